@@ -168,6 +168,7 @@ link_directories(${ITK_LIBRARY_DIRS})
 function(_configure_FactoryRegisterManager factory_type formats)
   set(LIST_OF_FACTORIES_REGISTRATION "")
   set(LIST_OF_FACTORY_NAMES "")
+  set(LIST_OF_FACTORY_NAME_STRINGS "")
 
   string(TOLOWER ${factory_type} _qualifier)
   foreach (format ${formats})
@@ -197,6 +198,9 @@ macro(ADD_FACTORY_REGISTRATION _registration_list_var _names_list_var _module_na
   set(${_registration_list_var}
     "${${_registration_list_var}}void ${_abi} ${_factory_name}FactoryRegister__Private();")
   set(${_names_list_var} "${${_names_list_var}}${_factory_name}FactoryRegister__Private,")
+  # name strings matching GetNameOfClass() of the factories, used for the
+  # deferred registration descriptors and the registration audit
+  set(LIST_OF_FACTORY_NAME_STRINGS "${LIST_OF_FACTORY_NAME_STRINGS}\"${_factory_name}Factory\",")
 endmacro()
 
 #-----------------------------------------------------------------------------
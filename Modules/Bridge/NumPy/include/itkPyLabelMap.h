@@ -0,0 +1,74 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#ifndef itkPyLabelMap_h
+#define itkPyLabelMap_h
+
+#include "itkLabelMap.h"
+
+// The python header defines _POSIX_C_SOURCE without a preceding #undef
+#undef _POSIX_C_SOURCE
+#undef _XOPEN_SOURCE
+#include <Python.h>
+
+namespace itk
+{
+
+/**
+ *\class PyLabelMap
+ *
+ *  \brief Helper class to export the run list of a LabelMap to python.
+ *
+ *  A LabelMap stores its pixels run-length encoded in the lines of its
+ *  LabelObjects, so there is no dense buffer to view. This class exports the
+ *  runs of all label objects into one contiguous python buffer without
+ *  densifying the label map into a label image first.
+ *
+ *  \ingroup ITKBridgeNumPy
+ */
+template <typename TLabelMap>
+class PyLabelMap
+{
+public:
+  /** Standard "Self" type alias. */
+  using Self = PyLabelMap;
+
+  /** Type of the label map from which the runs will be exported */
+  using LabelMapType = TLabelMap;
+  using LabelObjectType = typename LabelMapType::LabelObjectType;
+  using LineType = typename LabelObjectType::LineType;
+
+  /** Image dimension. */
+  static constexpr unsigned int ImageDimension = LabelMapType::ImageDimension;
+
+  /**
+   * Get a python bytearray with the runs of all label objects. Each run is
+   * ImageDimension + 2 consecutive int64 values: the label, the index of the
+   * first pixel of the run and the run length along the fastest axis.
+   */
+  static PyObject *
+  _GetRunsFromLabelMap(LabelMapType * labelMap);
+};
+
+} // namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkPyLabelMap.hxx"
+#endif
+
+#endif // _itkPyLabelMap_h
@@ -0,0 +1,79 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkPyLabelMap_hxx
+#define itkPyLabelMap_hxx
+
+#include "itkPyLabelMap.h"
+
+#include <cstdint>
+
+namespace itk
+{
+
+template <typename TLabelMap>
+PyObject *
+PyLabelMap<TLabelMap>::_GetRunsFromLabelMap(LabelMapType * labelMap)
+{
+  if (!labelMap)
+  {
+    throw std::runtime_error("Input label map is null");
+  }
+
+  labelMap->Update();
+
+  // Count the runs over all label objects to size the buffer in one pass
+  SizeValueType numberOfRuns = 0;
+  for (typename LabelMapType::ConstIterator labelIt(labelMap); !labelIt.IsAtEnd(); ++labelIt)
+  {
+    numberOfRuns += labelIt.GetLabelObject()->GetNumberOfLines();
+  }
+
+  constexpr unsigned int valuesPerRun = ImageDimension + 2;
+  const Py_ssize_t       len = (Py_ssize_t)(numberOfRuns * valuesPerRun * sizeof(int64_t));
+
+  // The bytearray owns its buffer, so the exported runs stay valid
+  // independently of the label map
+  PyObject * runList = PyByteArray_FromStringAndSize(NULL, len);
+  if (!runList)
+  {
+    return NULL;
+  }
+
+  auto * runs = reinterpret_cast<int64_t *>(PyByteArray_AsString(runList));
+  for (typename LabelMapType::ConstIterator labelIt(labelMap); !labelIt.IsAtEnd(); ++labelIt)
+  {
+    const LabelObjectType * labelObject = labelIt.GetLabelObject();
+    const auto              label = static_cast<int64_t>(labelObject->GetLabel());
+    for (typename LabelObjectType::ConstLineIterator lineIt(labelObject); !lineIt.IsAtEnd(); ++lineIt)
+    {
+      const LineType & line = lineIt.GetLine();
+      *runs++ = label;
+      for (unsigned int dim = 0; dim < ImageDimension; ++dim)
+      {
+        *runs++ = static_cast<int64_t>(line.GetIndex()[dim]);
+      }
+      *runs++ = static_cast<int64_t>(line.GetLength());
+    }
+  }
+
+  return runList;
+}
+
+} // namespace itk
+
+#endif
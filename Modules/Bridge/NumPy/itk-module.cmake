@@ -10,6 +10,8 @@ endif()
 itk_module(ITKBridgeNumPy
   DEPENDS
     ITKCommon
+  COMPILE_DEPENDS
+    ITKLabelMap
   TEST_DEPENDS
     ITKTestKernel
   ${_exclude_from_default}
@@ -0,0 +1,74 @@
+# ==========================================================================
+#
+#   Copyright NumFOCUS
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#          http://www.apache.org/licenses/LICENSE-2.0.txt
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+# ==========================================================================*/
+
+import unittest
+
+import itk
+import numpy as np
+
+
+class TestPyLabelMapRunExport(unittest.TestCase):
+    """This tests the run-list export of a LabelMap to a NumPy array."""
+
+    def setUp(self):
+        pass
+
+    def test_run_export_round_trip(self):
+        """The exported runs must reconstruct the dense label image."""
+
+        label_array = np.zeros((8, 12), dtype=np.uint8)
+        label_array[1, 2:7] = 1
+        label_array[2, 2:5] = 1
+        label_array[2, 6:9] = 2
+        label_array[5:7, 1:11] = 3
+
+        label_image = itk.GetImageFromArray(label_array)
+        ImageType = type(label_image)
+        LabelMapType = itk.LabelMap[itk.StatisticsLabelObject[itk.UL, 2]]
+        converter = itk.LabelImageToLabelMapFilter[ImageType, LabelMapType].New()
+        converter.SetInput(label_image)
+        converter.Update()
+        label_map = converter.GetOutput()
+
+        runs = itk.PyLabelMap[LabelMapType].GetRunsFromLabelMap(label_map)
+
+        self.assertEqual(runs.dtype, np.int64)
+        self.assertEqual(runs.ndim, 2)
+        self.assertEqual(runs.shape[1], 4)
+
+        # Reconstruct the dense array from the runs; each row is
+        # [label, index_i, index_j, length] with the index in i,j order
+        reconstructed = np.zeros(label_array.shape, dtype=np.uint8)
+        for label, index_i, index_j, length in runs:
+            reconstructed[index_j, index_i : index_i + length] = label
+
+        self.assertTrue(np.array_equal(reconstructed, label_array))
+
+        # The number of runs matches the lines of the label objects
+        number_of_lines = 0
+        for label in label_map.GetLabels():
+            number_of_lines += label_map.GetLabelObject(label).GetNumberOfLines()
+        self.assertEqual(runs.shape[0], number_of_lines)
+
+        # The runs stay valid after the label map is released
+        del label_map, converter
+        self.assertEqual(runs[0, 3], 5)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,74 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkAsynchronousPipelineUpdater_h
+#define itkAsynchronousPipelineUpdater_h
+
+#include "itkDataObject.h"
+#include "itkProcessObject.h"
+
+#include <future>
+#include <set>
+#include <vector>
+
+namespace itk
+{
+/** \class AsynchronousPipelineUpdater
+ * \brief Updates independent pipeline branches concurrently.
+ *
+ * The demand-driven pipeline updates strictly serially, filter by filter,
+ * even when branches do not share any upstream filter — for example the
+ * fixed and moving preprocessing chains of a registration. This utility
+ * walks the upstream filter graph of each requested output, groups outputs
+ * whose graphs share a filter (those must stay serial, since ProcessObject
+ * is not re-entrant), and updates the resulting independent groups
+ * concurrently on the global ThreadPool.
+ *
+ * The caller must not touch any object of the involved pipelines while an
+ * update is in flight.
+ *
+ * \sa ThreadPool
+ * \sa ProcessObject
+ * \ingroup ITKSystemObjects
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT AsynchronousPipelineUpdater
+{
+public:
+  /** Update all given pipeline outputs and block until they are up to
+   * date. Outputs whose upstream filter graphs are disjoint are updated
+   * concurrently; outputs sharing upstream filters are updated serially
+   * within one task, in the order given. The first exception thrown by any
+   * branch is rethrown after all branches have finished. */
+  static void
+  UpdateInParallel(const std::vector<DataObject::Pointer> & outputs);
+
+  /** Begin updating a single output on the global ThreadPool and return a
+   * future that becomes ready when the branch is up to date. Calling get()
+   * rethrows any exception from the update. The caller is responsible for
+   * not updating pipelines sharing upstream filters concurrently. */
+  static std::future<void>
+  UpdateAsynchronously(DataObject * output);
+
+  /** Collect the set of process objects upstream of (and including) the
+   * source of the given output. */
+  static std::set<ProcessObject *>
+  CollectUpstreamFilters(DataObject * output);
+};
+} // end namespace itk
+
+#endif
@@ -124,7 +124,13 @@ public:
   /** Compute and return the corners of the bounding box */
   itkLegacyMacro(const PointsContainer * GetCorners());
 
-  /** Method that actually computes bounding box. */
+  /** Method that actually computes bounding box. The reduction is
+   * chunked over the work units of the MultiThreaderBase; since taking
+   * the minimum and maximum is exact and order-independent, the result
+   * is identical to a serial sweep. The bounds are cached and only
+   * recomputed when the points have been modified; use ConsiderPoint()
+   * to expand cached bounds incrementally as points are inserted,
+   * without triggering a full recomputation. */
   bool
   ComputeBoundingBox() const;
 
@@ -28,6 +28,10 @@
 #ifndef itkBoundingBox_hxx
 #define itkBoundingBox_hxx
 #include "itkBoundingBox.h"
+#include "itkMultiThreaderBase.h"
+
+#include <algorithm>
+#include <vector>
 
 namespace itk
 {
@@ -157,33 +161,69 @@ BoundingBox<TPointIdentifier, VPointDimension, TCoordRep, TPointsContainer>::Com
       return false;
     }
 
-    PointsContainerConstIterator      ci = m_PointsContainer->Begin();
-    Point<TCoordRep, VPointDimension> point = ci->Value(); // point value
-    for (unsigned int i = 0; i < PointDimension; ++i)
+    // Snapshot the points, so that the reduction can be chunked over
+    // work units regardless of the points container type
+    std::vector<PointType> pointArray;
+    pointArray.reserve(m_PointsContainer->Size());
+    for (PointsContainerConstIterator ci = m_PointsContainer->Begin(); ci != m_PointsContainer->End(); ++ci)
     {
-      m_Bounds[2 * i] = point[i];
-      m_Bounds[2 * i + 1] = point[i];
+      pointArray.push_back(ci->Value());
     }
-    ++ci;
 
-    // use a const iterator to grab the points and compute
-    // the bounding box.
-    while (ci != m_PointsContainer->End())
+    // Each chunk reduces a contiguous range into local bounds; since
+    // taking the minimum and maximum is exact and order-independent, the
+    // merged result is identical to a serial sweep.
+    MultiThreaderBase::Pointer threader = MultiThreaderBase::New();
+    const SizeValueType        numberOfChunks =
+      std::min(static_cast<SizeValueType>(threader->GetNumberOfWorkUnits()), static_cast<SizeValueType>(pointArray.size()));
+    std::vector<BoundsArrayType> chunkBounds(numberOfChunks);
+    threader->ParallelizeArray(
+      0,
+      numberOfChunks,
+      [numberOfChunks, &pointArray, &chunkBounds](SizeValueType chunk) {
+        const SizeValueType begin = chunk * pointArray.size() / numberOfChunks;
+        const SizeValueType end = (chunk + 1) * pointArray.size() / numberOfChunks;
+
+        BoundsArrayType bounds;
+        for (unsigned int i = 0; i < PointDimension; ++i)
+        {
+          bounds[2 * i] = pointArray[begin][i];
+          bounds[2 * i + 1] = pointArray[begin][i];
+        }
+        for (SizeValueType index = begin + 1; index < end; ++index)
+        {
+          const PointType & point = pointArray[index];
+          for (unsigned int i = 0; i < PointDimension; ++i)
+          {
+            if (point[i] < bounds[2 * i])
+            {
+              bounds[2 * i] = point[i];
+            }
+            if (point[i] > bounds[2 * i + 1])
+            {
+              bounds[2 * i + 1] = point[i];
+            }
+          }
+        }
+        chunkBounds[chunk] = bounds;
+      },
+      nullptr);
+
+    m_Bounds = chunkBounds[0];
+    for (SizeValueType chunk = 1; chunk < numberOfChunks; ++chunk)
     {
-      point = ci->Value(); // point value
       for (unsigned int i = 0; i < PointDimension; ++i)
       {
-        if (point[i] < m_Bounds[2 * i])
+        if (chunkBounds[chunk][2 * i] < m_Bounds[2 * i])
         {
-          m_Bounds[2 * i] = point[i];
+          m_Bounds[2 * i] = chunkBounds[chunk][2 * i];
         }
-        if (point[i] > m_Bounds[2 * i + 1])
+        if (chunkBounds[chunk][2 * i + 1] > m_Bounds[2 * i + 1])
         {
-          m_Bounds[2 * i + 1] = point[i];
+          m_Bounds[2 * i + 1] = chunkBounds[chunk][2 * i + 1];
         }
       }
-      ++ci;
-    } // for all points in container
+    }
 
     m_BoundsMTime.Modified();
   }
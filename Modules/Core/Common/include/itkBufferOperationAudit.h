@@ -0,0 +1,110 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkBufferOperationAudit_h
+#define itkBufferOperationAudit_h
+
+#include "itkIntTypes.h"
+#include "itkMacro.h"
+
+#include <vector>
+
+namespace itk
+{
+/** \class BufferOperationAudit
+ * \brief Records buffer allocations, copies and grafts during an Update.
+ *
+ * Composite filters built as mini-pipelines are expected to graft their
+ * internal outputs instead of copying them, but a deep copy hiding in a
+ * forty-filter pipeline is invisible from the outside. While recording
+ * is on, every output allocation in ImageSource::AllocateOutputs, every
+ * region copy through ImageAlgorithm::Copy and every
+ * ImageSource::GraftOutput is appended to a global record list.
+ * GetAvoidableCopies() then flags the copies that look like missed
+ * grafts: full-buffer copies whose source buffer is never referenced
+ * again.
+ *
+ * Recording is process-global and thread-safe; the reported pointers
+ * identify the participating image objects. The audit is a development
+ * diagnostic — recording adds a lock per reported operation, so leave it
+ * off in production runs.
+ *
+ * \sa ImageAlgorithm
+ * \sa ImageSource
+ * \ingroup ITKSystemObjects
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT BufferOperationAudit
+{
+public:
+  enum class OperationEnum : uint8_t
+  {
+    Allocate,
+    Copy,
+    Graft
+  };
+
+  /** One recorded buffer operation. */
+  struct Record
+  {
+    OperationEnum Operation;
+
+    /** The image read from; null for allocations. */
+    const void * Source;
+
+    /** The image written to, allocated, or grafted onto. */
+    const void * Destination;
+
+    /** Number of pixels allocated or copied; zero for grafts. */
+    SizeValueType Pixels;
+
+    /** True when a copy covers the source's whole buffered region. */
+    bool FullBuffer;
+  };
+
+  /** Clear previous records and start recording. */
+  static void
+  Start();
+
+  /** Stop recording; the records remain available. */
+  static void
+  Stop();
+
+  static bool
+  IsRecording();
+
+  /** The operations recorded since the last Start(), in order. */
+  static std::vector<Record>
+  GetRecords();
+
+  /** The recorded copies that look like missed grafts: copies of a full
+   * source buffer whose source is never referenced by a later recorded
+   * operation. */
+  static std::vector<Record>
+  GetAvoidableCopies();
+
+  /** Reporting entry points used by the instrumented call sites. */
+  static void
+  ReportAllocation(const void * destination, SizeValueType pixels);
+  static void
+  ReportCopy(const void * source, const void * destination, SizeValueType pixels, bool fullBuffer);
+  static void
+  ReportGraft(const void * source, const void * destination);
+};
+} // end namespace itk
+
+#endif
@@ -0,0 +1,434 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkCompactVectorContainer_h
+#define itkCompactVectorContainer_h
+
+#include "itkObject.h"
+#include "itkObjectFactory.h"
+
+#include <vector>
+
+namespace itk
+{
+/** \class CompactVectorContainer
+ *  \brief An indexed container with contiguous element storage and
+ *         stable identifiers under deletion.
+ *
+ * This container conforms to the IndexedContainerInterface like
+ * VectorContainer, and like VectorContainer it stores its elements in a
+ * contiguous STL vector indexed by the element identifier. Unlike
+ * VectorContainer it keeps a validity flag per element slot: DeleteIndex
+ * tombstones the slot instead of erasing it, so the identifiers of the
+ * remaining elements never shift, and the iterators skip the tombstoned
+ * slots. This makes the container usable as the point and cell storage
+ * of meshes that are edited after creation, while iterating the
+ * container remains a forward walk over contiguous memory.
+ *
+ * Size() returns the number of valid elements, which can be smaller than
+ * the index range of the container.
+ *
+ * \tparam TElementIdentifier An INTEGRAL type for use in indexing the vector.
+ *
+ * \tparam TElement The element type stored in the container.
+ *
+ * \sa VectorContainer
+ * \sa MapContainer
+ *
+ * \ingroup DataRepresentation
+ * \ingroup ITKCommon
+ */
+template <typename TElementIdentifier, typename TElement>
+class ITK_TEMPLATE_EXPORT CompactVectorContainer : public Object
+{
+public:
+  /** Standard class type aliases. */
+  using Self = CompactVectorContainer;
+  using Superclass = Object;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Save the template parameters. */
+  using ElementIdentifier = TElementIdentifier;
+  using Element = TElement;
+
+private:
+  /** The types of the element storage and the validity flags. */
+  using VectorType = std::vector<Element>;
+  using size_type = typename VectorType::size_type;
+  using ValidityVectorType = std::vector<bool>;
+
+protected:
+  CompactVectorContainer() = default;
+
+public:
+  /** This type is provided to Adapt this container as an STL container */
+  using STLContainerType = VectorType;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Standard part of every itk Object. */
+  itkTypeMacro(CompactVectorContainer, Object);
+
+  /** Convenient type alias for the iterator and const iterator. */
+  class Iterator;
+  class ConstIterator;
+
+  using reference = typename VectorType::reference;
+  using const_reference = typename VectorType::const_reference;
+
+  /** Cast the element storage to a const STL container type. The
+   * tombstoned slots hold default elements. */
+  const STLContainerType &
+  CastToSTLConstContainer() const noexcept
+  {
+    return m_Elements;
+  }
+
+  /** Friends to this class. */
+  friend class Iterator;
+  friend class ConstIterator;
+
+  /** \class Iterator
+   * Simulate STL-map style iteration where dereferencing the iterator
+   * gives access to both the index and the value. Incrementing and
+   * decrementing skip the tombstoned slots.
+   * \ingroup ITKCommon
+   */
+  class Iterator
+  {
+  public:
+    Iterator() = default;
+    Iterator(Self * container, size_type pos)
+      : m_Container(container)
+      , m_Pos(pos)
+    {}
+    Iterator & operator*() { return *this; }
+    Iterator * operator->() { return this; }
+    Iterator &
+    operator++()
+    {
+      ++m_Pos;
+      while (m_Pos < m_Container->m_Elements.size() && !m_Container->m_ElementIsValid[m_Pos])
+      {
+        ++m_Pos;
+      }
+      return *this;
+    }
+    Iterator
+    operator++(int)
+    {
+      Iterator temp(*this);
+      ++(*this);
+      return temp;
+    }
+    Iterator &
+    operator--()
+    {
+      --m_Pos;
+      while (m_Pos > 0 && !m_Container->m_ElementIsValid[m_Pos])
+      {
+        --m_Pos;
+      }
+      return *this;
+    }
+    Iterator
+    operator--(int)
+    {
+      Iterator temp(*this);
+      --(*this);
+      return temp;
+    }
+
+    bool
+    operator==(const Iterator & r) const
+    {
+      return m_Pos == r.m_Pos;
+    }
+
+    ITK_UNEQUAL_OPERATOR_MEMBER_FUNCTION(Iterator);
+
+    bool
+    operator==(const ConstIterator & r) const
+    {
+      return m_Pos == r.m_Pos;
+    }
+
+    ITK_UNEQUAL_OPERATOR_MEMBER_FUNCTION(ConstIterator);
+
+    /** Get the index into the CompactVectorContainer associated with this
+     * iterator. */
+    ElementIdentifier
+    Index() const
+    {
+      return static_cast<ElementIdentifier>(m_Pos);
+    }
+
+    /** Get the value at this iterator's location in the
+     * CompactVectorContainer. */
+    reference
+    Value() const
+    {
+      return m_Container->m_Elements[m_Pos];
+    }
+
+  private:
+    Self *    m_Container{ nullptr };
+    size_type m_Pos{ 0 };
+    friend class ConstIterator;
+  };
+
+  /** \class ConstIterator
+   * Simulate STL-map style const iteration where dereferencing the
+   * iterator gives read access to both the index and the value.
+   * Incrementing and decrementing skip the tombstoned slots.
+   * \ingroup ITKCommon
+   */
+  class ConstIterator
+  {
+  public:
+    ConstIterator() = default;
+    ConstIterator(const Self * container, size_type pos)
+      : m_Container(container)
+      , m_Pos(pos)
+    {}
+    ConstIterator(const Iterator & r)
+      : m_Container(r.m_Container)
+      , m_Pos(r.m_Pos)
+    {}
+    ConstIterator & operator*() { return *this; }
+    ConstIterator * operator->() { return this; }
+    ConstIterator &
+    operator++()
+    {
+      ++m_Pos;
+      while (m_Pos < m_Container->m_Elements.size() && !m_Container->m_ElementIsValid[m_Pos])
+      {
+        ++m_Pos;
+      }
+      return *this;
+    }
+    ConstIterator
+    operator++(int)
+    {
+      ConstIterator temp(*this);
+      ++(*this);
+      return temp;
+    }
+    ConstIterator &
+    operator--()
+    {
+      --m_Pos;
+      while (m_Pos > 0 && !m_Container->m_ElementIsValid[m_Pos])
+      {
+        --m_Pos;
+      }
+      return *this;
+    }
+    ConstIterator
+    operator--(int)
+    {
+      ConstIterator temp(*this);
+      --(*this);
+      return temp;
+    }
+    ConstIterator &
+    operator=(const Iterator & r)
+    {
+      m_Container = r.m_Container;
+      m_Pos = r.m_Pos;
+      return *this;
+    }
+
+    bool
+    operator==(const Iterator & r) const
+    {
+      return m_Pos == r.m_Pos;
+    }
+
+    ITK_UNEQUAL_OPERATOR_MEMBER_FUNCTION(Iterator);
+
+    bool
+    operator==(const ConstIterator & r) const
+    {
+      return m_Pos == r.m_Pos;
+    }
+
+    ITK_UNEQUAL_OPERATOR_MEMBER_FUNCTION(ConstIterator);
+
+    /** Get the index into the CompactVectorContainer associated with this
+     * iterator. */
+    ElementIdentifier
+    Index() const
+    {
+      return static_cast<ElementIdentifier>(m_Pos);
+    }
+
+    /** Get the value at this iterator's location in the
+     * CompactVectorContainer. */
+    const_reference
+    Value() const
+    {
+      return m_Container->m_Elements[m_Pos];
+    }
+
+  private:
+    const Self * m_Container{ nullptr };
+    size_type    m_Pos{ 0 };
+    friend class Iterator;
+  };
+
+  /* Declare the public interface routines. */
+
+  /**
+   * Get a reference to the element at the given index.
+   * It is assumed that the index exists, and it will not automatically
+   * be created.
+   *
+   * It is assumed that the value of the element is modified through the
+   * reference.
+   */
+  reference ElementAt(ElementIdentifier);
+
+  /**
+   * Get a reference to the element at the given index.
+   * It is assumed that the index exists, and it will not automatically
+   * be created.
+   */
+  const_reference ElementAt(ElementIdentifier) const;
+
+  /**
+   * Get a reference to the element at the given index.
+   * If the element location does not exist, it will be created with a
+   * default element value.
+   *
+   * It is assumed that the value of the element is modified through the
+   * reference.
+   */
+  reference CreateElementAt(ElementIdentifier);
+
+  /**
+   * Read the element from the given index.
+   * It is assumed that the index exists.
+   */
+  Element GetElement(ElementIdentifier) const;
+
+  /**
+   * Set the element value at the given index.
+   * It is assumed that the index exists.
+   */
+  void SetElement(ElementIdentifier, Element);
+
+  /**
+   * Set the element value at the given index.
+   * If the element location does not exist, it will be created with a
+   * default element value.
+   */
+  void InsertElement(ElementIdentifier, Element);
+
+  /**
+   * Check if the given index holds a valid (non-tombstoned) element.
+   */
+  bool IndexExists(ElementIdentifier) const;
+
+  /**
+   * Check if the given index holds a valid element.  If it does not,
+   * return false.  Otherwise, set the element through the pointer (if it
+   * isn't nullptr), and return true.
+   */
+  bool
+  GetElementIfIndexExists(ElementIdentifier, Element *) const;
+
+  /**
+   * Make sure that the index range of the container is large enough to
+   * allow the given index, expanding it if necessary.  The index will
+   * contain the default element and is marked valid.
+   */
+  void CreateIndex(ElementIdentifier);
+
+  /**
+   * Delete the element defined by the index identifier.  The slot is
+   * tombstoned: it is overwritten with the default element and skipped
+   * by the iterators, and the identifiers of the remaining elements do
+   * not change.
+   */
+  void DeleteIndex(ElementIdentifier);
+
+  /**
+   * Get a begin const iterator for the container.
+   */
+  ConstIterator
+  Begin() const;
+
+  /**
+   * Get an end const iterator for the container.
+   */
+  ConstIterator
+  End() const;
+
+  /**
+   * Get a begin iterator for the container.
+   */
+  Iterator
+  Begin();
+
+  /**
+   * Get an end iterator for the container.
+   */
+  Iterator
+  End();
+
+  /**
+   * Get the number of valid elements currently stored in the container.
+   */
+  ElementIdentifier
+  Size() const;
+
+  /**
+   * Tell the container to allocate enough memory to allow at least as
+   * many elements as the size given to be stored.  This implementation
+   * allocates contiguous storage for the elements and their validity
+   * flags.
+   */
+  void Reserve(ElementIdentifier);
+
+  /**
+   * Tell the container to try to minimize its memory usage for storage
+   * of the current number of elements.
+   */
+  void
+  Squeeze();
+
+  /**
+   * Clear the elements. The final size will be zero.
+   */
+  void
+  Initialize();
+
+private:
+  VectorType         m_Elements;
+  ValidityVectorType m_ElementIsValid;
+  ElementIdentifier  m_NumberOfValidElements{ 0 };
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkCompactVectorContainer.hxx"
+#endif
+
+#endif
@@ -0,0 +1,264 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkCompactVectorContainer_hxx
+#define itkCompactVectorContainer_hxx
+
+#include "itkCompactVectorContainer.h"
+
+#include "itkNumericTraits.h"
+
+namespace itk
+{
+
+/**
+ * Get a reference to the element at the given index.
+ */
+template <typename TElementIdentifier, typename TElement>
+auto
+CompactVectorContainer<TElementIdentifier, TElement>::ElementAt(ElementIdentifier id) -> reference
+{
+  this->Modified();
+  return m_Elements[id];
+}
+
+/**
+ * Get a reference to the element at the given index.
+ */
+template <typename TElementIdentifier, typename TElement>
+auto
+CompactVectorContainer<TElementIdentifier, TElement>::ElementAt(ElementIdentifier id) const -> const_reference
+{
+  return m_Elements[id];
+}
+
+/**
+ * Get a reference to the element at the given index, creating the index
+ * if necessary.
+ */
+template <typename TElementIdentifier, typename TElement>
+auto
+CompactVectorContainer<TElementIdentifier, TElement>::CreateElementAt(ElementIdentifier id) -> reference
+{
+  this->CreateIndex(id);
+  return m_Elements[id];
+}
+
+/**
+ * Read the element from the given index.
+ */
+template <typename TElementIdentifier, typename TElement>
+auto
+CompactVectorContainer<TElementIdentifier, TElement>::GetElement(ElementIdentifier id) const -> Element
+{
+  return m_Elements[id];
+}
+
+/**
+ * Set the element value at the given index.
+ */
+template <typename TElementIdentifier, typename TElement>
+void
+CompactVectorContainer<TElementIdentifier, TElement>::SetElement(ElementIdentifier id, Element element)
+{
+  m_Elements[id] = element;
+  if (!m_ElementIsValid[id])
+  {
+    m_ElementIsValid[id] = true;
+    ++m_NumberOfValidElements;
+  }
+}
+
+/**
+ * Set the element value at the given index, expanding the index range
+ * of the container if necessary.
+ */
+template <typename TElementIdentifier, typename TElement>
+void
+CompactVectorContainer<TElementIdentifier, TElement>::InsertElement(ElementIdentifier id, Element element)
+{
+  this->CreateIndex(id);
+  m_Elements[id] = element;
+}
+
+/**
+ * Check if the given index holds a valid (non-tombstoned) element.
+ */
+template <typename TElementIdentifier, typename TElement>
+bool
+CompactVectorContainer<TElementIdentifier, TElement>::IndexExists(ElementIdentifier id) const
+{
+  return (NumericTraits<ElementIdentifier>::IsNonnegative(id) && (static_cast<size_type>(id) < m_Elements.size()) &&
+          m_ElementIsValid[id]);
+}
+
+/**
+ * If the given index holds a valid element, copy it through the pointer
+ * and return true.
+ */
+template <typename TElementIdentifier, typename TElement>
+bool
+CompactVectorContainer<TElementIdentifier, TElement>::GetElementIfIndexExists(ElementIdentifier id,
+                                                                              Element *         element) const
+{
+  if (this->IndexExists(id))
+  {
+    if (element)
+    {
+      *element = m_Elements[id];
+    }
+    return true;
+  }
+  return false;
+}
+
+/**
+ * Make sure that the index range of the container is large enough to
+ * allow the given index, expanding it if necessary.
+ */
+template <typename TElementIdentifier, typename TElement>
+void
+CompactVectorContainer<TElementIdentifier, TElement>::CreateIndex(ElementIdentifier id)
+{
+  if (static_cast<size_type>(id) >= m_Elements.size())
+  {
+    m_Elements.resize(static_cast<size_type>(id) + 1);
+    m_ElementIsValid.resize(static_cast<size_type>(id) + 1, false);
+  }
+  if (!m_ElementIsValid[id])
+  {
+    m_ElementIsValid[id] = true;
+    ++m_NumberOfValidElements;
+    this->Modified();
+  }
+}
+
+/**
+ * Tombstone the element defined by the index identifier: overwrite the
+ * slot with the default element and mark it invalid, keeping the
+ * identifiers of the remaining elements unchanged.
+ */
+template <typename TElementIdentifier, typename TElement>
+void
+CompactVectorContainer<TElementIdentifier, TElement>::DeleteIndex(ElementIdentifier id)
+{
+  if (this->IndexExists(id))
+  {
+    m_Elements[id] = Element();
+    m_ElementIsValid[id] = false;
+    --m_NumberOfValidElements;
+    this->Modified();
+  }
+}
+
+/**
+ * Get a begin const iterator for the container.
+ */
+template <typename TElementIdentifier, typename TElement>
+auto
+CompactVectorContainer<TElementIdentifier, TElement>::Begin() const -> ConstIterator
+{
+  size_type pos = 0;
+  while (pos < m_Elements.size() && !m_ElementIsValid[pos])
+  {
+    ++pos;
+  }
+  return ConstIterator(this, pos);
+}
+
+/**
+ * Get an end const iterator for the container.
+ */
+template <typename TElementIdentifier, typename TElement>
+auto
+CompactVectorContainer<TElementIdentifier, TElement>::End() const -> ConstIterator
+{
+  return ConstIterator(this, m_Elements.size());
+}
+
+/**
+ * Get a begin iterator for the container.
+ */
+template <typename TElementIdentifier, typename TElement>
+auto
+CompactVectorContainer<TElementIdentifier, TElement>::Begin() -> Iterator
+{
+  size_type pos = 0;
+  while (pos < m_Elements.size() && !m_ElementIsValid[pos])
+  {
+    ++pos;
+  }
+  return Iterator(this, pos);
+}
+
+/**
+ * Get an end iterator for the container.
+ */
+template <typename TElementIdentifier, typename TElement>
+auto
+CompactVectorContainer<TElementIdentifier, TElement>::End() -> Iterator
+{
+  return Iterator(this, m_Elements.size());
+}
+
+/**
+ * Get the number of valid elements currently stored in the container.
+ */
+template <typename TElementIdentifier, typename TElement>
+auto
+CompactVectorContainer<TElementIdentifier, TElement>::Size() const -> ElementIdentifier
+{
+  return m_NumberOfValidElements;
+}
+
+/**
+ * Allocate memory for at the requested number of elements.
+ */
+template <typename TElementIdentifier, typename TElement>
+void
+CompactVectorContainer<TElementIdentifier, TElement>::Reserve(ElementIdentifier sz)
+{
+  m_Elements.reserve(sz);
+  m_ElementIsValid.reserve(sz);
+}
+
+/**
+ * Try to minimize the memory usage for storage of the current number of
+ * elements.
+ */
+template <typename TElementIdentifier, typename TElement>
+void
+CompactVectorContainer<TElementIdentifier, TElement>::Squeeze()
+{
+  m_Elements.shrink_to_fit();
+  m_ElementIsValid.shrink_to_fit();
+}
+
+/**
+ * Clear the elements. The final size will be zero.
+ */
+template <typename TElementIdentifier, typename TElement>
+void
+CompactVectorContainer<TElementIdentifier, TElement>::Initialize()
+{
+  m_Elements.clear();
+  m_ElementIsValid.clear();
+  m_NumberOfValidElements = NumericTraits<ElementIdentifier>::ZeroValue();
+}
+} // end namespace itk
+
+#endif
@@ -0,0 +1,107 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkCompensatedSummationArray_h
+#define itkCompensatedSummationArray_h
+
+#include "itkCompensatedSummation.h"
+#include "itkIntTypes.h"
+
+namespace itk
+{
+class MultiThreaderBase;
+
+/** \class CompensatedSummationArray
+ * \brief Lane-parallel compensated accumulation of floating point numbers.
+ *
+ * CompensatedSummation carries a single sum/compensation pair, so every
+ * addition depends on the previous one and a long reduction is bound by the
+ * latency of the dependent floating point add chain. This class carries
+ * VLaneCount independent sum/compensation pairs instead: AddSpan distributes
+ * consecutive elements round-robin over the lanes, so the lane updates have
+ * no cross-iteration dependence and the compiler can keep several additions
+ * in flight (or vectorize the lane loop outright). GetSum folds the lanes
+ * with a final compensated pass.
+ *
+ * The result is deterministic for a given element order and lane count, but
+ * differs from strictly sequential Kahan summation by the (compensated)
+ * reassociation over lanes.
+ *
+ * ParallelSum additionally splits a buffer into per-work-unit chunks through
+ * MultiThreaderBase and folds the per-chunk accumulators, for reductions
+ * that are large enough to be worth threading.
+ *
+ * \sa CompensatedSummation
+ * \ingroup ITKCommon
+ */
+template <typename TFloat, unsigned int VLaneCount = 8>
+class ITK_TEMPLATE_EXPORT CompensatedSummationArray
+{
+public:
+  /** Type of the input elements. */
+  using FloatType = TFloat;
+
+  /** Type used for the sums and compensations. */
+  using AccumulateType = typename NumericTraits<FloatType>::AccumulateType;
+
+  /** Standard class type aliases. */
+  using Self = CompensatedSummationArray;
+
+  /** Number of independent accumulator lanes. */
+  static constexpr unsigned int LaneCount = VLaneCount;
+
+  CompensatedSummationArray();
+
+  /** Add a single element; consecutive calls rotate through the lanes. */
+  void
+  AddElement(const FloatType & element);
+
+  /** Add a contiguous run of elements, distributed over the lanes. */
+  void
+  AddSpan(const FloatType * buffer, SizeValueType count);
+
+  /** Merge another accumulator lane by lane. */
+  Self &
+  operator+=(const Self & rhs);
+
+  /** Reset all lanes to zero. */
+  void
+  ResetToZero();
+
+  /** Fold the lanes into the total with a final compensated pass. */
+  AccumulateType
+  GetSum() const;
+
+  /** Sum a contiguous buffer, splitting it into per-work-unit chunks through
+   * the given threader and folding the per-chunk accumulators. Falls back to
+   * a single chunk for buffers too small to be worth threading. */
+  static AccumulateType
+  ParallelSum(const FloatType * buffer, SizeValueType count, MultiThreaderBase * threader);
+
+private:
+  AccumulateType m_Sum[VLaneCount];
+  AccumulateType m_Compensation[VLaneCount];
+  unsigned int   m_NextLane{ 0 };
+};
+
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkCompensatedSummationArray.hxx"
+#endif
+
+#endif
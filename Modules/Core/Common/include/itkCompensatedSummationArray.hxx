@@ -0,0 +1,157 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkCompensatedSummationArray_hxx
+#define itkCompensatedSummationArray_hxx
+
+#include "itkCompensatedSummationArray.h"
+#include "itkMultiThreaderBase.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace itk
+{
+
+template <typename TFloat, unsigned int VLaneCount>
+CompensatedSummationArray<TFloat, VLaneCount>::CompensatedSummationArray()
+{
+  this->ResetToZero();
+}
+
+template <typename TFloat, unsigned int VLaneCount>
+void
+CompensatedSummationArray<TFloat, VLaneCount>::ResetToZero()
+{
+  for (unsigned int lane = 0; lane < VLaneCount; ++lane)
+  {
+    m_Sum[lane] = NumericTraits<AccumulateType>::ZeroValue();
+    m_Compensation[lane] = NumericTraits<AccumulateType>::ZeroValue();
+  }
+  m_NextLane = 0;
+}
+
+template <typename TFloat, unsigned int VLaneCount>
+void
+CompensatedSummationArray<TFloat, VLaneCount>::AddElement(const FloatType & element)
+{
+  CompensatedSummationAddElement(
+    m_Compensation[m_NextLane], m_Sum[m_NextLane], static_cast<AccumulateType>(element));
+  m_NextLane = (m_NextLane + 1) % VLaneCount;
+}
+
+// The same reassociation guards as for CompensatedSummationAddElement: the
+// compensation term must not be algebraically simplified away.
+#ifdef __INTEL_COMPILER
+#  pragma optimize("", off)
+#endif // __INTEL_COMPILER
+#ifdef _MSC_VER
+#  pragma float_control(push)
+#  pragma float_control(precise, on)
+#endif // _MSC_VER
+template <typename TFloat, unsigned int VLaneCount>
+void
+CompensatedSummationArray<TFloat, VLaneCount>::AddSpan(const FloatType * buffer, const SizeValueType count)
+{
+  const SizeValueType blockEnd = count - (count % VLaneCount);
+  for (SizeValueType i = 0; i < blockEnd; i += VLaneCount)
+  {
+    // The lanes are independent, so this loop has no cross-iteration
+    // dependence and can be kept in flight or vectorized; the compensated
+    // update itself stays in strict evaluation order within each lane.
+    for (unsigned int lane = 0; lane < VLaneCount; ++lane)
+    {
+      const auto           compensatedInput = static_cast<AccumulateType>(buffer[i + lane]) - m_Compensation[lane];
+      const AccumulateType tempSum = m_Sum[lane] + compensatedInput;
+      // Warning: watch out for the compiler optimizing this out!
+      m_Compensation[lane] = (tempSum - m_Sum[lane]) - compensatedInput;
+      m_Sum[lane] = tempSum;
+    }
+  }
+  for (SizeValueType i = blockEnd; i < count; ++i)
+  {
+    this->AddElement(buffer[i]);
+  }
+}
+#ifdef __INTEL_COMPILER
+#  pragma optimize("", on)
+#endif // __INTEL_COMPILER
+#ifdef _MSC_VER
+#  pragma float_control(pop)
+#endif // _MSC_VER
+
+template <typename TFloat, unsigned int VLaneCount>
+auto
+CompensatedSummationArray<TFloat, VLaneCount>::operator+=(const Self & rhs) -> Self &
+{
+  for (unsigned int lane = 0; lane < VLaneCount; ++lane)
+  {
+    CompensatedSummationAddElement(m_Compensation[lane], m_Sum[lane], rhs.m_Compensation[lane]);
+    CompensatedSummationAddElement(m_Compensation[lane], m_Sum[lane], rhs.m_Sum[lane]);
+  }
+  return *this;
+}
+
+template <typename TFloat, unsigned int VLaneCount>
+auto
+CompensatedSummationArray<TFloat, VLaneCount>::GetSum() const -> AccumulateType
+{
+  AccumulateType sum = NumericTraits<AccumulateType>::ZeroValue();
+  AccumulateType compensation = NumericTraits<AccumulateType>::ZeroValue();
+  for (unsigned int lane = 0; lane < VLaneCount; ++lane)
+  {
+    CompensatedSummationAddElement(compensation, sum, m_Compensation[lane]);
+    CompensatedSummationAddElement(compensation, sum, m_Sum[lane]);
+  }
+  return sum;
+}
+
+template <typename TFloat, unsigned int VLaneCount>
+auto
+CompensatedSummationArray<TFloat, VLaneCount>::ParallelSum(const FloatType *   buffer,
+                                                           const SizeValueType count,
+                                                           MultiThreaderBase * threader) -> AccumulateType
+{
+  // Do not spread tiny reductions over threads; each chunk should amortize
+  // the work unit dispatch.
+  constexpr SizeValueType minimumChunkLength = SizeValueType{ 1 } << 14;
+  const SizeValueType     chunkCount =
+    std::max<SizeValueType>(std::min<SizeValueType>(threader->GetNumberOfWorkUnits(), count / minimumChunkLength), 1);
+  const SizeValueType chunkLength = count / chunkCount;
+
+  std::vector<Self> partialSums(chunkCount);
+  threader->ParallelizeArray(
+    0,
+    chunkCount,
+    [buffer, count, chunkCount, chunkLength, &partialSums](SizeValueType chunk) {
+      const SizeValueType begin = chunk * chunkLength;
+      const SizeValueType end = (chunk + 1 == chunkCount) ? count : begin + chunkLength;
+      partialSums[chunk].AddSpan(buffer + begin, end - begin);
+    },
+    nullptr);
+
+  Self total;
+  for (const Self & partialSum : partialSums)
+  {
+    total += partialSum;
+  }
+  return total.GetSum();
+}
+
+} // end namespace itk
+
+#endif
@@ -0,0 +1,139 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkConcurrentTimeProbesCollector_h
+#define itkConcurrentTimeProbesCollector_h
+
+#include "itkIntTypes.h"
+#include "ITKCommonExport.h"
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace itk
+{
+/** \class ConcurrentTimeProbesCollector
+ *  \brief Aggregates named, nestable time probes across threads and processes.
+ *
+ *  Unlike TimeProbesCollectorBase, Start() and Stop() may be called
+ *  concurrently from several threads; each thread keeps its own probe
+ *  buffer and its own scope stack. Probes nest: calling
+ *  Start("filter"), Start("stage"), Start("work-unit") records the
+ *  innermost interval under the hierarchical path
+ *  "filter/stage/work-unit", so a report over the collected paths reads
+ *  like a flame view of the pipeline.
+ *
+ *  The aggregated measurements can be written to a stream in a compact
+ *  binary form with DumpBinary() and folded into another collector with
+ *  MergeBinary(), allowing the reports of many concurrent processes to
+ *  be combined into one. The binary records are written in the native
+ *  byte order and are meant to be merged on the same architecture that
+ *  produced them.
+ *
+ *  \sa TimeProbesCollectorBase
+ *  \sa WorkUnitInstrumentation
+ *
+ * \ingroup ITKSystemObjects
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT ConcurrentTimeProbesCollector
+{
+public:
+  /** Aggregated measurements of one hierarchical probe path. */
+  struct ProbeRecord
+  {
+    std::string   Path;
+    SizeValueType Count;
+    double        TotalSeconds;
+    double        MinSeconds;
+    double        MaxSeconds;
+  };
+
+  /** Start a probe with a particular name on the calling thread. Probes
+   * started while another probe of the same thread is running become its
+   * children in the reported path. */
+  void
+  Start(const char * id);
+
+  /** Stop the innermost running probe of the calling thread. The name must
+   * match the one passed to the corresponding Start() call; an
+   * ExceptionObject is thrown otherwise. */
+  void
+  Stop(const char * id);
+
+  /** Get the measurements of all threads and all merged processes,
+   * aggregated by path and sorted by path. */
+  std::vector<ProbeRecord>
+  GetProbeRecords() const;
+
+  /** Report the aggregated measurements, one line per path. */
+  void
+  Report(std::ostream & os = std::cout) const;
+
+  /** Write the aggregated measurements in the binary probe format. */
+  void
+  DumpBinary(std::ostream & os) const;
+
+  /** Fold a binary dump written by DumpBinary(), possibly by another
+   * process, into this collector. An ExceptionObject is thrown when the
+   * stream does not hold a binary probe dump. */
+  void
+  MergeBinary(std::istream & is);
+
+  /** Discard all measurements. Probes currently running keep their start
+   * time and record normally when stopped. */
+  void
+  Clear();
+
+private:
+  using ClockType = std::chrono::steady_clock;
+
+  struct OpenProbe
+  {
+    std::string           Path;
+    ClockType::time_point Start;
+  };
+
+  struct Aggregate
+  {
+    SizeValueType Count{ 0 };
+    double        TotalSeconds{ 0.0 };
+    double        MinSeconds{ 0.0 };
+    double        MaxSeconds{ 0.0 };
+  };
+
+  struct ThreadData
+  {
+    std::vector<OpenProbe>           Stack;
+    std::map<std::string, Aggregate> Records;
+  };
+
+  ThreadData &
+  GetThreadData();
+
+  mutable std::mutex                    m_Mutex;
+  std::map<std::thread::id, ThreadData> m_Threads;
+  std::map<std::string, Aggregate>      m_Merged;
+};
+} // end namespace itk
+
+#endif // itkConcurrentTimeProbesCollector_h
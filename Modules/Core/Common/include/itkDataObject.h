@@ -34,6 +34,7 @@
 #include "itkWeakPointer.h"
 #include "itkRealTimeStamp.h"
 #include "itkObjectFactory.h"
+#include <vector>
 
 namespace itk
 {
@@ -388,6 +389,15 @@ public:
     return m_DataReleased;
   }
 
+  /** Return the number of bytes of bulk data currently held by this data
+   * object. Used for diagnostics, e.g. by the PipelineProfiler. Data objects
+   * that do not track their bulk data return 0. */
+  virtual SizeValueType
+  GetBufferSizeInBytes() const
+  {
+    return 0;
+  }
+
   /** Provides opportunity for the data object to insure internal
    * consistency before access. Also causes owning source/filter (if
    * any) to update itself. The Update() method is composed of
@@ -401,6 +411,13 @@ public:
   virtual void
   Update();
 
+  /** Standard Modified(), additionally pushing pipeline invalidation to
+   * the filters consuming this data object when
+   * ProcessObject::GetGlobalIncrementalPipelineInvalidation() is
+   * enabled. */
+  void
+  Modified() const override;
+
   /** Update the information for this DataObject so that it can be used
    * as an output of a ProcessObject.  This method is used in the pipeline
    * mechanism to propagate information and initialize the meta data
@@ -592,6 +609,19 @@ private:
   bool
   DisconnectSource(ProcessObject * arg, const DataObjectIdentifierType & name);
 
+  /** Register/deregister a filter consuming this data object as input.
+   * Called only from ProcessObject when inputs are (re)assigned. One
+   * entry is kept per input slot, so the same filter may legitimately
+   * appear several times. */
+  void
+  AddConsumer(ProcessObject * consumer);
+  void
+  RemoveConsumer(ProcessObject * consumer);
+
+  /** The filters consuming this data object as input. Used to push
+   * pipeline invalidation downstream; see InvalidatePipeline(). */
+  std::vector<ProcessObject *> m_Consumers;
+
   /** Only used to synchronize the global variable across static libraries.*/
   itkGetGlobalDeclarationMacro(bool, GlobalReleaseDataFlag);
 
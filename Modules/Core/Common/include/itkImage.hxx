@@ -30,6 +30,7 @@
 
 #include "itkImage.h"
 #include "itkProcessObject.h"
+#include "itkMultiThreaderBase.h"
 #include <algorithm>
 
 namespace itk
@@ -51,7 +52,50 @@ Image<TPixel, VImageDimension>::Allocate(bool initializePixels)
   this->ComputeOffsetTable();
   num = static_cast<SizeValueType>(this->GetOffsetTable()[VImageDimension]);
 
-  m_Buffer->Reserve(num, initializePixels);
+  // For large buffers, initialize in parallel with the same region
+  // partitioning a downstream threaded filter will use. Zeroing is
+  // memory-bandwidth-bound, and on NUMA machines this first-touches each
+  // page on the node of the thread that will later process it.
+  constexpr SizeValueType parallelInitializationThresholdInBytes = SizeValueType{ 1 } << 23; // 8 MiB
+  if (initializePixels && num * sizeof(TPixel) >= parallelInitializationThresholdInBytes)
+  {
+    m_Buffer->Reserve(num, false); // uninitialized, pages not yet faulted
+    MultiThreaderBase::Pointer multiThreader = MultiThreaderBase::New();
+    multiThreader->SetUpdateProgress(false);
+    multiThreader->template ParallelizeImageRegion<VImageDimension>(
+      this->GetBufferedRegion(),
+      [this](const RegionType & region) {
+        // Fill the raw buffer scanline by scanline. Iterators cannot be used
+        // here: their headers include itkImage.h themselves, so they are not
+        // available while this file is compiled as part of itkImage.h.
+        TPixel * const      buffer = m_Buffer->GetBufferPointer();
+        IndexType           index = region.GetIndex();
+        const SizeType &    size = region.GetSize();
+        const SizeValueType scanlineLength = size[0];
+        SizeValueType       numberOfScanlines = 1;
+        for (unsigned int i = 1; i < VImageDimension; ++i)
+        {
+          numberOfScanlines *= size[i];
+        }
+        for (SizeValueType scanline = 0; scanline < numberOfScanlines; ++scanline)
+        {
+          std::fill_n(buffer + this->ComputeOffset(index), scanlineLength, TPixel());
+          for (unsigned int i = 1; i < VImageDimension; ++i)
+          {
+            if (static_cast<SizeValueType>(++index[i] - region.GetIndex(i)) < size[i])
+            {
+              break;
+            }
+            index[i] = region.GetIndex(i);
+          }
+        }
+      },
+      nullptr);
+  }
+  else
+  {
+    m_Buffer->Reserve(num, initializePixels);
+  }
 }
 
 
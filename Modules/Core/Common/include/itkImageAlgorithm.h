@@ -18,6 +18,7 @@
 #ifndef itkImageAlgorithm_h
 #define itkImageAlgorithm_h
 
+#include "itkBufferOperationAudit.h"
 #include "itkImageRegionIterator.h"
 
 #include <type_traits>
@@ -28,6 +29,8 @@ namespace itk
 template <typename TPixelType, unsigned int VImageDimension>
 class VectorImage;
 
+class MultiThreaderBase;
+
 
 /** \class ImageAlgorithm
  *  \brief A container of static functions which can operate on Images
@@ -73,6 +76,11 @@ struct ImageAlgorithm
        const typename InputImageType::RegionType &  inRegion,
        const typename OutputImageType::RegionType & outRegion)
   {
+    if (BufferOperationAudit::IsRecording())
+    {
+      BufferOperationAudit::ReportCopy(
+        inImage, outImage, inRegion.GetNumberOfPixels(), inRegion == inImage->GetBufferedRegion());
+    }
     ImageAlgorithm::DispatchedCopy(inImage, outImage, inRegion, outRegion);
   }
 
@@ -86,6 +94,11 @@ struct ImageAlgorithm
   {
     using _ImageType1 = Image<TPixel1, VImageDimension>;
     using _ImageType2 = Image<TPixel2, VImageDimension>;
+    if (BufferOperationAudit::IsRecording())
+    {
+      BufferOperationAudit::ReportCopy(
+        inImage, outImage, inRegion.GetNumberOfPixels(), inRegion == inImage->GetBufferedRegion());
+    }
     ImageAlgorithm::DispatchedCopy(
       inImage,
       outImage,
@@ -103,6 +116,11 @@ struct ImageAlgorithm
   {
     using _ImageType1 = VectorImage<TPixel1, VImageDimension>;
     using _ImageType2 = VectorImage<TPixel2, VImageDimension>;
+    if (BufferOperationAudit::IsRecording())
+    {
+      BufferOperationAudit::ReportCopy(
+        inImage, outImage, inRegion.GetNumberOfPixels(), inRegion == inImage->GetBufferedRegion());
+    }
     ImageAlgorithm::DispatchedCopy(
       inImage,
       outImage,
@@ -113,6 +131,28 @@ struct ImageAlgorithm
 
   /// \endcond
 
+  /**
+   * \brief Copies a region from one image to another with the copy work
+   * split over the work units of a multi-threader.
+   *
+   * The region is divided along its outermost dimensions and each chunk is
+   * copied with Copy(), so each work unit benefits from the same
+   * scanline-contiguous buffer copy as the single-threaded path. Small
+   * regions fall back to a plain Copy() call, as they do not amortize the
+   * work unit dispatch. When \c threader is null a default-constructed
+   * multi-threader is used.
+   *
+   * Both images must have the same dimension and the two regions the same
+   * size.
+   */
+  template <typename InputImageType, typename OutputImageType>
+  static void
+  ParallelCopy(const InputImageType *                       inImage,
+               OutputImageType *                            outImage,
+               const typename InputImageType::RegionType &  inRegion,
+               const typename OutputImageType::RegionType & outRegion,
+               MultiThreaderBase *                          threader = nullptr);
+
   /**
    * \brief Sets the output region to the smallest
    * region of the output image that fully contains
@@ -22,6 +22,7 @@
 #include "itkArray.h"
 #include "itkImageRegionIterator.h"
 #include "itkImageScanlineIterator.h"
+#include "itkMultiThreaderBase.h"
 
 
 namespace itk
@@ -168,6 +169,48 @@ ImageAlgorithm::DispatchedCopy(const InputImageType *                       inIm
 }
 
 
+template <typename InputImageType, typename OutputImageType>
+void
+ImageAlgorithm::ParallelCopy(const InputImageType *                       inImage,
+                             OutputImageType *                            outImage,
+                             const typename InputImageType::RegionType &  inRegion,
+                             const typename OutputImageType::RegionType & outRegion,
+                             MultiThreaderBase *                          threader)
+{
+  static_assert(unsigned{ InputImageType::ImageDimension } == unsigned{ OutputImageType::ImageDimension },
+                "ParallelCopy requires images of the same dimension.");
+  constexpr unsigned int Dimension = OutputImageType::ImageDimension;
+
+  // Small copies do not amortize the work unit dispatch.
+  constexpr SizeValueType minimumPixelsToThread = SizeValueType{ 1 } << 18;
+  if (outRegion.GetNumberOfPixels() < minimumPixelsToThread)
+  {
+    ImageAlgorithm::Copy(inImage, outImage, inRegion, outRegion);
+    return;
+  }
+
+  typename MultiThreaderBase::Pointer localThreader;
+  if (threader == nullptr)
+  {
+    localThreader = MultiThreaderBase::New();
+    threader = localThreader;
+  }
+
+  threader->template ParallelizeImageRegion<Dimension>(
+    outRegion,
+    [inImage, outImage, &inRegion, &outRegion](const ImageRegion<Dimension> & outSubRegion) {
+      typename InputImageType::RegionType inSubRegion;
+      for (unsigned int d = 0; d < Dimension; ++d)
+      {
+        inSubRegion.SetIndex(d, inRegion.GetIndex(d) + (outSubRegion.GetIndex(d) - outRegion.GetIndex(d)));
+        inSubRegion.SetSize(d, outSubRegion.GetSize(d));
+      }
+      ImageAlgorithm::Copy(inImage, outImage, inSubRegion, outSubRegion);
+    },
+    nullptr);
+}
+
+
 template <typename InputImageType, typename OutputImageType>
 typename OutputImageType::RegionType
 ImageAlgorithm::EnlargeRegionOverBox(const typename InputImageType::RegionType & inputRegion,
@@ -0,0 +1,92 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkImageBufferAllocator_h
+#define itkImageBufferAllocator_h
+
+#include "itkLightObject.h"
+#include "itkObjectFactory.h"
+#include "itkIntTypes.h"
+
+namespace itk
+{
+/** \class ImageBufferAllocator
+ *  \brief Pluggable allocation strategy for image pixel buffers.
+ *
+ * The default implementation allocates with operator new[] and releases
+ * with operator delete[], matching the historical behavior of
+ * ImportImageContainer. Applications can derive from this class to supply
+ * a custom strategy -- for example an arena that hands back recycled,
+ * already-faulted or hugepage-backed buffers across pipeline Update()
+ * calls -- and install it on a container via
+ * ImportImageContainer::SetAllocator().
+ *
+ * A buffer returned by Allocate() is always released through the
+ * Deallocate() of the same allocator instance, even if the container's
+ * allocator is replaced while the buffer is alive.
+ *
+ * \tparam TElement The element type stored in the allocated buffers.
+ *
+ * \sa ImportImageContainer
+ * \ingroup ImageObjects
+ * \ingroup ITKCommon
+ */
+template <typename TElement>
+class ITK_TEMPLATE_EXPORT ImageBufferAllocator : public LightObject
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(ImageBufferAllocator);
+
+  /** Standard class type aliases. */
+  using Self = ImageBufferAllocator;
+  using Superclass = LightObject;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Save the template parameters. */
+  using Element = TElement;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Standard part of every itk Object. */
+  itkTypeMacro(ImageBufferAllocator, LightObject);
+
+  /** Allocate a buffer of at least the given number of elements. If
+   * UseDefaultConstructor is true, each element is initialized with the
+   * default constructor; POD types initialize to zero. Throws
+   * MemoryAllocationError when the allocation cannot be satisfied. */
+  virtual TElement *
+  Allocate(SizeValueType size, bool UseDefaultConstructor = false);
+
+  /** Release a buffer previously obtained from Allocate() of this
+   * allocator instance. The size argument is the element count that was
+   * passed to the matching Allocate() call. */
+  virtual void
+  Deallocate(TElement * buffer, SizeValueType size);
+
+protected:
+  ImageBufferAllocator() = default;
+  ~ImageBufferAllocator() override = default;
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkImageBufferAllocator.hxx"
+#endif
+
+#endif
@@ -0,0 +1,67 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkImageBufferAllocator_hxx
+#define itkImageBufferAllocator_hxx
+
+#include "itkImageBufferAllocator.h"
+#include "itkMacro.h"
+
+namespace itk
+{
+template <typename TElement>
+TElement *
+ImageBufferAllocator<TElement>::Allocate(SizeValueType size, bool UseDefaultConstructor)
+{
+  // Encapsulate all image memory allocation here to throw an
+  // exception when memory allocation fails even when the compiler
+  // does not do this by default.
+  TElement * data;
+
+  try
+  {
+    if (UseDefaultConstructor)
+    {
+      data = new TElement[size](); // POD types initialized to 0, others use default constructor.
+    }
+    else
+    {
+      data = new TElement[size]; // Faster but uninitialized
+    }
+  }
+  catch (...)
+  {
+    data = nullptr;
+  }
+  if (!data)
+  {
+    // We cannot construct an error string here because we may be out
+    // of memory.  Do not use the exception macro.
+    throw MemoryAllocationError(__FILE__, __LINE__, "Failed to allocate memory for image.", ITK_LOCATION);
+  }
+  return data;
+}
+
+template <typename TElement>
+void
+ImageBufferAllocator<TElement>::Deallocate(TElement * buffer, SizeValueType itkNotUsed(size))
+{
+  delete[] buffer;
+}
+} // end namespace itk
+
+#endif
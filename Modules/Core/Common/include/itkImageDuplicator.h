@@ -74,11 +74,30 @@ public:
   using ImageConstPointer = typename TInputImage::ConstPointer;
   using PixelType = typename TInputImage::PixelType;
   using IndexType = typename TInputImage::IndexType;
+  using PixelContainerType = typename TInputImage::PixelContainer;
 
   static constexpr unsigned int ImageDimension = ImageType::ImageDimension;
 
   itkSetConstObjectMacro(InputImage, ImageType);
 
+  /** When enabled, Update() produces a duplicate that shares the pixel
+   * container of the input instead of copying the buffer. The shared buffer
+   * is replaced by a private copy when writable access is first requested
+   * through the non-const GetOutput() (or GetModifiableOutput()), so
+   * duplicates that are only ever read cost no copy at all. The image object
+   * returned before the materialization remains valid: only its pixel
+   * container is exchanged.
+   *
+   * Note that the duplicate is only a faithful snapshot as long as the input
+   * buffer itself is not modified in place. In particular, do not feed the
+   * still-shared duplicate to a filter that may run in place
+   * (\sa InPlaceImageFilter), as such a filter would write into the shared
+   * buffer; request the output through the non-const GetOutput() first.
+   * Off by default. */
+  itkSetMacro(UseCopyOnWrite, bool);
+  itkGetConstMacro(UseCopyOnWrite, bool);
+  itkBooleanMacro(UseCopyOnWrite);
+
   /**
    * Provide an interface to match that
    * of other ProcessObjects
@@ -98,6 +117,8 @@ public:
   virtual ImageType *
   GetOutput()
   {
+    // Writable access: a copy-on-write duplicate must own its buffer.
+    this->EnsureExclusivePixelContainer();
     return this->m_DuplicateImage.GetPointer();
   }
 
@@ -106,6 +127,7 @@ public:
   virtual ImageType *
   GetModifiableOutput()
   {
+    this->EnsureExclusivePixelContainer();
     return this->m_DuplicateImage.GetPointer();
   }
 #endif
@@ -121,9 +143,16 @@ protected:
   PrintSelf(std::ostream & os, Indent indent) const override;
 
 private:
-  ImageConstPointer m_InputImage;
-  ImagePointer      m_DuplicateImage;
-  ModifiedTimeType  m_InternalImageTime;
+  /** If the duplicate still shares the input's pixel container, give it a
+   * private copy of the buffer. */
+  void
+  EnsureExclusivePixelContainer();
+
+  ImageConstPointer                    m_InputImage;
+  ImagePointer                         m_DuplicateImage;
+  typename PixelContainerType::Pointer m_SharedPixelContainer;
+  ModifiedTimeType                     m_InternalImageTime;
+  bool                                 m_UseCopyOnWrite{ false };
 };
 } // end namespace itk
 
@@ -56,6 +56,22 @@ ImageDuplicator<TInputImage>::Update()
   // Cache the timestamp
   m_InternalImageTime = t;
 
+  if (m_UseCopyOnWrite)
+  {
+    // Share the input's pixel container instead of copying the buffer. The
+    // shared container is replaced by a private copy when writable access is
+    // first requested (see EnsureExclusivePixelContainer).
+    m_DuplicateImage = ImageType::New();
+    m_DuplicateImage->CopyInformation(m_InputImage);
+    m_DuplicateImage->SetRequestedRegion(m_InputImage->GetRequestedRegion());
+    m_DuplicateImage->SetBufferedRegion(m_InputImage->GetBufferedRegion());
+    m_SharedPixelContainer = const_cast<PixelContainerType *>(m_InputImage->GetPixelContainer());
+    m_DuplicateImage->SetPixelContainer(m_SharedPixelContainer);
+    return;
+  }
+
+  m_SharedPixelContainer = nullptr;
+
   // Allocate the image
   m_DuplicateImage = ImageType::New();
   m_DuplicateImage->CopyInformation(m_InputImage);
@@ -63,7 +79,32 @@ ImageDuplicator<TInputImage>::Update()
   m_DuplicateImage->SetBufferedRegion(m_InputImage->GetBufferedRegion());
   m_DuplicateImage->Allocate();
   typename ImageType::RegionType region = m_InputImage->GetBufferedRegion();
-  ImageAlgorithm::Copy(m_InputImage.GetPointer(), m_DuplicateImage.GetPointer(), region, region);
+  ImageAlgorithm::ParallelCopy(m_InputImage.GetPointer(), m_DuplicateImage.GetPointer(), region, region);
+}
+
+template <typename TInputImage>
+void
+ImageDuplicator<TInputImage>::EnsureExclusivePixelContainer()
+{
+  if (m_SharedPixelContainer.IsNull() || m_DuplicateImage.IsNull() ||
+      m_DuplicateImage->GetPixelContainer() != m_SharedPixelContainer.GetPointer())
+  {
+    return;
+  }
+
+  // Copy the shared buffer into a private container, and exchange the
+  // containers on the existing duplicate, so that pointers to the duplicate
+  // image remain valid.
+  const auto privateImage = ImageType::New();
+  privateImage->CopyInformation(m_DuplicateImage);
+  privateImage->SetRequestedRegion(m_DuplicateImage->GetRequestedRegion());
+  privateImage->SetBufferedRegion(m_DuplicateImage->GetBufferedRegion());
+  privateImage->Allocate();
+  const typename ImageType::RegionType region = m_DuplicateImage->GetBufferedRegion();
+  ImageAlgorithm::ParallelCopy(m_DuplicateImage.GetPointer(), privateImage.GetPointer(), region, region);
+
+  m_DuplicateImage->SetPixelContainer(privateImage->GetPixelContainer());
+  m_SharedPixelContainer = nullptr;
 }
 
 template <typename TInputImage>
@@ -74,6 +115,7 @@ ImageDuplicator<TInputImage>::PrintSelf(std::ostream & os, Indent indent) const
   os << indent << "Input Image: " << m_InputImage << std::endl;
   os << indent << "Output Image: " << m_DuplicateImage << std::endl;
   os << indent << "Internal Image Time: " << m_InternalImageTime << std::endl;
+  os << indent << "UseCopyOnWrite: " << m_UseCopyOnWrite << std::endl;
 }
 } // end namespace itk
 
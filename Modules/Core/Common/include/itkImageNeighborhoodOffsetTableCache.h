@@ -0,0 +1,147 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#ifndef itkImageNeighborhoodOffsetTableCache_h
+#define itkImageNeighborhoodOffsetTableCache_h
+
+#include "itkConnectedImageNeighborhoodShape.h"
+#include "itkImageNeighborhoodOffsets.h"
+#include "itkOffset.h"
+
+#include <array>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace itk
+{
+/** Process-wide memoized neighborhood offset tables.
+ *
+ * Filters that are invoked many times with the same neighborhood (patch
+ * based denoising, morphology inside registration loops) recompute their
+ * shape offsets and buffer offset tables on every iterator construction.
+ * The functions here compute each table once per distinct key and return a
+ * reference to the immutable cached copy; subsequent calls are a map
+ * lookup. The returned references stay valid for the lifetime of the
+ * process. All functions are thread-safe.
+ */
+
+/** Offsets of the connected image neighborhood with the given city-block
+ * distance, computed once per (distance, includeCenterPixel) pair. Use the
+ * compile-time GenerateConnectedImageNeighborhoodShapeOffsets when the
+ * parameters are known at compile time. */
+template <unsigned int VImageDimension>
+const std::vector<Offset<VImageDimension>> &
+GetCachedConnectedImageNeighborhoodOffsets(const std::size_t maximumCityblockDistance, const bool includeCenterPixel)
+{
+  using KeyType = std::pair<std::size_t, bool>;
+  static std::map<KeyType, std::vector<Offset<VImageDimension>>> cache;
+  static std::mutex                                              cacheMutex;
+
+  const std::lock_guard<std::mutex> lockGuard(cacheMutex);
+
+  const auto found = cache.find(KeyType{ maximumCityblockDistance, includeCenterPixel });
+  if (found != cache.end())
+  {
+    return found->second;
+  }
+  const ConnectedImageNeighborhoodShape<VImageDimension> shape{ maximumCityblockDistance, includeCenterPixel };
+  return cache
+    .emplace(KeyType{ maximumCityblockDistance, includeCenterPixel }, GenerateImageNeighborhoodOffsets(shape))
+    .first->second;
+}
+
+/** Offsets of the hyperrectangular neighborhood of the given radius,
+ * computed once per radius. */
+template <unsigned int VImageDimension>
+const std::vector<Offset<VImageDimension>> &
+GetCachedRectangularImageNeighborhoodOffsets(const Size<VImageDimension> & radius)
+{
+  using KeyType = std::array<SizeValueType, VImageDimension>;
+  static std::map<KeyType, std::vector<Offset<VImageDimension>>> cache;
+  static std::mutex                                              cacheMutex;
+
+  KeyType key;
+  for (unsigned int d = 0; d < VImageDimension; ++d)
+  {
+    key[d] = radius[d];
+  }
+
+  const std::lock_guard<std::mutex> lockGuard(cacheMutex);
+
+  const auto found = cache.find(key);
+  if (found != cache.end())
+  {
+    return found->second;
+  }
+  return cache.emplace(key, GenerateRectangularImageNeighborhoodOffsets(radius)).first->second;
+}
+
+/** Buffer offsets of a neighborhood on an image with the given strides
+ * (ImageBase::GetOffsetTable), computed once per (active offsets, strides)
+ * pair. The result maps each neighborhood offset onto the distance, in
+ * buffer elements, from the center pixel. */
+template <unsigned int VImageDimension>
+const std::vector<OffsetValueType> &
+GetCachedImageNeighborhoodOffsetTable(const std::vector<Offset<VImageDimension>> & neighborhoodOffsets,
+                                      const OffsetValueType *                      strides)
+{
+  using KeyType = std::vector<OffsetValueType>;
+  static std::map<KeyType, std::vector<OffsetValueType>> cache;
+  static std::mutex                                      cacheMutex;
+
+  // The key serializes the strides followed by the active offsets.
+  KeyType key;
+  key.reserve(VImageDimension * (1 + neighborhoodOffsets.size()));
+  for (unsigned int d = 0; d < VImageDimension; ++d)
+  {
+    key.push_back(strides[d]);
+  }
+  for (const auto & neighborhoodOffset : neighborhoodOffsets)
+  {
+    for (unsigned int d = 0; d < VImageDimension; ++d)
+    {
+      key.push_back(neighborhoodOffset[d]);
+    }
+  }
+
+  const std::lock_guard<std::mutex> lockGuard(cacheMutex);
+
+  const auto found = cache.find(key);
+  if (found != cache.end())
+  {
+    return found->second;
+  }
+
+  std::vector<OffsetValueType> table;
+  table.reserve(neighborhoodOffsets.size());
+  for (const auto & neighborhoodOffset : neighborhoodOffsets)
+  {
+    OffsetValueType bufferOffset = 0;
+    for (unsigned int d = 0; d < VImageDimension; ++d)
+    {
+      bufferOffset += neighborhoodOffset[d] * strides[d];
+    }
+    table.push_back(bufferOffset);
+  }
+  return cache.emplace(std::move(key), std::move(table)).first->second;
+}
+
+} // namespace itk
+#endif
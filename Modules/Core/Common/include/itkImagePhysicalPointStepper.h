@@ -0,0 +1,140 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#ifndef itkImagePhysicalPointStepper_h
+#define itkImagePhysicalPointStepper_h
+
+#include "itkMacro.h"
+#include "itkPoint.h"
+#include "itkVector.h"
+
+namespace itk
+{
+
+/**
+ * \class ImagePhysicalPointStepper
+ * \brief Incremental computation of physical points along the image grid.
+ *
+ * TransformIndexToPhysicalPoint() evaluates origin + direction * spacing *
+ * index from scratch on every call, which dominates loops that need a
+ * physical coordinate per pixel.  This lightweight helper precomputes one
+ * physical step vector per image axis (a column of the index-to-physical
+ * matrix), so that moving to a grid neighbor costs a single vector
+ * addition:
+   \code
+   ImagePhysicalPointStepper<ImageType> stepper(image);
+
+   while (!it.IsAtEnd())
+   {
+     stepper.SetIndex(it.GetIndex()); // exact, once per scanline
+     while (!it.IsAtEndOfLine())
+     {
+       const auto & point = stepper.GetPoint();
+       // use point ...
+       stepper.MoveAlongDimension(0);
+       ++it;
+     }
+     it.NextLine();
+   }
+   \endcode
+ *
+ * SetIndex() recomputes the point exactly via
+ * TransformIndexToPhysicalPoint(); MoveAlongDimension() accumulates step
+ * vectors, so points within a scanline may differ from the per-pixel
+ * transform by floating-point rounding on the order of the accumulated
+ * number of steps times machine epsilon.  Re-anchor with SetIndex() at
+ * each line start to keep the drift bounded by the scanline length.
+ *
+ * The stepper snapshots the image geometry at construction; it must not
+ * be used across changes to the image origin, spacing or direction.
+ *
+ * \ingroup ImageAccess
+ * \ingroup ITKCommon
+ */
+template <typename TImage>
+class ITK_TEMPLATE_EXPORT ImagePhysicalPointStepper
+{
+public:
+  /** Dimension of the image grid. */
+  static constexpr unsigned int ImageDimension = TImage::ImageDimension;
+
+  /** Standard type aliases. */
+  using ImageType = TImage;
+  using IndexType = typename ImageType::IndexType;
+  using PointType = Point<SpacePrecisionType, ImageDimension>;
+  using VectorType = Vector<SpacePrecisionType, ImageDimension>;
+
+  /** Precomputes the per-axis physical step vectors from the geometry of
+   * the specified image and anchors the current point at the index of its
+   * largest possible region. */
+  explicit ImagePhysicalPointStepper(const ImageType * image)
+  {
+    const IndexType baseIndex = image->GetLargestPossibleRegion().GetIndex();
+    const PointType basePoint = image->template TransformIndexToPhysicalPoint<SpacePrecisionType>(baseIndex);
+
+    for (unsigned int d = 0; d < ImageDimension; ++d)
+    {
+      IndexType steppedIndex = baseIndex;
+      ++steppedIndex[d];
+      m_Step[d] = image->template TransformIndexToPhysicalPoint<SpacePrecisionType>(steppedIndex) - basePoint;
+    }
+
+    m_Image = image;
+    m_Point = basePoint;
+  }
+
+  /** Re-anchors the current point at the specified index, computed exactly
+   * via TransformIndexToPhysicalPoint(). */
+  void
+  SetIndex(const IndexType & index)
+  {
+    m_Image->TransformIndexToPhysicalPoint(index, m_Point);
+  }
+
+  /** Returns the physical point of the current grid position. */
+  const PointType &
+  GetPoint() const
+  {
+    return m_Point;
+  }
+
+  /** Returns the physical displacement between neighboring grid positions
+   * along the specified image axis. */
+  const VectorType &
+  GetStep(const unsigned int dimension) const
+  {
+    return m_Step[dimension];
+  }
+
+  /** Advances the current point to the next grid position along the
+   * specified image axis. */
+  void
+  MoveAlongDimension(const unsigned int dimension)
+  {
+    m_Point += m_Step[dimension];
+  }
+
+private:
+  const ImageType * m_Image;
+  PointType         m_Point;
+  VectorType        m_Step[ImageDimension];
+};
+
+} // namespace itk
+
+#endif
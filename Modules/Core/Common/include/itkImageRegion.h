@@ -238,18 +238,17 @@ public:
   bool
   IsInside(const IndexType & index) const
   {
+    bool isInside = true;
     for (unsigned int i = 0; i < ImageDimension; ++i)
     {
-      if (index[i] < m_Index[i])
-      {
-        return false;
-      }
-      if (index[i] >= (m_Index[i] + static_cast<IndexValueType>(m_Size[i])))
-      {
-        return false;
-      }
+      // Casting the signed distance to the region start to an unsigned value
+      // tests both bounds with a single comparison. Accumulating the result
+      // instead of returning early lets the compiler fully unroll this
+      // fixed-trip-count loop into straight-line, branch-free code, which
+      // matters for the per-pixel calls made by iterators and splitters.
+      isInside &= (static_cast<SizeValueType>(index[i] - m_Index[i]) < m_Size[i]);
     }
-    return true;
+    return isInside;
   }
 
   /** Test if a continuous index is inside the region.
@@ -290,23 +289,19 @@ public:
   bool
   IsInside(const Self & region) const
   {
-    IndexType beginCorner = region.GetIndex();
-
-    if (!this->IsInside(beginCorner))
-    {
-      return false;
-    }
-    IndexType        endCorner;
-    const SizeType & size = region.GetSize();
+    const IndexType & beginCorner = region.GetIndex();
+    const SizeType &  size = region.GetSize();
+    bool              isInside = true;
     for (unsigned int i = 0; i < ImageDimension; ++i)
     {
-      endCorner[i] = beginCorner[i] + static_cast<OffsetValueType>(size[i]) - 1;
+      // Check both corners per dimension without early exits, so the loop
+      // unrolls into branch-free code. A zero size yields an end corner
+      // below the begin corner, which correctly fails the test.
+      const IndexValueType endCorner = beginCorner[i] + static_cast<OffsetValueType>(size[i]) - 1;
+      isInside &= (static_cast<SizeValueType>(beginCorner[i] - m_Index[i]) < m_Size[i]);
+      isInside &= (static_cast<SizeValueType>(endCorner - m_Index[i]) < m_Size[i]);
     }
-    if (!this->IsInside(endCorner))
-    {
-      return false;
-    }
-    return true;
+    return isInside;
   }
 
   /** Get the number of pixels contained in this region. This just
@@ -30,6 +30,8 @@
 
 #include "itkImageRegion.h"
 
+#include <algorithm> // For min and max.
+
 namespace itk
 {
 template <unsigned int VImageDimension>
@@ -188,57 +190,37 @@ template <unsigned int VImageDimension>
 bool
 ImageRegion<VImageDimension>::Crop(const Self & region)
 {
-  OffsetValueType crop;
-  unsigned int    i;
-  bool            cropPossible = true;
+  // Compute the intersection bounds per dimension with min/max instead of
+  // edge-by-edge branching; the fixed-trip-count loops unroll into
+  // straight-line code for the common 2D/3D instantiations.
+  IndexValueType lowerBound[VImageDimension];
+  IndexValueType upperBound[VImageDimension];
+  bool           cropPossible = true;
 
-  // Can we crop?
-  for (i = 0; i < VImageDimension && cropPossible; ++i)
+  for (unsigned int i = 0; i < VImageDimension; ++i)
   {
-    // Is left edge of current region to the right of the right edge
-    // of the region to crop with? (if so, we cannot crop)
-    if (m_Index[i] >= region.GetIndex()[i] + static_cast<OffsetValueType>(region.GetSize()[i]))
-    {
-      cropPossible = false;
-    }
-    // If right edge of the current region to the left of the left
-    // edge of the region to crop with? (if so, we cannot crop)
-    if (m_Index[i] + static_cast<OffsetValueType>(m_Size[i]) <= region.GetIndex()[i])
-    {
-      cropPossible = false;
-    }
+    const IndexValueType end = m_Index[i] + static_cast<OffsetValueType>(m_Size[i]);
+    const IndexValueType regionEnd = region.GetIndex()[i] + static_cast<OffsetValueType>(region.GetSize()[i]);
+
+    lowerBound[i] = std::max(m_Index[i], region.GetIndex()[i]);
+    upperBound[i] = std::min(end, regionEnd);
+
+    // Can we crop? The left edge of the current region must lie to the left
+    // of the right edge of the cropping region, and vice versa.
+    cropPossible &= (m_Index[i] < regionEnd) && (end > region.GetIndex()[i]);
   }
 
-  // if we cannot crop, return without changing anythin
+  // if we cannot crop, return without changing anything
   if (!cropPossible)
   {
     return cropPossible;
   }
 
   // we can crop, so crop
-  for (i = 0; i < VImageDimension; ++i)
+  for (unsigned int i = 0; i < VImageDimension; ++i)
   {
-    // first check the start index
-    if (m_Index[i] < region.GetIndex()[i])
-    {
-      // how much do we need to adjust
-      crop = region.GetIndex()[i] - m_Index[i];
-
-      // adjust the start index and the size of the current region
-      m_Index[i] += crop;
-      m_Size[i] -= static_cast<SizeValueType>(crop);
-    }
-    // now check the final size
-    if (m_Index[i] + static_cast<OffsetValueType>(m_Size[i]) >
-        region.GetIndex()[i] + static_cast<OffsetValueType>(region.GetSize()[i]))
-    {
-      // how much do we need to adjust
-      crop = m_Index[i] + static_cast<OffsetValueType>(m_Size[i]) - region.GetIndex()[i] -
-             static_cast<OffsetValueType>(region.GetSize()[i]);
-
-      // adjust the size
-      m_Size[i] -= static_cast<SizeValueType>(crop);
-    }
+    m_Index[i] = lowerBound[i];
+    m_Size[i] = static_cast<SizeValueType>(upperBound[i] - lowerBound[i]);
   }
 
   return cropPossible;
@@ -29,6 +29,7 @@
 #define itkImageSource_hxx
 #include "itkImageSource.h"
 
+#include "itkBufferOperationAudit.h"
 #include "itkOutputDataObjectIterator.h"
 #include "itkImageRegionSplitterBase.h"
 #include "itkMultiThreaderBase.h"
@@ -122,6 +123,11 @@ ImageSource<TOutputImage>::GraftOutput(const DataObjectIdentifierType & key, Dat
 
   // Call GraftImage to copy meta-information, regions, and the pixel container
   output->Graft(graft);
+
+  if (BufferOperationAudit::IsRecording())
+  {
+    BufferOperationAudit::ReportGraft(graft, output);
+  }
 }
 
 template <typename TOutputImage>
@@ -183,6 +189,11 @@ ImageSource<TOutputImage>::AllocateOutputs()
     {
       outputPtr->SetBufferedRegion(outputPtr->GetRequestedRegion());
       outputPtr->Allocate();
+
+      if (BufferOperationAudit::IsRecording())
+      {
+        BufferOperationAudit::ReportAllocation(outputPtr, outputPtr->GetBufferedRegion().GetNumberOfPixels());
+      }
     }
   }
 }
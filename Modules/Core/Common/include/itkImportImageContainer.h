@@ -20,6 +20,7 @@
 
 #include "itkObject.h"
 #include "itkObjectFactory.h"
+#include "itkImageBufferAllocator.h"
 #include <utility>
 
 namespace itk
@@ -57,6 +58,9 @@ public:
   using ElementIdentifier = TElementIdentifier;
   using Element = TElement;
 
+  /** The type of the pluggable buffer allocation strategy. */
+  using AllocatorType = ImageBufferAllocator<TElement>;
+
   /** Method for creation through the object factory. */
   itkNewMacro(Self);
 
@@ -151,6 +155,15 @@ public:
   itkGetConstMacro(ContainerManageMemory, bool);
   itkBooleanMacro(ContainerManageMemory);
 
+  /** Set/Get the allocation strategy used for buffers managed by this
+   *  container. When no allocator is set (the default), buffers are
+   *  allocated with operator new[]. A buffer stays paired with the
+   *  allocator that produced it, so replacing the allocator while a
+   *  buffer is alive is safe. Buffers imported via SetImportPointer are
+   *  never released through the allocator. */
+  itkSetObjectMacro(Allocator, AllocatorType);
+  itkGetModifiableObjectMacro(Allocator, AllocatorType);
+
 protected:
   ImportImageContainer();
   ~ImportImageContainer() override;
@@ -203,6 +216,12 @@ private:
   TElementIdentifier m_Size;
   TElementIdentifier m_Capacity;
   bool               m_ContainerManageMemory;
+
+  /** The allocation strategy for new buffers, nullptr selects operator new[]. */
+  typename AllocatorType::Pointer m_Allocator;
+
+  /** The allocator that produced the current buffer, if any. */
+  typename AllocatorType::Pointer m_BufferAllocator;
 };
 } // end namespace itk
 
@@ -70,6 +70,7 @@ ImportImageContainer<TElementIdentifier, TElement>::Reserve(ElementIdentifier si
       DeallocateManagedMemory();
 
       m_ImportPointer = temp;
+      m_BufferAllocator = m_Allocator;
       m_ContainerManageMemory = true;
       m_Capacity = size;
       m_Size = size;
@@ -84,6 +85,7 @@ ImportImageContainer<TElementIdentifier, TElement>::Reserve(ElementIdentifier si
   else
   {
     m_ImportPointer = this->AllocateElements(size, UseDefaultConstructor);
+    m_BufferAllocator = m_Allocator;
     m_Capacity = size;
     m_Size = size;
     m_ContainerManageMemory = true;
@@ -110,6 +112,7 @@ ImportImageContainer<TElementIdentifier, TElement>::Squeeze()
       DeallocateManagedMemory();
 
       m_ImportPointer = temp;
+      m_BufferAllocator = m_Allocator;
       m_ContainerManageMemory = true;
       m_Capacity = size;
       m_Size = size;
@@ -165,6 +168,11 @@ TElement *
 ImportImageContainer<TElementIdentifier, TElement>::AllocateElements(ElementIdentifier size,
                                                                      bool              UseDefaultConstructor) const
 {
+  if (m_Allocator)
+  {
+    return m_Allocator->Allocate(static_cast<SizeValueType>(size), UseDefaultConstructor);
+  }
+
   // Encapsulate all image memory allocation here to throw an
   // exception when memory allocation fails even when the compiler
   // does not do this by default.
@@ -201,8 +209,16 @@ ImportImageContainer<TElementIdentifier, TElement>::DeallocateManagedMemory()
   // Encapsulate all image memory deallocation here
   if (m_ContainerManageMemory)
   {
-    delete[] m_ImportPointer;
+    if (m_BufferAllocator)
+    {
+      m_BufferAllocator->Deallocate(m_ImportPointer, static_cast<SizeValueType>(m_Capacity));
+    }
+    else
+    {
+      delete[] m_ImportPointer;
+    }
   }
+  m_BufferAllocator = nullptr;
   m_ImportPointer = nullptr;
   m_Capacity = 0;
   m_Size = 0;
@@ -218,6 +234,7 @@ ImportImageContainer<TElementIdentifier, TElement>::PrintSelf(std::ostream & os,
   os << indent << "Container manages memory: " << (m_ContainerManageMemory ? "true" : "false") << std::endl;
   os << indent << "Size: " << m_Size << std::endl;
   os << indent << "Capacity: " << m_Capacity << std::endl;
+  os << indent << "Allocator: " << static_cast<const void *>(m_Allocator.GetPointer()) << std::endl;
 }
 } // end namespace itk
 
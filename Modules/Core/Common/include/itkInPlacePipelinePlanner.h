@@ -0,0 +1,84 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkInPlacePipelinePlanner_h
+#define itkInPlacePipelinePlanner_h
+
+#include "itkDataObject.h"
+#include "itkProcessObject.h"
+
+#include <vector>
+
+namespace itk
+{
+/** \class InPlacePipelinePlanner
+ * \brief Negotiates buffer reuse across a whole pipeline before an Update.
+ *
+ * InPlaceImageFilter decides in-place eligibility per filter, in
+ * isolation: a filter left in-place clobbers an input that another
+ * consumer still needs, which the pipeline repairs by re-executing the
+ * producer, while a conservatively disabled filter keeps an extra volume
+ * alive for nothing. This planner analyzes the upstream filter graph of
+ * the requested outputs as a whole: it enables in-place execution exactly
+ * where the consumed buffer is produced inside the graph and has no other
+ * consumer, disables it where reuse would force a re-execution, and marks
+ * singly-consumed intermediate outputs for release so their buffers are
+ * freed as soon as they have been consumed.
+ *
+ * Marked intermediates are regenerated on a subsequent Update; run the
+ * planner on pipelines that are updated once, or whose inputs change
+ * between updates anyway. The planner cannot see pointers the caller
+ * retains to intermediate outputs — exclude such outputs by passing them
+ * as requested outputs.
+ *
+ * \sa InPlaceImageFilter
+ * \sa ProcessObject
+ * \ingroup ITKSystemObjects
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT InPlacePipelinePlanner
+{
+public:
+  /** The decisions made for one planned pipeline. */
+  struct PlanReport
+  {
+    /** Number of filters in the analyzed upstream graph. */
+    unsigned int NumberOfFilters{ 0 };
+
+    /** Filters whose types allow in-place execution. */
+    unsigned int NumberOfInPlaceCapableFilters{ 0 };
+
+    /** Capable filters for which in-place execution was enabled. */
+    unsigned int NumberOfFiltersPlannedInPlace{ 0 };
+
+    /** Intermediate outputs marked for release after consumption. */
+    unsigned int NumberOfIntermediatesMarkedForRelease{ 0 };
+  };
+
+  /** Plan buffer reuse for the upstream graphs of all given outputs and
+   * return the decisions made. The outputs themselves, and any
+   * externally provided source images, are never reused or released. */
+  static PlanReport
+  Plan(const std::vector<DataObject::Pointer> & requestedOutputs);
+
+  /** Convenience overload for a single requested output. */
+  static PlanReport
+  Plan(DataObject * requestedOutput);
+};
+} // end namespace itk
+
+#endif
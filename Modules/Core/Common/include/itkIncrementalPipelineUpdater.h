@@ -0,0 +1,129 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkIncrementalPipelineUpdater_h
+#define itkIncrementalPipelineUpdater_h
+
+#include "itkObject.h"
+
+namespace itk
+{
+/** \class IncrementalPipelineUpdater
+ * \brief Recomputes only the subregion of a pipeline affected by an edit.
+ *
+ * When a small region of an input image changes — a paste, a brush
+ * stroke — re-updating the pipeline recomputes every downstream filter
+ * over its full output. For pipelines of local filters the affected
+ * output region is just the changed region plus the accumulated kernel
+ * support, and the requested-region machinery can already restrict the
+ * recomputation to it; what is lost is the rest of the output buffer,
+ * which the pipeline deallocates when a smaller region is requested.
+ *
+ * This helper keeps a persistent full-size canvas of the pipeline output.
+ * UpdateChangedRegion() measures the chain's total kernel support with a
+ * single requested-region propagation, requests only the changed region
+ * padded by that support, updates the pipeline, and patches the
+ * recomputed subregion into the canvas. GetOutput() returns the canvas,
+ * which always holds the complete, current result.
+ *
+ * The pipeline between the input image and the pipeline output must
+ * preserve the pixel grid (no resampling, shrinking or region casting)
+ * and must consist of local, shift-invariant operations; filters that
+ * enlarge their output requested region to the whole image degrade the
+ * update to a full recomputation but remain correct.
+ *
+ * \sa ProcessObject
+ * \sa PasteImageFilter
+ * \ingroup ITKCommon
+ */
+template <typename TInputImage, typename TOutputImage>
+class ITK_TEMPLATE_EXPORT IncrementalPipelineUpdater : public Object
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(IncrementalPipelineUpdater);
+
+  /** Standard class typedefs. */
+  using Self = IncrementalPipelineUpdater;
+  using Superclass = Object;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(IncrementalPipelineUpdater, Object);
+
+  using InputImageType = TInputImage;
+  using InputImagePointer = typename InputImageType::Pointer;
+  using InputImageRegionType = typename InputImageType::RegionType;
+
+  using OutputImageType = TOutputImage;
+  using OutputImagePointer = typename OutputImageType::Pointer;
+  using OutputImageRegionType = typename OutputImageType::RegionType;
+
+  /** Dimension of the images; input and output must match. */
+  static constexpr unsigned int ImageDimension = OutputImageType::ImageDimension;
+
+  static_assert(static_cast<unsigned int>(InputImageType::ImageDimension) ==
+                  static_cast<unsigned int>(OutputImageType::ImageDimension),
+                "Input and output images must have the same dimension.");
+
+  /** Set/Get the pipeline input image that receives the edits. */
+  itkSetObjectMacro(InputImage, InputImageType);
+  itkGetModifiableObjectMacro(InputImage, InputImageType);
+
+  /** Set/Get the final output of the filter chain to track. */
+  itkSetObjectMacro(PipelineOutput, OutputImageType);
+  itkGetModifiableObjectMacro(PipelineOutput, OutputImageType);
+
+  /** The persistent full-size result; valid after the first update. */
+  OutputImageType *
+  GetOutput()
+  {
+    return m_Canvas;
+  }
+
+  /** Update the whole pipeline and (re)fill the canvas. */
+  void
+  UpdateLargestPossibleRegion();
+
+  /** Recompute only the output region affected by an edit of the given
+   * input region and patch it into the canvas. The caller must have
+   * modified the input pixels (and called Modified() on the input)
+   * beforehand. Falls back to a full update when no canvas exists yet. */
+  void
+  UpdateChangedRegion(const InputImageRegionType & changedRegion);
+
+protected:
+  IncrementalPipelineUpdater() = default;
+  ~IncrementalPipelineUpdater() override = default;
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  InputImagePointer  m_InputImage;
+  OutputImagePointer m_PipelineOutput;
+  OutputImagePointer m_Canvas;
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkIncrementalPipelineUpdater.hxx"
+#endif
+
+#endif
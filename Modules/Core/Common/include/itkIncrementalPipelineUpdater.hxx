@@ -0,0 +1,124 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkIncrementalPipelineUpdater_hxx
+#define itkIncrementalPipelineUpdater_hxx
+
+#include "itkIncrementalPipelineUpdater.h"
+#include "itkImageAlgorithm.h"
+
+#include <algorithm>
+
+namespace itk
+{
+
+template <typename TInputImage, typename TOutputImage>
+void
+IncrementalPipelineUpdater<TInputImage, TOutputImage>::UpdateLargestPossibleRegion()
+{
+  itkAssertOrThrowMacro(m_PipelineOutput.IsNotNull(), "No pipeline output set.");
+
+  m_PipelineOutput->UpdateOutputInformation();
+  m_PipelineOutput->SetRequestedRegionToLargestPossibleRegion();
+  m_PipelineOutput->Update();
+
+  const OutputImageRegionType largestRegion = m_PipelineOutput->GetLargestPossibleRegion();
+  if (m_Canvas.IsNull() || m_Canvas->GetBufferedRegion() != largestRegion)
+  {
+    m_Canvas = OutputImageType::New();
+    m_Canvas->CopyInformation(m_PipelineOutput);
+    m_Canvas->SetRegions(largestRegion);
+    m_Canvas->Allocate();
+  }
+  ImageAlgorithm::ParallelCopy(m_PipelineOutput.GetPointer(), m_Canvas.GetPointer(), largestRegion, largestRegion);
+}
+
+template <typename TInputImage, typename TOutputImage>
+void
+IncrementalPipelineUpdater<TInputImage, TOutputImage>::UpdateChangedRegion(const InputImageRegionType & changedRegion)
+{
+  itkAssertOrThrowMacro(m_InputImage.IsNotNull(), "No input image set.");
+  itkAssertOrThrowMacro(m_PipelineOutput.IsNotNull(), "No pipeline output set.");
+
+  if (m_Canvas.IsNull())
+  {
+    this->UpdateLargestPossibleRegion();
+    return;
+  }
+
+  m_PipelineOutput->UpdateOutputInformation();
+  const OutputImageRegionType largestRegion = m_PipelineOutput->GetLargestPossibleRegion();
+
+  // Measure the chain's accumulated kernel support with one requested
+  // region propagation: request the changed region at the output and read
+  // off how far the input's requested region extends beyond it.
+  OutputImageRegionType probeRegion;
+  for (unsigned int i = 0; i < ImageDimension; ++i)
+  {
+    probeRegion.SetIndex(i, changedRegion.GetIndex(i));
+    probeRegion.SetSize(i, changedRegion.GetSize(i));
+  }
+  if (!probeRegion.Crop(largestRegion))
+  {
+    // The edit does not overlap the output grid.
+    return;
+  }
+  m_PipelineOutput->SetRequestedRegion(probeRegion);
+  m_PipelineOutput->PropagateRequestedRegion();
+  const InputImageRegionType inputRequestedRegion = m_InputImage->GetRequestedRegion();
+
+  // An output pixel o depends on input pixels [o - padLow, o + padHigh],
+  // so an input change at c affects output pixels [c - padHigh, c + padLow].
+  OutputImageRegionType affectedRegion;
+  for (unsigned int i = 0; i < ImageDimension; ++i)
+  {
+    const OffsetValueType padLow =
+      std::max(OffsetValueType{ 0 }, probeRegion.GetIndex(i) - inputRequestedRegion.GetIndex(i));
+    const OffsetValueType padHigh = std::max(
+      OffsetValueType{ 0 },
+      (inputRequestedRegion.GetIndex(i) + static_cast<OffsetValueType>(inputRequestedRegion.GetSize(i))) -
+        (probeRegion.GetIndex(i) + static_cast<OffsetValueType>(probeRegion.GetSize(i))));
+
+    affectedRegion.SetIndex(i, changedRegion.GetIndex(i) - padHigh);
+    affectedRegion.SetSize(i, changedRegion.GetSize(i) + static_cast<SizeValueType>(padLow + padHigh));
+  }
+  if (!affectedRegion.Crop(largestRegion))
+  {
+    // The edit does not affect any output pixel.
+    return;
+  }
+
+  m_PipelineOutput->SetRequestedRegion(affectedRegion);
+  m_PipelineOutput->Update();
+
+  ImageAlgorithm::ParallelCopy(m_PipelineOutput.GetPointer(), m_Canvas.GetPointer(), affectedRegion, affectedRegion);
+}
+
+template <typename TInputImage, typename TOutputImage>
+void
+IncrementalPipelineUpdater<TInputImage, TOutputImage>::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  itkPrintSelfObjectMacro(InputImage);
+  itkPrintSelfObjectMacro(PipelineOutput);
+  itkPrintSelfObjectMacro(Canvas);
+}
+
+} // end namespace itk
+
+#endif
@@ -95,7 +95,7 @@ public:
 
 
   /** Add a size to an index.  */
-  const Self
+  constexpr const Self
   operator+(const SizeType & sz) const
   {
     Self result;
@@ -108,7 +108,7 @@ public:
   }
 
   /** Increment index by a size.  */
-  const Self &
+  constexpr const Self &
   operator+=(const SizeType & sz)
   {
     for (unsigned int i = 0; i < VDimension; ++i)
@@ -120,7 +120,7 @@ public:
 
   /** Subtract a size from an index.
    */
-  const Self
+  constexpr const Self
   operator-(const SizeType & sz) const
   {
     Self result;
@@ -133,7 +133,7 @@ public:
   }
 
   /** Decrement index by a size.  */
-  const Self &
+  constexpr const Self &
   operator-=(const SizeType & sz)
   {
     for (unsigned int i = 0; i < VDimension; ++i)
@@ -144,7 +144,7 @@ public:
   }
 
   /** Add an offset to an index. */
-  const Self
+  constexpr const Self
   operator+(const OffsetType & offset) const
   {
     Self result;
@@ -157,7 +157,7 @@ public:
   }
 
   /** Increment index by an offset.  */
-  const Self &
+  constexpr const Self &
   operator+=(const OffsetType & offset)
   {
     for (unsigned int i = 0; i < VDimension; ++i)
@@ -168,7 +168,7 @@ public:
   }
 
   /** Decrement index by an offset.  */
-  const Self &
+  constexpr const Self &
   operator-=(const OffsetType & offset)
   {
     for (unsigned int i = 0; i < VDimension; ++i)
@@ -179,7 +179,7 @@ public:
   }
 
   /** Subtract an offset from an index. */
-  const Self
+  constexpr const Self
   operator-(const OffsetType & off) const
   {
     Self result;
@@ -192,7 +192,7 @@ public:
   }
 
   /** Subtract two indices.  */
-  const OffsetType
+  constexpr const OffsetType
   operator-(const Self & vec) const
   {
     OffsetType result;
@@ -207,7 +207,7 @@ public:
   /**
    * Multiply an index by a size (elementwise product).
    */
-  const Self operator*(const SizeType & vec) const
+  constexpr const Self operator*(const SizeType & vec) const
   {
     Self result;
 
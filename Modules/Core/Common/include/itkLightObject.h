@@ -47,7 +47,13 @@ namespace itk
  * does.) All ITK objects should be a subclass of LightObject or Object
  * with few exceptions (due to performance concerns).
  *
+ * Subclasses instantiated in large numbers can opt into slab/pool
+ * allocation with thread-local free lists by placing the
+ * itkSmallObjectPoolAllocationMacro in their declaration; see
+ * SmallObjectPool.
+ *
  * \sa Object
+ * \sa SmallObjectPool
  * \ingroup ITKSystemObjects
  * \ingroup DataRepresentation
  * \ingroup ITKCommon
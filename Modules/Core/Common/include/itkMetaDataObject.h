@@ -177,9 +177,25 @@ template <typename T>
 inline void
 EncapsulateMetaData(MetaDataDictionary & Dictionary, const std::string & key, const T & invalue)
 {
+  MetaDataObjectBase::Pointer & entry = Dictionary[key];
+
+  // When this dictionary holds the only reference to an entry of the
+  // right type, update it in place: repeatedly encapsulating into the
+  // same key then allocates nothing. Entries shared with copies of the
+  // dictionary are left untouched and replaced instead.
+  if (entry.IsNotNull() && entry->GetReferenceCount() == 1)
+  {
+    auto * existingObject = dynamic_cast<MetaDataObject<T> *>(entry.GetPointer());
+    if (existingObject != nullptr)
+    {
+      existingObject->SetMetaDataObjectValue(invalue);
+      return;
+    }
+  }
+
   typename MetaDataObject<T>::Pointer temp = MetaDataObject<T>::New();
   temp->SetMetaDataObjectValue(invalue);
-  Dictionary[key] = temp;
+  entry = temp;
 }
 
 template <typename T>
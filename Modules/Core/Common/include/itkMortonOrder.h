@@ -0,0 +1,234 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkMortonOrder_h
+#define itkMortonOrder_h
+
+#include "itkIndex.h"
+#include "itkSize.h"
+#include "itkIntTypes.h"
+
+#include <cstdint>
+
+namespace itk
+{
+/** \class MortonOrder
+ *  \brief A container of static functions for Morton (Z-order) pixel codes
+ *  and buffer layouts.
+ *
+ *  A Morton code interleaves the bits of an n-dimensional index, so indices
+ *  that are close in all dimensions map to nearby positions in a linear
+ *  buffer. Kernels with isotropic neighborhood access (diffusion, level
+ *  sets, morphology) can copy a row-major image buffer into Morton layout
+ *  with CopyToMortonLayout, run their neighborhood sweeps on the
+ *  cache-friendly layout using EncodeIndex for addressing, and copy the
+ *  result back with CopyFromMortonLayout.
+ *
+ *  The Morton buffer is padded to a power-of-two cube: its length is
+ *  m^Dimension where m is the smallest power of two covering the largest
+ *  extent of the region (see ComputeBufferLength). Codes are relative to
+ *  the region start, so regions need not begin at the origin.
+ *
+ *  \sa ImageAlgorithm
+ *  \ingroup ITKCommon
+ */
+struct MortonOrder
+{
+  /** Spread the low 32 bits of x so that there is one empty bit between
+   * consecutive source bits. */
+  static constexpr uint64_t
+  SpreadBy1(uint64_t x)
+  {
+    x &= 0x00000000ffffffffull;
+    x = (x | (x << 16)) & 0x0000ffff0000ffffull;
+    x = (x | (x << 8)) & 0x00ff00ff00ff00ffull;
+    x = (x | (x << 4)) & 0x0f0f0f0f0f0f0f0full;
+    x = (x | (x << 2)) & 0x3333333333333333ull;
+    x = (x | (x << 1)) & 0x5555555555555555ull;
+    return x;
+  }
+
+  /** Spread the low 21 bits of x so that there are two empty bits between
+   * consecutive source bits. */
+  static constexpr uint64_t
+  SpreadBy2(uint64_t x)
+  {
+    x &= 0x00000000001fffffull;
+    x = (x | (x << 32)) & 0x001f00000000ffffull;
+    x = (x | (x << 16)) & 0x001f0000ff0000ffull;
+    x = (x | (x << 8)) & 0x100f00f00f00f00full;
+    x = (x | (x << 4)) & 0x10c30c30c30c30c3ull;
+    x = (x | (x << 2)) & 0x1249249249249249ull;
+    return x;
+  }
+
+  /** Inverse of SpreadBy1. */
+  static constexpr uint64_t
+  CompactBy1(uint64_t x)
+  {
+    x &= 0x5555555555555555ull;
+    x = (x ^ (x >> 1)) & 0x3333333333333333ull;
+    x = (x ^ (x >> 2)) & 0x0f0f0f0f0f0f0f0full;
+    x = (x ^ (x >> 4)) & 0x00ff00ff00ff00ffull;
+    x = (x ^ (x >> 8)) & 0x0000ffff0000ffffull;
+    x = (x ^ (x >> 16)) & 0x00000000ffffffffull;
+    return x;
+  }
+
+  /** Inverse of SpreadBy2. */
+  static constexpr uint64_t
+  CompactBy2(uint64_t x)
+  {
+    x &= 0x1249249249249249ull;
+    x = (x ^ (x >> 2)) & 0x10c30c30c30c30c3ull;
+    x = (x ^ (x >> 4)) & 0x100f00f00f00f00full;
+    x = (x ^ (x >> 8)) & 0x001f0000ff0000ffull;
+    x = (x ^ (x >> 16)) & 0x001f00000000ffffull;
+    x = (x ^ (x >> 32)) & 0x00000000001fffffull;
+    return x;
+  }
+
+  /** Interleave a 2-D region-relative index into its Morton code. */
+  static constexpr uint64_t
+  EncodeIndex(const uint64_t x, const uint64_t y)
+  {
+    return SpreadBy1(x) | (SpreadBy1(y) << 1);
+  }
+
+  /** Interleave a 3-D region-relative index into its Morton code. */
+  static constexpr uint64_t
+  EncodeIndex(const uint64_t x, const uint64_t y, const uint64_t z)
+  {
+    return SpreadBy2(x) | (SpreadBy2(y) << 1) | (SpreadBy2(z) << 2);
+  }
+
+  /** De-interleave a Morton code back into a 2-D region-relative index. */
+  static void
+  DecodeIndex(const uint64_t code, uint64_t & x, uint64_t & y)
+  {
+    x = CompactBy1(code);
+    y = CompactBy1(code >> 1);
+  }
+
+  /** De-interleave a Morton code back into a 3-D region-relative index. */
+  static void
+  DecodeIndex(const uint64_t code, uint64_t & x, uint64_t & y, uint64_t & z)
+  {
+    x = CompactBy2(code);
+    y = CompactBy2(code >> 1);
+    z = CompactBy2(code >> 2);
+  }
+
+  /** The length of the Morton buffer covering a region of the given size:
+   * m^VDimension, where m is the smallest power of two that is at least the
+   * largest extent of the region. */
+  template <unsigned int VDimension>
+  static SizeValueType
+  ComputeBufferLength(const Size<VDimension> & size)
+  {
+    SizeValueType m = 1;
+    for (unsigned int d = 0; d < VDimension; ++d)
+    {
+      while (m < size[d])
+      {
+        m *= 2;
+      }
+    }
+    SizeValueType length = 1;
+    for (unsigned int d = 0; d < VDimension; ++d)
+    {
+      length *= m;
+    }
+    return length;
+  }
+
+  /** Copy a row-major buffer of the given size into Morton layout. The
+   * destination must hold at least ComputeBufferLength(size) elements;
+   * padding elements are left untouched. */
+  template <typename TPixel>
+  static void
+  CopyToMortonLayout(const TPixel * linearBuffer, const Size<2> & size, TPixel * mortonBuffer)
+  {
+    const TPixel * source = linearBuffer;
+    for (SizeValueType y = 0; y < size[1]; ++y)
+    {
+      const uint64_t rowCode = SpreadBy1(y) << 1;
+      for (SizeValueType x = 0; x < size[0]; ++x)
+      {
+        mortonBuffer[rowCode | SpreadBy1(x)] = *source++;
+      }
+    }
+  }
+
+  template <typename TPixel>
+  static void
+  CopyToMortonLayout(const TPixel * linearBuffer, const Size<3> & size, TPixel * mortonBuffer)
+  {
+    const TPixel * source = linearBuffer;
+    for (SizeValueType z = 0; z < size[2]; ++z)
+    {
+      const uint64_t sliceCode = SpreadBy2(z) << 2;
+      for (SizeValueType y = 0; y < size[1]; ++y)
+      {
+        const uint64_t rowCode = sliceCode | (SpreadBy2(y) << 1);
+        for (SizeValueType x = 0; x < size[0]; ++x)
+        {
+          mortonBuffer[rowCode | SpreadBy2(x)] = *source++;
+        }
+      }
+    }
+  }
+
+  /** Copy a Morton-layout buffer back into a row-major buffer of the given
+   * size. */
+  template <typename TPixel>
+  static void
+  CopyFromMortonLayout(const TPixel * mortonBuffer, const Size<2> & size, TPixel * linearBuffer)
+  {
+    TPixel * destination = linearBuffer;
+    for (SizeValueType y = 0; y < size[1]; ++y)
+    {
+      const uint64_t rowCode = SpreadBy1(y) << 1;
+      for (SizeValueType x = 0; x < size[0]; ++x)
+      {
+        *destination++ = mortonBuffer[rowCode | SpreadBy1(x)];
+      }
+    }
+  }
+
+  template <typename TPixel>
+  static void
+  CopyFromMortonLayout(const TPixel * mortonBuffer, const Size<3> & size, TPixel * linearBuffer)
+  {
+    TPixel * destination = linearBuffer;
+    for (SizeValueType z = 0; z < size[2]; ++z)
+    {
+      const uint64_t sliceCode = SpreadBy2(z) << 2;
+      for (SizeValueType y = 0; y < size[1]; ++y)
+      {
+        const uint64_t rowCode = sliceCode | (SpreadBy2(y) << 1);
+        for (SizeValueType x = 0; x < size[0]; ++x)
+        {
+          *destination++ = mortonBuffer[rowCode | SpreadBy2(x)];
+        }
+      }
+    }
+  }
+};
+} // end namespace itk
+
+#endif
@@ -38,6 +38,7 @@
 #include <functional>
 #include <thread>
 #include "itkProgressReporter.h"
+#include "itkWorkUnitInstrumentation.h"
 
 
 namespace itk
@@ -63,7 +64,8 @@ public:
     First = Platform,
     Pool,
     TBB,
-    Last = TBB,
+    WorkStealing,
+    Last = WorkStealing,
     Unknown = -1
   };
 
@@ -163,6 +165,7 @@ public:
   static constexpr ThreaderEnum First = ThreaderEnum::First;
   static constexpr ThreaderEnum Pool = ThreaderEnum::Pool;
   static constexpr ThreaderEnum TBB = ThreaderEnum::TBB;
+  static constexpr ThreaderEnum WorkStealing = ThreaderEnum::WorkStealing;
   static constexpr ThreaderEnum Last = ThreaderEnum::Last;
   static constexpr ThreaderEnum Unknown = ThreaderEnum::Unknown;
 #endif
@@ -186,6 +189,9 @@ public:
       case ThreaderEnum::TBB:
         return "TBB";
         break;
+      case ThreaderEnum::WorkStealing:
+        return "WorkStealing";
+        break;
       case ThreaderEnum::Unknown:
       default:
         return "Unknown";
@@ -218,6 +224,58 @@ public:
   static ThreadIdType
   GetGlobalDefaultNumberOfThreads();
 
+  /** Return a per-thread scratch buffer of at least \a numberOfBytes bytes,
+   * aligned to ITK_CACHE_LINE_ALIGNMENT. The buffer is owned by the calling
+   * thread, grows geometrically on demand and persists until the thread
+   * exits, so filters that need per-work-unit working sets (histogram
+   * kernels, metric joint PDFs, ...) can call this on every invocation
+   * without re-allocating on each Update().
+   *
+   * The contents are uninitialized and shared by all callers on the same
+   * thread: do not hold the pointer across a call that may request a larger
+   * size, and do not use it from a different thread than the one that
+   * requested it. */
+  static void *
+  GetWorkUnitScratch(SizeValueType numberOfBytes);
+
+  /** Set/Get the optional global work unit instrumentation. When set, its
+   * WorkUnitBegin/WorkUnitEnd callbacks are invoked on the executing thread
+   * around every work unit of ParallelizeImageRegion and
+   * ParallelizeImageRegionRestrictDirection, independently of the threader
+   * back-end in use. The caller retains ownership of the instrumentation
+   * object and must keep it alive until it is unregistered by passing
+   * nullptr; the callbacks must be thread safe.
+   *
+   * \sa WorkUnitInstrumentation
+   * \sa WorkUnitTimingCollector */
+  static void
+  SetGlobalWorkUnitInstrumentation(WorkUnitInstrumentation * instrumentation);
+  static WorkUnitInstrumentation *
+  GetGlobalWorkUnitInstrumentation();
+
+  /** Set/Get the global deterministic-reductions mode. When enabled, newly
+   * constructed multi-threaders use DeterministicNumberOfWorkUnits work
+   * units independently of the number of threads and of the machine, and
+   * filters that support this mode combine their per-work-unit partial
+   * results in work-unit order instead of thread completion order. Together
+   * this makes the floating point results of those reductions bit-identical
+   * across runs and thread counts at full parallelism.
+   *
+   * Enable the mode before constructing the pipeline; multi-threaders that
+   * already exist keep their number of work units. The TBB back-end falls
+   * back to the fixed region splitter in this mode, as its load-balanced
+   * partitioning yields run-dependent splits. */
+  static void
+  SetGlobalDeterministicReductions(bool deterministic);
+  static bool
+  GetGlobalDeterministicReductions();
+
+  /** Number of work units used by newly created multi-threaders when the
+   * global deterministic-reductions mode is enabled. The value is clamped
+   * to the global maximum number of threads like any other work unit
+   * count. */
+  static constexpr ThreadIdType DeterministicNumberOfWorkUnits = 64;
+
 #if !defined(ITK_LEGACY_REMOVE)
   /** Get/Set the number of threads to use.
    * DEPRECATED! Use WorkUnits and MaximumNumberOfThreads instead. */
@@ -347,7 +405,16 @@ ITK_GCC_PRAGMA_DIAG_POP()
           region.SetIndex(d, index[d]);
           region.SetSize(d, size[d]);
         }
+        WorkUnitInstrumentation * instrumentation = GetGlobalWorkUnitInstrumentation();
+        if (instrumentation)
+        {
+          instrumentation->WorkUnitBegin(VDimension, index, size);
+        }
         funcP(region);
+        if (instrumentation)
+        {
+          instrumentation->WorkUnitEnd(VDimension, index, size);
+        }
       },
       filter);
   }
@@ -403,7 +470,20 @@ ITK_GCC_PRAGMA_DIAG_POP()
             restrictedRequestedRegion.SetSize(dimension, size[splitDimension]);
             ++splitDimension;
           }
+          WorkUnitInstrumentation * instrumentation = GetGlobalWorkUnitInstrumentation();
+          if (instrumentation)
+          {
+            instrumentation->WorkUnitBegin(VDimension,
+                                           restrictedRequestedRegion.GetIndex().m_InternalArray,
+                                           restrictedRequestedRegion.GetSize().m_InternalArray);
+          }
           funcP(restrictedRequestedRegion);
+          if (instrumentation)
+          {
+            instrumentation->WorkUnitEnd(VDimension,
+                                         restrictedRequestedRegion.GetIndex().m_InternalArray,
+                                         restrictedRequestedRegion.GetSize().m_InternalArray);
+          }
         },
         filter);
     }
@@ -32,6 +32,7 @@
 #include "itkSingletonMacro.h"
 #include "itkCommonEnums.h"
 #include <list>
+#include <string>
 #include <vector>
 
 namespace itk
@@ -92,6 +93,25 @@ public:
   static void
   ReHash();
 
+  /** Write the resolved factory registration to a snapshot file. The
+   * snapshot records the running ITK version and the library path of
+   * every dynamically loaded factory, so a later process can register
+   * the same factories without scanning the ITK_AUTOLOAD_PATH
+   * directories. Returns false if the file cannot be written. */
+  static bool
+  ExportFactorySnapshot(const std::string & fileName);
+
+  /** Rehydrate the factory registration from a snapshot written by
+   * ExportFactorySnapshot, skipping the ITK_AUTOLOAD_PATH directory
+   * scan. Must be called before the factory mechanism is first used;
+   * short-lived batch processes call it at startup. Returns false —
+   * leaving the normal initialization path untouched — when the
+   * factories are already initialized, the snapshot cannot be read, it
+   * was written by a different ITK version, or one of its libraries can
+   * no longer be loaded. */
+  static bool
+  RestoreFactorySnapshot(const std::string & fileName);
+
   /** Register a factory so it can be used to create itk objects.
    *  This method is intended to be called only for built-in default
    *  factories, not for loadable factories.
@@ -102,6 +122,47 @@ public:
   static void
   RegisterFactoryInternal(ObjectFactoryBase *);
 
+  /** Function registering one built-in factory, as generated for the IO
+   * factory register managers. */
+  using FactoryRegistrationFunction = void (*)();
+
+  /** Record a built-in factory for lazy registration. Instead of
+   * constructing the factory and its override maps at static
+   * initialization time, only the name and the registration function are
+   * stored; the function runs on the first factory dispatch
+   * (CreateInstance(), CreateAllInstance() or GetRegisteredFactories()).
+   * The IO factory register managers use this to keep the startup cost of
+   * short-lived tools low. */
+  static void
+  DeferFactoryRegistration(const char * name, FactoryRegistrationFunction registrationFunction);
+
+  /** Run the deferred registration functions that have not materialized
+   * yet. Called automatically on factory dispatch; calling it explicitly
+   * only makes the deferred factories available early. */
+  static void
+  MaterializeDeferredFactories();
+
+  /** One entry of the factory registration audit. */
+  struct FactoryRegistrationRecord
+  {
+    /** Factory name as recorded at registration time. */
+    std::string Name;
+    /** Whether the factory was recorded through DeferFactoryRegistration(). */
+    bool Deferred{ false };
+    /** Whether the registration function has run. Always true for
+     * factories that were registered eagerly. */
+    bool Materialized{ false };
+    /** Wall time in seconds spent constructing and registering the
+     * factory, including its override maps. Zero while not materialized. */
+    double RegistrationSeconds{ 0.0 };
+  };
+
+  /** Audit of the built-in factory registrations, reporting the
+   * registration cost of each factory and whether its registration was
+   * deferred and has materialized. Does not trigger materialization. */
+  static std::vector<FactoryRegistrationRecord>
+  GetFactoryRegistrationAudit();
+
   using InsertionPositionEnum = ObjectFactoryEnums::InsertionPosition;
 #if !defined(ITK_LEGACY_REMOVE)
   // We need to expose the enum values at the class level
@@ -219,6 +280,17 @@ public:
     CreateObjectFunctionBase::Pointer m_CreateObject;
   };
 
+  /** Function constructing one built-in factory, used to time its
+   * registration for the registration audit. The returned factory must
+   * carry one reference owned by the caller. */
+  using FactoryNewFunction = ObjectFactoryBase * (*)();
+
+  /** Construct and register an internal factory, recording its
+   * construction and registration cost in the registration audit.
+   * Consumes the caller-owned reference of the constructed factory. */
+  static void
+  RegisterFactoryInternalTimed(FactoryNewFunction factoryNew);
+
   /** Registers the specified internal factory only once, even when `RegisterInternalFactoryOnce<TFactory>()` is called
    * multiple times (possibly even by multiple threads) for the very same factory. */
   template <typename TFactory>
@@ -230,7 +302,12 @@ public:
 
     // Factory registration, made thread-safe by "magic statics" (as introduced with C++11).
     static const FactoryRegistration staticFactoryRegistration = [] {
-      RegisterFactoryInternal(TFactory::New());
+      RegisterFactoryInternalTimed([]() -> ObjectFactoryBase * {
+        const typename TFactory::Pointer factory = TFactory::New();
+        // hand one reference to RegisterFactoryInternalTimed
+        factory->Register();
+        return factory.GetPointer();
+      });
       return FactoryRegistration{};
     }();
 
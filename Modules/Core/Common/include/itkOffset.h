@@ -88,7 +88,7 @@ public:
 
 
   /** Add two offsets. */
-  const Self
+  constexpr const Self
   operator+(const Self & vec) const
   {
     Self result;
@@ -101,7 +101,7 @@ public:
   }
 
   /** Add a size to an offset.  */
-  const Self
+  constexpr const Self
   operator+(const Size<VDimension> & sz) const
   {
     Self result;
@@ -114,7 +114,7 @@ public:
   }
 
   /** Increment index by a size.  */
-  const Self &
+  constexpr const Self &
   operator+=(const Size<VDimension> & sz)
   {
     for (unsigned int i = 0; i < VDimension; ++i)
@@ -125,7 +125,7 @@ public:
   }
 
   /** Decrement index by a size.  */
-  const Self &
+  constexpr const Self &
   operator-=(const Size<VDimension> & sz)
   {
     for (unsigned int i = 0; i < VDimension; ++i)
@@ -136,7 +136,7 @@ public:
   }
 
   /** Subtract two offsets. */
-  const Self
+  constexpr const Self
   operator-(const Self & vec)
   {
     Self result;
@@ -149,7 +149,7 @@ public:
   }
 
   /** Increment offset by an offset.  */
-  const Self &
+  constexpr const Self &
   operator+=(const Self & vec)
   {
     for (unsigned int i = 0; i < VDimension; ++i)
@@ -160,7 +160,7 @@ public:
   }
 
   /** Decrement offset by an offset.  */
-  const Self &
+  constexpr const Self &
   operator-=(const Self & vec)
   {
     for (unsigned int i = 0; i < VDimension; ++i)
@@ -365,9 +365,9 @@ public:
     return false;
   }
 
-  reference operator[](size_type pos) { return m_InternalArray[pos]; }
+  constexpr reference operator[](size_type pos) { return m_InternalArray[pos]; }
 
-  const_reference operator[](size_type pos) const { return m_InternalArray[pos]; }
+  constexpr const_reference operator[](size_type pos) const { return m_InternalArray[pos]; }
 
   reference
   at(size_type pos)
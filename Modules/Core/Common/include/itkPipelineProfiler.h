@@ -0,0 +1,103 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkPipelineProfiler_h
+#define itkPipelineProfiler_h
+
+#include "itkIntTypes.h"
+#include "ITKCommonExport.h"
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace itk
+{
+
+class ProcessObject;
+
+/**
+ *\class PipelineProfiler
+ * \brief Opt-in global profiler recording every filter execution
+ *
+ * When enabled, ProcessObject::UpdateOutputData() records one entry per
+ * filter execution: the class and object name of the filter, the wall time
+ * of its GenerateData() call, the number of work units it was configured
+ * with, and the bytes held in its output buffers. This makes it possible to
+ * find the expensive or regressed filters of a large pipeline without
+ * instrumenting each one with TimeProbe by hand.
+ *
+ * The profiler is disabled by default and adds a single boolean test to the
+ * update path when disabled. The recorded runs can be queried directly with
+ * GetFilterRuns() or exported in the chrome-trace event format with
+ * WriteChromeTraceJSON(), which trace viewers can display as a timeline.
+ * Recording is thread safe; filters updated concurrently appear interleaved
+ * in the order they finish.
+ *
+ * \sa TimeProbe
+ * \sa ResourceProbe
+ * \ingroup ITKSystemObjects
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT PipelineProfiler
+{
+public:
+  /** One recorded filter execution. Times are in seconds relative to the
+   * moment profiling was last enabled or cleared. */
+  struct FilterRun
+  {
+    std::string   Name;
+    uintptr_t     FilterId;
+    double        StartSeconds;
+    double        DurationSeconds;
+    uint32_t      NumberOfWorkUnits;
+    SizeValueType OutputBytes;
+  };
+
+  /** Enable or disable the recording globally. Enabling does not clear
+   * previously recorded runs. */
+  static void
+  SetGlobalEnabled(bool enabled);
+  static bool
+  GetGlobalEnabled();
+
+  /** Discard all recorded runs and restart the time origin */
+  static void
+  Clear();
+
+  /** Get a copy of the recorded runs */
+  static std::vector<FilterRun>
+  GetFilterRuns();
+
+  /** Current timestamp in seconds on the profiler clock */
+  static double
+  GetTimestamp();
+
+  /** Record one filter execution. Called by ProcessObject::UpdateOutputData
+   * around GenerateData() when profiling is enabled. */
+  static void
+  RecordFilterRun(const ProcessObject * filter, double startSeconds, double endSeconds);
+
+  /** Write the recorded runs as chrome-trace complete events, loadable by
+   * trace viewers */
+  static void
+  WriteChromeTraceJSON(std::ostream & os);
+};
+
+} // end namespace itk
+
+#endif
@@ -0,0 +1,113 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkPrefetchImageFilter_h
+#define itkPrefetchImageFilter_h
+
+#include "itkImageToImageFilter.h"
+
+#include <future>
+
+namespace itk
+{
+/** \class PrefetchImageFilter
+ * \brief Reads the next streaming division upstream while downstream computes.
+ *
+ * In a streamed pipeline the divisions execute strictly one after the
+ * other: while division N is filtered the disk is idle, and while
+ * division N+1 is read the CPU is idle. Inserted between a streaming
+ * capable reader and the first filter, this filter overlaps the two
+ * phases. It copies each requested region into its own output buffer,
+ * predicts the next requested region from the stride between the last
+ * two requests, and updates the upstream pipeline for the predicted
+ * region on the global ThreadPool while downstream consumes the current
+ * buffer. When the prediction hits — as it does for the regular division
+ * sequences produced by the streaming region splitters — the upstream
+ * read of every division after the second is hidden behind downstream
+ * compute.
+ *
+ * Mispredicted or stale prefetches are discarded and the region is read
+ * synchronously, so the filter is transparent apart from the cost of one
+ * extra buffer of one division. Prefetching is disabled when only one
+ * thread is available.
+ *
+ * \sa StreamingImageFilter
+ * \sa ImageFileReader
+ * \ingroup ITKCommon MultiThreaded Streamed
+ */
+template <typename TImageType>
+class ITK_TEMPLATE_EXPORT PrefetchImageFilter : public ImageToImageFilter<TImageType, TImageType>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(PrefetchImageFilter);
+
+  /** Standard class typedefs. */
+  using Self = PrefetchImageFilter;
+  using Superclass = ImageToImageFilter<TImageType, TImageType>;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(PrefetchImageFilter, ImageToImageFilter);
+
+  using ImageType = TImageType;
+  using ImagePointer = typename ImageType::Pointer;
+  using RegionType = typename ImageType::RegionType;
+
+  /** Override UpdateOutputData() to manage the upstream requested
+   * regions itself: the consumed region comes from the prefetch buffer
+   * when possible, and the predicted next region is updated upstream on
+   * a background thread before this method returns. */
+  void
+  UpdateOutputData(DataObject * output) override;
+
+  /** Override PropagateRequestedRegion not to propagate upstream; the
+   * upstream requested regions are managed during UpdateOutputData,
+   * possibly from a background thread. */
+  void
+  PropagateRequestedRegion(DataObject * output) override;
+
+protected:
+  PrefetchImageFilter() = default;
+  ~PrefetchImageFilter() override;
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  /** The latest modification time of the upstream filter graph; used to
+   * detect prefetched data made stale by upstream changes. */
+  ModifiedTimeType
+  ComputeUpstreamMTime() const;
+
+  std::future<void> m_PrefetchFuture;
+  ImagePointer      m_PrefetchBuffer;
+  ModifiedTimeType  m_PrefetchUpstreamMTime{ 0 };
+  bool              m_HasPrefetch{ false };
+
+  RegionType m_PreviousRequestedRegion;
+  bool       m_HasPreviousRequestedRegion{ false };
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkPrefetchImageFilter.hxx"
+#endif
+
+#endif
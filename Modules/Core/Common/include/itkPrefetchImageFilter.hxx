@@ -0,0 +1,193 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkPrefetchImageFilter_hxx
+#define itkPrefetchImageFilter_hxx
+
+#include "itkPrefetchImageFilter.h"
+#include "itkAsynchronousPipelineUpdater.h"
+#include "itkImageAlgorithm.h"
+#include "itkMultiThreaderBase.h"
+#include "itkThreadPool.h"
+
+#include <algorithm>
+
+namespace itk
+{
+
+template <typename TImageType>
+PrefetchImageFilter<TImageType>::~PrefetchImageFilter()
+{
+  if (m_PrefetchFuture.valid())
+  {
+    m_PrefetchFuture.wait();
+  }
+}
+
+template <typename TImageType>
+void
+PrefetchImageFilter<TImageType>::PropagateRequestedRegion(DataObject * output)
+{
+  if (this->m_Updating)
+  {
+    return;
+  }
+
+  this->EnlargeOutputRequestedRegion(output);
+  this->GenerateOutputRequestedRegion(output);
+
+  // The upstream requested regions are managed in UpdateOutputData, where
+  // they may belong to a prefetch running on a background thread; do not
+  // propagate upstream here.
+}
+
+template <typename TImageType>
+ModifiedTimeType
+PrefetchImageFilter<TImageType>::ComputeUpstreamMTime() const
+{
+  ModifiedTimeType upstreamMTime = 0;
+  auto *           inputPtr = const_cast<ImageType *>(this->GetInput(0));
+  for (ProcessObject * filter : AsynchronousPipelineUpdater::CollectUpstreamFilters(inputPtr))
+  {
+    upstreamMTime = std::max(upstreamMTime, filter->GetMTime());
+  }
+  return upstreamMTime;
+}
+
+template <typename TImageType>
+void
+PrefetchImageFilter<TImageType>::UpdateOutputData(DataObject * itkNotUsed(output))
+{
+  if (this->m_Updating)
+  {
+    return;
+  }
+
+  // An in-flight prefetch owns the upstream pipeline; let it finish
+  // before anything upstream is touched. Failures surface here.
+  if (m_PrefetchFuture.valid())
+  {
+    m_PrefetchFuture.get();
+  }
+
+  this->PrepareOutputs();
+
+  const itk::ProcessObject::DataObjectPointerArraySizeType ninputs = this->GetNumberOfValidRequiredInputs();
+  if (ninputs < this->GetNumberOfRequiredInputs())
+  {
+    itkExceptionMacro(<< "At least " << this->GetNumberOfRequiredInputs() << " inputs are required but only " << ninputs
+                      << " are specified.");
+  }
+
+  this->InvokeEvent(StartEvent());
+  this->SetAbortGenerateData(0);
+  this->UpdateProgress(0.0);
+  this->m_Updating = true;
+
+  ImageType *      outputPtr = this->GetOutput(0);
+  const RegionType outputRegion = outputPtr->GetRequestedRegion();
+  auto *           inputPtr = const_cast<ImageType *>(this->GetInput(0));
+
+  const ModifiedTimeType upstreamMTime = this->ComputeUpstreamMTime();
+  const bool             usePrefetch = m_HasPrefetch && m_PrefetchBuffer.IsNotNull() &&
+                           m_PrefetchUpstreamMTime == upstreamMTime &&
+                           m_PrefetchBuffer->GetBufferedRegion().IsInside(outputRegion);
+  m_HasPrefetch = false;
+
+  if (!usePrefetch)
+  {
+    inputPtr->SetRequestedRegion(outputRegion);
+    inputPtr->PropagateRequestedRegion();
+    inputPtr->UpdateOutputData();
+  }
+
+  outputPtr->SetBufferedRegion(outputRegion);
+  outputPtr->Allocate();
+  if (usePrefetch)
+  {
+    ImageAlgorithm::Copy(m_PrefetchBuffer.GetPointer(), outputPtr, outputRegion, outputRegion);
+  }
+  else
+  {
+    ImageAlgorithm::Copy(this->GetInput(0), outputPtr, outputRegion, outputRegion);
+  }
+
+  // Predict the next requested region from the stride between the last
+  // two requests and read it upstream in the background. The prediction
+  // matches the regular division sequences of the streaming splitters;
+  // anything else simply falls back to the synchronous path above.
+  bool       startPrefetch = false;
+  RegionType predictedRegion = outputRegion;
+  if (m_HasPreviousRequestedRegion && MultiThreaderBase::GetGlobalDefaultNumberOfThreads() > 1 &&
+      m_PreviousRequestedRegion.GetSize() == outputRegion.GetSize() &&
+      m_PreviousRequestedRegion.GetIndex() != outputRegion.GetIndex())
+  {
+    for (unsigned int i = 0; i < ImageType::ImageDimension; ++i)
+    {
+      predictedRegion.SetIndex(i, 2 * outputRegion.GetIndex(i) - m_PreviousRequestedRegion.GetIndex(i));
+    }
+    startPrefetch =
+      predictedRegion.Crop(inputPtr->GetLargestPossibleRegion()) && predictedRegion != outputRegion;
+  }
+  if (startPrefetch)
+  {
+    m_PrefetchBuffer = ImageType::New();
+    m_PrefetchBuffer->CopyInformation(inputPtr);
+    m_PrefetchBuffer->SetRegions(predictedRegion);
+    m_PrefetchBuffer->Allocate();
+    m_PrefetchUpstreamMTime = upstreamMTime;
+    m_HasPrefetch = true;
+
+    m_PrefetchFuture = ThreadPool::GetInstance()->AddWork(
+      [input = typename ImageType::Pointer(inputPtr), buffer = m_PrefetchBuffer, predictedRegion] {
+        input->SetRequestedRegion(predictedRegion);
+        input->PropagateRequestedRegion();
+        input->UpdateOutputData();
+        ImageAlgorithm::Copy(
+          static_cast<const ImageType *>(input.GetPointer()), buffer.GetPointer(), predictedRegion, predictedRegion);
+      });
+  }
+  m_PreviousRequestedRegion = outputRegion;
+  m_HasPreviousRequestedRegion = true;
+
+  this->UpdateProgress(1.0);
+  this->InvokeEvent(EndEvent());
+
+  for (auto & outputName : this->GetOutputNames())
+  {
+    if (this->ProcessObject::GetOutput(outputName))
+    {
+      this->ProcessObject::GetOutput(outputName)->DataHasBeenGenerated();
+    }
+  }
+
+  this->m_Updating = false;
+}
+
+template <typename TImageType>
+void
+PrefetchImageFilter<TImageType>::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "HasPrefetch: " << (m_HasPrefetch ? "On" : "Off") << std::endl;
+  itkPrintSelfObjectMacro(PrefetchBuffer);
+}
+
+} // end namespace itk
+
+#endif
@@ -403,6 +403,43 @@ public:
   virtual void
   UpdateOutputInformation();
 
+  /** Set/Get the global incremental pipeline invalidation mode.
+   *
+   * When enabled, Modified() pushes a dirty flag to all downstream
+   * filters once, and UpdateOutputInformation() short-circuits
+   * immediately on filters whose upstream pipeline has not changed.
+   * An unchanged pipeline's Update() then completes without re-walking
+   * the graph and re-comparing modified times, which matters for large
+   * static graphs updated at frame rate. Off by default; when enabled,
+   * VerifyPreconditions() is only re-run on invalidated filters.
+   *
+   * \warning Some filters aggregate the modified times of member
+   * objects by overriding GetMTime(), e.g. ResampleImageFilter with its
+   * transform and interpolator. Modifying only such a member does not
+   * push invalidation downstream: the aggregating filter itself is
+   * renegotiated when an Update() reaches it, but filters downstream of
+   * it short-circuit and can return stale results. In that situation
+   * call Modified() on the aggregating filter after modifying the
+   * member, or leave this mode disabled. */
+  static void
+  SetGlobalIncrementalPipelineInvalidation(bool val);
+  static bool
+  GetGlobalIncrementalPipelineInvalidation();
+
+  /** Mark this filter and everything downstream of it as requiring
+   * pipeline renegotiation. Invoked by Modified() (and by the Modified()
+   * of input DataObjects) when incremental pipeline invalidation is
+   * enabled. Propagation stops at filters that are already marked, so
+   * repeated modifications are O(1). */
+  void
+  InvalidatePipeline() const;
+
+  /** Standard Modified(), additionally pushing pipeline invalidation to
+   * downstream filters when incremental pipeline invalidation is
+   * enabled. */
+  void
+  Modified() const override;
+
   /** Send the requested region information back up the pipeline (to the
    * filters that precede this one). */
   virtual void
@@ -473,6 +510,27 @@ public:
     this->SetReleaseDataFlag(false);
   }
 
+  /** In-place execution negotiation hooks. A filter that can reuse its
+   * input buffer for its output overrides these, as InPlaceImageFilter
+   * does; the defaults describe a filter without that capability. They
+   * are declared here, type-erased, so that pipeline-level planners can
+   * negotiate buffer reuse across a heterogeneous filter graph without
+   * knowing the image types involved.
+   * \sa InPlaceImageFilter
+   * \sa InPlacePipelinePlanner */
+  virtual bool
+  CanRunInPlace() const
+  {
+    return false;
+  }
+  virtual void
+  SetInPlace(bool) {}
+  virtual bool
+  GetInPlace() const
+  {
+    return false;
+  }
+
   /** Turn on/off the flags to control whether the bulk data belonging
    * to the outputs of this ProcessObject are released/reallocated
    * during an Update().  In limited memory scenarios, a user may want
@@ -889,7 +947,8 @@ protected:
 
   /**
    * When true, the MultiThreader will report course grain progress. If set to false, a progress must be explicitly
-   * updated in derived filters.
+   * updated in derived filters. Setting this to false also makes TotalProgressReporter instances created for this
+   * filter inert, disabling progress accounting in threaded hot loops.
    */
   itkGetConstMacro(ThreaderUpdateProgress, bool);
   itkBooleanMacro(ThreaderUpdateProgress);
@@ -977,11 +1036,33 @@ private:
 
   bool m_ThreaderUpdateProgress{ true };
 
+  /** Whether this filter's upstream pipeline has changed since the last
+   * negotiation; only consulted when incremental pipeline invalidation
+   * is enabled. Mutable because Modified() is const. */
+  mutable bool m_PipelineDirty{ true };
+
+  /** The filter's aggregated modified time when the pipeline was last
+   * negotiated. Guards the short-circuit against filters whose
+   * GetMTime() override aggregates member objects: modifying such a
+   * member does not call this filter's Modified(). */
+  mutable ModifiedTimeType m_PipelineCleanTime{ 0 };
+
   /** Memory management ivars */
   bool m_ReleaseDataBeforeUpdateFlag;
 
+  /** Register this filter as consumer of a newly set input and
+   * deregister it from the replaced one. One registration is kept per
+   * input slot holding the data object. */
+  void
+  TrackInputConsumer(DataObject * oldInput, DataObject * newInput);
+
+  /** Only used to synchronize the global variable across static libraries.*/
+  itkGetGlobalDeclarationMacro(bool, GlobalIncrementalPipelineInvalidation);
+  static bool * m_GlobalIncrementalPipelineInvalidation;
+
   /** Friends of ProcessObject */
   friend class DataObject;
+  friend class TotalProgressReporter;
 
   friend class DataObjectConstIterator;
   friend class InputDataObjectConstIterator;
@@ -0,0 +1,130 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkRecyclingImageBufferAllocator_h
+#define itkRecyclingImageBufferAllocator_h
+
+#include "itkImageBufferAllocator.h"
+#include <map>
+#include <mutex>
+
+namespace itk
+{
+/** \class RecyclingImageBufferAllocator
+ *  \brief Buffer allocator that recycles released buffers through a
+ *  size-keyed free list.
+ *
+ * Pipelines that call Update() repeatedly (e.g. per video frame)
+ * reallocate every in-place-incapable filter output on each run. This
+ * allocator keeps released buffers on a free list keyed by element
+ * count; a later allocation request of the same size is satisfied from
+ * the list with already-faulted pages, eliminating per-frame
+ * malloc/page-fault churn. Requests with no exact-size match fall back
+ * to ordinary allocation. The pixel type is part of the key implicitly,
+ * as the allocator is templated over the element type.
+ *
+ * The cache is opt-in: install an instance (typically the per-type
+ * singleton from GetInstance()) on the pixel containers whose buffers
+ * should be recycled, e.g.
+ * \code
+ * image->GetPixelContainer()->SetAllocator(
+ *   itk::RecyclingImageBufferAllocator<float>::GetInstance());
+ * \endcode
+ *
+ * The amount of memory parked on the free list is bounded by
+ * MaximumFreeListSizeInBytes; buffers released beyond that bound are
+ * freed immediately. All methods are thread-safe.
+ *
+ * \tparam TElement The element type stored in the allocated buffers.
+ *
+ * \sa ImageBufferAllocator
+ * \sa ImportImageContainer
+ * \ingroup ImageObjects
+ * \ingroup ITKCommon
+ */
+template <typename TElement>
+class ITK_TEMPLATE_EXPORT RecyclingImageBufferAllocator : public ImageBufferAllocator<TElement>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(RecyclingImageBufferAllocator);
+
+  /** Standard class type aliases. */
+  using Self = RecyclingImageBufferAllocator;
+  using Superclass = ImageBufferAllocator<TElement>;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Standard part of every itk Object. */
+  itkTypeMacro(RecyclingImageBufferAllocator, ImageBufferAllocator);
+
+  /** Returns a per-element-type singleton instance, convenient for
+   * sharing one free list across all containers of a pixel type. */
+  static Pointer
+  GetInstance();
+
+  /** Satisfy the request from the free list when a buffer of exactly
+   * the requested element count is available, otherwise allocate. */
+  TElement *
+  Allocate(SizeValueType size, bool UseDefaultConstructor = false) override;
+
+  /** Park the buffer on the free list for reuse, or free it when the
+   * free list is at capacity. */
+  void
+  Deallocate(TElement * buffer, SizeValueType size) override;
+
+  /** Set/Get the upper bound on the memory parked on the free list.
+   * Setting a smaller bound trims the free list immediately. */
+  void
+  SetMaximumFreeListSizeInBytes(SizeValueType maximumBytes);
+  SizeValueType
+  GetMaximumFreeListSizeInBytes() const;
+
+  /** The memory currently parked on the free list. */
+  SizeValueType
+  GetFreeListSizeInBytes() const;
+
+  /** Release all buffers held on the free list. */
+  void
+  Clear();
+
+protected:
+  RecyclingImageBufferAllocator() = default;
+  ~RecyclingImageBufferAllocator() override { this->Clear(); }
+
+private:
+  /** Free buffers until the free list fits within the given bound.
+   * The mutex must be held by the caller. */
+  void
+  TrimFreeList(SizeValueType maximumBytes);
+
+  using FreeListType = std::multimap<SizeValueType, TElement *>;
+
+  FreeListType       m_FreeList;
+  SizeValueType      m_FreeListSizeInBytes{ 0 };
+  SizeValueType      m_MaximumFreeListSizeInBytes{ 1024 * 1024 * 1024 }; // 1 GiB
+  mutable std::mutex m_Mutex;
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkRecyclingImageBufferAllocator.hxx"
+#endif
+
+#endif
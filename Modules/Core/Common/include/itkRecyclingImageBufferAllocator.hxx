@@ -0,0 +1,122 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkRecyclingImageBufferAllocator_hxx
+#define itkRecyclingImageBufferAllocator_hxx
+
+#include "itkRecyclingImageBufferAllocator.h"
+#include <algorithm> // For fill_n.
+
+namespace itk
+{
+template <typename TElement>
+auto
+RecyclingImageBufferAllocator<TElement>::GetInstance() -> Pointer
+{
+  // Initialization of function-local statics is thread-safe.
+  static const Pointer instance = Self::New();
+  return instance;
+}
+
+template <typename TElement>
+TElement *
+RecyclingImageBufferAllocator<TElement>::Allocate(SizeValueType size, bool UseDefaultConstructor)
+{
+  {
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+    auto                        it = m_FreeList.find(size);
+    if (it != m_FreeList.end())
+    {
+      TElement * buffer = it->second;
+      m_FreeList.erase(it);
+      m_FreeListSizeInBytes -= size * sizeof(TElement);
+      if (UseDefaultConstructor)
+      {
+        std::fill_n(buffer, size, TElement());
+      }
+      return buffer;
+    }
+  }
+  return Superclass::Allocate(size, UseDefaultConstructor);
+}
+
+template <typename TElement>
+void
+RecyclingImageBufferAllocator<TElement>::Deallocate(TElement * buffer, SizeValueType size)
+{
+  const SizeValueType sizeInBytes = size * sizeof(TElement);
+  {
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+    if (size > 0 && m_FreeListSizeInBytes + sizeInBytes <= m_MaximumFreeListSizeInBytes)
+    {
+      m_FreeList.emplace(size, buffer);
+      m_FreeListSizeInBytes += sizeInBytes;
+      return;
+    }
+  }
+  Superclass::Deallocate(buffer, size);
+}
+
+template <typename TElement>
+void
+RecyclingImageBufferAllocator<TElement>::SetMaximumFreeListSizeInBytes(SizeValueType maximumBytes)
+{
+  std::lock_guard<std::mutex> lockGuard(m_Mutex);
+  m_MaximumFreeListSizeInBytes = maximumBytes;
+  this->TrimFreeList(maximumBytes);
+}
+
+template <typename TElement>
+SizeValueType
+RecyclingImageBufferAllocator<TElement>::GetMaximumFreeListSizeInBytes() const
+{
+  std::lock_guard<std::mutex> lockGuard(m_Mutex);
+  return m_MaximumFreeListSizeInBytes;
+}
+
+template <typename TElement>
+SizeValueType
+RecyclingImageBufferAllocator<TElement>::GetFreeListSizeInBytes() const
+{
+  std::lock_guard<std::mutex> lockGuard(m_Mutex);
+  return m_FreeListSizeInBytes;
+}
+
+template <typename TElement>
+void
+RecyclingImageBufferAllocator<TElement>::Clear()
+{
+  std::lock_guard<std::mutex> lockGuard(m_Mutex);
+  this->TrimFreeList(0);
+}
+
+template <typename TElement>
+void
+RecyclingImageBufferAllocator<TElement>::TrimFreeList(SizeValueType maximumBytes)
+{
+  // Free the largest parked buffers first.
+  while (m_FreeListSizeInBytes > maximumBytes && !m_FreeList.empty())
+  {
+    auto last = std::prev(m_FreeList.end());
+    m_FreeListSizeInBytes -= last->first * sizeof(TElement);
+    delete[] last->second;
+    m_FreeList.erase(last);
+  }
+}
+} // end namespace itk
+
+#endif
@@ -89,7 +89,7 @@ public:
   }
 
   /** Add two sizes.  */
-  const Self
+  constexpr const Self
   operator+(const Self & vec) const
   {
     Self result;
@@ -102,7 +102,7 @@ public:
   }
 
   /** Increment size by a size.  */
-  const Self &
+  constexpr const Self &
   operator+=(const Self & vec)
   {
     for (unsigned int i = 0; i < VDimension; ++i)
@@ -113,7 +113,7 @@ public:
   }
 
   /** Subtract two sizes.  */
-  const Self
+  constexpr const Self
   operator-(const Self & vec) const
   {
     Self result;
@@ -126,7 +126,7 @@ public:
   }
 
   /** Decrement size by a size.  */
-  const Self &
+  constexpr const Self &
   operator-=(const Self & vec)
   {
     for (unsigned int i = 0; i < VDimension; ++i)
@@ -137,7 +137,7 @@ public:
   }
 
   /** Multiply two sizes (elementwise product).  */
-  const Self operator*(const Self & vec) const
+  constexpr const Self operator*(const Self & vec) const
   {
     Self result;
 
@@ -149,7 +149,7 @@ public:
   }
 
   /** Multiply two sizes (elementwise product).  */
-  const Self &
+  constexpr const Self &
   operator*=(const Self & vec)
   {
     for (unsigned int i = 0; i < VDimension; ++i)
@@ -195,7 +195,7 @@ public:
    * \warning No bound checking is performed
    * \sa GetSize()
    * \sa SetElement() */
-  SizeValueType
+  constexpr SizeValueType
   GetElement(unsigned long element) const
   {
     return m_InternalArray[element];
@@ -0,0 +1,83 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkSmallObjectPool_h
+#define itkSmallObjectPool_h
+
+#include "itkMacro.h"
+#include "ITKCommonExport.h"
+#include <cstddef>
+
+namespace itk
+{
+/** \class SmallObjectPool
+ *  \brief Slab allocator with thread-local free lists for small objects.
+ *
+ * Pipelines that create thousands of small reference-counted objects per
+ * frame (transforms, metric samples, LabelObject lines) contend on the
+ * global allocator through LightObject::New. This pool carves fixed
+ * size-class chunks out of per-thread slabs: allocation and same-thread
+ * deallocation touch only thread-local free lists, while frees from a
+ * different thread are pushed onto a mutex-protected remote list that
+ * the owning arena reclaims lazily. Requests above the largest size
+ * class fall through to operator new.
+ *
+ * The pool is opt-in per class. Place the
+ * itkSmallObjectPoolAllocationMacro inside the declaration of a
+ * LightObject-derived class to route its instances through the pool:
+ * \code
+ * class MySample : public LightObject
+ * {
+ * public:
+ *   itkSmallObjectPoolAllocationMacro();
+ *   ...
+ * };
+ * \endcode
+ *
+ * Arenas are retired to a global reuse list when their thread exits, so
+ * chunks freed after the allocating thread is gone remain valid.
+ *
+ * \sa LightObject
+ * \ingroup ITKSystemObjects
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT SmallObjectPool
+{
+public:
+  /** Return a chunk of at least the given size. Never returns nullptr;
+   * throws std::bad_alloc when memory is exhausted. */
+  static void *
+  Allocate(std::size_t size);
+
+  /** Return a chunk previously obtained from Allocate. Safe to call
+   * from any thread. */
+  static void
+  Deallocate(void * ptr);
+};
+
+/** Place inside a class declaration to allocate its instances from the
+ * SmallObjectPool. The operators are inherited by derived classes;
+ * larger derived types simply map to a larger size class. */
+#define itkSmallObjectPoolAllocationMacro()                                              \
+  static void * operator new(std::size_t size) { return itk::SmallObjectPool::Allocate(size); } \
+  static void   operator delete(void * ptr) { itk::SmallObjectPool::Deallocate(ptr); }   \
+  static void * operator new[](std::size_t size) { return ::operator new(size); }        \
+  static void   operator delete[](void * ptr) { ::operator delete(ptr); }
+
+} // end namespace itk
+
+#endif
@@ -90,6 +90,18 @@ public:
   itkSetObjectMacro(RegionSplitter, SplitterType);
   itkGetModifiableObjectMacro(RegionSplitter, SplitterType);
 
+  /** Set/Get a memory budget, in bytes, for the upstream pipeline. When
+   * non-zero, the number of stream divisions is chosen automatically: the
+   * requested region of one candidate division is propagated up the
+   * pipeline, the peak buffer sizes of the upstream filters are estimated
+   * from the resulting requested regions, and the smallest division count
+   * whose estimate fits the budget is used, overriding
+   * NumberOfStreamDivisions. The budget covers the transient upstream
+   * buffers only; this filter's own output buffer is always allocated at
+   * full size. The default is 0, which disables the automatic selection. */
+  itkSetMacro(MemoryLimitInBytes, SizeValueType);
+  itkGetConstReferenceMacro(MemoryLimitInBytes, SizeValueType);
+
   /** Override UpdateOutputData() from ProcessObject to divide upstream
    * updates into pieces. This filter does not have a GenerateData()
    * or ThreadedGenerateData() method.  Instead, all the work is done
@@ -119,8 +131,19 @@ protected:
   PrintSelf(std::ostream & os, Indent indent) const override;
 
 private:
+  /** Pick the smallest division count, up to the given maximum, for which
+   * the estimated upstream memory of one division fits the budget. */
+  unsigned int
+  ComputeDivisionsForMemoryLimit(const OutputImageRegionType & outputRegion, unsigned int maximumNumberOfDivisions);
+
+  /** Propagate the given requested region up the pipeline and sum the
+   * estimated buffer sizes of all upstream filter outputs. */
+  SizeValueType
+  EstimateUpstreamMemoryFor(const InputImageRegionType & streamRegion);
+
   unsigned int          m_NumberOfStreamDivisions;
   RegionSplitterPointer m_RegionSplitter;
+  SizeValueType         m_MemoryLimitInBytes;
 };
 } // end namespace itk
 
@@ -18,9 +18,12 @@
 #ifndef itkStreamingImageFilter_hxx
 #define itkStreamingImageFilter_hxx
 #include "itkStreamingImageFilter.h"
+#include "itkAsynchronousPipelineUpdater.h"
 #include "itkCommand.h"
 #include "itkImageAlgorithm.h"
+#include "itkImageBase.h"
 #include "itkImageRegionSplitterSlowDimension.h"
+#include "itkNumericTraits.h"
 
 namespace itk
 {
@@ -35,6 +38,9 @@ StreamingImageFilter<TInputImage, TOutputImage>::StreamingImageFilter()
 
   // create default region splitter
   m_RegionSplitter = ImageRegionSplitterSlowDimension::New();
+
+  // no memory budget by default
+  m_MemoryLimitInBytes = 0;
 }
 
 /**
@@ -47,6 +53,7 @@ StreamingImageFilter<TInputImage, TOutputImage>::PrintSelf(std::ostream & os, In
   Superclass::PrintSelf(os, indent);
 
   os << indent << "Number of stream divisions: " << m_NumberOfStreamDivisions << std::endl;
+  os << indent << "Memory limit in bytes: " << m_MemoryLimitInBytes << std::endl;
 
   itkPrintSelfObjectMacro(RegionSplitter);
 }
@@ -162,6 +169,17 @@ StreamingImageFilter<TInputImage, TOutputImage>::UpdateOutputData(DataObject * i
     numDivisions = numDivisionsFromSplitter;
   }
 
+  /**
+   * A memory budget overrides the manual division count; the splitter still
+   * bounds how finely the region can be divided.
+   */
+  if (m_MemoryLimitInBytes > 0)
+  {
+    const unsigned int maximumNumberOfDivisions =
+      m_RegionSplitter->GetNumberOfSplits(outputRegion, NumericTraits<unsigned int>::max());
+    numDivisions = this->ComputeDivisionsForMemoryLimit(outputRegion, maximumNumberOfDivisions);
+  }
+
   /**
    * Loop over the number of pieces, execute the upstream pipeline on each
    * piece, and copy the results into the output image.
@@ -172,15 +190,22 @@ StreamingImageFilter<TInputImage, TOutputImage>::UpdateOutputData(DataObject * i
     InputImageRegionType streamRegion = outputRegion;
     m_RegionSplitter->GetSplit(piece, numDivisions, streamRegion);
 
-    inputPtr->SetRequestedRegion(streamRegion);
-    inputPtr->PropagateRequestedRegion();
-    inputPtr->UpdateOutputData();
+    // An earlier division may have left this region buffered already, e.g.
+    // when an upstream filter enlarges its output requested region or can
+    // only produce a larger chunk. Reuse the buffered overlap instead of
+    // re-executing the upstream pipeline.
+    if (piece == 0 || !inputPtr->GetBufferedRegion().IsInside(streamRegion))
+    {
+      inputPtr->SetRequestedRegion(streamRegion);
+      inputPtr->PropagateRequestedRegion();
+      inputPtr->UpdateOutputData();
+    }
 
     // copy the result to the proper place in the output. the input
     // requested region determined by the RegionSplitter (as opposed
     // to what the pipeline might have enlarged it to) is used to
     // copy the regions from the input to output
-    ImageAlgorithm::Copy(inputPtr, outputPtr, streamRegion, streamRegion);
+    ImageAlgorithm::ParallelCopy(inputPtr, outputPtr, streamRegion, streamRegion, this->GetMultiThreader());
 
 
     this->UpdateProgress(static_cast<float>(piece) / static_cast<float>(numDivisions));
@@ -217,6 +242,65 @@ StreamingImageFilter<TInputImage, TOutputImage>::UpdateOutputData(DataObject * i
   // Mark that we are no longer updating the data in this filter
   this->m_Updating = false;
 }
+
+/**
+ *
+ */
+template <typename TInputImage, typename TOutputImage>
+unsigned int
+StreamingImageFilter<TInputImage, TOutputImage>::ComputeDivisionsForMemoryLimit(
+  const OutputImageRegionType & outputRegion,
+  unsigned int                  maximumNumberOfDivisions)
+{
+  // Upstream memory shrinks roughly with the division count, but enlarged
+  // requested regions (e.g. neighborhood overlap) make it nonlinear, so
+  // probe actual division counts with a doubling search. Each probe costs
+  // one requested region propagation, not an execution.
+  unsigned int requestedDivisions = 1;
+  while (true)
+  {
+    const unsigned int divisions = m_RegionSplitter->GetNumberOfSplits(outputRegion, requestedDivisions);
+
+    InputImageRegionType streamRegion = outputRegion;
+    m_RegionSplitter->GetSplit(0, divisions, streamRegion);
+
+    if (this->EstimateUpstreamMemoryFor(streamRegion) <= m_MemoryLimitInBytes ||
+        divisions >= maximumNumberOfDivisions)
+    {
+      return divisions;
+    }
+    requestedDivisions = divisions * 2;
+  }
+}
+
+/**
+ *
+ */
+template <typename TInputImage, typename TOutputImage>
+SizeValueType
+StreamingImageFilter<TInputImage, TOutputImage>::EstimateUpstreamMemoryFor(const InputImageRegionType & streamRegion)
+{
+  auto * inputPtr = const_cast<InputImageType *>(this->GetInput(0));
+  inputPtr->SetRequestedRegion(streamRegion);
+  inputPtr->PropagateRequestedRegion();
+
+  SizeValueType totalBytes = 0;
+  for (ProcessObject * filter : AsynchronousPipelineUpdater::CollectUpstreamFilters(inputPtr))
+  {
+    for (const DataObject::Pointer & filterOutput : filter->GetOutputs())
+    {
+      const auto * imageOutput = dynamic_cast<const ImageBase<InputImageDimension> *>(filterOutput.GetPointer());
+      if (imageOutput != nullptr)
+      {
+        // The pixel container types of upstream outputs are not known at
+        // this level; the input's component size is used as representative.
+        totalBytes += static_cast<SizeValueType>(imageOutput->GetRequestedRegion().GetNumberOfPixels()) *
+                      imageOutput->GetNumberOfComponentsPerPixel() * sizeof(typename InputImageType::InternalPixelType);
+      }
+    }
+  }
+  return totalBytes;
+}
 } // end namespace itk
 
 #endif
@@ -123,6 +123,24 @@ auto result = pool->AddWork([](int param) { return param; }, 7);
   static void
   SetDoNotWaitForThreads(bool doNotWaitForThreads);
 
+  /** Set/Get whether worker threads are pinned to logical cores.
+   *
+   * When enabled, worker i is bound to core i modulo the number of logical
+   * cores, in the order the operating system enumerates them. Keeping each
+   * worker resident on one core (and thereby one NUMA node on multi-socket
+   * machines) avoids cross-socket memory traffic for buffers that were
+   * first touched by that worker, and pairs well with first-touch
+   * initialization of large image buffers.
+   *
+   * Affinity is also enabled when the ITK_THREAD_POOL_AFFINITY environment
+   * variable is set to a non-zero value. Pinning is only supported with
+   * pthreads on systems providing pthread_setaffinity_np and on Windows;
+   * elsewhere this setting has no effect. */
+  static bool
+  GetThreadAffinityEnabled();
+  static void
+  SetThreadAffinityEnabled(bool enableAffinity);
+
 protected:
   /** We need access to the mutex in AddWork, and the variable is only
    * visible in .cxx file, so this method returns it. */
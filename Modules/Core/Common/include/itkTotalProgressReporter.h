@@ -34,6 +34,11 @@ namespace itk
  * report will update the progress after a sufficient number of pixel to meet the numberOfUpdates requirement between
  * all threads. Also when the object is deconstructed, all remaining pixels will increment the progress.
  *
+ * Each thread counts completed pixels in its own members and only publishes batched increments to the shared
+ * filter counter, so the contended update is infrequent. When the filter's ThreaderUpdateProgress flag is off, the
+ * reporter is inert: no progress increments and no per-pixel abort checks are performed, which removes progress
+ * accounting from hot loops entirely.
+ *
  *
  * \ingroup ITKCommon
  */
@@ -309,6 +309,13 @@ public:
     return m_Buffer.GetPointer();
   }
 
+  /** Return the number of bytes held in the pixel container. */
+  SizeValueType
+  GetBufferSizeInBytes() const override
+  {
+    return m_Buffer ? static_cast<SizeValueType>(m_Buffer->Size() * sizeof(InternalPixelType)) : 0;
+  }
+
   /** Set the container to use. Note that this does not cause the
    * DataObject to be modified. */
   void
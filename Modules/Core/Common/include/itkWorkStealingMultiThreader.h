@@ -0,0 +1,143 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkWorkStealingMultiThreader_h
+#define itkWorkStealingMultiThreader_h
+
+#include "itkMultiThreaderBase.h"
+#include "itkThreadPool.h"
+
+namespace itk
+{
+/** \class WorkStealingMultiThreader
+ * \brief A class for performing multithreaded execution with dynamic
+ * load balancing on a thread pool back end.
+ *
+ * The requested image region or array range is over-decomposed into
+ * many more chunks than there are worker threads. Workers claim chunks
+ * from a shared queue as they become idle, so threads which received
+ * cheap chunks keep "stealing" the remaining work from loaded ones.
+ * This improves core utilization for workloads whose per-region cost
+ * is highly non-uniform, e.g. masked metrics or sparse label maps,
+ * at the price of slightly higher scheduling overhead than
+ * PoolMultiThreader's static splitting.
+ *
+ * The over-decomposition ratio is controlled by OversubscriptionFactor:
+ * roughly OversubscriptionFactor chunks are created per work unit.
+ *
+ * This threader can be selected globally via
+ * MultiThreaderBase::SetGlobalDefaultThreader(ThreaderEnum::WorkStealing)
+ * or the ITK_GLOBAL_DEFAULT_THREADER=WorkStealing environment variable.
+ *
+ * \ingroup OSSystemObjects
+ *
+ * \ingroup ITKCommon
+ */
+
+class ITKCommon_EXPORT WorkStealingMultiThreader : public MultiThreaderBase
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(WorkStealingMultiThreader);
+
+  /** Standard class type aliases. */
+  using Self = WorkStealingMultiThreader;
+  using Superclass = MultiThreaderBase;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(WorkStealingMultiThreader, MultiThreaderBase);
+
+  /** Execute the SingleMethod (as define by SetSingleMethod) using
+   * m_NumberOfWorkUnits work units. As a side effect the m_NumberOfWorkUnits will be
+   * checked against the current m_GlobalMaximumNumberOfThreads and clamped if
+   * necessary. The legacy SingleMethod interface partitions work by
+   * WorkUnitID inside the user callback, so no load balancing is
+   * possible here and work units are simply dispatched to the pool. */
+  void
+  SingleMethodExecute() override;
+
+  /** Set the SingleMethod to f() and the UserData field of the
+   * WorkUnitInfo that is passed to it will be data.
+   * This method must be of type itkThreadFunctionType and
+   * must take a single argument of type void. */
+  void
+  SetSingleMethod(ThreadFunctionType, void * data) override;
+
+  /** Parallelize an operation over an array with dynamic chunk claiming.
+   * If filter argument is not nullptr, this function will update its
+   * progress as each chunk is completed. */
+  void
+  ParallelizeArray(SizeValueType             firstIndex,
+                   SizeValueType             lastIndexPlus1,
+                   ArrayThreadingFunctorType aFunc,
+                   ProcessObject *           filter) override;
+
+  /** Break up region into many small chunks; idle workers claim the
+   * next unprocessed chunk until all chunks are done. */
+  void
+  ParallelizeImageRegion(unsigned int         dimension,
+                         const IndexValueType index[],
+                         const SizeValueType  size[],
+                         ThreadingFunctorType funcP,
+                         ProcessObject *      filter) override;
+
+  /** Set the number of threads to use. WorkStealingMultiThreader
+   * can only INCREASE its number of threads. */
+  void
+  SetMaximumNumberOfThreads(ThreadIdType numberOfThreads) override;
+
+  /** Set/Get the number of chunks created per work unit.
+   * Higher values balance non-uniform workloads better, but increase
+   * scheduling overhead. Clamped to the range [1, 64]. */
+  itkSetClampMacro(OversubscriptionFactor, ThreadIdType, 1, 64);
+  itkGetConstMacro(OversubscriptionFactor, ThreadIdType);
+
+  struct ThreadPoolInfoStruct : WorkUnitInfo
+  {
+    std::future<ITK_THREAD_RETURN_TYPE> Future;
+  };
+
+protected:
+  WorkStealingMultiThreader();
+  ~WorkStealingMultiThreader() override;
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  // Thread pool instance and factory
+  ThreadPool::Pointer m_ThreadPool;
+
+  /** Number of chunks to create per work unit. */
+  ThreadIdType m_OversubscriptionFactor{ 8 };
+
+  /** An array of work unit information containing a work unit id
+   *  (0, 1, 2, .. ITK_MAX_THREADS-1), work unit count, and a pointer
+   *  to void so that user data can be passed to each thread. */
+  ThreadPoolInfoStruct m_ThreadInfoArray[ITK_MAX_THREADS];
+
+  /** Friends of Multithreader.
+   * ProcessObject is a friend so that it can call PrintSelf() on its
+   * Multithreader. */
+  friend class ProcessObject;
+};
+
+} // end namespace itk
+#endif
@@ -0,0 +1,128 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkWorkUnitInstrumentation_h
+#define itkWorkUnitInstrumentation_h
+
+#include "itkIntTypes.h"
+#include "ITKCommonExport.h"
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+namespace itk
+{
+
+/**
+ *\class WorkUnitInstrumentation
+ * \brief Interface for callbacks around every ParallelizeImageRegion work unit
+ *
+ * An instrumentation object registered with
+ * MultiThreaderBase::SetGlobalWorkUnitInstrumentation() is invoked on the
+ * executing thread immediately before and after each work unit of
+ * ParallelizeImageRegion, with the dimension and the region of the work
+ * unit. Implementations can sample hardware counters, timers or tracing
+ * back-ends around the per-region work of every filter without modifying
+ * the filters; the executing thread can be identified with
+ * std::this_thread::get_id().
+ *
+ * Both callbacks are invoked concurrently from the worker threads and must
+ * be thread safe. They run on the hot path, so they should be cheap.
+ *
+ * \sa MultiThreaderBase
+ * \sa WorkUnitTimingCollector
+ * \ingroup ITKSystemObjects
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT WorkUnitInstrumentation
+{
+public:
+  virtual ~WorkUnitInstrumentation() = default;
+
+  /** Called on the executing thread right before a work unit runs */
+  virtual void
+  WorkUnitBegin(unsigned int dimension, const IndexValueType index[], const SizeValueType size[]) = 0;
+
+  /** Called on the executing thread right after a work unit finished */
+  virtual void
+  WorkUnitEnd(unsigned int dimension, const IndexValueType index[], const SizeValueType size[]) = 0;
+};
+
+/**
+ *\class WorkUnitTimingCollector
+ * \brief Reference WorkUnitInstrumentation recording per-thread work unit statistics
+ *
+ * This collector accumulates, for every executing thread, the number of work
+ * units, the number of pixels and the wall time spent inside the work units.
+ * The per-thread records show how evenly the work of a filter is distributed
+ * over the threads and what pixel throughput each thread achieves. Hardware
+ * counter back-ends (perf_event, PAPI, likwid) can be plugged in the same
+ * way by implementing WorkUnitInstrumentation with their respective APIs.
+ *
+ * \sa MultiThreaderBase
+ * \ingroup ITKSystemObjects
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT WorkUnitTimingCollector : public WorkUnitInstrumentation
+{
+public:
+  /** Accumulated statistics of one executing thread */
+  struct ThreadRecord
+  {
+    SizeValueType WorkUnits{ 0 };
+    SizeValueType Pixels{ 0 };
+    double        Seconds{ 0.0 };
+  };
+
+  void
+  WorkUnitBegin(unsigned int dimension, const IndexValueType index[], const SizeValueType size[]) override;
+
+  void
+  WorkUnitEnd(unsigned int dimension, const IndexValueType index[], const SizeValueType size[]) override;
+
+  /** Get a copy of the per-thread records */
+  std::vector<ThreadRecord>
+  GetThreadRecords() const;
+
+  /** Discard the collected records */
+  void
+  Reset();
+
+  /** Print a human readable per-thread report */
+  void
+  Print(std::ostream & os) const;
+
+private:
+  using TimePointType = std::chrono::steady_clock::time_point;
+
+  struct ThreadState
+  {
+    ThreadRecord  Record;
+    TimePointType Start;
+  };
+
+  mutable std::mutex                     m_Mutex;
+  std::map<std::thread::id, ThreadState> m_Threads;
+};
+
+} // end namespace itk
+
+#endif
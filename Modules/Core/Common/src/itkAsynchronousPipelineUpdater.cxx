@@ -0,0 +1,167 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkAsynchronousPipelineUpdater.h"
+#include "itkThreadPool.h"
+
+#include <algorithm>
+#include <deque>
+
+namespace itk
+{
+
+std::set<ProcessObject *>
+AsynchronousPipelineUpdater::CollectUpstreamFilters(DataObject * output)
+{
+  std::set<ProcessObject *> filters;
+  if (output == nullptr)
+  {
+    return filters;
+  }
+
+  std::deque<ProcessObject *> pending;
+  if (ProcessObject * source = output->GetSource())
+  {
+    pending.push_back(source);
+  }
+  while (!pending.empty())
+  {
+    ProcessObject * filter = pending.front();
+    pending.pop_front();
+    if (!filters.insert(filter).second)
+    {
+      continue;
+    }
+    for (const DataObject::Pointer & input : filter->GetInputs())
+    {
+      if (input.IsNotNull())
+      {
+        if (ProcessObject * inputSource = input->GetSource())
+        {
+          pending.push_back(inputSource);
+        }
+      }
+    }
+  }
+  return filters;
+}
+
+void
+AsynchronousPipelineUpdater::UpdateInParallel(const std::vector<DataObject::Pointer> & outputs)
+{
+  // Group the outputs so that any two outputs sharing an upstream filter
+  // end up in the same group; only whole groups run concurrently.
+  struct Group
+  {
+    std::set<ProcessObject *>        Filters;
+    std::vector<DataObject::Pointer> Outputs;
+  };
+  std::vector<Group> groups;
+
+  for (const DataObject::Pointer & output : outputs)
+  {
+    if (output.IsNull())
+    {
+      continue;
+    }
+    std::set<ProcessObject *> filters = CollectUpstreamFilters(output);
+
+    // Merge every group this output's graph touches into one. An output can
+    // bridge several previously independent groups.
+    Group merged;
+    merged.Filters = std::move(filters);
+    merged.Outputs.push_back(output);
+    auto intersects = [&merged](const Group & group) {
+      for (ProcessObject * filter : group.Filters)
+      {
+        if (merged.Filters.count(filter) > 0)
+        {
+          return true;
+        }
+      }
+      return false;
+    };
+    for (auto groupIt = groups.begin(); groupIt != groups.end();)
+    {
+      if (intersects(*groupIt))
+      {
+        merged.Filters.insert(groupIt->Filters.begin(), groupIt->Filters.end());
+        merged.Outputs.insert(merged.Outputs.begin(), groupIt->Outputs.begin(), groupIt->Outputs.end());
+        groupIt = groups.erase(groupIt);
+      }
+      else
+      {
+        ++groupIt;
+      }
+    }
+    groups.push_back(std::move(merged));
+  }
+
+  if (groups.empty())
+  {
+    return;
+  }
+
+  // A single group has no exposed parallelism; update it on this thread.
+  if (groups.size() == 1)
+  {
+    for (const DataObject::Pointer & output : groups.front().Outputs)
+    {
+      output->Update();
+    }
+    return;
+  }
+
+  ThreadPool::Pointer threadPool = ThreadPool::GetInstance();
+
+  std::vector<std::future<void>> futures;
+  futures.reserve(groups.size());
+  for (Group & group : groups)
+  {
+    futures.push_back(threadPool->AddWork([outputsInGroup = std::move(group.Outputs)] {
+      for (const DataObject::Pointer & output : outputsInGroup)
+      {
+        output->Update();
+      }
+    }));
+  }
+
+  // Let every branch run to completion before rethrowing the first failure,
+  // so no task is left referencing a destroyed pipeline.
+  for (std::future<void> & future : futures)
+  {
+    future.wait();
+  }
+  for (std::future<void> & future : futures)
+  {
+    future.get();
+  }
+}
+
+std::future<void>
+AsynchronousPipelineUpdater::UpdateAsynchronously(DataObject * output)
+{
+  return ThreadPool::GetInstance()->AddWork([outputPointer = DataObject::Pointer(output)] {
+    if (outputPointer.IsNotNull())
+    {
+      outputPointer->Update();
+    }
+  });
+}
+
+} // end namespace itk
@@ -0,0 +1,122 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkBufferOperationAudit.h"
+
+#include <atomic>
+#include <mutex>
+
+namespace itk
+{
+
+namespace
+{
+std::atomic<bool> recordingFlag{ false };
+
+std::mutex &
+GetRecordMutex()
+{
+  static std::mutex recordMutex;
+  return recordMutex;
+}
+
+std::vector<BufferOperationAudit::Record> &
+GetRecordList()
+{
+  static std::vector<BufferOperationAudit::Record> recordList;
+  return recordList;
+}
+} // namespace
+
+void
+BufferOperationAudit::Start()
+{
+  const std::lock_guard<std::mutex> lockGuard(GetRecordMutex());
+  GetRecordList().clear();
+  recordingFlag = true;
+}
+
+void
+BufferOperationAudit::Stop()
+{
+  recordingFlag = false;
+}
+
+bool
+BufferOperationAudit::IsRecording()
+{
+  return recordingFlag;
+}
+
+std::vector<BufferOperationAudit::Record>
+BufferOperationAudit::GetRecords()
+{
+  const std::lock_guard<std::mutex> lockGuard(GetRecordMutex());
+  return GetRecordList();
+}
+
+std::vector<BufferOperationAudit::Record>
+BufferOperationAudit::GetAvoidableCopies()
+{
+  const std::vector<Record> records = GetRecords();
+
+  std::vector<Record> avoidable;
+  for (size_t i = 0; i < records.size(); ++i)
+  {
+    const Record & record = records[i];
+    if (record.Operation != OperationEnum::Copy || !record.FullBuffer)
+    {
+      continue;
+    }
+    // A full-buffer copy whose source is done with could have been a
+    // graft of the source's pixel container instead.
+    bool sourceReferencedLater = false;
+    for (size_t j = i + 1; j < records.size() && !sourceReferencedLater; ++j)
+    {
+      sourceReferencedLater = records[j].Source == record.Source || records[j].Destination == record.Source;
+    }
+    if (!sourceReferencedLater)
+    {
+      avoidable.push_back(record);
+    }
+  }
+  return avoidable;
+}
+
+void
+BufferOperationAudit::ReportAllocation(const void * destination, SizeValueType pixels)
+{
+  const std::lock_guard<std::mutex> lockGuard(GetRecordMutex());
+  GetRecordList().push_back(Record{ OperationEnum::Allocate, nullptr, destination, pixels, false });
+}
+
+void
+BufferOperationAudit::ReportCopy(const void * source, const void * destination, SizeValueType pixels, bool fullBuffer)
+{
+  const std::lock_guard<std::mutex> lockGuard(GetRecordMutex());
+  GetRecordList().push_back(Record{ OperationEnum::Copy, source, destination, pixels, fullBuffer });
+}
+
+void
+BufferOperationAudit::ReportGraft(const void * source, const void * destination)
+{
+  const std::lock_guard<std::mutex> lockGuard(GetRecordMutex());
+  GetRecordList().push_back(Record{ OperationEnum::Graft, source, destination, 0, false });
+}
+
+} // end namespace itk
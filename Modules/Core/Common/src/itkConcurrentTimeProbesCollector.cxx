@@ -0,0 +1,229 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkConcurrentTimeProbesCollector.h"
+#include "itkMacro.h"
+
+#include <cstring>
+#include <iomanip>
+
+namespace
+{
+// Identifies a binary probe dump; the trailing digit is the format version
+constexpr char binaryProbeMagic[8] = { 'I', 'T', 'K', 'C', 'T', 'P', 'C', '1' };
+
+template <typename T>
+void
+WriteRaw(std::ostream & os, const T & value)
+{
+  os.write(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+template <typename T>
+bool
+ReadRaw(std::istream & is, T & value)
+{
+  is.read(reinterpret_cast<char *>(&value), sizeof(value));
+  return !is.fail();
+}
+} // namespace
+
+namespace itk
+{
+
+ConcurrentTimeProbesCollector::ThreadData &
+ConcurrentTimeProbesCollector::GetThreadData()
+{
+  // std::map nodes are stable, so the reference stays valid while other
+  // threads register themselves
+  const std::lock_guard<std::mutex> lockGuard(m_Mutex);
+  return m_Threads[std::this_thread::get_id()];
+}
+
+void
+ConcurrentTimeProbesCollector::Start(const char * id)
+{
+  ThreadData & data = this->GetThreadData();
+
+  std::string path = data.Stack.empty() ? std::string(id) : data.Stack.back().Path + '/' + id;
+  data.Stack.push_back(OpenProbe{ std::move(path), ClockType::now() });
+}
+
+void
+ConcurrentTimeProbesCollector::Stop(const char * id)
+{
+  const ClockType::time_point stopTime = ClockType::now();
+
+  ThreadData & data = this->GetThreadData();
+  if (data.Stack.empty())
+  {
+    itkGenericExceptionMacro("The probe \"" << id << "\" has not been started");
+  }
+  const OpenProbe & open = data.Stack.back();
+  const std::string name = open.Path.substr(open.Path.rfind('/') + 1);
+  if (name != id)
+  {
+    itkGenericExceptionMacro("The probe \"" << id << "\" cannot be stopped while the nested probe \"" << name
+                                            << "\" is running");
+  }
+
+  const double seconds = std::chrono::duration<double>(stopTime - open.Start).count();
+
+  const std::lock_guard<std::mutex> lockGuard(m_Mutex);
+  Aggregate &                       aggregate = data.Records[open.Path];
+  if (aggregate.Count == 0 || seconds < aggregate.MinSeconds)
+  {
+    aggregate.MinSeconds = seconds;
+  }
+  if (aggregate.Count == 0 || seconds > aggregate.MaxSeconds)
+  {
+    aggregate.MaxSeconds = seconds;
+  }
+  ++aggregate.Count;
+  aggregate.TotalSeconds += seconds;
+  data.Stack.pop_back();
+}
+
+std::vector<ConcurrentTimeProbesCollector::ProbeRecord>
+ConcurrentTimeProbesCollector::GetProbeRecords() const
+{
+  const std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+  std::map<std::string, Aggregate> combined = m_Merged;
+  for (const auto & thread : m_Threads)
+  {
+    for (const auto & record : thread.second.Records)
+    {
+      Aggregate & aggregate = combined[record.first];
+      if (aggregate.Count == 0 || record.second.MinSeconds < aggregate.MinSeconds)
+      {
+        aggregate.MinSeconds = record.second.MinSeconds;
+      }
+      if (aggregate.Count == 0 || record.second.MaxSeconds > aggregate.MaxSeconds)
+      {
+        aggregate.MaxSeconds = record.second.MaxSeconds;
+      }
+      aggregate.Count += record.second.Count;
+      aggregate.TotalSeconds += record.second.TotalSeconds;
+    }
+  }
+
+  std::vector<ProbeRecord> records;
+  records.reserve(combined.size());
+  for (const auto & record : combined)
+  {
+    records.push_back(ProbeRecord{
+      record.first, record.second.Count, record.second.TotalSeconds, record.second.MinSeconds, record.second.MaxSeconds });
+  }
+  return records;
+}
+
+void
+ConcurrentTimeProbesCollector::Report(std::ostream & os) const
+{
+  const std::vector<ProbeRecord> records = this->GetProbeRecords();
+
+  os << std::left << std::setw(40) << "Probe" << std::right << std::setw(10) << "Count" << std::setw(14) << "Total(s)"
+     << std::setw(14) << "Mean(s)" << std::setw(14) << "Min(s)" << std::setw(14) << "Max(s)" << std::endl;
+  for (const ProbeRecord & record : records)
+  {
+    os << std::left << std::setw(40) << record.Path << std::right << std::setw(10) << record.Count << std::setw(14)
+       << record.TotalSeconds << std::setw(14) << record.TotalSeconds / static_cast<double>(record.Count)
+       << std::setw(14) << record.MinSeconds << std::setw(14) << record.MaxSeconds << std::endl;
+  }
+}
+
+void
+ConcurrentTimeProbesCollector::DumpBinary(std::ostream & os) const
+{
+  const std::vector<ProbeRecord> records = this->GetProbeRecords();
+
+  os.write(binaryProbeMagic, sizeof(binaryProbeMagic));
+  WriteRaw(os, static_cast<uint64_t>(records.size()));
+  for (const ProbeRecord & record : records)
+  {
+    WriteRaw(os, static_cast<uint32_t>(record.Path.size()));
+    os.write(record.Path.data(), static_cast<std::streamsize>(record.Path.size()));
+    WriteRaw(os, static_cast<uint64_t>(record.Count));
+    WriteRaw(os, record.TotalSeconds);
+    WriteRaw(os, record.MinSeconds);
+    WriteRaw(os, record.MaxSeconds);
+  }
+}
+
+void
+ConcurrentTimeProbesCollector::MergeBinary(std::istream & is)
+{
+  char magic[sizeof(binaryProbeMagic)];
+  is.read(magic, sizeof(magic));
+  if (is.fail() || std::memcmp(magic, binaryProbeMagic, sizeof(magic)) != 0)
+  {
+    itkGenericExceptionMacro("The stream does not hold a binary probe dump");
+  }
+  uint64_t recordCount = 0;
+  if (!ReadRaw(is, recordCount))
+  {
+    itkGenericExceptionMacro("The binary probe dump is truncated");
+  }
+
+  const std::lock_guard<std::mutex> lockGuard(m_Mutex);
+  for (uint64_t i = 0; i < recordCount; ++i)
+  {
+    uint32_t pathLength = 0;
+    if (!ReadRaw(is, pathLength))
+    {
+      itkGenericExceptionMacro("The binary probe dump is truncated");
+    }
+    std::string path(pathLength, '\0');
+    is.read(&path[0], pathLength);
+    uint64_t count = 0;
+    double   totalSeconds = 0.0;
+    double   minSeconds = 0.0;
+    double   maxSeconds = 0.0;
+    if (is.fail() || !ReadRaw(is, count) || !ReadRaw(is, totalSeconds) || !ReadRaw(is, minSeconds) ||
+        !ReadRaw(is, maxSeconds))
+    {
+      itkGenericExceptionMacro("The binary probe dump is truncated");
+    }
+
+    Aggregate & aggregate = m_Merged[path];
+    if (aggregate.Count == 0 || minSeconds < aggregate.MinSeconds)
+    {
+      aggregate.MinSeconds = minSeconds;
+    }
+    if (aggregate.Count == 0 || maxSeconds > aggregate.MaxSeconds)
+    {
+      aggregate.MaxSeconds = maxSeconds;
+    }
+    aggregate.Count += static_cast<SizeValueType>(count);
+    aggregate.TotalSeconds += totalSeconds;
+  }
+}
+
+void
+ConcurrentTimeProbesCollector::Clear()
+{
+  const std::lock_guard<std::mutex> lockGuard(m_Mutex);
+  for (auto & thread : m_Threads)
+  {
+    thread.second.Records.clear();
+  }
+  m_Merged.clear();
+}
+
+} // end namespace itk
@@ -27,6 +27,7 @@
  *=========================================================================*/
 #include "itkProcessObject.h"
 #include "itkSingleton.h"
+#include <algorithm>
 
 namespace itk
 {
@@ -163,6 +164,38 @@ DataObject::GetGlobalReleaseDataFlag()
   return *DataObject::GetGlobalReleaseDataFlagPointer();
 }
 
+//----------------------------------------------------------------------------
+void
+DataObject::Modified() const
+{
+  Superclass::Modified();
+  // Unconditional so that the consumers' dirty flags stay accurate when
+  // incremental pipeline invalidation is enabled later on; invalidation
+  // stops at filters that are already marked.
+  for (ProcessObject * consumer : m_Consumers)
+  {
+    consumer->InvalidatePipeline();
+  }
+}
+
+//----------------------------------------------------------------------------
+void
+DataObject::AddConsumer(ProcessObject * consumer)
+{
+  m_Consumers.push_back(consumer);
+}
+
+//----------------------------------------------------------------------------
+void
+DataObject::RemoveConsumer(ProcessObject * consumer)
+{
+  auto it = std::find(m_Consumers.begin(), m_Consumers.end(), consumer);
+  if (it != m_Consumers.end())
+  {
+    m_Consumers.erase(it);
+  }
+}
+
 //----------------------------------------------------------------------------
 void
 DataObject::ReleaseData()
@@ -0,0 +1,116 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkImageRegionSplitterCacheAligned.h"
+
+
+namespace itk
+{
+
+ImageRegionSplitterCacheAligned::ImageRegionSplitterCacheAligned()
+  : m_AlignmentInElements(16)
+{}
+
+SizeValueType
+ImageRegionSplitterCacheAligned::ComputeValuesPerPiece(unsigned int  splitAxis,
+                                                       SizeValueType range,
+                                                       unsigned int  requestedNumber) const
+{
+  auto valuesPerPiece = Math::Ceil<SizeValueType>(static_cast<double>(range) / requestedNumber);
+  if (splitAxis == 0)
+  {
+    // splitting the contiguous axis: snap the piece length up to the
+    // alignment so piece boundaries do not share cache lines
+    const SizeValueType alignment = m_AlignmentInElements;
+    valuesPerPiece = ((valuesPerPiece + alignment - 1) / alignment) * alignment;
+  }
+  return valuesPerPiece;
+}
+
+unsigned int
+ImageRegionSplitterCacheAligned::GetNumberOfSplitsInternal(unsigned int         dim,
+                                                           const IndexValueType itkNotUsed(regionIndex)[],
+                                                           const SizeValueType  regionSize[],
+                                                           unsigned int         requestedNumber) const
+{
+  requestedNumber = std::max(1u, requestedNumber);
+  // split on the outermost dimension available
+  int splitAxis = dim - 1;
+  while (regionSize[splitAxis] <= 1)
+  {
+    --splitAxis;
+    if (splitAxis < 0)
+    { // cannot split
+      itkDebugMacro("  Cannot Split");
+      return 1;
+    }
+  }
+
+  const SizeValueType range = regionSize[splitAxis];
+  const SizeValueType valuesPerPiece = this->ComputeValuesPerPiece(splitAxis, range, requestedNumber);
+
+  return Math::Ceil<unsigned int>(static_cast<double>(range) / valuesPerPiece);
+}
+
+unsigned int
+ImageRegionSplitterCacheAligned::GetSplitInternal(unsigned int   dim,
+                                                  unsigned int   i,
+                                                  unsigned int   numberOfPieces,
+                                                  IndexValueType regionIndex[],
+                                                  SizeValueType  regionSize[]) const
+{
+  // split on the outermost dimension available
+  unsigned int splitAxis = dim - 1;
+  while (regionSize[splitAxis] <= 1)
+  {
+    if (splitAxis == 0)
+    { // cannot split
+      itkDebugMacro("  Cannot Split");
+      return 1;
+    }
+    --splitAxis;
+  }
+
+  const SizeValueType range = regionSize[splitAxis];
+  const SizeValueType valuesPerPiece = this->ComputeValuesPerPiece(splitAxis, range, numberOfPieces);
+  const unsigned int  maxPieceIdUsed = Math::Ceil<unsigned int>(static_cast<double>(range) / valuesPerPiece) - 1;
+
+  // Split the region
+  if (i < maxPieceIdUsed)
+  {
+    regionIndex[splitAxis] += i * valuesPerPiece;
+    regionSize[splitAxis] = valuesPerPiece;
+  }
+  if (i == maxPieceIdUsed)
+  {
+    regionIndex[splitAxis] += i * valuesPerPiece;
+    // last piece needs to process the "rest" dimension being split
+    regionSize[splitAxis] = regionSize[splitAxis] - i * valuesPerPiece;
+  }
+
+  return maxPieceIdUsed + 1;
+}
+
+void
+ImageRegionSplitterCacheAligned::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+  os << indent << "AlignmentInElements: " << m_AlignmentInElements << std::endl;
+}
+
+} // namespace itk
@@ -0,0 +1,170 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkImageRegionSplitterTile.h"
+#include "itkMath.h"
+
+#include <vector>
+
+namespace itk
+{
+
+ImageRegionSplitterTile::ImageRegionSplitterTile() = default;
+
+void
+ImageRegionSplitterTile::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+  os << indent << "OverlapRadius: " << m_OverlapRadius << std::endl;
+}
+
+unsigned int
+ImageRegionSplitterTile::GetNumberOfSplitsInternal(unsigned int         dim,
+                                                   const IndexValueType regionIndex[],
+                                                   const SizeValueType  regionSize[],
+                                                   unsigned int         requestedNumber) const
+{
+  std::vector<unsigned int> splits(dim);
+
+  return this->ComputeSplits(dim, requestedNumber, regionIndex, regionSize, &splits[0]);
+}
+
+unsigned int
+ImageRegionSplitterTile::GetSplitInternal(unsigned int   dim,
+                                          unsigned int   splitI,
+                                          unsigned int   numberOfPieces,
+                                          IndexValueType regionIndex[],
+                                          SizeValueType  regionSize[]) const
+{
+  std::vector<unsigned int> splits(dim);
+  std::vector<unsigned int> splitRegionIndex(dim);
+
+  numberOfPieces = this->ComputeSplits(dim, numberOfPieces, regionIndex, regionSize, &splits[0]);
+
+  // Determine which tile this piece is.
+  unsigned int offset = splitI;
+  for (unsigned int i = dim - 1; i > 0; --i)
+  {
+    unsigned int dimensionOffset = 1;
+    for (unsigned int j = 0; j < i; ++j)
+    {
+      dimensionOffset *= splits[j];
+    }
+
+    splitRegionIndex[i] = offset / dimensionOffset;
+    offset -= (splitRegionIndex[i] * dimensionOffset);
+  }
+  splitRegionIndex[0] = offset;
+
+  // Assign the output split region to the input region in-place.
+  for (unsigned int i = 0; i < dim; ++i)
+  {
+    const SizeValueType inputRegionSize = regionSize[i];
+    const auto          indexOffset =
+      Math::Floor<IndexValueType>((splitRegionIndex[i]) * (inputRegionSize / double(splits[i])));
+
+    regionIndex[i] += indexOffset;
+    if (splitRegionIndex[i] < splits[i] - 1)
+    {
+      regionSize[i] =
+        Math::Floor<SizeValueType>((splitRegionIndex[i] + 1) * (inputRegionSize / double(splits[i]))) - indexOffset;
+    }
+    else
+    {
+      // this dimension is falling off the edge of the image
+      regionSize[i] = regionSize[i] - indexOffset;
+    }
+  }
+
+  return numberOfPieces;
+}
+
+unsigned int
+ImageRegionSplitterTile::ComputeSplits(unsigned int         dim,
+                                       unsigned int         requestedNumber,
+                                       const IndexValueType itkNotUsed(regionIndex)[],
+                                       const SizeValueType  regionSize[],
+                                       unsigned int         splits[]) const
+{
+  unsigned int numberOfPieces = 1;
+
+  // A dimension is never cut into pieces thinner than the two-sided halo,
+  // otherwise the halo recomputation would dominate the division.
+  const SizeValueType minimumThickness = 2 * m_OverlapRadius + 1;
+
+  for (unsigned int i = 0; i < dim; ++i)
+  {
+    splits[i] = 1;
+  }
+
+  while (true)
+  {
+    // Each additional cut in dimension d makes the upstream pipeline
+    // recompute a halo proportional to the cut plane area, i.e. the product
+    // of the other dimensions' extents. Choose the dimension whose cut is
+    // cheapest, which is the one with the smallest plane area (for roughly
+    // isotropic halos this is the dimension with the largest extent).
+    int    splitDim = -1;
+    double smallestPlaneArea = 0.0;
+    for (unsigned int i = 0; i < dim; ++i)
+    {
+      if ((regionSize[i] / SizeValueType(splits[i] + 1)) < minimumThickness)
+      {
+        continue;
+      }
+      double planeArea = 1.0;
+      for (unsigned int j = 0; j < dim; ++j)
+      {
+        if (j != i)
+        {
+          planeArea *= static_cast<double>(regionSize[j]);
+        }
+      }
+      if (splitDim < 0 || planeArea < smallestPlaneArea)
+      {
+        splitDim = static_cast<int>(i);
+        smallestPlaneArea = planeArea;
+      }
+    }
+    if (splitDim < 0)
+    {
+      // every dimension is at its minimum thickness
+      return numberOfPieces;
+    }
+
+    // calculate the number of additional pieces this split would add
+    unsigned int additionalNumPieces = 1;
+    for (unsigned int i = 0; i < dim; ++i)
+    {
+      if (i != static_cast<unsigned int>(splitDim))
+      {
+        additionalNumPieces *= splits[i];
+      }
+    }
+
+    if (numberOfPieces + additionalNumPieces > requestedNumber)
+    {
+      return numberOfPieces;
+    }
+
+    numberOfPieces += additionalNumPieces;
+    ++splits[splitDim];
+  }
+}
+
+} // end namespace itk
@@ -0,0 +1,127 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkInPlacePipelinePlanner.h"
+#include "itkAsynchronousPipelineUpdater.h"
+
+#include <map>
+#include <set>
+
+namespace itk
+{
+
+namespace
+{
+// The input an in-place filter overwrites is its primary input. GetInputs
+// and GetInputNames produce matching, name-ordered sequences, so the
+// primary input can be located without access to the protected indexed
+// interface.
+DataObject *
+GetPrimaryInputOf(ProcessObject * filter)
+{
+  const ProcessObject::NameArray              names = filter->GetInputNames();
+  const ProcessObject::DataObjectPointerArray inputs = filter->GetInputs();
+  for (size_t i = 0; i < names.size() && i < inputs.size(); ++i)
+  {
+    if (names[i] == "Primary")
+    {
+      return inputs[i];
+    }
+  }
+  return nullptr;
+}
+} // namespace
+
+InPlacePipelinePlanner::PlanReport
+InPlacePipelinePlanner::Plan(const std::vector<DataObject::Pointer> & requestedOutputs)
+{
+  PlanReport report;
+
+  std::set<DataObject *>    requested;
+  std::set<ProcessObject *> filters;
+  for (const DataObject::Pointer & output : requestedOutputs)
+  {
+    if (output.IsNotNull())
+    {
+      requested.insert(output);
+      const std::set<ProcessObject *> upstream = AsynchronousPipelineUpdater::CollectUpstreamFilters(output);
+      filters.insert(upstream.begin(), upstream.end());
+    }
+  }
+
+  // Number of consumers of each data object within the analyzed graph.
+  std::map<DataObject *, unsigned int> consumerCount;
+  for (ProcessObject * filter : filters)
+  {
+    for (const DataObject::Pointer & input : filter->GetInputs())
+    {
+      if (input.IsNotNull())
+      {
+        ++consumerCount[input];
+      }
+    }
+  }
+
+  for (ProcessObject * filter : filters)
+  {
+    ++report.NumberOfFilters;
+
+    // Intermediate outputs with exactly one consumer can be released the
+    // moment that consumer has run. Requested outputs stay alive, and
+    // multiply-consumed outputs must not be released after the first
+    // consumer or the producer would re-execute for the second.
+    for (const DataObject::Pointer & output : filter->GetOutputs())
+    {
+      if (output.IsNotNull() && requested.count(output) == 0 && consumerCount[output] == 1 &&
+          !output->GetReleaseDataFlag())
+      {
+        output->ReleaseDataFlagOn();
+        ++report.NumberOfIntermediatesMarkedForRelease;
+      }
+    }
+
+    if (!filter->CanRunInPlace())
+    {
+      continue;
+    }
+    ++report.NumberOfInPlaceCapableFilters;
+
+    // In-place execution steals the primary input's buffer. That is only
+    // free when the buffer is produced inside the graph — never an
+    // externally provided source image — is consumed by this filter
+    // alone, and is not itself a requested output.
+    DataObject * primaryInput = GetPrimaryInputOf(filter);
+    const bool   reusable = primaryInput != nullptr && primaryInput->GetSource().IsNotNull() &&
+                          requested.count(primaryInput) == 0 && consumerCount[primaryInput] == 1;
+    filter->SetInPlace(reusable);
+    if (reusable)
+    {
+      ++report.NumberOfFiltersPlannedInPlace;
+    }
+  }
+
+  return report;
+}
+
+InPlacePipelinePlanner::PlanReport
+InPlacePipelinePlanner::Plan(DataObject * requestedOutput)
+{
+  return Plan(std::vector<DataObject::Pointer>(1, DataObject::Pointer(requestedOutput)));
+}
+
+} // end namespace itk
@@ -30,6 +30,7 @@
 
 #if defined(ITK_USE_POOL_MULTI_THREADER)
 #  include "itkPoolMultiThreader.h"
+#  include "itkWorkStealingMultiThreader.h"
 #endif
 #include "itkNumericTraits.h"
 #include <mutex>
@@ -39,10 +40,12 @@
 #include "itkImageSourceCommon.h"
 #include "itkSingleton.h"
 #include "itkProcessObject.h"
+#include <atomic>
 #include <iostream>
 #include <string>
 #include <algorithm>
 #include <cctype>
+#include <cstdint>
 
 #if defined(ITK_USE_TBB)
 #  include "itkTBBMultiThreader.h"
@@ -188,6 +191,10 @@ MultiThreaderBase::ThreaderTypeFromString(std::string threaderString)
   {
     return ThreaderEnum::TBB;
   }
+  else if (threaderString == "WORKSTEALING")
+  {
+    return ThreaderEnum::WorkStealing;
+  }
   else
   {
     return ThreaderEnum::Unknown;
@@ -269,6 +276,80 @@ MultiThreaderBase::SetUpdateProgress(bool updates)
   this->m_UpdateProgress = updates;
 }
 
+namespace
+{
+// Cache-line aligned scratch buffer owned by a single thread. The
+// allocation grows geometrically and is only released when the owning
+// thread exits.
+class WorkUnitScratchBuffer
+{
+public:
+  void *
+  Get(SizeValueType numberOfBytes)
+  {
+    if (numberOfBytes > m_Capacity)
+    {
+      const SizeValueType newCapacity = std::max(numberOfBytes, 2 * m_Capacity);
+      ::operator delete(m_Allocation);
+      // Keep the state consistent in case the allocation below throws.
+      m_Allocation = nullptr;
+      m_Buffer = nullptr;
+      m_Capacity = 0;
+      m_Allocation = ::operator new(newCapacity + ITK_CACHE_LINE_ALIGNMENT);
+      const auto address = reinterpret_cast<uintptr_t>(m_Allocation);
+      constexpr uintptr_t alignment = ITK_CACHE_LINE_ALIGNMENT;
+      m_Buffer = reinterpret_cast<void *>((address + alignment - 1) & ~(alignment - 1));
+      m_Capacity = newCapacity;
+    }
+    return m_Buffer;
+  }
+
+  ~WorkUnitScratchBuffer() { ::operator delete(m_Allocation); }
+
+private:
+  void *        m_Allocation{ nullptr };
+  void *        m_Buffer{ nullptr };
+  SizeValueType m_Capacity{ 0 };
+};
+} // namespace
+
+void *
+MultiThreaderBase::GetWorkUnitScratch(SizeValueType numberOfBytes)
+{
+  static thread_local WorkUnitScratchBuffer workUnitScratch;
+  return workUnitScratch.Get(numberOfBytes);
+}
+
+namespace
+{
+std::atomic<WorkUnitInstrumentation *> globalWorkUnitInstrumentation{ nullptr };
+std::atomic<bool>                      globalDeterministicReductions{ false };
+} // namespace
+
+void
+MultiThreaderBase::SetGlobalWorkUnitInstrumentation(WorkUnitInstrumentation * instrumentation)
+{
+  globalWorkUnitInstrumentation.store(instrumentation, std::memory_order_release);
+}
+
+WorkUnitInstrumentation *
+MultiThreaderBase::GetGlobalWorkUnitInstrumentation()
+{
+  return globalWorkUnitInstrumentation.load(std::memory_order_acquire);
+}
+
+void
+MultiThreaderBase::SetGlobalDeterministicReductions(bool deterministic)
+{
+  globalDeterministicReductions.store(deterministic, std::memory_order_release);
+}
+
+bool
+MultiThreaderBase::GetGlobalDeterministicReductions()
+{
+  return globalDeterministicReductions.load(std::memory_order_acquire);
+}
+
 ThreadIdType
 MultiThreaderBase::GetGlobalDefaultNumberOfThreads()
 {
@@ -406,6 +487,12 @@ MultiThreaderBase::New()
         return TBBMultiThreader::New();
 #else
         itkGenericExceptionMacro("ITK has been built without TBB support!");
+#endif
+      case ThreaderEnum::WorkStealing:
+#if defined(ITK_USE_POOL_MULTI_THREADER)
+        return WorkStealingMultiThreader::New();
+#else
+        itkGenericExceptionMacro("ITK has been built without WorkStealingMultiThreader support!");
 #endif
       default:
         itkGenericExceptionMacro("MultiThreaderBase::GetGlobalDefaultThreader returned Unknown!");
@@ -420,6 +507,12 @@ MultiThreaderBase::MultiThreaderBase()
 {
   m_MaximumNumberOfThreads = MultiThreaderBase::GetGlobalDefaultNumberOfThreads();
   m_NumberOfWorkUnits = m_MaximumNumberOfThreads;
+  if (GetGlobalDeterministicReductions())
+  {
+    // A thread-count independent work unit count keeps the region splits,
+    // and with them the shape of per-work-unit reductions, reproducible
+    this->SetNumberOfWorkUnits(DeterministicNumberOfWorkUnits);
+  }
 }
 
 MultiThreaderBase::~MultiThreaderBase() = default;
@@ -605,6 +698,8 @@ operator<<(std::ostream & out, const MultiThreaderBaseEnums::Threader value)
         return "itk::MultiThreaderBaseEnums::Threader::Pool";
       case MultiThreaderBaseEnums::Threader::TBB:
         return "itk::MultiThreaderBaseEnums::Threader::TBB";
+      case MultiThreaderBaseEnums::Threader::WorkStealing:
+        return "itk::MultiThreaderBaseEnums::Threader::WorkStealing";
         //      TODO    case MultiThreaderBaseEnums::Threader::Last:
         //                    return "itk::MultiThreaderBaseEnums::Threader::Last";
       case MultiThreaderBaseEnums::Threader::Unknown:
@@ -27,6 +27,8 @@
  *=========================================================================*/
 #include "itkCommand.h"
 #include <algorithm>
+#include <typeindex>
+#include <unordered_map>
 
 #include "itkSingleton.h"
 
@@ -93,6 +95,16 @@ public:
 
   bool m_ListModified{ false };
 
+  // Whether any registered observer matches the given event type. The
+  // result is cached per dynamic event type, so repeatedly invoking an
+  // event nobody observes costs a single hash lookup instead of a list
+  // traversal with a virtual CheckEvent call per observer. CheckEvent
+  // matches on the event type (same class or subclass), so the match
+  // result only depends on the dynamic type of the invoked event and on
+  // the observer list; the cache is discarded whenever the list changes.
+  bool
+  HasMatchingObserver(const EventObject & event) const;
+
 protected:
   // RAII of ListModified state to ensure exception safety
   struct SaveRestoreListModified
@@ -117,8 +129,9 @@ protected:
   InvokeEventRecursion(const EventObject & event, TObject * self, std::list<Observer *>::reverse_iterator & i);
 
 private:
-  std::list<Observer *> m_Observers;
-  unsigned long         m_Count;
+  std::list<Observer *>                             m_Observers;
+  mutable std::unordered_map<std::type_index, bool> m_EventMatchCache;
+  unsigned long                                     m_Count;
 };
 
 SubjectImplementation::~SubjectImplementation()
@@ -135,6 +148,7 @@ SubjectImplementation::AddObserver(const EventObject & event, Command * cmd)
   auto * ptr = new Observer(cmd, event.MakeObject(), m_Count);
 
   m_Observers.push_back(ptr);
+  m_EventMatchCache.clear();
   m_Count++;
   return ptr->m_Tag;
 }
@@ -146,6 +160,7 @@ SubjectImplementation::AddObserver(const EventObject & event, Command * cmd) con
   auto * me = const_cast<SubjectImplementation *>(this);
 
   me->m_Observers.push_back(ptr);
+  me->m_EventMatchCache.clear();
   me->m_Count++;
   return ptr->m_Tag;
 }
@@ -159,6 +174,7 @@ SubjectImplementation::RemoveObserver(unsigned long tag)
     {
       delete (*i);
       m_Observers.erase(i);
+      m_EventMatchCache.clear();
       m_ListModified = true;
       return;
     }
@@ -173,6 +189,7 @@ SubjectImplementation::RemoveAllObservers()
     delete observer;
   }
   m_Observers.clear();
+  m_EventMatchCache.clear();
   m_ListModified = true;
 }
 
@@ -185,6 +202,11 @@ SubjectImplementation::InvokeEvent(const EventObject & event, Object * self)
   // m_ListModified flag. The modified flag is save to the stack and
   // marked false before recursively saving the current list.
 
+  if (!this->HasMatchingObserver(event))
+  {
+    return;
+  }
+
   SaveRestoreListModified save(this);
 
   auto i = m_Observers.rbegin();
@@ -194,6 +216,11 @@ SubjectImplementation::InvokeEvent(const EventObject & event, Object * self)
 void
 SubjectImplementation::InvokeEvent(const EventObject & event, const Object * self)
 {
+  if (!this->HasMatchingObserver(event))
+  {
+    return;
+  }
+
   SaveRestoreListModified save(this);
 
   auto i = m_Observers.rbegin();
@@ -255,15 +282,32 @@ SubjectImplementation::GetCommand(unsigned long tag)
 bool
 SubjectImplementation::HasObserver(const EventObject & event) const
 {
+  return this->HasMatchingObserver(event);
+}
+
+bool
+SubjectImplementation::HasMatchingObserver(const EventObject & event) const
+{
+  const std::type_index eventType(typeid(event));
+
+  const auto cached = m_EventMatchCache.find(eventType);
+  if (cached != m_EventMatchCache.end())
+  {
+    return cached->second;
+  }
+
+  bool anyMatch = false;
   for (auto observer : m_Observers)
   {
     const EventObject * e = observer->m_Event;
     if (e->CheckEvent(&event))
     {
-      return true;
+      anyMatch = true;
+      break;
     }
   }
-  return false;
+  m_EventMatchCache[eventType] = anyMatch;
+  return anyMatch;
 }
 
 bool
@@ -35,12 +35,24 @@
 #include "itkVersion.h"
 #include <cstring>
 #include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <vector>
 
 namespace
 {
 
 using FactoryListType = std::list<::itk::ObjectFactoryBase *>;
 
+// One built-in factory recorded for lazy registration
+struct DeferredFactoryRegistration
+{
+  std::string                                           m_Name;
+  ::itk::ObjectFactoryBase::FactoryRegistrationFunction m_RegistrationFunction;
+};
+
 // Convenience function to synchronize lists and register the new factory,
 // either with `RegisterFactoryInternal()` or with `RegisterFactory()`. Avoid
 // duplicating factories that have already been registered and only add
@@ -121,6 +133,11 @@ struct ObjectFactoryBasePrivate
   std::list<::itk::ObjectFactoryBase *> * m_InternalFactories{ nullptr };
   bool                                    m_Initialized{ false };
   bool                                    m_StrictVersionChecking{ false };
+
+  std::list<DeferredFactoryRegistration>                                      m_DeferredFactories;
+  std::map<std::string, ::itk::ObjectFactoryBase::FactoryRegistrationRecord>  m_RegistrationAudit;
+  bool                                                                        m_Materializing{ false };
+  std::recursive_mutex                                                        m_DeferredMutex;
 };
 
 ObjectFactoryBasePrivate *
@@ -197,6 +214,7 @@ LightObject::Pointer
 ObjectFactoryBase::CreateInstance(const char * itkclassname)
 {
   ObjectFactoryBase::Initialize();
+  ObjectFactoryBase::MaterializeDeferredFactories();
 
   for (auto & registeredFactory : *m_PimplGlobals->m_RegisteredFactories)
   {
@@ -214,6 +232,7 @@ std::list<LightObject::Pointer>
 ObjectFactoryBase::CreateAllInstance(const char * itkclassname)
 {
   ObjectFactoryBase::Initialize();
+  ObjectFactoryBase::MaterializeDeferredFactories();
 
   std::list<LightObject::Pointer> created;
   for (auto & registeredFactory : *m_PimplGlobals->m_RegisteredFactories)
@@ -506,6 +525,133 @@ ObjectFactoryBase::ReHash()
   ObjectFactoryBase::Initialize();
 }
 
+/**
+ * Persist the resolved factory registration to a snapshot file
+ */
+bool
+ObjectFactoryBase::ExportFactorySnapshot(const std::string & fileName)
+{
+  ObjectFactoryBase::Initialize();
+
+  std::ofstream snapshot(fileName.c_str());
+  if (!snapshot)
+  {
+    return false;
+  }
+
+  snapshot << "ITKFactorySnapshot 1\n";
+  snapshot << Version::GetITKSourceVersion() << "\n";
+  for (auto & registeredFactory : *m_PimplGlobals->m_RegisteredFactories)
+  {
+    // Only dynamically loaded factories need to be persisted; internal
+    // factories re-register through static initialization in every
+    // process.
+    if (registeredFactory->m_LibraryHandle != nullptr)
+    {
+      snapshot << registeredFactory->m_LibraryPath << "\n";
+    }
+  }
+  return snapshot.good();
+}
+
+/**
+ * Rehydrate the factory registration from a snapshot, skipping the
+ * ITK_AUTOLOAD_PATH directory scan
+ */
+bool
+ObjectFactoryBase::RestoreFactorySnapshot(const std::string & fileName)
+{
+  itkInitGlobalsMacro(PimplGlobals);
+
+  if (m_PimplGlobals->m_Initialized && m_PimplGlobals->m_RegisteredFactories)
+  {
+    // the dynamic scan has already been paid for; nothing left to skip
+    return false;
+  }
+
+  std::ifstream snapshot(fileName.c_str());
+  if (!snapshot)
+  {
+    return false;
+  }
+
+  std::string  header;
+  unsigned int formatVersion = 0;
+  snapshot >> header >> formatVersion >> std::ws;
+  std::string itkVersion;
+  std::getline(snapshot, itkVersion);
+  if (header != "ITKFactorySnapshot" || formatVersion != 1 || itkVersion != Version::GetITKSourceVersion())
+  {
+    // a snapshot from another ITK version is stale; fall back on the
+    // normal directory scan
+    return false;
+  }
+
+  std::vector<std::string> libraryPaths;
+  std::string              line;
+  while (std::getline(snapshot, line))
+  {
+    if (!line.empty())
+    {
+      libraryPaths.push_back(line);
+    }
+  }
+
+#ifndef ITK_DYNAMIC_LOADING
+  if (!libraryPaths.empty())
+  {
+    return false;
+  }
+#else
+  // Resolve every snapshot library before registering any of them, so a
+  // stale snapshot leaves the factory state untouched.
+  std::vector<LibHandle>         libraryHandles;
+  std::vector<ITK_LOAD_FUNCTION> loadFunctions;
+  for (const std::string & libraryPath : libraryPaths)
+  {
+    LibHandle lib = DynamicLoader::OpenLibrary(libraryPath.c_str());
+    auto loadfunction = lib ? (ITK_LOAD_FUNCTION)DynamicLoader::GetSymbolAddress(lib, "itkLoad") : nullptr;
+    if (!loadfunction)
+    {
+      if (lib)
+      {
+        DynamicLoader::CloseLibrary(lib);
+      }
+      for (auto & libraryHandle : libraryHandles)
+      {
+        DynamicLoader::CloseLibrary(libraryHandle);
+      }
+      return false;
+    }
+    libraryHandles.push_back(lib);
+    loadFunctions.push_back(loadfunction);
+  }
+#endif
+
+  // Adopt the snapshot: register the compiled-in factories, then the
+  // snapshot libraries, and mark initialization complete so the
+  // ITK_AUTOLOAD_PATH directory scan is skipped.
+  m_PimplGlobals->m_Initialized = true;
+  ObjectFactoryBase::InitializeFactoryList();
+  ObjectFactoryBase::RegisterInternal();
+
+#ifdef ITK_DYNAMIC_LOADING
+  for (size_t i = 0; i < libraryHandles.size(); ++i)
+  {
+    ObjectFactoryBase * newfactory = (*loadFunctions[i])();
+    newfactory->m_LibraryHandle = (void *)libraryHandles[i];
+    newfactory->m_LibraryPath = libraryPaths[i];
+    newfactory->m_LibraryDate = 0; // unused for now...
+    if (!ObjectFactoryBase::RegisterFactory(newfactory))
+    {
+      DynamicLoader::CloseLibrary(libraryHandles[i]);
+    }
+  }
+#endif
+
+  return true;
+}
+
 /**
  * initialize class members
  */
@@ -553,6 +699,106 @@ ObjectFactoryBase::RegisterFactoryInternal(ObjectFactoryBase * factory)
   }
 }
 
+/**
+ * Record a built-in factory for lazy registration.
+ */
+void
+ObjectFactoryBase::DeferFactoryRegistration(const char * name, FactoryRegistrationFunction registrationFunction)
+{
+  itkInitGlobalsMacro(PimplGlobals);
+
+  const std::lock_guard<std::recursive_mutex> lockGuard(m_PimplGlobals->m_DeferredMutex);
+
+  // The register manager instances of every translation unit record the
+  // same factories; keep one descriptor per name
+  FactoryRegistrationRecord & record = m_PimplGlobals->m_RegistrationAudit[name];
+  if (!record.Deferred && !record.Materialized)
+  {
+    record.Name = name;
+    record.Deferred = true;
+    m_PimplGlobals->m_DeferredFactories.push_back(DeferredFactoryRegistration{ name, registrationFunction });
+  }
+}
+
+/**
+ * Run the pending deferred registration functions.
+ */
+void
+ObjectFactoryBase::MaterializeDeferredFactories()
+{
+  itkInitGlobalsMacro(PimplGlobals);
+
+  const std::lock_guard<std::recursive_mutex> lockGuard(m_PimplGlobals->m_DeferredMutex);
+
+  while (!m_PimplGlobals->m_DeferredFactories.empty())
+  {
+    const DeferredFactoryRegistration deferred = m_PimplGlobals->m_DeferredFactories.front();
+    m_PimplGlobals->m_DeferredFactories.pop_front();
+
+    // The nested RegisterFactoryInternalTimed() call must not record its
+    // own audit entry; the one of this materialization covers it
+    m_PimplGlobals->m_Materializing = true;
+    const auto start = std::chrono::steady_clock::now();
+    (*deferred.m_RegistrationFunction)();
+    const auto stop = std::chrono::steady_clock::now();
+    m_PimplGlobals->m_Materializing = false;
+
+    FactoryRegistrationRecord & record = m_PimplGlobals->m_RegistrationAudit[deferred.m_Name];
+    record.Name = deferred.m_Name;
+    record.Deferred = true;
+    record.Materialized = true;
+    record.RegistrationSeconds = std::chrono::duration<double>(stop - start).count();
+  }
+}
+
+/**
+ * Construct and register an internal factory, timing the registration.
+ */
+void
+ObjectFactoryBase::RegisterFactoryInternalTimed(FactoryNewFunction factoryNew)
+{
+  itkInitGlobalsMacro(PimplGlobals);
+
+  const auto          start = std::chrono::steady_clock::now();
+  ObjectFactoryBase * factory = (*factoryNew)();
+  ObjectFactoryBase::RegisterFactoryInternal(factory);
+  const auto stop = std::chrono::steady_clock::now();
+
+  {
+    const std::lock_guard<std::recursive_mutex> lockGuard(m_PimplGlobals->m_DeferredMutex);
+    if (!m_PimplGlobals->m_Materializing)
+    {
+      FactoryRegistrationRecord & record = m_PimplGlobals->m_RegistrationAudit[factory->GetNameOfClass()];
+      record.Name = factory->GetNameOfClass();
+      record.Materialized = true;
+      record.RegistrationSeconds = std::chrono::duration<double>(stop - start).count();
+    }
+  }
+
+  // drop the caller-owned reference handed over by factoryNew; the factory
+  // list holds its own
+  factory->UnRegister();
+}
+
+/**
+ * Copy the registration audit.
+ */
+std::vector<ObjectFactoryBase::FactoryRegistrationRecord>
+ObjectFactoryBase::GetFactoryRegistrationAudit()
+{
+  itkInitGlobalsMacro(PimplGlobals);
+
+  const std::lock_guard<std::recursive_mutex> lockGuard(m_PimplGlobals->m_DeferredMutex);
+
+  std::vector<FactoryRegistrationRecord> records;
+  records.reserve(m_PimplGlobals->m_RegistrationAudit.size());
+  for (const auto & entry : m_PimplGlobals->m_RegistrationAudit)
+  {
+    records.push_back(entry.second);
+  }
+  return records;
+}
+
 /**
  * Add a factory to the registered list
  */
@@ -888,6 +1134,7 @@ ObjectFactoryBase::GetRegisteredFactories()
   //  static SingletonIndex * singletonIndex = SingletonIndex::GetInstance();
   //  Unused(singletonIndex);
   ObjectFactoryBase::Initialize();
+  ObjectFactoryBase::MaterializeDeferredFactories();
   return *m_PimplGlobals->m_RegisteredFactories;
 }
 
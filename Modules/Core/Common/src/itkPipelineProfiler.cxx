@@ -0,0 +1,148 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkPipelineProfiler.h"
+#include "itkProcessObject.h"
+#include "itkRealTimeClock.h"
+
+#include <atomic>
+#include <mutex>
+
+namespace itk
+{
+
+namespace
+{
+
+std::atomic<bool> globalEnabled{ false };
+
+std::mutex profilerMutex;
+
+// The entries below are guarded by profilerMutex
+std::vector<PipelineProfiler::FilterRun> filterRuns;
+RealTimeClock::Pointer                   realTimeClock;
+double                                   timeOrigin = 0.0;
+
+// Must be called with profilerMutex held
+RealTimeClock *
+GetRealTimeClock()
+{
+  if (realTimeClock.IsNull())
+  {
+    realTimeClock = RealTimeClock::New();
+    timeOrigin = realTimeClock->GetTimeInSeconds();
+  }
+  return realTimeClock;
+}
+
+} // namespace
+
+void
+PipelineProfiler::SetGlobalEnabled(bool enabled)
+{
+  if (enabled)
+  {
+    // make sure the clock and the time origin exist before the first record
+    const std::lock_guard<std::mutex> lockGuard(profilerMutex);
+    GetRealTimeClock();
+  }
+  globalEnabled = enabled;
+}
+
+bool
+PipelineProfiler::GetGlobalEnabled()
+{
+  return globalEnabled;
+}
+
+void
+PipelineProfiler::Clear()
+{
+  const std::lock_guard<std::mutex> lockGuard(profilerMutex);
+  filterRuns.clear();
+  timeOrigin = GetRealTimeClock()->GetTimeInSeconds();
+}
+
+std::vector<PipelineProfiler::FilterRun>
+PipelineProfiler::GetFilterRuns()
+{
+  const std::lock_guard<std::mutex> lockGuard(profilerMutex);
+  return filterRuns;
+}
+
+double
+PipelineProfiler::GetTimestamp()
+{
+  const std::lock_guard<std::mutex> lockGuard(profilerMutex);
+  return GetRealTimeClock()->GetTimeInSeconds() - timeOrigin;
+}
+
+void
+PipelineProfiler::RecordFilterRun(const ProcessObject * filter, double startSeconds, double endSeconds)
+{
+  FilterRun run;
+  run.Name = filter->GetNameOfClass();
+  if (!filter->GetObjectName().empty())
+  {
+    run.Name += " (" + filter->GetObjectName() + ")";
+  }
+  run.FilterId = reinterpret_cast<uintptr_t>(filter);
+  run.StartSeconds = startSeconds;
+  run.DurationSeconds = endSeconds - startSeconds;
+  run.NumberOfWorkUnits = static_cast<uint32_t>(filter->GetNumberOfWorkUnits());
+
+  // Sum the bulk data held by the outputs. Outputs that do not report their
+  // buffer size contribute zero
+  run.OutputBytes = 0;
+  auto * mutableFilter = const_cast<ProcessObject *>(filter);
+  for (DataObject * output : mutableFilter->GetOutputs())
+  {
+    if (output != nullptr)
+    {
+      run.OutputBytes += output->GetBufferSizeInBytes();
+    }
+  }
+
+  const std::lock_guard<std::mutex> lockGuard(profilerMutex);
+  filterRuns.push_back(std::move(run));
+}
+
+void
+PipelineProfiler::WriteChromeTraceJSON(std::ostream & os)
+{
+  const std::lock_guard<std::mutex> lockGuard(profilerMutex);
+
+  os << "{\"traceEvents\": [\n";
+  bool first = true;
+  for (const FilterRun & run : filterRuns)
+  {
+    if (!first)
+    {
+      os << ",\n";
+    }
+    first = false;
+    // chrome-trace timestamps and durations are in microseconds
+    os << R"({"name": ")" << run.Name << R"(", "ph": "X", "pid": 0, "tid": 0)"
+       << ", \"ts\": " << run.StartSeconds * 1e6 << ", \"dur\": " << run.DurationSeconds * 1e6
+       << R"(, "args": {"filter_id": )" << run.FilterId << ", \"work_units\": " << run.NumberOfWorkUnits
+       << ", \"output_bytes\": " << run.OutputBytes << "}}";
+  }
+  os << "\n]}" << std::endl;
+}
+
+} // end namespace itk
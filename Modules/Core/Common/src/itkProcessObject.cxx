@@ -26,16 +26,22 @@
  *
  *=========================================================================*/
 #include "itkProcessObject.h"
+#include "itkPipelineProfiler.h"
 #include <mutex>
 
 #include <cstdio>
 #include <sstream>
 #include <algorithm>
 #include "itkMultiThreaderBase.h"
+#include "itkSingleton.h"
 
 namespace itk
 {
 
+itkGetGlobalValueMacro(ProcessObject, bool, GlobalIncrementalPipelineInvalidation, false);
+
+bool * ProcessObject::m_GlobalIncrementalPipelineInvalidation;
+
 
 namespace
 { // local namespace for managing globals
@@ -123,6 +129,16 @@ ProcessObject::~ProcessObject()
       output.second = nullptr;
     }
   }
+
+  // Remove the consumer back-links the inputs hold for pipeline
+  // invalidation; the inputs may outlive this process object.
+  for (auto & input : m_Inputs)
+  {
+    if (input.second)
+    {
+      input.second->RemoveConsumer(this);
+    }
+  }
 }
 
 
@@ -145,6 +161,7 @@ ProcessObject::SetNumberOfIndexedInputs(DataObjectPointerArraySizeType num)
            i < this->GetNumberOfIndexedInputs();
            ++i)
       {
+        this->TrackInputConsumer(m_IndexedInputs[i]->second, nullptr);
         m_Inputs.erase(m_IndexedInputs[i]->first);
       }
       m_IndexedInputs.resize(std::max<DataObjectPointerArraySizeType>(num, 1));
@@ -152,6 +169,7 @@ ProcessObject::SetNumberOfIndexedInputs(DataObjectPointerArraySizeType num)
 
       if (num < 1)
       {
+        this->TrackInputConsumer(m_IndexedInputs[0]->second, nullptr);
         m_IndexedInputs[0]->second = nullptr;
       }
     }
@@ -240,6 +258,7 @@ ProcessObject::RemoveInput(const DataObjectIdentifierType & key)
 
   if (it != m_Inputs.end())
   {
+    this->TrackInputConsumer(it->second, nullptr);
     m_Inputs.erase(it);
     this->Modified();
   }
@@ -271,12 +290,14 @@ ProcessObject::SetInput(const DataObjectIdentifierType & key, DataObject * input
   if (it == m_Inputs.end())
   {
     // this is a whole new entry
+    this->TrackInputConsumer(nullptr, input);
     m_Inputs[key] = input;
     this->Modified();
   }
   else if (it->second.GetPointer() != input)
   {
     // there is already an entry, but not with the right object
+    this->TrackInputConsumer(it->second, input);
     it->second = input;
     this->Modified();
   }
@@ -298,6 +319,7 @@ ProcessObject::SetNthInput(DataObjectPointerArraySizeType idx, DataObject * inpu
   }
   if (m_IndexedInputs[idx]->second != input)
   {
+    this->TrackInputConsumer(m_IndexedInputs[idx]->second, input);
     m_IndexedInputs[idx]->second = input;
     this->Modified();
   }
@@ -759,6 +781,7 @@ ProcessObject::SetPrimaryInput(DataObject * object)
 {
   if (m_IndexedInputs[0]->second != object)
   {
+    this->TrackInputConsumer(m_IndexedInputs[0]->second, object);
     m_IndexedInputs[0]->second = object;
     this->Modified();
   }
@@ -884,10 +907,12 @@ ProcessObject::AddOptionalInputName(const DataObjectIdentifierType & name, DataO
   {
     // if the old index had a data object move that to the new name
     it->second = this->GetInput(m_IndexedInputs[idx]->first);
+    this->TrackInputConsumer(nullptr, it->second);
   }
 
   // remove name of the old input ( may be new default index name
   // i.e. _1 )
+  this->TrackInputConsumer(m_IndexedInputs[idx]->second, nullptr);
   m_Inputs.erase(m_IndexedInputs[idx]->first);
 
   m_IndexedInputs[idx] = it;
@@ -1157,14 +1182,16 @@ ProcessObject::IncrementProgress(float increment)
   // Clamp the value to be between 0 and 1.
   uint32_t integerIncrement = progressFloatToFixed(increment);
 
-  uint32_t oldProgress = m_Progress;
-
-  uint32_t updatedProgress = m_Progress.fetch_add(integerIncrement);
+  // Relaxed ordering suffices: the aggregate is advisory, carries no
+  // synchronization, and worker threads only publish batched counts here.
+  // This avoids a full fence per update when many threads run cheap
+  // functors.
+  uint32_t previousProgress = m_Progress.fetch_add(integerIncrement, std::memory_order_relaxed);
 
   // check if progress overflowed
-  if (oldProgress > updatedProgress)
+  if (previousProgress > std::numeric_limits<uint32_t>::max() - integerIncrement)
   {
-    m_Progress = std::numeric_limits<uint32_t>::max();
+    m_Progress.store(std::numeric_limits<uint32_t>::max(), std::memory_order_relaxed);
   }
 
   if (std::this_thread::get_id() == this->m_UpdateThreadID)
@@ -1374,6 +1401,72 @@ ProcessObject::VerifyInputInformation() ITKv5_CONST
 {}
 
 
+void
+ProcessObject::SetGlobalIncrementalPipelineInvalidation(bool val)
+{
+  itkInitGlobalsMacro(GlobalIncrementalPipelineInvalidation);
+  *m_GlobalIncrementalPipelineInvalidation = val;
+}
+
+
+bool
+ProcessObject::GetGlobalIncrementalPipelineInvalidation()
+{
+  return *ProcessObject::GetGlobalIncrementalPipelineInvalidationPointer();
+}
+
+
+void
+ProcessObject::Modified() const
+{
+  Superclass::Modified();
+  // Propagation is unconditional so that the dirty flags stay accurate
+  // when incremental invalidation is enabled later on; it stops at the
+  // first already-dirty filter, so repeated modifications are O(1).
+  this->InvalidatePipeline();
+}
+
+
+void
+ProcessObject::InvalidatePipeline() const
+{
+  if (m_PipelineDirty)
+  {
+    // Everything downstream is already marked; also terminates cycles.
+    return;
+  }
+  m_PipelineDirty = true;
+  for (const auto & output : m_Outputs)
+  {
+    if (output.second)
+    {
+      for (ProcessObject * consumer : output.second->m_Consumers)
+      {
+        consumer->InvalidatePipeline();
+      }
+    }
+  }
+}
+
+
+void
+ProcessObject::TrackInputConsumer(DataObject * oldInput, DataObject * newInput)
+{
+  if (oldInput == newInput)
+  {
+    return;
+  }
+  if (oldInput)
+  {
+    oldInput->RemoveConsumer(this);
+  }
+  if (newInput)
+  {
+    newInput->AddConsumer(this);
+  }
+}
+
+
 void
 ProcessObject::UpdateOutputInformation()
 {
@@ -1392,6 +1485,20 @@ ProcessObject::UpdateOutputInformation()
     return;
   }
 
+  /**
+   * When incremental pipeline invalidation is enabled, a filter whose
+   * upstream pipeline has not been modified since the last negotiation
+   * can return immediately: its outputs' pipeline times and meta data
+   * are still valid. The modified time comparison catches filters whose
+   * GetMTime() override aggregates member objects (e.g. the transform
+   * of ResampleImageFilter): modifying such a member does not call this
+   * filter's Modified() and therefore leaves the dirty flag untouched.
+   */
+  if (!m_PipelineDirty && GetGlobalIncrementalPipelineInvalidation() && this->GetMTime() <= m_PipelineCleanTime)
+  {
+    return;
+  }
+
   /**
    * Verify that the process object has been configured correctly,
    * that all required inputs are set, and needed parameters are set
@@ -1482,6 +1589,14 @@ ProcessObject::UpdateOutputInformation()
      */
     m_OutputInformationMTime.Modified();
   }
+
+  /**
+   * The upstream pipeline state is now fully accounted for. Note that
+   * regenerating output information above may have re-marked downstream
+   * filters, which is the desired order.
+   */
+  m_PipelineDirty = false;
+  m_PipelineCleanTime = this->GetMTime();
 }
 
 
@@ -1703,6 +1818,13 @@ ProcessObject::UpdateOutputData(DataObject * itkNotUsed(output))
   m_AbortGenerateData = false;
   m_Progress = 0u;
 
+  const bool profiling = PipelineProfiler::GetGlobalEnabled();
+  double     profilingStart = 0.0;
+  if (profiling)
+  {
+    profilingStart = PipelineProfiler::GetTimestamp();
+  }
+
   try
   {
     this->GenerateData();
@@ -1731,6 +1853,11 @@ ProcessObject::UpdateOutputData(DataObject * itkNotUsed(output))
     this->UpdateProgress(1.0f);
   }
 
+  if (profiling)
+  {
+    PipelineProfiler::RecordFilterRun(this, profilingStart, PipelineProfiler::GetTimestamp());
+  }
+
   /**
    * Notify end event observers
    */
@@ -0,0 +1,211 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkSmallObjectPool.h"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace itk
+{
+namespace
+{
+// Size classes are multiples of this granularity; each chunk carries a
+// header of the same size so that user data stays 16-byte aligned.
+constexpr std::size_t chunkGranularity = 16;
+constexpr std::size_t numberOfSizeClasses = 32; // largest pooled request: 512 bytes of user data
+constexpr std::size_t slabSize = 64 * 1024;
+
+struct Arena;
+
+// Prepended to every chunk handed out by the pool. A nullptr arena
+// marks a chunk that was served directly by operator new.
+struct ChunkHeader
+{
+  Arena *       m_Arena;
+  std::uint32_t m_SizeClass;
+  std::uint32_t m_Padding;
+};
+static_assert(sizeof(ChunkHeader) <= chunkGranularity, "ChunkHeader must fit the alignment granularity");
+
+struct FreeChunk
+{
+  FreeChunk * m_Next;
+};
+
+struct Arena
+{
+  // Free lists touched only by the owning thread.
+  std::array<FreeChunk *, numberOfSizeClasses> m_FreeLists{};
+
+  // Chunks freed by other threads, reclaimed lazily under the mutex.
+  std::array<FreeChunk *, numberOfSizeClasses> m_RemoteFreeLists{};
+  std::mutex                                   m_RemoteMutex;
+
+  // Bump region of the current slab.
+  char *      m_BumpPointer{ nullptr };
+  std::size_t m_BumpRemaining{ 0 };
+
+  std::vector<std::unique_ptr<char[]>> m_Slabs;
+};
+
+struct PoolGlobals
+{
+  std::mutex                          m_Mutex;
+  std::vector<std::unique_ptr<Arena>> m_AllArenas;   // owns every arena ever created
+  std::vector<Arena *>                m_FreeArenas;  // arenas whose thread has exited
+};
+
+PoolGlobals &
+GetPoolGlobals()
+{
+  // Leaked intentionally: chunks may be freed during static destruction.
+  static auto * globals = new PoolGlobals;
+  return *globals;
+}
+
+// Acquires an arena on first use and retires it on thread exit, so that
+// chunks can outlive the thread which allocated them.
+struct ArenaHolder
+{
+  ArenaHolder()
+  {
+    PoolGlobals &               globals = GetPoolGlobals();
+    std::lock_guard<std::mutex> lockGuard(globals.m_Mutex);
+    if (!globals.m_FreeArenas.empty())
+    {
+      m_Arena = globals.m_FreeArenas.back();
+      globals.m_FreeArenas.pop_back();
+    }
+    else
+    {
+      globals.m_AllArenas.push_back(std::make_unique<Arena>());
+      m_Arena = globals.m_AllArenas.back().get();
+    }
+  }
+
+  ~ArenaHolder()
+  {
+    PoolGlobals &               globals = GetPoolGlobals();
+    std::lock_guard<std::mutex> lockGuard(globals.m_Mutex);
+    globals.m_FreeArenas.push_back(m_Arena);
+  }
+
+  Arena * m_Arena;
+};
+
+Arena &
+GetThreadArena()
+{
+  thread_local ArenaHolder holder;
+  return *holder.m_Arena;
+}
+
+std::size_t
+ChunkSizeOfClass(std::size_t sizeClass)
+{
+  return sizeof(ChunkHeader) + (sizeClass + 1) * chunkGranularity;
+}
+} // namespace
+
+void *
+SmallObjectPool::Allocate(std::size_t size)
+{
+  if (size == 0)
+  {
+    size = 1;
+  }
+  const std::size_t sizeClass = (size - 1) / chunkGranularity;
+  if (sizeClass >= numberOfSizeClasses)
+  {
+    // Too large to pool: delegate to the global allocator, marked with a
+    // null arena so Deallocate knows how to release it.
+    auto * header = static_cast<ChunkHeader *>(::operator new(sizeof(ChunkHeader) + size));
+    header->m_Arena = nullptr;
+    return header + 1;
+  }
+
+  Arena & arena = GetThreadArena();
+
+  // Fast path: thread-local free list.
+  FreeChunk *& freeList = arena.m_FreeLists[sizeClass];
+  if (freeList == nullptr)
+  {
+    // Reclaim chunks freed by other threads.
+    std::lock_guard<std::mutex> lockGuard(arena.m_RemoteMutex);
+    freeList = arena.m_RemoteFreeLists[sizeClass];
+    arena.m_RemoteFreeLists[sizeClass] = nullptr;
+  }
+  ChunkHeader * header;
+  if (freeList != nullptr)
+  {
+    header = reinterpret_cast<ChunkHeader *>(freeList);
+    freeList = freeList->m_Next;
+  }
+  else
+  {
+    // Carve a fresh chunk from the bump region of the current slab.
+    const std::size_t chunkSize = ChunkSizeOfClass(sizeClass);
+    if (arena.m_BumpRemaining < chunkSize)
+    {
+      arena.m_Slabs.push_back(std::make_unique<char[]>(slabSize));
+      arena.m_BumpPointer = arena.m_Slabs.back().get();
+      arena.m_BumpRemaining = slabSize;
+    }
+    header = reinterpret_cast<ChunkHeader *>(arena.m_BumpPointer);
+    arena.m_BumpPointer += chunkSize;
+    arena.m_BumpRemaining -= chunkSize;
+  }
+  header->m_Arena = &arena;
+  header->m_SizeClass = static_cast<std::uint32_t>(sizeClass);
+  return header + 1;
+}
+
+void
+SmallObjectPool::Deallocate(void * ptr)
+{
+  if (ptr == nullptr)
+  {
+    return;
+  }
+  ChunkHeader * header = static_cast<ChunkHeader *>(ptr) - 1;
+  Arena *       owner = header->m_Arena;
+  if (owner == nullptr)
+  {
+    ::operator delete(header);
+    return;
+  }
+  const std::size_t sizeClass = header->m_SizeClass;
+  auto *            chunk = reinterpret_cast<FreeChunk *>(header);
+  if (owner == &GetThreadArena())
+  {
+    chunk->m_Next = owner->m_FreeLists[sizeClass];
+    owner->m_FreeLists[sizeClass] = chunk;
+  }
+  else
+  {
+    std::lock_guard<std::mutex> lockGuard(owner->m_RemoteMutex);
+    chunk->m_Next = owner->m_RemoteFreeLists[sizeClass];
+    owner->m_RemoteFreeLists[sizeClass] = chunk;
+  }
+}
+} // end namespace itk
@@ -246,6 +246,14 @@ TBBMultiThreader::ParallelizeImageRegion(unsigned int         dimension,
                                          ThreadingFunctorType funcP,
                                          ProcessObject *      filter)
 {
+  if (MultiThreaderBase::GetGlobalDeterministicReductions())
+  {
+    // The load-balanced TBB partitioning yields run-dependent splits; use
+    // the fixed splits of the base implementation instead
+    this->MultiThreaderBase::ParallelizeImageRegion(dimension, index, size, funcP, filter);
+    return;
+  }
+
   if (!this->GetUpdateProgress())
   {
     filter = nullptr;
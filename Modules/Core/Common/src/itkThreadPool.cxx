@@ -17,6 +17,11 @@
  *=========================================================================*/
 
 
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+// Required for pthread_setaffinity_np and cpu_set_t.
+#  define _GNU_SOURCE
+#endif
+
 #include "itkThreadPool.h"
 #include "itksys/SystemTools.hxx"
 #include "itkThreadSupport.h"
@@ -26,6 +31,10 @@
 
 #include <algorithm>
 
+#if defined(ITK_USE_PTHREADS) && defined(__linux__)
+#  include <sched.h>
+#endif
+
 
 namespace itk
 {
@@ -47,8 +56,57 @@ struct ThreadPoolGlobals
 #else // In a static library, we have to wait.
   bool m_WaitForThreads = true;
 #endif
+  // Whether worker threads are pinned to logical cores.
+  bool m_UseAffinity = false;
+  // Whether the ITK_THREAD_POOL_AFFINITY environment variable was examined.
+  bool m_AffinityInitialized = false;
 };
 
+namespace
+{
+// Bind a worker thread to a single logical core, or to all cores when
+// core is negative. A no-op on platforms without affinity support.
+void
+BindThreadToCore(std::thread & thread, long long core)
+{
+#if defined(ITK_USE_PTHREADS) && defined(__linux__)
+  const unsigned int coreCount = std::max(1u, std::thread::hardware_concurrency());
+  cpu_set_t          cpuSet;
+  CPU_ZERO(&cpuSet);
+  if (core < 0) // restore the default affinity mask
+  {
+    for (unsigned int i = 0; i < coreCount; ++i)
+    {
+      CPU_SET(i, &cpuSet);
+    }
+  }
+  else
+  {
+    CPU_SET(static_cast<unsigned int>(core) % coreCount, &cpuSet);
+  }
+  pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &cpuSet);
+#elif defined(ITK_USE_WIN32_THREADS)
+  DWORD_PTR processMask = 0;
+  DWORD_PTR systemMask = 0;
+  GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask);
+  DWORD_PTR mask = processMask;
+  if (core >= 0)
+  {
+    constexpr unsigned int maskBits = 8 * sizeof(DWORD_PTR);
+    const DWORD_PTR        coreBit = DWORD_PTR(1) << (static_cast<unsigned int>(core) % maskBits);
+    if (coreBit & processMask)
+    {
+      mask = coreBit;
+    }
+  }
+  SetThreadAffinityMask(thread.native_handle(), mask);
+#else
+  (void)thread;
+  (void)core;
+#endif
+}
+} // namespace
+
 itkGetGlobalSimpleMacro(ThreadPool, ThreadPoolGlobals, PimplGlobals);
 
 ThreadPool::Pointer
@@ -99,26 +157,71 @@ ThreadPool::SetDoNotWaitForThreads(bool doNotWaitForThreads)
   m_PimplGlobals->m_WaitForThreads = !doNotWaitForThreads;
 }
 
+bool
+ThreadPool::GetThreadAffinityEnabled()
+{
+  itkInitGlobalsMacro(PimplGlobals);
+  if (!m_PimplGlobals->m_AffinityInitialized)
+  {
+    m_PimplGlobals->m_AffinityInitialized = true;
+    std::string envVar;
+    if (itksys::SystemTools::GetEnv("ITK_THREAD_POOL_AFFINITY", envVar))
+    {
+      m_PimplGlobals->m_UseAffinity = (envVar != "0");
+    }
+  }
+  return m_PimplGlobals->m_UseAffinity;
+}
+
+void
+ThreadPool::SetThreadAffinityEnabled(bool enableAffinity)
+{
+  itkInitGlobalsMacro(PimplGlobals);
+  m_PimplGlobals->m_AffinityInitialized = true; // the developer's choice beats the environment
+  m_PimplGlobals->m_UseAffinity = enableAffinity;
+
+  // Re-bind the workers of an already constructed pool.
+  if (m_PimplGlobals->m_ThreadPoolInstance.IsNotNull())
+  {
+    ThreadPool *                 instance = m_PimplGlobals->m_ThreadPoolInstance.GetPointer();
+    std::unique_lock<std::mutex> mutexHolder(m_PimplGlobals->m_Mutex);
+    for (size_t i = 0; i < instance->m_Threads.size(); ++i)
+    {
+      BindThreadToCore(instance->m_Threads[i], enableAffinity ? static_cast<long long>(i) : -1);
+    }
+  }
+}
+
 ThreadPool::ThreadPool()
 {
   m_PimplGlobals->m_ThreadPoolInstance = this;        // threads need this
   m_PimplGlobals->m_ThreadPoolInstance->UnRegister(); // Remove extra reference
   ThreadIdType threadCount = MultiThreaderBase::GetGlobalDefaultNumberOfThreads();
+  const bool useAffinity = GetThreadAffinityEnabled();
   m_Threads.reserve(threadCount);
   for (unsigned int i = 0; i < threadCount; ++i)
   {
     m_Threads.emplace_back(&ThreadPool::ThreadExecute);
+    if (useAffinity)
+    {
+      BindThreadToCore(m_Threads.back(), static_cast<long long>(m_Threads.size() - 1));
+    }
   }
 }
 
 void
 ThreadPool::AddThreads(ThreadIdType count)
 {
+  const bool                   useAffinity = GetThreadAffinityEnabled();
   std::unique_lock<std::mutex> mutexHolder(m_PimplGlobals->m_Mutex);
   m_Threads.reserve(m_Threads.size() + count);
   for (unsigned int i = 0; i < count; ++i)
   {
     m_Threads.emplace_back(&ThreadPool::ThreadExecute);
+    if (useAffinity)
+    {
+      BindThreadToCore(m_Threads.back(), static_cast<long long>(m_Threads.size() - 1));
+    }
   }
 }
 
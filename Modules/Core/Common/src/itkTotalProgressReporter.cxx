@@ -28,6 +28,12 @@ TotalProgressReporter::TotalProgressReporter(ProcessObject * filter,
   , m_CurrentPixel(0)
   , m_ProgressWeight(progressWeight)
 {
+  // Filters can turn off progress accounting entirely for hot loops.
+  if (m_Filter && !m_Filter->GetThreaderUpdateProgress())
+  {
+    m_Filter = nullptr;
+  }
+
   // Make sure we have at least one pixel.
   const float numPixels = std::max(static_cast<float>(totalNumberOfPixels), 1.0f);
 
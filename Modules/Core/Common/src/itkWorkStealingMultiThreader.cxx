@@ -0,0 +1,300 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkWorkStealingMultiThreader.h"
+#include "itkNumericTraits.h"
+#include "itkProcessObject.h"
+#include "itkImageSourceCommon.h"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+namespace itk
+{
+namespace
+{
+class ExceptionHandler
+{
+public:
+  // This class follows the rule of zero
+
+  template <typename TFunction>
+  void
+  TryAndCatch(const TFunction & function)
+  {
+    try
+    {
+      function();
+    }
+    catch (...)
+    {
+      if (m_FirstCaughtException == nullptr)
+      {
+        m_FirstCaughtException = std::current_exception();
+      }
+    }
+  }
+
+  void
+  RethrowFirstCaughtException() const
+  {
+    if (m_FirstCaughtException != nullptr)
+    {
+      std::rethrow_exception(m_FirstCaughtException);
+    }
+  }
+
+private:
+  std::exception_ptr m_FirstCaughtException;
+};
+} // namespace
+
+
+WorkStealingMultiThreader::WorkStealingMultiThreader()
+  : m_ThreadPool(ThreadPool::GetInstance())
+{
+  for (ThreadIdType i = 0; i < ITK_MAX_THREADS; ++i)
+  {
+    m_ThreadInfoArray[i].WorkUnitID = i;
+  }
+
+  ThreadIdType defaultThreads = std::max(1u, GetGlobalDefaultNumberOfThreads());
+  m_NumberOfWorkUnits = std::min<ThreadIdType>(ITK_MAX_THREADS, defaultThreads);
+  m_MaximumNumberOfThreads = m_ThreadPool->GetMaximumNumberOfThreads();
+}
+
+WorkStealingMultiThreader::~WorkStealingMultiThreader() = default;
+
+void
+WorkStealingMultiThreader::SetSingleMethod(ThreadFunctionType f, void * data)
+{
+  m_SingleMethod = f;
+  m_SingleData = data;
+}
+
+void
+WorkStealingMultiThreader::SetMaximumNumberOfThreads(ThreadIdType numberOfThreads)
+{
+  Superclass::SetMaximumNumberOfThreads(numberOfThreads);
+  ThreadIdType threadCount = m_ThreadPool->GetMaximumNumberOfThreads();
+  if (threadCount < m_MaximumNumberOfThreads)
+  {
+    m_ThreadPool->AddThreads(m_MaximumNumberOfThreads - threadCount);
+  }
+  m_MaximumNumberOfThreads = m_ThreadPool->GetMaximumNumberOfThreads();
+}
+
+void
+WorkStealingMultiThreader::SingleMethodExecute()
+{
+  if (!m_SingleMethod)
+  {
+    itkExceptionMacro(<< "No single method set!");
+  }
+
+  // The legacy SingleMethod interface assigns a fixed share of work to each
+  // WorkUnitID inside the user callback, so no dynamic rebalancing is
+  // possible here. Work units are dispatched to the pool as-is.
+  m_NumberOfWorkUnits = std::min(this->GetGlobalMaximumNumberOfThreads(), m_NumberOfWorkUnits);
+
+  for (ThreadIdType threadLoop = 1; threadLoop < m_NumberOfWorkUnits; ++threadLoop)
+  {
+    m_ThreadInfoArray[threadLoop].UserData = m_SingleData;
+    m_ThreadInfoArray[threadLoop].NumberOfWorkUnits = m_NumberOfWorkUnits;
+    m_ThreadInfoArray[threadLoop].Future = m_ThreadPool->AddWork(m_SingleMethod, &m_ThreadInfoArray[threadLoop]);
+  }
+
+  // Now, the parent thread calls this->SingleMethod() itself
+  m_ThreadInfoArray[0].UserData = m_SingleData;
+  m_ThreadInfoArray[0].NumberOfWorkUnits = m_NumberOfWorkUnits;
+  ExceptionHandler exceptionHandler;
+  exceptionHandler.TryAndCatch([this] { m_SingleMethod(&m_ThreadInfoArray[0]); });
+
+  // The parent thread has finished SingleMethod()
+  // so now it waits for each of the other work units to finish
+  for (ThreadIdType threadLoop = 1; threadLoop < m_NumberOfWorkUnits; ++threadLoop)
+  {
+    exceptionHandler.TryAndCatch([this, threadLoop] { m_ThreadInfoArray[threadLoop].Future.get(); });
+  }
+
+  exceptionHandler.RethrowFirstCaughtException();
+}
+
+void
+WorkStealingMultiThreader::ParallelizeArray(SizeValueType             firstIndex,
+                                            SizeValueType             lastIndexPlus1,
+                                            ArrayThreadingFunctorType aFunc,
+                                            ProcessObject *           filter)
+{
+  if (!this->GetUpdateProgress())
+  {
+    filter = nullptr;
+  }
+
+  if (firstIndex + 1 < lastIndexPlus1)
+  {
+    const SizeValueType indexCount = lastIndexPlus1 - firstIndex;
+    const SizeValueType chunkCount =
+      std::min<SizeValueType>(indexCount, static_cast<SizeValueType>(m_NumberOfWorkUnits) * m_OversubscriptionFactor);
+    SizeValueType chunkSize = indexCount / chunkCount;
+    if (indexCount % chunkCount > 0)
+    {
+      chunkSize++;
+    }
+
+    // Workers atomically claim the next unprocessed chunk: a worker which
+    // received cheap chunks keeps pulling work that would otherwise be
+    // stuck behind a loaded worker's static share.
+    auto nextChunk = std::make_shared<std::atomic<SizeValueType>>(0);
+    auto worker = [aFunc, nextChunk, firstIndex, lastIndexPlus1, chunkSize, chunkCount]() {
+      SizeValueType chunk = (*nextChunk)++;
+      while (chunk < chunkCount)
+      {
+        const SizeValueType start = firstIndex + chunk * chunkSize;
+        const SizeValueType end = std::min(start + chunkSize, lastIndexPlus1);
+        for (SizeValueType ii = start; ii < end; ++ii)
+        {
+          aFunc(ii);
+        }
+        chunk = (*nextChunk)++;
+      }
+      // make this lambda have the same signature as m_SingleMethod
+      return ITK_THREAD_RETURN_DEFAULT_VALUE;
+    };
+
+    const ThreadIdType workerCount =
+      std::min<ThreadIdType>(m_MaximumNumberOfThreads, static_cast<ThreadIdType>(chunkCount));
+    for (ThreadIdType i = 1; i < workerCount; ++i)
+    {
+      m_ThreadInfoArray[i].Future = m_ThreadPool->AddWork(worker);
+    }
+
+    ProgressReporter reporter(filter, 0, workerCount);
+
+    // execute this thread's share
+    ExceptionHandler exceptionHandler;
+    exceptionHandler.TryAndCatch([worker, &reporter] {
+      worker();
+      reporter.CompletedPixel();
+    });
+
+    // now wait for the other computations to finish
+    for (ThreadIdType i = 1; i < workerCount; ++i)
+    {
+      exceptionHandler.TryAndCatch([this, i, &reporter] {
+        m_ThreadInfoArray[i].Future.get();
+        reporter.CompletedPixel();
+      });
+    }
+
+    exceptionHandler.RethrowFirstCaughtException();
+  }
+  else if (firstIndex + 1 == lastIndexPlus1)
+  {
+    aFunc(firstIndex);
+  }
+  // else nothing needs to be executed
+}
+
+void
+WorkStealingMultiThreader::ParallelizeImageRegion(unsigned int         dimension,
+                                                  const IndexValueType index[],
+                                                  const SizeValueType  size[],
+                                                  ThreadingFunctorType funcP,
+                                                  ProcessObject *      filter)
+{
+  if (!this->GetUpdateProgress())
+  {
+    filter = nullptr;
+  }
+
+  if (m_NumberOfWorkUnits == 1) // no multi-threading wanted
+  {
+    ProgressReporter reporter(filter, 0, 1);
+    funcP(index, size); // process whole region
+    reporter.CompletedPixel();
+    return;
+  }
+
+  ImageIORegion region(dimension);
+  for (unsigned d = 0; d < dimension; ++d)
+  {
+    region.SetIndex(d, index[d]);
+    region.SetSize(d, size[d]);
+  }
+  if (region.GetNumberOfPixels() <= 1)
+  {
+    funcP(index, size); // process whole region
+    return;
+  }
+
+  // Over-decompose the region so that idle workers can claim chunks
+  // left over from non-uniformly expensive parts of the image.
+  const ImageRegionSplitterBase * splitter = ImageSourceCommon::GetGlobalDefaultSplitter();
+  const ThreadIdType              requestedChunks = m_NumberOfWorkUnits * m_OversubscriptionFactor;
+  const ThreadIdType              chunkCount = splitter->GetNumberOfSplits(region, requestedChunks);
+
+  auto nextChunk = std::make_shared<std::atomic<ThreadIdType>>(0);
+  auto worker = [funcP, nextChunk, splitter, region, chunkCount]() {
+    ThreadIdType chunk = (*nextChunk)++;
+    while (chunk < chunkCount)
+    {
+      ImageIORegion iRegion = region;
+      splitter->GetSplit(chunk, chunkCount, iRegion);
+      funcP(&iRegion.GetIndex()[0], &iRegion.GetSize()[0]);
+      chunk = (*nextChunk)++;
+    }
+    // make this lambda have the same signature as m_SingleMethod
+    return ITK_THREAD_RETURN_DEFAULT_VALUE;
+  };
+
+  const ThreadIdType workerCount = std::min<ThreadIdType>(m_MaximumNumberOfThreads, chunkCount);
+  for (ThreadIdType i = 1; i < workerCount; ++i)
+  {
+    m_ThreadInfoArray[i].Future = m_ThreadPool->AddWork(worker);
+  }
+
+  ProgressReporter reporter(filter, 0, workerCount);
+
+  // execute this thread's share
+  ExceptionHandler exceptionHandler;
+  exceptionHandler.TryAndCatch([worker, &reporter] {
+    worker();
+    reporter.CompletedPixel();
+  });
+
+  // now wait for the other computations to finish
+  for (ThreadIdType i = 1; i < workerCount; ++i)
+  {
+    exceptionHandler.TryAndCatch([this, i, &reporter] {
+      m_ThreadInfoArray[i].Future.get();
+      reporter.CompletedPixel();
+    });
+  }
+
+  exceptionHandler.RethrowFirstCaughtException();
+}
+
+void
+WorkStealingMultiThreader::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "OversubscriptionFactor: " << m_OversubscriptionFactor << std::endl;
+}
+
+} // namespace itk
@@ -0,0 +1,93 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkWorkUnitInstrumentation.h"
+
+namespace itk
+{
+
+void
+WorkUnitTimingCollector::WorkUnitBegin(unsigned int itkNotUsed(dimension),
+                                       const IndexValueType itkNotUsed(index)[],
+                                       const SizeValueType itkNotUsed(size)[])
+{
+  const std::lock_guard<std::mutex> lockGuard(m_Mutex);
+  m_Threads[std::this_thread::get_id()].Start = std::chrono::steady_clock::now();
+}
+
+void
+WorkUnitTimingCollector::WorkUnitEnd(unsigned int dimension,
+                                     const IndexValueType itkNotUsed(index)[],
+                                     const SizeValueType size[])
+{
+  const TimePointType now = std::chrono::steady_clock::now();
+
+  SizeValueType pixels = 1;
+  for (unsigned int d = 0; d < dimension; ++d)
+  {
+    pixels *= size[d];
+  }
+
+  const std::lock_guard<std::mutex> lockGuard(m_Mutex);
+  ThreadState &                     state = m_Threads[std::this_thread::get_id()];
+  ++state.Record.WorkUnits;
+  state.Record.Pixels += pixels;
+  state.Record.Seconds += std::chrono::duration<double>(now - state.Start).count();
+}
+
+auto
+WorkUnitTimingCollector::GetThreadRecords() const -> std::vector<ThreadRecord>
+{
+  const std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+  std::vector<ThreadRecord> records;
+  records.reserve(m_Threads.size());
+  for (const auto & thread : m_Threads)
+  {
+    records.push_back(thread.second.Record);
+  }
+  return records;
+}
+
+void
+WorkUnitTimingCollector::Reset()
+{
+  const std::lock_guard<std::mutex> lockGuard(m_Mutex);
+  m_Threads.clear();
+}
+
+void
+WorkUnitTimingCollector::Print(std::ostream & os) const
+{
+  const std::vector<ThreadRecord> records = this->GetThreadRecords();
+
+  os << "WorkUnitTimingCollector: " << records.size() << " threads" << std::endl;
+  unsigned int threadNumber = 0;
+  for (const ThreadRecord & record : records)
+  {
+    os << "  thread " << threadNumber++ << ": " << record.WorkUnits << " work units, " << record.Pixels
+       << " pixels, " << record.Seconds << " s";
+    if (record.Seconds > 0.0)
+    {
+      os << ", " << static_cast<double>(record.Pixels) / record.Seconds << " pixels/s";
+    }
+    os << std::endl;
+  }
+}
+
+} // end namespace itk
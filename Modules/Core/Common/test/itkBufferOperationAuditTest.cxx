@@ -0,0 +1,110 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkBufferOperationAudit.h"
+#include "itkImageAlgorithm.h"
+#include "itkShiftScaleImageFilter.h"
+
+#include <iostream>
+
+int
+itkBufferOperationAuditTest(int, char *[])
+{
+  bool testPassed = true;
+
+  using ImageType = itk::Image<float, 2>;
+  using RecordType = itk::BufferOperationAudit::Record;
+  using OperationEnum = itk::BufferOperationAudit::OperationEnum;
+
+  auto                  image = ImageType::New();
+  ImageType::SizeType   size = { { 16, 16 } };
+  ImageType::RegionType region(size);
+  image->SetRegions(region);
+  image->Allocate();
+  image->FillBuffer(2.0f);
+
+  itk::BufferOperationAudit::Start();
+  if (!itk::BufferOperationAudit::IsRecording())
+  {
+    std::cerr << "Recording did not start" << std::endl;
+    testPassed = false;
+  }
+
+  // A filter update must report the allocation of its output.
+  auto shiftScale = itk::ShiftScaleImageFilter<ImageType, ImageType>::New();
+  shiftScale->SetInput(image);
+  shiftScale->SetShift(1.0);
+  shiftScale->InPlaceOff();
+  shiftScale->Update();
+
+  std::vector<RecordType> records = itk::BufferOperationAudit::GetRecords();
+  if (records.size() != 1 || records[0].Operation != OperationEnum::Allocate ||
+      records[0].Destination != shiftScale->GetOutput() || records[0].Pixels != region.GetNumberOfPixels())
+  {
+    std::cerr << "Expected a single allocation record for the filter output, got " << records.size() << " records"
+              << std::endl;
+    testPassed = false;
+  }
+
+  // A deep copy of the whole filter output, with the source never touched
+  // again, is exactly the pattern the audit flags as a missed graft.
+  auto scratch = ImageType::New();
+  scratch->SetRegions(region);
+  scratch->Allocate();
+  itk::ImageAlgorithm::Copy(shiftScale->GetOutput(), scratch.GetPointer(), region, region);
+
+  // Grafting the copy onto another filter's output must be recorded and
+  // must not count as an avoidable copy itself.
+  auto grafting = itk::ShiftScaleImageFilter<ImageType, ImageType>::New();
+  grafting->GraftOutput(scratch);
+
+  records = itk::BufferOperationAudit::GetRecords();
+  if (records.size() != 3 || records[1].Operation != OperationEnum::Copy || !records[1].FullBuffer ||
+      records[1].Source != shiftScale->GetOutput() || records[2].Operation != OperationEnum::Graft ||
+      records[2].Source != scratch.GetPointer())
+  {
+    std::cerr << "Expected allocate/copy/graft records, got " << records.size() << " records" << std::endl;
+    testPassed = false;
+  }
+
+  const std::vector<RecordType> avoidable = itk::BufferOperationAudit::GetAvoidableCopies();
+  if (avoidable.size() != 1 || avoidable[0].Source != shiftScale->GetOutput())
+  {
+    std::cerr << "Expected the full-buffer copy to be flagged as avoidable, got " << avoidable.size() << std::endl;
+    testPassed = false;
+  }
+
+  // After Stop() no further operations may be recorded, but the existing
+  // records remain available.
+  itk::BufferOperationAudit::Stop();
+  itk::ImageAlgorithm::Copy(image.GetPointer(), scratch.GetPointer(), region, region);
+  if (itk::BufferOperationAudit::IsRecording() || itk::BufferOperationAudit::GetRecords().size() != 3)
+  {
+    std::cerr << "Recording continued after Stop()" << std::endl;
+    testPassed = false;
+  }
+
+  if (!testPassed)
+  {
+    std::cerr << "Test failed." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Test passed." << std::endl;
+  return EXIT_SUCCESS;
+}
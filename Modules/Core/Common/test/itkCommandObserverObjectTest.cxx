@@ -318,6 +318,50 @@ testLambdaCommand()
 }
 
 
+int
+testEventMatchCacheInvalidation()
+{
+  // the per-event-type observer match result is cached between
+  // invocations; verify the cache is discarded when the observer list
+  // changes in either direction
+
+  itk::Object::Pointer o = itk::Object::New();
+
+  itk::CStyleCommand::Pointer cmd = itk::CStyleCommand::New();
+  cmd->SetCallback(onAny);
+  cmd->SetObjectName("Any Command 1");
+
+  // prime a negative cache entry for UserEvent, then add an observer for
+  // it: the new observer must be executed
+  onAnyCount = 0;
+  o->InvokeEvent(itk::UserEvent());
+  ITK_TEST_EXPECT_TRUE(!o->HasObserver(itk::UserEvent()));
+  unsigned long id = o->AddObserver(itk::UserEvent(), cmd);
+  ITK_TEST_EXPECT_TRUE(o->HasObserver(itk::UserEvent()));
+  o->InvokeEvent(itk::UserEvent());
+  ITK_TEST_EXPECT_TRUE(onAnyCount == 1);
+
+  // prime a positive cache entry, then remove the observer: the event
+  // must no longer be reported as observed nor executed
+  o->RemoveObserver(id);
+  ITK_TEST_EXPECT_TRUE(!o->HasObserver(itk::UserEvent()));
+  onAnyCount = 0;
+  o->InvokeEvent(itk::UserEvent());
+  ITK_TEST_EXPECT_TRUE(onAnyCount == 0);
+
+  // same through RemoveAllObservers
+  o->AddObserver(itk::UserEvent(), cmd);
+  ITK_TEST_EXPECT_TRUE(o->HasObserver(itk::UserEvent()));
+  o->RemoveAllObservers();
+  ITK_TEST_EXPECT_TRUE(!o->HasObserver(itk::UserEvent()));
+  onAnyCount = 0;
+  o->InvokeEvent(itk::UserEvent());
+  ITK_TEST_EXPECT_TRUE(onAnyCount == 0);
+
+  return EXIT_SUCCESS;
+}
+
+
 } // end namespace
 
 
@@ -331,6 +375,7 @@ itkCommandObserverObjectTest(int, char *[])
   ret &= (testCommandRecursiveObject() == EXIT_SUCCESS);
   ret &= (testDeleteEventThrow() == EXIT_SUCCESS);
   ret &= (testLambdaCommand() == EXIT_SUCCESS);
+  ret &= (testEventMatchCacheInvalidation() == EXIT_SUCCESS);
 
   return ret ? EXIT_SUCCESS : EXIT_FAILURE;
 }
@@ -0,0 +1,139 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkCompactVectorContainer.h"
+#include "itkMesh.h"
+#include "itkDefaultCompactMeshTraits.h"
+
+#include <iostream>
+
+int
+itkCompactVectorContainerTest(int, char *[])
+{
+  using ContainerType = itk::CompactVectorContainer<unsigned long, double>;
+
+  ContainerType::Pointer container = ContainerType::New();
+
+  container->Reserve(10);
+  for (unsigned long id = 0; id < 10; ++id)
+  {
+    container->InsertElement(id, static_cast<double>(id) * 2.0);
+  }
+
+  if (container->Size() != 10)
+  {
+    std::cerr << "Size() after insertion is wrong: " << container->Size() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Tombstone a few identifiers; the identifiers of the remaining
+  // elements must not change and the iterators must skip the holes
+  container->DeleteIndex(0);
+  container->DeleteIndex(4);
+  container->DeleteIndex(9);
+
+  if (container->Size() != 7)
+  {
+    std::cerr << "Size() after deletion is wrong: " << container->Size() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if (container->IndexExists(4) || !container->IndexExists(5))
+  {
+    std::cerr << "IndexExists() does not reflect the tombstones" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  double element = 0.0;
+  if (container->GetElementIfIndexExists(4, &element) || !container->GetElementIfIndexExists(5, &element) ||
+      element != 10.0)
+  {
+    std::cerr << "GetElementIfIndexExists() does not reflect the tombstones" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  unsigned long expectedIds[7] = { 1, 2, 3, 5, 6, 7, 8 };
+  unsigned int  position = 0;
+  for (ContainerType::ConstIterator it = container->Begin(); it != container->End(); ++it)
+  {
+    if (position >= 7 || it.Index() != expectedIds[position] ||
+        it.Value() != static_cast<double>(expectedIds[position]) * 2.0)
+    {
+      std::cerr << "Iteration does not skip the tombstones" << std::endl;
+      return EXIT_FAILURE;
+    }
+    ++position;
+  }
+  if (position != 7)
+  {
+    std::cerr << "Iteration visited " << position << " elements instead of 7" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Re-inserting at a tombstoned identifier revives it
+  container->InsertElement(4, 8.0);
+  if (container->Size() != 8 || !container->IndexExists(4))
+  {
+    std::cerr << "Re-insertion at a tombstoned identifier failed" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  container->Squeeze();
+  container->Initialize();
+  if (container->Size() != 0 || container->Begin() != container->End())
+  {
+    std::cerr << "Initialize() did not clear the container" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The container must be usable as the point storage of a mesh
+  using MeshTraits = itk::DefaultCompactMeshTraits<double, 3, 3, double>;
+  using MeshType = itk::Mesh<double, 3, MeshTraits>;
+  using PointType = MeshType::PointType;
+
+  auto mesh = MeshType::New();
+
+  PointType point;
+  for (unsigned long id = 0; id < 5; ++id)
+  {
+    point.Fill(static_cast<double>(id));
+    mesh->SetPoint(id, point);
+  }
+
+  if (mesh->GetNumberOfPoints() != 5)
+  {
+    std::cerr << "Mesh has the wrong number of points: " << mesh->GetNumberOfPoints() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  mesh->GetPoints()->DeleteIndex(2);
+  if (mesh->GetNumberOfPoints() != 4)
+  {
+    std::cerr << "Mesh point deletion failed" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if (!mesh->GetPoint(3, &point) || point[0] != 3.0)
+  {
+    std::cerr << "Mesh point identifiers shifted after deletion" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Test passed." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,99 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkCompensatedSummationArray.h"
+#include "itkMultiThreaderBase.h"
+#include "itkMath.h"
+
+#include <iostream>
+#include <vector>
+
+int
+itkCompensatedSummationArrayTest(int, char *[])
+{
+  bool testPassed = true;
+
+  using SummationArrayType = itk::CompensatedSummationArray<float, 8>;
+
+  // An ill-conditioned series: the naive float sum of many small elements
+  // after a large one loses them entirely, the compensated lanes must not.
+  constexpr itk::SizeValueType count = 1000000;
+  const float                  smallElement = 1e-7f;
+  std::vector<float>           values(count, smallElement);
+  values[0] = 1.0f;
+
+  SummationArrayType accumulator;
+  accumulator.AddSpan(values.data(), count);
+  const double expected = 1.0 + static_cast<double>(count - 1) * static_cast<double>(smallElement);
+  if (itk::Math::abs(accumulator.GetSum() - expected) > 1e-4)
+  {
+    std::cerr << "AddSpan lost precision: " << accumulator.GetSum() << " != " << expected << std::endl;
+    testPassed = false;
+  }
+
+  // AddElement rotation must reach the same total as AddSpan.
+  SummationArrayType elementwise;
+  for (itk::SizeValueType i = 0; i < count; ++i)
+  {
+    elementwise.AddElement(values[i]);
+  }
+  if (itk::Math::NotAlmostEquals(elementwise.GetSum(), accumulator.GetSum()))
+  {
+    std::cerr << "AddElement total deviates from AddSpan total: " << elementwise.GetSum()
+              << " != " << accumulator.GetSum() << std::endl;
+    testPassed = false;
+  }
+
+  // Lane-wise merge: two halves merged must match the whole.
+  SummationArrayType firstHalf;
+  SummationArrayType secondHalf;
+  firstHalf.AddSpan(values.data(), count / 2);
+  secondHalf.AddSpan(values.data() + count / 2, count - count / 2);
+  firstHalf += secondHalf;
+  if (itk::Math::abs(firstHalf.GetSum() - expected) > 1e-4)
+  {
+    std::cerr << "Merged halves lost precision: " << firstHalf.GetSum() << " != " << expected << std::endl;
+    testPassed = false;
+  }
+
+  // The threaded reduction must agree with the single-threaded one.
+  itk::MultiThreaderBase::Pointer threader = itk::MultiThreaderBase::New();
+  const double parallelSum = SummationArrayType::ParallelSum(values.data(), count, threader);
+  if (itk::Math::abs(parallelSum - expected) > 1e-4)
+  {
+    std::cerr << "ParallelSum lost precision: " << parallelSum << " != " << expected << std::endl;
+    testPassed = false;
+  }
+
+  // ResetToZero must clear both sums and compensations.
+  accumulator.ResetToZero();
+  if (itk::Math::NotExactlyEquals(accumulator.GetSum(), 0.0))
+  {
+    std::cerr << "ResetToZero left a residue: " << accumulator.GetSum() << std::endl;
+    testPassed = false;
+  }
+
+  if (!testPassed)
+  {
+    std::cerr << "Test failed." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Test passed." << std::endl;
+  return EXIT_SUCCESS;
+}
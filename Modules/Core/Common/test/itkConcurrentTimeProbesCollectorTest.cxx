@@ -0,0 +1,163 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkConcurrentTimeProbesCollector.h"
+#include "itkMacro.h"
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+const itk::ConcurrentTimeProbesCollector::ProbeRecord *
+FindRecord(const std::vector<itk::ConcurrentTimeProbesCollector::ProbeRecord> & records, const std::string & path)
+{
+  const auto it = std::find_if(records.begin(), records.end(), [&path](const auto & record) {
+    return record.Path == path;
+  });
+  return it == records.end() ? nullptr : &*it;
+}
+} // namespace
+
+int
+itkConcurrentTimeProbesCollectorTest(int, char *[])
+{
+  itk::ConcurrentTimeProbesCollector collector;
+
+  // Nested probes build hierarchical paths
+  collector.Start("filter");
+  collector.Start("stage");
+  collector.Start("work-unit");
+  collector.Stop("work-unit");
+  collector.Stop("stage");
+  collector.Stop("filter");
+
+  // Stopping a probe out of nesting order must throw
+  collector.Start("filter");
+  collector.Start("stage");
+  bool caught = false;
+  try
+  {
+    collector.Stop("filter");
+  }
+  catch (const itk::ExceptionObject &)
+  {
+    caught = true;
+  }
+  if (!caught)
+  {
+    std::cerr << "Stopping an outer probe before its nested probe should throw" << std::endl;
+    return EXIT_FAILURE;
+  }
+  collector.Stop("stage");
+  collector.Stop("filter");
+
+  // Concurrent probes from several threads are kept apart and aggregated
+  constexpr unsigned int   numberOfThreads = 4;
+  constexpr unsigned int   probesPerThread = 25;
+  std::vector<std::thread> threads;
+  for (unsigned int t = 0; t < numberOfThreads; ++t)
+  {
+    threads.emplace_back([&collector]() {
+      for (unsigned int i = 0; i < probesPerThread; ++i)
+      {
+        collector.Start("filter");
+        collector.Start("work-unit");
+        collector.Stop("work-unit");
+        collector.Stop("filter");
+      }
+    });
+  }
+  for (std::thread & thread : threads)
+  {
+    thread.join();
+  }
+
+  std::vector<itk::ConcurrentTimeProbesCollector::ProbeRecord> records = collector.GetProbeRecords();
+  const auto * filterRecord = FindRecord(records, "filter");
+  const auto * workUnitRecord = FindRecord(records, "filter/work-unit");
+  const auto * stageRecord = FindRecord(records, "filter/stage");
+  if (!filterRecord || !workUnitRecord || !stageRecord)
+  {
+    std::cerr << "Expected hierarchical paths are missing from the records" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (filterRecord->Count != numberOfThreads * probesPerThread + 2 ||
+      workUnitRecord->Count != numberOfThreads * probesPerThread)
+  {
+    std::cerr << "Unexpected probe counts: " << filterRecord->Count << " and " << workUnitRecord->Count << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (filterRecord->MinSeconds < 0.0 || filterRecord->MinSeconds > filterRecord->MaxSeconds ||
+      filterRecord->TotalSeconds < filterRecord->MaxSeconds)
+  {
+    std::cerr << "Inconsistent probe timing aggregates" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // A binary dump merged into a fresh collector reproduces the records
+  std::stringstream dump;
+  collector.DumpBinary(dump);
+
+  itk::ConcurrentTimeProbesCollector merged;
+  merged.MergeBinary(dump);
+  dump.clear();
+  dump.seekg(0);
+  merged.MergeBinary(dump); // merging twice doubles the counts
+
+  std::vector<itk::ConcurrentTimeProbesCollector::ProbeRecord> mergedRecords = merged.GetProbeRecords();
+  const auto * mergedFilterRecord = FindRecord(mergedRecords, "filter");
+  if (mergedRecords.size() != records.size() || !mergedFilterRecord ||
+      mergedFilterRecord->Count != 2 * filterRecord->Count ||
+      mergedFilterRecord->MaxSeconds != filterRecord->MaxSeconds)
+  {
+    std::cerr << "Merging the binary dump did not reproduce the records" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // A stream without the probe magic is rejected
+  std::stringstream bogus("not a probe dump");
+  caught = false;
+  try
+  {
+    merged.MergeBinary(bogus);
+  }
+  catch (const itk::ExceptionObject &)
+  {
+    caught = true;
+  }
+  if (!caught)
+  {
+    std::cerr << "Merging a stream without the probe magic should throw" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  merged.Report(std::cout);
+
+  collector.Clear();
+  if (!collector.GetProbeRecords().empty())
+  {
+    std::cerr << "Clear() left records behind" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
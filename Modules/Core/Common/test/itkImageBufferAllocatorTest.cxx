@@ -0,0 +1,130 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include <iostream>
+#include "itkImageBufferAllocator.h"
+#include "itkImportImageContainer.h"
+#include "itkImage.h"
+
+namespace
+{
+// An allocator that counts its allocations and deallocations.
+class CountingAllocator : public itk::ImageBufferAllocator<float>
+{
+public:
+  using Self = CountingAllocator;
+  using Superclass = itk::ImageBufferAllocator<float>;
+  using Pointer = itk::SmartPointer<Self>;
+
+  itkNewMacro(Self);
+  itkTypeMacro(CountingAllocator, ImageBufferAllocator);
+
+  float *
+  Allocate(itk::SizeValueType size, bool UseDefaultConstructor) override
+  {
+    ++m_AllocationCount;
+    return Superclass::Allocate(size, UseDefaultConstructor);
+  }
+
+  void
+  Deallocate(float * buffer, itk::SizeValueType size) override
+  {
+    ++m_DeallocationCount;
+    Superclass::Deallocate(buffer, size);
+  }
+
+  unsigned int m_AllocationCount{ 0 };
+  unsigned int m_DeallocationCount{ 0 };
+
+protected:
+  CountingAllocator() = default;
+};
+} // namespace
+
+int
+itkImageBufferAllocatorTest(int, char *[])
+{
+  using ContainerType = itk::ImportImageContainer<unsigned long, float>;
+
+  auto allocator = CountingAllocator::New();
+
+  { // Reserve and release through the allocator
+    auto container = ContainerType::New();
+    container->SetAllocator(allocator);
+    container->Reserve(1000);
+    if (allocator->m_AllocationCount != 1)
+    {
+      std::cerr << "Error: Reserve did not use the installed allocator." << std::endl;
+      return EXIT_FAILURE;
+    }
+    container->Reserve(2000); // growth reallocates through the allocator
+    container->Squeeze();
+  }
+  if (allocator->m_AllocationCount != allocator->m_DeallocationCount)
+  {
+    std::cerr << "Error: allocation/deallocation mismatch: " << allocator->m_AllocationCount << " vs "
+              << allocator->m_DeallocationCount << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  { // The buffer stays paired with the allocator that produced it
+    auto container = ContainerType::New();
+    container->SetAllocator(allocator);
+    container->Reserve(100);
+    container->SetAllocator(nullptr);
+    container->Initialize(); // must release through the counting allocator
+    if (allocator->m_AllocationCount != allocator->m_DeallocationCount)
+    {
+      std::cerr << "Error: buffer was not released through its own allocator." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  { // An imported pointer is never released through the allocator
+    auto               container = ContainerType::New();
+    const unsigned int deallocationsBefore = allocator->m_DeallocationCount;
+    auto *             external = new float[10];
+    container->SetAllocator(allocator);
+    container->SetImportPointer(external, 10, true);
+    container->Initialize();
+    if (allocator->m_DeallocationCount != deallocationsBefore)
+    {
+      std::cerr << "Error: imported pointer was released through the allocator." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  { // Image::Allocate goes through the container's allocator
+    using ImageType = itk::Image<float, 2>;
+    auto image = ImageType::New();
+    image->GetPixelContainer()->SetAllocator(allocator);
+    ImageType::RegionType region;
+    region.SetSize({ { 16, 16 } });
+    image->SetRegions(region);
+    const unsigned int allocationsBefore = allocator->m_AllocationCount;
+    image->Allocate();
+    if (allocator->m_AllocationCount != allocationsBefore + 1)
+    {
+      std::cerr << "Error: Image::Allocate did not use the installed allocator." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  std::cout << "Test passed." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -290,6 +290,82 @@ itkImageDuplicatorTest(int, char *[])
   }
 
 
+  {
+    /** Test the copy-on-write mode */
+    std::cout << "Testing duplicator with copy-on-write: ";
+
+    auto m_Image = ImageType::New();
+    m_Image->SetRegions(region);
+    m_Image->Allocate();
+
+    itk::ImageRegionIterator<ImageType> it(m_Image, region);
+    float                               i = 0;
+    for (it.GoToBegin(); !it.IsAtEnd(); ++it)
+    {
+      it.Set(i);
+      i++;
+    }
+
+    using DuplicatorType = itk::ImageDuplicator<ImageType>;
+    auto duplicator = DuplicatorType::New();
+
+    duplicator->UseCopyOnWriteOn();
+    ITK_TEST_SET_GET_VALUE(true, duplicator->GetUseCopyOnWrite());
+
+    duplicator->SetInputImage(m_Image);
+    duplicator->Update();
+
+    // Read-only access: the duplicate shares the input's pixel container.
+    const DuplicatorType * constDuplicator = duplicator;
+    const ImageType *      constImageCopy = constDuplicator->GetOutput();
+    if (constImageCopy->GetPixelContainer() != m_Image->GetPixelContainer())
+    {
+      std::cout << "Error: The copy-on-write duplicate does not share the input's pixel container" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    // Writable access: the duplicate gets a private copy of the buffer, on
+    // the same image object.
+    ImageType::Pointer ImageCopy = duplicator->GetOutput();
+    if (ImageCopy.GetPointer() != constImageCopy)
+    {
+      std::cout << "Error: Writable access replaced the duplicate image object" << std::endl;
+      return EXIT_FAILURE;
+    }
+    if (ImageCopy->GetPixelContainer() == m_Image->GetPixelContainer())
+    {
+      std::cout << "Error: The writable duplicate still shares the input's pixel container" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    // Modifying the writable duplicate must leave the input untouched.
+    ImageType::IndexType firstIndex;
+    firstIndex.Fill(0);
+    ImageCopy->SetPixel(firstIndex, -1.0f);
+    if (itk::Math::NotAlmostEquals(m_Image->GetPixel(firstIndex), 0.0f))
+    {
+      std::cout << "Error: Modifying the writable duplicate changed the input" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    itk::ImageRegionIterator<ImageType> it2(ImageCopy, ImageCopy->GetLargestPossibleRegion());
+    it2.GoToBegin();
+    ++it2; // skip the modified pixel
+    i = 1;
+    while (!it2.IsAtEnd())
+    {
+      if (itk::Math::NotAlmostEquals(it2.Get(), i))
+      {
+        std::cout << "Error: Pixel value mismatched: " << it2.Get() << " vs. " << i << std::endl;
+        return EXIT_FAILURE;
+      }
+      i++;
+      ++it2;
+    }
+
+    std::cout << "[DONE]" << std::endl;
+  }
+
   std::cout << "Test finished" << std::endl;
   return EXIT_SUCCESS;
 }
@@ -0,0 +1,109 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkImageNeighborhoodOffsetTableCache.h"
+
+#include <iostream>
+
+int
+itkImageNeighborhoodOffsetTableCacheTest(int, char *[])
+{
+  bool testPassed = true;
+
+  // Cached connected offsets must match freshly generated ones, and a second
+  // lookup with the same key must return the same cached instance.
+  {
+    const auto & cached = itk::GetCachedConnectedImageNeighborhoodOffsets<3>(1, false);
+    const itk::ConnectedImageNeighborhoodShape<3> shape{ 1, false };
+    if (cached != itk::GenerateImageNeighborhoodOffsets(shape))
+    {
+      std::cerr << "Cached connected offsets differ from generated ones" << std::endl;
+      testPassed = false;
+    }
+    if (&cached != &itk::GetCachedConnectedImageNeighborhoodOffsets<3>(1, false))
+    {
+      std::cerr << "Second connected lookup did not hit the cache" << std::endl;
+      testPassed = false;
+    }
+    if (&cached == &itk::GetCachedConnectedImageNeighborhoodOffsets<3>(1, true))
+    {
+      std::cerr << "Different keys returned the same cached table" << std::endl;
+      testPassed = false;
+    }
+  }
+
+  // Same for the rectangular offsets.
+  {
+    const itk::Size<2> radius = { { 2, 1 } };
+    const auto &       cached = itk::GetCachedRectangularImageNeighborhoodOffsets(radius);
+    if (cached != itk::GenerateRectangularImageNeighborhoodOffsets(radius))
+    {
+      std::cerr << "Cached rectangular offsets differ from generated ones" << std::endl;
+      testPassed = false;
+    }
+    if (&cached != &itk::GetCachedRectangularImageNeighborhoodOffsets(radius))
+    {
+      std::cerr << "Second rectangular lookup did not hit the cache" << std::endl;
+      testPassed = false;
+    }
+  }
+
+  // The buffer offset table must map each neighborhood offset through the
+  // strides, and repeated lookups must hit the cache.
+  {
+    const itk::Size<3>          radius = { { 1, 1, 1 } };
+    const auto &                offsets = itk::GetCachedRectangularImageNeighborhoodOffsets(radius);
+    const itk::OffsetValueType  strides[3] = { 1, 100, 10000 };
+    const auto &                table = itk::GetCachedImageNeighborhoodOffsetTable(offsets, strides);
+    if (table.size() != offsets.size())
+    {
+      std::cerr << "Offset table has wrong size" << std::endl;
+      testPassed = false;
+    }
+    for (std::size_t i = 0; i < offsets.size(); ++i)
+    {
+      const itk::OffsetValueType expected =
+        offsets[i][0] * strides[0] + offsets[i][1] * strides[1] + offsets[i][2] * strides[2];
+      if (table[i] != expected)
+      {
+        std::cerr << "Offset table entry " << i << " is " << table[i] << ", expected " << expected << std::endl;
+        testPassed = false;
+      }
+    }
+    if (&table != &itk::GetCachedImageNeighborhoodOffsetTable(offsets, strides))
+    {
+      std::cerr << "Second table lookup did not hit the cache" << std::endl;
+      testPassed = false;
+    }
+    const itk::OffsetValueType otherStrides[3] = { 1, 200, 40000 };
+    if (&table == &itk::GetCachedImageNeighborhoodOffsetTable(offsets, otherStrides))
+    {
+      std::cerr << "Different strides returned the same cached table" << std::endl;
+      testPassed = false;
+    }
+  }
+
+  if (!testPassed)
+  {
+    std::cerr << "Test failed." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Test passed." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,124 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include <iostream>
+
+#include "itkImage.h"
+#include "itkImagePhysicalPointStepper.h"
+#include "itkImageScanlineIterator.h"
+#include "itkMath.h"
+
+/* Checks that scanline-incremental physical points agree with the exact
+ * per-index transform on a grid with a rotated direction matrix. */
+
+int
+itkImagePhysicalPointStepperTest(int, char *[])
+{
+  constexpr unsigned int Dimension = 2;
+  using ImageType = itk::Image<unsigned char, Dimension>;
+  using StepperType = itk::ImagePhysicalPointStepper<ImageType>;
+  using PointType = StepperType::PointType;
+
+  ImageType::SizeType size = { { 17, 11 } };
+
+  ImageType::IndexType startIndex;
+  startIndex[0] = -3;
+  startIndex[1] = 5;
+
+  ImageType::SpacingType spacing;
+  spacing[0] = 0.25;
+  spacing[1] = 1.5;
+
+  ImageType::PointType origin;
+  origin[0] = -7.0;
+  origin[1] = 11.0;
+
+  const double             angle = 0.3;
+  ImageType::DirectionType direction;
+  direction[0][0] = std::cos(angle);
+  direction[0][1] = -std::sin(angle);
+  direction[1][0] = std::sin(angle);
+  direction[1][1] = std::cos(angle);
+
+  auto image = ImageType::New();
+  image->SetRegions(ImageType::RegionType(startIndex, size));
+  image->SetSpacing(spacing);
+  image->SetOrigin(origin);
+  image->SetDirection(direction);
+  image->Allocate(true);
+
+  StepperType stepper(image);
+
+  // The step vectors are the physical displacements between grid neighbors
+  for (unsigned int d = 0; d < Dimension; ++d)
+  {
+    ImageType::IndexType steppedIndex = startIndex;
+    ++steppedIndex[d];
+    const PointType basePoint = image->TransformIndexToPhysicalPoint<double>(startIndex);
+    const PointType steppedPoint = image->TransformIndexToPhysicalPoint<double>(steppedIndex);
+    for (unsigned int j = 0; j < Dimension; ++j)
+    {
+      if (itk::Math::NotAlmostEquals(stepper.GetStep(d)[j], steppedPoint[j] - basePoint[j]))
+      {
+        std::cout << "Test failed! Step vector " << d << " is " << stepper.GetStep(d) << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  // Walking scanlines must reproduce the exact per-index transform up to
+  // the accumulation rounding of at most one scanline of steps
+  constexpr double tolerance = 1e-10;
+
+  itk::ImageScanlineIterator<ImageType> it(image, image->GetLargestPossibleRegion());
+  while (!it.IsAtEnd())
+  {
+    stepper.SetIndex(it.GetIndex());
+    while (!it.IsAtEndOfLine())
+    {
+      const PointType exactPoint = image->TransformIndexToPhysicalPoint<double>(it.GetIndex());
+      if (exactPoint.EuclideanDistanceTo(stepper.GetPoint()) > tolerance)
+      {
+        std::cout << "Test failed! At " << it.GetIndex() << " stepper gives " << stepper.GetPoint() << " instead of "
+                  << exactPoint << std::endl;
+        return EXIT_FAILURE;
+      }
+      stepper.MoveAlongDimension(0);
+      ++it;
+    }
+    it.NextLine();
+  }
+
+  // SetIndex re-anchors exactly
+  ImageType::IndexType index;
+  index[0] = 4;
+  index[1] = 9;
+  stepper.SetIndex(index);
+  const PointType exactPoint = image->TransformIndexToPhysicalPoint<double>(index);
+  for (unsigned int j = 0; j < Dimension; ++j)
+  {
+    if (itk::Math::NotExactlyEquals(stepper.GetPoint()[j], exactPoint[j]))
+    {
+      std::cout << "Test failed! SetIndex gives " << stepper.GetPoint() << " instead of " << exactPoint << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,108 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkImageRegionSplitterTile.h"
+#include "itkImageRegion.h"
+
+#include <iostream>
+#include <vector>
+
+int
+itkImageRegionSplitterTileTest(int, char *[])
+{
+  bool testPassed = true;
+
+  itk::ImageRegionSplitterTile::Pointer splitter = itk::ImageRegionSplitterTile::New();
+  splitter->SetOverlapRadius(4);
+  if (splitter->GetOverlapRadius() != 4)
+  {
+    std::cerr << "OverlapRadius not stored" << std::endl;
+    testPassed = false;
+  }
+
+  using RegionType = itk::ImageRegion<3>;
+  RegionType region;
+  region.SetIndex({ { 3, -1, 10 } });
+  region.SetSize({ { 100, 80, 60 } });
+
+  const unsigned int requestedNumber = 16;
+  const unsigned int numberOfSplits = splitter->GetNumberOfSplits(region, requestedNumber);
+  if (numberOfSplits == 0 || numberOfSplits > requestedNumber)
+  {
+    std::cerr << "Unexpected number of splits: " << numberOfSplits << std::endl;
+    testPassed = false;
+  }
+
+  // The split regions must tile the region exactly: every pixel covered
+  // once, no piece thinner than the two-sided halo.
+  std::vector<RegionType>   pieces(numberOfSplits);
+  itk::SizeValueType        coveredPixels = 0;
+  const itk::SizeValueType  minimumThickness = 2 * splitter->GetOverlapRadius() + 1;
+  for (unsigned int i = 0; i < numberOfSplits; ++i)
+  {
+    pieces[i] = region;
+    splitter->GetSplit(i, numberOfSplits, pieces[i]);
+    if (!region.IsInside(pieces[i]))
+    {
+      std::cerr << "Piece " << i << " is not inside the region" << std::endl;
+      testPassed = false;
+    }
+    coveredPixels += pieces[i].GetNumberOfPixels();
+    for (unsigned int d = 0; d < 3; ++d)
+    {
+      if (pieces[i].GetSize(d) < minimumThickness)
+      {
+        std::cerr << "Piece " << i << " is thinner than the halo along dimension " << d << std::endl;
+        testPassed = false;
+      }
+    }
+    for (unsigned int j = 0; j < i; ++j)
+    {
+      RegionType intersection = pieces[i];
+      if (intersection.Crop(pieces[j]) && intersection.GetNumberOfPixels() > 0)
+      {
+        std::cerr << "Pieces " << i << " and " << j << " overlap" << std::endl;
+        testPassed = false;
+      }
+    }
+  }
+  if (coveredPixels != region.GetNumberOfPixels())
+  {
+    std::cerr << "Pieces cover " << coveredPixels << " pixels, expected " << region.GetNumberOfPixels() << std::endl;
+    testPassed = false;
+  }
+
+  // With a huge halo nothing can be split.
+  splitter->SetOverlapRadius(100);
+  if (splitter->GetNumberOfSplits(region, requestedNumber) != 1)
+  {
+    std::cerr << "Expected a single piece when the halo exceeds every dimension" << std::endl;
+    testPassed = false;
+  }
+
+  splitter->Print(std::cout);
+
+  if (!testPassed)
+  {
+    std::cerr << "Test failed." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Test passed." << std::endl;
+  return EXIT_SUCCESS;
+}
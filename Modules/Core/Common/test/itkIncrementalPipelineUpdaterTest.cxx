@@ -0,0 +1,178 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkIncrementalPipelineUpdater.h"
+#include "itkImageToImageFilter.h"
+#include "itkConstNeighborhoodIterator.h"
+#include "itkImageRegionIterator.h"
+#include "itkZeroFluxNeumannBoundaryCondition.h"
+#include "itkPipelineMonitorImageFilter.h"
+
+#include <iostream>
+
+namespace
+{
+
+// A minimal local filter with one pixel of kernel support: each output
+// pixel is the sum over the 3x3 neighborhood.
+template <typename TImage>
+class NeighborhoodSumTestFilter : public itk::ImageToImageFilter<TImage, TImage>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(NeighborhoodSumTestFilter);
+
+  using Self = NeighborhoodSumTestFilter;
+  using Superclass = itk::ImageToImageFilter<TImage, TImage>;
+  using Pointer = itk::SmartPointer<Self>;
+
+  itkNewMacro(Self);
+  itkTypeMacro(NeighborhoodSumTestFilter, ImageToImageFilter);
+
+  using RegionType = typename TImage::RegionType;
+
+protected:
+  NeighborhoodSumTestFilter() { this->DynamicMultiThreadingOn(); }
+
+  void
+  GenerateInputRequestedRegion() override
+  {
+    Superclass::GenerateInputRequestedRegion();
+    auto * input = const_cast<TImage *>(this->GetInput());
+    if (input)
+    {
+      RegionType inputRegion = this->GetOutput()->GetRequestedRegion();
+      inputRegion.PadByRadius(1);
+      inputRegion.Crop(input->GetLargestPossibleRegion());
+      input->SetRequestedRegion(inputRegion);
+    }
+  }
+
+  void
+  DynamicThreadedGenerateData(const RegionType & outputRegionForThread) override
+  {
+    typename TImage::SizeType radius;
+    radius.Fill(1);
+    itk::ConstNeighborhoodIterator<TImage, itk::ZeroFluxNeumannBoundaryCondition<TImage>> inputIterator(
+      radius, this->GetInput(), outputRegionForThread);
+    itk::ImageRegionIterator<TImage> outputIterator(this->GetOutput(), outputRegionForThread);
+    for (; !outputIterator.IsAtEnd(); ++inputIterator, ++outputIterator)
+    {
+      typename TImage::PixelType sum = 0;
+      for (unsigned int i = 0; i < inputIterator.Size(); ++i)
+      {
+        sum += inputIterator.GetPixel(i);
+      }
+      outputIterator.Set(sum);
+    }
+  }
+};
+
+} // namespace
+
+int
+itkIncrementalPipelineUpdaterTest(int, char *[])
+{
+  bool testPassed = true;
+
+  using ImageType = itk::Image<float, 2>;
+
+  auto                  image = ImageType::New();
+  ImageType::SizeType   size = { { 64, 64 } };
+  ImageType::RegionType region(size);
+  image->SetRegions(region);
+  image->Allocate();
+  image->FillBuffer(1.0f);
+
+  auto filter = NeighborhoodSumTestFilter<ImageType>::New();
+  filter->SetInput(image);
+
+  itk::PipelineMonitorImageFilter<ImageType>::Pointer monitor = itk::PipelineMonitorImageFilter<ImageType>::New();
+  monitor->SetInput(filter->GetOutput());
+
+  using UpdaterType = itk::IncrementalPipelineUpdater<ImageType, ImageType>;
+  auto updater = UpdaterType::New();
+  updater->SetInputImage(image);
+  updater->SetPipelineOutput(monitor->GetOutput());
+  updater->Print(std::cout);
+
+  updater->UpdateLargestPossibleRegion();
+  if (updater->GetOutput()->GetPixel({ { 30, 30 } }) != 9.0f)
+  {
+    std::cerr << "Full update produced a wrong interior value" << std::endl;
+    testPassed = false;
+  }
+
+  // Edit a 4x4 block and recompute incrementally.
+  ImageType::RegionType changedRegion;
+  changedRegion.SetIndex({ { 10, 10 } });
+  changedRegion.SetSize({ { 4, 4 } });
+  itk::ImageRegionIterator<ImageType> editIterator(image, changedRegion);
+  for (; !editIterator.IsAtEnd(); ++editIterator)
+  {
+    editIterator.Set(2.0f);
+  }
+  image->Modified();
+  monitor->ClearPipelineSavedInformation();
+
+  updater->UpdateChangedRegion(changedRegion);
+
+  // Only the changed region plus one pixel of kernel support may have
+  // been recomputed.
+  ImageType::RegionType expectedRegion;
+  expectedRegion.SetIndex({ { 9, 9 } });
+  expectedRegion.SetSize({ { 6, 6 } });
+  if (monitor->GetUpdatedBufferedRegions().empty() || monitor->GetUpdatedBufferedRegions().back() != expectedRegion)
+  {
+    std::cout << monitor;
+    std::cerr << "Incremental update did not recompute the expected region " << expectedRegion << std::endl;
+    testPassed = false;
+  }
+
+  // The canvas must match a from-scratch recomputation everywhere.
+  auto referenceFilter = NeighborhoodSumTestFilter<ImageType>::New();
+  referenceFilter->SetInput(image);
+  referenceFilter->Update();
+
+  itk::ImageRegionIterator<ImageType> referenceIterator(referenceFilter->GetOutput(), region);
+  itk::ImageRegionIterator<ImageType> canvasIterator(updater->GetOutput(), region);
+  for (; !referenceIterator.IsAtEnd(); ++referenceIterator, ++canvasIterator)
+  {
+    if (canvasIterator.Get() != referenceIterator.Get())
+    {
+      std::cerr << "Canvas mismatch at " << canvasIterator.GetIndex() << ": " << canvasIterator.Get() << " vs "
+                << referenceIterator.Get() << std::endl;
+      testPassed = false;
+      break;
+    }
+  }
+
+  // An edit outside the grid must be a no-op.
+  ImageType::RegionType outsideRegion;
+  outsideRegion.SetIndex({ { 100, 100 } });
+  outsideRegion.SetSize({ { 4, 4 } });
+  updater->UpdateChangedRegion(outsideRegion);
+
+  if (!testPassed)
+  {
+    std::cerr << "Test failed." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Test passed." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -302,3 +302,33 @@ TEST(MetaDataDictionary, Equal)
   expectUnequal(metaDataDictionary1, defaultMetaDataDictionary);
   expectUnequal(metaDataDictionary2, defaultMetaDataDictionary);
 }
+
+TEST(MetaDataDictionary, EncapsulateReusesExclusiveEntry)
+{
+  itk::MetaDataDictionary       dictionary;
+  const itk::MetaDataDictionary & constDictionary = dictionary;
+
+  itk::EncapsulateMetaData<double>(dictionary, "key", 1.0);
+  const itk::MetaDataObjectBase * const firstEntry = constDictionary["key"];
+
+  // re-encapsulating the same type into an exclusively owned entry
+  // updates it in place
+  itk::EncapsulateMetaData<double>(dictionary, "key", 2.0);
+  EXPECT_EQ(constDictionary["key"], firstEntry);
+  double value = 0.0;
+  EXPECT_TRUE(itk::ExposeMetaData<double>(dictionary, "key", value));
+  EXPECT_EQ(value, 2.0);
+
+  // a different type replaces the entry
+  itk::EncapsulateMetaData<int>(dictionary, "key", 3);
+  EXPECT_NE(constDictionary["key"], firstEntry);
+
+  // an entry shared with a copied dictionary must not be mutated
+  itk::EncapsulateMetaData<double>(dictionary, "key", 4.0);
+  const itk::MetaDataDictionary copiedDictionary = dictionary;
+  itk::EncapsulateMetaData<double>(dictionary, "key", 5.0);
+  EXPECT_TRUE(itk::ExposeMetaData<double>(dictionary, "key", value));
+  EXPECT_EQ(value, 5.0);
+  EXPECT_TRUE(itk::ExposeMetaData<double>(copiedDictionary, "key", value));
+  EXPECT_EQ(value, 4.0);
+}
@@ -0,0 +1,124 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkMortonOrder.h"
+
+#include <iostream>
+#include <vector>
+
+int
+itkMortonOrderTest(int, char *[])
+{
+  bool testPassed = true;
+
+  // Encode/decode round trip over a 3-D block, and uniqueness of the codes
+  // within the padded cube.
+  {
+    constexpr itk::SizeValueType extent = 16;
+    std::vector<bool>            seen(extent * extent * extent, false);
+    for (uint64_t z = 0; z < extent; ++z)
+    {
+      for (uint64_t y = 0; y < extent; ++y)
+      {
+        for (uint64_t x = 0; x < extent; ++x)
+        {
+          const uint64_t code = itk::MortonOrder::EncodeIndex(x, y, z);
+          if (code >= seen.size() || seen[code])
+          {
+            std::cerr << "Code " << code << " out of range or duplicated" << std::endl;
+            testPassed = false;
+            continue;
+          }
+          seen[code] = true;
+
+          uint64_t dx;
+          uint64_t dy;
+          uint64_t dz;
+          itk::MortonOrder::DecodeIndex(code, dx, dy, dz);
+          if (dx != x || dy != y || dz != z)
+          {
+            std::cerr << "Decode mismatch for (" << x << ", " << y << ", " << z << ")" << std::endl;
+            testPassed = false;
+          }
+        }
+      }
+    }
+  }
+
+  // 2-D encode/decode round trip with large coordinates.
+  {
+    const uint64_t x = 123456;
+    const uint64_t y = 654321;
+    uint64_t       dx;
+    uint64_t       dy;
+    itk::MortonOrder::DecodeIndex(itk::MortonOrder::EncodeIndex(x, y), dx, dy);
+    if (dx != x || dy != y)
+    {
+      std::cerr << "2-D decode mismatch" << std::endl;
+      testPassed = false;
+    }
+  }
+
+  // Layout round trip on a non-cubic, non-power-of-two 3-D buffer.
+  {
+    const itk::Size<3> size = { { 7, 5, 3 } };
+
+    const itk::SizeValueType numberOfPixels = size[0] * size[1] * size[2];
+    const itk::SizeValueType bufferLength = itk::MortonOrder::ComputeBufferLength(size);
+    if (bufferLength != 8 * 8 * 8)
+    {
+      std::cerr << "Unexpected Morton buffer length: " << bufferLength << std::endl;
+      testPassed = false;
+    }
+
+    std::vector<int> linear(numberOfPixels);
+    for (itk::SizeValueType i = 0; i < numberOfPixels; ++i)
+    {
+      linear[i] = static_cast<int>(i) + 1;
+    }
+
+    std::vector<int> morton(bufferLength, 0);
+    itk::MortonOrder::CopyToMortonLayout(linear.data(), size, morton.data());
+
+    // Spot-check addressing through EncodeIndex.
+    const uint64_t code = itk::MortonOrder::EncodeIndex(3, 2, 1);
+    const int      expected = linear[3 + size[0] * (2 + size[1] * 1)];
+    if (morton[code] != expected)
+    {
+      std::cerr << "Morton addressing mismatch: " << morton[code] << " != " << expected << std::endl;
+      testPassed = false;
+    }
+
+    std::vector<int> roundTrip(numberOfPixels, 0);
+    itk::MortonOrder::CopyFromMortonLayout(morton.data(), size, roundTrip.data());
+    if (roundTrip != linear)
+    {
+      std::cerr << "Layout round trip failed" << std::endl;
+      testPassed = false;
+    }
+  }
+
+  if (!testPassed)
+  {
+    std::cerr << "Test failed." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Test passed." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,179 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkVersion.h"
+#include "itkImage.h"
+#include <algorithm>
+#include <iostream>
+
+namespace
+{
+
+template <typename TPixel, unsigned int VImageDimension = 2>
+class DeferredTestImage : public itk::Image<TPixel, VImageDimension>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(DeferredTestImage);
+
+  using Self = DeferredTestImage;
+  using Superclass = itk::Image<TPixel, VImageDimension>;
+  using Pointer = itk::SmartPointer<Self>;
+  using ConstPointer = itk::SmartPointer<const Self>;
+
+  itkNewMacro(DeferredTestImage);
+
+  itkTypeMacro(DeferredTestImage, Image);
+
+protected:
+  ~DeferredTestImage() override = default;
+  DeferredTestImage() = default;
+};
+
+class DeferredTestFactory : public itk::ObjectFactoryBase
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(DeferredTestFactory);
+
+  using Self = DeferredTestFactory;
+  using Superclass = itk::ObjectFactoryBase;
+  using Pointer = itk::SmartPointer<Self>;
+  using ConstPointer = itk::SmartPointer<const Self>;
+
+  const char *
+  GetITKSourceVersion() const override
+  {
+    return ITK_SOURCE_VERSION;
+  }
+  const char *
+  GetDescription() const override
+  {
+    return "A deferred test factory";
+  }
+
+  itkFactorylessNewMacro(Self);
+
+  itkTypeMacro(DeferredTestFactory, itk::ObjectFactoryBase);
+
+  static bool m_Constructed;
+
+private:
+  DeferredTestFactory()
+  {
+    m_Constructed = true;
+    this->RegisterOverride(typeid(itk::Image<short, 2>).name(),
+                           typeid(DeferredTestImage<short, 2>).name(),
+                           "Deferred test image factory override",
+                           true,
+                           itk::CreateObjectFunction<DeferredTestImage<short, 2>>::New());
+  }
+};
+
+bool DeferredTestFactory::m_Constructed = false;
+
+// Registration function in the style of the generated
+// <factory>FactoryRegister__Private() functions
+void
+DeferredTestFactoryRegister()
+{
+  itk::ObjectFactoryBase::RegisterInternalFactoryOnce<DeferredTestFactory>();
+}
+
+const itk::ObjectFactoryBase::FactoryRegistrationRecord *
+FindRecord(const std::vector<itk::ObjectFactoryBase::FactoryRegistrationRecord> & records, const std::string & name)
+{
+  const auto it =
+    std::find_if(records.begin(), records.end(), [&name](const auto & record) { return record.Name == name; });
+  return it == records.end() ? nullptr : &*it;
+}
+
+} // namespace
+
+int
+itkObjectFactoryDeferredRegistrationTest(int, char *[])
+{
+  // Recording the descriptor must not construct the factory
+  itk::ObjectFactoryBase::DeferFactoryRegistration("DeferredTestFactory", &DeferredTestFactoryRegister);
+  // recording the same factory again from another translation unit is a no-op
+  itk::ObjectFactoryBase::DeferFactoryRegistration("DeferredTestFactory", &DeferredTestFactoryRegister);
+  if (DeferredTestFactory::m_Constructed)
+  {
+    std::cerr << "The deferred factory was constructed at registration time" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The audit reports the descriptor without triggering materialization
+  std::vector<itk::ObjectFactoryBase::FactoryRegistrationRecord> records =
+    itk::ObjectFactoryBase::GetFactoryRegistrationAudit();
+  const auto * record = FindRecord(records, "DeferredTestFactory");
+  if (!record || !record->Deferred || record->Materialized)
+  {
+    std::cerr << "The audit should report the deferred, unmaterialized descriptor" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (DeferredTestFactory::m_Constructed)
+  {
+    std::cerr << "The audit triggered materialization" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The first factory dispatch materializes the deferred factory
+  std::list<itk::ObjectFactoryBase *> factories = itk::ObjectFactoryBase::GetRegisteredFactories();
+  if (!DeferredTestFactory::m_Constructed)
+  {
+    std::cerr << "The factory dispatch did not materialize the deferred factory" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const bool registered = std::any_of(factories.begin(), factories.end(), [](const itk::ObjectFactoryBase * factory) {
+    return std::string(factory->GetNameOfClass()) == "DeferredTestFactory";
+  });
+  if (!registered)
+  {
+    std::cerr << "The materialized factory is not registered" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The materialized factory serves object creation like an eager one
+  itk::LightObject::Pointer overridden =
+    itk::ObjectFactoryBase::CreateInstance(typeid(itk::Image<short, 2>).name());
+  if (overridden.IsNull() || std::string(overridden->GetNameOfClass()) != "DeferredTestImage")
+  {
+    std::cerr << "The override of the materialized factory was not used" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The audit now carries the registration cost
+  records = itk::ObjectFactoryBase::GetFactoryRegistrationAudit();
+  record = FindRecord(records, "DeferredTestFactory");
+  if (!record || !record->Deferred || !record->Materialized || record->RegistrationSeconds < 0.0)
+  {
+    std::cerr << "The audit should report the materialized factory and its cost" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Registering the factory again, eagerly or deferred, is a no-op
+  itk::ObjectFactoryBase::RegisterInternalFactoryOnce<DeferredTestFactory>();
+  itk::ObjectFactoryBase::DeferFactoryRegistration("DeferredTestFactory", &DeferredTestFactoryRegister);
+  const std::list<itk::ObjectFactoryBase *> factoriesAfter = itk::ObjectFactoryBase::GetRegisteredFactories();
+  if (factoriesAfter.size() != factories.size())
+  {
+    std::cerr << "Registering the factory again changed the registration" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,74 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkObjectFactoryBase.h"
+#include "itkVersion.h"
+#include "itkTestingMacros.h"
+
+#include <fstream>
+#include <iostream>
+
+int
+itkObjectFactorySnapshotTest(int argc, char * argv[])
+{
+  if (argc < 2)
+  {
+    std::cerr << "Usage: " << itkNameOfTestExecutableMacro(argv) << " snapshotFile" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const std::string snapshotFile = argv[1];
+
+  // Capture the current registration.
+  ITK_TEST_EXPECT_TRUE(itk::ObjectFactoryBase::ExportFactorySnapshot(snapshotFile));
+  const size_t numberOfFactories = itk::ObjectFactoryBase::GetRegisteredFactories().size();
+
+  // The snapshot begins with the format header and the running version.
+  std::ifstream written(snapshotFile.c_str());
+  std::string   header;
+  std::getline(written, header);
+  ITK_TEST_EXPECT_EQUAL(header, "ITKFactorySnapshot 1");
+  std::string itkVersion;
+  std::getline(written, itkVersion);
+  ITK_TEST_EXPECT_EQUAL(itkVersion, std::string(itk::Version::GetITKSourceVersion()));
+  written.close();
+
+  // Restoring into an already initialized process must refuse and leave
+  // the registration alone.
+  ITK_TEST_EXPECT_TRUE(!itk::ObjectFactoryBase::RestoreFactorySnapshot(snapshotFile));
+  ITK_TEST_EXPECT_EQUAL(itk::ObjectFactoryBase::GetRegisteredFactories().size(), numberOfFactories);
+
+  // Simulate a fresh process: with the factories torn down, the snapshot
+  // rehydrates the same registration without a directory scan.
+  itk::ObjectFactoryBase::UnRegisterAllFactories();
+  ITK_TEST_EXPECT_TRUE(itk::ObjectFactoryBase::RestoreFactorySnapshot(snapshotFile));
+  ITK_TEST_EXPECT_EQUAL(itk::ObjectFactoryBase::GetRegisteredFactories().size(), numberOfFactories);
+
+  // A snapshot from another ITK version is stale and must be rejected,
+  // falling back on the normal initialization path.
+  itk::ObjectFactoryBase::UnRegisterAllFactories();
+  {
+    std::ofstream stale(snapshotFile.c_str());
+    stale << "ITKFactorySnapshot 1\n";
+    stale << "itk version 0.0.0\n";
+  }
+  ITK_TEST_EXPECT_TRUE(!itk::ObjectFactoryBase::RestoreFactorySnapshot(snapshotFile));
+  ITK_TEST_EXPECT_EQUAL(itk::ObjectFactoryBase::GetRegisteredFactories().size(), numberOfFactories);
+
+  std::cout << "Test passed." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,123 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkPipelineProfiler.h"
+#include "itkRandomImageSource.h"
+#include "itkShiftScaleImageFilter.h"
+
+#include <iostream>
+#include <sstream>
+#include <string>
+
+int
+itkPipelineProfilerTest(int, char *[])
+{
+  using ImageType = itk::Image<float, 2>;
+
+  auto source = itk::RandomImageSource<ImageType>::New();
+  ImageType::SizeType size;
+  size[0] = 32;
+  size[1] = 24;
+  source->SetSize(size);
+
+  auto filter = itk::ShiftScaleImageFilter<ImageType, ImageType>::New();
+  filter->SetInput(source->GetOutput());
+  filter->SetShift(1.0);
+  filter->SetObjectName("shift");
+
+  // Disabled by default: updating must record nothing
+  if (itk::PipelineProfiler::GetGlobalEnabled())
+  {
+    std::cerr << "Profiler expected to be disabled by default" << std::endl;
+    return EXIT_FAILURE;
+  }
+  filter->Update();
+  itk::PipelineProfiler::Clear();
+
+  // Enabled: one record per filter execution
+  itk::PipelineProfiler::SetGlobalEnabled(true);
+  source->Modified();
+  filter->Update();
+  itk::PipelineProfiler::SetGlobalEnabled(false);
+
+  const std::vector<itk::PipelineProfiler::FilterRun> runs = itk::PipelineProfiler::GetFilterRuns();
+  if (runs.size() != 2)
+  {
+    std::cerr << "Expected 2 recorded filter runs, got " << runs.size() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  const itk::SizeValueType expectedBytes = 32 * 24 * sizeof(float);
+  bool                     sourceSeen = false;
+  bool                     filterSeen = false;
+  for (const itk::PipelineProfiler::FilterRun & run : runs)
+  {
+    if (run.DurationSeconds < 0.0 || run.StartSeconds < 0.0)
+    {
+      std::cerr << "Run " << run.Name << " has a negative time" << std::endl;
+      return EXIT_FAILURE;
+    }
+    if (run.NumberOfWorkUnits == 0)
+    {
+      std::cerr << "Run " << run.Name << " reports no work units" << std::endl;
+      return EXIT_FAILURE;
+    }
+    if (run.OutputBytes != expectedBytes)
+    {
+      std::cerr << "Run " << run.Name << " reports " << run.OutputBytes << " output bytes instead of "
+                << expectedBytes << std::endl;
+      return EXIT_FAILURE;
+    }
+    if (run.Name.find("RandomImageSource") != std::string::npos)
+    {
+      sourceSeen = true;
+    }
+    if (run.Name.find("ShiftScaleImageFilter") != std::string::npos && run.Name.find("shift") != std::string::npos)
+    {
+      filterSeen = true;
+    }
+  }
+  if (!sourceSeen || !filterSeen)
+  {
+    std::cerr << "Recorded runs do not cover both pipeline filters" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The chrome-trace export must contain one complete event per run
+  std::ostringstream trace;
+  itk::PipelineProfiler::WriteChromeTraceJSON(trace);
+  const std::string traceString = trace.str();
+  if (traceString.find("traceEvents") == std::string::npos ||
+      traceString.find("RandomImageSource") == std::string::npos ||
+      traceString.find("ShiftScaleImageFilter") == std::string::npos ||
+      traceString.find("\"ph\": \"X\"") == std::string::npos)
+  {
+    std::cerr << "Unexpected chrome-trace output:" << std::endl << traceString << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Clear discards the recorded runs
+  itk::PipelineProfiler::Clear();
+  if (!itk::PipelineProfiler::GetFilterRuns().empty())
+  {
+    std::cerr << "Clear did not discard the recorded runs" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
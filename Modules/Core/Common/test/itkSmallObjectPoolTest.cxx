@@ -0,0 +1,108 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "itkSmallObjectPool.h"
+#include "itkLightObject.h"
+
+namespace
+{
+// A LightObject-derived class opting into the pool.
+class PooledObject : public itk::LightObject
+{
+public:
+  using Self = PooledObject;
+  using Pointer = itk::SmartPointer<Self>;
+
+  itkSmallObjectPoolAllocationMacro();
+  itkNewMacro(Self);
+  itkTypeMacro(PooledObject, LightObject);
+
+  double m_Payload[4]{};
+
+protected:
+  PooledObject() = default;
+};
+} // namespace
+
+int
+itkSmallObjectPoolTest(int, char *[])
+{
+  // Same-thread allocate/free cycles reuse pooled chunks.
+  void * first = itk::SmallObjectPool::Allocate(48);
+  std::memset(first, 0xAB, 48);
+  itk::SmallObjectPool::Deallocate(first);
+  void * second = itk::SmallObjectPool::Allocate(48);
+  if (second != first)
+  {
+    std::cerr << "Error: same-size chunk was not reused from the free list." << std::endl;
+    return EXIT_FAILURE;
+  }
+  itk::SmallObjectPool::Deallocate(second);
+
+  // Requests above the largest size class fall through to operator new.
+  void * big = itk::SmallObjectPool::Allocate(100000);
+  std::memset(big, 0, 100000);
+  itk::SmallObjectPool::Deallocate(big);
+
+  // Chunks may be freed from a different thread than the one that
+  // allocated them.
+  constexpr unsigned int count = 1000;
+  std::vector<void *>    chunks(count);
+  for (auto & chunk : chunks)
+  {
+    chunk = itk::SmallObjectPool::Allocate(64);
+  }
+  std::thread remoteFreer([&chunks] {
+    for (auto * chunk : chunks)
+    {
+      itk::SmallObjectPool::Deallocate(chunk);
+    }
+  });
+  remoteFreer.join();
+  // The owning thread reclaims remotely freed chunks on its next allocations.
+  for (auto & chunk : chunks)
+  {
+    chunk = itk::SmallObjectPool::Allocate(64);
+  }
+  for (auto * chunk : chunks)
+  {
+    itk::SmallObjectPool::Deallocate(chunk);
+  }
+
+  // Smart pointer lifecycle of a pooled LightObject subclass.
+  {
+    std::vector<PooledObject::Pointer> objects;
+    for (unsigned int i = 0; i < 100; ++i)
+    {
+      objects.push_back(PooledObject::New());
+      objects.back()->m_Payload[0] = i;
+    }
+    if (objects[99]->m_Payload[0] != 99.0)
+    {
+      std::cerr << "Error: pooled object payload corrupted." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  std::cout << "Test passed." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,122 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include <iostream>
+#include "itkShiftScaleImageFilter.h"
+#include "itkStreamingImageFilter.h"
+#include "itkPipelineMonitorImageFilter.h"
+
+int
+itkStreamingImageFilterMemoryLimitTest(int, char *[])
+{
+  // type alias to simplify the syntax
+  using FloatImage = itk::Image<float, 2>;
+
+  // fill in an image
+  auto                   image = FloatImage::New();
+  FloatImage::IndexType  index = { { 0, 0 } };
+  FloatImage::SizeType   size = { { 64, 64 } };
+  FloatImage::RegionType region;
+  region.SetSize(size);
+  region.SetIndex(index);
+  image->SetRegions(region);
+  image->Allocate();
+
+  itk::ImageRegionIterator<FloatImage> iterator(image, region);
+  float                                i = 0;
+  for (; !iterator.IsAtEnd(); ++iterator, ++i)
+  {
+    iterator.Set(i);
+  }
+
+  itk::ShiftScaleImageFilter<FloatImage, FloatImage>::Pointer shiftScale =
+    itk::ShiftScaleImageFilter<FloatImage, FloatImage>::New();
+  shiftScale->SetInput(image);
+  shiftScale->SetShift(1.0);
+
+  // monitor what's going on
+  itk::PipelineMonitorImageFilter<FloatImage>::Pointer monitor = itk::PipelineMonitorImageFilter<FloatImage>::New();
+  monitor->SetInput(shiftScale->GetOutput());
+
+  itk::StreamingImageFilter<FloatImage, FloatImage>::Pointer streamer =
+    itk::StreamingImageFilter<FloatImage, FloatImage>::New();
+  streamer->SetInput(monitor->GetOutput());
+
+  // Two upstream filter outputs of 4 bytes per pixel: a budget of 8192
+  // bytes allows at most 1024 pixels per division, i.e. 16 of the 64 rows,
+  // so the planner must select 4 divisions.
+  streamer->SetMemoryLimitInBytes(8192);
+  if (streamer->GetMemoryLimitInBytes() != 8192)
+  {
+    std::cout << "Set/GetMemoryLimitInBytes failed." << std::endl;
+    return EXIT_FAILURE;
+  }
+  streamer->Update();
+
+  if (monitor->GetNumberOfUpdates() != 4)
+  {
+    std::cout << monitor;
+    std::cout << "Expected 4 upstream updates but got " << monitor->GetNumberOfUpdates() << "." << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (const FloatImage::RegionType & bufferedRegion : monitor->GetUpdatedBufferedRegions())
+  {
+    if (bufferedRegion.GetNumberOfPixels() > 1024)
+    {
+      std::cout << "Division of " << bufferedRegion.GetNumberOfPixels() << " pixels exceeds the memory budget."
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // check that the streamed output matches the input plus the shift
+  bool                                 passed = true;
+  itk::ImageRegionIterator<FloatImage> inputIterator(image, region);
+  itk::ImageRegionIterator<FloatImage> outputIterator(streamer->GetOutput(), region);
+  for (; !outputIterator.IsAtEnd(); ++inputIterator, ++outputIterator)
+  {
+    if (outputIterator.Get() != inputIterator.Get() + 1.0f)
+    {
+      passed = false;
+      std::cout << "Pixel " << outputIterator.GetIndex() << " expected " << inputIterator.Get() + 1.0f << " but got "
+                << outputIterator.Get() << std::endl;
+    }
+  }
+
+  // a zero budget must fall back to the manual division count
+  streamer->SetMemoryLimitInBytes(0);
+  streamer->SetNumberOfStreamDivisions(2);
+  streamer->Modified();
+  monitor->ClearPipelineSavedInformation();
+  streamer->Update();
+  if (monitor->GetNumberOfUpdates() != 2)
+  {
+    std::cout << monitor;
+    std::cout << "Expected 2 upstream updates but got " << monitor->GetNumberOfUpdates() << "." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if (!passed)
+  {
+    std::cout << "ImageStreaming memory limit test failed." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "ImageStreaming memory limit test passed." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,173 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkMultiThreaderBase.h"
+#include "itkWorkUnitInstrumentation.h"
+
+#include <atomic>
+#include <iostream>
+#include <sstream>
+
+namespace
+{
+
+// Counts the callbacks and the pixels they cover, to verify that the hooks
+// fire exactly once around every work unit and cover the whole region.
+class CountingInstrumentation : public itk::WorkUnitInstrumentation
+{
+public:
+  void
+  WorkUnitBegin(unsigned int itkNotUsed(dimension),
+                const itk::IndexValueType itkNotUsed(index)[],
+                const itk::SizeValueType itkNotUsed(size)[]) override
+  {
+    ++m_Begins;
+  }
+
+  void
+  WorkUnitEnd(unsigned int dimension, const itk::IndexValueType itkNotUsed(index)[], const itk::SizeValueType size[])
+    override
+  {
+    itk::SizeValueType pixels = 1;
+    for (unsigned int d = 0; d < dimension; ++d)
+    {
+      pixels *= size[d];
+    }
+    m_Pixels += pixels;
+    ++m_Ends;
+  }
+
+  std::atomic<itk::SizeValueType> m_Begins{ 0 };
+  std::atomic<itk::SizeValueType> m_Ends{ 0 };
+  std::atomic<itk::SizeValueType> m_Pixels{ 0 };
+};
+
+} // namespace
+
+int
+itkWorkUnitInstrumentationTest(int, char *[])
+{
+  using RegionType = itk::ImageRegion<2>;
+
+  RegionType region;
+  region.SetIndex(0, 3);
+  region.SetIndex(1, -2);
+  region.SetSize(0, 57);
+  region.SetSize(1, 41);
+  const itk::SizeValueType regionPixels = region.GetNumberOfPixels();
+
+  itk::MultiThreaderBase::Pointer threader = itk::MultiThreaderBase::New();
+
+  if (itk::MultiThreaderBase::GetGlobalWorkUnitInstrumentation() != nullptr)
+  {
+    std::cerr << "No instrumentation expected to be registered by default" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Without instrumentation the work units must still run
+  std::atomic<itk::SizeValueType> uninstrumentedPixels{ 0 };
+  threader->ParallelizeImageRegion<2>(
+    region,
+    [&uninstrumentedPixels](const RegionType & workUnit) { uninstrumentedPixels += workUnit.GetNumberOfPixels(); },
+    nullptr);
+  if (uninstrumentedPixels != regionPixels)
+  {
+    std::cerr << "Uninstrumented run covered " << uninstrumentedPixels << " pixels instead of " << regionPixels
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The counting instrumentation must see a begin and an end per work unit
+  // and the work units must tile the parallelized region
+  CountingInstrumentation counter;
+  itk::MultiThreaderBase::SetGlobalWorkUnitInstrumentation(&counter);
+  if (itk::MultiThreaderBase::GetGlobalWorkUnitInstrumentation() != &counter)
+  {
+    std::cerr << "GetGlobalWorkUnitInstrumentation did not return the registered object" << std::endl;
+    return EXIT_FAILURE;
+  }
+  threader->ParallelizeImageRegion<2>(
+    region, [](const RegionType & itkNotUsed(workUnit)) {}, nullptr);
+  if (counter.m_Begins == 0 || counter.m_Begins != counter.m_Ends)
+  {
+    std::cerr << "Unbalanced callbacks: " << counter.m_Begins << " begins, " << counter.m_Ends << " ends" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (counter.m_Pixels != regionPixels)
+  {
+    std::cerr << "Work units covered " << counter.m_Pixels << " pixels instead of " << regionPixels << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The restricted-direction variant must report the full work unit regions
+  counter.m_Begins = 0;
+  counter.m_Ends = 0;
+  counter.m_Pixels = 0;
+  threader->ParallelizeImageRegionRestrictDirection<2>(
+    0, region, [](const RegionType & itkNotUsed(workUnit)) {}, nullptr);
+  if (counter.m_Begins == 0 || counter.m_Begins != counter.m_Ends || counter.m_Pixels != regionPixels)
+  {
+    std::cerr << "Restricted-direction run: " << counter.m_Begins << " begins, " << counter.m_Ends << " ends, "
+              << counter.m_Pixels << " pixels (expected " << regionPixels << ')' << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The reference timing collector must account for every pixel
+  itk::WorkUnitTimingCollector collector;
+  itk::MultiThreaderBase::SetGlobalWorkUnitInstrumentation(&collector);
+  threader->ParallelizeImageRegion<2>(
+    region, [](const RegionType & itkNotUsed(workUnit)) {}, nullptr);
+  itk::MultiThreaderBase::SetGlobalWorkUnitInstrumentation(nullptr);
+
+  itk::SizeValueType collectedWorkUnits = 0;
+  itk::SizeValueType collectedPixels = 0;
+  for (const itk::WorkUnitTimingCollector::ThreadRecord & record : collector.GetThreadRecords())
+  {
+    if (record.Seconds < 0.0)
+    {
+      std::cerr << "Thread record has a negative time" << std::endl;
+      return EXIT_FAILURE;
+    }
+    collectedWorkUnits += record.WorkUnits;
+    collectedPixels += record.Pixels;
+  }
+  if (collectedWorkUnits == 0 || collectedPixels != regionPixels)
+  {
+    std::cerr << "Timing collector recorded " << collectedWorkUnits << " work units and " << collectedPixels
+              << " pixels (expected " << regionPixels << ')' << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::ostringstream report;
+  collector.Print(report);
+  if (report.str().find("work units") == std::string::npos)
+  {
+    std::cerr << "Unexpected collector report:" << std::endl << report.str() << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << report.str();
+
+  collector.Reset();
+  if (!collector.GetThreadRecords().empty())
+  {
+    std::cerr << "Reset did not discard the thread records" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
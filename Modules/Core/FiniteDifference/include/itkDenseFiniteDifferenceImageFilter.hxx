@@ -20,6 +20,7 @@
 #include "itkDenseFiniteDifferenceImageFilter.h"
 
 #include "itkImageRegionIterator.h"
+#include "itkImageScanlineIterator.h"
 #include "itkNumericTraits.h"
 #include "itkNeighborhoodAlgorithm.h"
 
@@ -48,15 +49,20 @@ DenseFiniteDifferenceImageFilter<TInputImage, TOutputImage>::CopyInputToOutput()
     return;
   }
 
-  ImageRegionConstIterator<TInputImage> in(input, output->GetRequestedRegion());
-  ImageRegionIterator<TOutputImage>     out(output, output->GetRequestedRegion());
+  ImageScanlineConstIterator<TInputImage> in(input, output->GetRequestedRegion());
+  ImageScanlineIterator<TOutputImage>     out(output, output->GetRequestedRegion());
 
   while (!out.IsAtEnd())
   {
-    out.Value() = static_cast<PixelType>(in.Get()); // Supports input
-                                                    // image adaptors only
-    ++in;
-    ++out;
+    while (!out.IsAtEndOfLine())
+    {
+      out.Value() = static_cast<PixelType>(in.Get()); // Supports input
+                                                      // image adaptors only
+      ++in;
+      ++out;
+    }
+    in.NextLine();
+    out.NextLine();
   }
 }
 
@@ -191,18 +197,22 @@ DenseFiniteDifferenceImageFilter<TInputImage, TOutputImage>::ThreadedApplyUpdate
   const ThreadRegionType & regionToProcess,
   ThreadIdType)
 {
-  ImageRegionIterator<UpdateBufferType> u(m_UpdateBuffer, regionToProcess);
-  ImageRegionIterator<OutputImageType>  o(this->GetOutput(), regionToProcess);
-
-  u.GoToBegin();
-  o.GoToBegin();
+  // This pass is memory bound; scanline iteration keeps the inner loop a
+  // plain stride-one walk over both buffers.
+  ImageScanlineIterator<UpdateBufferType> u(m_UpdateBuffer, regionToProcess);
+  ImageScanlineIterator<OutputImageType>  o(this->GetOutput(), regionToProcess);
 
   while (!u.IsAtEnd())
   {
-    o.Value() += static_cast<PixelType>(u.Value() * dt); // no adaptor
-                                                         // support here
-    ++o;
-    ++u;
+    while (!u.IsAtEndOfLine())
+    {
+      o.Value() += static_cast<PixelType>(u.Value() * dt); // no adaptor
+                                                           // support here
+      ++o;
+      ++u;
+    }
+    u.NextLine();
+    o.NextLine();
   }
 }
 
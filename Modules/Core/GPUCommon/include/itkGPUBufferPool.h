@@ -0,0 +1,118 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkGPUBufferPool_h
+#define itkGPUBufferPool_h
+
+#include "itkOpenCLUtil.h"
+#include "itkGPUContextManager.h"
+#include <itkLightObject.h>
+
+#include <map>
+#include <mutex>
+#include <utility>
+
+namespace itk
+{
+/** \class GPUBufferPool
+ *
+ * \brief Singleton pool recycling OpenCL device buffers.
+ *
+ * Every GPUDataManager allocates and releases its device buffer through
+ * this pool. When recycling is enabled, a buffer whose last reference is
+ * released is kept idle instead of being returned to the driver, and a
+ * later allocation of a compatible size reuses it. Chains of GPU filters
+ * that repeatedly allocate same-sized intermediates then stop paying the
+ * driver allocation cost per filter output. Recycling is disabled by
+ * default, in which case the pool is a plain pass-through to
+ * clCreateBuffer / clReleaseMemObject.
+ *
+ * \ingroup ITKGPUCommon
+ */
+class GPUBufferPool : public LightObject
+{
+public:
+  static GPUBufferPool *
+  GetInstance();
+
+  void
+  DestroyInstance();
+
+  /** Enable or disable recycling. Disabling purges the idle buffers. */
+  void
+  SetRecyclingEnabled(bool enabled);
+
+  bool
+  GetRecyclingEnabled() const
+  {
+    return m_RecyclingEnabled;
+  }
+
+  /** Return a device buffer of at least bufferSize bytes with the given
+   * flags, reusing an idle buffer when one fits. A reused buffer may be
+   * larger than requested, by at most a factor of two. */
+  cl_mem
+  AcquireBuffer(cl_mem_flags memFlags, size_t bufferSize);
+
+  /** Give up one reference to a buffer. A buffer obtained from
+   * AcquireBuffer whose last reference goes away becomes idle and
+   * available for reuse; any other buffer is released to the driver. */
+  void
+  ReleaseBuffer(cl_mem memObject);
+
+  /** Release all idle buffers to the driver. */
+  void
+  Purge();
+
+  /** Total bytes held by idle buffers, available for reuse. */
+  size_t
+  GetIdleMemorySize() const
+  {
+    return m_IdleMemorySize;
+  }
+
+private:
+  GPUBufferPool();
+  ~GPUBufferPool() override;
+
+  /** Purge expecting m_Mutex to be held by the caller. */
+  void
+  PurgeWhileLocked();
+
+  struct BufferRecord
+  {
+    cl_mem_flags m_MemFlags;
+    size_t       m_ByteSize;
+  };
+
+  /** Key ordering idle buffers by flags, then size, for best-fit lookup */
+  using BufferKey = std::pair<cl_mem_flags, size_t>;
+
+  GPUContextManager * m_ContextManager;
+
+  std::map<cl_mem, BufferRecord>   m_BuffersInUse;
+  std::multimap<BufferKey, cl_mem> m_IdleBuffers;
+  size_t                           m_IdleMemorySize;
+  bool                             m_RecyclingEnabled;
+
+  std::mutex m_Mutex;
+
+  static GPUBufferPool * m_Instance;
+};
+} // namespace itk
+
+#endif
@@ -0,0 +1,133 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkGPUImageStatistics_h
+#define itkGPUImageStatistics_h
+
+#include "itkObject.h"
+#include "itkGPUDataManager.h"
+#include "itkGPUKernelManager.h"
+#include "itkOpenCLUtil.h"
+
+#include <vector>
+
+namespace itk
+{
+/** Create a helper GPU Kernel class for GPUImageStatistics */
+itkGPUKernelClassMacro(GPUImageStatisticsKernel);
+
+/**
+ * \class GPUImageStatistics
+ *
+ * \brief Device-side minimum, maximum, sum and sum-of-squares reduction.
+ *
+ * This class computes the intensity statistics of a device buffer in a
+ * single kernel pass, so pipelines that need normalization do not
+ * download the volume; only one partial result per work group travels
+ * back to the host. The statistics and their names match
+ * StatisticsImageFilter: Minimum, Maximum, Sum, SumOfSquares, Mean,
+ * Sigma and Variance. Sums are accumulated in double precision on the
+ * device.
+ *
+ * \sa GPUReduction
+ * \ingroup ITKGPUCommon
+ */
+template <typename TElement>
+class ITK_TEMPLATE_EXPORT GPUImageStatistics : public Object
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(GPUImageStatistics);
+
+  /** Standard class type aliases. */
+  using Self = GPUImageStatistics;
+  using Superclass = Object;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(GPUImageStatistics, Object);
+
+  using GPUDataPointer = GPUDataManager::Pointer;
+
+  /** Type used for the accumulated statistics, as in StatisticsImageFilter */
+  using RealType = double;
+
+  /** Get OpenCL Kernel source as a string, creates a GetOpenCLSource method */
+  itkGetOpenCLSourceFromKernelMacro(GPUImageStatisticsKernel);
+
+  /** Compute the statistics of the first numberOfElements elements of the
+   * device buffer, e.g. the data manager of a GPUImage. The CPU side of
+   * the buffer is not touched. */
+  void
+  Compute(GPUDataManager * inputData, unsigned int numberOfElements);
+
+  itkGetMacro(Minimum, TElement);
+  itkGetMacro(Maximum, TElement);
+  itkGetMacro(Sum, RealType);
+  itkGetMacro(SumOfSquares, RealType);
+
+  RealType
+  GetMean() const;
+
+  RealType
+  GetVariance() const;
+
+  RealType
+  GetSigma() const;
+
+protected:
+  GPUImageStatistics();
+  ~GPUImageStatistics() override = default;
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+  /** Compile the statistics kernel on first use */
+  void
+  InitializeKernel();
+
+  GPUKernelManager::Pointer m_GPUKernelManager;
+
+  /** Per-block partial results, kept across calls so per-iteration
+   * statistics do not reallocate device memory. */
+  GPUDataPointer        m_BlockSumDataManager;
+  GPUDataPointer        m_BlockSumOfSquaresDataManager;
+  GPUDataPointer        m_BlockMinimumDataManager;
+  GPUDataPointer        m_BlockMaximumDataManager;
+  std::vector<RealType> m_BlockSums;
+  std::vector<RealType> m_BlockSumsOfSquares;
+  std::vector<TElement> m_BlockMinima;
+  std::vector<TElement> m_BlockMaxima;
+
+  int  m_StatisticsGPUKernelHandle;
+  bool m_SmallBlock;
+
+  unsigned int m_NumberOfElements;
+  TElement     m_Minimum;
+  TElement     m_Maximum;
+  RealType     m_Sum;
+  RealType     m_SumOfSquares;
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkGPUImageStatistics.hxx"
+#endif
+
+#endif
@@ -0,0 +1,227 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkGPUImageStatistics_hxx
+#define itkGPUImageStatistics_hxx
+
+#include "itkMacro.h"
+#include "itkGPUImageStatistics.h"
+#include "itkMath.h"
+#include "itkNumericTraits.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace itk
+{
+template <typename TElement>
+GPUImageStatistics<TElement>::GPUImageStatistics()
+{
+  /*** Prepare GPU opencl program ***/
+  m_GPUKernelManager = GPUKernelManager::New();
+  m_BlockSumDataManager = nullptr;
+  m_BlockSumOfSquaresDataManager = nullptr;
+  m_BlockMinimumDataManager = nullptr;
+  m_BlockMaximumDataManager = nullptr;
+
+  m_StatisticsGPUKernelHandle = -1;
+  m_SmallBlock = false;
+
+  m_NumberOfElements = 0;
+  m_Minimum = NumericTraits<TElement>::ZeroValue();
+  m_Maximum = NumericTraits<TElement>::ZeroValue();
+  m_Sum = 0.0;
+  m_SumOfSquares = 0.0;
+}
+
+template <typename TElement>
+void
+GPUImageStatistics<TElement>::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "NumberOfElements: " << m_NumberOfElements << std::endl;
+  os << indent << "Minimum: " << m_Minimum << std::endl;
+  os << indent << "Maximum: " << m_Maximum << std::endl;
+  os << indent << "Sum: " << m_Sum << std::endl;
+  os << indent << "SumOfSquares: " << m_SumOfSquares << std::endl;
+}
+
+template <typename TElement>
+void
+GPUImageStatistics<TElement>::InitializeKernel()
+{
+  std::ostringstream defines;
+
+  defines << Get64BitPragma();
+  defines << "#define REALTYPE double" << std::endl;
+
+  defines << "#define T ";
+  GetTypenameInString(typeid(TElement), defines);
+
+  const char * GPUSource = GPUImageStatistics::GetOpenCLSource();
+
+  // load and build program
+  this->m_GPUKernelManager->LoadProgramFromString(GPUSource, defines.str().c_str());
+
+  m_StatisticsGPUKernelHandle = this->m_GPUKernelManager->CreateKernel("statisticsReduce");
+
+  size_t wgSize;
+  cl_int ciErrNum =
+    this->m_GPUKernelManager->GetKernelWorkGroupInfo(m_StatisticsGPUKernelHandle, CL_KERNEL_WORK_GROUP_SIZE, &wgSize);
+  OpenCLCheckError(ciErrNum, __FILE__, __LINE__, ITK_LOCATION);
+
+  m_SmallBlock = (wgSize == 64);
+}
+
+template <typename TElement>
+void
+GPUImageStatistics<TElement>::Compute(GPUDataManager * inputData, unsigned int numberOfElements)
+{
+  if (inputData == nullptr || numberOfElements == 0)
+  {
+    itkExceptionMacro("Cannot compute statistics without input elements");
+  }
+
+  if (m_StatisticsGPUKernelHandle < 0)
+  {
+    this->InitializeKernel();
+  }
+
+  m_NumberOfElements = numberOfElements;
+
+  // number of threads per block, power of two for the tree reduction
+  int numThreads = m_SmallBlock ? 64 : 128;
+  int maxBlocks = 64;
+
+  int numBlocks = (static_cast<int>(numberOfElements) + numThreads - 1) / numThreads;
+  if (maxBlocks < numBlocks)
+  {
+    numBlocks = maxBlocks;
+  }
+
+  // Allocate the per-block partial results on first use.  The buffers
+  // are kept across calls so per-iteration statistics do not reallocate
+  // device memory; only the partials travel back to the host.
+  if (m_BlockSums.size() < static_cast<size_t>(numBlocks))
+  {
+    m_BlockSums.resize(numBlocks);
+    m_BlockSumsOfSquares.resize(numBlocks);
+    m_BlockMinima.resize(numBlocks);
+    m_BlockMaxima.resize(numBlocks);
+
+    auto allocateBlockBuffer = [numBlocks](void * cpuBuffer, size_t elementSize) {
+      GPUDataPointer manager = GPUDataManager::New();
+      manager->SetBufferSize(static_cast<unsigned int>(numBlocks * elementSize));
+      manager->SetCPUBufferPointer(cpuBuffer);
+      manager->Allocate();
+      manager->SetCPUDirtyFlag(true);
+      return manager;
+    };
+
+    m_BlockSumDataManager = allocateBlockBuffer(m_BlockSums.data(), sizeof(RealType));
+    m_BlockSumOfSquaresDataManager = allocateBlockBuffer(m_BlockSumsOfSquares.data(), sizeof(RealType));
+    m_BlockMinimumDataManager = allocateBlockBuffer(m_BlockMinima.data(), sizeof(TElement));
+    m_BlockMaximumDataManager = allocateBlockBuffer(m_BlockMaxima.data(), sizeof(TElement));
+  }
+
+  // arguments set up
+  cl_uint argidx = 0;
+  auto    n = static_cast<cl_uint>(numberOfElements);
+
+  this->m_GPUKernelManager->SetKernelArgWithImage(m_StatisticsGPUKernelHandle, argidx++, inputData);
+  this->m_GPUKernelManager->SetKernelArgWithImage(m_StatisticsGPUKernelHandle, argidx++, m_BlockSumDataManager);
+  this->m_GPUKernelManager->SetKernelArgWithImage(
+    m_StatisticsGPUKernelHandle, argidx++, m_BlockSumOfSquaresDataManager);
+  this->m_GPUKernelManager->SetKernelArgWithImage(m_StatisticsGPUKernelHandle, argidx++, m_BlockMinimumDataManager);
+  this->m_GPUKernelManager->SetKernelArgWithImage(m_StatisticsGPUKernelHandle, argidx++, m_BlockMaximumDataManager);
+  this->m_GPUKernelManager->SetKernelArg(m_StatisticsGPUKernelHandle, argidx++, sizeof(cl_uint), &n);
+  // shared memory below
+  this->m_GPUKernelManager->SetKernelArg(m_StatisticsGPUKernelHandle, argidx++, sizeof(RealType) * numThreads, nullptr);
+  this->m_GPUKernelManager->SetKernelArg(m_StatisticsGPUKernelHandle, argidx++, sizeof(RealType) * numThreads, nullptr);
+  this->m_GPUKernelManager->SetKernelArg(m_StatisticsGPUKernelHandle, argidx++, sizeof(TElement) * numThreads, nullptr);
+  this->m_GPUKernelManager->SetKernelArg(m_StatisticsGPUKernelHandle, argidx++, sizeof(TElement) * numThreads, nullptr);
+
+  size_t globalSize[1];
+  size_t localSize[1];
+
+  // execute the kernel
+  globalSize[0] = static_cast<size_t>(numBlocks) * numThreads;
+  localSize[0] = numThreads;
+
+  this->m_GPUKernelManager->LaunchKernel(m_StatisticsGPUKernelHandle, 1, globalSize, localSize);
+
+  // combine the per-block partial results on the host
+  m_BlockSumDataManager->SetCPUDirtyFlag(true);
+  m_BlockSumOfSquaresDataManager->SetCPUDirtyFlag(true);
+  m_BlockMinimumDataManager->SetCPUDirtyFlag(true);
+  m_BlockMaximumDataManager->SetCPUDirtyFlag(true);
+
+  auto * blockSums = (RealType *)m_BlockSumDataManager->GetCPUBufferPointer();
+  auto * blockSumsOfSquares = (RealType *)m_BlockSumOfSquaresDataManager->GetCPUBufferPointer();
+  auto * blockMinima = (TElement *)m_BlockMinimumDataManager->GetCPUBufferPointer();
+  auto * blockMaxima = (TElement *)m_BlockMaximumDataManager->GetCPUBufferPointer();
+
+  m_Sum = 0.0;
+  m_SumOfSquares = 0.0;
+  m_Minimum = blockMinima[0];
+  m_Maximum = blockMaxima[0];
+
+  for (int i = 0; i < numBlocks; ++i)
+  {
+    m_Sum += blockSums[i];
+    m_SumOfSquares += blockSumsOfSquares[i];
+    m_Minimum = std::min(m_Minimum, blockMinima[i]);
+    m_Maximum = std::max(m_Maximum, blockMaxima[i]);
+  }
+}
+
+template <typename TElement>
+auto
+GPUImageStatistics<TElement>::GetMean() const -> RealType
+{
+  if (m_NumberOfElements == 0)
+  {
+    return 0.0;
+  }
+  return m_Sum / static_cast<RealType>(m_NumberOfElements);
+}
+
+template <typename TElement>
+auto
+GPUImageStatistics<TElement>::GetVariance() const -> RealType
+{
+  if (m_NumberOfElements < 2)
+  {
+    return 0.0;
+  }
+
+  // same unbiased estimate as StatisticsImageFilter
+  const auto count = static_cast<RealType>(m_NumberOfElements);
+  return (m_SumOfSquares - (m_Sum * m_Sum / count)) / (count - 1.0);
+}
+
+template <typename TElement>
+auto
+GPUImageStatistics<TElement>::GetSigma() const -> RealType
+{
+  return std::sqrt(this->GetVariance());
+}
+
+} // end namespace itk
+
+#endif
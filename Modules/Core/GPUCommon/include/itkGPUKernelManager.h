@@ -23,6 +23,7 @@
 #ifndef itkGPUKernelManager_h
 #define itkGPUKernelManager_h
 
+#include <string>
 #include <vector>
 #include <itkLightObject.h>
 #include <itkObjectFactory.h>
@@ -66,6 +67,19 @@ public:
   bool
   LoadProgramFromString(const char * cSource, const char * cPreamble = "");
 
+  /** Directory where compiled OpenCL program binaries are cached between
+   * runs. When the directory is non-empty, LoadProgramFromFile and
+   * LoadProgramFromString first look for a binary previously compiled from
+   * the same source for the current device and driver, and store the binary
+   * after a successful source compilation, removing the runtime compilation
+   * cost from subsequent runs. An empty directory (the default) disables
+   * caching. The setting applies to all kernel managers of the process. */
+  static void
+  SetProgramBinaryCacheDirectory(const std::string & directory);
+
+  static const std::string &
+  GetProgramBinaryCacheDirectory();
+
   int
   CreateKernel(const char * kernelName);
 
@@ -197,6 +211,24 @@ protected:
   ResetArguments(int kernelIdx);
 
 private:
+  /** Create and build m_Program from the combined (preamble + source)
+   * string, using the program binary cache when it is enabled. */
+  bool
+  BuildProgram(const char * cSourceString, size_t szFinalLength);
+
+  bool
+  LoadProgramFromBinaryFile(const std::string & fileName);
+
+  void
+  SaveProgramToBinaryFile(const std::string & fileName);
+
+  /** Cache file name formed from a hash of the program source and the
+   * identity of the device and driver the binary is built for. */
+  std::string
+  GetProgramBinaryCacheFileName(const char * cSourceString) const;
+
+  static std::string m_ProgramBinaryCacheDirectory;
+
   cl_program m_Program;
 
   GPUContextManager * m_Manager;
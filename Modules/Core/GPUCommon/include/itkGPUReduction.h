@@ -23,6 +23,8 @@
 #include "itkGPUKernelManager.h"
 #include "itkOpenCLUtil.h"
 
+#include <vector>
+
 namespace itk
 {
 /** Create a helper GPU Kernel class for GPUReduction */
@@ -109,6 +111,14 @@ protected:
   GPUKernelManager::Pointer m_GPUKernelManager;
   GPUDataPointer            m_GPUDataManager;
 
+  /** Scratch buffer holding the per-block partial sums.  It is allocated
+   * on first use and kept across calls, so reductions performed once per
+   * iteration (e.g. the metric statistics of the GPU registration
+   * filters) do not allocate device and host memory each time.  Only the
+   * partial sums are read back per reduction. */
+  GPUDataPointer        m_GPUOutputDataManager;
+  std::vector<TElement> m_OutputBlockSums;
+
   /* GPU kernel handle for GPUComputeUpdate */
   int m_ReduceGPUKernelHandle;
   int m_TestGPUKernelHandle;
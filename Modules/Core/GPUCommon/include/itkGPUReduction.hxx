@@ -34,6 +34,7 @@ GPUReduction<TElement>::GPUReduction()
   /*** Prepare GPU opencl program ***/
   m_GPUKernelManager = GPUKernelManager::New();
   m_GPUDataManager = nullptr;
+  m_GPUOutputDataManager = nullptr;
 
   m_ReduceGPUKernelHandle = 0;
   m_TestGPUKernelHandle = 0;
@@ -169,6 +170,13 @@ template <typename TElement>
 void
 GPUReduction<TElement>::ReleaseGPUInputBuffer()
 {
+  if (m_GPUOutputDataManager != (GPUDataPointer) nullptr)
+  {
+    m_GPUOutputDataManager->Initialize();
+    m_GPUOutputDataManager = nullptr;
+    m_OutputBlockSums.clear();
+  }
+
   if (m_GPUDataManager == (GPUDataPointer) nullptr)
   {
     return;
@@ -255,14 +263,19 @@ GPUReduction<TElement>::GPUGenerateData()
   if (numBlocks == 1)
     cpuFinalThreshold = 1;
 
-  // allocate output data for the result
-  auto * h_odata = (TElement *)malloc(numBlocks * sizeof(TElement));
+  // Allocate output data for the result on first use.  The buffer is
+  // kept across calls so per-iteration reductions do not reallocate
+  // device memory; only the partial block sums travel back to the host.
+  if (m_OutputBlockSums.size() < static_cast<size_t>(numBlocks))
+  {
+    m_OutputBlockSums.resize(numBlocks);
 
-  GPUDataPointer odata = GPUDataManager::New();
-  odata->SetBufferSize(numBlocks * sizeof(TElement));
-  odata->SetCPUBufferPointer(h_odata);
-  odata->Allocate();
-  odata->SetCPUDirtyFlag(true);
+    m_GPUOutputDataManager = GPUDataManager::New();
+    m_GPUOutputDataManager->SetBufferSize(numBlocks * sizeof(TElement));
+    m_GPUOutputDataManager->SetCPUBufferPointer(m_OutputBlockSums.data());
+    m_GPUOutputDataManager->Allocate();
+    m_GPUOutputDataManager->SetCPUDirtyFlag(true);
+  }
 
   double dTotalTime = 0.0;
 
@@ -277,10 +290,7 @@ GPUReduction<TElement>::GPUGenerateData()
                                 cpuFinalThreshold,
                                 &dTotalTime,
                                 m_GPUDataManager,
-                                odata);
-
-  // cleanup
-  free(h_odata);
+                                m_GPUOutputDataManager);
 
   return m_GPUResult;
 }
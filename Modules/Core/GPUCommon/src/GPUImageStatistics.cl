@@ -0,0 +1,88 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+// The following defines are set during runtime compilation, see itkGPUImageStatistics.hxx
+// #define T float
+// #define REALTYPE double
+
+/*
+    Single-pass statistics reduction. Every thread accumulates the
+    minimum, maximum, sum and sum of squares over a grid-strided slice of
+    the input, the block then combines the thread accumulators through a
+    local memory tree reduction, and one partial result per block is
+    written to global memory. The host combines the per-block partials.
+    The caller guarantees n > 0 and a power-of-two work group size.
+*/
+__kernel void statisticsReduce(__global const T *g_idata,
+                               __global REALTYPE *g_osum,
+                               __global REALTYPE *g_osumsq,
+                               __global T *g_omin,
+                               __global T *g_omax,
+                               unsigned int n,
+                               __local REALTYPE *ssum,
+                               __local REALTYPE *ssumsq,
+                               __local T *smin,
+                               __local T *smax)
+{
+    unsigned int tid = get_local_id(0);
+    unsigned int i = get_group_id(0)*get_local_size(0) + tid;
+    unsigned int gridSize = get_local_size(0)*get_num_groups(0);
+
+    REALTYPE sum = 0;
+    REALTYPE sumsq = 0;
+    T vmin = g_idata[0];
+    T vmax = g_idata[0];
+
+    while (i < n)
+    {
+        T v = g_idata[i];
+        sum += (REALTYPE)v;
+        sumsq += (REALTYPE)v * (REALTYPE)v;
+        vmin = (v < vmin) ? v : vmin;
+        vmax = (v > vmax) ? v : vmax;
+        i += gridSize;
+    }
+
+    ssum[tid] = sum;
+    ssumsq[tid] = sumsq;
+    smin[tid] = vmin;
+    smax[tid] = vmax;
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    // do reduction in shared mem
+    for (unsigned int s = get_local_size(0)/2; s > 0; s >>= 1)
+    {
+        if (tid < s)
+        {
+            ssum[tid] += ssum[tid + s];
+            ssumsq[tid] += ssumsq[tid + s];
+            smin[tid] = (smin[tid + s] < smin[tid]) ? smin[tid + s] : smin[tid];
+            smax[tid] = (smax[tid + s] > smax[tid]) ? smax[tid + s] : smax[tid];
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+    // write result for this block to global mem
+    if (tid == 0)
+    {
+        g_osum[get_group_id(0)] = ssum[0];
+        g_osumsq[get_group_id(0)] = ssumsq[0];
+        g_omin[get_group_id(0)] = smin[0];
+        g_omax[get_group_id(0)] = smax[0];
+    }
+}
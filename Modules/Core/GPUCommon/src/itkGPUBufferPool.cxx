@@ -0,0 +1,153 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkGPUBufferPool.h"
+
+namespace itk
+{
+// static variable initialization
+GPUBufferPool * GPUBufferPool::m_Instance = nullptr;
+
+GPUBufferPool *
+GPUBufferPool::GetInstance()
+{
+  if (m_Instance == nullptr)
+  {
+    m_Instance = new GPUBufferPool();
+  }
+  return m_Instance;
+}
+
+void
+GPUBufferPool::DestroyInstance()
+{
+  m_Instance->Delete();
+  m_Instance = nullptr;
+  itkDebugStatement(std::cout << "OpenCL buffer pool is destroyed." << std::endl);
+}
+
+GPUBufferPool::GPUBufferPool()
+{
+  m_ContextManager = GPUContextManager::GetInstance();
+  m_IdleMemorySize = 0;
+  m_RecyclingEnabled = false;
+}
+
+GPUBufferPool::~GPUBufferPool()
+{
+  this->Purge();
+}
+
+void
+GPUBufferPool::SetRecyclingEnabled(bool enabled)
+{
+  std::lock_guard<std::mutex> holder(m_Mutex);
+
+  m_RecyclingEnabled = enabled;
+
+  if (!enabled)
+  {
+    this->PurgeWhileLocked();
+  }
+}
+
+cl_mem
+GPUBufferPool::AcquireBuffer(cl_mem_flags memFlags, size_t bufferSize)
+{
+  std::lock_guard<std::mutex> holder(m_Mutex);
+
+  if (m_RecyclingEnabled)
+  {
+    // best fit: the smallest idle buffer with the same flags that is
+    // large enough, as long as it does not waste more than half its size
+    auto iter = m_IdleBuffers.lower_bound(BufferKey(memFlags, bufferSize));
+    if (iter != m_IdleBuffers.end() && iter->first.first == memFlags && iter->first.second <= 2 * bufferSize)
+    {
+      cl_mem memObject = iter->second;
+      m_BuffersInUse[memObject] = BufferRecord{ memFlags, iter->first.second };
+      m_IdleMemorySize -= iter->first.second;
+      m_IdleBuffers.erase(iter);
+      return memObject;
+    }
+  }
+
+  cl_int errid;
+  cl_mem memObject = clCreateBuffer(m_ContextManager->GetCurrentContext(), memFlags, bufferSize, nullptr, &errid);
+  OpenCLCheckError(errid, __FILE__, __LINE__, ITK_LOCATION);
+
+  if (m_RecyclingEnabled)
+  {
+    m_BuffersInUse[memObject] = BufferRecord{ memFlags, bufferSize };
+  }
+
+  return memObject;
+}
+
+void
+GPUBufferPool::ReleaseBuffer(cl_mem memObject)
+{
+  std::lock_guard<std::mutex> holder(m_Mutex);
+
+  cl_int errid;
+
+  auto iter = m_BuffersInUse.find(memObject);
+  if (iter != m_BuffersInUse.end())
+  {
+    // only the last reference makes the buffer idle; grafted data
+    // managers hold additional references through clRetainMemObject
+    cl_uint referenceCount = 0;
+    errid = clGetMemObjectInfo(memObject, CL_MEM_REFERENCE_COUNT, sizeof(cl_uint), &referenceCount, nullptr);
+    OpenCLCheckError(errid, __FILE__, __LINE__, ITK_LOCATION);
+
+    if (referenceCount == 1)
+    {
+      if (m_RecyclingEnabled)
+      {
+        m_IdleBuffers.insert({ BufferKey(iter->second.m_MemFlags, iter->second.m_ByteSize), memObject });
+        m_IdleMemorySize += iter->second.m_ByteSize;
+        m_BuffersInUse.erase(iter);
+        return;
+      }
+      m_BuffersInUse.erase(iter);
+    }
+  }
+
+  errid = clReleaseMemObject(memObject);
+  OpenCLCheckError(errid, __FILE__, __LINE__, ITK_LOCATION);
+}
+
+void
+GPUBufferPool::Purge()
+{
+  std::lock_guard<std::mutex> holder(m_Mutex);
+
+  this->PurgeWhileLocked();
+}
+
+void
+GPUBufferPool::PurgeWhileLocked()
+{
+  for (auto & idleBuffer : m_IdleBuffers)
+  {
+    cl_int errid = clReleaseMemObject(idleBuffer.second);
+    OpenCLCheckError(errid, __FILE__, __LINE__, ITK_LOCATION);
+  }
+  m_IdleBuffers.clear();
+  m_IdleMemorySize = 0;
+}
+} // namespace itk
@@ -17,6 +17,7 @@
  *=========================================================================*/
 
 #include "itkGPUDataManager.h"
+#include "itkGPUBufferPool.h"
 //#define VERBOSE
 
 namespace itk
@@ -35,7 +36,7 @@ GPUDataManager::~GPUDataManager()
 {
   if (m_GPUBuffer)
   {
-    clReleaseMemObject(m_GPUBuffer);
+    GPUBufferPool::GetInstance()->ReleaseBuffer(m_GPUBuffer);
   }
 }
 
@@ -54,15 +55,12 @@ GPUDataManager::SetBufferFlag(cl_mem_flags flags)
 void
 GPUDataManager::Allocate()
 {
-  cl_int errid;
-
   if (m_BufferSize > 0)
   {
 #ifdef VERBOSE
     std::cout << this << "::Allocate Create GPU buffer of size " << m_BufferSize << " Bytes" << std::endl;
 #endif
-    m_GPUBuffer = clCreateBuffer(m_ContextManager->GetCurrentContext(), m_MemFlags, m_BufferSize, nullptr, &errid);
-    OpenCLCheckError(errid, __FILE__, __LINE__, ITK_LOCATION);
+    m_GPUBuffer = GPUBufferPool::GetInstance()->AcquireBuffer(m_MemFlags, m_BufferSize);
     m_IsGPUBufferDirty = true;
   }
 
@@ -223,7 +221,7 @@ GPUDataManager::Graft(const GPUDataManager * data)
 
     if (m_GPUBuffer) // Decrease reference count to GPU memory
     {
-      clReleaseMemObject(m_GPUBuffer);
+      GPUBufferPool::GetInstance()->ReleaseBuffer(m_GPUBuffer);
     }
     if (data->m_GPUBuffer) // Increase reference count to GPU memory
     {
@@ -250,7 +248,7 @@ GPUDataManager::Initialize()
 
   if (m_GPUBuffer) // Release GPU memory if exists
   {
-    clReleaseMemObject(m_GPUBuffer);
+    GPUBufferPool::GetInstance()->ReleaseBuffer(m_GPUBuffer);
   }
 
   m_BufferSize = 0;
@@ -18,8 +18,43 @@
 
 #include "itkGPUKernelManager.h"
 
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+
+namespace
+{
+// FNV-1a, used to key program binary cache files
+uint64_t
+HashNullTerminatedString(uint64_t hash, const char * str)
+{
+  while (*str != '\0')
+  {
+    hash ^= (uint64_t)(unsigned char)*str++;
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+} // namespace
+
 namespace itk
 {
+std::string GPUKernelManager::m_ProgramBinaryCacheDirectory;
+
+void
+GPUKernelManager::SetProgramBinaryCacheDirectory(const std::string & directory)
+{
+  m_ProgramBinaryCacheDirectory = directory;
+}
+
+const std::string &
+GPUKernelManager::GetProgramBinaryCacheDirectory()
+{
+  return m_ProgramBinaryCacheDirectory;
+}
+
 GPUKernelManager::GPUKernelManager()
 {
   m_Program = nullptr;
@@ -101,59 +136,10 @@ GPUKernelManager::LoadProgramFromFile(const char * filename, const char * cPream
 
   cSourceString[szSourceLength + szPreambleLength] = '\0';
 
-  //
-  // Create OpenCL program from source strings
-  //
-  cl_int errid;
-  m_Program = clCreateProgramWithSource(
-    m_Manager->GetCurrentContext(), 1, const_cast<const char **>(&cSourceString), &szFinalLength, &errid);
-  OpenCLCheckError(errid, __FILE__, __LINE__, ITK_LOCATION);
+  const bool built = this->BuildProgram(cSourceString, szFinalLength);
   free(cSourceString);
 
-  if (errid != CL_SUCCESS)
-  {
-    itkWarningMacro("Cannot create GPU program");
-    return false;
-  }
-
-  // build program
-  errid = clBuildProgram(m_Program, 0, nullptr, nullptr, nullptr, nullptr);
-  if (errid != CL_SUCCESS)
-  {
-    // itkWarningMacro("OpenCL program build error");
-
-    // print out build error
-    size_t paramValueSize = 0;
-
-    // get error message size
-    clGetProgramBuildInfo(m_Program, m_Manager->GetDeviceId(0), CL_PROGRAM_BUILD_LOG, 0, nullptr, &paramValueSize);
-
-    char * paramValue;
-    paramValue = (char *)malloc(paramValueSize);
-
-    // get error message
-    clGetProgramBuildInfo(
-      m_Program, m_Manager->GetDeviceId(0), CL_PROGRAM_BUILD_LOG, paramValueSize, paramValue, nullptr);
-
-    /*
-    std::ostringstream itkmsg;
-    itkmsg << "ERROR: In " __FILE__ ", line " << __LINE__ << "\n"
-           << this->GetNameOfClass() << " (" << this << "): "
-           << "OpenCL program build error:" << paramValue
-           << "\n\n";
-    ::itk::OutputWindowDisplayErrorText( itkmsg.str().c_str() );
-    */
-
-    std::cerr << paramValue << std::endl;
-
-    free(paramValue);
-
-    OpenCLCheckError(errid, __FILE__, __LINE__, ITK_LOCATION);
-
-    return false;
-  }
-
-  return true;
+  return built;
 }
 
 bool
@@ -177,14 +163,32 @@ GPUKernelManager::LoadProgramFromString(const char * cSource, const char * cPrea
 
   cSourceString[szFinalLength] = '\0';
 
+  const bool built = this->BuildProgram(cSourceString, szFinalLength);
+  free(cSourceString);
+
+  return built;
+}
+
+bool
+GPUKernelManager::BuildProgram(const char * cSourceString, size_t szFinalLength)
+{
+  std::string cacheFileName;
+  if (!m_ProgramBinaryCacheDirectory.empty())
+  {
+    cacheFileName = this->GetProgramBinaryCacheFileName(cSourceString);
+    if (this->LoadProgramFromBinaryFile(cacheFileName))
+    {
+      return true;
+    }
+  }
+
   //
   // Create OpenCL program from source strings
   //
   cl_int errid;
-  m_Program = clCreateProgramWithSource(
-    m_Manager->GetCurrentContext(), 1, const_cast<const char **>(&cSourceString), &szFinalLength, &errid);
+  m_Program =
+    clCreateProgramWithSource(m_Manager->GetCurrentContext(), 1, &cSourceString, &szFinalLength, &errid);
   OpenCLCheckError(errid, __FILE__, __LINE__, ITK_LOCATION);
-  free(cSourceString);
 
   if (errid != CL_SUCCESS)
   {
@@ -229,9 +233,114 @@ GPUKernelManager::LoadProgramFromString(const char * cSource, const char * cPrea
     return false;
   }
 
+  if (!cacheFileName.empty())
+  {
+    this->SaveProgramToBinaryFile(cacheFileName);
+  }
+
   return true;
 }
 
+std::string
+GPUKernelManager::GetProgramBinaryCacheFileName(const char * cSourceString) const
+{
+  uint64_t hash = 14695981039346656037ULL;
+  hash = HashNullTerminatedString(hash, cSourceString);
+
+  // a binary is only valid for the device and driver that produced it
+  char                 deviceInfo[1024];
+  const cl_device_info paramNames[] = { CL_DEVICE_NAME, CL_DEVICE_VENDOR, CL_DRIVER_VERSION };
+  for (const cl_device_info paramName : paramNames)
+  {
+    if (clGetDeviceInfo(m_Manager->GetDeviceId(0), paramName, sizeof(deviceInfo), deviceInfo, nullptr) == CL_SUCCESS)
+    {
+      hash = HashNullTerminatedString(hash, deviceInfo);
+    }
+  }
+
+  std::ostringstream fileName;
+  fileName << m_ProgramBinaryCacheDirectory << "/itkOpenCLProgram-" << std::hex << std::setfill('0') << std::setw(16)
+           << hash << ".bin";
+  return fileName.str();
+}
+
+bool
+GPUKernelManager::LoadProgramFromBinaryFile(const std::string & fileName)
+{
+  std::ifstream inputStream(fileName.c_str(), std::ios::binary);
+  if (!inputStream)
+  {
+    return false;
+  }
+
+  const std::vector<unsigned char> binary((std::istreambuf_iterator<char>(inputStream)),
+                                          std::istreambuf_iterator<char>());
+  if (binary.empty())
+  {
+    return false;
+  }
+
+  cl_device_id          device = m_Manager->GetDeviceId(0);
+  const unsigned char * binaryData = binary.data();
+  size_t                binarySize = binary.size();
+  cl_int                binaryStatus = CL_SUCCESS;
+  cl_int                errid;
+
+  cl_program program = clCreateProgramWithBinary(
+    m_Manager->GetCurrentContext(), 1, &device, &binarySize, &binaryData, &binaryStatus, &errid);
+  if (errid != CL_SUCCESS || binaryStatus != CL_SUCCESS)
+  {
+    // a stale or foreign binary is not an error; fall back to compiling
+    return false;
+  }
+
+  errid = clBuildProgram(program, 0, nullptr, nullptr, nullptr, nullptr);
+  if (errid != CL_SUCCESS)
+  {
+    clReleaseProgram(program);
+    return false;
+  }
+
+  m_Program = program;
+  return true;
+}
+
+void
+GPUKernelManager::SaveProgramToBinaryFile(const std::string & fileName)
+{
+  // the binary arrays of CL_PROGRAM_BINARIES are per device; only the
+  // single-device case is cached
+  cl_uint numberOfDevices = 0;
+  cl_int  errid = clGetProgramInfo(m_Program, CL_PROGRAM_NUM_DEVICES, sizeof(cl_uint), &numberOfDevices, nullptr);
+  if (errid != CL_SUCCESS || numberOfDevices != 1)
+  {
+    return;
+  }
+
+  size_t binarySize = 0;
+  errid = clGetProgramInfo(m_Program, CL_PROGRAM_BINARY_SIZES, sizeof(size_t), &binarySize, nullptr);
+  if (errid != CL_SUCCESS || binarySize == 0)
+  {
+    return;
+  }
+
+  std::vector<unsigned char> binary(binarySize);
+  unsigned char *            binaryData = binary.data();
+  errid = clGetProgramInfo(m_Program, CL_PROGRAM_BINARIES, sizeof(unsigned char *), &binaryData, nullptr);
+  if (errid != CL_SUCCESS)
+  {
+    return;
+  }
+
+  std::ofstream outputStream(fileName.c_str(), std::ios::binary | std::ios::trunc);
+  if (!outputStream)
+  {
+    itkWarningMacro("Cannot write OpenCL program binary cache file: " << fileName);
+    return;
+  }
+  outputStream.write(reinterpret_cast<const char *>(binary.data()), static_cast<std::streamsize>(binary.size()));
+}
+
 int
 GPUKernelManager::CreateKernel(const char * kernelName)
 {
@@ -0,0 +1,117 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+/**
+ * Test program for the itkGPUImageStatistics class.
+ * The device-side statistics are checked against a CPU computation.
+ */
+#include "itkGPUImageStatistics.h"
+#include "itkMath.h"
+
+#include <algorithm>
+#include <vector>
+
+int
+itkGPUImageStatisticsTest(int argc, char * argv[])
+{
+  if (argc > 2)
+  {
+    std::cout << "received " << argc << " arguments, but didn't expect any more than 1."
+              << "first ignored argument: " << argv[2] << std::endl;
+  }
+  int numPixels = 256 * 256 - 1917;
+  if (argc > 1)
+  {
+    numPixels = std::stoi(argv[1]);
+  }
+
+  using ElementType = float;
+
+  // create input with known statistics
+  std::vector<ElementType> h_idata(numPixels);
+  double                   cpuSum = 0.0;
+  double                   cpuSumOfSquares = 0.0;
+  for (int ii = 0; ii < numPixels; ++ii)
+  {
+    h_idata[ii] = static_cast<ElementType>((ii * 7919) % 257) - 128.0f;
+    cpuSum += h_idata[ii];
+    cpuSumOfSquares += static_cast<double>(h_idata[ii]) * h_idata[ii];
+  }
+  const ElementType cpuMinimum = *std::min_element(h_idata.begin(), h_idata.end());
+  const ElementType cpuMaximum = *std::max_element(h_idata.begin(), h_idata.end());
+
+  auto inputData = itk::GPUDataManager::New();
+  inputData->SetBufferSize(numPixels * sizeof(ElementType));
+  inputData->SetCPUBufferPointer(h_idata.data());
+  inputData->Allocate();
+  inputData->SetGPUDirtyFlag(true);
+
+  auto statistics = itk::GPUImageStatistics<ElementType>::New();
+  statistics->Compute(inputData, numPixels);
+
+  int status = EXIT_SUCCESS;
+
+  if (itk::Math::NotExactlyEquals(statistics->GetMinimum(), cpuMinimum) ||
+      itk::Math::NotExactlyEquals(statistics->GetMaximum(), cpuMaximum))
+  {
+    std::cout << "Expected minimum/maximum " << cpuMinimum << "/" << cpuMaximum << ", GPUImageStatistics computed "
+              << statistics->GetMinimum() << "/" << statistics->GetMaximum() << " which is wrong." << std::endl;
+    status = EXIT_FAILURE;
+  }
+
+  // the partial sums are combined in a different order than the CPU loop
+  const double sumTolerance = 1e-6 * std::abs(cpuSumOfSquares);
+  if (std::abs(statistics->GetSum() - cpuSum) > sumTolerance ||
+      std::abs(statistics->GetSumOfSquares() - cpuSumOfSquares) > sumTolerance)
+  {
+    std::cout << "Expected sum/sum-of-squares " << cpuSum << "/" << cpuSumOfSquares << ", GPUImageStatistics computed "
+              << statistics->GetSum() << "/" << statistics->GetSumOfSquares() << " which is wrong." << std::endl;
+    status = EXIT_FAILURE;
+  }
+
+  const double cpuMean = cpuSum / numPixels;
+  const double cpuVariance = (cpuSumOfSquares - (cpuSum * cpuSum / numPixels)) / (numPixels - 1.0);
+  if (std::abs(statistics->GetMean() - cpuMean) > 1e-6 * std::abs(cpuMean) ||
+      std::abs(statistics->GetVariance() - cpuVariance) > 1e-6 * std::abs(cpuVariance) ||
+      std::abs(statistics->GetSigma() - std::sqrt(cpuVariance)) > 1e-6 * std::sqrt(cpuVariance))
+  {
+    std::cout << "Expected mean/variance " << cpuMean << "/" << cpuVariance << ", GPUImageStatistics computed "
+              << statistics->GetMean() << "/" << statistics->GetVariance() << " which is wrong." << std::endl;
+    status = EXIT_FAILURE;
+  }
+
+  // a second pass over the same buffer must reuse the partial buffers
+  statistics->Compute(inputData, numPixels);
+  if (itk::Math::NotExactlyEquals(statistics->GetMinimum(), cpuMinimum) ||
+      itk::Math::NotExactlyEquals(statistics->GetMaximum(), cpuMaximum))
+  {
+    std::cout << "Recomputation changed the minimum/maximum." << std::endl;
+    status = EXIT_FAILURE;
+  }
+
+  if (status == EXIT_SUCCESS)
+  {
+    std::cout << "GPU statistics passed, mean = " << statistics->GetMean() << ", sigma = " << statistics->GetSigma()
+              << ", numPixels = " << numPixels << std::endl;
+  }
+
+  statistics = nullptr; // explicit GPU object destruction test
+  inputData = nullptr;
+
+  return status;
+}
@@ -66,7 +66,6 @@ namespace itk
  * \sa BSplineResampleImageFunction
  *
  * \ingroup ImageFilters
- * \ingroup SingleThreaded
  * \ingroup CannotBeStreamed
  * \ingroup ITKImageFunction
  */
@@ -156,6 +155,12 @@ private:
   virtual bool
   DataToCoefficients1D();
 
+  /** Thread-safe overload of DataToCoefficients1D.  The line being processed
+   *  is passed explicitly so that concurrent lines do not share the member
+   *  scratch space. */
+  bool
+  DataToCoefficients1D(CoefficientsVectorType & scratch, unsigned int direction) const;
+
   /** Converts an N-dimension image of data to an equivalent sized image
    *    of spline coefficients. */
   void
@@ -165,11 +170,19 @@ private:
   virtual void
   SetInitialCausalCoefficient(double z);
 
+  /** Thread-safe overload of SetInitialCausalCoefficient. */
+  void
+  SetInitialCausalCoefficient(double z, CoefficientsVectorType & scratch, unsigned int direction) const;
+
   /** Determines the first coefficient for the anti-causal filtering of the
     data. */
   virtual void
   SetInitialAntiCausalCoefficient(double z);
 
+  /** Thread-safe overload of SetInitialAntiCausalCoefficient. */
+  void
+  SetInitialAntiCausalCoefficient(double z, CoefficientsVectorType & scratch, unsigned int direction) const;
+
   /** Copy the input image into the output image.
    *  Used to initialize the Coefficients image before calculation. */
   void
@@ -180,11 +193,19 @@ private:
   void
   CopyCoefficientsToScratch(OutputLinearIterator &);
 
+  /** Thread-safe overload of CopyCoefficientsToScratch. */
+  static void
+  CopyCoefficientsToScratch(OutputLinearIterator & iter, CoefficientsVectorType & scratch);
+
   /** Copies a vector of data from the scratch to the Coefficients image
    *  (one line of the output image). */
   void
   CopyScratchToCoefficients(OutputLinearIterator &);
 
+  /** Thread-safe overload of CopyScratchToCoefficients. */
+  static void
+  CopyScratchToCoefficients(OutputLinearIterator & iter, const CoefficientsVectorType & scratch);
+
   // Variables needed by the smoothing spline routine.
 
   /** Temporary storage for processing of Coefficients. */
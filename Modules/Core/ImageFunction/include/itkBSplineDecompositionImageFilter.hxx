@@ -29,7 +29,8 @@
 #define itkBSplineDecompositionImageFilter_hxx
 #include "itkBSplineDecompositionImageFilter.h"
 #include "itkImageAlgorithm.h"
-#include "itkProgressReporter.h"
+#include "itkMultiThreaderBase.h"
+#include "itkProgressTransformer.h"
 #include "itkVector.h"
 #include "itkPrintHelper.h"
 
@@ -116,6 +117,56 @@ BSplineDecompositionImageFilter<TInputImage, TOutputImage>::DataToCoefficients1D
   return true;
 }
 
+template <typename TInputImage, typename TOutputImage>
+bool
+BSplineDecompositionImageFilter<TInputImage, TOutputImage>::DataToCoefficients1D(CoefficientsVectorType & scratch,
+                                                                                unsigned int direction) const
+{
+  // See Unser, 1993, Part II, Equation 2.5,
+  // or Unser, 1999, Box 2. for an explanation.
+
+  double c0 = 1.0;
+
+  if (m_DataLength[direction] == 1) // Required by mirror boundaries
+  {
+    return false;
+  }
+
+  // Compute over all gain
+  for (int k = 0; k < m_NumberOfPoles; ++k)
+  {
+    // Note for cubic splines lambda = 6
+    c0 = c0 * (1.0 - m_SplinePoles[k]) * (1.0 - 1.0 / m_SplinePoles[k]);
+  }
+
+  // Apply the gain
+  for (unsigned int n = 0; n < m_DataLength[direction]; ++n)
+  {
+    scratch[n] *= c0;
+  }
+
+  // Loop over all poles
+  for (int k = 0; k < m_NumberOfPoles; ++k)
+  {
+    // Causal initialization
+    this->SetInitialCausalCoefficient(m_SplinePoles[k], scratch, direction);
+    // Causal recursion
+    for (unsigned int n = 1; n < m_DataLength[direction]; ++n)
+    {
+      scratch[n] += m_SplinePoles[k] * scratch[n - 1];
+    }
+
+    // anticausal initialization
+    this->SetInitialAntiCausalCoefficient(m_SplinePoles[k], scratch, direction);
+    // anticausal recursion
+    for (int n = m_DataLength[direction] - 2; 0 <= n; n--)
+    {
+      scratch[n] = m_SplinePoles[k] * (scratch[n + 1] - scratch[n]);
+    }
+  }
+  return true;
+}
+
 template <typename TInputImage, typename TOutputImage>
 void
 BSplineDecompositionImageFilter<TInputImage, TOutputImage>::SetSplineOrder(unsigned int SplineOrder)
@@ -218,6 +269,53 @@ BSplineDecompositionImageFilter<TInputImage, TOutputImage>::SetInitialCausalCoef
   }
 }
 
+template <typename TInputImage, typename TOutputImage>
+void
+BSplineDecompositionImageFilter<TInputImage, TOutputImage>::SetInitialCausalCoefficient(
+  double                   z,
+  CoefficientsVectorType & scratch,
+  unsigned int             direction) const
+{
+  // See Unser, 1999, Box 2 for explanation
+  CoeffType                           sum;
+  double                              zn, z2n, iz;
+  typename TInputImage::SizeValueType horizon;
+
+  // Yhis initialization corresponds to mirror boundaries
+  horizon = m_DataLength[direction];
+  zn = z;
+  if (m_Tolerance > 0.0)
+  {
+    horizon = (typename TInputImage::SizeValueType)std::ceil(std::log(m_Tolerance) / std::log(std::fabs(z)));
+  }
+  if (horizon < m_DataLength[direction])
+  {
+    // Accelerated loop
+    sum = scratch[0]; // verify this
+    for (unsigned int n = 1; n < horizon; ++n)
+    {
+      sum += zn * scratch[n];
+      zn *= z;
+    }
+    scratch[0] = sum;
+  }
+  else
+  {
+    // Full loop
+    iz = 1.0 / z;
+    z2n = std::pow(z, (double)(m_DataLength[direction] - 1L));
+    sum = scratch[0] + z2n * scratch[m_DataLength[direction] - 1L];
+    z2n *= z2n * iz;
+    for (unsigned int n = 1; n <= (m_DataLength[direction] - 2); ++n)
+    {
+      sum += (zn + z2n) * scratch[n];
+      zn *= z;
+      z2n *= iz;
+    }
+    scratch[0] = sum / (1.0 - zn * zn);
+  }
+}
+
 template <typename TInputImage, typename TOutputImage>
 void
 BSplineDecompositionImageFilter<TInputImage, TOutputImage>::SetInitialAntiCausalCoefficient(double z)
@@ -230,45 +328,77 @@ BSplineDecompositionImageFilter<TInputImage, TOutputImage>::SetInitialAntiCausal
     (z * m_Scratch[m_DataLength[m_IteratorDirection] - 2] + m_Scratch[m_DataLength[m_IteratorDirection] - 1]);
 }
 
+template <typename TInputImage, typename TOutputImage>
+void
+BSplineDecompositionImageFilter<TInputImage, TOutputImage>::SetInitialAntiCausalCoefficient(
+  double                   z,
+  CoefficientsVectorType & scratch,
+  unsigned int             direction) const
+{
+  // This initialization corresponds to mirror boundaries.
+  // See Unser, 1999, Box 2 for explanation.
+  // Also see erratum at http://bigwww.epfl.ch/publications/unser9902.html
+  scratch[m_DataLength[direction] - 1] =
+    (z / (z * z - 1.0)) * (z * scratch[m_DataLength[direction] - 2] + scratch[m_DataLength[direction] - 1]);
+}
+
 template <typename TInputImage, typename TOutputImage>
 void
 BSplineDecompositionImageFilter<TInputImage, TOutputImage>::DataToCoefficientsND()
 {
   OutputImagePointer output = this->GetOutput();
 
-  Size<ImageDimension> size = output->GetBufferedRegion().GetSize();
-
-  unsigned int count = output->GetBufferedRegion().GetNumberOfPixels() / size[0] * ImageDimension;
-
-  ProgressReporter progress(this, 0, count, 10);
+  const typename TOutputImage::RegionType bufferedRegion = output->GetBufferedRegion();
 
   // Initialize coeffient array
   this->CopyImageToImage(); // Coefficients are initialized to the input data
 
+  float oldProgress = 0.0f;
+
   // Loop through each dimension
   for (unsigned int n = 0; n < ImageDimension; ++n)
   {
-    m_IteratorDirection = n;
-
-    // Initialize iterators
-    OutputLinearIterator CIterator(output, output->GetBufferedRegion());
-    CIterator.SetDirection(m_IteratorDirection);
-    // For each data vector
-    while (!CIterator.IsAtEnd())
-    {
-      // Copy coefficients to scratch
-      this->CopyCoefficientsToScratch(CIterator);
-
-      // Perform 1D BSpline calculations
-      this->DataToCoefficients1D();
-
-      // Copy scratch back to coefficients.
-      // Brings us back to the end of the line we were working on.
-      CIterator.GoToBeginOfLine();
-      this->CopyScratchToCoefficients(CIterator); // m_Scratch = m_Image;
-      CIterator.NextLine();
-      progress.CompletedPixel();
-    }
+    // The lines along the current dimension are independent of each other, so
+    // parallelize over a region collapsed along that dimension and have each
+    // work unit process whole lines with its own scratch space.
+    typename TOutputImage::RegionType collapsedRegion = bufferedRegion;
+    collapsedRegion.SetSize(n, 1);
+
+    const float         newProgress = float(n + 1) / ImageDimension;
+    ProgressTransformer progressTransformer(oldProgress, newProgress, this);
+
+    this->GetMultiThreader()->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+    this->GetMultiThreader()->template ParallelizeImageRegion<ImageDimension>(
+      collapsedRegion,
+      [this, &output, &bufferedRegion, n](const typename TOutputImage::RegionType & planeRegion) {
+        CoefficientsVectorType scratch(this->m_DataLength[n]);
+
+        typename TOutputImage::RegionType lineRegion = planeRegion;
+        lineRegion.SetSize(n, bufferedRegion.GetSize(n));
+        lineRegion.SetIndex(n, bufferedRegion.GetIndex(n));
+
+        // Initialize iterators
+        OutputLinearIterator CIterator(output, lineRegion);
+        CIterator.SetDirection(n);
+        // For each data vector
+        while (!CIterator.IsAtEnd())
+        {
+          // Copy coefficients to scratch
+          Self::CopyCoefficientsToScratch(CIterator, scratch);
+
+          // Perform 1D BSpline calculations
+          this->DataToCoefficients1D(scratch, n);
+
+          // Copy scratch back to coefficients.
+          // Brings us back to the end of the line we were working on.
+          CIterator.GoToBeginOfLine();
+          Self::CopyScratchToCoefficients(CIterator, scratch);
+          CIterator.NextLine();
+        }
+      },
+      progressTransformer.GetProcessObject());
+
+    oldProgress = newProgress;
   }
 }
 
@@ -295,6 +425,22 @@ BSplineDecompositionImageFilter<TInputImage, TOutputImage>::CopyScratchToCoeffic
   }
 }
 
+template <typename TInputImage, typename TOutputImage>
+void
+BSplineDecompositionImageFilter<TInputImage, TOutputImage>::CopyScratchToCoefficients(
+  OutputLinearIterator &         iter,
+  const CoefficientsVectorType & scratch)
+{
+  using OutputPixelType = typename TOutputImage::PixelType;
+  typename TOutputImage::SizeValueType j = 0;
+  while (!iter.IsAtEndOfLine())
+  {
+    iter.Set(static_cast<OutputPixelType>(scratch[j]));
+    ++iter;
+    ++j;
+  }
+}
+
 /**
  */
 template <typename TInputImage, typename TOutputImage>
@@ -311,6 +457,21 @@ BSplineDecompositionImageFilter<TInputImage, TOutputImage>::CopyCoefficientsToSc
   }
 }
 
+template <typename TInputImage, typename TOutputImage>
+void
+BSplineDecompositionImageFilter<TInputImage, TOutputImage>::CopyCoefficientsToScratch(OutputLinearIterator &   iter,
+                                                                                     CoefficientsVectorType & scratch)
+{
+  typename TOutputImage::SizeValueType j = 0;
+
+  while (!iter.IsAtEndOfLine())
+  {
+    scratch[j] = static_cast<CoeffType>(iter.Get());
+    ++iter;
+    ++j;
+  }
+}
+
 template <typename TInputImage, typename TOutputImage>
 void
 BSplineDecompositionImageFilter<TInputImage, TOutputImage>::GenerateInputRequestedRegion()
@@ -372,6 +372,15 @@ private:
   void
   GeneratePointsToIndex();
 
+  /** Compute the coefficient image for the given input, or fetch it from a
+   *  cache shared by all interpolator instances of this type.  The cache is
+   *  keyed on (image, modified time, spline order); time stamps are globally
+   *  unique in ITK, so a key can never alias a different image state.  This
+   *  avoids redundant decomposition passes when several interpolators (e.g.
+   *  per-thread copies in a metric) are connected to the same image. */
+  typename CoefficientImageType::ConstPointer
+  ComputeCoefficients(const TImageType * inputData);
+
   /** Determines the indices to use give the splines region of support */
   void
   DetermineRegionOfSupport(vnl_matrix<long> &          evaluateIndex,
@@ -37,6 +37,8 @@
 
 #include "itkMatrix.h"
 
+#include <mutex>
+
 namespace itk
 {
 /**
@@ -92,10 +94,7 @@ BSplineInterpolateImageFunction<TImageType, TCoordRep, TCoefficientType>::SetInp
 {
   if (inputData)
   {
-    m_CoefficientFilter->SetInput(inputData);
-
-    m_CoefficientFilter->Update();
-    m_Coefficients = m_CoefficientFilter->GetOutput();
+    m_Coefficients = this->ComputeCoefficients(inputData);
 
     // Call the Superclass implementation after, in case the filter
     // pulls in  more of the input image
@@ -109,6 +108,65 @@ BSplineInterpolateImageFunction<TImageType, TCoordRep, TCoefficientType>::SetInp
   }
 }
 
+template <typename TImageType, typename TCoordRep, typename TCoefficientType>
+typename BSplineInterpolateImageFunction<TImageType, TCoordRep, TCoefficientType>::CoefficientImageType::ConstPointer
+BSplineInterpolateImageFunction<TImageType, TCoordRep, TCoefficientType>::ComputeCoefficients(
+  const TImageType * inputData)
+{
+  struct CacheEntry
+  {
+    // The image pointer is a key only, never dereferenced, so the cache does
+    // not extend the lifetime of input images.  A destroyed image can never
+    // be confused with a later one at the same address because modified
+    // times are drawn from a global, monotonically increasing counter.
+    const TImageType *                          Image;
+    ModifiedTimeType                            ImageMTime;
+    unsigned int                                SplineOrder;
+    typename CoefficientImageType::ConstPointer Coefficients;
+  };
+
+  // Bounds the number of coefficient images kept alive by the cache.
+  constexpr std::size_t cacheCapacity = 8;
+
+  static std::mutex              cacheMutex;
+  static std::vector<CacheEntry> cache;
+
+  const ModifiedTimeType imageMTime = inputData->GetMTime();
+
+  {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    for (const CacheEntry & entry : cache)
+    {
+      if (entry.Image == inputData && entry.ImageMTime == imageMTime && entry.SplineOrder == m_SplineOrder)
+      {
+        return entry.Coefficients;
+      }
+    }
+  }
+
+  m_CoefficientFilter->SetInput(inputData);
+  m_CoefficientFilter->Update();
+
+  typename CoefficientImageType::Pointer coefficients = m_CoefficientFilter->GetOutput();
+
+  // Detach the coefficients from the mini-pipeline so a later decomposition
+  // performed by this instance cannot overwrite the shared buffer.
+  coefficients->DisconnectPipeline();
+
+  {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    if (cache.size() >= cacheCapacity)
+    {
+      // Drop the oldest entry.
+      cache.erase(cache.begin());
+    }
+    cache.push_back(
+      CacheEntry{ inputData, imageMTime, m_SplineOrder, typename CoefficientImageType::ConstPointer(coefficients) });
+  }
+
+  return coefficients.GetPointer();
+}
+
 template <typename TImageType, typename TCoordRep, typename TCoefficientType>
 void
 BSplineInterpolateImageFunction<TImageType, TCoordRep, TCoefficientType>::SetSplineOrder(unsigned int SplineOrder)
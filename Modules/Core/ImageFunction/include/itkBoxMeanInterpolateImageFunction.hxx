@@ -0,0 +1,138 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#ifndef itkBoxMeanInterpolateImageFunction_hxx
+#define itkBoxMeanInterpolateImageFunction_hxx
+
+#include "itkBoxMeanInterpolateImageFunction.h"
+
+#include "itkImageRegionConstIteratorWithIndex.h"
+#include "itkMath.h"
+
+namespace itk
+{
+
+template <typename TInputImage, typename TCoordRep>
+BoxMeanInterpolateImageFunction<TInputImage, TCoordRep>::BoxMeanInterpolateImageFunction()
+{
+  this->m_BoxRadius.Fill(0.5);
+}
+
+template <typename TInputImage, typename TCoordRep>
+auto
+BoxMeanInterpolateImageFunction<TInputImage, TCoordRep>::ComputeInterpolationRegion(
+  const ContinuousIndexType & cindex) const -> RegionType
+{
+  RegionType region = this->GetInputImage()->GetBufferedRegion();
+  for (unsigned int d = 0; d < ImageDimension; ++d)
+  {
+    // Voxel i covers [i - 0.5, i + 0.5]; it overlaps the box when
+    // i > cindex - radius - 0.5 and i < cindex + radius + 0.5.
+    TCoordRep      cBegin = cindex[d] - this->m_BoxRadius[d] + 0.5;
+    IndexValueType begin = std::max(region.GetIndex()[d], static_cast<IndexValueType>(std::floor(cBegin)));
+    TCoordRep      cEnd = cindex[d] + this->m_BoxRadius[d] + 0.5;
+    SizeValueType  end =
+      std::min(region.GetIndex()[d] + region.GetSize()[d], static_cast<SizeValueType>(std::ceil(cEnd)));
+    region.SetIndex(d, begin);
+    region.SetSize(d, end - begin);
+  }
+  return region;
+}
+
+template <typename TInputImage, typename TCoordRep>
+void
+BoxMeanInterpolateImageFunction<TInputImage, TCoordRep>::ComputeOverlapArray(
+  const RegionType &     region,
+  unsigned int           dimension,
+  RealType               cindex,
+  vnl_vector<RealType> & overlapArray) const
+{
+  overlapArray.set_size(region.GetSize()[dimension]);
+
+  const RealType low = cindex - this->m_BoxRadius[dimension];
+  const RealType high = cindex + this->m_BoxRadius[dimension];
+
+  for (unsigned int i = 0; i < region.GetSize()[dimension]; ++i)
+  {
+    const RealType voxelLow = static_cast<RealType>(region.GetIndex()[dimension] + static_cast<IndexValueType>(i)) - 0.5;
+    const RealType voxelHigh = voxelLow + 1.0;
+    const RealType overlap = std::min(high, voxelHigh) - std::max(low, voxelLow);
+    overlapArray[i] = (overlap > 0.0 ? overlap : 0.0);
+  }
+}
+
+template <typename TInputImage, typename TCoordRep>
+auto
+BoxMeanInterpolateImageFunction<TInputImage, TCoordRep>::EvaluateAtContinuousIndex(
+  const ContinuousIndexType & cindex) const -> OutputType
+{
+  vnl_vector<RealType> overlapArray[ImageDimension];
+
+  RegionType region = this->ComputeInterpolationRegion(cindex);
+
+  // Compute the covered voxel fractions along every dimension; the weight of
+  // a voxel is the product of its per-dimension fractions
+  for (unsigned int d = 0; d < ImageDimension; ++d)
+  {
+    this->ComputeOverlapArray(region, d, cindex[d], overlapArray[d]);
+  }
+
+  RealType sum_me = 0.0;
+  RealType sum_m = 0.0;
+
+  ImageRegionConstIteratorWithIndex<InputImageType> It(this->GetInputImage(), region);
+  for (It.GoToBegin(); !It.IsAtEnd(); ++It)
+  {
+    RealType w = overlapArray[0][It.GetIndex()[0] - region.GetIndex()[0]];
+    for (unsigned int d = 1; d < ImageDimension; ++d)
+    {
+      w *= overlapArray[d][It.GetIndex()[d] - region.GetIndex()[d]];
+    }
+    sum_me += static_cast<RealType>(It.Get()) * w;
+    sum_m += w;
+  }
+
+  // Normalizing by the accumulated weight (rather than the box volume) keeps
+  // the result a true mean when the box is clipped by the buffer boundary
+  return sum_me / sum_m;
+}
+
+template <typename TInputImage, typename TCoordRep>
+auto
+BoxMeanInterpolateImageFunction<TInputImage, TCoordRep>::GetRadius() const -> SizeType
+{
+  SizeType radius;
+
+  for (unsigned int dim = 0; dim < ImageDimension; ++dim)
+  {
+    radius[dim] = static_cast<SizeValueType>(Math::ceil(this->m_BoxRadius[dim] + 0.5));
+  }
+  return radius;
+}
+
+template <typename TInputImage, typename TCoordRep>
+void
+BoxMeanInterpolateImageFunction<TInputImage, TCoordRep>::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "BoxRadius: " << this->m_BoxRadius << std::endl;
+}
+} // namespace itk
+
+#endif
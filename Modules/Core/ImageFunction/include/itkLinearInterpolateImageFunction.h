@@ -18,9 +18,12 @@
 #ifndef itkLinearInterpolateImageFunction_h
 #define itkLinearInterpolateImageFunction_h
 
+#include "itkImage.h"
 #include "itkInterpolateImageFunction.h"
 #include "itkVariableLengthVector.h"
 
+#include <type_traits> // For integral_constant and is_same.
+
 namespace itk
 {
 /**
@@ -122,6 +125,14 @@ private:
   struct Dispatch : public DispatchBase
   {};
 
+  /** True when the input image is a plain itk::Image, whose pixels can be
+   * addressed directly in the buffer through the offset table.  Image types
+   * with proxied pixel access (e.g. VectorImage) keep the generic GetPixel
+   * based access. */
+  using InputImageHasContiguousBuffer =
+    std::integral_constant<bool,
+                           std::is_same<TInputImage, Image<typename TInputImage::PixelType, ImageDimension>>::value>;
+
   inline OutputType
   EvaluateOptimized(const Dispatch<0> &, const ContinuousIndexType &) const
   {
@@ -176,6 +187,14 @@ private:
     }
     const InternalComputationType & distance1 = index[1] - static_cast<InternalComputationType>(basei[1]);
 
+    // Interior fast path: all four neighbors are in bounds, which is the
+    // common case when resampling.  The arithmetic is the same as in the
+    // fall-through case below, only the pixel addressing differs.
+    if (distance0 > 0. && distance1 > 0. && basei[0] < this->m_EndIndex[0] && basei[1] < this->m_EndIndex[1])
+    {
+      return this->EvaluateInterior(InputImageHasContiguousBuffer(), basei, distance0, distance1);
+    }
+
     const TInputImage * const inputImagePtr = this->GetInputImage();
     const RealType &          val00 = inputImagePtr->GetPixel(basei);
     if (distance0 <= 0. && distance1 <= 0.)
@@ -259,6 +278,15 @@ private:
     }
     const InternalComputationType & distance2 = index[2] - static_cast<InternalComputationType>(basei[2]);
 
+    // Interior fast path: all eight neighbors are in bounds, which is the
+    // common case when resampling.  The arithmetic is the same as in the
+    // full trilinear case below, only the pixel addressing differs.
+    if (distance0 > 0. && distance1 > 0. && distance2 > 0. && basei[0] < this->m_EndIndex[0] &&
+        basei[1] < this->m_EndIndex[1] && basei[2] < this->m_EndIndex[2])
+    {
+      return this->EvaluateInterior(InputImageHasContiguousBuffer(), basei, distance0, distance1, distance2);
+    }
+
     const TInputImage * const inputImagePtr = this->GetInputImage();
     const RealType &          val000 = inputImagePtr->GetPixel(basei);
     if (distance0 <= 0. && distance1 <= 0. && distance2 <= 0.)
@@ -501,6 +529,125 @@ private:
     return this->EvaluateUnoptimized(index);
   }
 
+  /** Bilinear interpolation with all four neighbors known to be in bounds.
+   * The first overload addresses the corners directly in the pixel buffer;
+   * the second is the generic GetPixel based equivalent. */
+  inline OutputType
+  EvaluateInterior(std::true_type,
+                   const IndexType &               basei,
+                   const InternalComputationType & distance0,
+                   const InternalComputationType & distance1) const
+  {
+    const TInputImage * const inputImagePtr = this->GetInputImage();
+
+    const typename TInputImage::PixelType * const buffer = inputImagePtr->GetBufferPointer();
+    const OffsetValueType * const                 offsetTable = inputImagePtr->GetOffsetTable();
+    const OffsetValueType                         offset = inputImagePtr->ComputeOffset(basei);
+
+    const RealType val00 = buffer[offset];
+    const RealType val10 = buffer[offset + 1];
+    const RealType val01 = buffer[offset + offsetTable[1]];
+    const RealType val11 = buffer[offset + offsetTable[1] + 1];
+
+    const RealType valx0 = val00 + (val10 - val00) * distance0;
+    const RealType valx1 = val01 + (val11 - val01) * distance0;
+
+    return (static_cast<OutputType>(valx0 + (valx1 - valx0) * distance1));
+  }
+
+  inline OutputType
+  EvaluateInterior(std::false_type,
+                   IndexType                       basei,
+                   const InternalComputationType & distance0,
+                   const InternalComputationType & distance1) const
+  {
+    const TInputImage * const inputImagePtr = this->GetInputImage();
+
+    const RealType & val00 = inputImagePtr->GetPixel(basei);
+    ++basei[0];
+    const RealType & val10 = inputImagePtr->GetPixel(basei);
+    ++basei[1];
+    const RealType & val11 = inputImagePtr->GetPixel(basei);
+    --basei[0];
+    const RealType & val01 = inputImagePtr->GetPixel(basei);
+
+    const RealType & valx0 = val00 + (val10 - val00) * distance0;
+    const RealType & valx1 = val01 + (val11 - val01) * distance0;
+
+    return (static_cast<OutputType>(valx0 + (valx1 - valx0) * distance1));
+  }
+
+  /** Trilinear interpolation with all eight neighbors known to be in bounds.
+   * Overloads as for the bilinear case above. */
+  inline OutputType
+  EvaluateInterior(std::true_type,
+                   const IndexType &               basei,
+                   const InternalComputationType & distance0,
+                   const InternalComputationType & distance1,
+                   const InternalComputationType & distance2) const
+  {
+    const TInputImage * const inputImagePtr = this->GetInputImage();
+
+    const typename TInputImage::PixelType * const buffer = inputImagePtr->GetBufferPointer();
+    const OffsetValueType * const                 offsetTable = inputImagePtr->GetOffsetTable();
+    const OffsetValueType                         offset = inputImagePtr->ComputeOffset(basei);
+
+    const RealType val000 = buffer[offset];
+    const RealType val100 = buffer[offset + 1];
+    const RealType val010 = buffer[offset + offsetTable[1]];
+    const RealType val110 = buffer[offset + offsetTable[1] + 1];
+    const RealType val001 = buffer[offset + offsetTable[2]];
+    const RealType val101 = buffer[offset + offsetTable[2] + 1];
+    const RealType val011 = buffer[offset + offsetTable[1] + offsetTable[2]];
+    const RealType val111 = buffer[offset + offsetTable[1] + offsetTable[2] + 1];
+
+    const RealType valx00 = val000 + (val100 - val000) * distance0;
+    const RealType valx10 = val010 + (val110 - val010) * distance0;
+    const RealType valxx0 = valx00 + (valx10 - valx00) * distance1;
+
+    const RealType valx01 = val001 + (val101 - val001) * distance0;
+    const RealType valx11 = val011 + (val111 - val011) * distance0;
+    const RealType valxx1 = valx01 + (valx11 - valx01) * distance1;
+
+    return (static_cast<OutputType>(valxx0 + (valxx1 - valxx0) * distance2));
+  }
+
+  inline OutputType
+  EvaluateInterior(std::false_type,
+                   IndexType                       basei,
+                   const InternalComputationType & distance0,
+                   const InternalComputationType & distance1,
+                   const InternalComputationType & distance2) const
+  {
+    const TInputImage * const inputImagePtr = this->GetInputImage();
+
+    const RealType & val000 = inputImagePtr->GetPixel(basei);
+    ++basei[0];
+    const RealType & val100 = inputImagePtr->GetPixel(basei);
+    ++basei[1];
+    const RealType & val110 = inputImagePtr->GetPixel(basei);
+    --basei[0];
+    const RealType & val010 = inputImagePtr->GetPixel(basei);
+    ++basei[2];
+    const RealType & val011 = inputImagePtr->GetPixel(basei);
+    ++basei[0];
+    const RealType & val111 = inputImagePtr->GetPixel(basei);
+    --basei[1];
+    const RealType & val101 = inputImagePtr->GetPixel(basei);
+    --basei[0];
+    const RealType & val001 = inputImagePtr->GetPixel(basei);
+
+    const RealType & valx00 = val000 + (val100 - val000) * distance0;
+    const RealType & valx10 = val010 + (val110 - val010) * distance0;
+    const RealType & valxx0 = valx00 + (valx10 - valx00) * distance1;
+
+    const RealType & valx01 = val001 + (val101 - val001) * distance0;
+    const RealType & valx11 = val011 + (val111 - val011) * distance0;
+    const RealType & valxx1 = valx01 + (valx11 - valx01) * distance1;
+
+    return (static_cast<OutputType>(valxx0 + (valxx1 - valxx0) * distance2));
+  }
+
   /** Evaluate interpolator at image index position. */
   virtual inline OutputType
   EvaluateUnoptimized(const ContinuousIndexType & index) const;
@@ -0,0 +1,95 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkImage.h"
+#include "itkBoxMeanInterpolateImageFunction.h"
+#include "itkMath.h"
+#include "itkTestingMacros.h"
+#include "itkIndexRange.h"
+
+int
+itkBoxMeanInterpolateImageFunctionTest(int, char *[])
+{
+  using ImageType = itk::Image<float, 2>;
+  using InterpolatorType = itk::BoxMeanInterpolateImageFunction<ImageType, double>;
+
+  auto interpolator = InterpolatorType::New();
+
+  ITK_EXERCISE_BASIC_OBJECT_METHODS(interpolator, BoxMeanInterpolateImageFunction, InterpolateImageFunction);
+
+  InterpolatorType::ArrayType radius;
+  radius.Fill(1.0);
+  interpolator->SetBoxRadius(radius);
+  ITK_TEST_SET_GET_VALUE(radius, interpolator->GetBoxRadius());
+
+  auto image = ImageType::New();
+
+  ImageType::SizeType size;
+  size.Fill(6);
+
+  ImageType::RegionType region;
+  region.SetSize(size);
+
+  image->SetRegions(region);
+  image->Allocate();
+
+  for (const auto index : itk::ZeroBasedIndexRange<ImageType::ImageDimension>(size))
+  {
+    image->SetPixel(index, index[0] + 10 * index[1]);
+  }
+
+  interpolator->SetInputImage(image);
+
+  for (unsigned int d = 0; d < ImageType::ImageDimension; ++d)
+  {
+    ITK_TEST_EXPECT_EQUAL(2, interpolator->GetRadius()[d]);
+  }
+
+  // A box of half-width 1 centered on a voxel covers a 2x2 voxel area
+  // symmetrically; the mean of the linear ramp is the center value
+  InterpolatorType::ContinuousIndexType cindex;
+  cindex[0] = 2.0;
+  cindex[1] = 3.0;
+  ITK_TEST_EXPECT_TRUE(itk::Math::FloatAlmostEqual(32.0, interpolator->EvaluateAtContinuousIndex(cindex), 10, 1e-9));
+
+  // A box of half-width 0.5 centered between two voxels averages exactly
+  // those two voxels
+  interpolator->SetBoxRadius(0.5);
+  cindex[0] = 2.5;
+  cindex[1] = 3.0;
+  ITK_TEST_EXPECT_TRUE(itk::Math::FloatAlmostEqual(32.5, interpolator->EvaluateAtContinuousIndex(cindex), 10, 1e-9));
+
+  // A box of half-width 1.5 centered on a voxel covers a 3x3 voxel area
+  // exactly; the mean over constant rows/columns of a ramp is again the
+  // center value
+  interpolator->SetBoxRadius(1.5);
+  cindex[0] = 3.0;
+  cindex[1] = 2.0;
+  ITK_TEST_EXPECT_TRUE(itk::Math::FloatAlmostEqual(23.0, interpolator->EvaluateAtContinuousIndex(cindex), 10, 1e-9));
+
+  // At the corner the box is clipped by the buffer; the result is the mean
+  // of the remaining 2x2 quadrant
+  cindex[0] = 0.0;
+  cindex[1] = 0.0;
+  const double expectedCorner = (0.0 + 1.0 + 10.0 + 11.0) / 4.0;
+  ITK_TEST_EXPECT_TRUE(
+    itk::Math::FloatAlmostEqual(expectedCorner, interpolator->EvaluateAtContinuousIndex(cindex), 10, 1e-9));
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,233 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkTiledBinaryMask3DMeshSource_h
+#define itkTiledBinaryMask3DMeshSource_h
+
+#include "itkBinaryMask3DMeshSource.h"
+
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace itk
+{
+/** \class TiledBinaryMask3DMeshSource
+ *
+ * \brief Tiled, parallel surface extraction from a 3D binary mask.
+ *
+ * This mesh source produces the same surface as BinaryMask3DMeshSource,
+ * but decomposes the region into tiles, extracts the per-tile surfaces
+ * concurrently, and welds the tile meshes into a single output mesh.
+ * Neighboring tiles overlap by one voxel layer, so the marching cells
+ * are partitioned between them; the vertices the tiles share on their
+ * common faces are identified by their location on the voxel grid (the
+ * surface vertices lie on half-integer continuous indices) and merged
+ * through a hash of those grid keys.
+ *
+ * With UseStreaming enabled the tiles are additionally requested from
+ * the upstream pipeline one at a time before extraction, so a labeled
+ * volume larger than memory can be meshed through a streaming-capable
+ * reader. In that mode the upstream pipeline executes per tile and the
+ * extraction is serialized with the I/O; in the default mode the input
+ * must be buffered and the tiles are extracted in parallel over the
+ * work units of the MultiThreaderBase.
+ *
+ * \sa BinaryMask3DMeshSource
+ *
+ * \ingroup MeshSources
+ * \ingroup ITKMesh
+ */
+template <typename TInputImage, typename TOutputMesh>
+class ITK_TEMPLATE_EXPORT TiledBinaryMask3DMeshSource : public ImageToMeshFilter<TInputImage, TOutputMesh>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(TiledBinaryMask3DMeshSource);
+
+  /** Standard "Self" type alias. */
+  using Self = TiledBinaryMask3DMeshSource;
+  using Superclass = ImageToMeshFilter<TInputImage, TOutputMesh>;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(TiledBinaryMask3DMeshSource, ImageToMeshFilter);
+
+  /** Hold on to the type information specified by the template parameters. */
+  using OutputMeshType = TOutputMesh;
+  using OMeshTraits = typename OutputMeshType::MeshTraits;
+  using OPointType = typename OutputMeshType::PointType;
+  using OPixelType = typename OMeshTraits::PixelType;
+
+  /** Some convenient type alias. */
+  using OutputMeshPointer = typename OutputMeshType::Pointer;
+  using CellTraits = typename OutputMeshType::CellTraits;
+  using PointIdentifier = typename OutputMeshType::PointIdentifier;
+  using CellIdentifier = typename OutputMeshType::CellIdentifier;
+
+  /** The triangular cell type which forms the surface. */
+  using TCellInterface = CellInterface<OPixelType, CellTraits>;
+  using TriCell = TriangleCell<TCellInterface>;
+  using TriCellAutoPointer = typename TriCell::SelfAutoPointer;
+
+  /** Input Image Type Definition. */
+  using InputImageType = TInputImage;
+  using InputImagePointer = typename InputImageType::Pointer;
+  using InputImageConstPointer = typename InputImageType::ConstPointer;
+  using InputPixelType = typename InputImageType::PixelType;
+  using RegionType = typename InputImageType::RegionType;
+  using SizeType = typename InputImageType::SizeType;
+  using InputImageIndexType = typename InputImageType::IndexType;
+
+  /** The per-tile mesh source. */
+  using TileMeshSourceType = BinaryMask3DMeshSource<InputImageType, OutputMeshType>;
+
+  itkSetMacro(ObjectValue, InputPixelType);
+  itkGetConstMacro(ObjectValue, InputPixelType);
+
+  itkGetConstMacro(NumberOfNodes, SizeValueType);
+  itkGetConstMacro(NumberOfCells, SizeValueType);
+
+  /** Set/Get the size of the tiles the region is decomposed into. */
+  itkSetMacro(TileSize, SizeType);
+  itkGetConstReferenceMacro(TileSize, SizeType);
+
+  /** Set/Get whether the tiles are requested from the upstream pipeline
+   * one at a time. With streaming on, only one tile of the input has to
+   * be buffered at a time, but the upstream pipeline executes per tile
+   * and the extraction runs serially; the default is off, which expects
+   * a buffered input and extracts the tiles in parallel. */
+  itkSetMacro(UseStreaming, bool);
+  itkGetConstMacro(UseStreaming, bool);
+  itkBooleanMacro(UseStreaming);
+
+  /** accept the input image */
+  using Superclass::SetInput;
+  virtual void
+  SetInput(const InputImageType * image);
+
+  void
+  SetRegionOfInterest(const RegionType & iRegion)
+  {
+    if (iRegion != m_RegionOfInterest)
+    {
+      this->m_RegionOfInterest = iRegion;
+      this->m_RegionOfInterestProvidedByUser = true;
+      this->Modified();
+    }
+  }
+
+  itkGetConstReferenceMacro(RegionOfInterest, RegionType);
+
+protected:
+  TiledBinaryMask3DMeshSource();
+  ~TiledBinaryMask3DMeshSource() override = default;
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+  void
+  GenerateData() override;
+
+  void
+  GenerateOutputInformation() override
+  {} // do nothing override
+
+  /** With streaming on, only the first tile is requested from the
+   * input; GenerateData() requests and updates the remaining tiles one
+   * at a time. The default requests the whole input. */
+  void
+  GenerateInputRequestedRegion() override;
+
+  bool       m_RegionOfInterestProvidedByUser{ false };
+  RegionType m_RegionOfInterest;
+
+private:
+  /** Surface vertices lie on half-integer continuous indices of the
+   * voxel grid, so doubling the continuous index and rounding yields an
+   * exact integer key that identifies coincident vertices across tiles. */
+  using GridKeyType = std::array<int64_t, 3>;
+
+  struct GridKeyHash
+  {
+    std::size_t
+    operator()(const GridKeyType & key) const
+    {
+      std::size_t hash = static_cast<std::size_t>(key[0]);
+      hash = hash * 73856093u + static_cast<std::size_t>(key[1]);
+      hash = hash * 19349663u + static_cast<std::size_t>(key[2]);
+      return hash;
+    }
+  };
+
+  /** Sorted global point identifiers of a triangle, used to drop the
+   * duplicate faces the one-voxel tile overlap can produce. */
+  using TriangleKeyType = std::array<PointIdentifier, 3>;
+
+  struct TriangleKeyHash
+  {
+    std::size_t
+    operator()(const TriangleKeyType & key) const
+    {
+      std::size_t hash = static_cast<std::size_t>(key[0]);
+      hash = hash * 73856093u + static_cast<std::size_t>(key[1]);
+      hash = hash * 19349663u + static_cast<std::size_t>(key[2]);
+      return hash;
+    }
+  };
+
+  using PointIdMapType = std::unordered_map<GridKeyType, PointIdentifier, GridKeyHash>;
+  using TriangleSetType = std::unordered_set<TriangleKeyType, TriangleKeyHash>;
+
+  /** Merge a tile mesh into the output, welding shared vertices. The
+   * node and cell counts come from the tile mesh source, since the
+   * containers of its output mesh are pre-allocated beyond them. */
+  void
+  WeldTileMesh(const OutputMeshType * tileMesh,
+               SizeValueType          numberOfTileNodes,
+               SizeValueType          numberOfTileCells,
+               PointIdMapType &       pointIdMap,
+               TriangleSetType &      triangleSet);
+
+  /** Region the surface is extracted from, honoring the user region of
+   * interest and the streaming setting. */
+  RegionType
+  ComputeExtractionRegion();
+
+  /** Decompose the extraction region into tiles overlapping by one
+   * voxel layer in each positive direction. */
+  std::vector<RegionType>
+  ComputeTileRegions(const RegionType & region) const;
+
+  InputPixelType m_ObjectValue;
+  SizeType       m_TileSize;
+  bool           m_UseStreaming{ false };
+
+  SizeValueType m_NumberOfNodes{ 0 };
+  SizeValueType m_NumberOfCells{ 0 };
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkTiledBinaryMask3DMeshSource.hxx"
+#endif
+
+#endif
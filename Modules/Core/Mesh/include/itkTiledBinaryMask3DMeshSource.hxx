@@ -0,0 +1,299 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkTiledBinaryMask3DMeshSource_hxx
+#define itkTiledBinaryMask3DMeshSource_hxx
+
+#include "itkTiledBinaryMask3DMeshSource.h"
+#include "itkContinuousIndex.h"
+#include "itkMath.h"
+#include "itkMultiThreaderBase.h"
+
+#include <algorithm>
+
+namespace itk
+{
+template <typename TInputImage, typename TOutputMesh>
+TiledBinaryMask3DMeshSource<TInputImage, TOutputMesh>::TiledBinaryMask3DMeshSource()
+  : m_ObjectValue(NumericTraits<InputPixelType>::OneValue())
+{
+  this->SetNumberOfRequiredInputs(1);
+
+  SizeType size;
+  size.Fill(0);
+  m_RegionOfInterest.SetSize(size);
+
+  m_TileSize.Fill(64);
+}
+
+template <typename TInputImage, typename TOutputMesh>
+void
+TiledBinaryMask3DMeshSource<TInputImage, TOutputMesh>::SetInput(const InputImageType * image)
+{
+  this->ProcessObject::SetNthInput(0, const_cast<InputImageType *>(image));
+}
+
+template <typename TInputImage, typename TOutputMesh>
+auto
+TiledBinaryMask3DMeshSource<TInputImage, TOutputMesh>::ComputeExtractionRegion() -> RegionType
+{
+  const InputImageType * input = this->GetInput(0);
+
+  RegionType region;
+  if (m_UseStreaming)
+  {
+    region = input->GetLargestPossibleRegion();
+  }
+  else
+  {
+    region = input->GetBufferedRegion();
+  }
+
+  if (m_RegionOfInterestProvidedByUser)
+  {
+    RegionType regionOfInterest = m_RegionOfInterest;
+    regionOfInterest.Crop(region);
+    region = regionOfInterest;
+  }
+
+  return region;
+}
+
+template <typename TInputImage, typename TOutputMesh>
+auto
+TiledBinaryMask3DMeshSource<TInputImage, TOutputMesh>::ComputeTileRegions(const RegionType & region) const
+  -> std::vector<RegionType>
+{
+  const InputImageIndexType regionIndex = region.GetIndex();
+  const SizeType            regionSize = region.GetSize();
+
+  SizeType tileSize;
+  SizeType numberOfTiles;
+  for (unsigned int dimension = 0; dimension < 3; ++dimension)
+  {
+    tileSize[dimension] = std::max(m_TileSize[dimension], SizeValueType{ 1 });
+    numberOfTiles[dimension] = (regionSize[dimension] + tileSize[dimension] - 1) / tileSize[dimension];
+  }
+
+  // Each tile is padded by one voxel layer in each positive direction,
+  // so the marching cells spanning two tiles are produced exactly once,
+  // by the tile containing their lower corner
+  std::vector<RegionType> tileRegions;
+  tileRegions.reserve(numberOfTiles[0] * numberOfTiles[1] * numberOfTiles[2]);
+
+  RegionType tileRegion;
+  for (SizeValueType tz = 0; tz < numberOfTiles[2]; ++tz)
+  {
+    for (SizeValueType ty = 0; ty < numberOfTiles[1]; ++ty)
+    {
+      for (SizeValueType tx = 0; tx < numberOfTiles[0]; ++tx)
+      {
+        const SizeValueType tile[3] = { tx, ty, tz };
+
+        InputImageIndexType tileIndex;
+        SizeType            size;
+        for (unsigned int dimension = 0; dimension < 3; ++dimension)
+        {
+          const SizeValueType offset = tile[dimension] * tileSize[dimension];
+          tileIndex[dimension] = regionIndex[dimension] + static_cast<IndexValueType>(offset);
+          size[dimension] = std::min(tileSize[dimension] + 1, regionSize[dimension] - offset);
+        }
+        tileRegion.SetIndex(tileIndex);
+        tileRegion.SetSize(size);
+        tileRegions.push_back(tileRegion);
+      }
+    }
+  }
+
+  return tileRegions;
+}
+
+template <typename TInputImage, typename TOutputMesh>
+void
+TiledBinaryMask3DMeshSource<TInputImage, TOutputMesh>::GenerateInputRequestedRegion()
+{
+  if (!m_UseStreaming)
+  {
+    Superclass::GenerateInputRequestedRegion();
+    return;
+  }
+
+  auto * input = const_cast<InputImageType *>(this->GetInput(0));
+  if (input)
+  {
+    // Only the first tile is requested here; the remaining tiles are
+    // requested and updated one at a time in GenerateData()
+    const std::vector<RegionType> tileRegions = this->ComputeTileRegions(this->ComputeExtractionRegion());
+    if (!tileRegions.empty())
+    {
+      input->SetRequestedRegion(tileRegions.front());
+    }
+  }
+}
+
+template <typename TInputImage, typename TOutputMesh>
+void
+TiledBinaryMask3DMeshSource<TInputImage, TOutputMesh>::GenerateData()
+{
+  auto * input = const_cast<InputImageType *>(this->GetInput(0));
+  if (!input)
+  {
+    itkExceptionMacro(<< "Missing input image");
+  }
+
+  const RegionType              region = this->ComputeExtractionRegion();
+  const std::vector<RegionType> tileRegions = this->ComputeTileRegions(region);
+
+  std::vector<OutputMeshPointer> tileMeshes(tileRegions.size());
+  std::vector<SizeValueType>     tileNodeCounts(tileRegions.size());
+  std::vector<SizeValueType>     tileCellCounts(tileRegions.size());
+
+  auto extractTile = [this, input, &tileRegions, &tileMeshes, &tileNodeCounts, &tileCellCounts](SizeValueType tile) {
+    // A facade sharing the input pixel buffer keeps each per-tile
+    // mini-pipeline independent of the shared upstream pipeline
+    InputImagePointer facade = InputImageType::New();
+    facade->Graft(input);
+
+    typename TileMeshSourceType::Pointer tileSource = TileMeshSourceType::New();
+    tileSource->SetInput(facade);
+    tileSource->SetObjectValue(this->m_ObjectValue);
+    tileSource->SetRegionOfInterest(tileRegions[tile]);
+    tileSource->Update();
+
+    tileMeshes[tile] = tileSource->GetOutput();
+    tileMeshes[tile]->DisconnectPipeline();
+    tileNodeCounts[tile] = tileSource->GetNumberOfNodes();
+    tileCellCounts[tile] = tileSource->GetNumberOfCells();
+  };
+
+  if (m_UseStreaming)
+  {
+    // The upstream pipeline produces one tile at a time; extraction is
+    // serialized with the I/O
+    for (SizeValueType tile = 0; tile < tileRegions.size(); ++tile)
+    {
+      input->SetRequestedRegion(tileRegions[tile]);
+      input->PropagateRequestedRegion();
+      input->UpdateOutputData();
+
+      extractTile(tile);
+    }
+  }
+  else
+  {
+    this->GetMultiThreader()->ParallelizeArray(0, static_cast<SizeValueType>(tileRegions.size()), extractTile, this);
+  }
+
+  // Weld the tile meshes serially in tile order, so the output point
+  // and cell identifiers do not depend on the number of work units
+  this->m_NumberOfNodes = 0;
+  this->m_NumberOfCells = 0;
+
+  PointIdMapType  pointIdMap;
+  TriangleSetType triangleSet;
+  for (SizeValueType tile = 0; tile < tileRegions.size(); ++tile)
+  {
+    this->WeldTileMesh(tileMeshes[tile], tileNodeCounts[tile], tileCellCounts[tile], pointIdMap, triangleSet);
+  }
+
+  this->GetOutput()->SetBufferedRegion(this->GetOutput()->GetRequestedRegion());
+}
+
+template <typename TInputImage, typename TOutputMesh>
+void
+TiledBinaryMask3DMeshSource<TInputImage, TOutputMesh>::WeldTileMesh(const OutputMeshType * tileMesh,
+                                                                    SizeValueType          numberOfTileNodes,
+                                                                    SizeValueType          numberOfTileCells,
+                                                                    PointIdMapType &       pointIdMap,
+                                                                    TriangleSetType &      triangleSet)
+{
+  const InputImageType * input = this->GetInput(0);
+  OutputMeshType *       output = this->GetOutput();
+
+  using PointValueType = typename OPointType::ValueType;
+  using ContinuousIndexType = ContinuousIndex<PointValueType, 3>;
+
+  // Map the points of the tile into global identifiers, welding the
+  // vertices the tile shares with previously merged neighbors
+  std::vector<PointIdentifier> localToGlobal(numberOfTileNodes);
+
+  for (SizeValueType node = 0; node < numberOfTileNodes; ++node)
+  {
+    OPointType point;
+    tileMesh->GetPoint(static_cast<PointIdentifier>(node), &point);
+
+    ContinuousIndexType continuousIndex;
+    input->TransformPhysicalPointToContinuousIndex(point, continuousIndex);
+
+    // The vertices lie on half-integer continuous indices, so doubling
+    // and rounding yields an exact grid key
+    GridKeyType key;
+    for (unsigned int dimension = 0; dimension < 3; ++dimension)
+    {
+      key[dimension] = Math::Round<int64_t>(2.0 * continuousIndex[dimension]);
+    }
+
+    const auto insertion = pointIdMap.emplace(key, static_cast<PointIdentifier>(this->m_NumberOfNodes));
+    if (insertion.second)
+    {
+      output->SetPoint(static_cast<PointIdentifier>(this->m_NumberOfNodes), point);
+      ++this->m_NumberOfNodes;
+    }
+    localToGlobal[node] = insertion.first->second;
+  }
+
+  for (SizeValueType cellId = 0; cellId < numberOfTileCells; ++cellId)
+  {
+    const auto * cell = tileMesh->GetCells()->GetElement(static_cast<CellIdentifier>(cellId));
+
+    PointIdentifier globalIds[3];
+    unsigned int    pointCount = 0;
+    for (auto pointIdIterator = cell->PointIdsBegin(); pointIdIterator != cell->PointIdsEnd() && pointCount < 3;
+         ++pointIdIterator)
+    {
+      globalIds[pointCount++] = localToGlobal[*pointIdIterator];
+    }
+
+    // Drop the duplicate faces the one-voxel tile overlap can produce
+    TriangleKeyType triangleKey{ { globalIds[0], globalIds[1], globalIds[2] } };
+    std::sort(triangleKey.begin(), triangleKey.end());
+    if (triangleSet.insert(triangleKey).second)
+    {
+      typename TriCell::CellAutoPointer triangle;
+      triangle.TakeOwnership(new TriCell);
+      triangle->SetPointIds(globalIds);
+      output->SetCell(static_cast<CellIdentifier>(this->m_NumberOfCells), triangle);
+      ++this->m_NumberOfCells;
+    }
+  }
+}
+
+template <typename TInputImage, typename TOutputMesh>
+void
+TiledBinaryMask3DMeshSource<TInputImage, TOutputMesh>::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+  os << indent << "ObjectValue: " << static_cast<typename NumericTraits<InputPixelType>::PrintType>(m_ObjectValue)
+     << std::endl;
+  os << indent << "TileSize: " << m_TileSize << std::endl;
+  os << indent << "UseStreaming: " << (m_UseStreaming ? "On" : "Off") << std::endl;
+  os << indent << "NumberOfNodes: " << m_NumberOfNodes << std::endl;
+  os << indent << "NumberOfCells: " << m_NumberOfCells << std::endl;
+}
+} // end namespace itk
+
+#endif
@@ -35,6 +35,11 @@ namespace itk
  * Meshes that have added information like normal vector on the points, will
  * have to take care of transforming this data by other means.
  *
+ * The points are transformed in parallel over the work units of the
+ * MultiThreaderBase, so the transform must support concurrent
+ * TransformPoint calls, as it does during metric evaluation in the
+ * registration framework.
+ *
  * \ingroup MeshFilters
  * \ingroup ITKMesh
  */
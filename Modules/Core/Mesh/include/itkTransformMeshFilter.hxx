@@ -20,6 +20,8 @@
 
 #include "itkTransformMeshFilter.h"
 #include "itkMacro.h"
+#include "itkMultiThreaderBase.h"
+#include <vector>
 
 namespace itk
 {
@@ -86,14 +88,38 @@ TransformMeshFilter<TInputMesh, TOutputMesh, TTransform>::GenerateData()
   outPoints->Squeeze(); // in case the previous mesh had
                         // allocated a larger memory
 
-  typename InputPointsContainer::ConstIterator inputPoint = inPoints->Begin();
-  typename OutputPointsContainer::Iterator     outputPoint = outPoints->Begin();
+  // Snapshot the input points in iteration order, so that the transform
+  // can be applied in parallel regardless of the points container type
+  std::vector<typename TInputMesh::PointType> inputPointArray;
+  inputPointArray.reserve(inputMesh->GetNumberOfPoints());
 
+  typename InputPointsContainer::ConstIterator inputPoint = inPoints->Begin();
   while (inputPoint != inPoints->End())
   {
-    outputPoint.Value() = m_Transform->TransformPoint(inputPoint.Value());
-
+    inputPointArray.push_back(inputPoint.Value());
     ++inputPoint;
+  }
+
+  // The transform must support concurrent TransformPoint calls, as it
+  // does during metric evaluation in the registration framework. Each
+  // point is transformed independently, so the result is identical to
+  // the serial sweep.
+  std::vector<typename TOutputMesh::PointType> transformedPointArray(inputPointArray.size());
+  this->GetMultiThreader()->ParallelizeArray(
+    0,
+    static_cast<SizeValueType>(inputPointArray.size()),
+    [this, &inputPointArray, &transformedPointArray](SizeValueType i) {
+      transformedPointArray[i] = m_Transform->TransformPoint(inputPointArray[i]);
+    },
+    this);
+
+  typename OutputPointsContainer::Iterator outputPoint = outPoints->Begin();
+
+  SizeValueType transformedPointIndex = 0;
+  while (outputPoint != outPoints->End())
+  {
+    outputPoint.Value() = transformedPointArray[transformedPointIndex];
+    ++transformedPointIndex;
     ++outputPoint;
   }
 
@@ -0,0 +1,168 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include <iostream>
+
+#include "itkTiledBinaryMask3DMeshSource.h"
+#include "itkTestingMacros.h"
+
+int
+itkTiledBinaryMask3DMeshSourceTest(int, char *[])
+{
+  constexpr unsigned int Dimension = 3;
+
+  using ImageType = itk::Image<unsigned short, Dimension>;
+  using MeshType = itk::Mesh<double>;
+  using MeshSourceType = itk::BinaryMask3DMeshSource<ImageType, MeshType>;
+  using TiledMeshSourceType = itk::TiledBinaryMask3DMeshSource<ImageType, MeshType>;
+
+  constexpr ImageType::PixelType backgroundValue = 0;
+  constexpr ImageType::PixelType internalValue = 1;
+
+  ImageType::SizeType size;
+  size.Fill(32);
+
+  ImageType::IndexType start;
+  start.Fill(0);
+
+  ImageType::RegionType region;
+  region.SetSize(size);
+  region.SetIndex(start);
+
+  auto image = ImageType::New();
+  image->SetRegions(region);
+  image->Allocate();
+  image->FillBuffer(backgroundValue);
+
+  // A 20x20x20 solid box away from the image boundary, crossing the
+  // tile boundaries of the tile sizes exercised below
+  ImageType::IndexType index;
+  for (index[2] = 6; index[2] < 26; ++index[2])
+  {
+    for (index[1] = 6; index[1] < 26; ++index[1])
+    {
+      for (index[0] = 6; index[0] < 26; ++index[0])
+      {
+        image->SetPixel(index, internalValue);
+      }
+    }
+  }
+
+  // Reference surface from the monolithic mesh source
+  auto meshSource = MeshSourceType::New();
+  meshSource->SetInput(image);
+  meshSource->SetObjectValue(internalValue);
+  ITK_TRY_EXPECT_NO_EXCEPTION(meshSource->Update());
+
+  const itk::SizeValueType referenceNodes = meshSource->GetNumberOfNodes();
+  const itk::SizeValueType referenceCells = meshSource->GetNumberOfCells();
+  if (referenceNodes == 0 || referenceCells == 0)
+  {
+    std::cerr << "Test failed!" << std::endl;
+    std::cerr << "Reference mesh source produced an empty mesh" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  auto tiledMeshSource = TiledMeshSourceType::New();
+
+  ITK_EXERCISE_BASIC_OBJECT_METHODS(tiledMeshSource, TiledBinaryMask3DMeshSource, ImageToMeshFilter);
+
+  tiledMeshSource->SetInput(image);
+
+  tiledMeshSource->SetObjectValue(internalValue);
+  ITK_TEST_SET_GET_VALUE(internalValue, tiledMeshSource->GetObjectValue());
+
+  ImageType::SizeType tileSize;
+  tileSize.Fill(16);
+  tiledMeshSource->SetTileSize(tileSize);
+  ITK_TEST_SET_GET_VALUE(tileSize, tiledMeshSource->GetTileSize());
+
+  auto useStreaming = false;
+  ITK_TEST_SET_GET_BOOLEAN(tiledMeshSource, UseStreaming, useStreaming);
+
+  ITK_TRY_EXPECT_NO_EXCEPTION(tiledMeshSource->Update());
+
+  if (tiledMeshSource->GetNumberOfNodes() != referenceNodes || tiledMeshSource->GetNumberOfCells() != referenceCells)
+  {
+    std::cerr << "Test failed!" << std::endl;
+    std::cerr << "Tiled extraction differs from the monolithic one" << std::endl;
+    std::cerr << "Expected " << referenceNodes << " nodes and " << referenceCells << " cells, but got "
+              << tiledMeshSource->GetNumberOfNodes() << " nodes and " << tiledMeshSource->GetNumberOfCells()
+              << " cells" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The welded surface must not depend on the tile decomposition
+  auto oddTiledMeshSource = TiledMeshSourceType::New();
+  oddTiledMeshSource->SetInput(image);
+  oddTiledMeshSource->SetObjectValue(internalValue);
+  tileSize.Fill(13);
+  oddTiledMeshSource->SetTileSize(tileSize);
+  ITK_TRY_EXPECT_NO_EXCEPTION(oddTiledMeshSource->Update());
+
+  if (oddTiledMeshSource->GetNumberOfNodes() != referenceNodes ||
+      oddTiledMeshSource->GetNumberOfCells() != referenceCells)
+  {
+    std::cerr << "Test failed!" << std::endl;
+    std::cerr << "Tiled extraction depends on the tile size" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Streaming mode requests the tiles one at a time; with a buffered
+  // input it must still produce the same surface
+  auto streamedMeshSource = TiledMeshSourceType::New();
+  streamedMeshSource->SetInput(image);
+  streamedMeshSource->SetObjectValue(internalValue);
+  tileSize.Fill(16);
+  streamedMeshSource->SetTileSize(tileSize);
+  streamedMeshSource->UseStreamingOn();
+  ITK_TRY_EXPECT_NO_EXCEPTION(streamedMeshSource->Update());
+
+  if (streamedMeshSource->GetNumberOfNodes() != referenceNodes ||
+      streamedMeshSource->GetNumberOfCells() != referenceCells)
+  {
+    std::cerr << "Test failed!" << std::endl;
+    std::cerr << "Streamed extraction differs from the monolithic one" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Restricting the region of interest to the empty image corner must
+  // produce an empty mesh
+  auto croppedMeshSource = TiledMeshSourceType::New();
+  croppedMeshSource->SetInput(image);
+  croppedMeshSource->SetObjectValue(internalValue);
+
+  ImageType::RegionType regionOfInterest;
+  size.Fill(5);
+  regionOfInterest.SetSize(size);
+  regionOfInterest.SetIndex(start);
+  croppedMeshSource->SetRegionOfInterest(regionOfInterest);
+  ITK_TEST_SET_GET_VALUE(regionOfInterest, croppedMeshSource->GetRegionOfInterest());
+
+  ITK_TRY_EXPECT_NO_EXCEPTION(croppedMeshSource->Update());
+
+  if (croppedMeshSource->GetNumberOfCells() != 0)
+  {
+    std::cerr << "Test failed!" << std::endl;
+    std::cerr << "Region of interest was not honored" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
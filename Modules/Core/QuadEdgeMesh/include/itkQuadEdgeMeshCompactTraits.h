@@ -0,0 +1,113 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkQuadEdgeMeshCompactTraits_h
+#define itkQuadEdgeMeshCompactTraits_h
+
+#include <set>
+#include "itkCellInterface.h"
+#include "itkCompactVectorContainer.h"
+#include "itkQuadEdgeCellTraitsInfo.h"
+
+namespace itk
+{
+/**
+ *\class QuadEdgeMeshCompactTraits
+ *  \brief Traits of the QuadEdgeMesh with contiguous element storage.
+ *
+ *  This class is a variant of QuadEdgeMeshTraits that stores the points,
+ *  cells and their data in CompactVectorContainer instead of
+ *  MapContainer. The elements live in contiguous memory indexed by their
+ *  identifier, so sweeps over large meshes walk flat arrays instead of
+ *  chasing map nodes, while deletions — as performed by the decimation
+ *  and simplification filters — tombstone the container slot without
+ *  shifting the identifiers of the remaining elements.
+ *
+ *  \sa QuadEdgeMeshTraits
+ *  \sa CompactVectorContainer
+ * \ingroup ITKQuadEdgeMesh
+ */
+template <typename TPixel,
+          unsigned int VPointDimension,
+          typename TPData,
+          typename TDData,
+          typename TCoordRep = float,
+          typename TInterpolationWeight = float>
+class QuadEdgeMeshCompactTraits
+{
+public:
+  /** Basic types for a mesh trait class. */
+  using Self = QuadEdgeMeshCompactTraits;
+  using PixelType = TPixel;
+  using CellPixelType = TPixel;
+  using CoordRepType = TCoordRep;
+  using InterpolationWeightType = TInterpolationWeight;
+
+  static constexpr unsigned int PointDimension = VPointDimension;
+  static constexpr unsigned int MaxTopologicalDimension = VPointDimension;
+
+  using PointIdentifier = ::itk::IdentifierType;
+  using CellIdentifier = ::itk::IdentifierType;
+
+  using CellFeatureIdentifier = unsigned char; // made small in purpose
+
+  using UsingCellsContainer = std::set<CellIdentifier>;
+  using PointCellLinksContainer = std::set<CellIdentifier>;
+
+  /** Quad edge type alias. */
+  using PrimalDataType = TPData;
+  using DualDataType = TDData;
+  using QEPrimal = GeometricalQuadEdge<PointIdentifier, CellIdentifier, PrimalDataType, DualDataType>;
+  using QEDual = typename QEPrimal::DualType;
+  using VertexRefType = typename QEPrimal::OriginRefType;
+  using FaceRefType = typename QEPrimal::DualOriginRefType;
+
+  /** The type of point used for hashing.  This should never change from
+   * this setting, regardless of the mesh type. */
+  using PointHashType = Point<CoordRepType, VPointDimension>;
+
+  /** Points have an entry in the Onext ring */
+  using PointType = QuadEdgeMeshPoint<CoordRepType, VPointDimension, QEPrimal>;
+  using PointsContainer = CompactVectorContainer<PointIdentifier, PointType>;
+
+  /** Standard cell interface. */
+  using CellTraits = QuadEdgeMeshCellTraitsInfo<VPointDimension,
+                                                CoordRepType,
+                                                InterpolationWeightType,
+                                                PointIdentifier,
+                                                CellIdentifier,
+                                                CellFeatureIdentifier,
+                                                PointType,
+                                                PointsContainer,
+                                                UsingCellsContainer,
+                                                QEPrimal>;
+
+  using CellType = CellInterface<CellPixelType, CellTraits>;
+  using CellAutoPointer = typename CellType::CellAutoPointer;
+
+  /** Containers types. */
+  using CellLinksContainer = CompactVectorContainer<PointIdentifier, PointCellLinksContainer>;
+  using CellsContainer = CompactVectorContainer<CellIdentifier, CellType *>;
+  using PointDataContainer = CompactVectorContainer<PointIdentifier, PixelType>;
+  using CellDataContainer = CompactVectorContainer<CellIdentifier, CellPixelType>;
+
+  /** Other useful types. */
+  using VectorType = typename PointType::VectorType;
+};
+} // namespace itk
+
+#endif
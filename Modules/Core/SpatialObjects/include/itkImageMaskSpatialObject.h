@@ -21,6 +21,10 @@
 #include "itkImageSpatialObject.h"
 #include "itkImageSliceConstIteratorWithIndex.h"
 
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
 namespace itk
 {
 /**
@@ -77,6 +81,28 @@ public:
   bool
   IsInsideInObjectSpace(const PointType & point) const override;
 
+  /** Occupancy of an image region with respect to the mask. */
+  enum class RegionOccupancy : uint8_t
+  {
+    AllOutside,
+    Mixed,
+    AllInside
+  };
+
+  /** Classify a region of the image index space as entirely foreground
+   * (AllInside), entirely background (AllOutside), or Mixed. Pixels
+   * outside the buffered region count as background, matching
+   * IsInsideInObjectSpace.
+   *
+   * The classification is backed by a coarse occupancy grid built once
+   * per modification of the mask; only the pixels of mixed blocks
+   * straddling the region border are scanned, so block-sized interior
+   * regions are answered in constant time. Samplers iterating a masked
+   * domain can classify whole tiles through this method and skip the
+   * per-point inside tests for tiles that are not Mixed. */
+  RegionOccupancy
+  GetRegionOccupancyInIndexSpace(const RegionType & region) const;
+
   /* Avoid hiding the overload that supports depth and name arguments */
   using Superclass::IsInsideInObjectSpace;
 
@@ -116,6 +142,25 @@ protected:
 
   typename LightObject::Pointer
   InternalClone() const override;
+
+private:
+  /** Edge length of the cubic blocks of the occupancy grid. */
+  static constexpr SizeValueType OccupancyBlockSize = 16;
+
+  /** Rebuild the occupancy grid if the mask changed since it was last
+   * built. Thread-safe; concurrent queries only read the grid. */
+  void
+  UpdateOccupancyGrid() const;
+
+  /** One flag pair per block of the buffered region, built lazily and
+   * keyed to the modification time of the mask image. */
+  mutable std::mutex           m_OccupancyGridMutex;
+  mutable std::vector<uint8_t> m_BlockHasForeground;
+  mutable std::vector<uint8_t> m_BlockHasBackground;
+  mutable SizeType             m_OccupancyGridSize;
+  mutable RegionType           m_OccupancyGridRegion;
+  mutable const ImageType *    m_OccupancyGridImage{ nullptr };
+  mutable ModifiedTimeType     m_OccupancyGridTime{ 0 };
 };
 } // end of namespace itk
 
@@ -21,6 +21,7 @@
 #include "itkMath.h"
 #include "itkImageMaskSpatialObject.h"
 #include "itkImageRegionRange.h"
+#include "itkMultiThreaderBase.h"
 
 #include <cstdint> // For uintmax_t.
 
@@ -49,6 +50,197 @@ ImageMaskSpatialObject<TDimension, TPixel>::IsInsideInObjectSpace(const PointTyp
 }
 
 
+template <unsigned int TDimension, typename TPixel>
+void
+ImageMaskSpatialObject<TDimension, TPixel>::UpdateOccupancyGrid() const
+{
+  const ImageType * const image = this->GetImage();
+
+  const std::lock_guard<std::mutex> lockGuard(m_OccupancyGridMutex);
+  if (image == m_OccupancyGridImage && image->GetMTime() == m_OccupancyGridTime)
+  {
+    return;
+  }
+
+  m_OccupancyGridRegion = image->GetBufferedRegion();
+  const SizeType  regionSize = m_OccupancyGridRegion.GetSize();
+  const IndexType regionIndex = m_OccupancyGridRegion.GetIndex();
+
+  SizeValueType numberOfBlocks = 1;
+  for (unsigned int dimension = 0; dimension < TDimension; ++dimension)
+  {
+    m_OccupancyGridSize[dimension] = (regionSize[dimension] + OccupancyBlockSize - 1) / OccupancyBlockSize;
+    numberOfBlocks *= m_OccupancyGridSize[dimension];
+  }
+
+  m_BlockHasForeground.assign(numberOfBlocks, 0);
+  m_BlockHasBackground.assign(numberOfBlocks, 0);
+
+  if (numberOfBlocks > 0)
+  {
+    MultiThreaderBase::New()->ParallelizeArray(
+      0,
+      numberOfBlocks,
+      [this, image, &regionSize, &regionIndex](SizeValueType block) {
+        RegionType    blockRegion;
+        SizeValueType remainder = block;
+        for (unsigned int dimension = 0; dimension < TDimension; ++dimension)
+        {
+          const SizeValueType blockCoordinate = remainder % m_OccupancyGridSize[dimension];
+          remainder /= m_OccupancyGridSize[dimension];
+
+          const SizeValueType offset = blockCoordinate * OccupancyBlockSize;
+          const SizeValueType remaining = regionSize[dimension] - offset;
+          blockRegion.SetIndex(dimension, regionIndex[dimension] + static_cast<IndexValueType>(offset));
+          blockRegion.SetSize(dimension, remaining < OccupancyBlockSize ? remaining : OccupancyBlockSize);
+        }
+
+        constexpr auto zeroValue = NumericTraits<PixelType>::ZeroValue();
+        bool           hasForeground = false;
+        bool           hasBackground = false;
+        for (const PixelType pixelValue : ImageRegionRange<const ImageType>{ *image, blockRegion })
+        {
+          if (pixelValue != zeroValue)
+          {
+            hasForeground = true;
+          }
+          else
+          {
+            hasBackground = true;
+          }
+          if (hasForeground && hasBackground)
+          {
+            break;
+          }
+        }
+        m_BlockHasForeground[block] = hasForeground ? 1 : 0;
+        m_BlockHasBackground[block] = hasBackground ? 1 : 0;
+      },
+      nullptr);
+  }
+
+  m_OccupancyGridImage = image;
+  m_OccupancyGridTime = image->GetMTime();
+}
+
+template <unsigned int TDimension, typename TPixel>
+auto
+ImageMaskSpatialObject<TDimension, TPixel>::GetRegionOccupancyInIndexSpace(const RegionType & region) const
+  -> RegionOccupancy
+{
+  const ImageType * const image = this->GetImage();
+  if (image == nullptr || region.GetNumberOfPixels() == 0)
+  {
+    return RegionOccupancy::AllOutside;
+  }
+
+  this->UpdateOccupancyGrid();
+
+  RegionType croppedRegion = region;
+  if (!croppedRegion.Crop(m_OccupancyGridRegion))
+  {
+    // No overlap with the buffered region, which only holds background
+    return RegionOccupancy::AllOutside;
+  }
+
+  bool hasForeground = false;
+  // Pixels outside the buffered region count as background
+  bool hasBackground = (croppedRegion != region);
+
+  const IndexType gridIndex = m_OccupancyGridRegion.GetIndex();
+
+  // Inclusive range of block coordinates overlapping the region
+  IndexType firstBlock;
+  IndexType lastBlock;
+  for (unsigned int dimension = 0; dimension < TDimension; ++dimension)
+  {
+    firstBlock[dimension] =
+      (croppedRegion.GetIndex(dimension) - gridIndex[dimension]) / static_cast<IndexValueType>(OccupancyBlockSize);
+    lastBlock[dimension] = (croppedRegion.GetIndex(dimension) +
+                            static_cast<IndexValueType>(croppedRegion.GetSize(dimension)) - 1 - gridIndex[dimension]) /
+                           static_cast<IndexValueType>(OccupancyBlockSize);
+  }
+
+  IndexType blockCoordinate = firstBlock;
+  while (!(hasForeground && hasBackground))
+  {
+    SizeValueType block = 0;
+    SizeValueType stride = 1;
+    for (unsigned int dimension = 0; dimension < TDimension; ++dimension)
+    {
+      block += static_cast<SizeValueType>(blockCoordinate[dimension]) * stride;
+      stride *= m_OccupancyGridSize[dimension];
+    }
+
+    if (m_BlockHasForeground[block] && !m_BlockHasBackground[block])
+    {
+      hasForeground = true;
+    }
+    else if (m_BlockHasBackground[block] && !m_BlockHasForeground[block])
+    {
+      hasBackground = true;
+    }
+    else
+    {
+      // Mixed block: conclusive as a whole only if the region covers
+      // it entirely; otherwise scan the overlapping pixels
+      RegionType blockRegion;
+      for (unsigned int dimension = 0; dimension < TDimension; ++dimension)
+      {
+        const SizeValueType offset = static_cast<SizeValueType>(blockCoordinate[dimension]) * OccupancyBlockSize;
+        const SizeValueType remaining = m_OccupancyGridRegion.GetSize(dimension) - offset;
+        blockRegion.SetIndex(dimension, gridIndex[dimension] + static_cast<IndexValueType>(offset));
+        blockRegion.SetSize(dimension, remaining < OccupancyBlockSize ? remaining : OccupancyBlockSize);
+      }
+
+      if (croppedRegion.IsInside(blockRegion))
+      {
+        hasForeground = true;
+        hasBackground = true;
+      }
+      else
+      {
+        blockRegion.Crop(croppedRegion);
+        constexpr auto zeroValue = NumericTraits<PixelType>::ZeroValue();
+        for (const PixelType pixelValue : ImageRegionRange<const ImageType>{ *image, blockRegion })
+        {
+          if (pixelValue != zeroValue)
+          {
+            hasForeground = true;
+          }
+          else
+          {
+            hasBackground = true;
+          }
+          if (hasForeground && hasBackground)
+          {
+            break;
+          }
+        }
+      }
+    }
+
+    // Advance to the next block coordinate in the range
+    unsigned int dimension = 0;
+    while (dimension < TDimension && blockCoordinate[dimension] == lastBlock[dimension])
+    {
+      blockCoordinate[dimension] = firstBlock[dimension];
+      ++dimension;
+    }
+    if (dimension == TDimension)
+    {
+      break;
+    }
+    ++blockCoordinate[dimension];
+  }
+
+  if (hasForeground)
+  {
+    return hasBackground ? RegionOccupancy::Mixed : RegionOccupancy::AllInside;
+  }
+  return RegionOccupancy::AllOutside;
+}
+
 template <unsigned int TDimension, typename TPixel>
 void
 ImageMaskSpatialObject<TDimension, TPixel>::ComputeMyBoundingBox()
@@ -156,17 +348,11 @@ ImageMaskSpatialObject<TDimension, TPixel>::ComputeMyBoundingBoxInIndexSpace() c
 
   const ImageType & image = *imagePointer;
 
-  const auto HasForegroundPixels = [&image](const RegionType & region) {
-    for (const PixelType pixelValue : ImageRegionRange<const ImageType>{ image, region })
-    {
-      constexpr auto zeroValue = NumericTraits<PixelType>::ZeroValue();
-
-      if (pixelValue != zeroValue)
-      {
-        return true;
-      }
-    }
-    return false;
+  // The occupancy grid answers the all-background slabs without
+  // touching their pixels; only the blocks straddling the mask border
+  // are scanned
+  const auto HasForegroundPixels = [this](const RegionType & region) {
+    return this->GetRegionOccupancyInIndexSpace(region) != RegionOccupancy::AllOutside;
   };
 
   const auto CreateRegion = [](const IndexType & minIndex, const IndexType & maxIndex) {
@@ -0,0 +1,186 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkSpatialObjectBoundingVolumeHierarchy_h
+#define itkSpatialObjectBoundingVolumeHierarchy_h
+
+#include "itkSpatialObject.h"
+
+#include <vector>
+
+namespace itk
+{
+/**
+ *\class SpatialObjectBoundingVolumeHierarchy
+ * \brief Bounding volume hierarchy over a SpatialObject tree for fast
+ *        point-membership queries.
+ *
+ * The methods of SpatialObject that evaluate a point against an object
+ * and its children (IsInsideInWorldSpace, ValueAtInWorldSpace, ...)
+ * test every child linearly, so queries against scenes with thousands
+ * of objects cost O(number of objects) per point. This class flattens
+ * an object hierarchy down to a chosen depth, records the axis-aligned
+ * world-space bounding box of every object (GetMyBoundingBoxInWorldSpace),
+ * and organizes the boxes into a binary bounding volume hierarchy, so a
+ * point query only evaluates the objects whose bounding boxes contain
+ * the point.
+ *
+ * The objects are recorded in the order the SpatialObject methods visit
+ * them (the object itself first, then its children depth-first), and
+ * candidates are reported in that order, so the first evaluable
+ * candidate is the same object the linear traversal would select. The
+ * queries therefore return the same answers as the SpatialObject
+ * methods, provided every object is evaluable only inside its
+ * world-space bounding box; objects that influence space beyond their
+ * spatial extent must not be queried through this index.
+ *
+ * The hierarchy must be up to date (Update() called after the last
+ * modification of the objects or their transforms) when Initialize()
+ * is invoked; the index is a snapshot and is not maintained across
+ * later modifications of the objects.
+ *
+ * All query methods are const and may be invoked concurrently from
+ * multiple threads once Initialize() has been called.
+ *
+ * \sa SpatialObject
+ * \sa SpatialObjectToImageFilter
+ *
+ * \ingroup ITKSpatialObjects
+ */
+template <unsigned int TDimension = 3>
+class ITK_TEMPLATE_EXPORT SpatialObjectBoundingVolumeHierarchy : public Object
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(SpatialObjectBoundingVolumeHierarchy);
+
+  /** Standard class type aliases. */
+  using Self = SpatialObjectBoundingVolumeHierarchy;
+  using Superclass = Object;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(SpatialObjectBoundingVolumeHierarchy, Object);
+
+  /** Dimension of the space the objects live in. */
+  static constexpr unsigned int ObjectDimension = TDimension;
+
+  using SpatialObjectType = SpatialObject<TDimension>;
+  using SpatialObjectConstPointer = typename SpatialObjectType::ConstPointer;
+  using PointType = typename SpatialObjectType::PointType;
+  using ChildrenConstListType = typename SpatialObjectType::ChildrenConstListType;
+
+  /** Candidate objects reported by a query, in traversal order. */
+  using ObjectVectorType = std::vector<SpatialObjectConstPointer>;
+
+  /** Set/Get the root of the object hierarchy to be indexed. */
+  itkSetConstObjectMacro(SpatialObject, SpatialObjectType);
+  itkGetConstObjectMacro(SpatialObject, SpatialObjectType);
+
+  /** Set/Get how deep in the hierarchy the index descends. A depth of
+   * 0 indexes only the root object itself. */
+  itkSetMacro(MaximumDepth, unsigned int);
+  itkGetConstMacro(MaximumDepth, unsigned int);
+
+  /** Number of objects held by the index after Initialize(). */
+  itkGetConstMacro(NumberOfObjects, SizeValueType);
+
+  /** Build the index from the current state of the object hierarchy. */
+  void
+  Initialize();
+
+  /** Append to oCandidates the indexed objects whose world-space
+   * bounding boxes contain the point, in traversal order. */
+  void
+  FindCandidateObjectsAtPoint(const PointType & point, ObjectVectorType & oCandidates) const;
+
+  /** Batched version of FindCandidateObjectsAtPoint; the queries are
+   * distributed over the work units of the MultiThreaderBase. */
+  void
+  FindCandidateObjectsAtPoints(const std::vector<PointType> & points, std::vector<ObjectVectorType> & oCandidates) const;
+
+  /** Returns true if the point is inside one of the indexed objects.
+   * Equivalent to IsInsideInWorldSpace(point, depth) on the root. */
+  bool
+  IsInsideInWorldSpace(const PointType & point) const;
+
+  /** Returns the value of the first evaluable indexed object at the
+   * point. Equivalent to ValueAtInWorldSpace(point, value, depth) on
+   * the root. */
+  bool
+  ValueAtInWorldSpace(const PointType & point, double & value) const;
+
+protected:
+  SpatialObjectBoundingVolumeHierarchy();
+  ~SpatialObjectBoundingVolumeHierarchy() override = default;
+
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  /** A node covers the range [m_FirstObject, m_FirstObject +
+   * m_NumberOfObjects) of m_ObjectOrder when it is a leaf
+   * (m_NumberOfObjects > 0); otherwise it refers to its two children. */
+  struct NodeType
+  {
+    PointType     m_MinimumBounds;
+    PointType     m_MaximumBounds;
+    SizeValueType m_FirstObject;
+    SizeValueType m_NumberOfObjects;
+    SizeValueType m_Children[2];
+  };
+
+  /** Record the object and its children up to the given depth, in the
+   * order the SpatialObject point evaluation methods visit them. */
+  void
+  CollectObjects(const SpatialObjectType * object, unsigned int depth);
+
+  /** Build the node covering the range [begin, end) of m_ObjectOrder
+   * and return its index in m_Nodes. */
+  SizeValueType
+  BuildNode(SizeValueType begin, SizeValueType end);
+
+  /** Append to oObjectIndices the indexed objects whose bounding boxes
+   * contain the point, sorted into traversal order. */
+  void
+  FindCandidateIndicesAtPoint(const PointType & point, std::vector<SizeValueType> & oObjectIndices) const;
+
+  SpatialObjectConstPointer m_SpatialObject;
+  unsigned int              m_MaximumDepth{ SpatialObjectType::MaximumDepth };
+  SizeValueType             m_NumberOfObjects{ 0 };
+
+  /** Indexed objects in traversal order and their world-space bounds. */
+  ObjectVectorType       m_Objects;
+  std::vector<PointType> m_MinimumBounds;
+  std::vector<PointType> m_MaximumBounds;
+
+  /** Object indices permuted by the hierarchy construction. */
+  std::vector<SizeValueType> m_ObjectOrder;
+
+  std::vector<NodeType> m_Nodes;
+  SizeValueType         m_RootNode{ 0 };
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkSpatialObjectBoundingVolumeHierarchy.hxx"
+#endif
+
+#endif
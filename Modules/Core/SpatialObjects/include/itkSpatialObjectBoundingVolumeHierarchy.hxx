@@ -0,0 +1,274 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkSpatialObjectBoundingVolumeHierarchy_hxx
+#define itkSpatialObjectBoundingVolumeHierarchy_hxx
+
+#include "itkSpatialObjectBoundingVolumeHierarchy.h"
+#include "itkMultiThreaderBase.h"
+
+#include <algorithm>
+
+namespace itk
+{
+template <unsigned int TDimension>
+SpatialObjectBoundingVolumeHierarchy<TDimension>::SpatialObjectBoundingVolumeHierarchy() = default;
+
+template <unsigned int TDimension>
+void
+SpatialObjectBoundingVolumeHierarchy<TDimension>::CollectObjects(const SpatialObjectType * object, unsigned int depth)
+{
+  m_Objects.push_back(object);
+
+  const typename SpatialObjectType::BoundingBoxType * boundingBox = object->GetMyBoundingBoxInWorldSpace();
+  m_MinimumBounds.push_back(boundingBox->GetMinimum());
+  m_MaximumBounds.push_back(boundingBox->GetMaximum());
+
+  if (depth > 0)
+  {
+    ChildrenConstListType * children = object->GetConstChildren(0);
+    for (auto it = children->begin(); it != children->end(); ++it)
+    {
+      this->CollectObjects(*it, depth - 1);
+    }
+    delete children;
+  }
+}
+
+template <unsigned int TDimension>
+auto
+SpatialObjectBoundingVolumeHierarchy<TDimension>::BuildNode(SizeValueType begin, SizeValueType end) -> SizeValueType
+{
+  const SizeValueType nodeId = m_Nodes.size();
+  m_Nodes.emplace_back();
+
+  PointType minimumBounds = m_MinimumBounds[m_ObjectOrder[begin]];
+  PointType maximumBounds = m_MaximumBounds[m_ObjectOrder[begin]];
+  for (SizeValueType i = begin + 1; i < end; ++i)
+  {
+    for (unsigned int dimension = 0; dimension < TDimension; ++dimension)
+    {
+      minimumBounds[dimension] = std::min(minimumBounds[dimension], m_MinimumBounds[m_ObjectOrder[i]][dimension]);
+      maximumBounds[dimension] = std::max(maximumBounds[dimension], m_MaximumBounds[m_ObjectOrder[i]][dimension]);
+    }
+  }
+  m_Nodes[nodeId].m_MinimumBounds = minimumBounds;
+  m_Nodes[nodeId].m_MaximumBounds = maximumBounds;
+
+  constexpr SizeValueType maximumNumberOfObjectsPerLeaf = 2;
+  if (end - begin <= maximumNumberOfObjectsPerLeaf)
+  {
+    m_Nodes[nodeId].m_FirstObject = begin;
+    m_Nodes[nodeId].m_NumberOfObjects = end - begin;
+    return nodeId;
+  }
+  m_Nodes[nodeId].m_FirstObject = 0;
+  m_Nodes[nodeId].m_NumberOfObjects = 0;
+
+  // Split along the widest extent of the node at the median of the
+  // bounding box centers
+  unsigned int splitDimension = 0;
+  for (unsigned int dimension = 1; dimension < TDimension; ++dimension)
+  {
+    if (maximumBounds[dimension] - minimumBounds[dimension] >
+        maximumBounds[splitDimension] - minimumBounds[splitDimension])
+    {
+      splitDimension = dimension;
+    }
+  }
+
+  const SizeValueType middle = begin + (end - begin) / 2;
+  std::nth_element(m_ObjectOrder.begin() + begin,
+                   m_ObjectOrder.begin() + middle,
+                   m_ObjectOrder.begin() + end,
+                   [this, splitDimension](SizeValueType lhs, SizeValueType rhs) {
+                     return m_MinimumBounds[lhs][splitDimension] + m_MaximumBounds[lhs][splitDimension] <
+                            m_MinimumBounds[rhs][splitDimension] + m_MaximumBounds[rhs][splitDimension];
+                   });
+
+  // Build the children after the reference to the node above went out
+  // of scope: the recursion grows m_Nodes
+  const SizeValueType firstChild = this->BuildNode(begin, middle);
+  const SizeValueType secondChild = this->BuildNode(middle, end);
+  m_Nodes[nodeId].m_Children[0] = firstChild;
+  m_Nodes[nodeId].m_Children[1] = secondChild;
+
+  return nodeId;
+}
+
+template <unsigned int TDimension>
+void
+SpatialObjectBoundingVolumeHierarchy<TDimension>::Initialize()
+{
+  if (m_SpatialObject.IsNull())
+  {
+    itkExceptionMacro(<< "A spatial object must be set before initialization");
+  }
+
+  m_Objects.clear();
+  m_MinimumBounds.clear();
+  m_MaximumBounds.clear();
+  m_Nodes.clear();
+
+  this->CollectObjects(m_SpatialObject, m_MaximumDepth);
+  m_NumberOfObjects = m_Objects.size();
+
+  m_ObjectOrder.resize(m_NumberOfObjects);
+  for (SizeValueType i = 0; i < m_NumberOfObjects; ++i)
+  {
+    m_ObjectOrder[i] = i;
+  }
+
+  m_RootNode = this->BuildNode(0, m_NumberOfObjects);
+}
+
+template <unsigned int TDimension>
+void
+SpatialObjectBoundingVolumeHierarchy<TDimension>::FindCandidateIndicesAtPoint(
+  const PointType &            point,
+  std::vector<SizeValueType> & oObjectIndices) const
+{
+  std::vector<SizeValueType> nodeStack;
+  nodeStack.push_back(m_RootNode);
+  while (!nodeStack.empty())
+  {
+    const NodeType & node = m_Nodes[nodeStack.back()];
+    nodeStack.pop_back();
+
+    bool inside = true;
+    for (unsigned int dimension = 0; dimension < TDimension; ++dimension)
+    {
+      if (point[dimension] < node.m_MinimumBounds[dimension] || point[dimension] > node.m_MaximumBounds[dimension])
+      {
+        inside = false;
+        break;
+      }
+    }
+    if (!inside)
+    {
+      continue;
+    }
+
+    if (node.m_NumberOfObjects > 0)
+    {
+      for (SizeValueType i = node.m_FirstObject; i < node.m_FirstObject + node.m_NumberOfObjects; ++i)
+      {
+        const SizeValueType objectIndex = m_ObjectOrder[i];
+        bool                contained = true;
+        for (unsigned int dimension = 0; dimension < TDimension; ++dimension)
+        {
+          if (point[dimension] < m_MinimumBounds[objectIndex][dimension] ||
+              point[dimension] > m_MaximumBounds[objectIndex][dimension])
+          {
+            contained = false;
+            break;
+          }
+        }
+        if (contained)
+        {
+          oObjectIndices.push_back(objectIndex);
+        }
+      }
+    }
+    else
+    {
+      nodeStack.push_back(node.m_Children[0]);
+      nodeStack.push_back(node.m_Children[1]);
+    }
+  }
+
+  // Traversal order of the candidates must not depend on how the
+  // hierarchy partitioned the objects
+  std::sort(oObjectIndices.begin(), oObjectIndices.end());
+}
+
+template <unsigned int TDimension>
+void
+SpatialObjectBoundingVolumeHierarchy<TDimension>::FindCandidateObjectsAtPoint(const PointType &  point,
+                                                                              ObjectVectorType & oCandidates) const
+{
+  std::vector<SizeValueType> objectIndices;
+  this->FindCandidateIndicesAtPoint(point, objectIndices);
+  for (const SizeValueType objectIndex : objectIndices)
+  {
+    oCandidates.push_back(m_Objects[objectIndex]);
+  }
+}
+
+template <unsigned int TDimension>
+void
+SpatialObjectBoundingVolumeHierarchy<TDimension>::FindCandidateObjectsAtPoints(
+  const std::vector<PointType> &  points,
+  std::vector<ObjectVectorType> & oCandidates) const
+{
+  oCandidates.clear();
+  oCandidates.resize(points.size());
+
+  MultiThreaderBase::New()->ParallelizeArray(
+    0,
+    static_cast<SizeValueType>(points.size()),
+    [this, &points, &oCandidates](SizeValueType index) {
+      this->FindCandidateObjectsAtPoint(points[index], oCandidates[index]);
+    },
+    nullptr);
+}
+
+template <unsigned int TDimension>
+bool
+SpatialObjectBoundingVolumeHierarchy<TDimension>::IsInsideInWorldSpace(const PointType & point) const
+{
+  std::vector<SizeValueType> objectIndices;
+  this->FindCandidateIndicesAtPoint(point, objectIndices);
+  for (const SizeValueType objectIndex : objectIndices)
+  {
+    if (m_Objects[objectIndex]->IsInsideInWorldSpace(point))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+template <unsigned int TDimension>
+bool
+SpatialObjectBoundingVolumeHierarchy<TDimension>::ValueAtInWorldSpace(const PointType & point, double & value) const
+{
+  std::vector<SizeValueType> objectIndices;
+  this->FindCandidateIndicesAtPoint(point, objectIndices);
+  for (const SizeValueType objectIndex : objectIndices)
+  {
+    if (m_Objects[objectIndex]->ValueAtInWorldSpace(point, value))
+    {
+      return true;
+    }
+  }
+  value = m_SpatialObject->GetDefaultOutsideValue();
+  return false;
+}
+
+template <unsigned int TDimension>
+void
+SpatialObjectBoundingVolumeHierarchy<TDimension>::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+  os << indent << "SpatialObject: " << m_SpatialObject.GetPointer() << std::endl;
+  os << indent << "MaximumDepth: " << m_MaximumDepth << std::endl;
+  os << indent << "NumberOfObjects: " << m_NumberOfObjects << std::endl;
+}
+} // end namespace itk
+
+#endif
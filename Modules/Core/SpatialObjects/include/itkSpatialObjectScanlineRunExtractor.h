@@ -0,0 +1,149 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkSpatialObjectScanlineRunExtractor_h
+#define itkSpatialObjectScanlineRunExtractor_h
+
+#include "itkImageBase.h"
+#include "itkSpatialObject.h"
+
+#include <vector>
+
+namespace itk
+{
+/**
+ *\class SpatialObjectScanlineRunExtractor
+ * \brief Extracts the index runs of an image grid covered by a
+ *        SpatialObject, one scanline at a time.
+ *
+ * Code that samples an image under a SpatialObject mask either
+ * rasterizes the object into a dense mask image first or calls
+ * IsInsideInWorldSpace per pixel on every visit. This class evaluates
+ * the object once over a region of an image grid and emits the
+ * half-open [begin, begin + length) runs of consecutive inside pixels
+ * along the fastest axis, so callers can iterate the covered pixels
+ * repeatedly - per optimization iteration, for example - without
+ * materializing a mask volume or re-evaluating the geometry.
+ *
+ * The runs are reported in the row-major order an
+ * ImageRegionConstIteratorWithIndex would visit the pixels, so
+ * replacing a per-pixel inside test with a sweep over the runs
+ * preserves the visiting order. The scanlines are evaluated in
+ * parallel over the work units of the MultiThreaderBase; the result
+ * does not depend on the number of work units.
+ *
+ * The object hierarchy must be up to date (Update() called) when
+ * Update() is invoked on the extractor.
+ *
+ * \sa SpatialObject
+ * \sa SpatialObjectToImageStatisticsCalculator
+ *
+ * \ingroup ITKSpatialObjects
+ */
+template <unsigned int TDimension = 3>
+class ITK_TEMPLATE_EXPORT SpatialObjectScanlineRunExtractor : public Object
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(SpatialObjectScanlineRunExtractor);
+
+  /** Standard class type aliases. */
+  using Self = SpatialObjectScanlineRunExtractor;
+  using Superclass = Object;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(SpatialObjectScanlineRunExtractor, Object);
+
+  /** Dimension of the space the objects live in. */
+  static constexpr unsigned int ObjectDimension = TDimension;
+
+  using SpatialObjectType = SpatialObject<TDimension>;
+  using ImageBaseType = ImageBase<TDimension>;
+  using IndexType = typename ImageBaseType::IndexType;
+  using RegionType = typename ImageBaseType::RegionType;
+  using PointType = typename SpatialObjectType::PointType;
+
+  /** A run of consecutive pixels inside the object along the fastest
+   * axis, covering [m_FirstIndex[0], m_FirstIndex[0] + m_Length). */
+  struct RunType
+  {
+    IndexType     m_FirstIndex;
+    SizeValueType m_Length;
+  };
+
+  using RunVectorType = std::vector<RunType>;
+
+  /** Set/Get the object whose coverage is extracted. */
+  itkSetConstObjectMacro(SpatialObject, SpatialObjectType);
+  itkGetConstObjectMacro(SpatialObject, SpatialObjectType);
+
+  /** Set/Get how deep in the hierarchy the inside test descends
+   * (the depth argument of IsInsideInWorldSpace). A depth of 0 tests
+   * only the object itself. */
+  itkSetMacro(MaximumDepth, unsigned int);
+  itkGetConstMacro(MaximumDepth, unsigned int);
+
+  /** Set/Get the image defining the grid the runs are expressed on.
+   * Only the geometry of the image is used. */
+  itkSetConstObjectMacro(Image, ImageBaseType);
+  itkGetConstObjectMacro(Image, ImageBaseType);
+
+  /** Set/Get the image region swept by the scanlines. */
+  itkSetMacro(Region, RegionType);
+  itkGetConstReferenceMacro(Region, RegionType);
+
+  /** Extract the runs from the current state of the object. */
+  void
+  Update();
+
+  /** The extracted runs, in row-major order. */
+  const RunVectorType &
+  GetRuns() const
+  {
+    return m_Runs;
+  }
+
+  /** Total number of pixels covered by the extracted runs. */
+  itkGetConstMacro(NumberOfPixels, SizeValueType);
+
+protected:
+  SpatialObjectScanlineRunExtractor();
+  ~SpatialObjectScanlineRunExtractor() override = default;
+
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  typename SpatialObjectType::ConstPointer m_SpatialObject;
+  typename ImageBaseType::ConstPointer     m_Image;
+  RegionType                               m_Region;
+  unsigned int                             m_MaximumDepth{ SpatialObjectType::MaximumDepth };
+
+  RunVectorType m_Runs;
+  SizeValueType m_NumberOfPixels{ 0 };
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkSpatialObjectScanlineRunExtractor.hxx"
+#endif
+
+#endif
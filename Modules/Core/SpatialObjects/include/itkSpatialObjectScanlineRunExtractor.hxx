@@ -0,0 +1,139 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkSpatialObjectScanlineRunExtractor_hxx
+#define itkSpatialObjectScanlineRunExtractor_hxx
+
+#include "itkSpatialObjectScanlineRunExtractor.h"
+#include "itkMultiThreaderBase.h"
+
+namespace itk
+{
+template <unsigned int TDimension>
+SpatialObjectScanlineRunExtractor<TDimension>::SpatialObjectScanlineRunExtractor()
+{
+  typename RegionType::SizeType size;
+  size.Fill(0);
+  m_Region.SetSize(size);
+}
+
+template <unsigned int TDimension>
+void
+SpatialObjectScanlineRunExtractor<TDimension>::Update()
+{
+  if (m_SpatialObject.IsNull() || m_Image.IsNull())
+  {
+    itkExceptionMacro(<< "A spatial object and an image grid must be set before extraction");
+  }
+
+  m_Runs.clear();
+  m_NumberOfPixels = 0;
+
+  const typename RegionType::SizeType regionSize = m_Region.GetSize();
+  const IndexType                     regionIndex = m_Region.GetIndex();
+  if (m_Region.GetNumberOfPixels() == 0)
+  {
+    return;
+  }
+
+  SizeValueType numberOfScanlines = 1;
+  for (unsigned int dimension = 1; dimension < TDimension; ++dimension)
+  {
+    numberOfScanlines *= regionSize[dimension];
+  }
+
+  // The world-to-object inverse transforms are computed lazily on first
+  // use; refresh them here so the scanline work units only read them
+  m_SpatialObject->GetObjectToWorldTransformInverse();
+  m_SpatialObject->GetObjectToParentTransformInverse();
+  typename SpatialObjectType::ChildrenConstListType * children = m_SpatialObject->GetConstChildren(m_MaximumDepth);
+  for (auto it = children->begin(); it != children->end(); ++it)
+  {
+    (*it)->GetObjectToWorldTransformInverse();
+    (*it)->GetObjectToParentTransformInverse();
+  }
+  delete children;
+
+  std::vector<RunVectorType> scanlineRuns(numberOfScanlines);
+
+  MultiThreaderBase::New()->ParallelizeArray(
+    0,
+    numberOfScanlines,
+    [this, &scanlineRuns, &regionSize, &regionIndex](SizeValueType scanline) {
+      IndexType     index = regionIndex;
+      SizeValueType remainder = scanline;
+      for (unsigned int dimension = 1; dimension < TDimension; ++dimension)
+      {
+        index[dimension] += static_cast<IndexValueType>(remainder % regionSize[dimension]);
+        remainder /= regionSize[dimension];
+      }
+
+      PointType     point;
+      SizeValueType runLength = 0;
+      IndexType     runFirstIndex = index;
+      for (SizeValueType i = 0; i < regionSize[0]; ++i)
+      {
+        m_Image->TransformIndexToPhysicalPoint(index, point);
+        if (m_SpatialObject->IsInsideInWorldSpace(point, m_MaximumDepth))
+        {
+          if (runLength == 0)
+          {
+            runFirstIndex = index;
+          }
+          ++runLength;
+        }
+        else if (runLength > 0)
+        {
+          scanlineRuns[scanline].push_back({ runFirstIndex, runLength });
+          runLength = 0;
+        }
+        ++index[0];
+      }
+      if (runLength > 0)
+      {
+        scanlineRuns[scanline].push_back({ runFirstIndex, runLength });
+      }
+    },
+    nullptr);
+
+  // Concatenate in scanline order, so the runs enumerate the pixels in
+  // the order a region iterator would visit them
+  for (SizeValueType scanline = 0; scanline < numberOfScanlines; ++scanline)
+  {
+    for (const RunType & run : scanlineRuns[scanline])
+    {
+      m_Runs.push_back(run);
+      m_NumberOfPixels += run.m_Length;
+    }
+  }
+}
+
+template <unsigned int TDimension>
+void
+SpatialObjectScanlineRunExtractor<TDimension>::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+  os << indent << "SpatialObject: " << m_SpatialObject.GetPointer() << std::endl;
+  os << indent << "Image: " << m_Image.GetPointer() << std::endl;
+  os << indent << "Region: " << m_Region << std::endl;
+  os << indent << "MaximumDepth: " << m_MaximumDepth << std::endl;
+  os << indent << "NumberOfRuns: " << m_Runs.size() << std::endl;
+  os << indent << "NumberOfPixels: " << m_NumberOfPixels << std::endl;
+}
+} // end namespace itk
+
+#endif
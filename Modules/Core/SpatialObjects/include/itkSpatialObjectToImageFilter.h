@@ -20,6 +20,7 @@
 
 #include "itkImageSource.h"
 #include "itkConceptChecking.h"
+#include "itkSpatialObjectBoundingVolumeHierarchy.h"
 
 namespace itk
 {
@@ -178,15 +179,38 @@ public:
   itkGetConstMacro(UseObjectValue, bool);
   itkBooleanMacro(UseObjectValue);
 
+  /** If UseBoundingVolumeHierarchy is set to true, the filter builds a
+   * SpatialObjectBoundingVolumeHierarchy over the input hierarchy and
+   * only evaluates the objects whose world-space bounding boxes contain
+   * a given pixel, instead of testing every object per pixel. The
+   * output is unchanged as long as every object is evaluable only
+   * inside its bounding box; do not enable this for objects that
+   * influence space beyond their spatial extent. Default is off. */
+  itkSetMacro(UseBoundingVolumeHierarchy, bool);
+  itkGetConstMacro(UseBoundingVolumeHierarchy, bool);
+  itkBooleanMacro(UseBoundingVolumeHierarchy);
+
 protected:
   SpatialObjectToImageFilter();
   ~SpatialObjectToImageFilter() override = default;
 
+  /** Compute the output size, either explicitly specified or from the
+   * family bounding box of the input, so the output can be allocated
+   * before the threaded rasterization. */
+  void
+  GenerateOutputInformation() override;
+
+  /** The rasterization is split over the output regions; the point
+   * evaluation methods of the input objects only read the objects, so
+   * the pixels can be evaluated concurrently once the lazily computed
+   * inverse transforms have been refreshed by
+   * BeforeThreadedGenerateData(). */
   void
-  GenerateOutputInformation() override
-  {} // do nothing
+  BeforeThreadedGenerateData() override;
   void
-  GenerateData() override;
+  DynamicThreadedGenerateData(const OutputImageRegionType & outputRegionForThread) override;
+  void
+  AfterThreadedGenerateData() override;
 
   SizeType      m_Size;
   double        m_Spacing[OutputImageDimension];
@@ -199,11 +223,17 @@ protected:
   ValueType m_OutsideValue;
 
   bool m_UseObjectValue;
+  bool m_UseBoundingVolumeHierarchy;
 
   void
   PrintSelf(std::ostream & os, Indent indent) const override;
 
 private:
+  using BoundingVolumeHierarchyType = SpatialObjectBoundingVolumeHierarchy<ObjectDimension>;
+
+  /** Index built by BeforeThreadedGenerateData() for the duration of
+   * one rasterization when UseBoundingVolumeHierarchy is enabled. */
+  typename BoundingVolumeHierarchyType::Pointer m_BoundingVolumeHierarchy;
 };
 } // end namespace itk
 
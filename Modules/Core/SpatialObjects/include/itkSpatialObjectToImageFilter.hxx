@@ -20,7 +20,7 @@
 
 #include "itkSpatialObjectToImageFilter.h"
 #include "itkImageRegionIteratorWithIndex.h"
-#include "itkProgressReporter.h"
+#include "itkTotalProgressReporter.h"
 #include "itkMath.h"
 
 namespace itk
@@ -43,6 +43,7 @@ SpatialObjectToImageFilter<TInputSpatialObject, TOutputImage>::SpatialObjectToIm
   m_InsideValue = 0;
   m_OutsideValue = 0;
   m_UseObjectValue = false;
+  m_UseBoundingVolumeHierarchy = false;
 }
 
 /** Set the Input SpatialObject */
@@ -265,13 +266,10 @@ SpatialObjectToImageFilter<TInputSpatialObject, TOutputImage>::GetDirection() co
 
 template <typename TInputSpatialObject, typename TOutputImage>
 void
-SpatialObjectToImageFilter<TInputSpatialObject, TOutputImage>::GenerateData()
+SpatialObjectToImageFilter<TInputSpatialObject, TOutputImage>::GenerateOutputInformation()
 {
   unsigned int i;
 
-  itkDebugMacro(<< "SpatialObjectToImageFilter::Update() called");
-
-  // Get the input and output pointers
   const InputSpatialObjectType * InputObject = this->GetInput();
   OutputImagePointer             OutputImage = this->GetOutput();
 
@@ -314,22 +312,60 @@ SpatialObjectToImageFilter<TInputSpatialObject, TOutputImage>::GenerateData()
   }
   region.SetIndex(index);
 
-  OutputImage->SetLargestPossibleRegion(region); //
-  OutputImage->SetBufferedRegion(region);        // set the region
-  OutputImage->SetRequestedRegion(region);       //
+  OutputImage->SetLargestPossibleRegion(region); // set the region
   OutputImage->SetSpacing(m_Spacing);            // set spacing
   OutputImage->SetOrigin(m_Origin);              //   and origin
   OutputImage->SetDirection(m_Direction);
-  OutputImage->Allocate(); // allocate the image
+}
+
+template <typename TInputSpatialObject, typename TOutputImage>
+void
+SpatialObjectToImageFilter<TInputSpatialObject, TOutputImage>::BeforeThreadedGenerateData()
+{
+  const InputSpatialObjectType * InputObject = this->GetInput();
+
+  // The world-to-object inverse transforms are computed lazily on first
+  // use; refresh them here so the work units only read them
+  InputObject->GetObjectToWorldTransformInverse();
+  InputObject->GetObjectToParentTransformInverse();
+
+  typename InputSpatialObjectType::ChildrenConstListType * children = InputObject->GetConstChildren(m_ChildrenDepth);
+  for (auto it = children->begin(); it != children->end(); ++it)
+  {
+    (*it)->GetObjectToWorldTransformInverse();
+    (*it)->GetObjectToParentTransformInverse();
+  }
+  delete children;
+
+  // When requested, index the object hierarchy so each pixel only
+  // evaluates the objects whose bounding boxes contain it
+  if (m_UseBoundingVolumeHierarchy)
+  {
+    m_BoundingVolumeHierarchy = BoundingVolumeHierarchyType::New();
+    m_BoundingVolumeHierarchy->SetSpatialObject(InputObject);
+    m_BoundingVolumeHierarchy->SetMaximumDepth(m_ChildrenDepth);
+    m_BoundingVolumeHierarchy->Initialize();
+  }
+}
+
+template <typename TInputSpatialObject, typename TOutputImage>
+void
+SpatialObjectToImageFilter<TInputSpatialObject, TOutputImage>::DynamicThreadedGenerateData(
+  const OutputImageRegionType & outputRegionForThread)
+{
+  unsigned int i;
+
+  const InputSpatialObjectType * InputObject = this->GetInput();
+  OutputImagePointer             OutputImage = this->GetOutput();
 
   using myIteratorType = itk::ImageRegionIteratorWithIndex<OutputImageType>;
 
-  myIteratorType it(OutputImage, region);
+  myIteratorType it(OutputImage, outputRegionForThread);
 
   itk::Point<double, ObjectDimension>      objectPoint;
   itk::Point<double, OutputImageDimension> imagePoint;
 
-  ProgressReporter progress(this, 0, OutputImage->GetRequestedRegion().GetNumberOfPixels());
+  TotalProgressReporter progress(this, OutputImage->GetRequestedRegion().GetNumberOfPixels());
 
   while (!it.IsAtEnd())
   {
@@ -342,7 +378,9 @@ SpatialObjectToImageFilter<TInputSpatialObject, TOutputImage>::GenerateData()
 
     double val = 0;
 
-    bool evaluable = InputObject->ValueAtInWorldSpace(objectPoint, val, m_ChildrenDepth);
+    bool evaluable = m_UseBoundingVolumeHierarchy
+                       ? m_BoundingVolumeHierarchy->ValueAtInWorldSpace(objectPoint, val)
+                       : InputObject->ValueAtInWorldSpace(objectPoint, val, m_ChildrenDepth);
     if (Math::NotExactlyEquals(m_InsideValue, NumericTraits<ValueType>::ZeroValue()) ||
         Math::NotExactlyEquals(m_OutsideValue, NumericTraits<ValueType>::ZeroValue()))
     {
@@ -369,9 +407,15 @@ SpatialObjectToImageFilter<TInputSpatialObject, TOutputImage>::GenerateData()
     ++it;
     progress.CompletedPixel();
   }
+}
 
-  itkDebugMacro(<< "SpatialObjectToImageFilter::Update() finished");
-} // end update function
+template <typename TInputSpatialObject, typename TOutputImage>
+void
+SpatialObjectToImageFilter<TInputSpatialObject, TOutputImage>::AfterThreadedGenerateData()
+{
+  // The index is a snapshot of the objects taken for this run only
+  m_BoundingVolumeHierarchy = nullptr;
+}
 
 template <typename TInputSpatialObject, typename TOutputImage>
 void
@@ -390,6 +434,7 @@ SpatialObjectToImageFilter<TInputSpatialObject, TOutputImage>::PrintSelf(std::os
   {
     os << indent << "Using Object Value : OFF" << std::endl;
   }
+  os << indent << "Using Bounding Volume Hierarchy : " << (m_UseBoundingVolumeHierarchy ? "ON" : "OFF") << std::endl;
 }
 } // end namespace itk
 
@@ -24,6 +24,7 @@
 #include "itkMeanSampleFilter.h"
 #include "itkCovarianceSampleFilter.h"
 #include "itkImageMaskSpatialObject.h"
+#include "itkSpatialObjectScanlineRunExtractor.h"
 
 namespace itk
 {
@@ -191,19 +192,27 @@ SpatialObjectToImageStatisticsCalculator<TInputImage, TInputSpatialObject, TSamp
     region.SetIndex(indMin);
     region.SetSize(size);
 
-    using IteratorType = ImageRegionConstIteratorWithIndex<ImageType>;
-    IteratorType it = IteratorType(m_Image, region);
-    it.GoToBegin();
+    // Extract the [begin, begin + length) runs of pixels covered by
+    // the object; this evaluates the geometry once per pixel over the
+    // scanlines in parallel, and the sweep below visits the covered
+    // pixels in the same order the former per-pixel inside test did
+    using RunExtractorType = SpatialObjectScanlineRunExtractor<Self::ObjectDimension>;
+    auto runExtractor = RunExtractorType::New();
+    runExtractor->SetSpatialObject(m_SpatialObject);
+    runExtractor->SetImage(m_Image);
+    runExtractor->SetRegion(region);
+    runExtractor->SetMaximumDepth(0);
+    runExtractor->Update();
+
     IndexType  ind;
-    PointType  pnt;
     VectorType mv;
-    while (!it.IsAtEnd())
+    for (const auto & run : runExtractor->GetRuns())
     {
-      ind = it.GetIndex();
-      m_Image->TransformIndexToPhysicalPoint(ind, pnt);
-      if (m_SpatialObject->IsInsideInWorldSpace(pnt))
+      for (SizeValueType j = 0; j < run.m_Length; ++j)
       {
-        mv[0] = it.Get();
+        ind = run.m_FirstIndex;
+        ind[0] += static_cast<IndexValueType>(j);
+        mv[0] = m_Image->GetPixel(ind);
         m_Sum += static_cast<AccumulateType>(mv[0]);
         for (unsigned int i = 1; i < Self::SampleDimension; ++i)
         {
@@ -214,7 +223,6 @@ SpatialObjectToImageStatisticsCalculator<TInputImage, TInputSpatialObject, TSamp
         m_Sample->PushBack(mv);
         m_NumberOfPixels++;
       }
-      ++it;
     }
   }
 
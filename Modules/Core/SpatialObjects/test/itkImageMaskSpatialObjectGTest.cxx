@@ -323,3 +323,83 @@ TEST(ImageMaskSpatialObject, CornerPointIsNotInsideMaskOfZeroValues)
   const double cornerPoint[] = { 1.5, 1.5 };
   ASSERT_FALSE(imageMaskSpatialObject->IsInsideInObjectSpace(cornerPoint));
 }
+
+
+// Tests that GetRegionOccupancyInIndexSpace classifies regions exactly as a
+// per-pixel scan of the mask would, including regions smaller than, equal to,
+// and larger than the blocks of the internal occupancy grid.
+TEST(ImageMaskSpatialObject, RegionOccupancyAgreesWithPerPixelScan)
+{
+  using ImageType = itk::Image<unsigned char, 2>;
+  using SpatialObjectType = itk::ImageMaskSpatialObject<2>;
+  using RegionType = ImageType::RegionType;
+  using RegionOccupancy = SpatialObjectType::RegionOccupancy;
+
+  const auto image = ImageType::New();
+  image->SetRegions(itk::Size<2>{ { 40, 40 } });
+  image->Allocate(true);
+
+  // A filled 20x20 square of foreground, crossing block borders.
+  for (itk::IndexValueType y = 7; y < 27; ++y)
+  {
+    for (itk::IndexValueType x = 7; x < 27; ++x)
+    {
+      image->SetPixel({ { x, y } }, 1);
+    }
+  }
+
+  const auto spatialObject = SpatialObjectType::New();
+  spatialObject->SetImage(image);
+
+  const auto scanOccupancy = [&image](const RegionType & region) {
+    bool hasForeground = false;
+    bool hasBackground = false;
+    for (itk::IndexValueType y = region.GetIndex(1); y < region.GetIndex(1) + itk::IndexValueType(region.GetSize(1));
+         ++y)
+    {
+      for (itk::IndexValueType x = region.GetIndex(0); x < region.GetIndex(0) + itk::IndexValueType(region.GetSize(0));
+           ++x)
+      {
+        const itk::Index<2> pixelIndex = { { x, y } };
+        if (image->GetBufferedRegion().IsInside(pixelIndex) && image->GetPixel(pixelIndex) != 0)
+        {
+          hasForeground = true;
+        }
+        else
+        {
+          hasBackground = true;
+        }
+      }
+    }
+    if (hasForeground)
+    {
+      return hasBackground ? RegionOccupancy::Mixed : RegionOccupancy::AllInside;
+    }
+    return RegionOccupancy::AllOutside;
+  };
+
+  // Probe a collection of regions of varying size and placement.
+  for (const itk::SizeValueType regionSize : { 1, 3, 16, 21 })
+  {
+    for (itk::IndexValueType y = 0; y < 40; y += 5)
+    {
+      for (itk::IndexValueType x = 0; x < 40; x += 5)
+      {
+        const RegionType region({ { x, y } }, { { regionSize, regionSize } });
+        EXPECT_EQ(spatialObject->GetRegionOccupancyInIndexSpace(region), scanOccupancy(region))
+          << " region: " << region;
+      }
+    }
+  }
+
+  // An empty region and a region outside the buffered region are all outside.
+  EXPECT_EQ(spatialObject->GetRegionOccupancyInIndexSpace(RegionType()), RegionOccupancy::AllOutside);
+  EXPECT_EQ(spatialObject->GetRegionOccupancyInIndexSpace(RegionType({ { 50, 50 } }, { { 4, 4 } })),
+            RegionOccupancy::AllOutside);
+
+  // The grid is rebuilt when the mask is modified.
+  image->FillBuffer(1);
+  image->Modified();
+  EXPECT_EQ(spatialObject->GetRegionOccupancyInIndexSpace(RegionType({ { 0, 0 } }, { { 40, 40 } })),
+            RegionOccupancy::AllInside);
+}
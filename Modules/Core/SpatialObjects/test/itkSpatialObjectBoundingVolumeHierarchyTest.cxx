@@ -0,0 +1,190 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkSpatialObjectBoundingVolumeHierarchy.h"
+#include "itkEllipseSpatialObject.h"
+#include "itkGroupSpatialObject.h"
+#include "itkSpatialObjectToImageFilter.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkTestingMacros.h"
+
+int
+itkSpatialObjectBoundingVolumeHierarchyTest(int, char *[])
+{
+  constexpr unsigned int Dimension = 3;
+
+  using GroupType = itk::GroupSpatialObject<Dimension>;
+  using EllipseType = itk::EllipseSpatialObject<Dimension>;
+  using HierarchyType = itk::SpatialObjectBoundingVolumeHierarchy<Dimension>;
+  using PointType = HierarchyType::PointType;
+
+  // A scene of small spheres scattered on a grid
+  auto group = GroupType::New();
+
+  constexpr unsigned int numberOfObjectsPerAxis = 4;
+  for (unsigned int k = 0; k < numberOfObjectsPerAxis; ++k)
+  {
+    for (unsigned int j = 0; j < numberOfObjectsPerAxis; ++j)
+    {
+      for (unsigned int i = 0; i < numberOfObjectsPerAxis; ++i)
+      {
+        auto ellipse = EllipseType::New();
+        ellipse->SetRadiusInObjectSpace(2.0);
+
+        EllipseType::TransformType::OffsetType offset;
+        offset[0] = 10.0 * i + 5.0;
+        offset[1] = 10.0 * j + 5.0;
+        offset[2] = 10.0 * k + 5.0;
+        ellipse->GetModifiableObjectToParentTransform()->SetOffset(offset);
+
+        group->AddChild(ellipse);
+      }
+    }
+  }
+  group->Update();
+
+  auto hierarchy = HierarchyType::New();
+
+  ITK_EXERCISE_BASIC_OBJECT_METHODS(hierarchy, SpatialObjectBoundingVolumeHierarchy, Object);
+
+  ITK_TRY_EXPECT_EXCEPTION(hierarchy->Initialize());
+
+  hierarchy->SetSpatialObject(group);
+  ITK_TEST_SET_GET_VALUE(group, hierarchy->GetSpatialObject());
+
+  unsigned int maximumDepth = GroupType::MaximumDepth;
+  hierarchy->SetMaximumDepth(maximumDepth);
+  ITK_TEST_SET_GET_VALUE(maximumDepth, hierarchy->GetMaximumDepth());
+
+  ITK_TRY_EXPECT_NO_EXCEPTION(hierarchy->Initialize());
+
+  const itk::SizeValueType expectedNumberOfObjects =
+    numberOfObjectsPerAxis * numberOfObjectsPerAxis * numberOfObjectsPerAxis + 1;
+  ITK_TEST_EXPECT_EQUAL(expectedNumberOfObjects, hierarchy->GetNumberOfObjects());
+
+  // The queries must agree with the linear SpatialObject traversal on
+  // a grid of probe points inside, near, and between the spheres
+  std::vector<PointType> probePoints;
+  for (double z = 0.0; z < 40.0; z += 1.5)
+  {
+    for (double y = 0.0; y < 40.0; y += 1.5)
+    {
+      for (double x = 0.0; x < 40.0; x += 1.5)
+      {
+        PointType point;
+        point[0] = x;
+        point[1] = y;
+        point[2] = z;
+        probePoints.push_back(point);
+      }
+    }
+  }
+
+  for (const PointType & point : probePoints)
+  {
+    if (hierarchy->IsInsideInWorldSpace(point) != group->IsInsideInWorldSpace(point, maximumDepth))
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "IsInsideInWorldSpace mismatch at " << point << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    double expectedValue = 0;
+    double value = 0;
+    const bool expectedEvaluable = group->ValueAtInWorldSpace(point, expectedValue, maximumDepth);
+    const bool evaluable = hierarchy->ValueAtInWorldSpace(point, value);
+    if (evaluable != expectedEvaluable || itk::Math::NotExactlyEquals(value, expectedValue))
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "ValueAtInWorldSpace mismatch at " << point << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // The batched query must report the same candidates as the
+  // point-by-point one
+  std::vector<HierarchyType::ObjectVectorType> batchedCandidates;
+  hierarchy->FindCandidateObjectsAtPoints(probePoints, batchedCandidates);
+  ITK_TEST_EXPECT_EQUAL(probePoints.size(), batchedCandidates.size());
+
+  for (std::size_t i = 0; i < probePoints.size(); ++i)
+  {
+    HierarchyType::ObjectVectorType candidates;
+    hierarchy->FindCandidateObjectsAtPoint(probePoints[i], candidates);
+    if (candidates != batchedCandidates[i])
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "Batched candidates differ at " << probePoints[i] << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    // Every reported candidate must contain the point in its bounding box
+    for (const auto & candidate : candidates)
+    {
+      if (!candidate->GetMyBoundingBoxInWorldSpace()->IsInside(probePoints[i]))
+      {
+        std::cerr << "Test failed!" << std::endl;
+        std::cerr << "Candidate does not contain " << probePoints[i] << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  // Rasterization through the filter must not depend on whether the
+  // index is used
+  using ImageType = itk::Image<unsigned char, Dimension>;
+  using FilterType = itk::SpatialObjectToImageFilter<GroupType, ImageType>;
+
+  ImageType::SizeType size;
+  size.Fill(40);
+
+  auto referenceFilter = FilterType::New();
+  referenceFilter->SetInput(group);
+  referenceFilter->SetSize(size);
+  referenceFilter->SetInsideValue(1);
+  ITK_TRY_EXPECT_NO_EXCEPTION(referenceFilter->Update());
+
+  auto indexedFilter = FilterType::New();
+  indexedFilter->SetInput(group);
+  indexedFilter->SetSize(size);
+  indexedFilter->SetInsideValue(1);
+
+  auto useBoundingVolumeHierarchy = true;
+  ITK_TEST_SET_GET_BOOLEAN(indexedFilter, UseBoundingVolumeHierarchy, useBoundingVolumeHierarchy);
+
+  ITK_TRY_EXPECT_NO_EXCEPTION(indexedFilter->Update());
+
+  itk::ImageRegionConstIterator<ImageType> referenceIt(referenceFilter->GetOutput(),
+                                                       referenceFilter->GetOutput()->GetLargestPossibleRegion());
+  itk::ImageRegionConstIterator<ImageType> indexedIt(indexedFilter->GetOutput(),
+                                                     indexedFilter->GetOutput()->GetLargestPossibleRegion());
+  while (!referenceIt.IsAtEnd())
+  {
+    if (referenceIt.Get() != indexedIt.Get())
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "Filter output differs at " << referenceIt.GetIndex() << std::endl;
+      return EXIT_FAILURE;
+    }
+    ++referenceIt;
+    ++indexedIt;
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,135 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkSpatialObjectScanlineRunExtractor.h"
+#include "itkEllipseSpatialObject.h"
+#include "itkGroupSpatialObject.h"
+#include "itkImage.h"
+#include "itkImageRegionConstIteratorWithIndex.h"
+#include "itkTestingMacros.h"
+
+int
+itkSpatialObjectScanlineRunExtractorTest(int, char *[])
+{
+  constexpr unsigned int Dimension = 2;
+
+  using GroupType = itk::GroupSpatialObject<Dimension>;
+  using EllipseType = itk::EllipseSpatialObject<Dimension>;
+  using ImageType = itk::Image<unsigned char, Dimension>;
+  using ExtractorType = itk::SpatialObjectScanlineRunExtractor<Dimension>;
+
+  // Two circles, one crossing the region border
+  auto group = GroupType::New();
+  for (unsigned int i = 0; i < 2; ++i)
+  {
+    auto ellipse = EllipseType::New();
+    ellipse->SetRadiusInObjectSpace(8.0);
+
+    EllipseType::TransformType::OffsetType offset;
+    offset[0] = 30.0 * i + 15.0;
+    offset[1] = 20.0 * i + 10.0;
+    ellipse->GetModifiableObjectToParentTransform()->SetOffset(offset);
+
+    group->AddChild(ellipse);
+  }
+  group->Update();
+
+  auto image = ImageType::New();
+
+  ImageType::RegionType region;
+  ImageType::SizeType   size;
+  size.Fill(50);
+  region.SetSize(size);
+  image->SetRegions(region);
+  image->Allocate(true);
+
+  auto extractor = ExtractorType::New();
+
+  ITK_EXERCISE_BASIC_OBJECT_METHODS(extractor, SpatialObjectScanlineRunExtractor, Object);
+
+  ITK_TRY_EXPECT_EXCEPTION(extractor->Update());
+
+  extractor->SetSpatialObject(group);
+  ITK_TEST_SET_GET_VALUE(group, extractor->GetSpatialObject());
+
+  extractor->SetImage(image);
+  ITK_TEST_SET_GET_VALUE(image, extractor->GetImage());
+
+  extractor->SetRegion(region);
+  ITK_TEST_SET_GET_VALUE(region, extractor->GetRegion());
+
+  unsigned int maximumDepth = GroupType::MaximumDepth;
+  extractor->SetMaximumDepth(maximumDepth);
+  ITK_TEST_SET_GET_VALUE(maximumDepth, extractor->GetMaximumDepth());
+
+  ITK_TRY_EXPECT_NO_EXCEPTION(extractor->Update());
+
+  // Enumerate the pixels covered by the runs, in run order
+  std::vector<ImageType::IndexType> runPixels;
+  for (const auto & run : extractor->GetRuns())
+  {
+    ImageType::IndexType index = run.m_FirstIndex;
+    for (itk::SizeValueType i = 0; i < run.m_Length; ++i)
+    {
+      runPixels.push_back(index);
+      ++index[0];
+    }
+  }
+  ITK_TEST_EXPECT_EQUAL(runPixels.size(), extractor->GetNumberOfPixels());
+
+  // The runs must enumerate exactly the pixels the per-pixel inside
+  // test accepts, in the order a region iterator visits them
+  std::vector<ImageType::IndexType> expectedPixels;
+
+  itk::ImageRegionConstIteratorWithIndex<ImageType> it(image, region);
+  ImageType::PointType                              point;
+  while (!it.IsAtEnd())
+  {
+    image->TransformIndexToPhysicalPoint(it.GetIndex(), point);
+    if (group->IsInsideInWorldSpace(point, maximumDepth))
+    {
+      expectedPixels.push_back(it.GetIndex());
+    }
+    ++it;
+  }
+
+  if (runPixels != expectedPixels)
+  {
+    std::cerr << "Test failed!" << std::endl;
+    std::cerr << "Expected " << expectedPixels.size() << " covered pixels, but the runs enumerate " << runPixels.size()
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if (extractor->GetNumberOfPixels() == 0)
+  {
+    std::cerr << "Test failed!" << std::endl;
+    std::cerr << "No run was extracted for a scene with two circles" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // An empty region must produce no runs
+  size.Fill(0);
+  region.SetSize(size);
+  extractor->SetRegion(region);
+  ITK_TRY_EXPECT_NO_EXCEPTION(extractor->Update());
+  ITK_TEST_EXPECT_EQUAL(itk::SizeValueType{ 0 }, extractor->GetNumberOfPixels());
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -29,7 +29,7 @@
 #define itkRandomImageSource_hxx
 
 #include "itkRandomImageSource.h"
-#include "itkImageRegionIterator.h"
+#include "itkImageScanlineIterator.h"
 #include "itkObjectFactory.h"
 #include "itkTotalProgressReporter.h"
 
@@ -226,7 +226,7 @@ RandomImageSource<TOutputImage>::DynamicThreadedGenerateData(const OutputImageRe
   using scalarType = typename TOutputImage::PixelType;
   typename TOutputImage::Pointer image = this->GetOutput(0);
 
-  ImageRegionIterator<TOutputImage> it(image, outputRegionForThread);
+  ImageScanlineIterator<TOutputImage> it(image, outputRegionForThread);
 
   TotalProgressReporter progress(this, image->GetRequestedRegion().GetNumberOfPixels());
 
@@ -244,14 +244,19 @@ RandomImageSource<TOutputImage>::DynamicThreadedGenerateData(const OutputImageRe
   auto dMin = static_cast<double>(m_Min);
   auto dMax = static_cast<double>(m_Max);
 
-  for (; !it.IsAtEnd(); ++it)
+  while (!it.IsAtEnd())
   {
-    sample_seed = (sample_seed * 16807) % 2147483647L;
-    u = static_cast<double>(sample_seed) / 2147483711UL;
-    rnd = (1.0 - u) * dMin + u * dMax;
+    while (!it.IsAtEndOfLine())
+    {
+      sample_seed = (sample_seed * 16807) % 2147483647L;
+      u = static_cast<double>(sample_seed) / 2147483711UL;
+      rnd = (1.0 - u) * dMin + u * dMax;
 
-    it.Set((scalarType)rnd);
-    progress.CompletedPixel();
+      it.Set((scalarType)rnd);
+      ++it;
+      progress.CompletedPixel();
+    }
+    it.NextLine();
   }
 }
 } // end namespace itk
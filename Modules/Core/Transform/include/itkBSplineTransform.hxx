@@ -21,8 +21,6 @@
 #include "itkBSplineTransform.h"
 
 #include "itkContinuousIndex.h"
-#include "itkImageScanlineConstIterator.h"
-#include "itkImageRegionConstIteratorWithIndex.h"
 
 namespace itk
 {
@@ -539,47 +537,74 @@ BSplineTransform<TParametersValueType, NDimensions, VSplineOrder>::TransformPoin
     this->m_WeightsFunction->Evaluate(index, weights, supportIndex);
 
     // For each dimension, correlate coefficient with weights
-    SizeType supportSize;
-    supportSize.Fill(SplineOrder + 1);
-    RegionType supportRegion;
-    supportRegion.SetSize(supportSize);
-    supportRegion.SetIndex(supportIndex);
-
     outputPoint.Fill(NumericTraits<ScalarType>::ZeroValue());
 
-    using IteratorType = ImageScanlineConstIterator<ImageType>;
-    IteratorType                coeffIterator[SpaceDimension];
-    unsigned long               counter = 0;
-    const ParametersValueType * basePointer = this->m_CoefficientImages[0]->GetBufferPointer();
+    /* Walk the support region with direct pointer arithmetic.  The
+     * coefficient images share one buffered region, so a single set of
+     * strides addresses all of them and the innermost loop runs over
+     * SplineOrder + 1 contiguous coefficients per scanline, which keeps
+     * the multiply-accumulate kernel open to compiler vectorization. */
+    const RegionType & bufferedRegion = this->m_CoefficientImages[0]->GetBufferedRegion();
+
+    OffsetValueType strides[SpaceDimension];
+    strides[0] = 1;
+    for (unsigned int d = 1; d < SpaceDimension; ++d)
+    {
+      strides[d] = strides[d - 1] * static_cast<OffsetValueType>(bufferedRegion.GetSize(d - 1));
+    }
+
+    OffsetValueType supportOffset = 0;
+    for (unsigned int d = 0; d < SpaceDimension; ++d)
+    {
+      supportOffset += (supportIndex[d] - bufferedRegion.GetIndex(d)) * strides[d];
+    }
+
+    const ParametersValueType * coefficientBuffers[SpaceDimension];
     for (unsigned int j = 0; j < SpaceDimension; ++j)
     {
-      coeffIterator[j] = IteratorType(this->m_CoefficientImages[j], supportRegion);
+      coefficientBuffers[j] = this->m_CoefficientImages[j]->GetBufferPointer();
     }
 
-    while (!coeffIterator[0].IsAtEnd())
+    constexpr SizeValueType supportPerDimension = SplineOrder + 1;
+    SizeValueType           numberOfLines = 1;
+    for (unsigned int d = 1; d < SpaceDimension; ++d)
     {
-      while (!coeffIterator[0].IsAtEndOfLine())
+      numberOfLines *= supportPerDimension;
+    }
+
+    IndexValueType lineIndex[SpaceDimension] = { 0 };
+    unsigned long  counter = 0;
+    for (SizeValueType line = 0; line < numberOfLines; ++line)
+    {
+      OffsetValueType lineOffset = supportOffset;
+      for (unsigned int d = 1; d < SpaceDimension; ++d)
+      {
+        lineOffset += lineIndex[d] * strides[d];
+      }
+
+      for (SizeValueType i = 0; i < supportPerDimension; ++i)
       {
+        const OffsetValueType pixelOffset = lineOffset + static_cast<OffsetValueType>(i);
+
         // Multiply weigth with coefficient
         for (unsigned int j = 0; j < SpaceDimension; ++j)
         {
-          outputPoint[j] += static_cast<ScalarType>(weights[counter] * coeffIterator[j].Get());
+          outputPoint[j] += static_cast<ScalarType>(weights[counter] * coefficientBuffers[j][pixelOffset]);
         }
 
         // Populate the indices array
-        indices[counter] = &(coeffIterator[0].Value()) - basePointer;
-
-        // Go to next coefficient in the support region
+        indices[counter] = pixelOffset;
         ++counter;
-        for (unsigned int j = 0; j < SpaceDimension; ++j)
-        {
-          ++(coeffIterator[j]);
-        }
       } // end scanline
 
-      for (unsigned int j = 0; j < SpaceDimension; ++j)
+      // Advance to the next scanline of the support region.
+      for (unsigned int d = 1; d < SpaceDimension; ++d)
       {
-        coeffIterator[j].NextLine();
+        if (++lineIndex[d] < static_cast<IndexValueType>(supportPerDimension))
+        {
+          break;
+        }
+        lineIndex[d] = 0;
       }
     }
 
@@ -608,10 +633,6 @@ BSplineTransform<TParametersValueType, NDimensions, VSplineOrder>::ComputeJacobi
   // Zero all components of jacobian
   jacobian.SetSize(SpaceDimension, this->GetNumberOfParameters());
   jacobian.Fill(0.0);
-  RegionType supportRegion;
-  SizeType   supportSize;
-  supportSize.Fill(SplineOrder + 1);
-  supportRegion.SetSize(supportSize);
 
   ContinuousIndexType index;
   this->m_CoefficientImages[0]->TransformPhysicalPointToContinuousIndex(point, index);
@@ -630,8 +651,6 @@ BSplineTransform<TParametersValueType, NDimensions, VSplineOrder>::ComputeJacobi
   IndexType supportIndex;
   this->m_WeightsFunction->Evaluate(index, weights, supportIndex);
 
-  supportRegion.SetIndex(supportIndex);
-
   IndexType startIndex = this->m_CoefficientImages[0]->GetLargestPossibleRegion().GetIndex();
 
   const MeshSizeType meshSize = this->GetTransformDomainMeshSize();
@@ -644,23 +663,52 @@ BSplineTransform<TParametersValueType, NDimensions, VSplineOrder>::ComputeJacobi
 
   SizeValueType numberOfParametersPerDimension = this->GetNumberOfParametersPerDimension();
 
-  ImageRegionConstIteratorWithIndex<ImageType> It(this->m_CoefficientImages[0], supportRegion);
-  unsigned long                                counter = 0;
-  for (It.GoToBegin(); !It.IsAtEnd(); ++It)
+  /* Walk the support region directly.  The linear parameter number of a
+   * support coefficient advances by one along the first dimension and by
+   * a fixed cumulative stride per higher dimension, so no per-pixel image
+   * iterator or index arithmetic is needed. */
+  unsigned long supportBase = supportIndex[0] - startIndex[0];
+  for (unsigned int d = 1; d < SpaceDimension; ++d)
+  {
+    supportBase += (supportIndex[d] - startIndex[d]) * cumulativeGridSizes[d - 1];
+  }
+
+  constexpr SizeValueType supportPerDimension = SplineOrder + 1;
+  SizeValueType           numberOfLines = 1;
+  for (unsigned int d = 1; d < SpaceDimension; ++d)
   {
-    typename ImageType::OffsetType currentIndex = It.GetIndex() - startIndex;
+    numberOfLines *= supportPerDimension;
+  }
 
-    unsigned long number = currentIndex[0];
+  IndexValueType lineIndex[SpaceDimension] = { 0 };
+  unsigned long  counter = 0;
+  for (SizeValueType line = 0; line < numberOfLines; ++line)
+  {
+    unsigned long lineBase = supportBase;
     for (unsigned int d = 1; d < SpaceDimension; ++d)
     {
-      number += (currentIndex[d] * cumulativeGridSizes[d - 1]);
+      lineBase += lineIndex[d] * cumulativeGridSizes[d - 1];
     }
 
-    for (unsigned int d = 0; d < SpaceDimension; ++d)
+    for (SizeValueType i = 0; i < supportPerDimension; ++i)
+    {
+      const unsigned long number = lineBase + i;
+      for (unsigned int d = 0; d < SpaceDimension; ++d)
+      {
+        jacobian(d, number + d * numberOfParametersPerDimension) = weights[counter];
+      }
+      counter++;
+    }
+
+    // Advance to the next scanline of the support region.
+    for (unsigned int d = 1; d < SpaceDimension; ++d)
     {
-      jacobian(d, number + d * numberOfParametersPerDimension) = weights[counter];
+      if (++lineIndex[d] < static_cast<IndexValueType>(supportPerDimension))
+      {
+        break;
+      }
+      lineIndex[d] = 0;
     }
-    counter++;
   }
 }
 
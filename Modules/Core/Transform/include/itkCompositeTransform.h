@@ -386,6 +386,24 @@ public:
   virtual void
   FlattenTransformQueue();
 
+  /**
+   * Return a new composite transform in which every maximal run of adjacent
+   * matrix-offset (linear) transforms has been precomposed into a single
+   * AffineTransform.  A chain such as rigid -> affine -> bspline -> affine
+   * collapses to affine -> bspline -> affine, so resampling through the
+   * result pays one matrix application per collapsed run instead of one
+   * virtual dispatch and one matrix application per member.
+   *
+   * The returned transform maps points the same way as this one, up to the
+   * floating point rounding of matrix precomposition.  Nested composite
+   * transforms are not traversed; call FlattenTransformQueue() first.  The
+   * result is intended for evaluation (e.g. resampling): the transforms to
+   * optimize flags are left at their defaults and precomposed members are
+   * detached from the originals.
+   */
+  Pointer
+  CollapseLinearTransforms() const;
+
   /**
    * Compute the Jacobian with respect to the parameters for the composite
    * transform using Jacobian rule. See comments in the implementation.
@@ -455,6 +473,11 @@ protected:
 
 private:
   mutable ModifiedTimeType m_PreviousTransformsToOptimizeUpdateTime;
+
+  /** Time at which m_Parameters was last assembled from the active
+   * sub-transforms.  GetParameters skips the concatenation while neither
+   * this transform nor any active sub-transform has been modified since. */
+  mutable ModifiedTimeType m_ParametersAssemblyTime;
 };
 
 } // end namespace itk
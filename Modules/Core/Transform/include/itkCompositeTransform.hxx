@@ -19,6 +19,7 @@
 #define itkCompositeTransform_hxx
 
 #include "itkCompositeTransform.h"
+#include "itkAffineTransform.h"
 
 namespace itk
 {
@@ -30,6 +31,7 @@ CompositeTransform<TParametersValueType, NDimensions>::CompositeTransform()
   this->m_TransformsToOptimizeFlags.clear();
   this->m_TransformsToOptimizeQueue.clear();
   this->m_PreviousTransformsToOptimizeUpdateTime = 0;
+  this->m_ParametersAssemblyTime = 0;
 }
 
 template <typename TParametersValueType, unsigned int NDimensions>
@@ -626,9 +628,29 @@ CompositeTransform<TParametersValueType, NDimensions>::GetParameters() const ->
   }
   else
   {
+    /* Assemble lazily: every write path of the sub-transforms bumps their
+     * modified time, so an unchanged stamp means the previously assembled
+     * concatenation is still valid and the per-iteration copy can be
+     * skipped. */
+    ModifiedTimeType latestTime = this->GetMTime();
+    for (const auto & transform : transforms)
+    {
+      const ModifiedTimeType transformTime = transform->GetMTime();
+      if (transformTime > latestTime)
+      {
+        latestTime = transformTime;
+      }
+    }
+
+    const NumberOfParametersType numberOfParameters = this->GetNumberOfParameters();
+    if (latestTime <= this->m_ParametersAssemblyTime && this->m_Parameters.Size() == numberOfParameters)
+    {
+      return this->m_Parameters;
+    }
+
     /* Resize destructively. But if it's already this size, nothing is done so
      * it's efficient. */
-    this->m_Parameters.SetSize(this->GetNumberOfParameters());
+    this->m_Parameters.SetSize(numberOfParameters);
 
     NumberOfParametersType offset = NumericTraits<NumberOfParametersType>::ZeroValue();
 
@@ -639,6 +661,8 @@ CompositeTransform<TParametersValueType, NDimensions>::GetParameters() const ->
       std::copy_n(subParameters.data_block(), subParameters.Size(), &(this->m_Parameters.data_block())[offset]);
       offset += subParameters.Size();
     }
+
+    this->m_ParametersAssemblyTime = latestTime;
   }
 
   return this->m_Parameters;
@@ -962,6 +986,62 @@ CompositeTransform<TParametersValueType, NDimensions>::FlattenTransformQueue()
 }
 
 
+template <typename TParametersValueType, unsigned int NDimensions>
+auto
+CompositeTransform<TParametersValueType, NDimensions>::CollapseLinearTransforms() const -> Pointer
+{
+  using MatrixOffsetTransformType = MatrixOffsetTransformBase<TParametersValueType, NDimensions, NDimensions>;
+  using AffineTransformType = AffineTransform<TParametersValueType, NDimensions>;
+
+  /* Collect the collapsed chain in application order, i.e. from the back of
+   * the queue, merging each maximal run of matrix-offset transforms into one
+   * affine transform. */
+  TransformQueueType                    collapsedApplicationOrder;
+  typename AffineTransformType::Pointer run;
+
+  for (auto it = this->m_TransformQueue.rbegin(); it != this->m_TransformQueue.rend(); ++it)
+  {
+    const auto * linear = dynamic_cast<const MatrixOffsetTransformType *>(it->GetPointer());
+    if (linear)
+    {
+      if (run.IsNull())
+      {
+        run = AffineTransformType::New();
+        run->SetMatrix(linear->GetMatrix());
+        run->SetOffset(linear->GetOffset());
+      }
+      else
+      {
+        /* The run so far is applied first, followed by this transform. */
+        run->Compose(linear, false);
+      }
+    }
+    else
+    {
+      if (run.IsNotNull())
+      {
+        collapsedApplicationOrder.push_back(run.GetPointer());
+        run = nullptr;
+      }
+      collapsedApplicationOrder.push_back(*it);
+    }
+  }
+  if (run.IsNotNull())
+  {
+    collapsedApplicationOrder.push_back(run.GetPointer());
+  }
+
+  /* Transforms are applied from the back of the queue, so rebuild the
+   * composite in reverse application order. */
+  auto collapsed = Self::New();
+  for (auto it = collapsedApplicationOrder.rbegin(); it != collapsedApplicationOrder.rend(); ++it)
+  {
+    collapsed->AddTransform(it->GetPointer());
+  }
+  return collapsed;
+}
+
+
 template <typename TParametersValueType, unsigned int NDimensions>
 void
 CompositeTransform<TParametersValueType, NDimensions>::PrintSelf(std::ostream & os, Indent indent) const
@@ -238,6 +238,16 @@ public:
   itkSetClampMacro(Stiffness, double, 0.0, NumericTraits<double>::max());
   itkGetConstMacro(Stiffness, double);
 
+  /** Solve the landmark system with a QR decomposition instead of the
+   * default singular value decomposition. The QR solver is considerably
+   * faster for large landmark sets, but it does not regularize a
+   * (numerically) singular system the way the SVD does, and the computed
+   * spline coefficients may differ from the SVD ones by floating-point
+   * rounding. Default is off. */
+  itkSetMacro(FastSolver, bool);
+  itkGetConstMacro(FastSolver, bool);
+  itkBooleanMacro(FastSolver);
+
 protected:
   KernelTransform();
   ~KernelTransform() override = default;
@@ -284,7 +294,10 @@ protected:
    * By overriding this method, we can obtain (among others):
    *    Elastic body spline
    *    Thin plate spline
-   *    Volume spline */
+   *    Volume spline
+   *
+   * \note ComputeK() invokes this method concurrently from multiple work
+   * units, so overriding implementations must not modify member data. */
   virtual void
   ComputeG(const InputVectorType & landmarkVector, GMatrixType & gmatrix) const;
 
@@ -304,7 +317,10 @@ protected:
   virtual void
   ComputeDeformationContribution(const InputPointType & thisPoint, OutputPointType & result) const;
 
-  /** Compute K matrix. */
+  /** Compute K matrix. The off-diagonal kernel blocks are evaluated in
+   * parallel over the work units of the MultiThreaderBase; every block is
+   * written exactly once, so the matrix is identical to the one of a
+   * serial evaluation. */
   void
   ComputeK();
 
@@ -374,6 +390,10 @@ protected:
   /** Has the W matrix been computed? */
   bool m_WMatrixComputed;
 
+  /** Solve the landmark system with a QR decomposition instead of the
+   * default SVD. */
+  bool m_FastSolver;
+
   /** Identity matrix. */
   IMatrixType m_I;
 
@@ -18,6 +18,9 @@
 #ifndef itkKernelTransform_hxx
 #define itkKernelTransform_hxx
 #include "itkKernelTransform.h"
+#include "itkMultiThreaderBase.h"
+#include "vnl/algo/vnl_qr.h"
+#include <vector>
 
 namespace itk
 {
@@ -36,6 +39,7 @@ KernelTransform<TParametersValueType, NDimensions>::KernelTransform()
   this->m_TargetLandmarks = PointSetType::New();
   this->m_Displacements = VectorSetType::New();
   this->m_WMatrixComputed = false;
+  this->m_FastSolver = false;
 
   this->m_Stiffness = 0.0;
 }
@@ -146,12 +150,22 @@ template <typename TParametersValueType, unsigned int NDimensions>
 void
 KernelTransform<TParametersValueType, NDimensions>::ComputeWMatrix()
 {
-  using SVDSolverType = vnl_svd<TParametersValueType>;
-
   this->ComputeL();
   this->ComputeY();
-  SVDSolverType svd(this->m_LMatrix, 1e-8);
-  this->m_WMatrix = svd.solve(this->m_YMatrix);
+  if (this->m_FastSolver)
+  {
+    // The QR decomposition is considerably faster than the SVD for large
+    // landmark sets, at the cost of the SVD's regularization of
+    // numerically singular systems
+    vnl_qr<TParametersValueType> qr(this->m_LMatrix);
+    this->m_WMatrix = qr.solve(this->m_YMatrix);
+  }
+  else
+  {
+    using SVDSolverType = vnl_svd<TParametersValueType>;
+    SVDSolverType svd(this->m_LMatrix, 1e-8);
+    this->m_WMatrix = svd.solve(this->m_YMatrix);
+  }
 
   this->ReorganizeW();
 }
@@ -196,39 +210,49 @@ KernelTransform<TParametersValueType, NDimensions>::ComputeK()
   PointsIterator p1 = this->m_SourceLandmarks->GetPoints()->Begin();
   PointsIterator end = this->m_SourceLandmarks->GetPoints()->End();
 
-  GMatrixType G;
-  // K matrix is symmetric, so only evaluate the upper triangle and
-  // store the values in bot the upper and lower triangle
+  // Gather the landmarks into contiguous storage, so that the rows of K
+  // can be evaluated independently of the point container iterators
+  std::vector<InputPointType> landmarks(numberOfLandmarks);
+
+  // Compute the block diagonal elements, i.e. kernel for pi->pi.
+  // ComputeReflexiveG is not thread-safe, so this sweep stays serial.
   unsigned int i = 0;
   while (p1 != end)
   {
-    PointsIterator p2 = p1; // start at the diagonal element
-    unsigned int   j = i;
+    landmarks[i] = p1.Value();
 
-    // Compute the block diagonal element, i.e. kernel for pi->pi
-    G = this->ComputeReflexiveG(p1);
+    const GMatrixType &                        G = this->ComputeReflexiveG(p1);
     const vnl_matrix_ref<TParametersValueType> G_reference_alias{
       G.as_ref()
     }; // different interfaces require different representations of values.
     this->m_KMatrix.update(
       G_reference_alias, i * NDimensions, i * NDimensions); // update only accepts `const vnl_matrix<T> &`
-    ++p2;
-    ++j;
-
-    // Compute the upper (and copy into lower) triangular part of K
-    while (p2 != end)
-    {
-      const InputVectorType s = p1.Value() - p2.Value();
-      this->ComputeG(s, G);
-      // write value in upper and lower triangle of matrix
-      this->m_KMatrix.update(G_reference_alias, i * NDimensions, j * NDimensions);
-      this->m_KMatrix.update(G_reference_alias, j * NDimensions, i * NDimensions);
-      ++p2;
-      ++j;
-    }
     ++p1;
     ++i;
   }
+
+  // K matrix is symmetric, so only evaluate the upper triangle and
+  // store the values in both the upper and lower triangle. Every block
+  // is written exactly once, so the rows can be evaluated in parallel
+  // over the work units and the matrix is identical to the one of a
+  // serial evaluation.
+  MultiThreaderBase::Pointer threader = MultiThreaderBase::New();
+  threader->ParallelizeArray(
+    0,
+    numberOfLandmarks,
+    [this, &landmarks, numberOfLandmarks](SizeValueType row) {
+      GMatrixType G;
+      for (PointIdentifier col = row + 1; col < numberOfLandmarks; ++col)
+      {
+        const InputVectorType s = landmarks[row] - landmarks[col];
+        this->ComputeG(s, G);
+        const vnl_matrix_ref<TParametersValueType> G_reference_alias{ G.as_ref() };
+        // write value in upper and lower triangle of matrix
+        this->m_KMatrix.update(G_reference_alias, row * NDimensions, col * NDimensions);
+        this->m_KMatrix.update(G_reference_alias, col * NDimensions, row * NDimensions);
+      }
+    },
+    nullptr);
 }
 
 
@@ -531,6 +555,7 @@ KernelTransform<TParametersValueType, NDimensions>::PrintSelf(std::ostream & os,
     this->m_Displacements->Print(os, indent.GetNextIndent());
   }
   os << indent << "Stiffness: " << this->m_Stiffness << std::endl;
+  os << indent << "FastSolver: " << (this->m_FastSolver ? "On" : "Off") << std::endl;
 }
 
 } // end namespace itk
@@ -134,7 +134,21 @@ typename MatrixOffsetTransformBase<TParametersValueType, NInputDimensions, NOutp
 MatrixOffsetTransformBase<TParametersValueType, NInputDimensions, NOutputDimensions>::TransformPoint(
   const InputPointType & point) const
 {
-  return m_Matrix * point + m_Offset;
+  // Apply the matrix and add the offset row by row in a single fused pass.
+  // This avoids the intermediate Point temporary and second loop of
+  // m_Matrix * point + m_Offset, and the fixed-size loops fully unroll for
+  // the common 2-D/3-D/4-D instantiations.
+  OutputPointType result;
+  for (unsigned int r = 0; r < NOutputDimensions; ++r)
+  {
+    ScalarType sum = m_Offset[r];
+    for (unsigned int c = 0; c < NInputDimensions; ++c)
+    {
+      sum += m_Matrix[r][c] * point[c];
+    }
+    result[r] = sum;
+  }
+  return result;
 }
 
 
@@ -152,7 +166,9 @@ typename MatrixOffsetTransformBase<TParametersValueType, NInputDimensions, NOutp
 MatrixOffsetTransformBase<TParametersValueType, NInputDimensions, NOutputDimensions>::TransformVector(
   const InputVnlVectorType & vect) const
 {
-  return m_Matrix.GetVnlMatrix() * vect;
+  // Matrix::operator* on a vnl_vector_fixed is a plain unrolled loop; going
+  // through GetVnlMatrix() would route the product through vnl instead.
+  return m_Matrix * vect;
 }
 
 
@@ -0,0 +1,115 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include <iostream>
+
+#include "itkAffineTransform.h"
+#include "itkBSplineTransform.h"
+#include "itkCompositeTransform.h"
+#include "itkEuler2DTransform.h"
+#include "itkTestingMacros.h"
+
+int
+itkCompositeTransformCollapseLinearTest(int, char *[])
+{
+  constexpr unsigned int NDimensions = 2;
+  const double           epsilon = 1e-10;
+
+  using ScalarType = double;
+  using CompositeType = itk::CompositeTransform<ScalarType, NDimensions>;
+  using AffineType = itk::AffineTransform<ScalarType, NDimensions>;
+  using RigidType = itk::Euler2DTransform<ScalarType>;
+  using BSplineType = itk::BSplineTransform<ScalarType, NDimensions, 3>;
+
+  // Build a rigid -> affine -> bspline -> affine chain (application order)
+  auto rigid = RigidType::New();
+  rigid->SetAngle(0.3);
+  RigidType::OutputVectorType rigidTranslation;
+  rigidTranslation[0] = 2.0;
+  rigidTranslation[1] = -1.0;
+  rigid->SetTranslation(rigidTranslation);
+
+  auto affine = AffineType::New();
+  affine->Scale(1.2);
+  AffineType::OutputVectorType affineTranslation;
+  affineTranslation[0] = -5.0;
+  affineTranslation[1] = 3.0;
+  affine->Translate(affineTranslation);
+
+  auto bspline = BSplineType::New();
+  BSplineType::PhysicalDimensionsType physicalDimensions;
+  physicalDimensions.Fill(50.0);
+  BSplineType::MeshSizeType meshSize;
+  meshSize.Fill(4);
+  bspline->SetTransformDomainPhysicalDimensions(physicalDimensions);
+  bspline->SetTransformDomainMeshSize(meshSize);
+  BSplineType::ParametersType bsplineParameters(bspline->GetNumberOfParameters());
+  for (unsigned int i = 0; i < bsplineParameters.GetSize(); ++i)
+  {
+    bsplineParameters[i] = 0.01 * (i % 7);
+  }
+  bspline->SetParameters(bsplineParameters);
+
+  auto affine2 = AffineType::New();
+  affine2->Rotate2D(-0.1);
+
+  // Transforms are applied from the back of the queue, so add in reverse
+  // application order
+  auto composite = CompositeType::New();
+  composite->AddTransform(affine2);
+  composite->AddTransform(bspline);
+  composite->AddTransform(affine);
+  composite->AddTransform(rigid);
+
+  CompositeType::Pointer collapsed = composite->CollapseLinearTransforms();
+
+  // rigid + affine collapse into one; bspline and the trailing affine remain
+  ITK_TEST_EXPECT_EQUAL(3, collapsed->GetNumberOfTransforms());
+
+  // The collapsed chain must map points like the original one
+  for (double x = 5.0; x < 45.0; x += 7.3)
+  {
+    for (double y = 5.0; y < 45.0; y += 7.3)
+    {
+      CompositeType::InputPointType point;
+      point[0] = x;
+      point[1] = y;
+      const CompositeType::OutputPointType expected = composite->TransformPoint(point);
+      const CompositeType::OutputPointType actual = collapsed->TransformPoint(point);
+      for (unsigned int d = 0; d < NDimensions; ++d)
+      {
+        if (std::fabs(expected[d] - actual[d]) > epsilon)
+        {
+          std::cout << "Test failed! Collapsed chain maps " << point << " to " << actual << ", expected " << expected
+                    << std::endl;
+          return EXIT_FAILURE;
+        }
+      }
+    }
+  }
+
+  // An all-linear chain collapses to a single transform
+  auto allLinear = CompositeType::New();
+  allLinear->AddTransform(affine2);
+  allLinear->AddTransform(affine);
+  allLinear->AddTransform(rigid);
+  ITK_TEST_EXPECT_EQUAL(1, allLinear->CollapseLinearTransforms()->GetNumberOfTransforms());
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -199,6 +199,38 @@ itkSplineKernelTransformTest(int, char *[])
     return EXIT_FAILURE;
   }
 
+  std::cout << "TPS 2D QR solver Test:" << std::endl;
+  auto tpsQR2D = TPSTransform2DType::New();
+  tpsQR2D->SetSourceLandmarks(sourceLandmarks2D);
+  tpsQR2D->SetTargetLandmarks(targetLandmarks2D);
+  tpsQR2D->FastSolverOn();
+  if (!tpsQR2D->GetFastSolver())
+  {
+    std::cout << "ERROR:  FastSolverOn() value not retained." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  tpsQR2D->ComputeWMatrix();
+
+  source2Dit = sourceLandmarks2D->GetPoints()->Begin();
+  target2Dit = targetLandmarks2D->GetPoints()->Begin();
+
+  source2Dend = sourceLandmarks2D->GetPoints()->End();
+  while (source2Dit != source2Dend)
+  {
+    sourcePoint2D = source2Dit.Value();
+    targetPoint2D = target2Dit.Value();
+    mappedPoint2D = tpsQR2D->TransformPoint(sourcePoint2D);
+    std::cout << sourcePoint2D << " : " << targetPoint2D;
+    std::cout << " warps to: " << mappedPoint2D << std::endl;
+    if (mappedPoint2D.EuclideanDistanceTo(targetPoint2D) > epsilon)
+    {
+      return EXIT_FAILURE;
+    }
+    source2Dit++;
+    target2Dit++;
+  }
+
 
   // NOTE: The following should set the default values explicitly
   {
@@ -47,6 +47,11 @@ namespace itk
  * Digital Image Processing.
  * Addison Wesley, 491-494, (1993).
  *
+ * The implementation keeps a worklist of the pixels that may still change,
+ * so stable regions are not rescanned, and examines the candidates of each
+ * thinning sub-step in parallel. The produced skeleton is identical to that
+ * of a serial full-scan implementation.
+ *
  * To do: Make this filter ND.
  *
  * \sa MorphologyImageFilter
@@ -22,6 +22,9 @@
 
 #include "itkBinaryThinningImageFilter.h"
 #include "itkImageRegionIterator.h"
+#include "itkMultiThreaderBase.h"
+
+#include <algorithm>
 #include <vector>
 
 namespace itk
@@ -107,176 +110,306 @@ BinaryThinningImageFilter<TInputImage, TOutputImage>::ComputeThinImage()
 
   typename NeighborhoodIteratorType::RadiusType radius;
   radius.Fill(1);
-  NeighborhoodIteratorType ot(radius, thinImage, region);
 
   // Create a set of offsets from the center.
   // This numbering follows that of Gonzalez and Woods.
   using OffsetType = typename NeighborhoodIteratorType::OffsetType;
-  OffsetType o2 = { { 0, -1 } };
-  OffsetType o3 = { { 1, -1 } };
-  OffsetType o4 = { { 1, 0 } };
-  OffsetType o5 = { { 1, 1 } };
-  OffsetType o6 = { { 0, 1 } };
-  OffsetType o7 = { { -1, 1 } };
-  OffsetType o8 = { { -1, 0 } };
-  OffsetType o9 = { { -1, -1 } };
-
-  PixelType p2;
-  PixelType p3;
-  PixelType p4;
-  PixelType p5;
-  PixelType p6;
-  PixelType p7;
-  PixelType p8;
-  PixelType p9;
-
-  // These tests correspond to the conditions listed in Gonzalez and Woods
-  bool testA;
-  bool testB;
-  bool testC;
-  bool testD;
-
-  std::vector<IndexType>                    pixelsToDelete;
-  typename std::vector<IndexType>::iterator pixelsToDeleteIt;
+  const OffsetType o2 = { { 0, -1 } };
+  const OffsetType o3 = { { 1, -1 } };
+  const OffsetType o4 = { { 1, 0 } };
+  const OffsetType o5 = { { 1, 1 } };
+  const OffsetType o6 = { { 0, 1 } };
+  const OffsetType o7 = { { -1, 1 } };
+  const OffsetType o8 = { { -1, 0 } };
+  const OffsetType o9 = { { -1, -1 } };
+
+  const OffsetType neighborOffsets[8] = { o2, o3, o4, o5, o6, o7, o8, o9 };
+
+  // Decides whether the center pixel of 'ot' is to be deleted by the given
+  // thinning sub-step. These tests correspond to the conditions listed in
+  // Gonzalez and Woods.
+  const auto isDeletable = [&o2, &o3, &o4, &o5, &o6, &o7, &o8, &o9](const NeighborhoodIteratorType & ot,
+                                                                    const int                        step) -> bool {
+    const PixelType p2 = ot.GetPixel(o2);
+    const PixelType p3 = ot.GetPixel(o3);
+    const PixelType p4 = ot.GetPixel(o4);
+    const PixelType p5 = ot.GetPixel(o5);
+    const PixelType p6 = ot.GetPixel(o6);
+    const PixelType p7 = ot.GetPixel(o7);
+    const PixelType p8 = ot.GetPixel(o8);
+    const PixelType p9 = ot.GetPixel(o9);
+
+    bool testA = false;
+    bool testB = false;
+    bool testC = false;
+    bool testD = false;
+
+    // TestA
+    // Count the number of neighbors that are on.
+    // TestA is violated when contour point p1 has only one or
+    // seven 8-neighbors valued 1.  Having only one such
+    // neighbor implies that p1 is the end point of a skeleton
+    // stroke and obviously should not be deleted.  Deleting p1
+    // if it has seven such neighbos would cause erosion into a region.
+    const PixelType numberOfOnNeighbors = p2 + p3 + p4 + p5 + p6 + p7 + p8 + p9;
+
+    if (numberOfOnNeighbors > 1 && numberOfOnNeighbors < 7)
+    {
+      testA = true;
+    }
+
+    // TestB
+    // Count the number of 0-1 transitions in the ordered
+    // sequence.
+    // TestB is violated when it is applied to points on a
+    // stroke 1 pixel thick.  Hence this test prevents
+    // disconnetion of segments of a skeleton during the
+    // thinning operation.
+    // First find the total number of transitions, and then
+    // divide by 2.
+    const PixelType transitions = (std::abs(static_cast<int>(p3 - p2)) + std::abs(static_cast<int>(p4 - p3)) +
+                                   std::abs(static_cast<int>(p5 - p4)) + std::abs(static_cast<int>(p6 - p5)) +
+                                   std::abs(static_cast<int>(p7 - p6)) + std::abs(static_cast<int>(p8 - p7)) +
+                                   std::abs(static_cast<int>(p9 - p8)) + std::abs(static_cast<int>(p2 - p9))) /
+                                  2;
+
+    if (transitions == 1)
+    {
+      testB = true;
+    }
+
+    // TestC and TestD
+    // Step 1 in Gonzalez and Woods is broken up here into two
+    // steps; step 1 and step 2.
+    // Steps 1 and 2 are the first two passes over the image for each
+    // iteration of the algorithm.
+    // A point that satisfies these tests as well as TestA
+    // and TestB is an east or south boundary point or a
+    // northwest corner point in the boundary.
+    // Note that northeast and southwest corner points are
+    // satisfied in both the combination of steps 1 and 2 and
+    // the combination of steps 3 and 4.
+    if (step == 1)
+    {
+      if (p4 == 0 || p6 == 0)
+      {
+        testC = true;
+        testD = true;
+      }
+    }
+
+    else if (step == 2)
+    {
+      if (p2 == 0 && p8 == 0)
+      {
+        testC = true;
+        testD = true;
+      }
+    }
+
+    // Step 2 in Gonzalez and Woods is broken up here into two
+    // steps; step 3 and step 4.
+    // Steps 3 and 4 are the second passes over the image for each
+    // iteration of the algorithm.
+    // A point that satisfies these tests as well as TestA
+    // and TestB is a west or north boundary point or a
+    // southeast corner point in the boundary.
+    // Note that northeast and southwest corner points are
+    // satisfied in both the combination of steps 1 and 2 and
+    // the combination of steps 3 and 4.
+    else if (step == 3)
+    {
+      if (p2 == 0 || p8 == 0)
+      {
+        testC = true;
+        testD = true;
+      }
+    }
+    else if (step == 4)
+    {
+      if (p4 == 0 && p6 == 0)
+      {
+        testC = true;
+        testD = true;
+      }
+    }
+
+    return testA && testB && testC && testD;
+  };
+
+  // Worklist bookkeeping. Each pixel carries a small bit mask recording by
+  // which of the four thinning sub-steps it still has to be examined, in the
+  // current round over the steps (low nibble) and in the next round (high
+  // nibble). A pixel whose 8-neighborhood has not changed since a sub-step
+  // last examined it produces the same decision again, so a pixel is only
+  // re-listed when one of its neighbors is deleted: stable regions are never
+  // rescanned. The deletions applied by each sub-step are identical to those
+  // of a full scan of the image, so the result is unchanged.
+  OutputImagePixelType * const buffer = thinImage->GetBufferPointer();
+  const SizeValueType          numberOfPixels = thinImage->GetBufferedRegion().GetNumberOfPixels();
+
+  std::vector<unsigned char> pendingSteps(numberOfPixels, 0);
+  std::vector<SizeValueType> candidates[4];
+  std::vector<SizeValueType> nextCandidates[4];
+
+  // Initially, every foreground pixel is a candidate for every sub-step.
+  for (SizeValueType offset = 0; offset < numberOfPixels; ++offset)
+  {
+    if (buffer[offset])
+    {
+      pendingSteps[offset] = 0x0F;
+      for (auto & stepCandidates : candidates)
+      {
+        stepCandidates.push_back(offset);
+      }
+    }
+  }
+
+  MultiThreaderBase * const multiThreader = this->GetMultiThreader();
+  const auto                numberOfWorkUnits = static_cast<SizeValueType>(this->GetNumberOfWorkUnits());
+
+  std::vector<SizeValueType> pixelsToDelete;
 
   // Loop through the image several times until there is no change.
-  bool noChange = false;
-  while (!noChange)
+  while (!(candidates[0].empty() && candidates[1].empty() && candidates[2].empty() && candidates[3].empty()))
   {
-    noChange = true;
     // Loop through the thinning steps.
     for (int step = 1; step <= 4; ++step)
     {
+      std::vector<SizeValueType> & stepCandidates = candidates[step - 1];
+
       pixelsToDelete.clear();
-      // Loop through the image.
-      for (ot.GoToBegin(); !ot.IsAtEnd(); ++ot)
+
+      // Mark phase: examine the listed pixels. The decisions only read the
+      // image, and the deletions are applied after the whole sub-step just
+      // as in a serial full scan, so the candidates can be examined in
+      // parallel chunks. The deletion set does not depend on the
+      // examination order.
+      const auto          numberOfCandidates = static_cast<SizeValueType>(stepCandidates.size());
+      const SizeValueType numberOfChunks =
+        std::min(std::max(numberOfCandidates / 4096, SizeValueType{ 1 }), numberOfWorkUnits);
+
+      if (numberOfChunks <= 1)
       {
-        // Each iteration over the image, set all tests to false.
-        testA = false;
-        testB = false;
-        testC = false;
-        testD = false;
-
-        p2 = ot.GetPixel(o2);
-        p3 = ot.GetPixel(o3);
-        p4 = ot.GetPixel(o4);
-        p5 = ot.GetPixel(o5);
-        p6 = ot.GetPixel(o6);
-        p7 = ot.GetPixel(o7);
-        p8 = ot.GetPixel(o8);
-        p9 = ot.GetPixel(o9);
-
-        // Determine whether the pixel should be deleted in the
-        // following if statements.
-        if (ot.GetCenterPixel())
+        NeighborhoodIteratorType ot(radius, thinImage, region);
+        for (const SizeValueType offset : stepCandidates)
         {
-          // TestA
-          // Count the number of neighbors that are on.
-          // TestA is violated when contour point p1 has only one or
-          // seven 8-neighbors valued 1.  Having only one such
-          // neighbor implies that p1 is the end point of a skeleton
-          // stroke and obviously should not be deleted.  Deleting p1
-          // if it has seven such neighbos would cause erosion into a region.
-          PixelType numberOfOnNeighbors = p2 + p3 + p4 + p5 + p6 + p7 + p8 + p9;
-
-          if (numberOfOnNeighbors > 1 && numberOfOnNeighbors < 7)
+          if (buffer[offset])
           {
-            testA = true;
+            ot.SetLocation(thinImage->ComputeIndex(offset));
+            if (isDeletable(ot, step))
+            {
+              pixelsToDelete.push_back(offset);
+            }
           }
+        }
+      }
+      else
+      {
+        std::vector<std::vector<SizeValueType>> chunkPixelsToDelete(numberOfChunks);
 
-          // TestB
-          // Count the number of 0-1 transitions in the ordered
-          // sequence.
-          // TestB is violated when it is applied to points on a
-          // stroke 1 pixel thick.  Hence this test prevents
-          // disconnetion of segments of a skeleton during the
-          // thinning operation.
-          // First find the total number of transitions, and then
-          // divide by 2.
-          const PixelType transitions = (std::abs(static_cast<int>(p3 - p2)) + std::abs(static_cast<int>(p4 - p3)) +
-                                         std::abs(static_cast<int>(p5 - p4)) + std::abs(static_cast<int>(p6 - p5)) +
-                                         std::abs(static_cast<int>(p7 - p6)) + std::abs(static_cast<int>(p8 - p7)) +
-                                         std::abs(static_cast<int>(p9 - p8)) + std::abs(static_cast<int>(p2 - p9))) /
-                                        2;
-
-          if (transitions == 1)
-          {
-            testB = true;
-          }
+        multiThreader->ParallelizeArray(
+          0,
+          numberOfChunks,
+          [&thinImage, &region, &radius, &stepCandidates, &chunkPixelsToDelete, &isDeletable, buffer, step, numberOfCandidates, numberOfChunks](
+            SizeValueType chunk) {
+            const SizeValueType chunkBegin = chunk * numberOfCandidates / numberOfChunks;
+            const SizeValueType chunkEnd = (chunk + 1) * numberOfCandidates / numberOfChunks;
 
-          // TestC and TestD
-          // Step 1 in Gonzalez and Woods is broken up here into two
-          // steps; step 1 and step 2.
-          // Steps 1 and 2 are the first two passes over the image for each
-          // iteration of the algorithm.
-          // A point that satisfies these tests as well as TestA
-          // and TestB is an east or south boundary point or a
-          // northwest corner point in the boundary.
-          // Note that northeast and southwest corner points are
-          // satisfied in both the combination of steps 1 and 2 and
-          // the combination of steps 3 and 4.
-          if (step == 1)
-          {
-            if (p4 == 0 || p6 == 0)
+            NeighborhoodIteratorType     ot(radius, thinImage, region);
+            std::vector<SizeValueType> & chunkDeletions = chunkPixelsToDelete[chunk];
+
+            for (SizeValueType candidate = chunkBegin; candidate < chunkEnd; ++candidate)
             {
-              testC = true;
-              testD = true;
+              const SizeValueType offset = stepCandidates[candidate];
+              if (buffer[offset])
+              {
+                ot.SetLocation(thinImage->ComputeIndex(offset));
+                if (isDeletable(ot, step))
+                {
+                  chunkDeletions.push_back(offset);
+                }
+              }
             }
-          }
+          },
+          nullptr);
 
-          else if (step == 2)
+        for (const std::vector<SizeValueType> & chunkDeletions : chunkPixelsToDelete)
+        {
+          pixelsToDelete.insert(pixelsToDelete.end(), chunkDeletions.begin(), chunkDeletions.end());
+        }
+      }
+
+      // The listed pixels are no longer pending for this sub-step.
+      const auto currentStepBit = static_cast<unsigned char>(1 << (step - 1));
+      for (const SizeValueType offset : stepCandidates)
+      {
+        pendingSteps[offset] = static_cast<unsigned char>(pendingSteps[offset] & ~currentStepBit);
+      }
+      stepCandidates.clear();
+
+      // Apply the deletions, then re-list the foreground neighbors of every
+      // deleted pixel: their decisions may change for the remaining
+      // sub-steps of this round, and for the sub-steps up to and including
+      // this one of the next round (this sub-step's scan saw the image from
+      // before its deletions).
+      for (const SizeValueType offset : pixelsToDelete)
+      {
+        buffer[offset] = 0;
+      }
+      for (const SizeValueType offset : pixelsToDelete)
+      {
+        const IndexType index = thinImage->ComputeIndex(offset);
+        for (const OffsetType & neighborOffset : neighborOffsets)
+        {
+          const IndexType neighborIndex = index + neighborOffset;
+          if (!region.IsInside(neighborIndex))
           {
-            if (p2 == 0 && p8 == 0)
-            {
-              testC = true;
-              testD = true;
-            }
+            continue;
           }
-
-          // Step 2 in Gonzalez and Woods is broken up here into two
-          // steps; step 3 and step 4.
-          // Steps 3 and 4 are the second passes over the image for each
-          // iteration of the algorithm.
-          // A point that satisfies these tests as well as TestA
-          // and TestB is a west or north boundary point or a
-          // southeast corner point in the boundary.
-          // Note that northeast and southwest corner points are
-          // satisfied in both the combination of steps 1 and 2 and
-          // the combination of steps 3 and 4.
-          else if (step == 3)
+          const SizeValueType neighbor = thinImage->ComputeOffset(neighborIndex);
+          if (!buffer[neighbor])
           {
-            if (p2 == 0 || p8 == 0)
-            {
-              testC = true;
-              testD = true;
-            }
+            continue;
           }
-          else if (step == 4)
+          unsigned char & mask = pendingSteps[neighbor];
+          for (int laterStep = step + 1; laterStep <= 4; ++laterStep)
           {
-            if (p4 == 0 && p6 == 0)
+            const auto bit = static_cast<unsigned char>(1 << (laterStep - 1));
+            if (!(mask & bit))
             {
-              testC = true;
-              testD = true;
+              mask = static_cast<unsigned char>(mask | bit);
+              candidates[laterStep - 1].push_back(neighbor);
             }
           }
-
-          // If all tests pass, mark the pixel for removal
-          if (testA && testB && testC && testD)
+          for (int earlierStep = 1; earlierStep <= step; ++earlierStep)
           {
-            pixelsToDelete.push_back(ot.GetIndex());
-            noChange = false;
+            const auto bit = static_cast<unsigned char>(1 << (4 + earlierStep - 1));
+            if (!(mask & bit))
+            {
+              mask = static_cast<unsigned char>(mask | bit);
+              nextCandidates[earlierStep - 1].push_back(neighbor);
+            }
           }
         }
-      } // end image iteration loop
+      }
+    } // end step loop
 
-      // Loop through the vector of pixels to delete and set these pixels to 0 in
-      // the image.
-      for (pixelsToDeleteIt = pixelsToDelete.begin(); pixelsToDeleteIt != pixelsToDelete.end(); ++pixelsToDeleteIt)
+    // Round transition: the pixels re-listed for the next round become the
+    // current candidates.
+    for (int s = 0; s < 4; ++s)
+    {
+      candidates[s] = std::move(nextCandidates[s]);
+      nextCandidates[s].clear();
+
+      const auto lowBit = static_cast<unsigned char>(1 << s);
+      const auto highBit = static_cast<unsigned char>(1 << (4 + s));
+      for (const SizeValueType offset : candidates[s])
       {
-        thinImage->SetPixel(*pixelsToDeleteIt, 0);
+        pendingSteps[offset] = static_cast<unsigned char>((pendingSteps[offset] & ~highBit) | lowBit);
       }
-    } // end step loop
-  }   // end noChange while loop
+    }
+  } // end round loop
 
   itkDebugMacro(<< "ComputeThinImage End");
 }
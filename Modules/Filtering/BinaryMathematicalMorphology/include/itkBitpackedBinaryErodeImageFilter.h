@@ -0,0 +1,68 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkBitpackedBinaryErodeImageFilter_h
+#define itkBitpackedBinaryErodeImageFilter_h
+
+#include "itkBitpackedBinaryErodeDilateImageFilter.h"
+
+namespace itk
+{
+/**
+ * \class BitpackedBinaryErodeImageFilter
+ * \brief Fast binary erosion of full-box structuring elements, 64
+ * pixels per word.
+ *
+ * Box kernels are run through the separable bitpacked engine of
+ * BitpackedBinaryErodeDilateImageFilter; other kernels fall back to
+ * BinaryErodeImageFilter with identical results. As in the classic
+ * filter, the boundary defaults to foreground.
+ *
+ * \sa BitpackedBinaryErodeDilateImageFilter
+ * \sa BinaryErodeImageFilter
+ * \ingroup ITKBinaryMathematicalMorphology
+ */
+template <typename TInputImage, typename TOutputImage, typename TKernel>
+class ITK_TEMPLATE_EXPORT BitpackedBinaryErodeImageFilter
+  : public BitpackedBinaryErodeDilateImageFilter<TInputImage, TOutputImage, TKernel>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(BitpackedBinaryErodeImageFilter);
+
+  /** Standard class type aliases. */
+  using Self = BitpackedBinaryErodeImageFilter;
+  using Superclass = BitpackedBinaryErodeDilateImageFilter<TInputImage, TOutputImage, TKernel>;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(BitpackedBinaryErodeImageFilter, BitpackedBinaryErodeDilateImageFilter);
+
+protected:
+  BitpackedBinaryErodeImageFilter()
+  {
+    this->m_Dilation = false;
+    this->m_BoundaryToForeground = true;
+  }
+  ~BitpackedBinaryErodeImageFilter() override = default;
+};
+} // end namespace itk
+
+#endif
@@ -0,0 +1,170 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkBitpackedBinaryDilateImageFilter.h"
+#include "itkBitpackedBinaryErodeImageFilter.h"
+#include "itkBinaryDilateImageFilter.h"
+#include "itkBinaryErodeImageFilter.h"
+#include "itkFlatStructuringElement.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkTestingMacros.h"
+
+namespace
+{
+
+using ImageType = itk::Image<unsigned char, 2>;
+
+// Compare two outputs pixel by pixel.
+bool
+ImagesAreIdentical(const ImageType * result, const ImageType * reference, const char * description)
+{
+  itk::ImageRegionConstIteratorWithIndex<ImageType> resultIt(result, result->GetLargestPossibleRegion());
+  for (resultIt.GoToBegin(); !resultIt.IsAtEnd(); ++resultIt)
+  {
+    const auto referenceValue = reference->GetPixel(resultIt.GetIndex());
+    if (resultIt.Get() != referenceValue)
+    {
+      std::cerr << description << ": value " << static_cast<int>(resultIt.Get()) << " at " << resultIt.GetIndex()
+                << " differs from expected value " << static_cast<int>(referenceValue) << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+int
+itkBitpackedBinaryErodeDilateImageFilterTest(int, char *[])
+{
+  using KernelType = itk::FlatStructuringElement<2>;
+
+  constexpr unsigned char foregroundValue = 100;
+  constexpr unsigned char backgroundValue = 5;
+
+  // A deterministic input mixing foreground, background and other
+  // intensity values, wider than 64 pixels so that the packed rows
+  // span several words.
+  auto input = ImageType::New();
+  ImageType::SizeType size;
+  size[0] = 71;
+  size[1] = 23;
+  input->SetRegions(size);
+  input->Allocate();
+
+  itk::ImageRegionIteratorWithIndex<ImageType> inputIt(input, input->GetLargestPossibleRegion());
+  for (inputIt.GoToBegin(); !inputIt.IsAtEnd(); ++inputIt)
+  {
+    const ImageType::IndexType index = inputIt.GetIndex();
+    const auto                 hash = static_cast<unsigned int>(index[0] * 13 + index[1] * 7) % 5;
+    if (hash < 2)
+    {
+      inputIt.Set(foregroundValue);
+    }
+    else if (hash == 2)
+    {
+      inputIt.Set(backgroundValue);
+    }
+    else
+    {
+      inputIt.Set(static_cast<unsigned char>(hash * 20));
+    }
+  }
+
+  KernelType::SizeType boxRadius;
+  boxRadius[0] = 2;
+  boxRadius[1] = 1;
+  const KernelType boxKernel = KernelType::Box(boxRadius);
+
+  KernelType::SizeType ballRadius;
+  ballRadius.Fill(2);
+  const KernelType ballKernel = KernelType::Ball(ballRadius);
+
+  for (const KernelType & kernel : { boxKernel, ballKernel })
+  {
+    // Dilation against the classic border-following filter.
+    auto bitpackedDilate = itk::BitpackedBinaryDilateImageFilter<ImageType, ImageType, KernelType>::New();
+    bitpackedDilate->SetInput(input);
+    bitpackedDilate->SetKernel(kernel);
+    bitpackedDilate->SetForegroundValue(foregroundValue);
+    bitpackedDilate->SetBackgroundValue(backgroundValue);
+
+    auto classicDilate = itk::BinaryDilateImageFilter<ImageType, ImageType, KernelType>::New();
+    classicDilate->SetInput(input);
+    classicDilate->SetKernel(kernel);
+    classicDilate->SetForegroundValue(foregroundValue);
+    classicDilate->SetBackgroundValue(backgroundValue);
+
+    ITK_TRY_EXPECT_NO_EXCEPTION(bitpackedDilate->Update());
+    ITK_TRY_EXPECT_NO_EXCEPTION(classicDilate->Update());
+
+    if (!ImagesAreIdentical(bitpackedDilate->GetOutput(), classicDilate->GetOutput(), "Dilation"))
+    {
+      return EXIT_FAILURE;
+    }
+
+    // Erosion, with the same boundary condition as the classic filter.
+    auto bitpackedErode = itk::BitpackedBinaryErodeImageFilter<ImageType, ImageType, KernelType>::New();
+    bitpackedErode->SetInput(input);
+    bitpackedErode->SetKernel(kernel);
+    bitpackedErode->SetForegroundValue(foregroundValue);
+    bitpackedErode->SetBackgroundValue(backgroundValue);
+
+    auto classicErode = itk::BinaryErodeImageFilter<ImageType, ImageType, KernelType>::New();
+    classicErode->SetInput(input);
+    classicErode->SetKernel(kernel);
+    classicErode->SetForegroundValue(foregroundValue);
+    classicErode->SetBackgroundValue(backgroundValue);
+
+    ITK_TRY_EXPECT_NO_EXCEPTION(bitpackedErode->Update());
+    ITK_TRY_EXPECT_NO_EXCEPTION(classicErode->Update());
+
+    if (!ImagesAreIdentical(bitpackedErode->GetOutput(), classicErode->GetOutput(), "Erosion"))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Exercise the non-default boundary condition on the bitpacked path.
+  auto boundaryDilate = itk::BitpackedBinaryDilateImageFilter<ImageType, ImageType, KernelType>::New();
+  boundaryDilate->SetInput(input);
+  boundaryDilate->SetKernel(boxKernel);
+  boundaryDilate->SetForegroundValue(foregroundValue);
+  boundaryDilate->SetBackgroundValue(backgroundValue);
+  boundaryDilate->BoundaryToForegroundOn();
+
+  auto classicBoundaryDilate = itk::BinaryDilateImageFilter<ImageType, ImageType, KernelType>::New();
+  classicBoundaryDilate->SetInput(input);
+  classicBoundaryDilate->SetKernel(boxKernel);
+  classicBoundaryDilate->SetForegroundValue(foregroundValue);
+  classicBoundaryDilate->SetBackgroundValue(backgroundValue);
+  classicBoundaryDilate->BoundaryToForegroundOn();
+
+  ITK_TRY_EXPECT_NO_EXCEPTION(boundaryDilate->Update());
+  ITK_TRY_EXPECT_NO_EXCEPTION(classicBoundaryDilate->Update());
+
+  if (!ImagesAreIdentical(boundaryDilate->GetOutput(), classicBoundaryDilate->GetOutput(), "Boundary dilation"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  ITK_EXERCISE_BASIC_OBJECT_METHODS(
+    boundaryDilate, BitpackedBinaryDilateImageFilter, BitpackedBinaryErodeDilateImageFilter);
+
+  return EXIT_SUCCESS;
+}
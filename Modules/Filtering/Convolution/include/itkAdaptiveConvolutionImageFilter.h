@@ -0,0 +1,216 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkAdaptiveConvolutionImageFilter_h
+#define itkAdaptiveConvolutionImageFilter_h
+
+#include "itkConvolutionImageFilterBase.h"
+
+#include "itkImage.h"
+#include "itkProgressAccumulator.h"
+#include "ITKConvolutionExport.h"
+
+#include <vector>
+
+namespace itk
+{
+/**\class AdaptiveConvolutionImageFilterEnums
+ * \brief Contains all enum classes used by AdaptiveConvolutionImageFilter class.
+ * \ingroup ITKConvolution
+ */
+class AdaptiveConvolutionImageFilterEnums
+{
+public:
+  /**
+   *\class ConvolutionStrategy
+   * \ingroup ITKConvolution
+   * Convolution execution strategy enumeration
+   */
+  enum class ConvolutionStrategy : uint8_t
+  {
+    AUTOMATIC = 0,
+    SPATIAL,
+    SEPARABLE,
+    FFT
+  };
+};
+/** Define how to print enumerations */
+extern ITKConvolution_EXPORT std::ostream &
+                             operator<<(std::ostream & out, const AdaptiveConvolutionImageFilterEnums::ConvolutionStrategy value);
+
+/**
+ *\class AdaptiveConvolutionImageFilter
+ * \brief Convolve an image with a kernel using an automatically selected strategy.
+ *
+ * This filter inspects the kernel image and chooses between three
+ * execution strategies: direct spatial convolution
+ * (ConvolutionImageFilter), a sequence of one-dimensional passes when
+ * the kernel is an outer product of one-dimensional profiles (rank
+ * one), and FFT-based convolution (FFTConvolutionImageFilter) when the
+ * estimated cost of the spatial approach exceeds that of the
+ * transforms.  The strategy may also be forced through SetStrategy().
+ *
+ * The separable strategy is selected automatically only when its
+ * result matches full spatial convolution: in VALID output region mode,
+ * or in SAME mode with a zero ConstantBoundaryCondition.  With other
+ * boundary conditions the one-dimensional passes would extrapolate
+ * already-convolved values near corners, so the planner falls back to
+ * the spatial or FFT strategy; forcing SEPARABLE in that situation is
+ * allowed but approximates the boundary handling per pass.
+ *
+ * As with FFTConvolutionImageFilter, the strategies differ in
+ * floating-point summation order, so results may differ at the level
+ * of rounding error between strategies.
+ *
+ * \ingroup ITKConvolution
+ * \sa ConvolutionImageFilter FFTConvolutionImageFilter
+ */
+template <typename TInputImage, typename TKernelImage = TInputImage, typename TOutputImage = TInputImage>
+class ITK_TEMPLATE_EXPORT AdaptiveConvolutionImageFilter
+  : public ConvolutionImageFilterBase<TInputImage, TKernelImage, TOutputImage>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(AdaptiveConvolutionImageFilter);
+
+  using Self = AdaptiveConvolutionImageFilter;
+  using Superclass = ConvolutionImageFilterBase<TInputImage, TKernelImage, TOutputImage>;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information ( and related methods ) */
+  itkTypeMacro(AdaptiveConvolutionImageFilter, ConvolutionImageFilterBase);
+
+  /** Dimensionality of input and output data is assumed to be the same. */
+  static constexpr unsigned int ImageDimension = TInputImage::ImageDimension;
+
+  using InputImageType = TInputImage;
+  using OutputImageType = TOutputImage;
+  using KernelImageType = TKernelImage;
+  using InputPixelType = typename InputImageType::PixelType;
+  using OutputPixelType = typename OutputImageType::PixelType;
+  using KernelPixelType = typename KernelImageType::PixelType;
+  using InputIndexType = typename InputImageType::IndexType;
+  using OutputIndexType = typename OutputImageType::IndexType;
+  using KernelIndexType = typename KernelImageType::IndexType;
+  using InputSizeType = typename InputImageType::SizeType;
+  using OutputSizeType = typename OutputImageType::SizeType;
+  using KernelSizeType = typename KernelImageType::SizeType;
+  using InputRegionType = typename InputImageType::RegionType;
+  using OutputRegionType = typename OutputImageType::RegionType;
+  using KernelRegionType = typename KernelImageType::RegionType;
+
+  /** Real-valued types used for the separability analysis and the
+   * one-dimensional pass kernels. */
+  using KernelRealType = typename NumericTraits<KernelPixelType>::RealType;
+  using SeparableKernelImageType = Image<KernelRealType, ImageDimension>;
+  using InternalImageType = Image<typename NumericTraits<OutputPixelType>::RealType, ImageDimension>;
+
+  using ConvolutionStrategyEnum = AdaptiveConvolutionImageFilterEnums::ConvolutionStrategy;
+
+  /** Set/get the execution strategy. The default, AUTOMATIC, selects
+   * among the other strategies based on the kernel; forcing SEPARABLE
+   * for a kernel that is not rank one raises an exception at update
+   * time. */
+  itkSetEnumMacro(Strategy, ConvolutionStrategyEnum);
+  itkGetEnumMacro(Strategy, ConvolutionStrategyEnum);
+
+  /** Get the strategy executed by the last update. AUTOMATIC is
+   * returned before the first update. */
+  itkGetEnumMacro(StrategyUsed, ConvolutionStrategyEnum);
+
+  /** Set/get the relative tolerance of the rank-one test used to decide
+   * whether the kernel is separable. The reconstruction error of the
+   * candidate outer-product factorization must stay below this fraction
+   * of the kernel's peak magnitude. */
+  itkSetMacro(SeparabilityTolerance, double);
+  itkGetConstMacro(SeparabilityTolerance, double);
+
+  /** Set/get the weight applied to the N*log2(N) term of the FFT cost
+   * estimate before comparing it against the cost of spatial
+   * convolution. Larger values bias the planner towards the spatial
+   * strategy. */
+  itkSetMacro(FFTCostWeight, double);
+  itkGetConstMacro(FFTCostWeight, double);
+
+protected:
+  AdaptiveConvolutionImageFilter() = default;
+  ~AdaptiveConvolutionImageFilter() override = default;
+
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+  /** The strategy is not known until GenerateData(), and the FFT
+   * strategy requires the entire input, so the largest possible regions
+   * are requested for both inputs. */
+  void
+  GenerateInputRequestedRegion() override;
+
+  /** This filter uses a minipipeline to compute the output. */
+  void
+  GenerateData() override;
+
+private:
+  /** Resolve the AUTOMATIC strategy for the current kernel.  When the
+   * separable strategy is chosen the one-dimensional factor profiles
+   * are stored in m_SeparableFactors. */
+  ConvolutionStrategyEnum
+  ChooseStrategy();
+
+  /** Test whether the kernel is an outer product of one-dimensional
+   * profiles to within the separability tolerance. On success the
+   * profiles, scaled so that their outer product reproduces the kernel
+   * (normalized if requested), are stored in m_SeparableFactors. */
+  bool
+  KernelIsSeparable();
+
+  /** True when the one-dimensional pass sequence reproduces the full
+   * spatial convolution exactly: VALID output region mode, or a zero
+   * ConstantBoundaryCondition in SAME mode. */
+  bool
+  SeparableExecutionIsExact() const;
+
+  /** Delegate the whole convolution to a spatial or FFT convolution
+   * filter sharing this filter's settings. */
+  template <typename TDelegateFilter>
+  void
+  ComputeWithDelegate(TDelegateFilter * delegate, ProgressAccumulator * progress);
+
+  /** Run the sequence of one-dimensional convolution passes built from
+   * m_SeparableFactors. */
+  void
+  ComputeSeparableConvolution(ProgressAccumulator * progress);
+
+  ConvolutionStrategyEnum m_Strategy{ ConvolutionStrategyEnum::AUTOMATIC };
+  ConvolutionStrategyEnum m_StrategyUsed{ ConvolutionStrategyEnum::AUTOMATIC };
+
+  double m_SeparabilityTolerance{ 1e-5 };
+  double m_FFTCostWeight{ 10.0 };
+
+  /** One-dimensional factor profiles of a separable kernel, one vector
+   * of taps per dimension. */
+  std::vector<std::vector<KernelRealType>> m_SeparableFactors;
+};
+} // namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkAdaptiveConvolutionImageFilter.hxx"
+#endif
+
+#endif
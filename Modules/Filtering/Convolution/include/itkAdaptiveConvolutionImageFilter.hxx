@@ -0,0 +1,405 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkAdaptiveConvolutionImageFilter_hxx
+#define itkAdaptiveConvolutionImageFilter_hxx
+
+#include "itkAdaptiveConvolutionImageFilter.h"
+
+#include "itkConstantBoundaryCondition.h"
+#include "itkConvolutionImageFilter.h"
+#include "itkCropImageFilter.h"
+#include "itkFFTConvolutionImageFilter.h"
+#include "itkImageRegionConstIteratorWithIndex.h"
+#include "itkMath.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace itk
+{
+template <typename TInputImage, typename TKernelImage, typename TOutputImage>
+void
+AdaptiveConvolutionImageFilter<TInputImage, TKernelImage, TOutputImage>::GenerateInputRequestedRegion()
+{
+  // Request the largest possible region for both input images.
+  if (this->GetInput())
+  {
+    typename InputImageType::Pointer imagePtr = const_cast<InputImageType *>(this->GetInput());
+    imagePtr->SetRequestedRegionToLargestPossibleRegion();
+  }
+
+  if (this->GetKernelImage())
+  {
+    // Input kernel is an image, cast away the constness so we can set
+    // the requested region.
+    typename KernelImageType::Pointer kernelPtr = const_cast<KernelImageType *>(this->GetKernelImage());
+    kernelPtr->SetRequestedRegionToLargestPossibleRegion();
+  }
+}
+
+template <typename TInputImage, typename TKernelImage, typename TOutputImage>
+void
+AdaptiveConvolutionImageFilter<TInputImage, TKernelImage, TOutputImage>::GenerateData()
+{
+  // Allocate the output
+  this->AllocateOutputs();
+
+  // Create a process accumulator for tracking the progress of the minipipeline
+  auto progress = ProgressAccumulator::New();
+  progress->SetMiniPipelineFilter(this);
+
+  m_StrategyUsed = this->ChooseStrategy();
+
+  switch (m_StrategyUsed)
+  {
+    case ConvolutionStrategyEnum::SPATIAL:
+    {
+      using DelegateType = ConvolutionImageFilter<InputImageType, KernelImageType, OutputImageType>;
+      auto delegate = DelegateType::New();
+      this->ComputeWithDelegate(delegate.GetPointer(), progress);
+      break;
+    }
+    case ConvolutionStrategyEnum::SEPARABLE:
+    {
+      this->ComputeSeparableConvolution(progress);
+      break;
+    }
+    case ConvolutionStrategyEnum::FFT:
+    {
+      using DelegateType = FFTConvolutionImageFilter<InputImageType, KernelImageType, OutputImageType>;
+      auto delegate = DelegateType::New();
+      this->ComputeWithDelegate(delegate.GetPointer(), progress);
+      break;
+    }
+    default:
+    {
+      itkExceptionMacro(<< "Unexpected convolution strategy " << m_StrategyUsed << ".");
+    }
+  }
+}
+
+template <typename TInputImage, typename TKernelImage, typename TOutputImage>
+auto
+AdaptiveConvolutionImageFilter<TInputImage, TKernelImage, TOutputImage>::ChooseStrategy() -> ConvolutionStrategyEnum
+{
+  if (m_Strategy == ConvolutionStrategyEnum::SEPARABLE)
+  {
+    if (!this->KernelIsSeparable())
+    {
+      itkExceptionMacro(<< "SEPARABLE strategy was requested, but the kernel is not an outer product of "
+                           "one-dimensional profiles within the separability tolerance "
+                        << m_SeparabilityTolerance << ".");
+    }
+    return ConvolutionStrategyEnum::SEPARABLE;
+  }
+  if (m_Strategy != ConvolutionStrategyEnum::AUTOMATIC)
+  {
+    return m_Strategy;
+  }
+
+  // The separable strategy is only chosen when it reproduces the full
+  // spatial convolution; it is then the cheapest by a wide margin.
+  if (this->SeparableExecutionIsExact() && this->KernelIsSeparable())
+  {
+    return ConvolutionStrategyEnum::SEPARABLE;
+  }
+
+  // Compare the estimated cost of sliding the whole kernel over the
+  // output against three transforms of the padded image.
+  const KernelSizeType kernelSize = this->GetKernelImage()->GetLargestPossibleRegion().GetSize();
+  const OutputSizeType outputSize = this->GetOutput()->GetRequestedRegion().GetSize();
+
+  double kernelTaps = 1.0;
+  double paddedPixels = 1.0;
+  for (unsigned int i = 0; i < ImageDimension; ++i)
+  {
+    kernelTaps *= static_cast<double>(kernelSize[i]);
+    paddedPixels *= static_cast<double>(outputSize[i] + kernelSize[i] - 1);
+  }
+  const double outputPixels = static_cast<double>(this->GetOutput()->GetRequestedRegion().GetNumberOfPixels());
+
+  const double spatialCost = outputPixels * kernelTaps;
+  const double fftCost = m_FFTCostWeight * paddedPixels * std::log2(std::max(paddedPixels, 2.0));
+
+  return (spatialCost <= fftCost) ? ConvolutionStrategyEnum::SPATIAL : ConvolutionStrategyEnum::FFT;
+}
+
+template <typename TInputImage, typename TKernelImage, typename TOutputImage>
+bool
+AdaptiveConvolutionImageFilter<TInputImage, TKernelImage, TOutputImage>::SeparableExecutionIsExact() const
+{
+  if (this->GetOutputRegionMode() == ConvolutionImageFilterBaseEnums::ConvolutionImageFilterOutputRegion::VALID)
+  {
+    // The boundary-affected border is cropped away.
+    return true;
+  }
+  const auto * constantCondition =
+    dynamic_cast<const ConstantBoundaryCondition<TInputImage> *>(this->GetBoundaryCondition());
+  return constantCondition != nullptr &&
+         constantCondition->GetConstant() == NumericTraits<InputPixelType>::ZeroValue();
+}
+
+template <typename TInputImage, typename TKernelImage, typename TOutputImage>
+bool
+AdaptiveConvolutionImageFilter<TInputImage, TKernelImage, TOutputImage>::KernelIsSeparable()
+{
+  if (ImageDimension < 2)
+  {
+    // A one-dimensional kernel gains nothing over the spatial strategy.
+    return false;
+  }
+
+  const KernelImageType * kernel = this->GetKernelImage();
+  const KernelRegionType  kernelRegion = kernel->GetLargestPossibleRegion();
+  const KernelSizeType    kernelSize = kernelRegion.GetSize();
+  const KernelIndexType   kernelIndex = kernelRegion.GetIndex();
+
+  // Locate the peak-magnitude tap and accumulate the kernel sum.
+  KernelRealType  peakMagnitude = NumericTraits<KernelRealType>::ZeroValue();
+  KernelRealType  kernelSum = NumericTraits<KernelRealType>::ZeroValue();
+  KernelIndexType peakIndex = kernelIndex;
+
+  ImageRegionConstIteratorWithIndex<KernelImageType> it(kernel, kernelRegion);
+  for (it.GoToBegin(); !it.IsAtEnd(); ++it)
+  {
+    const auto value = static_cast<KernelRealType>(it.Get());
+    kernelSum += value;
+    if (itk::Math::abs(value) > peakMagnitude)
+    {
+      peakMagnitude = itk::Math::abs(value);
+      peakIndex = it.GetIndex();
+    }
+  }
+  if (peakMagnitude == NumericTraits<KernelRealType>::ZeroValue())
+  {
+    return false;
+  }
+  if (this->GetNormalize() && itk::Math::abs(kernelSum) < NumericTraits<KernelRealType>::min())
+  {
+    // The kernel cannot be normalized; let the delegate filters handle it.
+    return false;
+  }
+
+  // A kernel k is an outer product of one-dimensional profiles exactly
+  // when, for the line profiles v_d through the peak p,
+  //   prod_d v_d(x_d) == k(x) * k(p)^(D-1)   for every tap x.
+  // This is the rank-one test the SVD would perform for a matrix,
+  // generalized to any dimension.
+  std::vector<std::vector<KernelRealType>> factors(ImageDimension);
+  for (unsigned int d = 0; d < ImageDimension; ++d)
+  {
+    factors[d].resize(kernelSize[d]);
+    KernelIndexType lineIndex = peakIndex;
+    for (SizeValueType i = 0; i < kernelSize[d]; ++i)
+    {
+      lineIndex[d] = kernelIndex[d] + static_cast<IndexValueType>(i);
+      factors[d][i] = static_cast<KernelRealType>(kernel->GetPixel(lineIndex));
+    }
+  }
+
+  const auto     peakValue = static_cast<KernelRealType>(kernel->GetPixel(peakIndex));
+  KernelRealType peakPower = NumericTraits<KernelRealType>::OneValue();
+  for (unsigned int d = 1; d < ImageDimension; ++d)
+  {
+    peakPower *= peakValue;
+  }
+  const KernelRealType tolerance = m_SeparabilityTolerance * itk::Math::abs(peakPower) * peakMagnitude;
+
+  for (it.GoToBegin(); !it.IsAtEnd(); ++it)
+  {
+    const KernelIndexType index = it.GetIndex();
+    KernelRealType        predicted = NumericTraits<KernelRealType>::OneValue();
+    for (unsigned int d = 0; d < ImageDimension; ++d)
+    {
+      predicted *= factors[d][index[d] - kernelIndex[d]];
+    }
+    if (itk::Math::abs(predicted - static_cast<KernelRealType>(it.Get()) * peakPower) > tolerance)
+    {
+      return false;
+    }
+  }
+
+  // Scale the first profile so that the outer product of the profiles
+  // reproduces the kernel, normalized to a unit sum if requested.
+  KernelRealType scale = peakPower;
+  if (this->GetNormalize())
+  {
+    scale *= kernelSum;
+  }
+  for (SizeValueType i = 0; i < kernelSize[0]; ++i)
+  {
+    factors[0][i] /= scale;
+  }
+
+  m_SeparableFactors = std::move(factors);
+  return true;
+}
+
+template <typename TInputImage, typename TKernelImage, typename TOutputImage>
+template <typename TDelegateFilter>
+void
+AdaptiveConvolutionImageFilter<TInputImage, TKernelImage, TOutputImage>::ComputeWithDelegate(
+  TDelegateFilter *     delegate,
+  ProgressAccumulator * progress)
+{
+  auto localInput = InputImageType::New();
+  localInput->Graft(this->GetInput());
+
+  delegate->SetInput(localInput);
+  delegate->SetKernelImage(this->GetKernelImage());
+  delegate->SetBoundaryCondition(this->GetBoundaryCondition());
+  delegate->SetNormalize(this->GetNormalize());
+  delegate->SetOutputRegionMode(this->GetOutputRegionMode());
+  delegate->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+  progress->RegisterInternalFilter(delegate, 1.0f);
+
+  delegate->GraftOutput(this->GetOutput());
+  delegate->GetOutput()->SetRequestedRegion(this->GetOutput()->GetRequestedRegion());
+  delegate->Update();
+  this->GraftOutput(delegate->GetOutput());
+}
+
+template <typename TInputImage, typename TKernelImage, typename TOutputImage>
+void
+AdaptiveConvolutionImageFilter<TInputImage, TKernelImage, TOutputImage>::ComputeSeparableConvolution(
+  ProgressAccumulator * progress)
+{
+  const KernelSizeType kernelSize = this->GetKernelImage()->GetLargestPossibleRegion().GetSize();
+
+  // Build the one-dimensional pass kernels from the factor profiles.
+  std::vector<typename SeparableKernelImageType::Pointer> factorKernels(ImageDimension);
+  for (unsigned int d = 0; d < ImageDimension; ++d)
+  {
+    auto factorKernel = SeparableKernelImageType::New();
+
+    typename SeparableKernelImageType::SizeType size;
+    size.Fill(1);
+    size[d] = kernelSize[d];
+    factorKernel->SetRegions(size);
+    factorKernel->Allocate();
+
+    typename SeparableKernelImageType::IndexType index;
+    index.Fill(0);
+    for (SizeValueType i = 0; i < kernelSize[d]; ++i)
+    {
+      index[d] = static_cast<IndexValueType>(i);
+      factorKernel->SetPixel(index, m_SeparableFactors[d][i]);
+    }
+    factorKernels[d] = factorKernel;
+  }
+
+  const bool  validMode =
+    this->GetOutputRegionMode() == ConvolutionImageFilterBaseEnums::ConvolutionImageFilterOutputRegion::VALID;
+  const float passWeight = (validMode ? 0.9f : 1.0f) / static_cast<float>(ImageDimension);
+
+  // In SAME mode this strategy is only selected for a zero constant
+  // boundary; the later passes extend their intermediate images with the
+  // same zero constant. In VALID mode the boundary-affected border is
+  // cropped away below, so the choice is irrelevant.
+  ConstantBoundaryCondition<InternalImageType> zeroCondition;
+
+  auto localInput = InputImageType::New();
+  localInput->Graft(this->GetInput());
+
+  using FirstPassType = ConvolutionImageFilter<InputImageType, SeparableKernelImageType, InternalImageType>;
+  auto firstPass = FirstPassType::New();
+  firstPass->SetInput(localInput);
+  firstPass->SetKernelImage(factorKernels[0]);
+  firstPass->SetBoundaryCondition(this->GetBoundaryCondition());
+  firstPass->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+  firstPass->ReleaseDataFlagOn();
+  progress->RegisterInternalFilter(firstPass, passWeight);
+
+  using MiddlePassType = ConvolutionImageFilter<InternalImageType, SeparableKernelImageType, InternalImageType>;
+  std::vector<typename MiddlePassType::Pointer> middlePasses;
+  typename InternalImageType::Pointer           intermediate = firstPass->GetOutput();
+  for (unsigned int d = 1; d + 1 < ImageDimension; ++d)
+  {
+    auto pass = MiddlePassType::New();
+    pass->SetInput(intermediate);
+    pass->SetKernelImage(factorKernels[d]);
+    pass->SetBoundaryCondition(&zeroCondition);
+    pass->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+    pass->ReleaseDataFlagOn();
+    progress->RegisterInternalFilter(pass, passWeight);
+    middlePasses.push_back(pass);
+    intermediate = pass->GetOutput();
+  }
+
+  using LastPassType = ConvolutionImageFilter<InternalImageType, SeparableKernelImageType, OutputImageType>;
+  auto lastPass = LastPassType::New();
+  lastPass->SetInput(intermediate);
+  lastPass->SetKernelImage(factorKernels[ImageDimension - 1]);
+  lastPass->SetBoundaryCondition(&zeroCondition);
+  lastPass->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+  progress->RegisterInternalFilter(lastPass, passWeight);
+
+  if (!validMode)
+  {
+    // Graft the output of the last pass onto this filter's output.
+    lastPass->GraftOutput(this->GetOutput());
+    lastPass->GetOutput()->SetRequestedRegion(this->GetOutput()->GetRequestedRegion());
+    lastPass->Update();
+    this->GraftOutput(lastPass->GetOutput());
+  }
+  else
+  {
+    using CropFilterType = CropImageFilter<OutputImageType, OutputImageType>;
+    using CropSizeType = typename CropFilterType::SizeType;
+
+    // Crop with the radius of the full kernel, reduced by 1 at the
+    // lower bound in dimensions where the kernel size is odd, exactly
+    // as ConvolutionImageFilter does for its VALID mode.
+    CropSizeType radius;
+    CropSizeType lowerCropSize;
+    for (unsigned int i = 0; i < ImageDimension; ++i)
+    {
+      radius[i] = kernelSize[i] / 2;
+      lowerCropSize[i] = radius[i] - (1 - (kernelSize[i] % 2));
+    }
+
+    lastPass->GraftOutput(this->GetOutput());
+
+    auto cropFilter = CropFilterType::New();
+    cropFilter->SetLowerBoundaryCropSize(lowerCropSize);
+    cropFilter->SetUpperBoundaryCropSize(radius);
+    cropFilter->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+    cropFilter->InPlaceOn();
+    progress->RegisterInternalFilter(cropFilter, 0.1f);
+    cropFilter->SetInput(lastPass->GetOutput());
+
+    cropFilter->GetOutput()->SetRequestedRegion(this->GetOutput()->GetRequestedRegion());
+    cropFilter->Update();
+    this->GraftOutput(cropFilter->GetOutput());
+  }
+}
+
+template <typename TInputImage, typename TKernelImage, typename TOutputImage>
+void
+AdaptiveConvolutionImageFilter<TInputImage, TKernelImage, TOutputImage>::PrintSelf(std::ostream & os,
+                                                                                  Indent         indent) const
+{
+  Superclass::PrintSelf(os, indent);
+  os << indent << "Strategy: " << m_Strategy << std::endl;
+  os << indent << "StrategyUsed: " << m_StrategyUsed << std::endl;
+  os << indent << "SeparabilityTolerance: " << m_SeparabilityTolerance << std::endl;
+  os << indent << "FFTCostWeight: " << m_FFTCostWeight << std::endl;
+}
+} // namespace itk
+#endif
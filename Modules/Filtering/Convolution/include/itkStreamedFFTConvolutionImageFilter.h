@@ -0,0 +1,126 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkStreamedFFTConvolutionImageFilter_h
+#define itkStreamedFFTConvolutionImageFilter_h
+
+#include "itkFFTConvolutionImageFilter.h"
+
+namespace itk
+{
+/**
+ *\class StreamedFFTConvolutionImageFilter
+ * \brief FFT-based convolution that supports streamed execution
+ * through overlap-save block convolution.
+ *
+ * FFTConvolutionImageFilter always requests, pads and transforms the
+ * complete input image, so the peak memory use of a convolution is
+ * several full-size internal buffers regardless of how the consumer
+ * requests the output. This filter instead convolves one requested
+ * region at a time: each block is extracted from the input together
+ * with a kernel-radius halo, convolved independently in the Fourier
+ * domain, and only the halo-free interior of the result is kept --
+ * the classical overlap-save scheme. Because the requested halo is the
+ * same one ConvolutionImageFilter requests, any streaming consumer,
+ * e.g. an ImageFileWriter with a number of stream divisions set, can
+ * drive the convolution of a volume larger than main memory end to
+ * end.
+ *
+ * Away from the image borders each output pixel depends only on input
+ * pixels inside the block plus halo, so the output is identical to the
+ * output of FFTConvolutionImageFilter. At a true image border the halo
+ * is cropped and the boundary condition is applied to the same border
+ * pixels the unstreamed filter pads with, so ZeroFluxNeumannBoundaryCondition
+ * (the default) and ConstantBoundaryCondition also match exactly.
+ *
+ * \warning PeriodicBoundaryCondition wraps around each streamed block
+ * instead of the whole image and will not match the unstreamed
+ * filter's output near the image borders.
+ *
+ * \warning This filter ignores the spacing, origin, and orientation
+ * of the kernel image and treats them as identical to those in the
+ * input image.
+ *
+ * \ingroup ITKConvolution
+ * \sa FFTConvolutionImageFilter
+ * \sa ConvolutionImageFilter
+ * \sa StreamingImageFilter
+ *
+ */
+template <typename TInputImage,
+          typename TKernelImage = TInputImage,
+          typename TOutputImage = TInputImage,
+          typename TInternalPrecision = double>
+class ITK_TEMPLATE_EXPORT StreamedFFTConvolutionImageFilter
+  : public FFTConvolutionImageFilter<TInputImage, TKernelImage, TOutputImage, TInternalPrecision>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(StreamedFFTConvolutionImageFilter);
+
+  using Self = StreamedFFTConvolutionImageFilter;
+  using Superclass = FFTConvolutionImageFilter<TInputImage, TKernelImage, TOutputImage, TInternalPrecision>;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information ( and related methods ) */
+  itkTypeMacro(StreamedFFTConvolutionImageFilter, FFTConvolutionImageFilter);
+
+  /** Dimensionality of input and output data is assumed to be the same. */
+  static constexpr unsigned int ImageDimension = TInputImage::ImageDimension;
+
+  using InputImageType = TInputImage;
+  using OutputImageType = TOutputImage;
+  using KernelImageType = TKernelImage;
+  using typename Superclass::InputRegionType;
+  using typename Superclass::OutputRegionType;
+  using typename Superclass::KernelRegionType;
+  using typename Superclass::KernelSizeType;
+
+protected:
+  StreamedFFTConvolutionImageFilter() = default;
+  ~StreamedFFTConvolutionImageFilter() override = default;
+
+  /** Unlike its superclass, this filter only needs the output
+   * requested region padded by the kernel radius, exactly like
+   * ConvolutionImageFilter. This is what makes the filter streamable.
+   *
+   * \sa ProcessObject::GenerateInputRequestedRegion()  */
+  void
+  GenerateInputRequestedRegion() override;
+
+  /** This filter uses a minipipeline to compute the output: the
+   * requested block plus halo is extracted as a standalone image,
+   * convolved by the superclass' (unstreamed) algorithm, and the
+   * halo-free interior is grafted to the output. */
+  void
+  GenerateData() override;
+
+  /** Calculate the radius of the kernel, i.e. the halo each block is
+   * padded with. */
+  KernelSizeType
+  GetKernelRadius() const;
+};
+} // namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkStreamedFFTConvolutionImageFilter.hxx"
+#endif
+
+#endif
@@ -0,0 +1,135 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#ifndef itkStreamedFFTConvolutionImageFilter_hxx
+#define itkStreamedFFTConvolutionImageFilter_hxx
+
+#include "itkStreamedFFTConvolutionImageFilter.h"
+
+#include "itkExtractImageFilter.h"
+#include "itkProgressAccumulator.h"
+
+namespace itk
+{
+
+template <typename TInputImage, typename TKernelImage, typename TOutputImage, typename TInternalPrecision>
+void
+StreamedFFTConvolutionImageFilter<TInputImage, TKernelImage, TOutputImage, TInternalPrecision>::
+  GenerateInputRequestedRegion()
+{
+  // Pad the output requested region by the radius of the kernel.
+  if (this->GetInput())
+  {
+    InputRegionType inputRegion = this->GetOutput()->GetRequestedRegion();
+    inputRegion.PadByRadius(this->GetKernelRadius());
+
+    // Crop the input requested region to fit within the largest
+    // possible region.
+    typename InputImageType::Pointer inputPtr = const_cast<InputImageType *>(this->GetInput());
+    bool                             cropped = inputRegion.Crop(inputPtr->GetLargestPossibleRegion());
+    if (!cropped)
+    {
+      InvalidRequestedRegionError e(__FILE__, __LINE__);
+      e.SetLocation(ITK_LOCATION);
+      e.SetDescription("Requested region is (at least partially) outside the largest possible region.");
+      e.SetDataObject(inputPtr);
+      throw e;
+    }
+    inputPtr->SetRequestedRegion(inputRegion);
+  }
+
+  // The whole kernel is needed for every block.
+  if (this->GetKernelImage())
+  {
+    typename KernelImageType::Pointer kernelPtr = const_cast<KernelImageType *>(this->GetKernelImage());
+    kernelPtr->SetRequestedRegionToLargestPossibleRegion();
+  }
+}
+
+template <typename TInputImage, typename TKernelImage, typename TOutputImage, typename TInternalPrecision>
+void
+StreamedFFTConvolutionImageFilter<TInputImage, TKernelImage, TOutputImage, TInternalPrecision>::GenerateData()
+{
+  // Create a process accumulator for tracking the progress of this minipipeline
+  auto progress = ProgressAccumulator::New();
+  progress->SetMiniPipelineFilter(this);
+
+  // Pull the block -- the output requested region plus the kernel
+  // halo, as requested in GenerateInputRequestedRegion -- out of the
+  // input as a standalone image, so that the convolution below pads
+  // and transforms only block sized buffers.
+  const InputRegionType blockRegion = this->GetInput()->GetRequestedRegion();
+
+  using BlockExtractFilterType = ExtractImageFilter<InputImageType, InputImageType>;
+  auto blockExtractor = BlockExtractFilterType::New();
+  blockExtractor->SetInput(this->GetInput());
+  blockExtractor->SetExtractionRegion(blockRegion);
+  blockExtractor->SetDirectionCollapseToIdentity();
+  blockExtractor->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+  blockExtractor->ReleaseDataFlagOn();
+  progress->RegisterInternalFilter(blockExtractor, 0.05f);
+
+  // Convolve the block as if it were a complete image. Where the halo
+  // is complete the result equals the unstreamed convolution; where it
+  // was cropped at a true image border, the boundary condition is
+  // applied to the same border pixels the unstreamed filter pads with.
+  auto convolver = Superclass::New();
+  convolver->SetInput(blockExtractor->GetOutput());
+  convolver->SetKernelImage(this->GetKernelImage());
+  convolver->SetNormalize(this->GetNormalize());
+  convolver->SetBoundaryCondition(this->GetBoundaryCondition());
+  convolver->SetOutputRegionModeToSame();
+  convolver->SetSizeGreatestPrimeFactor(this->GetSizeGreatestPrimeFactor());
+  convolver->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+  progress->RegisterInternalFilter(convolver, 0.9f);
+
+  // Keep only the halo-free interior of the convolved block.
+  using InteriorExtractFilterType = ExtractImageFilter<OutputImageType, OutputImageType>;
+  auto interiorExtractor = InteriorExtractFilterType::New();
+  interiorExtractor->SetInput(convolver->GetOutput());
+  interiorExtractor->SetExtractionRegion(this->GetOutput()->GetRequestedRegion());
+  interiorExtractor->SetDirectionCollapseToIdentity();
+  interiorExtractor->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+  progress->RegisterInternalFilter(interiorExtractor, 0.05f);
+
+  // Graft this filter's output onto the mini-pipeline so the
+  // mini-pipeline writes to this filter's bulk data output, then graft
+  // back so the output has the correct region ivars.
+  interiorExtractor->GraftOutput(this->GetOutput());
+  interiorExtractor->Update();
+  this->GraftOutput(interiorExtractor->GetOutput());
+}
+
+template <typename TInputImage, typename TKernelImage, typename TOutputImage, typename TInternalPrecision>
+auto
+StreamedFFTConvolutionImageFilter<TInputImage, TKernelImage, TOutputImage, TInternalPrecision>::GetKernelRadius() const
+  -> KernelSizeType
+{
+  const KernelSizeType kernelSize = this->GetKernelImage()->GetLargestPossibleRegion().GetSize();
+
+  KernelSizeType radius;
+  for (unsigned int i = 0; i < ImageDimension; ++i)
+  {
+    radius[i] = kernelSize[i] / 2;
+  }
+
+  return radius;
+}
+
+} // namespace itk
+#endif
@@ -0,0 +1,282 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkAdaptiveConvolutionImageFilter.h"
+#include "itkConstantBoundaryCondition.h"
+#include "itkConvolutionImageFilter.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkTestingMacros.h"
+
+namespace
+{
+
+using ImageType = itk::Image<float, 2>;
+using FilterType = itk::AdaptiveConvolutionImageFilter<ImageType>;
+using ReferenceFilterType = itk::ConvolutionImageFilter<ImageType>;
+using StrategyEnum = itk::AdaptiveConvolutionImageFilterEnums::ConvolutionStrategy;
+
+ImageType::Pointer
+MakeTestImage(itk::SizeValueType width)
+{
+  auto image = ImageType::New();
+
+  ImageType::SizeType size;
+  size.Fill(width);
+  image->SetRegions(size);
+  image->Allocate();
+
+  // A deterministic, non-symmetric pattern.
+  itk::ImageRegionIteratorWithIndex<ImageType> it(image, image->GetLargestPossibleRegion());
+  for (it.GoToBegin(); !it.IsAtEnd(); ++it)
+  {
+    const ImageType::IndexType index = it.GetIndex();
+    it.Set(1.0f + static_cast<float>((3 * index[0] + 7 * index[1]) % 11));
+  }
+  return image;
+}
+
+ImageType::Pointer
+MakeSeparableKernel(itk::SizeValueType width)
+{
+  auto kernel = ImageType::New();
+
+  ImageType::SizeType size;
+  size.Fill(width);
+  kernel->SetRegions(size);
+  kernel->Allocate();
+
+  // Outer product of two distinct 1-D profiles.
+  itk::ImageRegionIteratorWithIndex<ImageType> it(kernel, kernel->GetLargestPossibleRegion());
+  for (it.GoToBegin(); !it.IsAtEnd(); ++it)
+  {
+    const ImageType::IndexType index = it.GetIndex();
+    it.Set(static_cast<float>((1.0 + index[0]) * (2.0 + 0.5 * index[1])));
+  }
+  return kernel;
+}
+
+ImageType::Pointer
+MakeNonSeparableKernel(itk::SizeValueType width)
+{
+  auto kernel = MakeSeparableKernel(width);
+
+  // Break the rank-one structure at one off-peak tap.
+  ImageType::IndexType index;
+  index.Fill(0);
+  kernel->SetPixel(index, kernel->GetPixel(index) + 1.0f);
+  return kernel;
+}
+
+bool
+ImagesAgree(const ImageType * image, const ImageType * reference, double relativeTolerance)
+{
+  if (image->GetLargestPossibleRegion() != reference->GetLargestPossibleRegion())
+  {
+    std::cerr << "Region mismatch: " << image->GetLargestPossibleRegion() << " vs "
+              << reference->GetLargestPossibleRegion() << std::endl;
+    return false;
+  }
+
+  double maximumMagnitude = 0.0;
+  itk::ImageRegionConstIterator<ImageType> rIt(reference, reference->GetLargestPossibleRegion());
+  for (rIt.GoToBegin(); !rIt.IsAtEnd(); ++rIt)
+  {
+    maximumMagnitude = std::max(maximumMagnitude, static_cast<double>(itk::Math::abs(rIt.Get())));
+  }
+
+  itk::ImageRegionConstIterator<ImageType> it(image, image->GetLargestPossibleRegion());
+  for (it.GoToBegin(), rIt.GoToBegin(); !it.IsAtEnd(); ++it, ++rIt)
+  {
+    if (itk::Math::abs(it.Get() - rIt.Get()) > relativeTolerance * maximumMagnitude)
+    {
+      std::cerr << "Pixel mismatch at " << it.GetIndex() << ": " << it.Get() << " vs " << rIt.Get() << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+ImageType::Pointer
+ReferenceConvolution(const ImageType *                 image,
+                     const ImageType *                 kernel,
+                     FilterType::OutputRegionModeEnum  outputRegionMode,
+                     itk::ImageBoundaryCondition<ImageType> * boundaryCondition)
+{
+  auto reference = ReferenceFilterType::New();
+  reference->SetInput(image);
+  reference->SetKernelImage(kernel);
+  reference->SetOutputRegionMode(outputRegionMode);
+  if (boundaryCondition != nullptr)
+  {
+    reference->SetBoundaryCondition(boundaryCondition);
+  }
+  reference->Update();
+  return reference->GetOutput();
+}
+
+} // namespace
+
+int
+itkAdaptiveConvolutionImageFilterTest(int, char *[])
+{
+  auto filter = FilterType::New();
+
+  ITK_EXERCISE_BASIC_OBJECT_METHODS(filter, AdaptiveConvolutionImageFilter, ConvolutionImageFilterBase);
+
+  filter->SetSeparabilityTolerance(1e-6);
+  ITK_TEST_SET_GET_VALUE(1e-6, filter->GetSeparabilityTolerance());
+  filter->SetFFTCostWeight(10.0);
+  ITK_TEST_SET_GET_VALUE(10.0, filter->GetFFTCostWeight());
+  filter->SetStrategy(StrategyEnum::AUTOMATIC);
+  ITK_TEST_SET_GET_VALUE(StrategyEnum::AUTOMATIC, filter->GetStrategy());
+
+  ImageType::Pointer image = MakeTestImage(64);
+
+  // A small non-separable kernel must dispatch to the spatial strategy
+  // and reproduce ConvolutionImageFilter exactly.
+  {
+    ImageType::Pointer kernel = MakeNonSeparableKernel(3);
+
+    auto adaptive = FilterType::New();
+    adaptive->SetInput(image);
+    adaptive->SetKernelImage(kernel);
+    ITK_TRY_EXPECT_NO_EXCEPTION(adaptive->Update());
+
+    ITK_TEST_EXPECT_TRUE(adaptive->GetStrategyUsed() == StrategyEnum::SPATIAL);
+
+    ImageType::Pointer reference =
+      ReferenceConvolution(image, kernel, FilterType::OutputRegionModeEnum::SAME, nullptr);
+    ITK_TEST_EXPECT_TRUE(ImagesAgree(adaptive->GetOutput(), reference, 0.0));
+  }
+
+  // A large non-separable kernel must dispatch to the FFT strategy.
+  {
+    ImageType::Pointer kernel = MakeNonSeparableKernel(31);
+
+    auto adaptive = FilterType::New();
+    adaptive->SetInput(image);
+    adaptive->SetKernelImage(kernel);
+    ITK_TRY_EXPECT_NO_EXCEPTION(adaptive->Update());
+
+    ITK_TEST_EXPECT_TRUE(adaptive->GetStrategyUsed() == StrategyEnum::FFT);
+
+    ImageType::Pointer reference =
+      ReferenceConvolution(image, kernel, FilterType::OutputRegionModeEnum::SAME, nullptr);
+    ITK_TEST_EXPECT_TRUE(ImagesAgree(adaptive->GetOutput(), reference, 1e-5));
+  }
+
+  // A separable kernel in VALID mode must dispatch to the separable
+  // strategy and agree with the full spatial convolution.
+  {
+    ImageType::Pointer kernel = MakeSeparableKernel(9);
+
+    auto adaptive = FilterType::New();
+    adaptive->SetInput(image);
+    adaptive->SetKernelImage(kernel);
+    adaptive->SetOutputRegionModeToValid();
+    ITK_TRY_EXPECT_NO_EXCEPTION(adaptive->Update());
+
+    ITK_TEST_EXPECT_TRUE(adaptive->GetStrategyUsed() == StrategyEnum::SEPARABLE);
+
+    ImageType::Pointer reference =
+      ReferenceConvolution(image, kernel, FilterType::OutputRegionModeEnum::VALID, nullptr);
+    ITK_TEST_EXPECT_TRUE(ImagesAgree(adaptive->GetOutput(), reference, 1e-5));
+  }
+
+  // A separable kernel in SAME mode with a zero constant boundary must
+  // also dispatch to the separable strategy.
+  {
+    ImageType::Pointer kernel = MakeSeparableKernel(9);
+
+    itk::ConstantBoundaryCondition<ImageType> zeroCondition;
+
+    auto adaptive = FilterType::New();
+    adaptive->SetInput(image);
+    adaptive->SetKernelImage(kernel);
+    adaptive->SetBoundaryCondition(&zeroCondition);
+    ITK_TRY_EXPECT_NO_EXCEPTION(adaptive->Update());
+
+    ITK_TEST_EXPECT_TRUE(adaptive->GetStrategyUsed() == StrategyEnum::SEPARABLE);
+
+    ImageType::Pointer reference =
+      ReferenceConvolution(image, kernel, FilterType::OutputRegionModeEnum::SAME, &zeroCondition);
+    ITK_TEST_EXPECT_TRUE(ImagesAgree(adaptive->GetOutput(), reference, 1e-5));
+  }
+
+  // With the default boundary condition the planner must not pick the
+  // separable strategy, even for a separable kernel.
+  {
+    ImageType::Pointer kernel = MakeSeparableKernel(9);
+
+    auto adaptive = FilterType::New();
+    adaptive->SetInput(image);
+    adaptive->SetKernelImage(kernel);
+    ITK_TRY_EXPECT_NO_EXCEPTION(adaptive->Update());
+
+    ITK_TEST_EXPECT_TRUE(adaptive->GetStrategyUsed() != StrategyEnum::SEPARABLE);
+  }
+
+  // Normalization must carry through the separable strategy.
+  {
+    ImageType::Pointer kernel = MakeSeparableKernel(5);
+
+    auto adaptive = FilterType::New();
+    adaptive->SetInput(image);
+    adaptive->SetKernelImage(kernel);
+    adaptive->SetOutputRegionModeToValid();
+    adaptive->NormalizeOn();
+    ITK_TRY_EXPECT_NO_EXCEPTION(adaptive->Update());
+
+    ITK_TEST_EXPECT_TRUE(adaptive->GetStrategyUsed() == StrategyEnum::SEPARABLE);
+
+    auto reference = ReferenceFilterType::New();
+    reference->SetInput(image);
+    reference->SetKernelImage(kernel);
+    reference->SetOutputRegionModeToValid();
+    reference->NormalizeOn();
+    reference->Update();
+    ITK_TEST_EXPECT_TRUE(ImagesAgree(adaptive->GetOutput(), reference->GetOutput(), 1e-5));
+  }
+
+  // Forcing the separable strategy on a non-separable kernel must fail.
+  {
+    ImageType::Pointer kernel = MakeNonSeparableKernel(5);
+
+    auto adaptive = FilterType::New();
+    adaptive->SetInput(image);
+    adaptive->SetKernelImage(kernel);
+    adaptive->SetStrategy(StrategyEnum::SEPARABLE);
+    ITK_TRY_EXPECT_EXCEPTION(adaptive->Update());
+  }
+
+  // A forced strategy must be honored.
+  {
+    ImageType::Pointer kernel = MakeNonSeparableKernel(3);
+
+    auto adaptive = FilterType::New();
+    adaptive->SetInput(image);
+    adaptive->SetKernelImage(kernel);
+    adaptive->SetStrategy(StrategyEnum::FFT);
+    ITK_TRY_EXPECT_NO_EXCEPTION(adaptive->Update());
+    ITK_TEST_EXPECT_TRUE(adaptive->GetStrategyUsed() == StrategyEnum::FFT);
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
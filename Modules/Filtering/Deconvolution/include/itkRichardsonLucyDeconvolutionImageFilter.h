@@ -20,7 +20,7 @@
 
 #include "itkIterativeDeconvolutionImageFilter.h"
 
-#include "itkComplexConjugateImageAdaptor.h"
+#include "itkBinaryGeneratorImageFilter.h"
 #include "itkDivideOrZeroOutImageFilter.h"
 #include "itkMultiplyImageFilter.h"
 
@@ -41,6 +41,14 @@ namespace itk
  * follows a Poisson distribution and that the distribution for each
  * pixel is independent of the other pixels.
  *
+ * The update step is computed by a mini-pipeline that is constructed
+ * once per Update() and stays connected across iterations, so the
+ * transfer function and the other frequency-domain buffers remain
+ * resident and no pipeline stages are rebuilt per iteration. The
+ * correlation with the conjugate transfer function is fused into a
+ * single elementwise pass that runs in place on the frequency-domain
+ * buffer.
+ *
  * This code was adapted from the Insight Journal contribution:
  *
  * "Deconvolution: infrastructure and reference algorithms"
@@ -114,21 +122,46 @@ private:
   using MultiplyFilterType = MultiplyImageFilter<InternalImageType>;
   using ComplexMultiplyType = MultiplyImageFilter<InternalComplexImageType>;
   using DivideFilterType = DivideOrZeroOutImageFilter<InternalImageType>;
-  using ConjugateAdaptorType = ComplexConjugateImageAdaptor<InternalComplexImageType>;
-  using ComplexConjugateMultiplyType =
-    MultiplyImageFilter<InternalComplexImageType, ConjugateAdaptorType, InternalComplexImageType>;
+  using ConjugateMultiplyFilterType =
+    BinaryGeneratorImageFilter<InternalComplexImageType, InternalComplexImageType, InternalComplexImageType>;
 
   InternalImagePointerType m_PaddedInput;
 
-  typename ComplexMultiplyType::Pointer          m_ComplexMultiplyFilter1;
-  typename IFFTFilterType::Pointer               m_IFFTFilter1;
-  typename DivideFilterType::Pointer             m_DivideFilter;
-  typename FFTFilterType::Pointer                m_FFTFilter;
-  typename ConjugateAdaptorType::Pointer         m_ConjugateAdaptor;
-  typename ComplexConjugateMultiplyType::Pointer m_ComplexMultiplyFilter2;
-  typename IFFTFilterType::Pointer               m_IFFTFilter2;
-  typename MultiplyFilterType::Pointer           m_MultiplyFilter;
+  typename FFTFilterType::Pointer               m_EstimateFFTFilter;
+  typename ComplexMultiplyType::Pointer         m_ComplexMultiplyFilter1;
+  typename IFFTFilterType::Pointer              m_IFFTFilter1;
+  typename DivideFilterType::Pointer            m_DivideFilter;
+  typename FFTFilterType::Pointer               m_FFTFilter;
+  typename ConjugateMultiplyFilterType::Pointer m_ConjugateMultiplyFilter;
+  typename IFFTFilterType::Pointer              m_IFFTFilter2;
+  typename MultiplyFilterType::Pointer          m_MultiplyFilter;
 };
+
+namespace Functor
+{
+template <typename TInput1, typename TInput2, typename TOutput>
+class ITK_TEMPLATE_EXPORT RichardsonLucyConjugateMultiplyFunctor
+{
+public:
+  RichardsonLucyConjugateMultiplyFunctor() = default;
+  ~RichardsonLucyConjugateMultiplyFunctor() = default;
+
+  bool
+  operator==(const RichardsonLucyConjugateMultiplyFunctor &) const
+  {
+    return true;
+  }
+
+  ITK_UNEQUAL_OPERATOR_MEMBER_FUNCTION(RichardsonLucyConjugateMultiplyFunctor);
+
+  inline TOutput
+  operator()(const TInput1 & ratio, const TInput2 & H) const
+  {
+    return static_cast<TOutput>(ratio * std::conj(H));
+  }
+};
+} // namespace Functor
+
 } // end namespace itk
 
 #ifndef ITK_MANUAL_INSTANTIATION
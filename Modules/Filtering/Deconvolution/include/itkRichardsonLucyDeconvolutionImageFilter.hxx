@@ -48,10 +48,19 @@ RichardsonLucyDeconvolutionImageFilter<TInputImage, TKernelImage, TOutputImage,
 
   this->PadInput(this->GetInput(), m_PaddedInput, progress, 0.5f * progressWeight);
 
-  // Set up minipipeline to compute estimate at each iteration
+  // Set up minipipeline to compute estimate at each iteration. The
+  // pipeline is built once here and stays connected across iterations:
+  // the transfer function and the other frequency-domain buffers
+  // remain resident and no stages are rebuilt per iteration.
+  m_EstimateFFTFilter = FFTFilterType::New();
+  m_EstimateFFTFilter->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+  // Current estimate will be set as input in Iteration()
+  m_EstimateFFTFilter->ReleaseDataFlagOn();
+  progress->RegisterInternalFilter(m_EstimateFFTFilter, 0.1f * iterationProgressWeight);
+
   m_ComplexMultiplyFilter1 = ComplexMultiplyType::New();
   m_ComplexMultiplyFilter1->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
-  // Transformed estimate will be set as input 1 in Iteration()
+  m_ComplexMultiplyFilter1->SetInput1(m_EstimateFFTFilter->GetOutput());
   m_ComplexMultiplyFilter1->SetInput2(this->m_TransferFunction);
   m_ComplexMultiplyFilter1->InPlaceOn();
   m_ComplexMultiplyFilter1->ReleaseDataFlagOn();
@@ -79,20 +88,27 @@ RichardsonLucyDeconvolutionImageFilter<TInputImage, TKernelImage, TOutputImage,
   m_FFTFilter->ReleaseDataFlagOn();
   progress->RegisterInternalFilter(m_FFTFilter, 0.2f * iterationProgressWeight);
 
-  m_ConjugateAdaptor = ConjugateAdaptorType::New();
-  m_ConjugateAdaptor->SetImage(this->m_TransferFunction);
-
-  m_ComplexMultiplyFilter2 = ComplexConjugateMultiplyType::New();
-  m_ComplexMultiplyFilter2->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
-  m_ComplexMultiplyFilter2->SetInput1(m_FFTFilter->GetOutput());
-  m_ComplexMultiplyFilter2->SetInput2(m_ConjugateAdaptor);
-  m_ComplexMultiplyFilter2->ReleaseDataFlagOn();
-  progress->RegisterInternalFilter(m_ComplexMultiplyFilter2, 0.07f * iterationProgressWeight);
+  // The multiplication with the conjugate transfer function is fused
+  // into a single elementwise pass that runs in place on the
+  // frequency-domain buffer, instead of a multiply filter reading
+  // through a ComplexConjugateImageAdaptor.
+  using ConjugateMultiplyFunctorType =
+    Functor::RichardsonLucyConjugateMultiplyFunctor<InternalComplexType, InternalComplexType, InternalComplexType>;
+  ConjugateMultiplyFunctorType conjugateMultiplyFunctor;
+
+  m_ConjugateMultiplyFilter = ConjugateMultiplyFilterType::New();
+  m_ConjugateMultiplyFilter->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+  m_ConjugateMultiplyFilter->SetFunctor(conjugateMultiplyFunctor);
+  m_ConjugateMultiplyFilter->SetInput1(m_FFTFilter->GetOutput());
+  m_ConjugateMultiplyFilter->SetInput2(this->m_TransferFunction);
+  m_ConjugateMultiplyFilter->InPlaceOn();
+  m_ConjugateMultiplyFilter->ReleaseDataFlagOn();
+  progress->RegisterInternalFilter(m_ConjugateMultiplyFilter, 0.07f * iterationProgressWeight);
 
   m_IFFTFilter2 = IFFTFilterType::New();
   m_IFFTFilter2->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
   m_IFFTFilter2->SetActualXDimensionIsOdd(this->GetXDimensionIsOdd());
-  m_IFFTFilter2->SetInput(m_ComplexMultiplyFilter2->GetOutput());
+  m_IFFTFilter2->SetInput(m_ConjugateMultiplyFilter->GetOutput());
   m_IFFTFilter2->ReleaseDataFlagOn();
   progress->RegisterInternalFilter(m_IFFTFilter2, 0.2f * iterationProgressWeight);
 
@@ -110,15 +126,13 @@ RichardsonLucyDeconvolutionImageFilter<TInputImage, TKernelImage, TOutputImage,
 template <typename TInputImage, typename TKernelImage, typename TOutputImage, typename TInternalPrecision>
 void
 RichardsonLucyDeconvolutionImageFilter<TInputImage, TKernelImage, TOutputImage, TInternalPrecision>::Iteration(
-  ProgressAccumulator * progress,
-  float                 iterationProgressWeight)
+  ProgressAccumulator * itkNotUsed(progress),
+  float                 itkNotUsed(iterationProgressWeight))
 {
-  // Set up minipipeline to compute the new estimate
-  InternalComplexImagePointerType transformedEstimate;
-  this->TransformPaddedInput(this->m_CurrentEstimate, transformedEstimate, progress, 0.1f * iterationProgressWeight);
-
-  // Set the inputs
-  m_ComplexMultiplyFilter1->SetInput1(transformedEstimate);
+  // The minipipeline set up in Initialize() stays connected across
+  // iterations; just point it at the current estimate and pull the new
+  // estimate through it.
+  m_EstimateFFTFilter->SetInput(this->m_CurrentEstimate);
   m_MultiplyFilter->SetInput1(this->m_CurrentEstimate);
 
   // Trigger the update
@@ -137,12 +151,12 @@ RichardsonLucyDeconvolutionImageFilter<TInputImage, TKernelImage, TOutputImage,
 {
   this->Superclass::Finish(progress, progressWeight);
 
+  m_EstimateFFTFilter = nullptr;
   m_ComplexMultiplyFilter1 = nullptr;
   m_IFFTFilter1 = nullptr;
   m_DivideFilter = nullptr;
   m_FFTFilter = nullptr;
-  m_ConjugateAdaptor = nullptr;
-  m_ComplexMultiplyFilter2 = nullptr;
+  m_ConjugateMultiplyFilter = nullptr;
   m_IFFTFilter2 = nullptr;
   m_MultiplyFilter = nullptr;
 }
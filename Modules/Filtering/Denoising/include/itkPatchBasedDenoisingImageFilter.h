@@ -29,6 +29,7 @@
 #include "itkFixedArray.h"
 #include "itkMatrix.h"
 #include "itkRegionConstrainedSubsampler.h"
+#include "itkVariableLengthVector.h"
 #include <type_traits>
 
 #include <vector>
@@ -136,6 +137,18 @@ public:
     BaseSamplerPointer    sampler;
     EigenValuesCacheType  eigenValsCache;
     EigenVectorsCacheType eigenVecsCache;
+    /** Scratch space reused across the per-query-pixel calls of
+     *  ComputeGradientJointEntropy.  Every field is fully rewritten on each
+     *  call; keeping the storage alive between calls only avoids repeated
+     *  allocation in the per-pixel hot loop. */
+    typename BaseSamplerType::SubsamplePointer selectedPatchesScratch;
+    VariableLengthVector<PixelType>            currentPatchScratch;
+    VariableLengthVector<unsigned short>       inBoundsScratch;
+    VariableLengthVector<RealArrayType>        patchWeightScratch;
+    RealArrayType                              squaredNormScratch;
+    RealArrayType                              centerPatchSquaredNormScratch;
+    RealArrayType                              norm1Scratch;
+    RealArrayType                              norm2Scratch;
   };
 
   /** Set/Get flag indicating whether smooth-disc patch weights should be used.
@@ -1572,6 +1572,28 @@ PatchBasedDenoisingImageFilter<TInputImage, TOutputImage>::ThreadedComputeSigmaU
   }
   inList->SetRegion(*fIt);
 
+  // Allocate the per-sample working buffers once, outside the sample loop.
+  // Their contents are fully rewritten for every sample below, and Search()
+  // clears and refills the subsample container, so reusing them does not
+  // change any result.
+  typename BaseSamplerType::SubsamplePointer selectedPatches = BaseSamplerType::SubsampleType::New();
+
+  RealArrayType probJointEntropy(m_NumIndependentComponents);
+  RealArrayType probJointEntropyFirstDerivative(m_NumIndependentComponents);
+  RealArrayType probJointEntropySecondDerivative(m_NumIndependentComponents);
+
+  RealArrayType probPatchEntropy(m_NumIndependentComponents);
+  RealArrayType probPatchEntropyFirstDerivative(m_NumIndependentComponents);
+  RealArrayType probPatchEntropySecondDerivative(m_NumIndependentComponents);
+
+  VariableLengthVector<PixelType> currentPatchVec(lengthPatch);
+
+  RealType      centerPatchDifference;
+  RealArrayType squaredNorm(m_NumIndependentComponents);
+  RealArrayType centerPatchSquaredNorm(m_NumIndependentComponents);
+  RealArrayType tmpNorm1(m_NumIndependentComponents);
+  RealArrayType tmpNorm2(m_NumIndependentComponents);
+
   unsigned int sampleNum = 0;
   for (SampleIteratorType sampleIt = inList->Begin(); sampleIt != inList->End(); ++sampleIt, ++sampleNum)
   {
@@ -1607,28 +1629,20 @@ PatchBasedDenoisingImageFilter<TInputImage, TOutputImage>::ThreadedComputeSigmaU
     region.SetIndex(rIndex);
     region.SetSize(rSize);
 
-    typename BaseSamplerType::SubsamplePointer selectedPatches = BaseSamplerType::SubsampleType::New();
     sampler->SetRegionConstraint(region);
     sampler->CanSelectQueryOff();
     sampler->Search(currentPatchId, selectedPatches);
 
     const unsigned int numPatches = selectedPatches->GetTotalFrequency();
 
-    RealArrayType probJointEntropy(m_NumIndependentComponents);
-    RealArrayType probJointEntropyFirstDerivative(m_NumIndependentComponents);
-    RealArrayType probJointEntropySecondDerivative(m_NumIndependentComponents);
     probJointEntropy.Fill(0.0);
     probJointEntropyFirstDerivative.Fill(0.0);
     probJointEntropySecondDerivative.Fill(0.0);
 
-    RealArrayType probPatchEntropy(m_NumIndependentComponents);
-    RealArrayType probPatchEntropyFirstDerivative(m_NumIndependentComponents);
-    RealArrayType probPatchEntropySecondDerivative(m_NumIndependentComponents);
     probPatchEntropy.Fill(0.0);
     probPatchEntropyFirstDerivative.Fill(0.0);
     probPatchEntropySecondDerivative.Fill(0.0);
 
-    VariableLengthVector<PixelType> currentPatchVec(lengthPatch);
     // Store the current patch prior to iterating over the selected patches
     // to avoid repeatedly calling GetPixel for this patch
     // because we know we are processing a region whose pixels are all in
@@ -1656,12 +1670,6 @@ PatchBasedDenoisingImageFilter<TInputImage, TOutputImage>::ThreadedComputeSigmaU
                     << "\npatch accessed by searcher: ");
     }
 
-    RealType      centerPatchDifference;
-    RealArrayType squaredNorm(m_NumIndependentComponents);
-    RealArrayType centerPatchSquaredNorm(m_NumIndependentComponents);
-    RealArrayType tmpNorm1(m_NumIndependentComponents);
-    RealArrayType tmpNorm2(m_NumIndependentComponents);
-
     bool useCachedComputations = false;
     for (typename BaseSamplerType::SubsampleConstIterator selectedIt = selectedPatches->Begin();
          selectedIt != selectedPatches->End();
@@ -2151,7 +2159,15 @@ PatchBasedDenoisingImageFilter<TInputImage, TOutputImage>::ComputeGradientJointE
   region.SetIndex(rIndex);
   region.SetSize(rSize);
 
-  typename BaseSamplerType::SubsamplePointer selectedPatches = BaseSamplerType::SubsampleType::New();
+  // The scratch buffers in threadData persist across the per-pixel calls of
+  // this method so that this hot loop does not allocate.  They are fully
+  // rewritten below, and Search() clears and refills the subsample container,
+  // so reusing them does not change any result.
+  if (threadData.selectedPatchesScratch.IsNull())
+  {
+    threadData.selectedPatchesScratch = BaseSamplerType::SubsampleType::New();
+  }
+  typename BaseSamplerType::SubsamplePointer & selectedPatches = threadData.selectedPatchesScratch;
 
   sampler->SetRegionConstraint(region);
   sampler->CanSelectQueryOn();
@@ -2159,11 +2175,18 @@ PatchBasedDenoisingImageFilter<TInputImage, TOutputImage>::ComputeGradientJointE
 
   const unsigned int numPatches = selectedPatches->GetTotalFrequency();
 
-  RealType                             centerPatchDifference = m_ZeroPixel;
-  VariableLengthVector<PixelType>      currentPatchVec(lengthPatch);
-  VariableLengthVector<unsigned short> isInBoundsVec(lengthPatch);
-  VariableLengthVector<RealArrayType>  patchWeightVec(lengthPatch);
-  const PatchWeightsType               patchWeights = this->GetPatchWeights();
+  RealType centerPatchDifference = m_ZeroPixel;
+
+  VariableLengthVector<PixelType> &      currentPatchVec = threadData.currentPatchScratch;
+  VariableLengthVector<unsigned short> & isInBoundsVec = threadData.inBoundsScratch;
+  VariableLengthVector<RealArrayType> &  patchWeightVec = threadData.patchWeightScratch;
+  if (currentPatchVec.GetSize() != lengthPatch)
+  {
+    currentPatchVec.SetSize(lengthPatch);
+    isInBoundsVec.SetSize(lengthPatch);
+    patchWeightVec.SetSize(lengthPatch);
+  }
+  const PatchWeightsType patchWeights = this->GetPatchWeights();
 
   // Store the current patch prior to iterating over the selected patches
   // to avoid repeatedly calling GetPixel for this patch.
@@ -2205,10 +2228,14 @@ PatchBasedDenoisingImageFilter<TInputImage, TOutputImage>::ComputeGradientJointE
 
   RealType gradientJointEntropy = m_ZeroPixel;
 
-  RealArrayType squaredNorm(m_NumIndependentComponents);
-  RealArrayType centerPatchSquaredNorm(m_NumIndependentComponents);
-  RealArrayType tmpNorm1(m_NumIndependentComponents);
-  RealArrayType tmpNorm2(m_NumIndependentComponents);
+  RealArrayType & squaredNorm = threadData.squaredNormScratch;
+  RealArrayType & centerPatchSquaredNorm = threadData.centerPatchSquaredNormScratch;
+  RealArrayType & tmpNorm1 = threadData.norm1Scratch;
+  RealArrayType & tmpNorm2 = threadData.norm2Scratch;
+  squaredNorm.SetSize(m_NumIndependentComponents);
+  centerPatchSquaredNorm.SetSize(m_NumIndependentComponents);
+  tmpNorm1.SetSize(m_NumIndependentComponents);
+  tmpNorm2.SetSize(m_NumIndependentComponents);
 
   bool useCachedComputations = false;
 
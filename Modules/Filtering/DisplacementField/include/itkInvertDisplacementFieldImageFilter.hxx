@@ -20,8 +20,8 @@
 
 #include "itkInvertDisplacementFieldImageFilter.h"
 
-#include "itkComposeDisplacementFieldsImageFilter.h"
 #include "itkImageDuplicator.h"
+#include "itkImageRegionConstIteratorWithIndex.h"
 #include "itkImageRegionIterator.h"
 #include <mutex>
 #include "itkProgressTransformer.h"
@@ -103,6 +103,14 @@ InvertDisplacementFieldImageFilter<TInputImage, TOutputImage>::GenerateData()
   this->m_ScaledNormImage->SetRegions(displacementField->GetRequestedRegion());
   this->m_ScaledNormImage->Allocate(true); // initialize buffer to zero
 
+  // The composed field buffer is allocated once and refilled in place each
+  // iteration by the first threaded pass.
+  this->m_ComposedField->CopyInformation(displacementField);
+  this->m_ComposedField->SetRegions(displacementField->GetRequestedRegion());
+  this->m_ComposedField->Allocate();
+
+  this->m_Interpolator->SetInputImage(displacementField);
+
   SizeValueType numberOfPixelsInRegion = (displacementField->GetRequestedRegion()).GetNumberOfPixels();
   this->m_MaxErrorNorm = NumericTraits<RealType>::max();
   this->m_MeanErrorNorm = NumericTraits<RealType>::max();
@@ -116,16 +124,8 @@ InvertDisplacementFieldImageFilter<TInputImage, TOutputImage>::GenerateData()
     itkDebugMacro("Iteration " << iteration << ": mean error norm = " << this->m_MeanErrorNorm
                                << ", max error norm = " << this->m_MaxErrorNorm);
 
-    using ComposerType = ComposeDisplacementFieldsImageFilter<DisplacementFieldType>;
-    auto composer = ComposerType::New();
-    composer->SetDisplacementField(displacementField);
-    composer->SetWarpingField(inverseDisplacementField);
-
-    this->m_ComposedField = composer->GetOutput();
-    this->m_ComposedField->Update();
-    this->m_ComposedField->DisconnectPipeline();
-
-    // Multithread processing to multiply each element of the composed field by 1 / spacing
+    // Multithread processing to compose the current inverse estimate with the
+    // displacement field and scale each element of the result by 1 / spacing
     this->m_MeanErrorNorm = NumericTraits<RealType>::ZeroValue();
     this->m_MaxErrorNorm = NumericTraits<RealType>::ZeroValue();
 
@@ -208,6 +208,14 @@ InvertDisplacementFieldImageFilter<TInputImage, TOutputImage>::DynamicThreadedGe
   }
   else
   {
+    typename InverseDisplacementFieldType::ConstPointer inverseField = this->GetOutput();
+
+    ImageRegionConstIteratorWithIndex<InverseDisplacementFieldType> ItI(inverseField, region);
+
+    PointType pointIn1;
+    PointType pointIn2;
+    PointType pointIn3;
+
     VectorType inverseSpacing;
     RealType   localMean = NumericTraits<RealType>::ZeroValue();
     RealType   localMax = NumericTraits<RealType>::ZeroValue();
@@ -215,10 +223,36 @@ InvertDisplacementFieldImageFilter<TInputImage, TOutputImage>::DynamicThreadedGe
     {
       inverseSpacing[d] = 1.0 / this->m_DisplacementFieldSpacing[d];
     }
-    for (ItE.GoToBegin(), ItS.GoToBegin(); !ItE.IsAtEnd(); ++ItE, ++ItS)
+    for (ItI.GoToBegin(), ItE.GoToBegin(), ItS.GoToBegin(); !ItI.IsAtEnd(); ++ItI, ++ItE, ++ItS)
     {
-      const VectorType & displacement = ItE.Get();
-      RealType           scaledNorm = 0.0;
+      // Compose the current inverse estimate with the displacement field in
+      // the same sweep which measures the residual norms.  This avoids
+      // running a separate composition filter, with its own output
+      // allocation and extra pass over the field, once per iteration.
+      inverseField->TransformIndexToPhysicalPoint(ItI.GetIndex(), pointIn1);
+
+      const VectorType warpVector = ItI.Get();
+
+      for (unsigned int d = 0; d < ImageDimension; ++d)
+      {
+        pointIn2[d] = pointIn1[d] + warpVector[d];
+      }
+
+      typename InterpolatorType::OutputType interpolatedDisplacement(0.0);
+      if (this->m_Interpolator->IsInsideBuffer(pointIn2))
+      {
+        interpolatedDisplacement = this->m_Interpolator->Evaluate(pointIn2);
+      }
+
+      for (unsigned int d = 0; d < ImageDimension; ++d)
+      {
+        pointIn3[d] = pointIn2[d] + interpolatedDisplacement[d];
+      }
+
+      VectorType displacement;
+      displacement = pointIn3 - pointIn1;
+
+      RealType scaledNorm = 0.0;
       for (unsigned int d = 0; d < ImageDimension; ++d)
       {
         scaledNorm += itk::Math::sqr(displacement[d] * inverseSpacing[d]);
@@ -19,6 +19,8 @@
 #define itkSignedMaurerDistanceMapImageFilter_h
 
 #include "itkImageToImageFilter.h"
+#include "itkNarrowBand.h"
+#include "vnl/vnl_vector.h"
 
 namespace itk
 {
@@ -50,6 +52,13 @@ namespace itk
  *  the itk::DanielssonDistanceImageFilter class except it does not return
  *  the Voronoi map.
  *
+ *  Set/GetMaximumDistance optionally caps the computation: distances
+ *  beyond the cap saturate at +/- MaximumDistance, which prunes far away
+ *  boundary parabolas from the envelope scans. With a positive cap,
+ *  CollectNarrowBandOn() additionally gathers the pixels strictly inside
+ *  the cap into an itk::NarrowBand of index and distance pairs, available
+ *  through GetNarrowBand().
+ *
  *  Reference:
  *  C. R. Maurer, Jr., R. Qi, and V. Raghavan, "A Linear Time Algorithm
  *  for Computing Exact Euclidean Distance Transforms of Binary Images in
@@ -115,6 +124,12 @@ public:
   using OutputSpacingType = typename OutputImageType::SpacingType;
   using OutputImageRegionType = typename OutputImageType::RegionType;
 
+  /** The narrow band optionally filled with the pixels closer to the
+   * object boundary than MaximumDistance. */
+  using BandNodeType = BandNode<OutputIndexType, OutputPixelType>;
+  using NarrowBandType = NarrowBand<BandNodeType>;
+  using NarrowBandPointer = typename NarrowBandType::Pointer;
+
   /** Set if the distance should be squared. */
   itkSetMacro(SquaredDistance, bool);
 
@@ -153,6 +168,31 @@ public:
   itkSetMacro(BackgroundValue, InputPixelType);
   itkGetConstReferenceMacro(BackgroundValue, InputPixelType);
 
+  /** Set/Get the maximum distance of interest. When greater than zero,
+   * boundary parabolas further away than this distance are pruned from the
+   * Voronoi envelope scans and the output saturates at +/- MaximumDistance
+   * (+/- MaximumDistance^2 when SquaredDistance is on) instead of holding
+   * the exact value. The default, zero, computes the full distance map. */
+  itkSetMacro(MaximumDistance, double);
+  itkGetConstReferenceMacro(MaximumDistance, double);
+
+  /** Set/Get whether a sparse narrow band representation of the result
+   * should be collected in addition to the dense output image. Requires a
+   * positive MaximumDistance, which acts as the band radius. Default is
+   * off. */
+  itkSetMacro(CollectNarrowBand, bool);
+  itkGetConstReferenceMacro(CollectNarrowBand, bool);
+  itkBooleanMacro(CollectNarrowBand);
+
+  /** Get the narrow band collected during the last update. Each node holds
+   * the index and the signed distance of a pixel strictly closer to the
+   * object boundary than MaximumDistance. */
+  NarrowBandPointer
+  GetNarrowBand() const
+  {
+    return m_NarrowBand;
+  }
+
 #ifdef ITK_USE_CONCEPT_CHECKING
   // Begin concept checking
   itkConceptMacro(IntConvertibleToInputCheck, (Concept::Convertible<int, InputPixelType>));
@@ -184,10 +224,23 @@ protected:
   }
 
 private:
+  /** Run the one dimensional Voronoi pass on the line through idx along
+   * dimension d. The line is addressed directly through the image
+   * buffers, and the scratch vectors are reused for all the lines
+   * processed by a thread. */
   void
-       Voronoi(unsigned int, OutputIndexType idx, OutputImageType * output);
+       Voronoi(unsigned int                  d,
+               OutputIndexType               idx,
+               OutputImageType *             output,
+               vnl_vector<OutputPixelType> & g,
+               vnl_vector<OutputPixelType> & h);
   bool Remove(OutputPixelType, OutputPixelType, OutputPixelType, OutputPixelType, OutputPixelType, OutputPixelType);
 
+  /** Collect the pixels within MaximumDistance of the boundary into
+   * m_NarrowBand, once the distance map has been computed. */
+  void
+  CollectNarrowBandNodes();
+
   InputPixelType   m_BackgroundValue;
   InputSpacingType m_Spacing;
 
@@ -197,6 +250,11 @@ private:
   bool m_UseImageSpacing{ true };
   bool m_SquaredDistance{ false };
 
+  double m_MaximumDistance{ 0.0 };
+
+  bool              m_CollectNarrowBand{ false };
+  NarrowBandPointer m_NarrowBand;
+
   const InputImageType * m_InputCache;
 };
 } // end namespace itk
@@ -29,6 +29,9 @@
 #include "vnl/vnl_vector.h"
 #include "itkMath.h"
 
+#include <mutex>
+#include <vector>
+
 namespace itk
 {
 template <typename TInputImage, typename TOutputImage>
@@ -102,6 +105,11 @@ template <typename TInputImage, typename TOutputImage>
 void
 SignedMaurerDistanceMapImageFilter<TInputImage, TOutputImage>::GenerateData()
 {
+  if (m_CollectNarrowBand && m_MaximumDistance <= 0.0)
+  {
+    itkExceptionMacro("CollectNarrowBand requires a positive MaximumDistance to act as the band radius.");
+  }
+
   ThreadIdType numberOfWorkUnits = this->GetNumberOfWorkUnits();
 
   OutputImageType *      outputPtr = this->GetOutput();
@@ -162,6 +170,15 @@ SignedMaurerDistanceMapImageFilter<TInputImage, TOutputImage>::GenerateData()
     m_CurrentDimension = d;
     this->GetMultiThreader()->SingleMethodExecute();
   }
+
+  if (m_CollectNarrowBand)
+  {
+    this->CollectNarrowBandNodes();
+  }
+  else
+  {
+    m_NarrowBand = nullptr;
+  }
 }
 
 template <typename TInputImage, typename TOutputImage>
@@ -231,6 +248,12 @@ SignedMaurerDistanceMapImageFilter<TInputImage, TOutputImage>::ThreadedGenerateD
   OutputIndexType    idx;
   idx.Fill(0);
 
+  // The scratch vectors of the Voronoi pass are reused for every line
+  // processed by this thread, instead of being reallocated per line.
+  const OutputSizeValueType   lineLength = outputPtr->GetRequestedRegion().GetSize()[m_CurrentDimension];
+  vnl_vector<OutputPixelType> g(lineLength, 0);
+  vnl_vector<OutputPixelType> h(lineLength, 0);
+
   for (InputSizeValueType n = 0; n < tempRow; ++n)
   {
     index = n;
@@ -245,7 +268,7 @@ SignedMaurerDistanceMapImageFilter<TInputImage, TOutputImage>::ThreadedGenerateD
       index %= k[count];
       count++;
     }
-    this->Voronoi(m_CurrentDimension, idx, outputImage);
+    this->Voronoi(m_CurrentDimension, idx, outputImage, g, h);
     progress->CompletedPixel();
   }
   progress.reset();
@@ -310,43 +333,58 @@ SignedMaurerDistanceMapImageFilter<TInputImage, TOutputImage>::ThreadedGenerateD
 
 template <typename TInputImage, typename TOutputImage>
 void
-SignedMaurerDistanceMapImageFilter<TInputImage, TOutputImage>::Voronoi(unsigned int      d,
-                                                                       OutputIndexType   idx,
-                                                                       OutputImageType * output)
+SignedMaurerDistanceMapImageFilter<TInputImage, TOutputImage>::Voronoi(unsigned int                  d,
+                                                                       OutputIndexType               idx,
+                                                                       OutputImageType *             output,
+                                                                       vnl_vector<OutputPixelType> & g,
+                                                                       vnl_vector<OutputPixelType> & h)
 {
   OutputRegionType    oRegion = output->GetRequestedRegion();
   OutputSizeValueType nd = oRegion.GetSize()[d];
 
-  vnl_vector<OutputPixelType> g(nd, 0);
-  vnl_vector<OutputPixelType> h(nd, 0);
-
-
   InputRegionType iRegion = m_InputCache->GetRequestedRegion();
   InputIndexType  startIndex = iRegion.GetIndex();
 
-  OutputPixelType di;
+  // Address the line directly through the image buffers: one offset
+  // computation per line instead of one per pixel access, so the scans
+  // stride through memory and stay cache friendly.
+  idx[d] = startIndex[d];
+  OutputPixelType *      outLine = output->GetBufferPointer() + output->ComputeOffset(idx);
+  const InputPixelType * inLine = m_InputCache->GetBufferPointer() + m_InputCache->ComputeOffset(idx);
+  const OffsetValueType  outStride = output->GetOffsetTable()[d];
+  const OffsetValueType  inStride = m_InputCache->GetOffsetTable()[d];
+
+  const bool useImageSpacing = this->GetUseImageSpacing();
+
+  // Distances stay squared until the final pass, so the cap is applied in
+  // the squared domain. Intermediate values above the cap can only lead to
+  // final distances above the cap, which all saturate; pruning them from
+  // the envelope cannot change any value below the cap.
+  const bool capDistance = this->m_MaximumDistance > 0.0;
+  const auto capSquared = static_cast<OutputPixelType>(this->m_MaximumDistance * this->m_MaximumDistance);
+  const bool finalPass = (d == ImageDimension - 1);
 
   int l = -1;
 
-  for (unsigned int i = 0; i < nd; ++i)
+  const OutputPixelType * outScan = outLine;
+  for (OutputSizeValueType i = 0; i < nd; ++i, outScan += outStride)
   {
-    idx[d] = i + startIndex[d];
-
-    di = output->GetPixel(idx);
-
-    OutputPixelType iw;
+    const OutputPixelType di = *outScan;
 
-    if (this->GetUseImageSpacing())
+    if (Math::NotExactlyEquals(di, NumericTraits<OutputPixelType>::max()) &&
+        !(capDistance && itk::Math::abs(di) > capSquared))
     {
-      iw = static_cast<OutputPixelType>(i) * static_cast<OutputPixelType>(this->m_Spacing[d]);
-    }
-    else
-    {
-      iw = static_cast<OutputPixelType>(i);
-    }
+      OutputPixelType iw;
+
+      if (useImageSpacing)
+      {
+        iw = static_cast<OutputPixelType>(i) * static_cast<OutputPixelType>(this->m_Spacing[d]);
+      }
+      else
+      {
+        iw = static_cast<OutputPixelType>(i);
+      }
 
-    if (Math::NotExactlyEquals(di, NumericTraits<OutputPixelType>::max()))
-    {
       if (l < 1)
       {
         l++;
@@ -368,6 +406,24 @@ SignedMaurerDistanceMapImageFilter<TInputImage, TOutputImage>::Voronoi(unsigned
 
   if (l == -1)
   {
+    if (capDistance && finalPass)
+    {
+      // Every parabola of this line was pruned by the cap: the whole line
+      // saturates at the cap, with the sign taken from the input.
+      OutputPixelType *      out = outLine;
+      const InputPixelType * in = inLine;
+      for (OutputSizeValueType i = 0; i < nd; ++i, out += outStride, in += inStride)
+      {
+        if (Math::NotExactlyEquals(*in, this->m_BackgroundValue) == this->m_InsideIsPositive)
+        {
+          *out = capSquared;
+        }
+        else
+        {
+          *out = -capSquared;
+        }
+      }
+    }
     return;
   }
 
@@ -375,11 +431,13 @@ SignedMaurerDistanceMapImageFilter<TInputImage, TOutputImage>::Voronoi(unsigned
 
   l = 0;
 
-  for (unsigned int i = 0; i < nd; ++i)
+  OutputPixelType *      out = outLine;
+  const InputPixelType * in = inLine;
+  for (OutputSizeValueType i = 0; i < nd; ++i, out += outStride, in += inStride)
   {
     OutputPixelType iw;
 
-    if (this->GetUseImageSpacing())
+    if (useImageSpacing)
     {
       iw = static_cast<OutputPixelType>(i * this->m_Spacing[d]);
     }
@@ -402,28 +460,32 @@ SignedMaurerDistanceMapImageFilter<TInputImage, TOutputImage>::Voronoi(unsigned
       l++;
       d1 = d2;
     }
-    idx[d] = i + startIndex[d];
 
-    if (Math::NotExactlyEquals(m_InputCache->GetPixel(idx), this->m_BackgroundValue))
+    if (capDistance && finalPass && d1 > capSquared)
+    {
+      d1 = capSquared;
+    }
+
+    if (Math::NotExactlyEquals(*in, this->m_BackgroundValue))
     {
       if (this->m_InsideIsPositive)
       {
-        output->SetPixel(idx, d1);
+        *out = d1;
       }
       else
       {
-        output->SetPixel(idx, -d1);
+        *out = -d1;
       }
     }
     else
     {
       if (this->m_InsideIsPositive)
       {
-        output->SetPixel(idx, -d1);
+        *out = -d1;
       }
       else
       {
-        output->SetPixel(idx, d1);
+        *out = d1;
       }
     }
   }
@@ -447,6 +509,53 @@ SignedMaurerDistanceMapImageFilter<TInputImage, TOutputImage>::Remove(OutputPixe
   return (value > 0);
 }
 
+template <typename TInputImage, typename TOutputImage>
+void
+SignedMaurerDistanceMapImageFilter<TInputImage, TOutputImage>::CollectNarrowBandNodes()
+{
+  const OutputImageType * outputPtr = this->GetOutput();
+
+  // The output holds squared distances when SquaredDistance is on, so the
+  // band threshold has to live in the same domain. Saturated pixels sit
+  // exactly at the cap and the strict comparison keeps them out.
+  const auto threshold = static_cast<OutputPixelType>(
+    this->m_SquaredDistance ? this->m_MaximumDistance * this->m_MaximumDistance : this->m_MaximumDistance);
+
+  m_NarrowBand = NarrowBandType::New();
+  m_NarrowBand->SetTotalRadius(static_cast<float>(this->m_MaximumDistance));
+
+  std::mutex mutex;
+
+  this->GetMultiThreader()->template ParallelizeImageRegion<ImageDimension>(
+    outputPtr->GetRequestedRegion(),
+    [this, outputPtr, threshold, &mutex](const OutputImageRegionType & region) {
+      std::vector<BandNodeType> nodes;
+
+      ImageRegionConstIteratorWithIndex<OutputImageType> it(outputPtr, region);
+      for (it.GoToBegin(); !it.IsAtEnd(); ++it)
+      {
+        const OutputPixelType value = it.Get();
+        if (itk::Math::abs(value) < threshold)
+        {
+          BandNodeType node;
+          node.m_Index = it.GetIndex();
+          node.m_Data = value;
+          nodes.push_back(node);
+        }
+      }
+
+      if (!nodes.empty())
+      {
+        const std::lock_guard<std::mutex> lockGuard(mutex);
+        for (const BandNodeType & node : nodes)
+        {
+          m_NarrowBand->PushBack(node);
+        }
+      }
+    },
+    nullptr);
+}
+
 /**
  * Standard "PrintSelf" method
  */
@@ -460,6 +569,8 @@ SignedMaurerDistanceMapImageFilter<TInputImage, TOutputImage>::PrintSelf(std::os
   os << indent << "Inside is positive: " << this->m_InsideIsPositive << std::endl;
   os << indent << "Use image spacing: " << this->m_UseImageSpacing << std::endl;
   os << indent << "Squared distance: " << this->m_SquaredDistance << std::endl;
+  os << indent << "Maximum distance: " << this->m_MaximumDistance << std::endl;
+  os << indent << "Collect narrow band: " << this->m_CollectNarrowBand << std::endl;
 }
 } // end namespace itk
 
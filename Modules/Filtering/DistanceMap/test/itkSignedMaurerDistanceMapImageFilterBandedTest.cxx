@@ -0,0 +1,161 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkSignedMaurerDistanceMapImageFilter.h"
+#include "itkImageRegionConstIteratorWithIndex.h"
+#include "itkTestingMacros.h"
+
+#include <set>
+
+int
+itkSignedMaurerDistanceMapImageFilterBandedTest(int, char *[])
+{
+  constexpr unsigned int Dimension = 2;
+  using InputImageType = itk::Image<unsigned char, Dimension>;
+  using OutputImageType = itk::Image<float, Dimension>;
+  using FilterType = itk::SignedMaurerDistanceMapImageFilter<InputImageType, OutputImageType>;
+
+  constexpr double maximumDistance = 10.0;
+
+  // A binary image with two objects far enough apart that part of the
+  // image lies beyond the maximum distance of interest.
+  auto                      image = InputImageType::New();
+  InputImageType::SizeType  size;
+  size.Fill(128);
+  image->SetRegions(size);
+  image->Allocate(true);
+  for (int y = 20; y <= 35; ++y)
+  {
+    for (int x = 15; x <= 40; ++x)
+    {
+      image->SetPixel({ { x, y } }, 255);
+    }
+  }
+  for (int y = 90; y <= 110; ++y)
+  {
+    for (int x = 85; x <= 95; ++x)
+    {
+      image->SetPixel({ { x, y } }, 255);
+    }
+  }
+
+  // Reference: the full, uncapped distance map.
+  auto reference = FilterType::New();
+  reference->SetInput(image);
+  reference->InsideIsPositiveOff();
+  reference->SquaredDistanceOff();
+  reference->UseImageSpacingOn();
+  ITK_TRY_EXPECT_NO_EXCEPTION(reference->Update());
+
+  auto banded = FilterType::New();
+  banded->SetInput(image);
+  banded->InsideIsPositiveOff();
+  banded->SquaredDistanceOff();
+  banded->UseImageSpacingOn();
+  banded->SetMaximumDistance(maximumDistance);
+  ITK_TEST_SET_GET_VALUE(maximumDistance, banded->GetMaximumDistance());
+  banded->CollectNarrowBandOn();
+  ITK_TEST_SET_GET_VALUE(true, banded->GetCollectNarrowBand());
+  ITK_TRY_EXPECT_NO_EXCEPTION(banded->Update());
+
+  ITK_EXERCISE_BASIC_OBJECT_METHODS(banded, SignedMaurerDistanceMapImageFilter, ImageToImageFilter);
+
+  // Inside the band the capped map must match the full map; outside it
+  // must saturate at +/- MaximumDistance.
+  itk::ImageRegionConstIteratorWithIndex<OutputImageType> refIt(reference->GetOutput(),
+                                                                reference->GetOutput()->GetLargestPossibleRegion());
+  itk::SizeValueType                                      bandSize = 0;
+  for (refIt.GoToBegin(); !refIt.IsAtEnd(); ++refIt)
+  {
+    const float expected = refIt.Get();
+    const float computed = banded->GetOutput()->GetPixel(refIt.GetIndex());
+    if (itk::Math::abs(expected) < maximumDistance)
+    {
+      ++bandSize;
+      if (itk::Math::abs(computed - expected) > 1e-4)
+      {
+        std::cerr << "Test failed!" << std::endl;
+        std::cerr << "Distance mismatch inside the band at " << refIt.GetIndex() << ": expected " << expected
+                  << ", got " << computed << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+    else if (itk::Math::abs(itk::Math::abs(computed) - maximumDistance) > 1e-4 ||
+             (expected < 0) != (computed < 0))
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "Pixel beyond the cap at " << refIt.GetIndex() << " is not saturated: expected "
+                << (expected < 0 ? '-' : '+') << maximumDistance << ", got " << computed << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // The narrow band must contain exactly the pixels strictly inside the
+  // cap, each carrying its signed distance.
+  using NarrowBandType = FilterType::NarrowBandType;
+  NarrowBandType::Pointer narrowBand = banded->GetNarrowBand();
+  ITK_TEST_EXPECT_TRUE(narrowBand.IsNotNull());
+  ITK_TEST_EXPECT_EQUAL(bandSize, static_cast<itk::SizeValueType>(narrowBand->Size()));
+
+  std::set<itk::OffsetValueType> seenOffsets;
+  for (auto nodeIt = narrowBand->Begin(); nodeIt != narrowBand->End(); ++nodeIt)
+  {
+    const float expected = banded->GetOutput()->GetPixel(nodeIt->m_Index);
+    if (itk::Math::abs(expected) >= maximumDistance || itk::Math::NotExactlyEquals(nodeIt->m_Data, expected))
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "Unexpected narrow band node at " << nodeIt->m_Index << " with value " << nodeIt->m_Data
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+    seenOffsets.insert(banded->GetOutput()->ComputeOffset(nodeIt->m_Index));
+  }
+  ITK_TEST_EXPECT_EQUAL(bandSize, static_cast<itk::SizeValueType>(seenOffsets.size()));
+  ITK_TEST_EXPECT_TRUE(itk::Math::FloatAlmostEqual(static_cast<float>(maximumDistance), narrowBand->GetTotalRadius()));
+
+  // The cap must behave the same way in the squared distance domain.
+  auto squared = FilterType::New();
+  squared->SetInput(image);
+  squared->InsideIsPositiveOff();
+  squared->SquaredDistanceOn();
+  squared->UseImageSpacingOn();
+  squared->SetMaximumDistance(maximumDistance);
+  ITK_TRY_EXPECT_NO_EXCEPTION(squared->Update());
+
+  for (refIt.GoToBegin(); !refIt.IsAtEnd(); ++refIt)
+  {
+    const float expected = refIt.Get();
+    const float computed = squared->GetOutput()->GetPixel(refIt.GetIndex());
+    const float clamped = std::min(itk::Math::abs(expected), static_cast<float>(maximumDistance));
+    if (itk::Math::abs(itk::Math::abs(computed) - clamped * clamped) > 1e-2)
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "Squared distance mismatch at " << refIt.GetIndex() << ": expected " << clamped * clamped
+                << ", got " << computed << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Collecting the narrow band without a band radius is an error.
+  auto invalid = FilterType::New();
+  invalid->SetInput(image);
+  invalid->CollectNarrowBandOn();
+  ITK_TRY_EXPECT_EXCEPTION(invalid->Update());
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,105 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkCommonExplicitInstantiation_h
+#define itkCommonExplicitInstantiation_h
+
+#include "itkImage.h"
+#include "itkImageToImageFilter.h"
+#include "itkInPlaceImageFilter.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkImageRegionIterator.h"
+#include "ITKExplicitInstantiationExport.h"
+
+/** Prebuilt instantiations of the ITKCommon image, iterator and filter base
+ * templates for 2D and 3D images of unsigned char, short and float.
+ * Including this header suppresses implicit instantiation of these templates
+ * in the including translation unit; the definitions are linked from the
+ * ITKExplicitInstantiation library instead, which shortens compile times and
+ * shares the generated code between all users of the library. */
+
+#if defined(ITKExplicitInstantiation_EXPORTS)
+//   We are building this library
+#  define ITKExplicitInstantiation_EXPORT_EXPLICIT ITK_TEMPLATE_EXPORT
+#else
+//   We are using this library
+#  define ITKExplicitInstantiation_EXPORT_EXPLICIT ITKExplicitInstantiation_EXPORT
+#endif
+
+#ifndef ITK_TEMPLATE_EXPLICIT_CommonExplicitInstantiation
+namespace itk
+{
+
+ITK_GCC_PRAGMA_DIAG_PUSH()
+ITK_GCC_PRAGMA_DIAG(ignored "-Wattributes")
+
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT ImportImageContainer<SizeValueType, unsigned char>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT ImportImageContainer<SizeValueType, short>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT ImportImageContainer<SizeValueType, float>;
+
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT Image<unsigned char, 2>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT Image<unsigned char, 3>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT Image<short, 2>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT Image<short, 3>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT Image<float, 2>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT Image<float, 3>;
+
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT ImageSource<Image<unsigned char, 2>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT ImageSource<Image<unsigned char, 3>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT ImageSource<Image<short, 2>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT ImageSource<Image<short, 3>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT ImageSource<Image<float, 2>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT ImageSource<Image<float, 3>>;
+
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT
+  ImageToImageFilter<Image<unsigned char, 2>, Image<unsigned char, 2>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT
+  ImageToImageFilter<Image<unsigned char, 3>, Image<unsigned char, 3>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT ImageToImageFilter<Image<short, 2>, Image<short, 2>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT ImageToImageFilter<Image<short, 3>, Image<short, 3>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT ImageToImageFilter<Image<float, 2>, Image<float, 2>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT ImageToImageFilter<Image<float, 3>, Image<float, 3>>;
+
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT
+  InPlaceImageFilter<Image<unsigned char, 2>, Image<unsigned char, 2>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT
+  InPlaceImageFilter<Image<unsigned char, 3>, Image<unsigned char, 3>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT InPlaceImageFilter<Image<short, 2>, Image<short, 2>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT InPlaceImageFilter<Image<short, 3>, Image<short, 3>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT InPlaceImageFilter<Image<float, 2>, Image<float, 2>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT InPlaceImageFilter<Image<float, 3>, Image<float, 3>>;
+
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT ImageRegionConstIterator<Image<unsigned char, 2>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT ImageRegionConstIterator<Image<unsigned char, 3>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT ImageRegionConstIterator<Image<short, 2>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT ImageRegionConstIterator<Image<short, 3>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT ImageRegionConstIterator<Image<float, 2>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT ImageRegionConstIterator<Image<float, 3>>;
+
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT ImageRegionIterator<Image<unsigned char, 2>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT ImageRegionIterator<Image<unsigned char, 3>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT ImageRegionIterator<Image<short, 2>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT ImageRegionIterator<Image<short, 3>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT ImageRegionIterator<Image<float, 2>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT ImageRegionIterator<Image<float, 3>>;
+
+ITK_GCC_PRAGMA_DIAG_POP()
+
+} // end namespace itk
+#endif // ITK_TEMPLATE_EXPLICIT_CommonExplicitInstantiation
+
+#endif // itkCommonExplicitInstantiation_h
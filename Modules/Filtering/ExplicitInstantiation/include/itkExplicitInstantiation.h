@@ -0,0 +1,31 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkExplicitInstantiation_h
+#define itkExplicitInstantiation_h
+
+/** Convenience header pulling in all prebuilt template instantiations of the
+ * ITKExplicitInstantiation module. Applications that use the common 2D/3D
+ * unsigned char, short and float pipelines include this header before using
+ * the covered templates and link the ITKExplicitInstantiation library to
+ * avoid re-instantiating them. */
+
+#include "itkCommonExplicitInstantiation.h"
+#include "itkSmoothingExplicitInstantiation.h"
+#include "itkImageGridExplicitInstantiation.h"
+
+#endif // itkExplicitInstantiation_h
@@ -0,0 +1,59 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkImageGridExplicitInstantiation_h
+#define itkImageGridExplicitInstantiation_h
+
+#include "itkCommonExplicitInstantiation.h"
+#include "itkShrinkImageFilter.h"
+#include "itkResampleImageFilter.h"
+
+/** Prebuilt instantiations of the most used geometry filters of the
+ * ImageGrid module for 2D and 3D images of unsigned char, short and float.
+ * See itkCommonExplicitInstantiation.h for how the mechanism works. */
+
+#ifndef ITK_TEMPLATE_EXPLICIT_ImageGridExplicitInstantiation
+namespace itk
+{
+
+ITK_GCC_PRAGMA_DIAG_PUSH()
+ITK_GCC_PRAGMA_DIAG(ignored "-Wattributes")
+
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT
+  ShrinkImageFilter<Image<unsigned char, 2>, Image<unsigned char, 2>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT
+  ShrinkImageFilter<Image<unsigned char, 3>, Image<unsigned char, 3>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT ShrinkImageFilter<Image<short, 2>, Image<short, 2>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT ShrinkImageFilter<Image<short, 3>, Image<short, 3>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT ShrinkImageFilter<Image<float, 2>, Image<float, 2>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT ShrinkImageFilter<Image<float, 3>, Image<float, 3>>;
+
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT
+  ResampleImageFilter<Image<unsigned char, 2>, Image<unsigned char, 2>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT
+  ResampleImageFilter<Image<unsigned char, 3>, Image<unsigned char, 3>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT ResampleImageFilter<Image<short, 2>, Image<short, 2>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT ResampleImageFilter<Image<short, 3>, Image<short, 3>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT ResampleImageFilter<Image<float, 2>, Image<float, 2>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT ResampleImageFilter<Image<float, 3>, Image<float, 3>>;
+
+ITK_GCC_PRAGMA_DIAG_POP()
+
+} // end namespace itk
+#endif // ITK_TEMPLATE_EXPLICIT_ImageGridExplicitInstantiation
+
+#endif // itkImageGridExplicitInstantiation_h
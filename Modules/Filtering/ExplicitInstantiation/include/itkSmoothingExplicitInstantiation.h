@@ -0,0 +1,83 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkSmoothingExplicitInstantiation_h
+#define itkSmoothingExplicitInstantiation_h
+
+#include "itkCommonExplicitInstantiation.h"
+#include "itkBoxImageFilter.h"
+#include "itkMeanImageFilter.h"
+#include "itkMedianImageFilter.h"
+#include "itkDiscreteGaussianImageFilter.h"
+
+/** Prebuilt instantiations of the most used smoothing filters (and their
+ * BoxImageFilter base) for 2D and 3D images of unsigned char, short and
+ * float. See itkCommonExplicitInstantiation.h for how the mechanism works. */
+
+#ifndef ITK_TEMPLATE_EXPLICIT_SmoothingExplicitInstantiation
+namespace itk
+{
+
+ITK_GCC_PRAGMA_DIAG_PUSH()
+ITK_GCC_PRAGMA_DIAG(ignored "-Wattributes")
+
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT
+  BoxImageFilter<Image<unsigned char, 2>, Image<unsigned char, 2>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT
+  BoxImageFilter<Image<unsigned char, 3>, Image<unsigned char, 3>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT BoxImageFilter<Image<short, 2>, Image<short, 2>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT BoxImageFilter<Image<short, 3>, Image<short, 3>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT BoxImageFilter<Image<float, 2>, Image<float, 2>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT BoxImageFilter<Image<float, 3>, Image<float, 3>>;
+
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT
+  MeanImageFilter<Image<unsigned char, 2>, Image<unsigned char, 2>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT
+  MeanImageFilter<Image<unsigned char, 3>, Image<unsigned char, 3>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT MeanImageFilter<Image<short, 2>, Image<short, 2>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT MeanImageFilter<Image<short, 3>, Image<short, 3>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT MeanImageFilter<Image<float, 2>, Image<float, 2>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT MeanImageFilter<Image<float, 3>, Image<float, 3>>;
+
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT
+  MedianImageFilter<Image<unsigned char, 2>, Image<unsigned char, 2>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT
+  MedianImageFilter<Image<unsigned char, 3>, Image<unsigned char, 3>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT MedianImageFilter<Image<short, 2>, Image<short, 2>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT MedianImageFilter<Image<short, 3>, Image<short, 3>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT MedianImageFilter<Image<float, 2>, Image<float, 2>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT MedianImageFilter<Image<float, 3>, Image<float, 3>>;
+
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT
+  DiscreteGaussianImageFilter<Image<unsigned char, 2>, Image<unsigned char, 2>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT
+  DiscreteGaussianImageFilter<Image<unsigned char, 3>, Image<unsigned char, 3>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT
+  DiscreteGaussianImageFilter<Image<short, 2>, Image<short, 2>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT
+  DiscreteGaussianImageFilter<Image<short, 3>, Image<short, 3>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT
+  DiscreteGaussianImageFilter<Image<float, 2>, Image<float, 2>>;
+extern template class ITKExplicitInstantiation_EXPORT_EXPLICIT
+  DiscreteGaussianImageFilter<Image<float, 3>, Image<float, 3>>;
+
+ITK_GCC_PRAGMA_DIAG_POP()
+
+} // end namespace itk
+#endif // ITK_TEMPLATE_EXPLICIT_SmoothingExplicitInstantiation
+
+#endif // itkSmoothingExplicitInstantiation_h
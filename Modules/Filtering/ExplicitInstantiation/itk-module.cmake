@@ -0,0 +1,21 @@
+set(DOCUMENTATION "This module prebuilds explicit instantiations of the most
+commonly used image, iterator and filter templates (2D and 3D images of
+unsigned char, short and float) so that applications link the hot filter code
+from a shared library instead of re-instantiating it in every translation
+unit. Include itkExplicitInstantiation.h (or one of the per-area headers) and
+link this module's library to benefit. The module is not built by default:
+enable it with Module_ITKExplicitInstantiation.")
+
+itk_module(ITKExplicitInstantiation
+  ENABLE_SHARED
+  DEPENDS
+    ITKCommon
+    ITKImageFilterBase
+    ITKSmoothing
+    ITKImageGrid
+  TEST_DEPENDS
+    ITKTestKernel
+  EXCLUDE_FROM_DEFAULT
+  DESCRIPTION
+    "${DOCUMENTATION}"
+)
@@ -0,0 +1,75 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#define ITK_TEMPLATE_EXPLICIT_CommonExplicitInstantiation
+#include "itkCommonExplicitInstantiation.h"
+
+namespace itk
+{
+
+ITK_GCC_PRAGMA_DIAG_PUSH()
+ITK_GCC_PRAGMA_DIAG(ignored "-Wattributes")
+
+template class ITKExplicitInstantiation_EXPORT ImportImageContainer<SizeValueType, unsigned char>;
+template class ITKExplicitInstantiation_EXPORT ImportImageContainer<SizeValueType, short>;
+template class ITKExplicitInstantiation_EXPORT ImportImageContainer<SizeValueType, float>;
+
+template class ITKExplicitInstantiation_EXPORT Image<unsigned char, 2>;
+template class ITKExplicitInstantiation_EXPORT Image<unsigned char, 3>;
+template class ITKExplicitInstantiation_EXPORT Image<short, 2>;
+template class ITKExplicitInstantiation_EXPORT Image<short, 3>;
+template class ITKExplicitInstantiation_EXPORT Image<float, 2>;
+template class ITKExplicitInstantiation_EXPORT Image<float, 3>;
+
+template class ITKExplicitInstantiation_EXPORT ImageSource<Image<unsigned char, 2>>;
+template class ITKExplicitInstantiation_EXPORT ImageSource<Image<unsigned char, 3>>;
+template class ITKExplicitInstantiation_EXPORT ImageSource<Image<short, 2>>;
+template class ITKExplicitInstantiation_EXPORT ImageSource<Image<short, 3>>;
+template class ITKExplicitInstantiation_EXPORT ImageSource<Image<float, 2>>;
+template class ITKExplicitInstantiation_EXPORT ImageSource<Image<float, 3>>;
+
+template class ITKExplicitInstantiation_EXPORT ImageToImageFilter<Image<unsigned char, 2>, Image<unsigned char, 2>>;
+template class ITKExplicitInstantiation_EXPORT ImageToImageFilter<Image<unsigned char, 3>, Image<unsigned char, 3>>;
+template class ITKExplicitInstantiation_EXPORT ImageToImageFilter<Image<short, 2>, Image<short, 2>>;
+template class ITKExplicitInstantiation_EXPORT ImageToImageFilter<Image<short, 3>, Image<short, 3>>;
+template class ITKExplicitInstantiation_EXPORT ImageToImageFilter<Image<float, 2>, Image<float, 2>>;
+template class ITKExplicitInstantiation_EXPORT ImageToImageFilter<Image<float, 3>, Image<float, 3>>;
+
+template class ITKExplicitInstantiation_EXPORT InPlaceImageFilter<Image<unsigned char, 2>, Image<unsigned char, 2>>;
+template class ITKExplicitInstantiation_EXPORT InPlaceImageFilter<Image<unsigned char, 3>, Image<unsigned char, 3>>;
+template class ITKExplicitInstantiation_EXPORT InPlaceImageFilter<Image<short, 2>, Image<short, 2>>;
+template class ITKExplicitInstantiation_EXPORT InPlaceImageFilter<Image<short, 3>, Image<short, 3>>;
+template class ITKExplicitInstantiation_EXPORT InPlaceImageFilter<Image<float, 2>, Image<float, 2>>;
+template class ITKExplicitInstantiation_EXPORT InPlaceImageFilter<Image<float, 3>, Image<float, 3>>;
+
+template class ITKExplicitInstantiation_EXPORT ImageRegionConstIterator<Image<unsigned char, 2>>;
+template class ITKExplicitInstantiation_EXPORT ImageRegionConstIterator<Image<unsigned char, 3>>;
+template class ITKExplicitInstantiation_EXPORT ImageRegionConstIterator<Image<short, 2>>;
+template class ITKExplicitInstantiation_EXPORT ImageRegionConstIterator<Image<short, 3>>;
+template class ITKExplicitInstantiation_EXPORT ImageRegionConstIterator<Image<float, 2>>;
+template class ITKExplicitInstantiation_EXPORT ImageRegionConstIterator<Image<float, 3>>;
+
+template class ITKExplicitInstantiation_EXPORT ImageRegionIterator<Image<unsigned char, 2>>;
+template class ITKExplicitInstantiation_EXPORT ImageRegionIterator<Image<unsigned char, 3>>;
+template class ITKExplicitInstantiation_EXPORT ImageRegionIterator<Image<short, 2>>;
+template class ITKExplicitInstantiation_EXPORT ImageRegionIterator<Image<short, 3>>;
+template class ITKExplicitInstantiation_EXPORT ImageRegionIterator<Image<float, 2>>;
+template class ITKExplicitInstantiation_EXPORT ImageRegionIterator<Image<float, 3>>;
+
+ITK_GCC_PRAGMA_DIAG_POP()
+
+} // end namespace itk
@@ -0,0 +1,59 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#define ITK_TEMPLATE_EXPLICIT_SmoothingExplicitInstantiation
+#include "itkSmoothingExplicitInstantiation.h"
+
+namespace itk
+{
+
+ITK_GCC_PRAGMA_DIAG_PUSH()
+ITK_GCC_PRAGMA_DIAG(ignored "-Wattributes")
+
+template class ITKExplicitInstantiation_EXPORT BoxImageFilter<Image<unsigned char, 2>, Image<unsigned char, 2>>;
+template class ITKExplicitInstantiation_EXPORT BoxImageFilter<Image<unsigned char, 3>, Image<unsigned char, 3>>;
+template class ITKExplicitInstantiation_EXPORT BoxImageFilter<Image<short, 2>, Image<short, 2>>;
+template class ITKExplicitInstantiation_EXPORT BoxImageFilter<Image<short, 3>, Image<short, 3>>;
+template class ITKExplicitInstantiation_EXPORT BoxImageFilter<Image<float, 2>, Image<float, 2>>;
+template class ITKExplicitInstantiation_EXPORT BoxImageFilter<Image<float, 3>, Image<float, 3>>;
+
+template class ITKExplicitInstantiation_EXPORT MeanImageFilter<Image<unsigned char, 2>, Image<unsigned char, 2>>;
+template class ITKExplicitInstantiation_EXPORT MeanImageFilter<Image<unsigned char, 3>, Image<unsigned char, 3>>;
+template class ITKExplicitInstantiation_EXPORT MeanImageFilter<Image<short, 2>, Image<short, 2>>;
+template class ITKExplicitInstantiation_EXPORT MeanImageFilter<Image<short, 3>, Image<short, 3>>;
+template class ITKExplicitInstantiation_EXPORT MeanImageFilter<Image<float, 2>, Image<float, 2>>;
+template class ITKExplicitInstantiation_EXPORT MeanImageFilter<Image<float, 3>, Image<float, 3>>;
+
+template class ITKExplicitInstantiation_EXPORT MedianImageFilter<Image<unsigned char, 2>, Image<unsigned char, 2>>;
+template class ITKExplicitInstantiation_EXPORT MedianImageFilter<Image<unsigned char, 3>, Image<unsigned char, 3>>;
+template class ITKExplicitInstantiation_EXPORT MedianImageFilter<Image<short, 2>, Image<short, 2>>;
+template class ITKExplicitInstantiation_EXPORT MedianImageFilter<Image<short, 3>, Image<short, 3>>;
+template class ITKExplicitInstantiation_EXPORT MedianImageFilter<Image<float, 2>, Image<float, 2>>;
+template class ITKExplicitInstantiation_EXPORT MedianImageFilter<Image<float, 3>, Image<float, 3>>;
+
+template class ITKExplicitInstantiation_EXPORT
+  DiscreteGaussianImageFilter<Image<unsigned char, 2>, Image<unsigned char, 2>>;
+template class ITKExplicitInstantiation_EXPORT
+  DiscreteGaussianImageFilter<Image<unsigned char, 3>, Image<unsigned char, 3>>;
+template class ITKExplicitInstantiation_EXPORT DiscreteGaussianImageFilter<Image<short, 2>, Image<short, 2>>;
+template class ITKExplicitInstantiation_EXPORT DiscreteGaussianImageFilter<Image<short, 3>, Image<short, 3>>;
+template class ITKExplicitInstantiation_EXPORT DiscreteGaussianImageFilter<Image<float, 2>, Image<float, 2>>;
+template class ITKExplicitInstantiation_EXPORT DiscreteGaussianImageFilter<Image<float, 3>, Image<float, 3>>;
+
+ITK_GCC_PRAGMA_DIAG_POP()
+
+} // end namespace itk
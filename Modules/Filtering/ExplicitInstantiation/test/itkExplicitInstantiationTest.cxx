@@ -0,0 +1,99 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+// The instantiation header is included first so that all covered templates
+// below are linked from the prebuilt library instead of being instantiated
+// in this translation unit.
+#include "itkExplicitInstantiation.h"
+
+#include <iostream>
+
+int
+itkExplicitInstantiationTest(int, char *[])
+{
+  using ImageType = itk::Image<unsigned char, 2>;
+  using FloatImageType = itk::Image<float, 2>;
+
+  auto image = ImageType::New();
+  ImageType::RegionType region;
+  region.SetSize(0, 16);
+  region.SetSize(1, 16);
+  image->SetRegions(region);
+  image->Allocate();
+  image->FillBuffer(10);
+
+  ImageType::IndexType center;
+  center[0] = 8;
+  center[1] = 8;
+  image->SetPixel(center, 200);
+
+  // A 3x3 median removes the single outlier
+  auto median = itk::MedianImageFilter<ImageType, ImageType>::New();
+  median->SetInput(image);
+  median->Update();
+  itk::ImageRegionConstIterator<ImageType> medianIter(median->GetOutput(), region);
+  for (; !medianIter.IsAtEnd(); ++medianIter)
+  {
+    if (medianIter.Get() != 10)
+    {
+      std::cerr << "Median output has unexpected value " << static_cast<int>(medianIter.Get()) << " at "
+                << medianIter.GetIndex() << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Shrinking by 2 halves the image size
+  auto shrinker = itk::ShrinkImageFilter<ImageType, ImageType>::New();
+  shrinker->SetInput(median->GetOutput());
+  shrinker->SetShrinkFactors(2);
+  shrinker->Update();
+  if (shrinker->GetOutput()->GetLargestPossibleRegion().GetSize(0) != 8)
+  {
+    std::cerr << "Shrink output has unexpected size "
+              << shrinker->GetOutput()->GetLargestPossibleRegion().GetSize(0) << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Gaussian smoothing of a constant float image stays constant
+  auto floatImage = FloatImageType::New();
+  floatImage->SetRegions(region);
+  floatImage->Allocate();
+  floatImage->FillBuffer(1.0f);
+
+  auto gaussian = itk::DiscreteGaussianImageFilter<FloatImageType, FloatImageType>::New();
+  gaussian->SetInput(floatImage);
+  gaussian->SetVariance(1.0);
+  gaussian->Update();
+
+  auto resampler = itk::ResampleImageFilter<FloatImageType, FloatImageType>::New();
+  resampler->SetInput(gaussian->GetOutput());
+  resampler->SetOutputParametersFromImage(floatImage);
+  resampler->Update();
+
+  ImageType::IndexType inside;
+  inside[0] = 8;
+  inside[1] = 8;
+  const float resampled = resampler->GetOutput()->GetPixel(inside);
+  if (itk::Math::abs(resampled - 1.0f) > 1e-5f)
+  {
+    std::cerr << "Resampled center pixel is " << resampled << " instead of 1" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
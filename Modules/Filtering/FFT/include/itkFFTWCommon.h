@@ -384,6 +384,182 @@ public:
     return plan;
   }
 
+  /** Create and immediately destroy a plan for the given transform
+   * geometry so that the planner's wisdom is generated ahead of the
+   * first Execute. Wisdom is FFTW's process-wide plan cache, keyed by
+   * the transform geometry, precision and planner flags and shared by
+   * all filter instances; once it exists, creating the same plan again
+   * is a cheap table lookup. Scratch buffers are allocated internally,
+   * so this can run before any image data exists. */
+  static void
+  Preplan_dft_r2c(int rank, const int * n, unsigned flags, int threads = 1)
+  {
+    int total = 1;
+    for (int i = 0; i < rank; ++i)
+    {
+      total *= n[i];
+    }
+    // the fastest moving dimension is the last one in fftw, and only
+    // half of it (plus one) is stored on the complex side
+    const int halfTotal = total / n[rank - 1] * (n[rank - 1] / 2 + 1);
+    auto *    in = new PixelType[total];
+    auto *    out = new ComplexType[halfTotal];
+    DestroyPlan(Plan_dft_r2c(rank, n, in, out, flags, threads, true));
+    delete[] in;
+    delete[] out;
+  }
+
+  /** Same as Preplan_dft_r2c for the complex to real transform. */
+  static void
+  Preplan_dft_c2r(int rank, const int * n, unsigned flags, int threads = 1)
+  {
+    int total = 1;
+    for (int i = 0; i < rank; ++i)
+    {
+      total *= n[i];
+    }
+    const int halfTotal = total / n[rank - 1] * (n[rank - 1] / 2 + 1);
+    auto *    in = new ComplexType[halfTotal];
+    auto *    out = new PixelType[total];
+    DestroyPlan(Plan_dft_c2r(rank, n, in, out, flags, threads, true));
+    delete[] in;
+    delete[] out;
+  }
+
+  /** Same as Preplan_dft_r2c for the complex to complex transform. */
+  static void
+  Preplan_dft(int rank, const int * n, int sign, unsigned flags, int threads = 1)
+  {
+    int total = 1;
+    for (int i = 0; i < rank; ++i)
+    {
+      total *= n[i];
+    }
+    auto * in = new ComplexType[total];
+    auto * out = new ComplexType[total];
+    DestroyPlan(Plan_dft(rank, n, in, out, sign, flags, threads, true));
+    delete[] in;
+    delete[] out;
+  }
+
+  /** Plan \c howmany equally sized transforms over contiguous batches:
+   * transform b reads from in + b * prod(n) and writes to
+   * out + b * halfTotal, where halfTotal is the half-hermitian size of
+   * one transform. A single Execute then runs the whole batch with one
+   * thread team, amortizing the per-call overhead of many small
+   * transforms. */
+  static PlanType
+  Plan_many_dft_r2c(int           rank,
+                    const int *   n,
+                    int           howmany,
+                    PixelType *   in,
+                    ComplexType * out,
+                    unsigned      flags,
+                    int           threads = 1,
+                    bool          canDestroyInput = false)
+  {
+#  ifndef ITK_USE_CUFFTW
+    std::lock_guard<FFTWGlobalConfiguration::MutexType> lock(FFTWGlobalConfiguration::GetLockMutex());
+    fftwf_plan_with_nthreads(threads);
+#  else
+    (void)threads;
+#  endif
+    int total = 1;
+    for (int i = 0; i < rank; ++i)
+    {
+      total *= n[i];
+    }
+    const int halfTotal = total / n[rank - 1] * (n[rank - 1] / 2 + 1);
+    // don't add FFTW_WISDOM_ONLY if the plan rigor is FFTW_ESTIMATE
+    // because FFTW_ESTIMATE guarantee to not destroy the input
+    unsigned roflags = flags;
+    if (!(flags & FFTW_ESTIMATE))
+    {
+      roflags = flags | FFTW_WISDOM_ONLY;
+    }
+    PlanType plan =
+      fftwf_plan_many_dft_r2c(rank, n, howmany, in, nullptr, 1, total, out, nullptr, 1, halfTotal, roflags);
+    if (plan == nullptr)
+    {
+      // no wisdom available for that plan
+      if (canDestroyInput)
+      {
+        // just create the plan
+        plan = fftwf_plan_many_dft_r2c(rank, n, howmany, in, nullptr, 1, total, out, nullptr, 1, halfTotal, flags);
+      }
+      else
+      {
+        // lets create a plan with a fake input to generate the wisdom
+        auto * din = new PixelType[static_cast<size_t>(total) * howmany];
+        fftwf_plan_many_dft_r2c(rank, n, howmany, din, nullptr, 1, total, out, nullptr, 1, halfTotal, flags);
+        delete[] din;
+        // and then create the final plan - this time it shouldn't fail
+        plan = fftwf_plan_many_dft_r2c(rank, n, howmany, in, nullptr, 1, total, out, nullptr, 1, halfTotal, roflags);
+      }
+#  ifndef ITK_USE_CUFFTW
+      FFTWGlobalConfiguration::SetNewWisdomAvailable(true);
+#  endif
+    }
+    itkAssertOrThrowMacro(plan != nullptr, "PLAN_CREATION_FAILED ");
+    return plan;
+  }
+
+  /** Same as Plan_many_dft_r2c for the complex to real transform. */
+  static PlanType
+  Plan_many_dft_c2r(int           rank,
+                    const int *   n,
+                    int           howmany,
+                    ComplexType * in,
+                    PixelType *   out,
+                    unsigned      flags,
+                    int           threads = 1,
+                    bool          canDestroyInput = false)
+  {
+#  ifndef ITK_USE_CUFFTW
+    std::lock_guard<FFTWGlobalConfiguration::MutexType> lock(FFTWGlobalConfiguration::GetLockMutex());
+    fftwf_plan_with_nthreads(threads);
+#  else
+    (void)threads;
+#  endif
+    int total = 1;
+    for (int i = 0; i < rank; ++i)
+    {
+      total *= n[i];
+    }
+    const int halfTotal = total / n[rank - 1] * (n[rank - 1] / 2 + 1);
+    // don't add FFTW_WISDOM_ONLY if the plan rigor is FFTW_ESTIMATE
+    // because FFTW_ESTIMATE guarantee to not destroy the input
+    unsigned roflags = flags;
+    if (!(flags & FFTW_ESTIMATE))
+    {
+      roflags = flags | FFTW_WISDOM_ONLY;
+    }
+    PlanType plan =
+      fftwf_plan_many_dft_c2r(rank, n, howmany, in, nullptr, 1, halfTotal, out, nullptr, 1, total, roflags);
+    if (plan == nullptr)
+    {
+      // no wisdom available for that plan
+      if (canDestroyInput)
+      {
+        // just create the plan
+        plan = fftwf_plan_many_dft_c2r(rank, n, howmany, in, nullptr, 1, halfTotal, out, nullptr, 1, total, flags);
+      }
+      else
+      {
+        // lets create a plan with a fake input to generate the wisdom
+        auto * din = new ComplexType[static_cast<size_t>(halfTotal) * howmany];
+        fftwf_plan_many_dft_c2r(rank, n, howmany, din, nullptr, 1, halfTotal, out, nullptr, 1, total, flags);
+        delete[] din;
+        // and then create the final plan - this time it shouldn't fail
+        plan = fftwf_plan_many_dft_c2r(rank, n, howmany, in, nullptr, 1, halfTotal, out, nullptr, 1, total, roflags);
+      }
+#  ifndef ITK_USE_CUFFTW
+      FFTWGlobalConfiguration::SetNewWisdomAvailable(true);
+#  endif
+    }
+    itkAssertOrThrowMacro(plan != nullptr, "PLAN_CREATION_FAILED ");
+    return plan;
+  }
 
   static void
   Execute(PlanType p)
@@ -725,6 +901,182 @@ public:
     return plan;
   }
 
+  /** Create and immediately destroy a plan for the given transform
+   * geometry so that the planner's wisdom is generated ahead of the
+   * first Execute. Wisdom is FFTW's process-wide plan cache, keyed by
+   * the transform geometry, precision and planner flags and shared by
+   * all filter instances; once it exists, creating the same plan again
+   * is a cheap table lookup. Scratch buffers are allocated internally,
+   * so this can run before any image data exists. */
+  static void
+  Preplan_dft_r2c(int rank, const int * n, unsigned flags, int threads = 1)
+  {
+    int total = 1;
+    for (int i = 0; i < rank; ++i)
+    {
+      total *= n[i];
+    }
+    // the fastest moving dimension is the last one in fftw, and only
+    // half of it (plus one) is stored on the complex side
+    const int halfTotal = total / n[rank - 1] * (n[rank - 1] / 2 + 1);
+    auto *    in = new PixelType[total];
+    auto *    out = new ComplexType[halfTotal];
+    DestroyPlan(Plan_dft_r2c(rank, n, in, out, flags, threads, true));
+    delete[] in;
+    delete[] out;
+  }
+
+  /** Same as Preplan_dft_r2c for the complex to real transform. */
+  static void
+  Preplan_dft_c2r(int rank, const int * n, unsigned flags, int threads = 1)
+  {
+    int total = 1;
+    for (int i = 0; i < rank; ++i)
+    {
+      total *= n[i];
+    }
+    const int halfTotal = total / n[rank - 1] * (n[rank - 1] / 2 + 1);
+    auto *    in = new ComplexType[halfTotal];
+    auto *    out = new PixelType[total];
+    DestroyPlan(Plan_dft_c2r(rank, n, in, out, flags, threads, true));
+    delete[] in;
+    delete[] out;
+  }
+
+  /** Same as Preplan_dft_r2c for the complex to complex transform. */
+  static void
+  Preplan_dft(int rank, const int * n, int sign, unsigned flags, int threads = 1)
+  {
+    int total = 1;
+    for (int i = 0; i < rank; ++i)
+    {
+      total *= n[i];
+    }
+    auto * in = new ComplexType[total];
+    auto * out = new ComplexType[total];
+    DestroyPlan(Plan_dft(rank, n, in, out, sign, flags, threads, true));
+    delete[] in;
+    delete[] out;
+  }
+
+  /** Plan \c howmany equally sized transforms over contiguous batches:
+   * transform b reads from in + b * prod(n) and writes to
+   * out + b * halfTotal, where halfTotal is the half-hermitian size of
+   * one transform. A single Execute then runs the whole batch with one
+   * thread team, amortizing the per-call overhead of many small
+   * transforms. */
+  static PlanType
+  Plan_many_dft_r2c(int           rank,
+                    const int *   n,
+                    int           howmany,
+                    PixelType *   in,
+                    ComplexType * out,
+                    unsigned      flags,
+                    int           threads = 1,
+                    bool          canDestroyInput = false)
+  {
+#  ifndef ITK_USE_CUFFTW
+    std::lock_guard<FFTWGlobalConfiguration::MutexType> lock(FFTWGlobalConfiguration::GetLockMutex());
+    fftw_plan_with_nthreads(threads);
+#  else
+    (void)threads;
+#  endif
+    int total = 1;
+    for (int i = 0; i < rank; ++i)
+    {
+      total *= n[i];
+    }
+    const int halfTotal = total / n[rank - 1] * (n[rank - 1] / 2 + 1);
+    // don't add FFTW_WISDOM_ONLY if the plan rigor is FFTW_ESTIMATE
+    // because FFTW_ESTIMATE guarantee to not destroy the input
+    unsigned roflags = flags;
+    if (!(flags & FFTW_ESTIMATE))
+    {
+      roflags = flags | FFTW_WISDOM_ONLY;
+    }
+    PlanType plan =
+      fftw_plan_many_dft_r2c(rank, n, howmany, in, nullptr, 1, total, out, nullptr, 1, halfTotal, roflags);
+    if (plan == nullptr)
+    {
+      // no wisdom available for that plan
+      if (canDestroyInput)
+      {
+        // just create the plan
+        plan = fftw_plan_many_dft_r2c(rank, n, howmany, in, nullptr, 1, total, out, nullptr, 1, halfTotal, flags);
+      }
+      else
+      {
+        // lets create a plan with a fake input to generate the wisdom
+        auto * din = new PixelType[static_cast<size_t>(total) * howmany];
+        fftw_plan_many_dft_r2c(rank, n, howmany, din, nullptr, 1, total, out, nullptr, 1, halfTotal, flags);
+        delete[] din;
+        // and then create the final plan - this time it shouldn't fail
+        plan = fftw_plan_many_dft_r2c(rank, n, howmany, in, nullptr, 1, total, out, nullptr, 1, halfTotal, roflags);
+      }
+#  ifndef ITK_USE_CUFFTW
+      FFTWGlobalConfiguration::SetNewWisdomAvailable(true);
+#  endif
+    }
+    itkAssertOrThrowMacro(plan != nullptr, "PLAN_CREATION_FAILED ");
+    return plan;
+  }
+
+  /** Same as Plan_many_dft_r2c for the complex to real transform. */
+  static PlanType
+  Plan_many_dft_c2r(int           rank,
+                    const int *   n,
+                    int           howmany,
+                    ComplexType * in,
+                    PixelType *   out,
+                    unsigned      flags,
+                    int           threads = 1,
+                    bool          canDestroyInput = false)
+  {
+#  ifndef ITK_USE_CUFFTW
+    std::lock_guard<FFTWGlobalConfiguration::MutexType> lock(FFTWGlobalConfiguration::GetLockMutex());
+    fftw_plan_with_nthreads(threads);
+#  else
+    (void)threads;
+#  endif
+    int total = 1;
+    for (int i = 0; i < rank; ++i)
+    {
+      total *= n[i];
+    }
+    const int halfTotal = total / n[rank - 1] * (n[rank - 1] / 2 + 1);
+    // don't add FFTW_WISDOM_ONLY if the plan rigor is FFTW_ESTIMATE
+    // because FFTW_ESTIMATE guarantee to not destroy the input
+    unsigned roflags = flags;
+    if (!(flags & FFTW_ESTIMATE))
+    {
+      roflags = flags | FFTW_WISDOM_ONLY;
+    }
+    PlanType plan =
+      fftw_plan_many_dft_c2r(rank, n, howmany, in, nullptr, 1, halfTotal, out, nullptr, 1, total, roflags);
+    if (plan == nullptr)
+    {
+      // no wisdom available for that plan
+      if (canDestroyInput)
+      {
+        // just create the plan
+        plan = fftw_plan_many_dft_c2r(rank, n, howmany, in, nullptr, 1, halfTotal, out, nullptr, 1, total, flags);
+      }
+      else
+      {
+        // lets create a plan with a fake input to generate the wisdom
+        auto * din = new ComplexType[static_cast<size_t>(halfTotal) * howmany];
+        fftw_plan_many_dft_c2r(rank, n, howmany, din, nullptr, 1, halfTotal, out, nullptr, 1, total, flags);
+        delete[] din;
+        // and then create the final plan - this time it shouldn't fail
+        plan = fftw_plan_many_dft_c2r(rank, n, howmany, in, nullptr, 1, halfTotal, out, nullptr, 1, total, roflags);
+      }
+#  ifndef ITK_USE_CUFFTW
+      FFTWGlobalConfiguration::SetNewWisdomAvailable(true);
+#  endif
+    }
+    itkAssertOrThrowMacro(plan != nullptr, "PLAN_CREATION_FAILED ");
+    return plan;
+  }
 
   static void
   Execute(PlanType p)
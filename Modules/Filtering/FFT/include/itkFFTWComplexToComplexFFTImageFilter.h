@@ -125,6 +125,28 @@ public:
 #  endif
   }
 
+  /** Pre-create the FFTW plan for images of the given size and
+   * transform direction. FFTW caches plans process-wide as wisdom,
+   * keyed by the transform size, precision, direction and planner
+   * flags and shared across filter instances, so a later Update on an
+   * image of this size finds its plan ready instead of stalling in the
+   * planner, which can take hundreds of milliseconds per size with
+   * FFTW_MEASURE or above. Plan creation is serialized on the global
+   * FFTW lock, so this may be called from a background thread at
+   * application startup. This has no effect with ITK_USE_CUFFTW
+   * enabled.
+   *
+   * \sa FFTWGlobalConfiguration */
+  static void
+  PreplanTransform(const ImageSizeType & size, const typename Superclass::TransformDirectionEnum direction);
+
+  /** As above, with an explicit planner rigor flag instead of
+   * FFTWGlobalConfiguration::GetPlanRigor(). */
+  static void
+  PreplanTransform(const ImageSizeType &                             size,
+                   const typename Superclass::TransformDirectionEnum direction,
+                   const int                                         planRigor);
+
 protected:
   FFTWComplexToComplexFFTImageFilter();
   ~FFTWComplexToComplexFFTImageFilter() override = default;
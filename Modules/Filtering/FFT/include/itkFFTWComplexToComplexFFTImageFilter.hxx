@@ -21,8 +21,9 @@
 #include "itkFFTWComplexToComplexFFTImageFilter.h"
 #include "itkIndent.h"
 #include "itkMetaDataObject.h"
-#include "itkImageRegionIterator.h"
+#include "itkImageScanlineIterator.h"
 #include "itkProgressReporter.h"
+#include "itkMultiThreaderBase.h"
 
 
 /*
@@ -110,20 +111,68 @@ FFTWComplexToComplexFFTImageFilter<TImage>::DynamicThreadedGenerateData(
   // Normalize the output if backward transform
   if (this->GetTransformDirection() == Superclass::TransformDirectionEnum::INVERSE)
   {
-    using IteratorType = ImageRegionIterator<OutputImageType>;
+    using IteratorType = ImageScanlineIterator<OutputImageType>;
     SizeValueType totalOutputSize = this->GetOutput()->GetRequestedRegion().GetNumberOfPixels();
     IteratorType  it(this->GetOutput(), outputRegionForThread);
     while (!it.IsAtEnd())
     {
-      PixelType val = it.Value();
-      val /= totalOutputSize;
-      it.Set(val);
-      ++it;
+      while (!it.IsAtEndOfLine())
+      {
+        PixelType val = it.Value();
+        val /= totalOutputSize;
+        it.Set(val);
+        ++it;
+      }
+      it.NextLine();
     }
   }
 }
 
 
+template <typename TImage>
+void
+FFTWComplexToComplexFFTImageFilter<TImage>::PreplanTransform(const ImageSizeType & size,
+                                                             const typename Superclass::TransformDirectionEnum direction)
+{
+#ifndef ITK_USE_CUFFTW
+  Self::PreplanTransform(size, direction, FFTWGlobalConfiguration::GetPlanRigor());
+#else
+  (void)size;
+  (void)direction;
+#endif
+}
+
+template <typename TImage>
+void
+FFTWComplexToComplexFFTImageFilter<TImage>::PreplanTransform(const ImageSizeType & size,
+                                                             const typename Superclass::TransformDirectionEnum direction,
+                                                             const int planRigor)
+{
+#ifndef ITK_USE_CUFFTW
+  int transformDirection = 1;
+  if (direction == Superclass::TransformDirectionEnum::INVERSE)
+  {
+    transformDirection = -1;
+  }
+  int sizes[ImageDimension];
+  for (unsigned int i = 0; i < ImageDimension; ++i)
+  {
+    sizes[(ImageDimension - 1) - i] = size[i];
+  }
+  // Match the flags GenerateData uses when the input is not released,
+  // which is the common case.
+  FFTWProxyType::Preplan_dft(ImageDimension,
+                             sizes,
+                             transformDirection,
+                             planRigor | FFTW_PRESERVE_INPUT,
+                             MultiThreaderBase::GetGlobalDefaultNumberOfThreads());
+#else
+  (void)size;
+  (void)direction;
+  (void)planRigor;
+#endif
+}
+
 template <typename TImage>
 void
 FFTWComplexToComplexFFTImageFilter<TImage>::UpdateOutputData(DataObject * output)
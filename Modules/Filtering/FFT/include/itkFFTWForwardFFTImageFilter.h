@@ -114,6 +114,26 @@ public:
   SizeValueType
   GetSizeGreatestPrimeFactor() const override;
 
+  /** Pre-create the FFTW plan for input images whose largest possible
+   * region has the given size. FFTW caches plans process-wide as
+   * wisdom, keyed by the transform size, precision and planner flags
+   * and shared across filter instances, so a later Update on an image
+   * of this size finds its plan ready instead of stalling in the
+   * planner, which can take hundreds of milliseconds per size with
+   * FFTW_MEASURE or above. Plan creation is serialized on the global
+   * FFTW lock, so this may be called from a background thread at
+   * application startup. This has no effect with ITK_USE_CUFFTW
+   * enabled.
+   *
+   * \sa FFTWGlobalConfiguration */
+  static void
+  PreplanTransform(const InputSizeType & size);
+
+  /** As above, with an explicit planner rigor flag instead of
+   * FFTWGlobalConfiguration::GetPlanRigor(). */
+  static void
+  PreplanTransform(const InputSizeType & size, const int planRigor);
+
 protected:
   FFTWForwardFFTImageFilter();
   ~FFTWForwardFFTImageFilter() override = default;
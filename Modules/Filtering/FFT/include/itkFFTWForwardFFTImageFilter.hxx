@@ -128,6 +128,39 @@ FFTWForwardFFTImageFilter<TInputImage, TOutputImage>::GenerateData()
   this->GraftOutput(halfToFullFilter->GetOutput());
 }
 
+template <typename TInputImage, typename TOutputImage>
+void
+FFTWForwardFFTImageFilter<TInputImage, TOutputImage>::PreplanTransform(const InputSizeType & size)
+{
+#ifndef ITK_USE_CUFFTW
+  Self::PreplanTransform(size, FFTWGlobalConfiguration::GetPlanRigor());
+#else
+  (void)size;
+#endif
+}
+
+template <typename TInputImage, typename TOutputImage>
+void
+FFTWForwardFFTImageFilter<TInputImage, TOutputImage>::PreplanTransform(const InputSizeType & size, const int planRigor)
+{
+#ifndef ITK_USE_CUFFTW
+  int sizes[ImageDimension];
+  for (unsigned int i = 0; i < ImageDimension; ++i)
+  {
+    sizes[(ImageDimension - 1) - i] = size[i];
+  }
+  // Match the flags GenerateData uses when the input is not released,
+  // which is the common case.
+  FFTWProxyType::Preplan_dft_r2c(ImageDimension,
+                                 sizes,
+                                 planRigor | FFTW_PRESERVE_INPUT,
+                                 MultiThreaderBase::GetGlobalDefaultNumberOfThreads());
+#else
+  (void)size;
+  (void)planRigor;
+#endif
+}
+
 template <typename TInputImage, typename TOutputImage>
 void
 FFTWForwardFFTImageFilter<TInputImage, TOutputImage>::UpdateOutputData(DataObject * output)
@@ -19,10 +19,13 @@
 #define itkFFTWHalfHermitianToRealInverseFFTImageFilter_hxx
 
 #include "itkFFTWHalfHermitianToRealInverseFFTImageFilter.h"
-#include "itkImageRegionIterator.h"
+#include "itkImageScanlineIterator.h"
 #include "itkProgressReporter.h"
 #include "itkMultiThreaderBase.h"
 
+#include <cstring>
+#include <memory>
+
 namespace itk
 {
 
@@ -129,13 +132,137 @@ void
 FFTWHalfHermitianToRealInverseFFTImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(
   const OutputRegionType & outputRegionForThread)
 {
-  using IteratorType = ImageRegionIterator<OutputImageType>;
+  using IteratorType = ImageScanlineIterator<OutputImageType>;
   unsigned long totalOutputSize = this->GetOutput()->GetRequestedRegion().GetNumberOfPixels();
   IteratorType  it(this->GetOutput(), outputRegionForThread);
   while (!it.IsAtEnd())
   {
-    it.Set(it.Value() / totalOutputSize);
-    ++it;
+    while (!it.IsAtEndOfLine())
+    {
+      it.Set(it.Value() / totalOutputSize);
+      ++it;
+    }
+    it.NextLine();
+  }
+}
+
+template <typename TInputImage, typename TOutputImage>
+void
+FFTWHalfHermitianToRealInverseFFTImageFilter<TInputImage, TOutputImage>::PreplanTransform(const OutputSizeType & size)
+{
+#ifndef ITK_USE_CUFFTW
+  Self::PreplanTransform(size, FFTWGlobalConfiguration::GetPlanRigor());
+#else
+  (void)size;
+#endif
+}
+
+template <typename TInputImage, typename TOutputImage>
+void
+FFTWHalfHermitianToRealInverseFFTImageFilter<TInputImage, TOutputImage>::PreplanTransform(const OutputSizeType & size,
+                                                                                          const int planRigor)
+{
+#ifndef ITK_USE_CUFFTW
+  int sizes[ImageDimension];
+  for (unsigned int i = 0; i < ImageDimension; ++i)
+  {
+    sizes[(ImageDimension - 1) - i] = size[i];
+  }
+  FFTWProxyType::Preplan_dft_c2r(
+    ImageDimension, sizes, planRigor, MultiThreaderBase::GetGlobalDefaultNumberOfThreads());
+#else
+  (void)size;
+  (void)planRigor;
+#endif
+}
+
+template <typename TInputImage, typename TOutputImage>
+void
+FFTWHalfHermitianToRealInverseFFTImageFilter<TInputImage, TOutputImage>::TransformBatch(
+  const std::vector<typename InputImageType::ConstPointer> & inputImages,
+  std::vector<typename OutputImageType::Pointer> &           outputImages,
+  bool                                                       actualXDimensionIsOdd)
+{
+  outputImages.clear();
+  if (inputImages.empty())
+  {
+    return;
+  }
+
+  const typename InputImageType::RegionType inputRegion = inputImages[0]->GetLargestPossibleRegion();
+  const InputSizeType                       inputSize = inputRegion.GetSize();
+  for (const auto & inputImage : inputImages)
+  {
+    if (inputImage->GetLargestPossibleRegion().GetSize() != inputSize)
+    {
+      itkGenericExceptionMacro(<< "All images in a batch must have the same size, found "
+                               << inputImage->GetLargestPossibleRegion().GetSize() << " and " << inputSize);
+    }
+  }
+
+  OutputSizeType outputSize = inputSize;
+  outputSize[0] = 2 * (inputSize[0] - 1) + (actualXDimensionIsOdd ? 1 : 0);
+
+  unsigned int totalInputSize = 1;
+  unsigned int totalOutputSize = 1;
+  int          sizes[ImageDimension];
+  for (unsigned int i = 0; i < ImageDimension; ++i)
+  {
+    totalInputSize *= inputSize[i];
+    totalOutputSize *= outputSize[i];
+    sizes[(ImageDimension - 1) - i] = outputSize[i];
+  }
+  const auto howmany = static_cast<int>(inputImages.size());
+
+  // Stage the batch in contiguous buffers: FFTW's advanced interface
+  // requires a fixed distance between consecutive transforms, which
+  // the separately allocated image buffers do not provide. The staging
+  // buffer is also what lets FFTW destroy its input, which the
+  // complex-to-real transform requires for multidimensional images.
+  const auto in =
+    std::make_unique<typename FFTWProxyType::ComplexType[]>(static_cast<size_t>(totalInputSize) * howmany);
+  const auto out = std::make_unique<OutputPixelType[]>(static_cast<size_t>(totalOutputSize) * howmany);
+  for (int b = 0; b < howmany; ++b)
+  {
+    std::memcpy(in.get() + static_cast<size_t>(b) * totalInputSize,
+                inputImages[b]->GetBufferPointer(),
+                static_cast<size_t>(totalInputSize) * sizeof(typename FFTWProxyType::ComplexType));
+  }
+
+#ifndef ITK_USE_CUFFTW
+  const int planRigor = FFTWGlobalConfiguration::GetPlanRigor();
+#else
+  const int planRigor = FFTW_ESTIMATE;
+#endif
+  typename FFTWProxyType::PlanType plan =
+    FFTWProxyType::Plan_many_dft_c2r(ImageDimension,
+                                     sizes,
+                                     howmany,
+                                     in.get(),
+                                     out.get(),
+                                     planRigor,
+                                     MultiThreaderBase::GetGlobalDefaultNumberOfThreads(),
+                                     true);
+  FFTWProxyType::Execute(plan);
+  FFTWProxyType::DestroyPlan(plan);
+
+  typename OutputImageType::RegionType outputRegion = inputRegion;
+  outputRegion.SetSize(0, outputSize[0]);
+
+  outputImages.reserve(howmany);
+  for (int b = 0; b < howmany; ++b)
+  {
+    auto outputImage = OutputImageType::New();
+    outputImage->CopyInformation(inputImages[b]);
+    outputImage->SetRegions(outputRegion);
+    outputImage->Allocate();
+    OutputPixelType *       outputBuffer = outputImage->GetBufferPointer();
+    const OutputPixelType * batchBuffer = out.get() + static_cast<size_t>(b) * totalOutputSize;
+    for (unsigned int p = 0; p < totalOutputSize; ++p)
+    {
+      outputBuffer[p] = batchBuffer[p] / totalOutputSize;
+    }
+    outputImages.push_back(outputImage);
   }
 }
 
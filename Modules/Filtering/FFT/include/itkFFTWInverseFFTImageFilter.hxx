@@ -21,7 +21,7 @@
 #include "itkFullToHalfHermitianImageFilter.h"
 #include "itkFFTWInverseFFTImageFilter.h"
 
-#include "itkImageRegionIterator.h"
+#include "itkImageScanlineIterator.h"
 #include "itkProgressReporter.h"
 #include "itkMultiThreaderBase.h"
 
@@ -100,18 +100,52 @@ FFTWInverseFFTImageFilter<TInputImage, TOutputImage>::BeforeThreadedGenerateData
   FFTWProxyType::DestroyPlan(plan);
 }
 
+template <typename TInputImage, typename TOutputImage>
+void
+FFTWInverseFFTImageFilter<TInputImage, TOutputImage>::PreplanTransform(const OutputSizeType & size)
+{
+#ifndef ITK_USE_CUFFTW
+  Self::PreplanTransform(size, FFTWGlobalConfiguration::GetPlanRigor());
+#else
+  (void)size;
+#endif
+}
+
+template <typename TInputImage, typename TOutputImage>
+void
+FFTWInverseFFTImageFilter<TInputImage, TOutputImage>::PreplanTransform(const OutputSizeType & size,
+                                                                       const int              planRigor)
+{
+#ifndef ITK_USE_CUFFTW
+  int sizes[ImageDimension];
+  for (unsigned int i = 0; i < ImageDimension; ++i)
+  {
+    sizes[(ImageDimension - 1) - i] = size[i];
+  }
+  FFTWProxyType::Preplan_dft_c2r(
+    ImageDimension, sizes, planRigor, MultiThreaderBase::GetGlobalDefaultNumberOfThreads());
+#else
+  (void)size;
+  (void)planRigor;
+#endif
+}
+
 template <typename TInputImage, typename TOutputImage>
 void
 FFTWInverseFFTImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(
   const OutputImageRegionType & outputRegionForThread)
 {
-  using IteratorType = ImageRegionIterator<OutputImageType>;
+  using IteratorType = ImageScanlineIterator<OutputImageType>;
   unsigned long totalOutputSize = this->GetOutput()->GetRequestedRegion().GetNumberOfPixels();
   IteratorType  it(this->GetOutput(), outputRegionForThread);
   while (!it.IsAtEnd())
   {
-    it.Set(it.Value() / totalOutputSize);
-    ++it;
+    while (!it.IsAtEndOfLine())
+    {
+      it.Set(it.Value() / totalOutputSize);
+      ++it;
+    }
+    it.NextLine();
   }
 }
 
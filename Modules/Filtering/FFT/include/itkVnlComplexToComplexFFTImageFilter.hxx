@@ -21,7 +21,7 @@
 #include "itkVnlComplexToComplexFFTImageFilter.h"
 #include "itkProgressReporter.h"
 #include "itkVnlFFTCommon.h"
-#include "itkImageRegionIteratorWithIndex.h"
+#include "itkImageScanlineIterator.h"
 #include "itkImageAlgorithm.h"
 
 
@@ -83,15 +83,19 @@ VnlComplexToComplexFFTImageFilter<TImage>::DynamicThreadedGenerateData(
   // Normalize the output if backward transform
   if (this->GetTransformDirection() == Superclass::TransformDirectionEnum::INVERSE)
   {
-    using IteratorType = ImageRegionIterator<OutputImageType>;
+    using IteratorType = ImageScanlineIterator<OutputImageType>;
     SizeValueType totalOutputSize = this->GetOutput()->GetRequestedRegion().GetNumberOfPixels();
     IteratorType  it(this->GetOutput(), outputRegionForThread);
     while (!it.IsAtEnd())
     {
-      PixelType val = it.Value();
-      val /= totalOutputSize;
-      it.Set(val);
-      ++it;
+      while (!it.IsAtEndOfLine())
+      {
+        PixelType val = it.Value();
+        val /= totalOutputSize;
+        it.Set(val);
+        ++it;
+      }
+      it.NextLine();
     }
   }
 }
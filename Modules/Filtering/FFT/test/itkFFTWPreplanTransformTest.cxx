@@ -0,0 +1,98 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkFFTWForwardFFTImageFilter.h"
+#include "itkFFTWInverseFFTImageFilter.h"
+#include "itkFFTWRealToHalfHermitianForwardFFTImageFilter.h"
+#include "itkFFTWHalfHermitianToRealInverseFFTImageFilter.h"
+#include "itkFFTWComplexToComplexFFTImageFilter.h"
+#include "itkImageRegionIterator.h"
+#include "itkMath.h"
+#include "itkTestingMacros.h"
+
+// Exercises the plan-ahead API of the FFTW filters: pre-creating plans
+// for a declared size before the first Update must leave the planner's
+// wisdom behind and must not change the transform results.
+int
+itkFFTWPreplanTransformTest(int, char *[])
+{
+  using PixelType = float;
+  using ImageType = itk::Image<PixelType, 2>;
+  using ComplexImageType = itk::Image<std::complex<PixelType>, 2>;
+
+  ImageType::SizeType size;
+  size[0] = 24;
+  size[1] = 16;
+
+  // Pre-create the plans for the declared size. Afterwards, plan
+  // creation inside the filters below is a wisdom lookup.
+  using ForwardFilterType = itk::FFTWForwardFFTImageFilter<ImageType>;
+  using InverseFilterType = itk::FFTWInverseFFTImageFilter<ComplexImageType, ImageType>;
+  using RealForwardFilterType = itk::FFTWRealToHalfHermitianForwardFFTImageFilter<ImageType>;
+  using RealInverseFilterType = itk::FFTWHalfHermitianToRealInverseFFTImageFilter<ComplexImageType, ImageType>;
+  using ComplexFilterType = itk::FFTWComplexToComplexFFTImageFilter<ComplexImageType>;
+
+  ITK_TRY_EXPECT_NO_EXCEPTION(ForwardFilterType::PreplanTransform(size));
+  ITK_TRY_EXPECT_NO_EXCEPTION(InverseFilterType::PreplanTransform(size));
+  ITK_TRY_EXPECT_NO_EXCEPTION(RealForwardFilterType::PreplanTransform(size));
+  ITK_TRY_EXPECT_NO_EXCEPTION(RealInverseFilterType::PreplanTransform(size));
+  ITK_TRY_EXPECT_NO_EXCEPTION(
+    ComplexFilterType::PreplanTransform(size, ComplexFilterType::TransformDirectionEnum::FORWARD));
+  ITK_TRY_EXPECT_NO_EXCEPTION(
+    ComplexFilterType::PreplanTransform(size, ComplexFilterType::TransformDirectionEnum::INVERSE, FFTW_ESTIMATE));
+
+  // A forward / inverse round trip on an image of the declared size
+  // must still reproduce the input.
+  auto input = ImageType::New();
+  input->SetRegions(size);
+  input->Allocate();
+  itk::ImageRegionIterator<ImageType> it(input, input->GetLargestPossibleRegion());
+  unsigned int                        counter = 0;
+  while (!it.IsAtEnd())
+  {
+    it.Set(static_cast<PixelType>(counter % 97));
+    ++counter;
+    ++it;
+  }
+
+  auto forwardFilter = ForwardFilterType::New();
+  forwardFilter->SetInput(input);
+
+  auto inverseFilter = InverseFilterType::New();
+  inverseFilter->SetInput(forwardFilter->GetOutput());
+
+  ITK_TRY_EXPECT_NO_EXCEPTION(inverseFilter->Update());
+
+  itk::ImageRegionIterator<ImageType> inIt(input, input->GetLargestPossibleRegion());
+  itk::ImageRegionIterator<ImageType> outIt(inverseFilter->GetOutput(),
+                                            inverseFilter->GetOutput()->GetLargestPossibleRegion());
+  while (!inIt.IsAtEnd())
+  {
+    if (itk::Math::abs(inIt.Get() - outIt.Get()) > 0.01)
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "Round trip value " << outIt.Get() << " differs from input value " << inIt.Get() << std::endl;
+      return EXIT_FAILURE;
+    }
+    ++inIt;
+    ++outIt;
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,139 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkFFTWRealToHalfHermitianForwardFFTImageFilter.h"
+#include "itkFFTWHalfHermitianToRealInverseFFTImageFilter.h"
+#include "itkImageRegionIterator.h"
+#include "itkMath.h"
+#include "itkTestingMacros.h"
+
+#include <vector>
+
+// Exercises the batched transform API of the FFTW half-hermitian
+// filters: a batch of equally sized images transformed in one call
+// must produce the same results as running the corresponding filter
+// once per image, and a forward / inverse batch round trip must
+// reproduce the inputs.
+int
+itkFFTWTransformBatchTest(int, char *[])
+{
+  using PixelType = float;
+  using ImageType = itk::Image<PixelType, 2>;
+  using ComplexImageType = itk::Image<std::complex<PixelType>, 2>;
+  using ForwardFilterType = itk::FFTWRealToHalfHermitianForwardFFTImageFilter<ImageType>;
+  using InverseFilterType = itk::FFTWHalfHermitianToRealInverseFFTImageFilter<ComplexImageType, ImageType>;
+
+  // An odd size along the fastest dimension exercises the
+  // actualXDimensionIsOdd argument of the inverse batch.
+  ImageType::SizeType size;
+  size[0] = 13;
+  size[1] = 8;
+
+  constexpr unsigned int numberOfImages = 3;
+
+  std::vector<ImageType::ConstPointer> inputs;
+  for (unsigned int i = 0; i < numberOfImages; ++i)
+  {
+    auto input = ImageType::New();
+    input->SetRegions(size);
+    input->Allocate();
+    itk::ImageRegionIterator<ImageType> it(input, input->GetLargestPossibleRegion());
+    unsigned int                        counter = i;
+    while (!it.IsAtEnd())
+    {
+      it.Set(static_cast<PixelType>(counter % 97));
+      counter += i + 1;
+      ++it;
+    }
+    inputs.push_back(input);
+  }
+
+  // Transform the batch in one call.
+  std::vector<ComplexImageType::Pointer> batchTransforms;
+  ITK_TRY_EXPECT_NO_EXCEPTION(ForwardFilterType::TransformBatch(inputs, batchTransforms));
+  ITK_TEST_EXPECT_EQUAL(batchTransforms.size(), inputs.size());
+
+  // Mismatched sizes in a batch must be rejected.
+  {
+    auto small = ImageType::New();
+    small->SetRegions(ImageType::SizeType::Filled(4));
+    small->Allocate(true);
+    std::vector<ImageType::ConstPointer>   badInputs = inputs;
+    std::vector<ComplexImageType::Pointer> badOutputs;
+    badInputs.push_back(small);
+    ITK_TRY_EXPECT_EXCEPTION(ForwardFilterType::TransformBatch(badInputs, badOutputs));
+  }
+
+  // Each batch member must match a per-image filter run.
+  for (unsigned int i = 0; i < numberOfImages; ++i)
+  {
+    auto forwardFilter = ForwardFilterType::New();
+    forwardFilter->SetInput(inputs[i]);
+    ITK_TRY_EXPECT_NO_EXCEPTION(forwardFilter->Update());
+
+    ITK_TEST_EXPECT_TRUE(batchTransforms[i]->GetLargestPossibleRegion() ==
+                         forwardFilter->GetOutput()->GetLargestPossibleRegion());
+
+    itk::ImageRegionIterator<ComplexImageType> batchIt(batchTransforms[i],
+                                                       batchTransforms[i]->GetLargestPossibleRegion());
+    itk::ImageRegionIterator<ComplexImageType> filterIt(forwardFilter->GetOutput(),
+                                                        forwardFilter->GetOutput()->GetLargestPossibleRegion());
+    while (!batchIt.IsAtEnd())
+    {
+      if (itk::Math::abs(batchIt.Get().real() - filterIt.Get().real()) > 0.01 ||
+          itk::Math::abs(batchIt.Get().imag() - filterIt.Get().imag()) > 0.01)
+      {
+        std::cerr << "Test failed!" << std::endl;
+        std::cerr << "Batch value " << batchIt.Get() << " differs from filter value " << filterIt.Get()
+                  << " in image " << i << std::endl;
+        return EXIT_FAILURE;
+      }
+      ++batchIt;
+      ++filterIt;
+    }
+  }
+
+  // An inverse batch on the forward batch must reproduce the inputs.
+  std::vector<ComplexImageType::ConstPointer> constTransforms(batchTransforms.begin(), batchTransforms.end());
+  std::vector<ImageType::Pointer>             roundTrips;
+  ITK_TRY_EXPECT_NO_EXCEPTION(InverseFilterType::TransformBatch(constTransforms, roundTrips, size[0] % 2 != 0));
+  ITK_TEST_EXPECT_EQUAL(roundTrips.size(), inputs.size());
+
+  for (unsigned int i = 0; i < numberOfImages; ++i)
+  {
+    ITK_TEST_EXPECT_TRUE(roundTrips[i]->GetLargestPossibleRegion() == inputs[i]->GetLargestPossibleRegion());
+
+    itk::ImageRegionConstIterator<ImageType> inIt(inputs[i], inputs[i]->GetLargestPossibleRegion());
+    itk::ImageRegionIterator<ImageType>      outIt(roundTrips[i], roundTrips[i]->GetLargestPossibleRegion());
+    while (!inIt.IsAtEnd())
+    {
+      if (itk::Math::abs(inIt.Get() - outIt.Get()) > 0.01)
+      {
+        std::cerr << "Test failed!" << std::endl;
+        std::cerr << "Round trip value " << outIt.Get() << " differs from input value " << inIt.Get() << " in image "
+                  << i << std::endl;
+        return EXIT_FAILURE;
+      }
+      ++inIt;
+      ++outIt;
+    }
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -26,6 +26,7 @@
 
 #include <queue>
 #include <functional>
+#include <vector>
 
 namespace itk
 {
@@ -69,6 +70,15 @@ extern ITKFastMarching_EXPORT std::ostream &
  * Fast Marching sweeps through N points in (N log N) steps to obtain
  * the arrival time value as the front propagates through the domain.
  *
+ * Alternatively, UseBucketQueueOn() replaces the binary heap by a Dial
+ * bucket queue (the "untidy priority queue" of the level set literature)
+ * whose operations are all constant time, dropping the overall complexity
+ * to O(N). Arrival times are quantized into buckets of BucketWidth: nodes
+ * of a same bucket are processed in arbitrary order, so the computed
+ * times can differ from the heap-based ones by a few BucketWidth. The
+ * buckets are allocated lazily as the front advances, so the far field
+ * beyond the stopping criterion is never touched.
+ *
  * The initial front is specified by two containers:
  * \li one containing the known nodes (Alive Nodes: nodes that are already
  * part of the object),
@@ -230,6 +240,21 @@ public:
   itkGetConstReferenceMacro(CollectPoints, bool);
   itkBooleanMacro(CollectPoints);
 
+  /** Set/Get whether trial nodes are kept in a Dial bucket queue with
+   * quantized arrival times instead of a binary heap. Requires a positive
+   * BucketWidth. Default is off. */
+  itkSetMacro(UseBucketQueue, bool);
+  itkGetConstReferenceMacro(UseBucketQueue, bool);
+  itkBooleanMacro(UseBucketQueue);
+
+  /** Set/Get the arrival time quantum of the bucket queue. Nodes whose
+   * arrival times fall in the same bucket of this width are processed in
+   * arbitrary order, which bounds the deviation from the heap-based
+   * solution. A value around the arrival time step between neighbor nodes
+   * keeps the error of the order of the discretization error. */
+  itkSetMacro(BucketWidth, double);
+  itkGetConstReferenceMacro(BucketWidth, double);
+
 protected:
   /** \brief Constructor */
   FastMarchingBase();
@@ -262,6 +287,38 @@ protected:
 
   PriorityQueueType m_Heap;
 
+  /** Dial bucket queue used instead of m_Heap when UseBucketQueue is on.
+   * Bucket i holds the nodes whose arrival time falls in
+   * [ i * BucketWidth, ( i + 1 ) * BucketWidth ). Buckets are allocated
+   * lazily as the front advances and released once the front has passed
+   * them. */
+  using BucketType = std::vector<NodePairType>;
+  using BucketQueueType = std::vector<BucketType>;
+
+  bool   m_UseBucketQueue;
+  double m_BucketWidth;
+
+  BucketQueueType m_BucketQueue;
+  SizeValueType   m_BucketNodeCount;
+  SizeValueType   m_CurrentBucket;
+
+  /** \brief Push a trial node on the active queue (heap or bucket queue) */
+  void
+  PushNode(const NodePairType & iNodePair);
+
+  /** \brief Pop the trial node with the smallest arrival time. The queue
+   * must not be empty. */
+  NodePairType
+  PopNode();
+
+  /** \brief Check whether the active queue has no node left */
+  bool
+  QueueIsEmpty() const;
+
+  /** \brief Empty the active queue and release its memory */
+  void
+  ClearQueue();
+
   TopologyCheckEnum m_TopologyCheck;
 
   /** \brief Get the total number of nodes in the domain */
@@ -47,6 +47,10 @@ FastMarchingBase<TInput, TOutput>::FastMarchingBase()
   m_LargeValue = NumericTraits<OutputPixelType>::max();
   m_TopologyValue = m_LargeValue;
   m_CollectPoints = false;
+  m_UseBucketQueue = false;
+  m_BucketWidth = 0.;
+  m_BucketNodeCount = 0;
+  m_CurrentBucket = 0;
 }
 // -----------------------------------------------------------------------------
 
@@ -59,6 +63,92 @@ FastMarchingBase<TInput, TOutput>::PrintSelf(std::ostream & os, Indent indent) c
   os << indent << "Speed constant: " << m_SpeedConstant << std::endl;
   os << indent << "Topology check: " << m_TopologyCheck << std::endl;
   os << indent << "Normalization Factor: " << m_NormalizationFactor << std::endl;
+  os << indent << "Use bucket queue: " << m_UseBucketQueue << std::endl;
+  os << indent << "Bucket width: " << m_BucketWidth << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+template <typename TInput, typename TOutput>
+void
+FastMarchingBase<TInput, TOutput>::PushNode(const NodePairType & iNodePair)
+{
+  if (m_UseBucketQueue)
+  {
+    auto bucket = static_cast<SizeValueType>(static_cast<double>(iNodePair.GetValue()) / m_BucketWidth);
+
+    // An improved trial value can fall in a bucket the front has already
+    // passed; process it with the current bucket, which stays within the
+    // quantization error.
+    if (bucket < m_CurrentBucket)
+    {
+      bucket = m_CurrentBucket;
+    }
+    if (bucket >= m_BucketQueue.size())
+    {
+      m_BucketQueue.resize(bucket + 1);
+    }
+    m_BucketQueue[bucket].push_back(iNodePair);
+    ++m_BucketNodeCount;
+  }
+  else
+  {
+    m_Heap.push(iNodePair);
+  }
+}
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+template <typename TInput, typename TOutput>
+typename FastMarchingBase<TInput, TOutput>::NodePairType
+FastMarchingBase<TInput, TOutput>::PopNode()
+{
+  if (m_UseBucketQueue)
+  {
+    while (m_BucketQueue[m_CurrentBucket].empty())
+    {
+      // release the memory of the buckets the front has passed
+      BucketType().swap(m_BucketQueue[m_CurrentBucket]);
+      ++m_CurrentBucket;
+    }
+    NodePairType nodePair = m_BucketQueue[m_CurrentBucket].back();
+    m_BucketQueue[m_CurrentBucket].pop_back();
+    --m_BucketNodeCount;
+    return nodePair;
+  }
+
+  NodePairType nodePair = m_Heap.top();
+  m_Heap.pop();
+  return nodePair;
+}
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+template <typename TInput, typename TOutput>
+bool
+FastMarchingBase<TInput, TOutput>::QueueIsEmpty() const
+{
+  if (m_UseBucketQueue)
+  {
+    return m_BucketNodeCount == 0;
+  }
+  return m_Heap.empty();
+}
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+template <typename TInput, typename TOutput>
+void
+FastMarchingBase<TInput, TOutput>::ClearQueue()
+{
+  while (!m_Heap.empty())
+  {
+    m_Heap.pop();
+  }
+  BucketQueueType().swap(m_BucketQueue);
+  m_BucketNodeCount = 0;
+  m_CurrentBucket = 0;
 }
 
 // -----------------------------------------------------------------------------
@@ -84,6 +174,10 @@ FastMarchingBase<TInput, TOutput>::Initialize(OutputDomainType * oDomain)
   {
     itkExceptionMacro(<< "SpeedConstant is null or negative");
   }
+  if (m_UseBucketQueue && m_BucketWidth < itk::Math::eps)
+  {
+    itkExceptionMacro(<< "Bucket width is null or negative");
+  }
   if (m_CollectPoints)
   {
     if (m_ProcessedPoints.IsNull())
@@ -92,11 +186,8 @@ FastMarchingBase<TInput, TOutput>::Initialize(OutputDomainType * oDomain)
     }
   }
 
-  // make sure the heap is empty
-  while (!m_Heap.empty())
-  {
-    m_Heap.pop();
-  }
+  // make sure the queue is empty
+  this->ClearQueue();
   /*
   while ( !m_Heap->Empty() )
     {
@@ -130,7 +221,7 @@ FastMarchingBase<TInput, TOutput>::GenerateData()
   try
   {
     // while( !m_Heap->Empty() )
-    while (!m_Heap.empty())
+    while (!this->QueueIsEmpty())
     {
       // PriorityQueueElementType element = m_Heap->Peek();
       // m_Heap->Pop();
@@ -139,8 +230,7 @@ FastMarchingBase<TInput, TOutput>::GenerateData()
       // OutputPixelType current_value = element.m_Priority;
 
 
-      NodePairType current_node_pair = m_Heap.top();
-      m_Heap.pop();
+      NodePairType current_node_pair = this->PopNode();
 
       NodeType current_node = current_node_pair.GetNode();
       current_value = this->GetOutputValue(output, current_node);
@@ -183,10 +273,7 @@ FastMarchingBase<TInput, TOutput>::GenerateData()
     // it.
     //
     // RELEASE MEMORY!!!
-    while (!m_Heap.empty())
-    {
-      m_Heap.pop();
-    }
+    this->ClearQueue();
     /*while( !m_Heap->Empty() )
       {
       m_Heap->Pop();
@@ -198,10 +285,7 @@ FastMarchingBase<TInput, TOutput>::GenerateData()
   m_TargetReachedValue = current_value;
 
   // let's release some useless memory...
-  while (!m_Heap.empty())
-  {
-    m_Heap.pop();
-  }
+  this->ClearQueue();
   /*while( !m_Heap->Empty() )
     {
     m_Heap->Pop();
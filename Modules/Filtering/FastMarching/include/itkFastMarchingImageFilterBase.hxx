@@ -200,7 +200,7 @@ FastMarchingImageFilterBase<TInput, TOutput>::UpdateValue(OutputImageType * oIma
     this->SetLabelValueForGivenNode(iNode, Traits::Trial);
 
     // Insert point into trial heap
-    this->m_Heap.push(NodePairType(iNode, outputPixel));
+    this->PushNode(NodePairType(iNode, outputPixel));
   }
 }
 
@@ -566,7 +566,7 @@ FastMarchingImageFilterBase<TInput, TOutput>::InitializeOutput(OutputImageType *
         this->SetOutputValue(oImage, idx, outputPixel);
 
         // this->m_Heap->Push( PriorityQueueElementType( idx, pointsIter->second ) );
-        this->m_Heap.push(pointsIter->Value());
+        this->PushNode(pointsIter->Value());
       }
       ++pointsIter;
     }
@@ -0,0 +1,114 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkFastMarchingImageFilterBase.h"
+#include "itkFastMarchingThresholdStoppingCriterion.h"
+#include "itkImageRegionConstIteratorWithIndex.h"
+#include "itkTestingMacros.h"
+
+#include <algorithm>
+
+int
+itkFastMarchingImageFilterBaseBucketQueueTest(int itkNotUsed(argc), char * itkNotUsed(argv)[])
+{
+  using PixelType = float;
+  constexpr unsigned int Dimension = 2;
+
+  using FloatImageType = itk::Image<PixelType, Dimension>;
+  using CriterionType = itk::FastMarchingThresholdStoppingCriterion<FloatImageType, FloatImageType>;
+  using FastMarchingType = itk::FastMarchingImageFilterBase<FloatImageType, FloatImageType>;
+  using NodePairType = FastMarchingType::NodePairType;
+  using NodePairContainerType = FastMarchingType::NodePairContainerType;
+
+  constexpr double threshold = 25.;
+  constexpr double bucketWidth = 0.05;
+
+  FloatImageType::SizeType size = { { 64, 64 } };
+
+  // Set up a speed image of ones
+  auto speedImage = FloatImageType::New();
+  speedImage->SetRegions(size);
+  speedImage->Allocate();
+  speedImage->FillBuffer(1.0f);
+
+  // A single trial seed in the middle of the image
+  auto         seeds = NodePairContainerType::New();
+  NodePairType node_pair;
+  node_pair.SetValue(0.0);
+  node_pair.SetNode({ { 32, 32 } });
+  seeds->push_back(node_pair);
+
+  // Reference: the default heap based front
+  auto criterion = CriterionType::New();
+  criterion->SetThreshold(threshold);
+
+  auto marcher = FastMarchingType::New();
+  marcher->SetInput(speedImage);
+  marcher->SetTrialPoints(seeds);
+  marcher->SetOutputSize(size);
+  marcher->SetStoppingCriterion(criterion);
+  ITK_TRY_EXPECT_NO_EXCEPTION(marcher->Update());
+
+  auto bucketMarcher = FastMarchingType::New();
+  bucketMarcher->SetInput(speedImage);
+  bucketMarcher->SetTrialPoints(seeds);
+  bucketMarcher->SetOutputSize(size);
+  bucketMarcher->SetStoppingCriterion(criterion);
+  bucketMarcher->UseBucketQueueOn();
+  ITK_TEST_SET_GET_VALUE(true, bucketMarcher->GetUseBucketQueue());
+
+  // A bucket queue without a bucket width must be refused
+  ITK_TRY_EXPECT_EXCEPTION(bucketMarcher->Update());
+
+  bucketMarcher->SetBucketWidth(bucketWidth);
+  ITK_TEST_SET_GET_VALUE(bucketWidth, bucketMarcher->GetBucketWidth());
+  ITK_TRY_EXPECT_NO_EXCEPTION(bucketMarcher->Update());
+
+  ITK_EXERCISE_BASIC_OBJECT_METHODS(bucketMarcher, FastMarchingImageFilterBase, FastMarchingBase);
+
+  // Nodes of a same bucket are processed in arbitrary order, so the
+  // quantized arrival times may deviate from the heap based ones by a
+  // small multiple of the bucket width.
+  const double tolerance = 10. * bucketWidth;
+
+  itk::ImageRegionConstIteratorWithIndex<FloatImageType> it(marcher->GetOutput(),
+                                                            marcher->GetOutput()->GetBufferedRegion());
+  for (it.GoToBegin(); !it.IsAtEnd(); ++it)
+  {
+    const double heapValue = it.Get();
+    const double bucketValue = bucketMarcher->GetOutput()->GetPixel(it.GetIndex());
+
+    // near the stopping threshold the two fronts may not have reached
+    // exactly the same nodes
+    if (std::min(heapValue, bucketValue) >= threshold - tolerance)
+    {
+      continue;
+    }
+    if (itk::Math::abs(heapValue - bucketValue) > tolerance)
+    {
+      std::cout << "Error at index [" << it.GetIndex() << "]" << std::endl;
+      std::cout << "Expected the bucket queue arrival time to be within " << tolerance << " of " << heapValue
+                << ", but got: " << bucketValue << std::endl;
+      std::cout << "Test failed" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  std::cout << "Test finished" << std::endl;
+  return EXIT_SUCCESS;
+}
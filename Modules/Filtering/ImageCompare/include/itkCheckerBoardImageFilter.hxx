@@ -19,7 +19,7 @@
 #define itkCheckerBoardImageFilter_hxx
 
 #include "itkCheckerBoardImageFilter.h"
-#include "itkImageRegionIteratorWithIndex.h"
+#include "itkImageScanlineIterator.h"
 #include "itkObjectFactory.h"
 #include "itkTotalProgressReporter.h"
 
@@ -60,8 +60,8 @@ CheckerBoardImageFilter<TImage>::DynamicThreadedGenerateData(const ImageRegionTy
   InputImageConstPointer input2Ptr = this->GetInput(1);
 
   // Create an iterator that will walk the output region for this thread.
-  using OutputIterator = ImageRegionIteratorWithIndex<OutputImageType>;
-  using InputIterator = ImageRegionConstIteratorWithIndex<InputImageType>;
+  using OutputIterator = ImageScanlineIterator<OutputImageType>;
+  using InputIterator = ImageScanlineConstIterator<InputImageType>;
 
   OutputIterator outItr(outputPtr, outputRegionForThread);
   InputIterator  in1Itr(input1Ptr, outputRegionForThread);
@@ -87,33 +87,44 @@ CheckerBoardImageFilter<TImage>::DynamicThreadedGenerateData(const ImageRegionTy
 
   PixelType pixval;
 
-  // Walk the output region
+  // Walk the output region line by line; only the fastest index changes
+  // within a line, so the contribution of the higher dimensions to the
+  // checker parity is computed once per line
   while (!outItr.IsAtEnd())
   {
-    IndexType index = outItr.GetIndex();
+    const IndexType lineIndex = outItr.GetIndex();
 
-    unsigned int sum = 0;
-
-    for (unsigned int i = 0; i < ImageDimension; ++i)
+    unsigned int lineSum = 0;
+    for (unsigned int i = 1; i < ImageDimension; ++i)
     {
-      sum += static_cast<unsigned int>(index[i] / factors[i]);
+      lineSum += static_cast<unsigned int>(lineIndex[i] / factors[i]);
     }
 
-    if (sum & 1)
-    {
-      pixval = in2Itr.Get();
-    }
-    else
+    IndexValueType index0 = lineIndex[0];
+    while (!outItr.IsAtEndOfLine())
     {
-      pixval = in1Itr.Get();
+      const unsigned int sum = lineSum + static_cast<unsigned int>(index0 / factors[0]);
+
+      if (sum & 1)
+      {
+        pixval = in2Itr.Get();
+      }
+      else
+      {
+        pixval = in1Itr.Get();
+      }
+
+      outItr.Set(pixval);
+
+      ++outItr;
+      ++in1Itr;
+      ++in2Itr;
+      ++index0;
+      progress.CompletedPixel();
     }
-
-    outItr.Set(pixval);
-
-    ++outItr;
-    ++in1Itr;
-    ++in2Itr;
-    progress.CompletedPixel();
+    outItr.NextLine();
+    in1Itr.NextLine();
+    in2Itr.NextLine();
   }
 }
 
@@ -19,7 +19,7 @@
 #define itkSimilarityIndexImageFilter_hxx
 #include "itkSimilarityIndexImageFilter.h"
 
-#include "itkImageRegionIterator.h"
+#include "itkImageScanlineIterator.h"
 #include "itkProgressReporter.h"
 #include "itkMath.h"
 
@@ -146,8 +146,8 @@ void
 SimilarityIndexImageFilter<TInputImage1, TInputImage2>::ThreadedGenerateData(const RegionType & outputRegionForThread,
                                                                              ThreadIdType       threadId)
 {
-  ImageRegionConstIterator<TInputImage1> it1(this->GetInput1(), outputRegionForThread);
-  ImageRegionConstIterator<TInputImage2> it2(this->GetInput2(), outputRegionForThread);
+  ImageScanlineConstIterator<TInputImage1> it1(this->GetInput1(), outputRegionForThread);
+  ImageScanlineConstIterator<TInputImage2> it2(this->GetInput2(), outputRegionForThread);
 
   // support progress methods/callbacks
   ProgressReporter progress(this, threadId, outputRegionForThread.GetNumberOfPixels());
@@ -155,24 +155,29 @@ SimilarityIndexImageFilter<TInputImage1, TInputImage2>::ThreadedGenerateData(con
   // do the work
   while (!it1.IsAtEnd())
   {
-    bool nonzero = false;
-    if (it1.Get() != NumericTraits<InputImage1PixelType>::ZeroValue())
+    while (!it1.IsAtEndOfLine())
     {
-      m_CountOfImage1[threadId]++;
-      nonzero = true;
-    }
-    if (Math::NotExactlyEquals(it2.Get(), NumericTraits<InputImage2PixelType>::ZeroValue()))
-    {
-      m_CountOfImage2[threadId]++;
-      if (nonzero)
+      bool nonzero = false;
+      if (it1.Get() != NumericTraits<InputImage1PixelType>::ZeroValue())
       {
-        m_CountOfIntersection[threadId]++;
+        m_CountOfImage1[threadId]++;
+        nonzero = true;
       }
-    }
-    ++it1;
-    ++it2;
+      if (Math::NotExactlyEquals(it2.Get(), NumericTraits<InputImage2PixelType>::ZeroValue()))
+      {
+        m_CountOfImage2[threadId]++;
+        if (nonzero)
+        {
+          m_CountOfIntersection[threadId]++;
+        }
+      }
+      ++it1;
+      ++it2;
 
-    progress.CompletedPixel();
+      progress.CompletedPixel();
+    }
+    it1.NextLine();
+    it2.NextLine();
   }
 }
 
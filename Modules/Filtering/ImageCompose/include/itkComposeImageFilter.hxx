@@ -19,7 +19,7 @@
 #define itkComposeImageFilter_hxx
 
 #include "itkComposeImageFilter.h"
-#include "itkImageRegionIterator.h"
+#include "itkImageScanlineIterator.h"
 #include "itkTotalProgressReporter.h"
 
 namespace itk
@@ -115,7 +115,7 @@ ComposeImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(const
 
   TotalProgressReporter progress(this, outputImage->GetRequestedRegion().GetNumberOfPixels());
 
-  ImageRegionIterator<OutputImageType> oit(outputImage, outputRegionForThread);
+  ImageScanlineIterator<OutputImageType> oit(outputImage, outputRegionForThread);
   oit.GoToBegin();
 
   InputIteratorContainerType inputItContainer;
@@ -133,10 +133,18 @@ ComposeImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(const
   NumericTraits<OutputPixelType>::SetLength(pix, static_cast<unsigned int>(this->GetNumberOfIndexedInputs()));
   while (!oit.IsAtEnd())
   {
-    ComputeOutputPixel(pix, inputItContainer);
-    oit.Set(pix);
-    ++oit;
-    progress.CompletedPixel();
+    while (!oit.IsAtEndOfLine())
+    {
+      ComputeOutputPixel(pix, inputItContainer);
+      oit.Set(pix);
+      ++oit;
+      progress.CompletedPixel();
+    }
+    oit.NextLine();
+    for (auto & inputIt : inputItContainer)
+    {
+      inputIt.NextLine();
+    }
   }
 }
 } // end namespace itk
@@ -238,10 +238,48 @@ JoinSeriesImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(
 
   TotalProgressReporter progress(this, output->GetRequestedRegion().GetNumberOfPixels());
 
+  // Copying between images of different dimensions makes ImageAlgorithm::Copy
+  // fall back to per-pixel iteration. Instead, wrap each input in a temporary
+  // image of the output dimension that shares the input's pixel container --
+  // the same trick TileImageFilter uses -- so that the copy can collapse
+  // whole scanlines, or the whole slab when the layouts match, into single
+  // contiguous copies.
+  using TempImageType = typename TInputImage::template RebindImageType<typename TInputImage::PixelType,
+                                                                       OutputImageDimension>;
+  using PixelContainerType = typename TempImageType::PixelContainer;
+
+  typename TempImageType::RegionType tempRegion;
+  typename TempImageType::RegionType tempBufferedRegion;
+
   for (IndexValueType idx = begin; idx < end; ++idx)
   {
     outputRegion.SetIndex(InputImageDimension, idx);
-    ImageAlgorithm::Copy(this->GetInput(idx), output, inputRegion, outputRegion);
+
+    const TInputImage * input = this->GetInput(idx);
+
+    for (unsigned int i = 0; i < InputImageDimension; ++i)
+    {
+      tempRegion.SetIndex(i, inputRegion.GetIndex(i));
+      tempRegion.SetSize(i, inputRegion.GetSize(i));
+      tempBufferedRegion.SetIndex(i, input->GetBufferedRegion().GetIndex(i));
+      tempBufferedRegion.SetSize(i, input->GetBufferedRegion().GetSize(i));
+    }
+    for (unsigned int i = InputImageDimension; i < OutputImageDimension; ++i)
+    {
+      tempRegion.SetIndex(i, 0);
+      tempRegion.SetSize(i, 1);
+      tempBufferedRegion.SetIndex(i, 0);
+      tempBufferedRegion.SetSize(i, 1);
+    }
+
+    auto tempImage = TempImageType::New();
+    tempImage->SetLargestPossibleRegion(tempBufferedRegion);
+    tempImage->SetBufferedRegion(tempBufferedRegion);
+    tempImage->SetRequestedRegion(tempRegion);
+    tempImage->SetNumberOfComponentsPerPixel(input->GetNumberOfComponentsPerPixel());
+    tempImage->SetPixelContainer(const_cast<PixelContainerType *>(input->GetPixelContainer()));
+
+    ImageAlgorithm::Copy(tempImage.GetPointer(), output, tempRegion, outputRegion);
     progress.Completed(outputRegion.GetNumberOfPixels());
   }
 }
@@ -237,23 +237,22 @@ private:
   void
   FollowEdge(IndexType index, const OutputImageType * multiplyImageFilterOutput);
 
-  /** Calculate the second derivative of the smoothed image, it writes the
-   *  result to the update buffer */
+  /** Compute the second directional derivative, the non-maximum
+   * suppression and the multiplication with the zero crossings for one
+   * tile. The second derivative is evaluated on the tile plus a one pixel
+   * halo into a small tile-local buffer, so the derivative values needed
+   * for the directional gradient and the zero crossings stay cache
+   * resident and no full-size intermediate image is written. The result
+   * goes to m_UpdateBuffer1. */
   void
-  ThreadedCompute2ndDerivative(const OutputImageRegionType & outputRegionForThread);
-
+  ThreadedFusedNonMaximumSuppression(const OutputImageRegionType & outputRegionForThread);
 
   /** This method is used to calculate the 2nd derivative for
-   * non-boundary pixels. It is called by the ThreadedCompute2ndDerivative
-   * method. */
+   * non-boundary pixels. It is called by the
+   * ThreadedFusedNonMaximumSuppression method. */
   OutputImagePixelType
   ComputeCannyEdge(const NeighborhoodType & it, void * globalData);
 
-  /** Calculate the gradient of the second derivative of the smoothed image,
-   *  it writes the result to m_UpdateBuffer1 */
-  void
-  ThreadedCompute2ndDerivativePos(const OutputImageRegionType & outputRegionForThread);
-
   ArrayType m_Variance;
   ArrayType m_MaximumError;
 
@@ -279,9 +278,6 @@ private:
   SizeValueType m_Stride[ImageDimension];
   SizeValueType m_Center;
 
-  typename ListNodeStorageType::Pointer m_NodeStore;
-  ListPointerType                       m_NodeList;
-
   OutputImageType * m_OutputImage;
 };
 } // end of namespace itk
@@ -19,15 +19,18 @@
 #define itkCannyEdgeDetectionImageFilter_hxx
 #include "itkCannyEdgeDetectionImageFilter.h"
 
-#include "itkZeroCrossingImageFilter.h"
 #include "itkNeighborhoodInnerProduct.h"
 #include "itkNumericTraits.h"
 #include "itkProgressReporter.h"
 #include "itkGradientMagnitudeImageFilter.h"
 #include "itkImageRegionIteratorWithIndex.h"
+#include "itkImageScanlineIterator.h"
 #include "itkMath.h"
 #include "itkProgressTransformer.h"
 
+#include <mutex>
+#include <vector>
+
 namespace itk
 {
 template <typename TInputImage, typename TOutputImage>
@@ -72,10 +75,6 @@ CannyEdgeDetectionImageFilter<TInputImage, TOutputImage>::CannyEdgeDetectionImag
   m_ComputeCannyEdge2ndDerivativeOper.SetOrder(2);
   m_ComputeCannyEdge2ndDerivativeOper.CreateDirectional();
 
-  // Initialize the list
-  m_NodeStore = ListNodeStorageType::New();
-  m_NodeList = ListType::New();
-
   m_OutputImage = nullptr;
 }
 
@@ -94,37 +93,49 @@ CannyEdgeDetectionImageFilter<TInputImage, TOutputImage>::AllocateUpdateBuffer()
 
 template <typename TInputImage, typename TOutputImage>
 void
-CannyEdgeDetectionImageFilter<TInputImage, TOutputImage>::ThreadedCompute2ndDerivative(
+CannyEdgeDetectionImageFilter<TInputImage, TOutputImage>::ThreadedFusedNonMaximumSuppression(
   const OutputImageRegionType & outputRegionForThread)
 {
   ZeroFluxNeumannBoundaryCondition<TInputImage> nbc;
 
-  ImageRegionIterator<TOutputImage> it;
-
   void * globalData = nullptr;
 
-  // Here input is the result from the gaussian filter output is the update
-  // buffer
+  // Here input is the result from the gaussian filter
   typename OutputImageType::Pointer input = m_GaussianFilter->GetOutput();
 
   // Set iterator radius
   Size<ImageDimension> radius;
   radius.Fill(1);
 
+  // The directional gradient and the zero crossings below read the second
+  // derivative of the neighbors of each tile pixel, so the derivative is
+  // computed on the tile padded by one pixel into a small tile-local
+  // buffer. The halo pixels are recomputed by the neighboring tiles, which
+  // is cheaper than writing and re-reading a full-size intermediate image.
+  OutputImageRegionType paddedRegion = outputRegionForThread;
+  paddedRegion.PadByRadius(radius);
+  paddedRegion.Crop(input->GetBufferedRegion());
+
+  auto secondDerivativeImage = OutputImageType::New();
+  secondDerivativeImage->CopyInformation(input);
+  secondDerivativeImage->SetRegions(paddedRegion);
+  secondDerivativeImage->Allocate();
+
   // Find the data-set boundary "faces"
   typename NeighborhoodAlgorithm::ImageBoundaryFacesCalculator<TInputImage>::FaceListType faceList;
   NeighborhoodAlgorithm::ImageBoundaryFacesCalculator<TInputImage>                        bC;
-  faceList = bC(input, outputRegionForThread, radius);
+  faceList = bC(input, paddedRegion, radius);
 
   typename NeighborhoodAlgorithm::ImageBoundaryFacesCalculator<TInputImage>::FaceListType::iterator fit;
 
+  // 1. Calculate the second directional derivative on the padded tile.
   // Process the non-boundady region and then each of the boundary faces.
   // These are N-d regions which border the edge of the buffer.
   for (fit = faceList.begin(); fit != faceList.end(); ++fit)
   {
     NeighborhoodType bit(radius, input, *fit);
 
-    it = ImageRegionIterator<OutputImageType>(this->m_OutputImage, *fit);
+    ImageRegionIterator<OutputImageType> it(secondDerivativeImage, *fit);
     bit.OverrideBoundaryCondition(&nbc);
     bit.GoToBegin();
 
@@ -135,6 +146,93 @@ CannyEdgeDetectionImageFilter<TInputImage, TOutputImage>::ThreadedCompute2ndDeri
       ++it;
     }
   }
+
+  // 2. Calculate the gradient of the second derivative, suppress the
+  // non-maxima, find the zero crossings of the second derivative and
+  // multiply them together, all in a single sweep over the tile.
+
+  InputImagePixelType  zero = NumericTraits<InputImagePixelType>::ZeroValue();
+  OutputImagePixelType one = NumericTraits<OutputImagePixelType>::OneValue();
+
+  OutputImagePixelType dx[ImageDimension];
+  OutputImagePixelType dx1[ImageDimension];
+
+  OutputImagePixelType directional[ImageDimension];
+  OutputImagePixelType derivPos;
+
+  OutputImagePixelType gradMag;
+
+  NeighborhoodInnerProduct<OutputImageType> IP;
+
+  faceList = bC(input, outputRegionForThread, radius);
+
+  for (fit = faceList.begin(); fit != faceList.end(); ++fit)
+  {
+    auto bit = ConstNeighborhoodIterator<InputImageType>(radius, input, *fit);
+    auto bit1 = ConstNeighborhoodIterator<InputImageType>(radius, secondDerivativeImage, *fit);
+    auto it = ImageRegionIterator<OutputImageType>(m_UpdateBuffer1, *fit);
+    bit.OverrideBoundaryCondition(&nbc);
+    bit.GoToBegin();
+    bit1.GoToBegin();
+    it.GoToBegin();
+
+    while (!bit.IsAtEnd())
+    {
+      gradMag = 0.0001;
+
+      for (unsigned int i = 0; i < ImageDimension; ++i)
+      {
+        dx[i] = IP(m_ComputeCannyEdgeSlice[i], bit, m_ComputeCannyEdge1stDerivativeOper);
+        gradMag += dx[i] * dx[i];
+
+        dx1[i] = IP(m_ComputeCannyEdgeSlice[i], bit1, m_ComputeCannyEdge1stDerivativeOper);
+      }
+
+      gradMag = std::sqrt((double)gradMag);
+      derivPos = zero;
+      for (unsigned int i = 0; i < ImageDimension; ++i)
+      {
+        // First calculate the directional derivative
+        directional[i] = dx[i] / gradMag;
+
+        // Calculate gradient of 2nd derivative
+        derivPos += dx1[i] * directional[i];
+      }
+
+      OutputImagePixelType nonMaximum = ((derivPos <= zero));
+      nonMaximum = nonMaximum * gradMag;
+
+      // Zero crossing of the second derivative, with the semantics of
+      // ZeroCrossingImageFilter: mark the pixel on the side of the
+      // crossing closest to zero, breaking ties towards the positive
+      // direction.
+      const OutputImagePixelType thisOne = bit1.GetPixel(m_Center);
+      OutputImagePixelType       zeroCrossing = NumericTraits<OutputImagePixelType>::ZeroValue();
+      for (unsigned int i = 0; i < 2 * ImageDimension; ++i)
+      {
+        const SizeValueType neighbor =
+          (i < ImageDimension) ? m_Center - m_Stride[i] : m_Center + m_Stride[i - ImageDimension];
+        const OutputImagePixelType that = bit1.GetPixel(neighbor);
+        if (((thisOne < zero) && (that > zero)) || ((thisOne > zero) && (that < zero)) ||
+            ((Math::ExactlyEquals(thisOne, zero)) && (Math::NotExactlyEquals(that, zero))) ||
+            ((Math::NotExactlyEquals(thisOne, zero)) && (Math::ExactlyEquals(that, zero))))
+        {
+          const OutputImagePixelType absThisOne = itk::Math::abs(thisOne);
+          const OutputImagePixelType absThat = itk::Math::abs(that);
+          if (absThisOne < absThat || (Math::ExactlyEquals(absThisOne, absThat) && i >= ImageDimension))
+          {
+            zeroCrossing = one;
+            break;
+          }
+        }
+      }
+
+      it.Value() = nonMaximum * zeroCrossing;
+      ++bit;
+      ++bit1;
+      ++it;
+    }
+  }
 }
 
 template <typename TInputImage, typename TOutputImage>
@@ -206,9 +304,6 @@ CannyEdgeDetectionImageFilter<TInputImage, TOutputImage>::GenerateData()
   output->Graft(this->GetOutput());
   this->m_OutputImage = output;
 
-  typename ZeroCrossingImageFilter<TOutputImage, TOutputImage>::Pointer zeroCrossFilter =
-    ZeroCrossingImageFilter<TOutputImage, TOutputImage>::New();
-
   this->AllocateUpdateBuffer();
 
   // 1.Apply the Gaussian Filter to the input image
@@ -220,48 +315,26 @@ CannyEdgeDetectionImageFilter<TInputImage, TOutputImage>::GenerateData()
   m_GaussianFilter->Update();
   this->UpdateProgress(0.01f);
 
-  ProgressTransformer progress1(0.01f, 0.45f, this);
-  // 2. Calculate 2nd order directional derivative
-  // Calculate the 2nd order directional derivative of the smoothed image.
-  // The output of this filter will be used to store the directional
-  // derivative.
+  ProgressTransformer progress1(0.01f, 0.9f, this);
+  // 2. + 3. Calculate the 2nd order directional derivative of the smoothed
+  // image, suppress the non-maxima and multiply with the zero crossings of
+  // the 2nd derivative, all fused into one tiled pass over the image. The
+  // result, the input to the hysteresis thresholding, is written to
+  // m_UpdateBuffer1.
   this->GetMultiThreader()->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
   this->GetMultiThreader()->template ParallelizeImageRegion<TOutputImage::ImageDimension>(
     this->GetOutput()->GetRequestedRegion(),
     [this](const OutputImageRegionType & outputRegionForThread) {
-      this->ThreadedCompute2ndDerivative(outputRegionForThread);
+      this->ThreadedFusedNonMaximumSuppression(outputRegionForThread);
     },
     progress1.GetProcessObject());
 
-  ProgressTransformer progress2(0.45f, 0.9f, this);
-  this->GetMultiThreader()->template ParallelizeImageRegion<TOutputImage::ImageDimension>(
-    this->GetOutput()->GetRequestedRegion(),
-    [this](const OutputImageRegionType & outputRegionForThread) {
-      this->ThreadedCompute2ndDerivativePos(outputRegionForThread);
-    },
-    progress2.GetProcessObject());
-
-  // 3. Non-maximum suppression
-
-  // Calculate the zero crossings of the 2nd directional derivative and write
-  // the result to output buffer.
-  zeroCrossFilter->SetInput(this->m_OutputImage);
-  zeroCrossFilter->Update();
+  // Keep the non-maximum suppression image available through
+  // GetNonMaximumSuppressionImage()
+  m_MultiplyImageFilter->GetOutput()->Graft(m_UpdateBuffer1);
   this->UpdateProgress(0.92f);
 
-  // 4. Hysteresis Thresholding
-
-  // First get all the edges corresponding to zerocrossings
-  m_MultiplyImageFilter->SetInput1(m_UpdateBuffer1);
-  m_MultiplyImageFilter->SetInput2(zeroCrossFilter->GetOutput());
-
-  // To save memory, we will graft the output of the m_GaussianFilter,
-  // which is no longer needed, into the m_MultiplyImageFilter.
-  m_MultiplyImageFilter->GraftOutput(m_GaussianFilter->GetOutput());
-  m_MultiplyImageFilter->Update();
-  this->UpdateProgress(0.95f);
-
-  // Then do the double threshoulding upon the edge responses
+  // 4. Hysteresis Thresholding upon the edge responses
   this->HysteresisThresholding();
   this->UpdateProgress(0.99f);
 
@@ -277,38 +350,60 @@ CannyEdgeDetectionImageFilter<TInputImage, TOutputImage>::HysteresisThresholding
   // This is the Zero crossings of the Second derivative multiplied with the
   // gradients of the image. HysteresisThresholding of this image should give
   // the Canny output.
-  typename OutputImageType::Pointer input = m_MultiplyImageFilter->GetOutput();
-  float                             value;
-
-  ListNodeType * node;
-
-  // fix me
-  ImageRegionIterator<TOutputImage> oit(input, input->GetRequestedRegion());
+  typename OutputImageType::Pointer input = m_UpdateBuffer1;
 
-  oit.GoToBegin();
+  // Clear the output before marking the edges
+  this->GetMultiThreader()->template ParallelizeImageRegion<TOutputImage::ImageDimension>(
+    this->m_OutputImage->GetRequestedRegion(),
+    [this](const OutputImageRegionType & region) {
+      ImageScanlineIterator<TOutputImage> uit(this->m_OutputImage, region);
+      while (!uit.IsAtEnd())
+      {
+        while (!uit.IsAtEndOfLine())
+        {
+          uit.Set(NumericTraits<OutputImagePixelType>::ZeroValue());
+          ++uit;
+        }
+        uit.NextLine();
+      }
+    },
+    nullptr);
 
-  ImageRegionIterator<TOutputImage> uit(this->m_OutputImage, this->m_OutputImage->GetRequestedRegion());
-  uit.GoToBegin();
-  while (!uit.IsAtEnd())
-  {
-    uit.Value() = NumericTraits<OutputImagePixelType>::ZeroValue();
-    ++uit;
-  }
+  // Collect the seeds above the upper threshold in parallel. Following the
+  // connected edges marks an order-independent set of pixels, so the seed
+  // order does not influence the output.
+  std::vector<IndexType> seeds;
+  std::mutex             seedsMutex;
+  this->GetMultiThreader()->template ParallelizeImageRegion<TOutputImage::ImageDimension>(
+    input->GetRequestedRegion(),
+    [this, &input, &seeds, &seedsMutex](const OutputImageRegionType & region) {
+      std::vector<IndexType>                      localSeeds;
+      ImageScanlineConstIterator<TOutputImage>    oit(input, region);
+      while (!oit.IsAtEnd())
+      {
+        IndexType index = oit.GetIndex();
+        while (!oit.IsAtEndOfLine())
+        {
+          if (oit.Get() > m_UpperThreshold)
+          {
+            localSeeds.push_back(index);
+          }
+          ++index[0];
+          ++oit;
+        }
+        oit.NextLine();
+      }
+      if (!localSeeds.empty())
+      {
+        const std::lock_guard<std::mutex> lockGuard(seedsMutex);
+        seeds.insert(seeds.end(), localSeeds.begin(), localSeeds.end());
+      }
+    },
+    nullptr);
 
-  const OutputImageType * multiplyImageFilterOutput = this->m_MultiplyImageFilter->GetOutput();
-  while (!oit.IsAtEnd())
+  for (const IndexType & seed : seeds)
   {
-    value = oit.Value();
-
-    if (value > m_UpperThreshold)
-    {
-      node = m_NodeStore->Borrow();
-      node->m_Value = oit.GetIndex();
-      m_NodeList->PushFront(node);
-      FollowEdge(oit.GetIndex(), multiplyImageFilterOutput);
-    }
-
-    ++oit;
+    FollowEdge(seed, input);
   }
 }
 
@@ -322,9 +417,8 @@ CannyEdgeDetectionImageFilter<TInputImage, TOutputImage>::FollowEdge(IndexType
   // the Canny output.
   InputImageRegionType inputRegion = multiplyImageFilterOutput->GetRequestedRegion();
 
-  IndexType      nIndex;
-  IndexType      cIndex;
-  ListNodeType * node;
+  IndexType nIndex;
+  IndexType cIndex;
 
   // Assign iterator radius
   Size<ImageDimension> radius;
@@ -337,44 +431,37 @@ CannyEdgeDetectionImageFilter<TInputImage, TOutputImage>::FollowEdge(IndexType
   uit.SetIndex(index);
   if (Math::ExactlyEquals(uit.Get(), NumericTraits<OutputImagePixelType>::OneValue()))
   {
-    // Remove the node if we are not going to follow it!
-    //
-    // Pop the front node from the list and read its index value.
-    node = m_NodeList->Front(); // get a pointer to the first node
-    m_NodeList->PopFront();     // unlink the front node
-    m_NodeStore->Return(node);  // return the memory for reuse
+    // The edge this seed belongs to has already been followed.
     return;
   }
 
+  // Depth-first edge following with an explicit stack; pixels are marked
+  // in the output when pushed, so each one is visited at most once.
+  std::vector<IndexType> indexStack;
+  indexStack.push_back(index);
+  uit.Value() = NumericTraits<OutputImagePixelType>::OneValue();
+
   int nSize = m_Center * 2 + 1;
-  while (!m_NodeList->Empty())
+  while (!indexStack.empty())
   {
-    // Pop the front node from the list and read its index value.
-    node = m_NodeList->Front(); // Get a pointer to the first node
-    cIndex = node->m_Value;     // Read the value of the first node
-    m_NodeList->PopFront();     // Unlink the front node
-    m_NodeStore->Return(node);  // Return the memory for reuse
+    cIndex = indexStack.back();
+    indexStack.pop_back();
 
-    // Move iterators to the correct index position.
+    // Move the neighborhood iterator to the current index position.
     oit.SetLocation(cIndex);
-    uit.SetIndex(cIndex);
-    uit.Value() = 1;
 
-    // Search the neighbors for new indices to add to the list.
+    // Search the neighbors for new indices to add to the stack.
     for (int i = 0; i < nSize; ++i)
     {
       nIndex = oit.GetIndex(i);
-      uit.SetIndex(nIndex);
       if (inputRegion.IsInside(nIndex))
       {
+        uit.SetIndex(nIndex);
         if (oit.GetPixel(i) > m_LowerThreshold &&
             Math::NotExactlyEquals(uit.Value(), NumericTraits<OutputImagePixelType>::OneValue()))
         {
-          node = m_NodeStore->Borrow(); // Get a new node struct
-          node->m_Value = nIndex;       // Set its value
-          m_NodeList->PushFront(node);  // Add the new node to the list
+          indexStack.push_back(nIndex);
 
-          uit.SetIndex(nIndex);
           uit.Value() = NumericTraits<OutputImagePixelType>::OneValue();
         }
       }
@@ -382,94 +469,6 @@ CannyEdgeDetectionImageFilter<TInputImage, TOutputImage>::FollowEdge(IndexType
   }
 }
 
-template <typename TInputImage, typename TOutputImage>
-void
-CannyEdgeDetectionImageFilter<TInputImage, TOutputImage>::ThreadedCompute2ndDerivativePos(
-  const OutputImageRegionType & outputRegionForThread)
-{
-  ZeroFluxNeumannBoundaryCondition<TInputImage> nbc;
-
-  ConstNeighborhoodIterator<TInputImage> bit;
-  ConstNeighborhoodIterator<TInputImage> bit1;
-
-  ImageRegionIterator<TOutputImage> it;
-
-  // Here input is the result from the gaussian filter
-  //      input1 is the 2nd derivative result
-  //      output is the gradient of 2nd derivative
-  typename OutputImageType::Pointer input1 = this->m_OutputImage;
-  typename OutputImageType::Pointer input = m_GaussianFilter->GetOutput();
-
-  typename InputImageType::Pointer output = m_UpdateBuffer1;
-
-  // Set iterator radius
-  Size<ImageDimension> radius;
-  radius.Fill(1);
-
-  // Find the data-set boundary "faces"
-  typename NeighborhoodAlgorithm::ImageBoundaryFacesCalculator<TInputImage>::FaceListType faceList;
-  NeighborhoodAlgorithm::ImageBoundaryFacesCalculator<TInputImage>                        bC;
-  faceList = bC(input, outputRegionForThread, radius);
-
-  typename NeighborhoodAlgorithm::ImageBoundaryFacesCalculator<TInputImage>::FaceListType::iterator fit;
-
-  InputImagePixelType zero = NumericTraits<InputImagePixelType>::ZeroValue();
-
-  OutputImagePixelType dx[ImageDimension];
-  OutputImagePixelType dx1[ImageDimension];
-
-  OutputImagePixelType directional[ImageDimension];
-  OutputImagePixelType derivPos;
-
-  OutputImagePixelType gradMag;
-
-  // Process the non-boundary region and then each of the boundary faces.
-  // These are N-d regions which border the edge of the buffer.
-
-  NeighborhoodInnerProduct<OutputImageType> IP;
-
-  for (fit = faceList.begin(); fit != faceList.end(); ++fit)
-  {
-    bit = ConstNeighborhoodIterator<InputImageType>(radius, input, *fit);
-    bit1 = ConstNeighborhoodIterator<InputImageType>(radius, input1, *fit);
-    it = ImageRegionIterator<OutputImageType>(output, *fit);
-    bit.OverrideBoundaryCondition(&nbc);
-    bit.GoToBegin();
-    bit1.GoToBegin();
-    it.GoToBegin();
-
-    while (!bit.IsAtEnd())
-    {
-      gradMag = 0.0001;
-
-      for (unsigned int i = 0; i < ImageDimension; ++i)
-      {
-        dx[i] = IP(m_ComputeCannyEdgeSlice[i], bit, m_ComputeCannyEdge1stDerivativeOper);
-        gradMag += dx[i] * dx[i];
-
-        dx1[i] = IP(m_ComputeCannyEdgeSlice[i], bit1, m_ComputeCannyEdge1stDerivativeOper);
-      }
-
-      gradMag = std::sqrt((double)gradMag);
-      derivPos = zero;
-      for (unsigned int i = 0; i < ImageDimension; ++i)
-      {
-        // First calculate the directional derivative
-        directional[i] = dx[i] / gradMag;
-
-        // Calculate gradient of 2nd derivative
-        derivPos += dx1[i] * directional[i];
-      }
-
-      it.Value() = ((derivPos <= zero));
-      it.Value() = it.Get() * gradMag;
-      ++bit;
-      ++bit1;
-      ++it;
-    }
-  }
-}
-
 template <typename TInputImage, typename TOutputImage>
 void
 CannyEdgeDetectionImageFilter<TInputImage, TOutputImage>::PrintSelf(std::ostream & os, Indent indent) const
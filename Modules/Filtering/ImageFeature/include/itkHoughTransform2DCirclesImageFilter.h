@@ -52,6 +52,10 @@ namespace itk
  * is recommended, as the estimation of the radius involves floating point
  * calculations. Usually, 'double' is the best choice for this pixel type.
  *
+ * The accumulation of the votes is distributed over the threads of the
+ * MultiThreader in a way that keeps the result bit-for-bit identical to a
+ * serial accumulation, run-to-run.
+ *
  * \ingroup ImageFeatureExtraction
  *
  * \ingroup ITKImageFeature
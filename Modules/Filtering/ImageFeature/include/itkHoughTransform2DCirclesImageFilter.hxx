@@ -22,9 +22,13 @@
 #include "itkImageRegionIteratorWithIndex.h"
 #include "itkDiscreteGaussianImageFilter.h"
 #include "itkGaussianDerivativeImageFunction.h"
-#include "itkMinimumMaximumImageCalculator.h"
+#include "itkMultiThreaderBase.h"
 #include "itkMath.h"
 
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
 namespace itk
 {
 template <typename TInputPixelType, typename TOutputPixelType, typename TRadiusPixelType>
@@ -90,14 +94,6 @@ HoughTransform2DCirclesImageFilter<TInputPixelType, TOutputPixelType, TRadiusPix
   this->AllocateOutputs();
   outputImage->FillBuffer(0);
 
-  using DoGFunctionType = GaussianDerivativeImageFunction<InputImageType>;
-  const auto DoGFunction = DoGFunctionType::New();
-  DoGFunction->SetSigma(m_SigmaGradient);
-  DoGFunction->SetUseImageSpacing(m_UseImageSpacing);
-  // Set input image _after_ setting the other GaussianDerivative properties,
-  // to avoid multiple kernel recomputation within GaussianDerivativeImageFunction.
-  DoGFunction->SetInputImage(inputImage);
-
   m_RadiusImage = RadiusImageType::New();
 
   m_RadiusImage->SetRegions(outputImage->GetLargestPossibleRegion());
@@ -106,28 +102,116 @@ HoughTransform2DCirclesImageFilter<TInputPixelType, TOutputPixelType, TRadiusPix
   m_RadiusImage->SetDirection(inputImage->GetDirection());
   m_RadiusImage->Allocate(true); // initialize buffer to zero
 
-  ImageRegionConstIteratorWithIndex<InputImageType> image_it(inputImage, inputImage->GetRequestedRegion());
-  image_it.GoToBegin();
-
   const ImageRegion<2> & region = outputImage->GetRequestedRegion();
 
-  while (!image_it.IsAtEnd())
+  // Only the pixels above the intensity threshold may vote, so gather their
+  // indices once instead of re-scanning the whole frame in the later stages.
+  std::vector<Index<2>> candidatePixels;
+
+  ImageRegionConstIteratorWithIndex<InputImageType> image_it(inputImage, inputImage->GetRequestedRegion());
+  for (image_it.GoToBegin(); !image_it.IsAtEnd(); ++image_it)
   {
     if (image_it.Get() > m_Threshold)
     {
-      const Index<2>                             inputIndex = image_it.GetIndex();
-      const typename DoGFunctionType::VectorType grad = DoGFunction->DoGFunctionType::EvaluateAtIndex(inputIndex);
+      candidatePixels.push_back(image_it.GetIndex());
+    }
+  }
+
+  // The unit gradient of each candidate pixel whose gradient norm is above
+  // m_GradientNormThreshold, kept in the scan order of the candidates.
+  struct Voter
+  {
+    Index<2> index;
+    double   vx;
+    double   vy;
+  };
+  std::vector<Voter> voters;
+
+  MultiThreaderBase * const multiThreader = this->GetMultiThreader();
 
-      double Vx = grad[0];
-      double Vy = grad[1];
+  if (!candidatePixels.empty())
+  {
+    const auto                 numberOfCandidates = static_cast<SizeValueType>(candidatePixels.size());
+    std::vector<Voter>         gradients(numberOfCandidates);
+    std::vector<unsigned char> aboveNormThreshold(numberOfCandidates, 0);
+
+    // The gradient evaluations are independent of each other, so they are
+    // distributed over chunks of the candidate list. Each chunk uses its own
+    // derivative function, as the function is not safe to share between
+    // threads.
+    const SizeValueType numberOfChunks =
+      std::min(numberOfCandidates, static_cast<SizeValueType>(this->GetNumberOfWorkUnits()));
+
+    multiThreader->ParallelizeArray(
+      0,
+      numberOfChunks,
+      [this, &inputImage, &candidatePixels, &gradients, &aboveNormThreshold, numberOfCandidates, numberOfChunks](
+        SizeValueType chunk) {
+        using DoGFunctionType = GaussianDerivativeImageFunction<InputImageType>;
+        const auto DoGFunction = DoGFunctionType::New();
+        DoGFunction->SetSigma(m_SigmaGradient);
+        DoGFunction->SetUseImageSpacing(m_UseImageSpacing);
+        // Set input image _after_ setting the other GaussianDerivative properties,
+        // to avoid multiple kernel recomputation within GaussianDerivativeImageFunction.
+        DoGFunction->SetInputImage(inputImage);
+
+        const SizeValueType chunkBegin = chunk * numberOfCandidates / numberOfChunks;
+        const SizeValueType chunkEnd = (chunk + 1) * numberOfCandidates / numberOfChunks;
+
+        for (SizeValueType candidate = chunkBegin; candidate < chunkEnd; ++candidate)
+        {
+          const Index<2>                             inputIndex = candidatePixels[candidate];
+          const typename DoGFunctionType::VectorType grad = DoGFunction->DoGFunctionType::EvaluateAtIndex(inputIndex);
+
+          const double Vx = grad[0];
+          const double Vy = grad[1];
 
-      const double norm = std::sqrt(Vx * Vx + Vy * Vy);
+          const double norm = std::sqrt(Vx * Vx + Vy * Vy);
 
-      // if the gradient is not flat (using GradientNormThreshold to estimate flatness)
-      if (norm > m_GradientNormThreshold)
+          // if the gradient is not flat (using GradientNormThreshold to estimate flatness)
+          if (norm > m_GradientNormThreshold)
+          {
+            gradients[candidate] = { inputIndex, Vx / norm, Vy / norm };
+            aboveNormThreshold[candidate] = 1;
+          }
+        }
+      },
+      nullptr);
+
+    for (SizeValueType candidate = 0; candidate < numberOfCandidates; ++candidate)
+    {
+      if (aboveNormThreshold[candidate])
       {
-        Vx /= norm;
-        Vy /= norm;
+        voters.push_back(gradients[candidate]);
+      }
+    }
+  }
+
+  if (!voters.empty())
+  {
+    // A vote can land at most about max(MinimumRadius, MaximumRadius) rows
+    // away from its voter (plus rounding and one overshooting radius step),
+    // so voters whose rows are further than 'reach' away from a band of
+    // output rows cannot contribute to it.
+    const auto reach = static_cast<IndexValueType>(std::ceil(std::max(m_MinimumRadius, m_MaximumRadius))) + 3;
+
+    // Replays the votes of all voters, applying only those that fall within
+    // the band of output rows [bandBegin, bandEnd). A vote ray still
+    // terminates as soon as it leaves the full requested region, exactly as
+    // in a serial scan, so each accumulator pixel receives its votes in the
+    // serial voter order and the result is identical to a serial pass.
+    const auto accumulateBand = [this, &outputImage, &voters, &region, reach](const IndexValueType bandBegin,
+                                                                             const IndexValueType bandEnd) {
+      for (const Voter & voter : voters)
+      {
+        if (voter.index[1] + reach < bandBegin || voter.index[1] - reach >= bandEnd)
+        {
+          continue;
+        }
+
+        const Index<2> inputIndex = voter.index;
+        const double   Vx = voter.vx;
+        const double   Vy = voter.vy;
 
         for (double angle = -m_SweepAngle; angle <= m_SweepAngle; angle += 0.05)
         {
@@ -147,8 +231,11 @@ HoughTransform2DCirclesImageFilter<TInputPixelType, TOutputPixelType, TRadiusPix
                 std::sqrt(static_cast<double>((outputIndex[0] - inputIndex[0]) * (outputIndex[0] - inputIndex[0]) +
                                               (outputIndex[1] - inputIndex[1]) * (outputIndex[1] - inputIndex[1])));
 
-              ++outputImage->GetPixel(outputIndex);
-              m_RadiusImage->GetPixel(outputIndex) += distance;
+              if (outputIndex[1] >= bandBegin && outputIndex[1] < bandEnd)
+              {
+                ++outputImage->GetPixel(outputIndex);
+                m_RadiusImage->GetPixel(outputIndex) += distance;
+              }
             }
             else
             {
@@ -158,8 +245,36 @@ HoughTransform2DCirclesImageFilter<TInputPixelType, TOutputPixelType, TRadiusPix
           } while (distance < m_MaximumRadius);
         }
       }
+    };
+
+    const IndexValueType firstRow = region.GetIndex(1);
+    const auto           numberOfRows = static_cast<IndexValueType>(region.GetSize(1));
+
+    // Each band accumulates an exclusive range of output rows, so the threads
+    // never write to the same pixel and the result is bit-for-bit identical
+    // to the serial accumulation, run-to-run. Bands are kept at least two
+    // reaches tall, so that a voter overlaps few bands and little ray-walking
+    // work is duplicated.
+    const IndexValueType numberOfBands = std::min(static_cast<IndexValueType>(this->GetNumberOfWorkUnits()),
+                                                  std::max(IndexValueType{ 1 }, numberOfRows / (2 * reach)));
+
+    if (numberOfBands <= 1)
+    {
+      accumulateBand(firstRow, firstRow + numberOfRows);
+    }
+    else
+    {
+      multiThreader->ParallelizeArray(
+        0,
+        static_cast<SizeValueType>(numberOfBands),
+        [firstRow, numberOfRows, numberOfBands, &accumulateBand](SizeValueType band) {
+          const IndexValueType bandBegin = firstRow + static_cast<IndexValueType>(band) * numberOfRows / numberOfBands;
+          const IndexValueType bandEnd =
+            firstRow + (static_cast<IndexValueType>(band) + 1) * numberOfRows / numberOfBands;
+          accumulateBand(bandBegin, bandEnd);
+        },
+        nullptr);
     }
-    ++image_it;
   }
 
   // Compute the average radius
@@ -218,8 +333,9 @@ HoughTransform2DCirclesImageFilter<TInputPixelType, TOutputPixelType, TRadiusPix
     gaussianFilter->Update();
     const InternalImageType::Pointer postProcessImage = gaussianFilter->GetOutput();
 
-    const auto                             minMaxCalculator = MinimumMaximumImageCalculator<InternalImageType>::New();
-    ImageRegionIterator<InternalImageType> it_input(postProcessImage, postProcessImage->GetLargestPossibleRegion());
+    const InternalImageType::RegionType postProcessRegion = postProcessImage->GetLargestPossibleRegion();
+
+    MultiThreaderBase * const multiThreader = this->GetMultiThreader();
 
     CirclesListSizeType circles = 0;
 
@@ -227,10 +343,42 @@ HoughTransform2DCirclesImageFilter<TInputPixelType, TOutputPixelType, TRadiusPix
     // Break out of "forever loop" as soon as the requested number of circles is found.
     for (;;)
     {
-      minMaxCalculator->SetImage(postProcessImage);
-      minMaxCalculator->ComputeMaximum();
+      // Find the first occurrence (in scan order) of the maximum of the
+      // blurred accumulator. The sub-region maxima are computed in parallel;
+      // the scan-order tie-break makes the merged result independent of the
+      // region split and of the order in which the threads finish.
+      float                        maximum = NumericTraits<float>::NonpositiveMin();
+      InternalImageType::IndexType indexOfMaximum = postProcessRegion.GetIndex();
+      std::mutex                   maximumMutex;
+
+      multiThreader->ParallelizeImageRegion<2>(
+        postProcessRegion,
+        [&postProcessImage, &maximum, &indexOfMaximum, &maximumMutex](const InternalImageType::RegionType & subRegion) {
+          float                        localMaximum = NumericTraits<float>::NonpositiveMin();
+          InternalImageType::IndexType localIndex = subRegion.GetIndex();
+
+          ImageRegionConstIteratorWithIndex<InternalImageType> it_input(postProcessImage, subRegion);
+          for (it_input.GoToBegin(); !it_input.IsAtEnd(); ++it_input)
+          {
+            if (it_input.Get() > localMaximum)
+            {
+              localMaximum = it_input.Get();
+              localIndex = it_input.GetIndex();
+            }
+          }
 
-      if (minMaxCalculator->GetMaximum() <= 0)
+          const std::lock_guard<std::mutex> lockGuard(maximumMutex);
+          if (localMaximum > maximum ||
+              (localMaximum == maximum && (localIndex[1] < indexOfMaximum[1] ||
+                                           (localIndex[1] == indexOfMaximum[1] && localIndex[0] < indexOfMaximum[0]))))
+          {
+            maximum = localMaximum;
+            indexOfMaximum = localIndex;
+          }
+        },
+        nullptr);
+
+      if (maximum <= 0)
       {
         // When all pixel values in 'postProcessImage' are zero or less, no more circles
         // should be found. Note that a zero in 'postProcessImage' might correspond to a
@@ -239,8 +387,6 @@ HoughTransform2DCirclesImageFilter<TInputPixelType, TOutputPixelType, TRadiusPix
         break;
       }
 
-      const InternalImageType::IndexType indexOfMaximum = minMaxCalculator->GetIndexOfMaximum();
-
       // Create a Circle Spatial Object
       const auto Circle = CircleType::New();
       Circle->SetId(static_cast<int>(circles));
@@ -22,9 +22,13 @@
 #include "itkImageRegionIteratorWithIndex.h"
 #include "itkDiscreteGaussianImageFilter.h"
 #include "itkMinimumMaximumImageCalculator.h"
+#include "itkMultiThreaderBase.h"
 #include "itkCastImageFilter.h"
 #include "itkMath.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace itk
 {
 
@@ -104,24 +108,70 @@ HoughTransform2DLinesImageFilter<TInputPixelType, TOutputPixelType>::GenerateDat
 
   const double nPI = 4.0 * std::atan(1.0);
 
+  // Only the pixels above the intensity threshold vote, so gather their
+  // indices once instead of re-scanning the whole frame per angle.
+  std::vector<Index<2>> candidatePixels;
+
   ImageRegionConstIteratorWithIndex<InputImageType> image_it(inputImage, inputImage->GetRequestedRegion());
-  image_it.GoToBegin();
+  for (image_it.GoToBegin(); !image_it.IsAtEnd(); ++image_it)
+  {
+    if (image_it.Get() > m_Threshold)
+    {
+      candidatePixels.push_back(image_it.GetIndex());
+    }
+  }
 
-  Index<2> index;
+  if (candidatePixels.empty())
+  {
+    return;
+  }
 
-  while (!image_it.IsAtEnd())
+  // Tabulate the swept angles together with their trigonometry and their
+  // accumulator row (the m_Theta index), which depends on the angle only.
+  // Hoisting the sine and cosine out of the per-pixel loop does not change
+  // any vote.
+  struct SweptAngle
   {
-    if (image_it.Get() > m_Threshold)
+    double         cosine;
+    double         sine;
+    IndexValueType theta;
+  };
+  std::vector<SweptAngle> sweptAngles;
+
+  for (double angle = -nPI; angle < nPI; angle += nPI / m_AngleResolution)
+  {
+    // m_Theta
+    const auto theta = (IndexValueType)((m_AngleResolution / 2) + m_AngleResolution * angle / (2 * nPI));
+    sweptAngles.push_back({ std::cos(angle), std::sin(angle), theta });
+  }
+
+  const auto maximumR = (IndexValueType)outputImage->GetBufferedRegion().GetSize()[0];
+
+  // Accumulates the votes of every candidate pixel for the angles whose
+  // m_Theta index lies in [thetaBegin, thetaEnd). Each vote adds 1 to an
+  // accumulator bin, so the result depends only on how many votes each bin
+  // receives, not on their order: accumulating the theta bands in parallel
+  // is bit-for-bit identical to the serial scan. The bands write to mutually
+  // exclusive accumulator rows.
+  const auto accumulateThetaBand = [&outputImage, &candidatePixels, &sweptAngles, maximumR](
+                                     const IndexValueType thetaBegin, const IndexValueType thetaEnd) {
+    Index<2> index;
+
+    for (const SweptAngle & sweptAngle : sweptAngles)
     {
-      for (double angle = -nPI; angle < nPI; angle += nPI / m_AngleResolution)
+      if (sweptAngle.theta < thetaBegin || sweptAngle.theta >= thetaEnd)
+      {
+        continue;
+      }
+      index[1] = sweptAngle.theta;
+
+      for (const Index<2> & pixelIndex : candidatePixels)
       {
         index[0] =
           // m_R
-          (IndexValueType)(image_it.GetIndex()[0] * std::cos(angle) + image_it.GetIndex()[1] * std::sin(angle));
-        // m_Theta
-        index[1] = (IndexValueType)((m_AngleResolution / 2) + m_AngleResolution * angle / (2 * nPI));
+          (IndexValueType)(pixelIndex[0] * sweptAngle.cosine + pixelIndex[1] * sweptAngle.sine);
 
-        if (index[0] > 0 && index[0] <= (IndexValueType)outputImage->GetBufferedRegion().GetSize()[0])
+        if (index[0] > 0 && index[0] <= maximumR)
         // The preceding "if" should be replaceable with "if (
         // outputImage->GetBufferedRegion().IsInside(index) )" but
         // the algorithm fails if it is
@@ -130,7 +180,30 @@ HoughTransform2DLinesImageFilter<TInputPixelType, TOutputPixelType>::GenerateDat
         }
       }
     }
-    ++image_it;
+  };
+
+  // The m_Theta indices are nondecreasing along the angle sweep, from the
+  // row of the first swept angle to the row of the last one.
+  const IndexValueType thetaFirst = sweptAngles.front().theta;
+  const IndexValueType thetaSpan = sweptAngles.back().theta - thetaFirst + 1;
+
+  const IndexValueType numberOfBands = std::min(static_cast<IndexValueType>(this->GetNumberOfWorkUnits()), thetaSpan);
+
+  if (numberOfBands <= 1)
+  {
+    accumulateThetaBand(thetaFirst, thetaFirst + thetaSpan);
+  }
+  else
+  {
+    this->GetMultiThreader()->ParallelizeArray(
+      0,
+      static_cast<SizeValueType>(numberOfBands),
+      [thetaFirst, thetaSpan, numberOfBands, &accumulateThetaBand](SizeValueType band) {
+        const IndexValueType thetaBegin = thetaFirst + static_cast<IndexValueType>(band) * thetaSpan / numberOfBands;
+        const IndexValueType thetaEnd = thetaFirst + (static_cast<IndexValueType>(band) + 1) * thetaSpan / numberOfBands;
+        accumulateThetaBand(thetaBegin, thetaEnd);
+      },
+      nullptr);
   }
 }
 
@@ -249,6 +249,40 @@ protected:
   GenerateOutputInformation() override;
 
 private:
+  /** Detects images whose pixel access flattens to a direct load or store
+   * on a contiguous buffer of InternalPixelType. The accessor must be
+   * stateless (empty), which rules out VectorImage and element-selection
+   * adaptors that need stride or component state. Plain itk::Image and
+   * ImageAdaptors with stateless accessors qualify. */
+  template <typename TImageType, typename = void>
+  struct FlatPixelAccess : std::false_type
+  {};
+  template <typename TImageType>
+  struct FlatPixelAccess<TImageType,
+                         typename std::enable_if<std::is_empty<typename TImageType::AccessorType>::value>::type>
+    : std::true_type
+  {};
+
+  /** True when all images support flat pixel access, so that every scanline
+   * of a region is a contiguous run in the respective buffers. */
+  static constexpr bool ImagesAreContiguous = FlatPixelAccess<TInputImage1>::value &&
+                                              FlatPixelAccess<TInputImage2>::value &&
+                                              FlatPixelAccess<TOutputImage>::value;
+
+  /** Apply the functor to one thread's region, span by span, through raw
+   * buffer pointers and inline stateless accessors. Only selected when all
+   * images support flat pixel access: the tight per-span loops let the
+   * compiler auto-vectorize stateless functors (Add, Multiply, ...). */
+  template <typename TFunctor>
+  void
+  ProcessRegionWithFunctor(const TFunctor &, const OutputImageRegionType & outputRegionForThread, std::true_type);
+
+  /** Generic overload for image adaptors and VectorImage; iterates with
+   * scanline iterators. */
+  template <typename TFunctor>
+  void
+  ProcessRegionWithFunctor(const TFunctor &, const OutputImageRegionType & outputRegionForThread, std::false_type);
+
   std::function<void(const OutputImageRegionType &)> m_DynamicThreadedGenerateDataFunction;
 };
 } // end namespace itk
@@ -105,6 +105,14 @@ CastImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateDataDispatche
 
   this->CallCopyOutputRegionToInputRegion(inputRegionForThread, outputRegionForThread);
 
+  // When running in place the output was grafted from the input and the
+  // pixel buffer already holds the right values; the copy would be a
+  // full self-copy.
+  if (this->GetRunningInPlace())
+  {
+    return;
+  }
+
   ImageAlgorithm::Copy(inputPtr, outputPtr, inputRegionForThread, outputRegionForThread);
 }
 
@@ -0,0 +1,150 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkFusedGeneratorImageFilter_h
+#define itkFusedGeneratorImageFilter_h
+
+#include "itkUnaryGeneratorImageFilter.h"
+
+#include <utility>
+
+namespace itk
+{
+namespace Functor
+{
+/** \class Composed
+ * \brief Applies one per-pixel functor to the result of another.
+ *
+ * The first functor may take any number of arguments; the second must be
+ * unary. Nesting Composed instances, most conveniently through
+ * MakeComposedFunctor, fuses a whole chain of elementwise stages into a
+ * single functor, so one pass over the buffer replaces a pipeline of
+ * intermediate volumes.
+ *
+ * \ingroup ITKImageFilterBase
+ */
+template <typename TFirstFunctor, typename TSecondFunctor>
+class Composed
+{
+public:
+  Composed() = default;
+
+  Composed(TFirstFunctor first, TSecondFunctor second)
+    : m_First(std::move(first))
+    , m_Second(std::move(second))
+  {}
+
+  template <typename... TPixels>
+  auto
+  operator()(const TPixels &... pixels) const -> decltype(std::declval<const TSecondFunctor &>()(
+    std::declval<const TFirstFunctor &>()(pixels...)))
+  {
+    return m_Second(m_First(pixels...));
+  }
+
+private:
+  TFirstFunctor  m_First;
+  TSecondFunctor m_Second;
+};
+
+/** Compose per-pixel functors into a single functor that applies them left
+ * to right. With one argument the functor is returned unchanged. The result
+ * can be passed to the SetFunctor method of any generator image filter;
+ * intermediate values have the return types of the individual stages and
+ * never touch memory. */
+template <typename TFunctor>
+TFunctor
+MakeComposedFunctor(TFunctor functor)
+{
+  return functor;
+}
+
+template <typename TFirstFunctor, typename TSecondFunctor, typename... TRemainingFunctors>
+auto
+MakeComposedFunctor(TFirstFunctor first, TSecondFunctor second, TRemainingFunctors... remaining)
+{
+  // By-value parameters decay plain functions to function pointers.
+  return MakeComposedFunctor(Composed<TFirstFunctor, TSecondFunctor>(std::move(first), std::move(second)),
+                             std::move(remaining)...);
+}
+} // end namespace Functor
+
+/** \class FusedGeneratorImageFilter
+ * \brief Applies a chain of per-pixel operations in a single pass.
+ *
+ * A pipeline of elementwise filters, such as cast, rescale and threshold,
+ * materializes a full intermediate image between every pair of stages.
+ * This filter fuses the stages instead: SetFunctors composes the given
+ * functors, lambdas or function pointers left to right into one functor
+ * and runs it through the UnaryGeneratorImageFilter machinery, so the
+ * input buffer is read once and the output buffer written once however
+ * long the chain is.
+ *
+ * Intermediate values are held in registers with the return types of the
+ * individual stages; insert an explicit widening stage where an
+ * intermediate filter of the unfused pipeline would have used a wider
+ * pixel type.
+ *
+ * Chains starting with a two-input stage can be fused the same way by
+ * passing Functor::MakeComposedFunctor(binaryStage, unaryStages...) to
+ * BinaryGeneratorImageFilter::SetFunctor.
+ *
+ * \sa UnaryGeneratorImageFilter
+ * \sa BinaryGeneratorImageFilter
+ *
+ * \ingroup ITKImageFilterBase MultiThreaded
+ */
+template <typename TInputImage, typename TOutputImage>
+class ITK_TEMPLATE_EXPORT FusedGeneratorImageFilter : public UnaryGeneratorImageFilter<TInputImage, TOutputImage>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(FusedGeneratorImageFilter);
+
+  /** Standard class typedefs. */
+  using Self = FusedGeneratorImageFilter;
+  using Superclass = UnaryGeneratorImageFilter<TInputImage, TOutputImage>;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(FusedGeneratorImageFilter, UnaryGeneratorImageFilter);
+
+#if !defined(ITK_WRAPPING_PARSER)
+  /** Set the per-pixel stages, applied left to right. Each stage may be a
+   * functor object, lambda or function pointer; every stage after the
+   * first must be callable with the previous stage's return value. A
+   * single copy of each stage is shared by all threads, so the stages
+   * must be concurrent thread-safe. */
+  template <typename... TFunctors>
+  void
+  SetFunctors(TFunctors... functors)
+  {
+    static_assert(sizeof...(TFunctors) > 0, "At least one functor is required.");
+    this->SetFunctor(Functor::MakeComposedFunctor(std::move(functors)...));
+  }
+#endif // !defined( ITK_WRAPPING_PARSER )
+
+protected:
+  FusedGeneratorImageFilter() = default;
+  ~FusedGeneratorImageFilter() override = default;
+};
+} // end namespace itk
+
+#endif
@@ -0,0 +1,132 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkMaskRegionOccupancyGrid_h
+#define itkMaskRegionOccupancyGrid_h
+
+#include "itkMultiThreaderBase.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace itk
+{
+/**
+ * \class MaskRegionOccupancyGrid
+ * \brief Per-tile occupancy classification of a mask image.
+ *
+ * Partitions a region of a mask image into rectangular tiles and records for
+ * each tile whether every pixel equals the masking value (AllOutside), no
+ * pixel does (AllInside), or both kinds occur (Mixed). The grid is computed
+ * in a single pass over the mask; any sub-region of the computed region can
+ * afterwards be classified from the tile records alone.
+ *
+ * Filters with a masked fast path use this to skip the per-pixel mask test
+ * on uniform parts of their output: all-outside regions can be filled with
+ * the outside value without reading the inputs at all, and all-inside
+ * regions can run an unchecked loop. The classification is conservative --
+ * a region overlapping differently classified or uncomputed tiles is
+ * reported as Mixed, which always falls back to the per-pixel path.
+ *
+ * \sa MaskImageFilter
+ * \ingroup ITKImageFilterBase
+ */
+template <typename TMaskImage>
+class ITK_TEMPLATE_EXPORT MaskRegionOccupancyGrid
+{
+public:
+  using MaskImageType = TMaskImage;
+  using MaskPixelType = typename TMaskImage::PixelType;
+  using RegionType = typename TMaskImage::RegionType;
+  using SizeType = typename TMaskImage::SizeType;
+  using IndexType = typename TMaskImage::IndexType;
+
+  static constexpr unsigned int ImageDimension = TMaskImage::ImageDimension;
+
+  /** Classification of a tile or of a queried region. */
+  enum class OccupancyEnum : uint8_t
+  {
+    AllOutside, ///< every pixel equals the masking value
+    AllInside,  ///< no pixel equals the masking value
+    Mixed       ///< both kinds of pixels, or not covered by the grid
+  };
+
+  /** Default edge length of the tiles, in pixels per dimension. */
+  static constexpr SizeValueType DefaultTileLength = 64;
+
+  MaskRegionOccupancyGrid() = default;
+
+  /** Classify the tiles covering \c region in one pass over the mask. The
+   * tiles are distributed over the work units of \c threader when one is
+   * given, and processed serially otherwise. */
+  void
+  Compute(const MaskImageType * mask,
+          const RegionType &    region,
+          const MaskPixelType & maskingValue,
+          const SizeType &      tileSize,
+          MultiThreaderBase *   threader = nullptr);
+
+  /** Same as above with all tile edges set to DefaultTileLength. */
+  void
+  Compute(const MaskImageType * mask,
+          const RegionType &    region,
+          const MaskPixelType & maskingValue,
+          MultiThreaderBase *   threader = nullptr)
+  {
+    SizeType tileSize;
+    tileSize.Fill(DefaultTileLength);
+    this->Compute(mask, region, maskingValue, tileSize, threader);
+  }
+
+  /** Conservatively classify a sub-region of the computed region from the
+   * tile grid alone. Regions reaching outside the computed region, or
+   * queried before Compute() has run, are reported as Mixed. */
+  OccupancyEnum
+  ClassifyRegion(const RegionType & region) const;
+
+  /** The pixel region the grid was computed over. */
+  const RegionType &
+  GetComputedRegion() const
+  {
+    return m_Region;
+  }
+
+  /** The tile size the grid was computed with. */
+  const SizeType &
+  GetTileSize() const
+  {
+    return m_TileSize;
+  }
+
+private:
+  /** Linear offset of a tile in m_Tiles; dimension 0 is the fastest. */
+  SizeValueType
+  ComputeTileOffset(const IndexType & tileIndex) const;
+
+  RegionType                 m_Region;
+  SizeType                   m_TileSize;
+  SizeType                   m_GridSize;
+  std::vector<OccupancyEnum> m_Tiles;
+  bool                       m_Computed{ false };
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkMaskRegionOccupancyGrid.hxx"
+#endif
+
+#endif
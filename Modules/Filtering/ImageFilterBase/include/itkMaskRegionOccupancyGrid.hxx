@@ -0,0 +1,202 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkMaskRegionOccupancyGrid_hxx
+#define itkMaskRegionOccupancyGrid_hxx
+
+#include "itkMaskRegionOccupancyGrid.h"
+#include "itkImageScanlineIterator.h"
+
+#include <algorithm>
+
+namespace itk
+{
+
+template <typename TMaskImage>
+void
+MaskRegionOccupancyGrid<TMaskImage>::Compute(const MaskImageType * mask,
+                                             const RegionType &    region,
+                                             const MaskPixelType & maskingValue,
+                                             const SizeType &      tileSize,
+                                             MultiThreaderBase *   threader)
+{
+  m_Region = region;
+  m_TileSize = tileSize;
+
+  SizeValueType numberOfTiles = 1;
+  for (unsigned int d = 0; d < ImageDimension; ++d)
+  {
+    itkAssertOrThrowMacro(tileSize[d] > 0, "Tile size must be positive in every dimension");
+    m_GridSize[d] = (region.GetSize(d) + tileSize[d] - 1) / tileSize[d];
+    numberOfTiles *= m_GridSize[d];
+  }
+  m_Tiles.resize(numberOfTiles);
+
+  // Classify one tile; disjoint tiles write disjoint elements of m_Tiles,
+  // so no synchronization is needed
+  auto classifyTile = [this, mask, maskingValue](const IndexType & tileIndex) {
+    RegionType tileRegion;
+    for (unsigned int d = 0; d < ImageDimension; ++d)
+    {
+      const IndexValueType start = m_Region.GetIndex(d) + tileIndex[d] * static_cast<IndexValueType>(m_TileSize[d]);
+      tileRegion.SetIndex(d, start);
+      tileRegion.SetSize(
+        d, std::min<SizeValueType>(m_TileSize[d], m_Region.GetIndex(d) + m_Region.GetSize(d) - start));
+    }
+
+    bool seenInside = false;
+    bool seenOutside = false;
+
+    ImageScanlineConstIterator<MaskImageType> it(mask, tileRegion);
+    while (!it.IsAtEnd() && !(seenInside && seenOutside))
+    {
+      while (!it.IsAtEndOfLine())
+      {
+        if (it.Get() == maskingValue)
+        {
+          seenOutside = true;
+        }
+        else
+        {
+          seenInside = true;
+        }
+        ++it;
+      }
+      it.NextLine();
+    }
+
+    OccupancyEnum occupancy = OccupancyEnum::Mixed;
+    if (!seenInside)
+    {
+      occupancy = OccupancyEnum::AllOutside;
+    }
+    else if (!seenOutside)
+    {
+      occupancy = OccupancyEnum::AllInside;
+    }
+    m_Tiles[this->ComputeTileOffset(tileIndex)] = occupancy;
+  };
+
+  // Walk a chunk of the tile grid with an odometer over the tile indices
+  RegionType tileGridRegion;
+  tileGridRegion.SetSize(m_GridSize);
+  auto classifyChunk = [&classifyTile](const RegionType & chunk) {
+    IndexType           tileIndex = chunk.GetIndex();
+    const SizeValueType chunkTiles = chunk.GetNumberOfPixels();
+    for (SizeValueType i = 0; i < chunkTiles; ++i)
+    {
+      classifyTile(tileIndex);
+      for (unsigned int d = 0; d < ImageDimension; ++d)
+      {
+        if (++tileIndex[d] < chunk.GetIndex(d) + static_cast<IndexValueType>(chunk.GetSize(d)))
+        {
+          break;
+        }
+        tileIndex[d] = chunk.GetIndex(d);
+      }
+    }
+  };
+
+  if (threader != nullptr)
+  {
+    threader->template ParallelizeImageRegion<ImageDimension>(tileGridRegion, classifyChunk, nullptr);
+  }
+  else
+  {
+    classifyChunk(tileGridRegion);
+  }
+
+  m_Computed = true;
+}
+
+template <typename TMaskImage>
+auto
+MaskRegionOccupancyGrid<TMaskImage>::ClassifyRegion(const RegionType & region) const -> OccupancyEnum
+{
+  if (!m_Computed || !m_Region.IsInside(region))
+  {
+    return OccupancyEnum::Mixed;
+  }
+
+  // Tile index range covered by the region
+  IndexType firstTile;
+  IndexType lastTile;
+  for (unsigned int d = 0; d < ImageDimension; ++d)
+  {
+    firstTile[d] = (region.GetIndex(d) - m_Region.GetIndex(d)) / static_cast<IndexValueType>(m_TileSize[d]);
+    lastTile[d] = (region.GetIndex(d) + static_cast<IndexValueType>(region.GetSize(d)) - 1 - m_Region.GetIndex(d)) /
+                  static_cast<IndexValueType>(m_TileSize[d]);
+  }
+
+  // A tile classified as uniform is uniform on any subset, so the covered
+  // tiles just need to agree; any Mixed tile makes the region Mixed
+  bool seenInside = false;
+  bool seenOutside = false;
+
+  IndexType     tileIndex = firstTile;
+  SizeValueType coveredTiles = 1;
+  for (unsigned int d = 0; d < ImageDimension; ++d)
+  {
+    coveredTiles *= static_cast<SizeValueType>(lastTile[d] - firstTile[d] + 1);
+  }
+  for (SizeValueType i = 0; i < coveredTiles; ++i)
+  {
+    switch (m_Tiles[this->ComputeTileOffset(tileIndex)])
+    {
+      case OccupancyEnum::AllInside:
+        seenInside = true;
+        break;
+      case OccupancyEnum::AllOutside:
+        seenOutside = true;
+        break;
+      case OccupancyEnum::Mixed:
+      default:
+        return OccupancyEnum::Mixed;
+    }
+    if (seenInside && seenOutside)
+    {
+      return OccupancyEnum::Mixed;
+    }
+    for (unsigned int d = 0; d < ImageDimension; ++d)
+    {
+      if (++tileIndex[d] <= lastTile[d])
+      {
+        break;
+      }
+      tileIndex[d] = firstTile[d];
+    }
+  }
+
+  return seenOutside ? OccupancyEnum::AllOutside : OccupancyEnum::AllInside;
+}
+
+template <typename TMaskImage>
+SizeValueType
+MaskRegionOccupancyGrid<TMaskImage>::ComputeTileOffset(const IndexType & tileIndex) const
+{
+  SizeValueType offset = 0;
+  SizeValueType stride = 1;
+  for (unsigned int d = 0; d < ImageDimension; ++d)
+  {
+    offset += static_cast<SizeValueType>(tileIndex[d]) * stride;
+    stride *= m_GridSize[d];
+  }
+  return offset;
+}
+
+} // end namespace itk
+#endif
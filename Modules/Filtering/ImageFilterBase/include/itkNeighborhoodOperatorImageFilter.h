@@ -23,6 +23,9 @@
 #include "itkImage.h"
 #include "itkZeroFluxNeumannBoundaryCondition.h"
 
+#include <type_traits>
+#include <vector>
+
 namespace itk
 {
 /** \class NeighborhoodOperatorImageFilter
@@ -184,6 +187,32 @@ protected:
   }
 
 private:
+  /** True when pixels map one-to-one onto buffer elements of the same
+   * arithmetic type, so the interior of the image can be swept through raw
+   * buffer pointers. */
+  static constexpr bool FlatScalarPixels =
+    std::is_arithmetic<InputPixelType>::value && std::is_same<InputPixelType, InputInternalPixelType>::value &&
+    std::is_arithmetic<OutputPixelType>::value && std::is_same<OutputPixelType, OutputInternalPixelType>::value;
+
+  /** Apply the operator over one interior block through raw buffer pointers
+   * with precomputed neighbor offsets. The block is known not to touch the
+   * buffer boundary, so no per-pixel bounds checks are performed. */
+  void
+  ProcessInteriorBlock(const OutputImageRegionType &        blockRegion,
+                       const std::vector<OffsetValueType> & neighborOffsets,
+                       std::true_type);
+
+  /** Fallback for non-scalar pixel types; defers to the checked path. */
+  void
+  ProcessInteriorBlock(const OutputImageRegionType &        blockRegion,
+                       const std::vector<OffsetValueType> & neighborOffsets,
+                       std::false_type);
+
+  /** Apply the operator over one block with the boundary-checked
+   * neighborhood iterator and the configured boundary condition. */
+  void
+  ProcessCheckedBlock(const OutputImageRegionType & blockRegion);
+
   /** Internal operator used to filter the image. */
   OutputNeighborhoodType m_Operator;
 
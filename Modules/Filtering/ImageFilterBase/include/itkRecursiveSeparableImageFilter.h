@@ -140,6 +140,20 @@ protected:
   void
   FilterDataArray(RealType * outs, const RealType * data, RealType * scratch, SizeValueType ln) const;
 
+  /** Apply the Recursive Filter to a batch of lines stored interleaved:
+   * element i of line b lives at data[i * lanes + b]. Keeping the
+   * recurrence state of several independent lines adjacent in memory
+   * replaces the serial data dependence of a single line with \c lanes
+   * independent recurrences per step, which compilers turn into SIMD
+   * lanes. The buffers must hold ln * lanes elements; scratch handling
+   * matches FilterDataArray. */
+  void
+  FilterDataArrayBatch(RealType *          outs,
+                       const RealType *    data,
+                       RealType *          scratch,
+                       const SizeValueType ln,
+                       const unsigned int  lanes) const;
+
 protected:
   /** Causal coefficients that multiply the input data. */
   ScalarRealType m_N0;
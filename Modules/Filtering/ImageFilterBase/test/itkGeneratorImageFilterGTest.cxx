@@ -19,6 +19,7 @@
 #include "itkUnaryGeneratorImageFilter.h"
 #include "itkBinaryGeneratorImageFilter.h"
 #include "itkTernaryGeneratorImageFilter.h"
+#include "itkFusedGeneratorImageFilter.h"
 #include "itkImage.h"
 #include "itkImageRegionIterator.h"
 
@@ -444,3 +445,86 @@ TEST(TernaryGeneratorImageFilter, Constants)
 
   EXPECT_NEAR(103.0, outputImage->GetPixel(idx), 1e-8);
 }
+
+
+TEST(FusedGeneratorImageFilter, SetGetBasic)
+{
+
+  using Utils = Utilities<3>;
+
+  using FilterType = itk::FusedGeneratorImageFilter<Utils::ImageType, Utils::ImageType>;
+  auto filter = FilterType::New();
+  filter->Print(std::cout);
+
+  EXPECT_STREQ("FusedGeneratorImageFilter", filter->GetNameOfClass());
+  EXPECT_STREQ("UnaryGeneratorImageFilter", filter->Superclass::GetNameOfClass());
+}
+
+
+TEST(FusedGeneratorImageFilter, SetFunctors)
+{
+
+  using Utils = Utilities<3, float>;
+
+  auto image = Utils::CreateImage();
+  image->FillBuffer(2.0);
+
+
+  using FilterType = itk::FusedGeneratorImageFilter<Utils::ImageType, Utils::ImageType>;
+
+  auto filter = FilterType::New();
+  filter->SetInput(image);
+
+  Utils::ImageType::Pointer outputImage;
+
+  Utils::IndexType idx;
+  idx.Fill(0);
+
+  // a single stage behaves like a plain unary generator
+  filter->SetFunctors(Utils::MyUnaryFunction);
+  EXPECT_NO_THROW(filter->Update());
+
+  outputImage = filter->GetOutput();
+  ASSERT_TRUE(outputImage.IsNotNull());
+
+  EXPECT_NEAR(12.0, outputImage->GetPixel(idx), 1e-8);
+
+  // stages are applied left to right: ((2 + 10) * 3) - 1
+  filter->SetFunctors(
+    Utils::MyUnaryFunction, [](float v) { return v * 3.0f; }, [](const float & v) { return v - 1.0f; });
+  EXPECT_NO_THROW(filter->Update());
+
+  outputImage = filter->GetOutput();
+  ASSERT_TRUE(outputImage.IsNotNull());
+
+  EXPECT_NEAR(35.0, outputImage->GetPixel(idx), 1e-8);
+}
+
+
+TEST(BinaryGeneratorImageFilter, ComposedFunctor)
+{
+
+  using Utils = Utilities<3, float>;
+
+  auto image = Utils::CreateImage();
+  image->FillBuffer(2.0);
+
+
+  using FilterType = itk::BinaryGeneratorImageFilter<Utils::ImageType, Utils::ImageType, Utils::ImageType>;
+
+  auto filter = FilterType::New();
+  filter->SetInput1(image);
+  filter->SetConstant2(4.0f);
+
+  // a binary first stage with a fused unary tail: (2 + 3 * 4) + 10
+  filter->SetFunctor(itk::Functor::MakeComposedFunctor(Utils::MyBinaryFunction1, Utils::MyUnaryFunction));
+  EXPECT_NO_THROW(filter->Update());
+
+  Utils::ImageType::Pointer outputImage = filter->GetOutput();
+  ASSERT_TRUE(outputImage.IsNotNull());
+
+  Utils::IndexType idx;
+  idx.Fill(0);
+
+  EXPECT_NEAR(24.0, outputImage->GetPixel(idx), 1e-8);
+}
@@ -0,0 +1,176 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkMaskRegionOccupancyGrid.h"
+#include "itkImage.h"
+#include "itkImageRegionConstIteratorWithIndex.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkTestingMacros.h"
+
+// Brute-force classification of a mask region, for cross-checking the grid
+template <typename TMaskImage>
+typename itk::MaskRegionOccupancyGrid<TMaskImage>::OccupancyEnum
+BruteForceClassify(const TMaskImage *                         mask,
+                   const typename TMaskImage::RegionType &    region,
+                   const typename TMaskImage::PixelType &     maskingValue)
+{
+  using OccupancyEnum = typename itk::MaskRegionOccupancyGrid<TMaskImage>::OccupancyEnum;
+
+  bool seenInside = false;
+  bool seenOutside = false;
+
+  itk::ImageRegionConstIteratorWithIndex<TMaskImage> it(mask, region);
+  for (it.GoToBegin(); !it.IsAtEnd(); ++it)
+  {
+    if (it.Get() == maskingValue)
+    {
+      seenOutside = true;
+    }
+    else
+    {
+      seenInside = true;
+    }
+  }
+  if (seenInside && seenOutside)
+  {
+    return OccupancyEnum::Mixed;
+  }
+  return seenOutside ? OccupancyEnum::AllOutside : OccupancyEnum::AllInside;
+}
+
+int
+itkMaskRegionOccupancyGridTest(int, char *[])
+{
+  constexpr unsigned int Dimension = 2;
+  using MaskImageType = itk::Image<unsigned char, Dimension>;
+  using OccupancyGridType = itk::MaskRegionOccupancyGrid<MaskImageType>;
+  using OccupancyEnum = OccupancyGridType::OccupancyEnum;
+  using RegionType = MaskImageType::RegionType;
+
+  MaskImageType::SizeType size;
+  size[0] = 100;
+  size[1] = 70;
+
+  // Mask holding a single filled rectangle: [32,79] x [16,47]
+  auto mask = MaskImageType::New();
+  mask->SetRegions(size);
+  mask->Allocate(true);
+
+  RegionType foregroundRegion;
+  foregroundRegion.SetIndex(0, 32);
+  foregroundRegion.SetIndex(1, 16);
+  foregroundRegion.SetSize(0, 48);
+  foregroundRegion.SetSize(1, 32);
+  itk::ImageRegionIteratorWithIndex<MaskImageType> fgIt(mask, foregroundRegion);
+  for (fgIt.GoToBegin(); !fgIt.IsAtEnd(); ++fgIt)
+  {
+    fgIt.Set(1);
+  }
+
+  OccupancyGridType grid;
+
+  // Before Compute() everything must be conservatively Mixed
+  ITK_TEST_EXPECT_TRUE(grid.ClassifyRegion(mask->GetBufferedRegion()) == OccupancyEnum::Mixed);
+
+  MaskImageType::SizeType tileSize;
+  tileSize.Fill(16);
+  grid.Compute(mask, mask->GetBufferedRegion(), 0, tileSize);
+
+  ITK_TEST_EXPECT_TRUE(grid.GetComputedRegion() == mask->GetBufferedRegion());
+  ITK_TEST_EXPECT_TRUE(grid.GetTileSize() == tileSize);
+
+  // Tile-aligned queries: fully outside, fully inside, straddling
+  RegionType query;
+  query.SetIndex(0, 0);
+  query.SetIndex(1, 0);
+  query.SetSize(0, 32);
+  query.SetSize(1, 16);
+  ITK_TEST_EXPECT_TRUE(grid.ClassifyRegion(query) == OccupancyEnum::AllOutside);
+
+  query.SetIndex(0, 32);
+  query.SetIndex(1, 16);
+  query.SetSize(0, 48);
+  query.SetSize(1, 32);
+  ITK_TEST_EXPECT_TRUE(grid.ClassifyRegion(query) == OccupancyEnum::AllInside);
+
+  query.SetIndex(0, 16);
+  query.SetIndex(1, 16);
+  query.SetSize(0, 32);
+  query.SetSize(1, 16);
+  ITK_TEST_EXPECT_TRUE(grid.ClassifyRegion(query) == OccupancyEnum::Mixed);
+
+  // A query reaching outside the computed region must be Mixed
+  query.SetIndex(0, 96);
+  query.SetIndex(1, 64);
+  query.SetSize(0, 16);
+  query.SetSize(1, 16);
+  ITK_TEST_EXPECT_TRUE(grid.ClassifyRegion(query) == OccupancyEnum::Mixed);
+
+  // The grid classification must never contradict the mask: a uniform
+  // answer from the grid has to match the brute-force answer exactly
+  for (itk::IndexValueType y = 0; y < 70; y += 7)
+  {
+    for (itk::IndexValueType x = 0; x < 100; x += 11)
+    {
+      query.SetIndex(0, x);
+      query.SetIndex(1, y);
+      query.SetSize(0, std::min<itk::SizeValueType>(23, 100 - x));
+      query.SetSize(1, std::min<itk::SizeValueType>(13, 70 - y));
+
+      const OccupancyEnum fromGrid = grid.ClassifyRegion(query);
+      if (fromGrid != OccupancyEnum::Mixed && fromGrid != BruteForceClassify(mask.GetPointer(), query, 0))
+      {
+        std::cerr << "Test failed!" << std::endl;
+        std::cerr << "Grid classification contradicts the mask at " << query << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  // The threaded computation must produce the same grid
+  OccupancyGridType threadedGrid;
+  threadedGrid.Compute(mask, mask->GetBufferedRegion(), 0, tileSize, itk::MultiThreaderBase::New());
+  for (itk::IndexValueType y = 0; y < 70; y += 16)
+  {
+    for (itk::IndexValueType x = 0; x < 100; x += 16)
+    {
+      query.SetIndex(0, x);
+      query.SetIndex(1, y);
+      query.SetSize(0, std::min<itk::SizeValueType>(16, 100 - x));
+      query.SetSize(1, std::min<itk::SizeValueType>(16, 70 - y));
+      if (threadedGrid.ClassifyRegion(query) != grid.ClassifyRegion(query))
+      {
+        std::cerr << "Test failed!" << std::endl;
+        std::cerr << "Serial and threaded grids disagree at " << query << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  // A non-zero masking value inverts the classification of uniform tiles
+  OccupancyGridType invertedGrid;
+  invertedGrid.Compute(mask, mask->GetBufferedRegion(), 1, tileSize);
+  query.SetIndex(0, 0);
+  query.SetIndex(1, 0);
+  query.SetSize(0, 32);
+  query.SetSize(1, 16);
+  ITK_TEST_EXPECT_TRUE(invertedGrid.ClassifyRegion(query) == OccupancyEnum::AllInside);
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
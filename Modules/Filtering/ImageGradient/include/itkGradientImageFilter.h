@@ -186,12 +186,16 @@ private:
   GenerateOutputInformation() override;
 
   // An overloaded method which may transform the gradient to a
-  // physical vector and converts to the correct output pixel type.
+  // physical vector and converts to the correct output pixel type. The
+  // transform flag is precomputed per run so identity direction cosines
+  // skip the per-pixel matrix multiply.
   template <typename TValue>
   void
-  SetOutputPixel(ImageRegionIterator<VectorImage<TValue, OutputImageDimension>> & it, CovariantVectorType & gradient)
+  SetOutputPixel(ImageRegionIterator<VectorImage<TValue, OutputImageDimension>> & it,
+                 CovariantVectorType &                                            gradient,
+                 bool                                                             transformToPhysicalSpace)
   {
-    if (this->m_UseImageDirection)
+    if (transformToPhysicalSpace)
     {
       CovariantVectorType physicalGradient;
       it.GetImage()->TransformLocalVectorToPhysicalVector(gradient, physicalGradient);
@@ -205,10 +209,10 @@ private:
 
   template <typename T>
   void
-  SetOutputPixel(ImageRegionIterator<T> & it, CovariantVectorType & gradient)
+  SetOutputPixel(ImageRegionIterator<T> & it, CovariantVectorType & gradient, bool transformToPhysicalSpace)
   {
     // This uses the more efficient set by reference method
-    if (this->m_UseImageDirection)
+    if (transformToPhysicalSpace)
     {
       it.GetImage()->TransformLocalVectorToPhysicalVector(gradient, it.Value());
     }
@@ -169,6 +169,12 @@ GradientImageFilter<TInputImage, TOperatorValueType, TOutputValueType, TOutputIm
     x_slice[i] = std::slice(center - nit.GetStride(i), op[i].GetSize()[0], nit.GetStride(i));
   }
 
+  // The local-to-physical rotation is a no-op when the direction cosines
+  // are identity, which is the common case; detect it once here instead of
+  // multiplying every output pixel by the identity matrix.
+  const bool transformToPhysicalSpace =
+    this->m_UseImageDirection && !(outputImage->GetDirection() == OutputImageType::DirectionType::GetIdentity());
+
   CovariantVectorType gradient;
   // Process non-boundary face and then each of the boundary faces.
   // These are N-d regions which border the edge of the buffer.
@@ -189,7 +195,7 @@ GradientImageFilter<TInputImage, TOperatorValueType, TOutputValueType, TOutputIm
       // This method optionally performs a tansform for Physical
       // coordinates and potential conversion to a different output
       // pixel type.
-      this->SetOutputPixel(it, gradient);
+      this->SetOutputPixel(it, gradient, transformToPhysicalSpace);
 
       ++nit;
       ++it;
@@ -24,6 +24,7 @@
 #include "itkRecursiveGaussianImageFilter.h"
 #include "itkSqrtImageFilter.h"
 #include "itkBinaryGeneratorImageFilter.h"
+#include "itkUnaryGeneratorImageFilter.h"
 
 namespace itk
 {
@@ -160,9 +161,12 @@ protected:
 private:
   using SqrSpacingFilterType = BinaryGeneratorImageFilter<RealImageType, RealImageType, RealImageType>;
   using SqrSpacingFilterPointer = typename SqrSpacingFilterType::Pointer;
+  using SqrFirstFilterType = UnaryGeneratorImageFilter<RealImageType, RealImageType>;
+  using SqrFirstFilterPointer = typename SqrFirstFilterType::Pointer;
 
   GaussianFilterPointer   m_SmoothingFilters[ImageDimension - 1];
   DerivativeFilterPointer m_DerivativeFilter;
+  SqrFirstFilterPointer   m_SqrFirstFilter;
   SqrSpacingFilterPointer m_SqrSpacingFilter;
   SqrtFilterPointer       m_SqrtFilter;
 
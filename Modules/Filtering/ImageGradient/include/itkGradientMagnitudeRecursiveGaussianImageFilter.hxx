@@ -59,6 +59,13 @@ GradientMagnitudeRecursiveGaussianImageFilter<TInputImage,
   // run that filter in place for much efficiency
   m_SqrSpacingFilter->InPlaceOn();
 
+  // the first gradient component initializes the cumulative image directly
+  // from the smoothed derivative, so no separate accumulator has to be
+  // allocated and zero-filled
+  m_SqrFirstFilter = SqrFirstFilterType::New();
+  m_SqrFirstFilter->SetInput(m_SmoothingFilters[ImageDimension - 2]->GetOutput());
+  m_SqrFirstFilter->InPlaceOn();
+
   // input of SqrtFilter is the cumulative image - we can't set it now
   m_SqrtFilter = SqrtFilterType::New();
   m_SqrtFilter->InPlaceOn();
@@ -114,6 +121,7 @@ GradientMagnitudeRecursiveGaussianImageFilter<TInputImage, TOutputImage>::SetNum
     m_SmoothingFilters[i]->SetNumberOfWorkUnits(nb);
   }
   m_DerivativeFilter->SetNumberOfWorkUnits(nb);
+  m_SqrFirstFilter->SetNumberOfWorkUnits(nb);
   m_SqrSpacingFilter->SetNumberOfWorkUnits(nb);
   m_SqrtFilter->SetNumberOfWorkUnits(nb);
 }
@@ -200,12 +208,10 @@ GradientMagnitudeRecursiveGaussianImageFilter<TInputImage, TOutputImage>::Genera
   }
 
 
-  auto cumulativeImage = CumulativeImageType::New();
-  cumulativeImage->SetRegions(inputImage->GetBufferedRegion());
-  cumulativeImage->Allocate();
-  cumulativeImage->FillBuffer(NumericTraits<InternalRealType>::ZeroValue());
-  // The output's information must match the input's information
-  cumulativeImage->CopyInformation(this->GetInput());
+  // The cumulative image holding the sum of the squared gradient components.
+  // It is created by the first gradient component below, so the peak number
+  // of live volumes stays at the smoothed derivative plus the accumulator.
+  CumulativeImagePointer cumulativeImage;
 
   m_DerivativeFilter->SetInput(inputImage);
 
@@ -234,24 +240,43 @@ GradientMagnitudeRecursiveGaussianImageFilter<TInputImage, TOutputImage>::Genera
     m_DerivativeFilter->SetDirection(dim);
 
     const double lambdaSpacing = inputImage->GetSpacing()[dim];
-    m_SqrSpacingFilter->SetFunctor([lambdaSpacing](const InternalRealType & a, const InternalRealType & b) {
-      return a + itk::Math::sqr(b / lambdaSpacing);
-    });
-    m_SqrSpacingFilter->SetInput(cumulativeImage);
-
-    // run the mini pipeline for that dimension
-    // Note: we must take care to update the requested region. Without that, a
-    // second run of the
-    // filter with a smaller input than in the first run trigger an exception,
-    // because the filter
-    // ask for a larger region than available. TODO: there should be a way to do
-    // that only once
-    // per GenerateData() call.
-    m_SqrSpacingFilter->UpdateLargestPossibleRegion();
-
-    // and user the result as the cumulative image
-    cumulativeImage = m_SqrSpacingFilter->GetOutput();
-    cumulativeImage->DisconnectPipeline();
+    if (dim == 0)
+    {
+      // The first component has nothing to accumulate onto; square the
+      // smoothed derivative in place and take the result as the accumulator
+      m_SqrFirstFilter->SetFunctor([lambdaSpacing](const InternalRealType & b) {
+        return static_cast<InternalRealType>(itk::Math::sqr(b / lambdaSpacing));
+      });
+
+      // run the mini pipeline for that dimension
+      // Note: we must take care to update the requested region. Without that, a
+      // second run of the
+      // filter with a smaller input than in the first run trigger an exception,
+      // because the filter
+      // ask for a larger region than available. TODO: there should be a way to do
+      // that only once
+      // per GenerateData() call.
+      m_SqrFirstFilter->UpdateLargestPossibleRegion();
+
+      // and use the result as the cumulative image
+      cumulativeImage = m_SqrFirstFilter->GetOutput();
+      cumulativeImage->DisconnectPipeline();
+    }
+    else
+    {
+      m_SqrSpacingFilter->SetFunctor([lambdaSpacing](const InternalRealType & a, const InternalRealType & b) {
+        return a + itk::Math::sqr(b / lambdaSpacing);
+      });
+      m_SqrSpacingFilter->SetInput(cumulativeImage);
+
+      // run the mini pipeline for that dimension (see the requested region
+      // note above)
+      m_SqrSpacingFilter->UpdateLargestPossibleRegion();
+
+      // and use the result as the cumulative image
+      cumulativeImage = m_SqrSpacingFilter->GetOutput();
+      cumulativeImage->DisconnectPipeline();
+    }
   }
   m_SqrtFilter->SetInput(cumulativeImage);
   m_SqrtFilter->GraftOutput(this->GetOutput());
@@ -315,8 +315,10 @@ GradientRecursiveGaussianImageFilter<TInputImage, TOutputImage>::GenerateData()
 
   // If the flag for using the input image direction is ON,
   // then we apply the direction correction to all the pixels
-  // of the output gradient image.
-  if (this->m_UseImageDirection)
+  // of the output gradient image. When the direction cosines are
+  // identity the correction is a no-op, so the whole pass is skipped.
+  if (this->m_UseImageDirection &&
+      !(outputImage->GetDirection() == OutputImageType::DirectionType::GetIdentity()))
   {
 
     OutputImageType *                    gradientImage = outputImage;
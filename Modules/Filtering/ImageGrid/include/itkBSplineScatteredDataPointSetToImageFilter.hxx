@@ -31,6 +31,8 @@
 #include "vnl/algo/vnl_matrix_inverse.h"
 #include "itkMath.h"
 
+#include <vector>
+
 namespace itk
 {
 
@@ -468,6 +470,17 @@ BSplineScatteredDataPointSetToImageFilter<TInputPointSet, TOutputImage>::Threade
     epsilon[i] = r[i] * this->m_Spacing[i] * this->m_BSplineEpsilon;
   }
 
+  // Per-dimension basis weight cache. The tensor-product weight of each of
+  // the (splineOrder + 1)^ImageDimension control points in the support
+  // region factorizes into one kernel value per dimension, so the kernels
+  // only need to be evaluated (splineOrder + 1) * ImageDimension times per
+  // point instead of once per dimension for every support offset.
+  std::vector<RealType> basisWeights1D[ImageDimension];
+  for (unsigned int i = 0; i < ImageDimension; ++i)
+  {
+    basisWeights1D[i].resize(this->m_SplineOrder[i] + 1);
+  }
+
   // Determine which points should be handled by this particular thread.
 
   ThreadIdType numberOfWorkUnits = this->GetNumberOfWorkUnits();
@@ -509,45 +522,53 @@ BSplineScatteredDataPointSetToImageFilter<TInputPointSet, TOutputImage>::Threade
       }
     }
 
-    RealType w2Sum = 0.0;
-    for (ItW.GoToBegin(); !ItW.IsAtEnd(); ++ItW)
+    for (unsigned int i = 0; i < ImageDimension; ++i)
     {
-      RealType                          B = 1.0;
-      typename RealImageType::IndexType idx = ItW.GetIndex();
-      for (unsigned int i = 0; i < ImageDimension; ++i)
+      for (unsigned int k = 0; k < this->m_SplineOrder[i] + 1; ++k)
       {
-        RealType u = static_cast<RealType>(p[i] - static_cast<unsigned>(p[i]) - idx[i]) +
+        RealType u = static_cast<RealType>(p[i] - static_cast<unsigned>(p[i]) - k) +
                      0.5 * static_cast<RealType>(this->m_SplineOrder[i] - 1);
 
         switch (this->m_SplineOrder[i])
         {
           case 0:
           {
-            B *= this->m_KernelOrder0->Evaluate(u);
+            basisWeights1D[i][k] = this->m_KernelOrder0->Evaluate(u);
             break;
           }
           case 1:
           {
-            B *= this->m_KernelOrder1->Evaluate(u);
+            basisWeights1D[i][k] = this->m_KernelOrder1->Evaluate(u);
             break;
           }
           case 2:
           {
-            B *= this->m_KernelOrder2->Evaluate(u);
+            basisWeights1D[i][k] = this->m_KernelOrder2->Evaluate(u);
             break;
           }
           case 3:
           {
-            B *= this->m_KernelOrder3->Evaluate(u);
+            basisWeights1D[i][k] = this->m_KernelOrder3->Evaluate(u);
             break;
           }
           default:
           {
-            B *= this->m_Kernel[i]->Evaluate(u);
+            basisWeights1D[i][k] = this->m_Kernel[i]->Evaluate(u);
             break;
           }
         }
       }
+    }
+
+    RealType w2Sum = 0.0;
+    for (ItW.GoToBegin(); !ItW.IsAtEnd(); ++ItW)
+    {
+      RealType                          B = 1.0;
+      typename RealImageType::IndexType idx = ItW.GetIndex();
+      for (unsigned int i = 0; i < ImageDimension; ++i)
+      {
+        B *= basisWeights1D[i][idx[i]];
+      }
       ItW.Set(B);
       w2Sum += B * B;
     }
@@ -555,6 +576,9 @@ BSplineScatteredDataPointSetToImageFilter<TInputPointSet, TOutputImage>::Threade
     RealImageType *      currentThreadOmegaLattice = this->m_OmegaLatticePerThread[threadId];
     PointDataImageType * currentThreadDeltaLattice = this->m_DeltaLatticePerThread[threadId];
 
+    const RealType      wc = this->m_PointWeights->GetElement(n);
+    const PointDataType pointData = this->m_InputPointData->GetElement(n);
+
     for (ItW.GoToBegin(); !ItW.IsAtEnd(); ++ItW)
     {
       typename RealImageType::IndexType idx = ItW.GetIndex();
@@ -566,10 +590,9 @@ BSplineScatteredDataPointSetToImageFilter<TInputPointSet, TOutputImage>::Threade
           idx[i] %= size[i];
         }
       }
-      RealType wc = this->m_PointWeights->GetElement(n);
       RealType t = ItW.Get();
       currentThreadOmegaLattice->SetPixel(idx, currentThreadOmegaLattice->GetPixel(idx) + wc * t * t);
-      PointDataType data = this->m_InputPointData->GetElement(n);
+      PointDataType data = pointData;
       data *= (t * t * t * wc / w2Sum);
       currentThreadDeltaLattice->SetPixel(idx, currentThreadDeltaLattice->GetPixel(idx) + data);
     }
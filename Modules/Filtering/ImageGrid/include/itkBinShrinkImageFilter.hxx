@@ -139,86 +139,80 @@ BinShrinkImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(
     }
   }
 
-  // allocate accumulate line
-  const size_t          ln = outputRegionForThread.GetSize(0);
-  AccumulatePixelType * accBuffer = nullptr;
-  accBuffer = new AccumulatePixelType[ln];
-
-  try
+  // allocate an accumulate line covering the full width of the input bins;
+  // the input scanlines of each bin are summed into it with unit stride
+  // before being collapsed into output bins
+  const size_t                     ln = outputRegionForThread.GetSize(0);
+  const size_t                     lnInput = ln * this->GetShrinkFactors()[0];
+  std::vector<AccumulatePixelType> accBuffer(lnInput);
+
+  // convert the shrink factor for convenient multiplication
+  typename TOutputImage::SizeType factorSize;
+  for (unsigned int i = 0; i < TInputImage::ImageDimension; ++i)
   {
-    // convert the shrink factor for convenient multiplication
-    typename TOutputImage::SizeType factorSize;
-    for (unsigned int i = 0; i < TInputImage::ImageDimension; ++i)
-    {
-      factorSize[i] = this->GetShrinkFactors()[i];
-    }
+    factorSize[i] = this->GetShrinkFactors()[i];
+  }
 
-    const size_t numSamples = std::accumulate(
-      this->GetShrinkFactors().cbegin(), this->GetShrinkFactors().cend(), size_t(1), std::multiplies<size_t>());
-    const double inumSamples = 1.0 / (double)numSamples;
+  const size_t numSamples = std::accumulate(
+    this->GetShrinkFactors().cbegin(), this->GetShrinkFactors().cend(), size_t(1), std::multiplies<size_t>());
+  const double inumSamples = 1.0 / (double)numSamples;
 
-    TotalProgressReporter progress(this, outputPtr->GetRequestedRegion().GetNumberOfPixels());
+  TotalProgressReporter progress(this, outputPtr->GetRequestedRegion().GetNumberOfPixels());
 
-    while (!outputIterator.IsAtEnd())
-    {
-      const OutputIndexType outputIndex = outputIterator.GetIndex();
+  while (!outputIterator.IsAtEnd())
+  {
+    const OutputIndexType outputIndex = outputIterator.GetIndex();
 
-      typename std::vector<OutputOffsetType>::const_iterator offset = offsets.begin();
-      const InputIndexType                                   startInputIndex = outputIndex * factorSize;
+    typename std::vector<OutputOffsetType>::const_iterator offset = offsets.begin();
+    const InputIndexType                                   startInputIndex = outputIndex * factorSize;
 
-      inputIterator.SetIndex(startInputIndex + *offset);
-      for (size_t i = 0; i < ln; ++i)
-      {
-        accBuffer[i] = inputIterator.Get();
-        ++inputIterator;
+    // The first input scanline of the bins initializes the accumulate buffer
+    // and the remaining ones are added to it. Accumulating whole scanlines
+    // element for element keeps these inner loops vectorizable.
+    inputIterator.SetIndex(startInputIndex + *offset);
+    for (size_t i = 0; i < lnInput; ++i)
+    {
+      assert(!inputIterator.IsAtEndOfLine());
+      accBuffer[i] = inputIterator.Get();
+      ++inputIterator;
+    }
 
-        for (size_t j = 1; j < factorSize[0]; ++j)
-        {
-          assert(!inputIterator.IsAtEndOfLine());
-          accBuffer[i] += inputIterator.Get();
-          ++inputIterator;
-        }
-      }
+    while (++offset != offsets.end())
+    {
+      inputIterator.SetIndex(startInputIndex + *offset);
+      // Note: If the output image is small then we might not split
+      // the fastest direction. So we may not actually be at the start
+      // of the line...
+      // inputIterator.GoToBeginOfLine();
 
-      while (++offset != offsets.end())
+      for (size_t i = 0; i < lnInput; ++i)
       {
-        inputIterator.SetIndex(startInputIndex + *offset);
-        // Note: If the output image is small then we might not split
-        // the fastest direction. So we may not actually be at the start
-        // of the line...
-        // inputIterator.GoToBeginOfLine();
-
-        for (size_t i = 0; i < ln; ++i)
-        {
-          for (size_t j = 0; j < factorSize[0]; ++j)
-          {
-            assert(!inputIterator.IsAtEndOfLine());
-            accBuffer[i] += inputIterator.Get();
-            ++inputIterator;
-          }
-        }
+        assert(!inputIterator.IsAtEndOfLine());
+        accBuffer[i] += inputIterator.Get();
+        ++inputIterator;
       }
+    }
 
-      for (size_t j = 0; j < ln; ++j)
+    // Collapse each bin of accumulated samples into an output pixel
+    const AccumulatePixelType * accLine = accBuffer.data();
+    for (size_t j = 0; j < ln; ++j)
+    {
+      assert(!outputIterator.IsAtEndOfLine());
+      AccumulatePixelType acc = *accLine++;
+      for (size_t i = 1; i < factorSize[0]; ++i)
       {
-        assert(!outputIterator.IsAtEndOfLine());
-        // this statement is made to work with RGB pixel types
-        accBuffer[j] = accBuffer[j] * inumSamples;
-
-        outputIterator.Set(RoundIfInteger<OutputPixelType>(accBuffer[j]));
-        ++outputIterator;
+        acc += *accLine++;
       }
+      // this statement is made to work with RGB pixel types
+      acc = acc * inumSamples;
 
-      outputIterator.NextLine();
-      progress.Completed(outputRegionForThread.GetSize()[0]);
+      outputIterator.Set(RoundIfInteger<OutputPixelType>(acc));
+      ++outputIterator;
     }
+
+    outputIterator.NextLine();
+    progress.Completed(outputRegionForThread.GetSize()[0]);
   }
-  catch (...)
-  {
-    delete[] accBuffer;
-    throw;
-  }
-  delete[] accBuffer;
 }
 
 template <class TInputImage, class TOutputImage>
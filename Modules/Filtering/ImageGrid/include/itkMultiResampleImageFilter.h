@@ -0,0 +1,293 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkMultiResampleImageFilter_h
+#define itkMultiResampleImageFilter_h
+
+#include <vector>
+
+#include "itkTransform.h"
+#include "itkImageToImageFilter.h"
+#include "itkLinearInterpolateImageFunction.h"
+#include "itkSize.h"
+#include "itkDefaultConvertPixelTraits.h"
+#include "itkDataObjectDecorator.h"
+
+namespace itk
+{
+/**
+ *\class MultiResampleImageFilter
+ * \brief Resample several images through one coordinate transform.
+ *
+ * MultiResampleImageFilter resamples each of its indexed inputs onto a common
+ * output grid through a single coordinate transform, producing one output per
+ * input.  The transform is evaluated once per output pixel and the mapped
+ * point is handed to a per-input interpolator, so resampling N channels that
+ * share a transform costs one TransformPoint per pixel instead of N.  This
+ * matters most for expensive transforms such as DisplacementFieldTransform or
+ * deep composite transforms, where the mapping dominates the per-pixel work.
+
+ * All inputs must have the same pixel type but may have different geometries;
+ * each interpolator converts the mapped physical point using its own input's
+ * information.  The interpolator for input n is set with SetInterpolator(n,
+ * interpolator) and defaults to
+ * LinearInterpolateImageFunction<InputImageType, TInterpolatorPrecisionType>;
+ * use a nearest neighbor interpolator for label inputs.  Samples mapped
+ * outside an input's buffer receive the DefaultPixelValue.
+ *
+ * The output grid is defined the same way as in ResampleImageFilter: either
+ * explicitly through SetSize, SetOutputSpacing, SetOutputOrigin,
+ * SetOutputDirection and SetOutputStartIndex (or SetOutputParametersFromImage),
+ * or from a reference image when UseReferenceImage is On.  As with
+ * ResampleImageFilter, the transform maps output points to input points.
+ *
+ * The outputs are created to match the indexed inputs during pipeline
+ * updates; GetOutput(n) returns the resampled version of input n after the
+ * filter has executed.
+ *
+ * \sa ResampleImageFilter
+ *
+ * \ingroup GeometricTransform
+ * \ingroup ITKImageGrid
+ */
+template <typename TInputImage,
+          typename TOutputImage,
+          typename TInterpolatorPrecisionType = double,
+          typename TTransformPrecisionType = TInterpolatorPrecisionType>
+class ITK_TEMPLATE_EXPORT MultiResampleImageFilter : public ImageToImageFilter<TInputImage, TOutputImage>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(MultiResampleImageFilter);
+
+  /** Standard class type aliases. */
+  using Self = MultiResampleImageFilter;
+  using Superclass = ImageToImageFilter<TInputImage, TOutputImage>;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  using InputImageType = TInputImage;
+  using OutputImageType = TOutputImage;
+  using InputImagePointer = typename InputImageType::Pointer;
+  using InputImageConstPointer = typename InputImageType::ConstPointer;
+  using OutputImagePointer = typename OutputImageType::Pointer;
+  using InputImageRegionType = typename InputImageType::RegionType;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(MultiResampleImageFilter, ImageToImageFilter);
+
+  /** Number of dimensions of output image. */
+  static constexpr unsigned int OutputImageDimension = TOutputImage::ImageDimension;
+
+  /** Number of dimensions of input image. */
+  static constexpr unsigned int InputImageDimension = TInputImage::ImageDimension;
+
+  /** base type for images of the current OutputImageDimension */
+  using ImageBaseType = ImageBase<Self::OutputImageDimension>;
+
+  /** Transform type alias. */
+  using TransformType = Transform<TTransformPrecisionType, Self::OutputImageDimension, Self::InputImageDimension>;
+  using TransformPointerType = typename TransformType::ConstPointer;
+  using DecoratedTransformType = DataObjectDecorator<TransformType>;
+  using DecoratedTransformPointer = typename DecoratedTransformType::Pointer;
+
+  /** Interpolator type alias. */
+  using InterpolatorType = InterpolateImageFunction<InputImageType, TInterpolatorPrecisionType>;
+  using InterpolatorPointerType = typename InterpolatorType::Pointer;
+
+  using InterpolatorOutputType = typename InterpolatorType::OutputType;
+
+  using LinearInterpolatorType = LinearInterpolateImageFunction<InputImageType, TInterpolatorPrecisionType>;
+
+  /** Image size type alias. */
+  using SizeType = Size<Self::OutputImageDimension>;
+
+  /** Image index type alias. */
+  using IndexType = typename TOutputImage::IndexType;
+
+  /** Image point type alias. */
+  using InputPointType = typename InterpolatorType::PointType;
+  using OutputPointType = typename TOutputImage::PointType;
+
+  /** Image pixel value type alias. */
+  using PixelType = typename TOutputImage::PixelType;
+  using InputPixelType = typename TInputImage::PixelType;
+
+  using PixelConvertType = DefaultConvertPixelTraits<PixelType>;
+
+  using PixelComponentType = typename PixelConvertType::ComponentType;
+
+  /** Input pixel continuous index typdef */
+  using ContinuousInputIndexType = ContinuousIndex<TInterpolatorPrecisionType, InputImageDimension>;
+
+  /** Typedef to describe the output image region type. */
+  using OutputImageRegionType = typename TOutputImage::RegionType;
+
+  /** Image spacing,origin and direction type alias */
+  using SpacingType = typename TOutputImage::SpacingType;
+  using OriginPointType = typename TOutputImage::PointType;
+  using DirectionType = typename TOutputImage::DirectionType;
+
+  /** Typedef the reference image type to be the ImageBase of the OutputImageType */
+  using ReferenceImageBaseType = ImageBase<OutputImageDimension>;
+
+  /** Get/Set the coordinate transformation.
+   * As for ResampleImageFilter, this must be in physical coordinates and it
+   * is the output-to-input transform.  The transform is shared by every
+   * input, which is the point of this filter.  By default the filter uses an
+   * Identity transform. */
+  itkSetGetDecoratedObjectInputMacro(Transform, TransformType);
+
+  /** Set the interpolator used for the n-th input.  Inputs without an
+   * explicitly set interpolator use a
+   * LinearInterpolateImageFunction<InputImageType,
+   * TInterpolatorPrecisionType>. */
+  void
+  SetInterpolator(unsigned int index, InterpolatorType * interpolator);
+
+  /** Get the interpolator for the n-th input.  Returns nullptr if no
+   * interpolator has been set for that input and the filter has not yet
+   * created the default one. */
+  InterpolatorType *
+  GetInterpolator(unsigned int index) const;
+
+  /** Get/Set the size of the output images. */
+  itkSetMacro(Size, SizeType);
+  itkGetConstReferenceMacro(Size, SizeType);
+
+  /** Get/Set the pixel value used when a transformed pixel is outside of an
+   * input image.  The default default pixel value is 0. */
+  itkSetMacro(DefaultPixelValue, PixelType);
+  itkGetConstReferenceMacro(DefaultPixelValue, PixelType);
+
+  /** Set the output image spacing. */
+  itkSetMacro(OutputSpacing, SpacingType);
+
+  /** Get the output image spacing. */
+  itkGetConstReferenceMacro(OutputSpacing, SpacingType);
+
+  /** Set the output image origin. */
+  itkSetMacro(OutputOrigin, OriginPointType);
+
+  /** Get the output image origin. */
+  itkGetConstReferenceMacro(OutputOrigin, OriginPointType);
+
+  /** Set the output direction cosine matrix. */
+  itkSetMacro(OutputDirection, DirectionType);
+  itkGetConstReferenceMacro(OutputDirection, DirectionType);
+
+  /** Helper method to set the output parameters based on this image. */
+  void
+  SetOutputParametersFromImage(const ImageBaseType * image);
+
+  /** Set the start index of the output largest possible region.
+   * The default is an index of all zeros. */
+  itkSetMacro(OutputStartIndex, IndexType);
+
+  /** Get the start index of the output largest possible region. */
+  itkGetConstReferenceMacro(OutputStartIndex, IndexType);
+
+  /** Set a reference image to use to define the output information. */
+  itkSetInputMacro(ReferenceImage, ReferenceImageBaseType);
+
+  /** Get the reference image that is defining the output information. */
+  itkGetInputMacro(ReferenceImage, ReferenceImageBaseType);
+
+  /** Turn on/off whether a specified reference image should be used to define
+   *  the output information. */
+  itkSetMacro(UseReferenceImage, bool);
+  itkBooleanMacro(UseReferenceImage);
+  itkGetConstMacro(UseReferenceImage, bool);
+
+#ifdef ITK_USE_CONCEPT_CHECKING
+  // Begin concept checking
+  itkConceptMacro(OutputHasNumericTraitsCheck, (Concept::HasNumericTraits<PixelComponentType>));
+  // End concept checking
+#endif
+
+protected:
+  MultiResampleImageFilter();
+  ~MultiResampleImageFilter() override = default;
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+  /** Override VerifyInputInformation() since this filter's inputs do
+   * not need to occupy the same physical space.
+   *
+   * \sa ProcessObject::VerifyInputInformation
+   */
+  void
+  VerifyInputInformation() ITKv5_CONST override
+  {}
+
+  /** Create one output per indexed input and set the common output grid
+   * information on each of them. */
+  void
+  GenerateOutputInformation() override;
+
+  /** The inputs are required in full: the transform is arbitrary, so the
+   * input region needed for an output region cannot be computed in general.
+   * \sa ProcessObject::GenerateInputRequestedRegion() */
+  void
+  GenerateInputRequestedRegion() override;
+
+  /** Create default interpolators for inputs that have none and connect every
+   * interpolator to its input image; InterpolatorType::SetInputImage is not
+   * thread-safe and hence has to be set up before
+   * DynamicThreadedGenerateData. */
+  void
+  BeforeThreadedGenerateData() override;
+
+  /** Disconnect the input images from the interpolators. */
+  void
+  AfterThreadedGenerateData() override;
+
+  /** Compute the Modified Time based on the changed components. */
+  ModifiedTimeType
+  GetMTime() const override;
+
+  /** Resample all inputs over the given output region.  The transform is
+   * evaluated once per output pixel; the mapped point is then interpolated in
+   * each input. */
+  void
+  DynamicThreadedGenerateData(const OutputImageRegionType & outputRegionForThread) override;
+
+private:
+  void
+  InitializeTransform();
+
+  SizeType                             m_Size;          // Size of the output images
+  std::vector<InterpolatorPointerType> m_Interpolators; // Image functions for
+                                                        // interpolation, one per input
+  PixelType m_DefaultPixelValue;                        // default pixel value
+                                                        // if the point is
+                                                        // outside an image
+  SpacingType     m_OutputSpacing;                      // output image spacing
+  OriginPointType m_OutputOrigin;                       // output image origin
+  DirectionType   m_OutputDirection;                    // output image direction cosines
+  IndexType       m_OutputStartIndex;                   // output image start index
+  bool            m_UseReferenceImage{ false };
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkMultiResampleImageFilter.hxx"
+#endif
+
+#endif
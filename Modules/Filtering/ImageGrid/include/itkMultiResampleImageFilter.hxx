@@ -0,0 +1,394 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkMultiResampleImageFilter_hxx
+#define itkMultiResampleImageFilter_hxx
+
+#include "itkMultiResampleImageFilter.h"
+#include "itkObjectFactory.h"
+#include "itkIdentityTransform.h"
+#include "itkTotalProgressReporter.h"
+#include "itkImageRegionIterator.h"
+#include "itkImageRegionIteratorWithIndex.h"
+
+namespace itk
+{
+
+template <typename TInputImage,
+          typename TOutputImage,
+          typename TInterpolatorPrecisionType,
+          typename TTransformPrecisionType>
+MultiResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTransformPrecisionType>::
+  MultiResampleImageFilter()
+  : m_OutputSpacing(1.0)
+  , m_OutputOrigin(0.0)
+{
+  m_Size.Fill(0);
+  m_OutputStartIndex.Fill(0);
+
+  m_OutputDirection.SetIdentity();
+
+  // "Transform" required ( not numbered )
+  Self::AddRequiredInputName("Transform");
+  this->InitializeTransform();
+
+  m_DefaultPixelValue = NumericTraits<PixelType>::ZeroValue(m_DefaultPixelValue);
+  this->DynamicMultiThreadingOn();
+}
+
+template <typename TInputImage,
+          typename TOutputImage,
+          typename TInterpolatorPrecisionType,
+          typename TTransformPrecisionType>
+void
+MultiResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTransformPrecisionType>::
+  InitializeTransform()
+{
+  using IdentityTransformType =
+    Transform<TTransformPrecisionType, Self::OutputImageDimension, Self::OutputImageDimension>;
+  typename IdentityTransformType::Pointer defaultTransform =
+    IdentityTransform<TTransformPrecisionType, OutputImageDimension>::New();
+  if (InputImageDimension == OutputImageDimension)
+  {
+    using DecoratorType = DataObjectDecorator<IdentityTransformType>;
+    auto decoratedInput = DecoratorType::New();
+    decoratedInput->Set(defaultTransform);
+    this->ProcessObject::SetInput(
+      "Transform", const_cast<DataObjectDecorator<IdentityTransformType> *>(decoratedInput.GetPointer()));
+  }
+  this->Modified();
+}
+
+template <typename TInputImage,
+          typename TOutputImage,
+          typename TInterpolatorPrecisionType,
+          typename TTransformPrecisionType>
+void
+MultiResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTransformPrecisionType>::
+  SetInterpolator(unsigned int index, InterpolatorType * interpolator)
+{
+  if (index >= m_Interpolators.size())
+  {
+    m_Interpolators.resize(index + 1);
+  }
+  if (m_Interpolators[index] != interpolator)
+  {
+    m_Interpolators[index] = interpolator;
+    this->Modified();
+  }
+}
+
+template <typename TInputImage,
+          typename TOutputImage,
+          typename TInterpolatorPrecisionType,
+          typename TTransformPrecisionType>
+auto
+MultiResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTransformPrecisionType>::
+  GetInterpolator(unsigned int index) const -> InterpolatorType *
+{
+  if (index >= m_Interpolators.size())
+  {
+    return nullptr;
+  }
+  return m_Interpolators[index];
+}
+
+template <typename TInputImage,
+          typename TOutputImage,
+          typename TInterpolatorPrecisionType,
+          typename TTransformPrecisionType>
+void
+MultiResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTransformPrecisionType>::
+  SetOutputParametersFromImage(const ImageBaseType * image)
+{
+  this->SetOutputOrigin(image->GetOrigin());
+  this->SetOutputSpacing(image->GetSpacing());
+  this->SetOutputDirection(image->GetDirection());
+  this->SetOutputStartIndex(image->GetLargestPossibleRegion().GetIndex());
+  this->SetSize(image->GetLargestPossibleRegion().GetSize());
+}
+
+template <typename TInputImage,
+          typename TOutputImage,
+          typename TInterpolatorPrecisionType,
+          typename TTransformPrecisionType>
+void
+MultiResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTransformPrecisionType>::
+  GenerateOutputInformation()
+{
+  // One output per indexed input.  Outputs may need to be created here: the
+  // number of inputs is not known at construction time.
+  const auto numberOfIndexedInputs = static_cast<unsigned int>(this->GetNumberOfIndexedInputs());
+  this->SetNumberOfRequiredOutputs(numberOfIndexedInputs);
+  for (unsigned int idx = 0; idx < numberOfIndexedInputs; ++idx)
+  {
+    if (this->ProcessObject::GetOutput(idx) == nullptr)
+    {
+      this->ProcessObject::SetNthOutput(idx, this->MakeOutput(idx));
+    }
+  }
+
+  // Call the superclass' implementation of this method
+  Superclass::GenerateOutputInformation();
+
+  const ReferenceImageBaseType * const referenceImage = this->GetReferenceImage();
+
+  for (unsigned int idx = 0; idx < numberOfIndexedInputs; ++idx)
+  {
+    OutputImageType * outputPtr = this->GetOutput(idx);
+
+    // Set the size of the output region
+    if (m_UseReferenceImage && referenceImage)
+    {
+      outputPtr->SetLargestPossibleRegion(referenceImage->GetLargestPossibleRegion());
+    }
+    else
+    {
+      typename TOutputImage::RegionType outputLargestPossibleRegion;
+      outputLargestPossibleRegion.SetSize(m_Size);
+      outputLargestPossibleRegion.SetIndex(m_OutputStartIndex);
+      outputPtr->SetLargestPossibleRegion(outputLargestPossibleRegion);
+    }
+
+    // Set spacing and origin
+    if (m_UseReferenceImage && referenceImage)
+    {
+      outputPtr->SetSpacing(referenceImage->GetSpacing());
+      outputPtr->SetOrigin(referenceImage->GetOrigin());
+      outputPtr->SetDirection(referenceImage->GetDirection());
+    }
+    else
+    {
+      outputPtr->SetSpacing(m_OutputSpacing);
+      outputPtr->SetOrigin(m_OutputOrigin);
+      outputPtr->SetDirection(m_OutputDirection);
+    }
+
+    // The superclass copied the number of components from the primary input
+    // to every output; each output carries its own input's component count.
+    outputPtr->SetNumberOfComponentsPerPixel(this->GetInput(idx)->GetNumberOfComponentsPerPixel());
+  }
+}
+
+template <typename TInputImage,
+          typename TOutputImage,
+          typename TInterpolatorPrecisionType,
+          typename TTransformPrecisionType>
+void
+MultiResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTransformPrecisionType>::
+  GenerateInputRequestedRegion()
+{
+  // call the superclass's implementation
+  Superclass::GenerateInputRequestedRegion();
+
+  // The transform is arbitrary, so request the largest possible region of
+  // every input image.
+  const auto numberOfIndexedInputs = static_cast<unsigned int>(this->GetNumberOfIndexedInputs());
+  for (unsigned int idx = 0; idx < numberOfIndexedInputs; ++idx)
+  {
+    auto * inputPtr = const_cast<InputImageType *>(this->GetInput(idx));
+    if (inputPtr)
+    {
+      inputPtr->SetRequestedRegionToLargestPossibleRegion();
+    }
+  }
+}
+
+template <typename TInputImage,
+          typename TOutputImage,
+          typename TInterpolatorPrecisionType,
+          typename TTransformPrecisionType>
+void
+MultiResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTransformPrecisionType>::
+  BeforeThreadedGenerateData()
+{
+  const auto numberOfIndexedInputs = static_cast<unsigned int>(this->GetNumberOfIndexedInputs());
+  if (m_Interpolators.size() < numberOfIndexedInputs)
+  {
+    m_Interpolators.resize(numberOfIndexedInputs);
+  }
+  for (unsigned int idx = 0; idx < numberOfIndexedInputs; ++idx)
+  {
+    if (m_Interpolators[idx].IsNull())
+    {
+      m_Interpolators[idx] = LinearInterpolatorType::New().GetPointer();
+    }
+    m_Interpolators[idx]->SetInputImage(this->GetInput(idx));
+  }
+
+  unsigned int nComponents = DefaultConvertPixelTraits<PixelType>::GetNumberOfComponents(m_DefaultPixelValue);
+
+  if (nComponents == 0)
+  {
+    PixelComponentType tempZeroComponents{ 0 };
+    PixelComponentType zeroComponent = NumericTraits<PixelComponentType>::ZeroValue(tempZeroComponents);
+    nComponents = this->GetInput()->GetNumberOfComponentsPerPixel();
+    NumericTraits<PixelType>::SetLength(m_DefaultPixelValue, nComponents);
+    for (unsigned int n = 0; n < nComponents; ++n)
+    {
+      PixelConvertType::SetNthComponent(n, m_DefaultPixelValue, zeroComponent);
+    }
+  }
+}
+
+template <typename TInputImage,
+          typename TOutputImage,
+          typename TInterpolatorPrecisionType,
+          typename TTransformPrecisionType>
+void
+MultiResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTransformPrecisionType>::
+  AfterThreadedGenerateData()
+{
+  // Disconnect the input images from the interpolators
+  for (auto & interpolator : m_Interpolators)
+  {
+    if (interpolator.IsNotNull())
+    {
+      interpolator->SetInputImage(nullptr);
+    }
+  }
+}
+
+template <typename TInputImage,
+          typename TOutputImage,
+          typename TInterpolatorPrecisionType,
+          typename TTransformPrecisionType>
+void
+MultiResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTransformPrecisionType>::
+  DynamicThreadedGenerateData(const OutputImageRegionType & outputRegionForThread)
+{
+  OutputImageType *     firstOutputPtr = this->GetOutput();
+  const TransformType * transformPtr = this->GetTransform();
+
+  const auto numberOfIndexedInputs = static_cast<unsigned int>(this->GetNumberOfIndexedInputs());
+
+  TotalProgressReporter progress(this, firstOutputPtr->GetRequestedRegion().GetNumberOfPixels());
+
+  // Walk the first output with an index iterator; the remaining outputs share
+  // its grid and are walked in lockstep.
+  ImageRegionIteratorWithIndex<TOutputImage> firstIt(firstOutputPtr, outputRegionForThread);
+
+  std::vector<ImageRegionIterator<TOutputImage>> outputIts;
+  outputIts.reserve(numberOfIndexedInputs - 1);
+  for (unsigned int idx = 1; idx < numberOfIndexedInputs; ++idx)
+  {
+    outputIts.emplace_back(this->GetOutput(idx), outputRegionForThread);
+  }
+
+  OutputPointType outputPoint; // Coordinates of current output pixel
+  InputPointType  inputPoint;  // Coordinates of current input pixel
+
+  ContinuousInputIndexType inputIndex;
+
+  while (!firstIt.IsAtEnd())
+  {
+    // Determine the index of the current output pixel
+    firstOutputPtr->TransformIndexToPhysicalPoint(firstIt.GetIndex(), outputPoint);
+
+    // Compute the corresponding input pixel position, once for all inputs
+    inputPoint = transformPtr->TransformPoint(outputPoint);
+
+    for (unsigned int idx = 0; idx < numberOfIndexedInputs; ++idx)
+    {
+      const InterpolatorType * interpolator = m_Interpolators[idx];
+
+      // Each input has its own geometry, so the physical point is converted
+      // per input; only the transform evaluation is shared.
+      interpolator->ConvertPointToContinuousIndex(inputPoint, inputIndex);
+
+      PixelType value;
+      if (interpolator->IsInsideBuffer(inputIndex))
+      {
+        value = static_cast<PixelType>(interpolator->EvaluateAtContinuousIndex(inputIndex));
+      }
+      else
+      {
+        value = m_DefaultPixelValue; // default background value
+      }
+
+      if (idx == 0)
+      {
+        firstIt.Set(value);
+      }
+      else
+      {
+        outputIts[idx - 1].Set(value);
+      }
+    }
+
+    ++firstIt;
+    for (auto & outputIt : outputIts)
+    {
+      ++outputIt;
+    }
+    progress.CompletedPixel();
+  }
+}
+
+template <typename TInputImage,
+          typename TOutputImage,
+          typename TInterpolatorPrecisionType,
+          typename TTransformPrecisionType>
+ModifiedTimeType
+MultiResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTransformPrecisionType>::GetMTime()
+  const
+{
+  ModifiedTimeType latestTime = Object::GetMTime();
+
+  for (const auto & interpolator : m_Interpolators)
+  {
+    if (interpolator.IsNotNull())
+    {
+      if (latestTime < interpolator->GetMTime())
+      {
+        latestTime = interpolator->GetMTime();
+      }
+    }
+  }
+
+  return latestTime;
+}
+
+template <typename TInputImage,
+          typename TOutputImage,
+          typename TInterpolatorPrecisionType,
+          typename TTransformPrecisionType>
+void
+MultiResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTransformPrecisionType>::PrintSelf(
+  std::ostream & os,
+  Indent         indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "DefaultPixelValue: " << static_cast<typename NumericTraits<PixelType>::PrintType>(m_DefaultPixelValue)
+     << std::endl;
+  os << indent << "Size: " << m_Size << std::endl;
+  os << indent << "OutputStartIndex: " << m_OutputStartIndex << std::endl;
+  os << indent << "OutputSpacing: " << m_OutputSpacing << std::endl;
+  os << indent << "OutputOrigin: " << m_OutputOrigin << std::endl;
+  os << indent << "OutputDirection: " << m_OutputDirection << std::endl;
+  os << indent << "Transform: " << this->GetTransform() << std::endl;
+  os << indent << "UseReferenceImage: " << (m_UseReferenceImage ? "On" : "Off") << std::endl;
+  os << indent << "Interpolators:" << std::endl;
+  for (std::size_t idx = 0; idx < m_Interpolators.size(); ++idx)
+  {
+    os << indent.GetNextIndent() << idx << ": " << m_Interpolators[idx].GetPointer() << std::endl;
+  }
+}
+} // end namespace itk
+
+#endif
@@ -20,6 +20,9 @@
 
 #include "itkImageToImageFilter.h"
 #include "itkFixedArray.h"
+#include "itkImage.h"
+
+#include <type_traits> // For integral_constant and is_same.
 
 namespace itk
 {
@@ -126,6 +129,24 @@ protected:
 
 
 private:
+  /** Whether pixels can be addressed directly in the buffer.  True for plain
+   * itk::Image; false for VectorImage and image adaptors, whose pixel access
+   * goes through a proxy. */
+  using ImageHasContiguousBuffer =
+    std::integral_constant<bool, std::is_same<TImage, Image<typename TImage::PixelType, TImage::ImageDimension>>::value>;
+
+  /** Scanline copy with direct buffer addressing: along an output scanline
+   * the input pixels are a constant stride apart, so the inner loop is a
+   * strided gather without per-pixel index arithmetic. */
+  void
+  PermuteScanlines(std::true_type, const OutputImageRegionType & outputRegionForThread);
+
+  /** Scanline copy through GetPixel for proxied pixel types; the input index
+   * is stepped along the single permuted dimension instead of being
+   * recomputed per pixel. */
+  void
+  PermuteScanlines(std::false_type, const OutputImageRegionType & outputRegionForThread);
+
   PermuteOrderArrayType m_Order;
   PermuteOrderArrayType m_InverseOrder;
 };
@@ -19,7 +19,7 @@
 #define itkPermuteAxesImageFilter_hxx
 
 #include "itkPermuteAxesImageFilter.h"
-#include "itkImageRegionIteratorWithIndex.h"
+#include "itkImageScanlineIterator.h"
 #include "itkMacro.h"
 #include "itkTotalProgressReporter.h"
 
@@ -219,6 +219,13 @@ PermuteAxesImageFilter<TImage>::GenerateInputRequestedRegion()
 template <typename TImage>
 void
 PermuteAxesImageFilter<TImage>::DynamicThreadedGenerateData(const OutputImageRegionType & outputRegionForThread)
+{
+  this->PermuteScanlines(ImageHasContiguousBuffer(), outputRegionForThread);
+}
+
+template <typename TImage>
+void
+PermuteAxesImageFilter<TImage>::PermuteScanlines(std::true_type, const OutputImageRegionType & outputRegionForThread)
 {
   unsigned int j;
 
@@ -228,28 +235,81 @@ PermuteAxesImageFilter<TImage>::DynamicThreadedGenerateData(const OutputImageReg
 
   TotalProgressReporter progress(this, outputPtr->GetRequestedRegion().GetNumberOfPixels());
 
-  // Setup output region iterator
-  using OutputIterator = ImageRegionIteratorWithIndex<TImage>;
+  const typename TImage::PixelType * inputBuffer = inputPtr->GetBufferPointer();
+  const OffsetValueType *            inputOffsetTable = inputPtr->GetOffsetTable();
+
+  // Along an output scanline only the m_Order[0]-th input coordinate moves,
+  // so consecutive output pixels are a constant input stride apart
+  const OffsetValueType inputStride = inputOffsetTable[m_Order[0]];
+  const SizeValueType   lineLength = outputRegionForThread.GetSize(0);
+
+  using OutputIterator = ImageScanlineIterator<TImage>;
   OutputIterator outIt(outputPtr, outputRegionForThread);
 
   typename TImage::IndexType outputIndex;
   typename TImage::IndexType inputIndex;
 
-  // walk the output region, and sample the input image
-  for (outIt.GoToBegin(); !outIt.IsAtEnd(); ++outIt)
+  // walk the output region scanline by scanline, gathering from the input
+  while (!outIt.IsAtEnd())
   {
-    // determine the index of the output pixel
+    // determine the input pixel location associated with the start of line
     outputIndex = outIt.GetIndex();
+    for (j = 0; j < ImageDimension; ++j)
+    {
+      inputIndex[j] = outputIndex[m_InverseOrder[j]];
+    }
+    OffsetValueType inputOffset = inputPtr->ComputeOffset(inputIndex);
 
-    // determine the input pixel location associated with this output pixel
+    while (!outIt.IsAtEndOfLine())
+    {
+      outIt.Set(inputBuffer[inputOffset]);
+      inputOffset += inputStride;
+      ++outIt;
+    }
+    outIt.NextLine();
+    progress.Completed(lineLength);
+  }
+}
+
+template <typename TImage>
+void
+PermuteAxesImageFilter<TImage>::PermuteScanlines(std::false_type, const OutputImageRegionType & outputRegionForThread)
+{
+  unsigned int j;
+
+  // Get the input and output pointers
+  typename Superclass::InputImageConstPointer inputPtr = this->GetInput();
+  typename Superclass::OutputImagePointer     outputPtr = this->GetOutput();
+
+  TotalProgressReporter progress(this, outputPtr->GetRequestedRegion().GetNumberOfPixels());
+
+  const SizeValueType lineLength = outputRegionForThread.GetSize(0);
+
+  using OutputIterator = ImageScanlineIterator<TImage>;
+  OutputIterator outIt(outputPtr, outputRegionForThread);
+
+  typename TImage::IndexType outputIndex;
+  typename TImage::IndexType inputIndex;
+
+  // walk the output region scanline by scanline, and sample the input image;
+  // only the m_Order[0]-th input coordinate moves within a line
+  while (!outIt.IsAtEnd())
+  {
+    outputIndex = outIt.GetIndex();
     for (j = 0; j < ImageDimension; ++j)
     {
       inputIndex[j] = outputIndex[m_InverseOrder[j]];
     }
 
-    // copy the input pixel to the output
-    outIt.Set(inputPtr->GetPixel(inputIndex));
-    progress.CompletedPixel();
+    while (!outIt.IsAtEndOfLine())
+    {
+      // copy the input pixel to the output
+      outIt.Set(inputPtr->GetPixel(inputIndex));
+      ++inputIndex[m_Order[0]];
+      ++outIt;
+    }
+    outIt.NextLine();
+    progress.Completed(lineLength);
   }
 }
 } // namespace itk
@@ -24,6 +24,7 @@
 #include "itkImageToImageFilter.h"
 #include "itkExtrapolateImageFunction.h"
 #include "itkLinearInterpolateImageFunction.h"
+#include "itkNearestNeighborInterpolateImageFunction.h"
 #include "itkSize.h"
 #include "itkDefaultConvertPixelTraits.h"
 #include "itkDataObjectDecorator.h"
@@ -146,6 +147,9 @@ public:
   using LinearInterpolatorType = LinearInterpolateImageFunction<InputImageType, TInterpolatorPrecisionType>;
   using LinearInterpolatorPointerType = typename LinearInterpolatorType::Pointer;
 
+  using NearestNeighborInterpolatorType = NearestNeighborInterpolateImageFunction<InputImageType, TInterpolatorPrecisionType>;
+  using NearestNeighborInterpolatorPointerType = typename NearestNeighborInterpolatorType::Pointer;
+
   /** Extrapolator type alias. */
   using ExtrapolatorType = ExtrapolateImageFunction<InputImageType, TInterpolatorPrecisionType>;
   using ExtrapolatorPointerType = typename ExtrapolatorType::Pointer;
@@ -270,6 +274,34 @@ public:
   itkBooleanMacro(UseReferenceImage);
   itkGetConstMacro(UseReferenceImage, bool);
 
+  /** Turn on/off the sampled computation of the input requested region for
+   * nonlinear transforms.  By default the entire input is requested whenever
+   * the transform is not linear, which makes the input fully resident
+   * regardless of streaming divisions.  When this flag is on, the input
+   * footprint of each output (streaming) division is instead estimated by
+   * transforming a grid of NonlinearFootprintSamplesPerDimension^Dim sample
+   * points spanning the division and bounding the mapped continuous indices,
+   * padded by the interpolator support plus NonlinearFootprintPadding voxels.
+   * The estimate is conservative only up to sampling: a transform whose
+   * displacement between sample points exceeds the padding can map pixels
+   * outside the requested tile, and such pixels receive the default pixel
+   * value (or the extrapolator result).  Off by default. */
+  itkSetMacro(UseNonlinearInputFootprint, bool);
+  itkBooleanMacro(UseNonlinearInputFootprint);
+  itkGetConstMacro(UseNonlinearInputFootprint, bool);
+
+  /** Number of transform samples per dimension used to estimate the input
+   * footprint of an output division when UseNonlinearInputFootprint is on.
+   * The default is 8. */
+  itkSetClampMacro(NonlinearFootprintSamplesPerDimension, unsigned int, 2, 1024);
+  itkGetConstMacro(NonlinearFootprintSamplesPerDimension, unsigned int);
+
+  /** Safety padding in input voxels added around the sampled footprint, on
+   * top of the interpolator support, when UseNonlinearInputFootprint is on.
+   * The default is 2. */
+  itkSetMacro(NonlinearFootprintPadding, SizeValueType);
+  itkGetConstMacro(NonlinearFootprintPadding, SizeValueType);
+
 #ifdef ITK_USE_CONCEPT_CHECKING
   // Begin concept checking
   itkConceptMacro(OutputHasNumericTraitsCheck, (Concept::HasNumericTraits<PixelComponentType>));
@@ -350,6 +382,30 @@ protected:
                                                                const ComponentType          maxComponent) const);
 
 private:
+  /** Scanline loop of the linear-transform fast path, parameterized on the
+   * static type of the interpolator.  LinearThreadedGenerateData resolves the
+   * ubiquitous linear and nearest neighbor interpolators to their concrete
+   * types so the per-pixel evaluation inlines instead of dispatching
+   * virtually; any other interpolator uses the generic instantiation. */
+  template <typename TConcreteInterpolator>
+  void
+  LinearThreadedGenerateDataWithInterpolator(const OutputImageRegionType & outputRegionForThread,
+                                             const TConcreteInterpolator * interpolator);
+
+  /** Evaluate the interpolator non-virtually when its exact type is known. */
+  template <typename TConcreteInterpolator>
+  static InterpolatorOutputType
+  EvaluateInterpolatorExact(const TConcreteInterpolator * interpolator, const ContinuousInputIndexType & index)
+  {
+    return interpolator->TConcreteInterpolator::EvaluateAtContinuousIndex(index);
+  }
+
+  static InterpolatorOutputType
+  EvaluateInterpolatorExact(const InterpolatorType * interpolator, const ContinuousInputIndexType & index)
+  {
+    return interpolator->EvaluateAtContinuousIndex(index);
+  }
+
   static PixelComponentType
   CastComponentWithBoundsChecking(const PixelComponentType value);
 
@@ -367,6 +423,15 @@ private:
   void
   InitializeTransform();
 
+  /** Estimate the input region needed to resample the given output region
+   * through a nonlinear transform by sampling the transform on a grid
+   * spanning the region and bounding the mapped continuous indices.  The
+   * result is padded by the interpolator support plus
+   * NonlinearFootprintPadding voxels and is not cropped to the input largest
+   * possible region. */
+  InputImageRegionType
+  ComputeNonlinearInputFootprint(const OutputImageRegionType & outputRegion) const;
+
   SizeType                m_Size;         // Size of the output image
   InterpolatorPointerType m_Interpolator; // Image function for
                                           // interpolation
@@ -380,6 +445,10 @@ private:
   DirectionType   m_OutputDirection;      // output image direction cosines
   IndexType       m_OutputStartIndex;     // output image start index
   bool            m_UseReferenceImage{ false };
+
+  bool          m_UseNonlinearInputFootprint{ false };
+  unsigned int  m_NonlinearFootprintSamplesPerDimension{ 8 };
+  SizeValueType m_NonlinearFootprintPadding{ 2 };
 };
 } // end namespace itk
 
@@ -29,6 +29,7 @@
 #include "itkImageAlgorithm.h"
 
 #include <type_traits> // For is_same.
+#include <typeinfo>    // For typeid.
 
 namespace itk
 {
@@ -438,6 +439,38 @@ template <typename TInputImage,
 void
 ResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTransformPrecisionType>::
   LinearThreadedGenerateData(const OutputImageRegionType & outputRegionForThread)
+{
+  // Resolve the common interpolators to their concrete types so the scanline
+  // kernel below evaluates them without a virtual dispatch per pixel.  The
+  // exact-type checks ensure a subclass with overridden behavior still goes
+  // through the generic virtual path.
+  const InterpolatorType * interpolator = m_Interpolator.GetPointer();
+
+  if (typeid(*interpolator) == typeid(LinearInterpolatorType))
+  {
+    this->LinearThreadedGenerateDataWithInterpolator(outputRegionForThread,
+                                                     static_cast<const LinearInterpolatorType *>(interpolator));
+  }
+  else if (typeid(*interpolator) == typeid(NearestNeighborInterpolatorType))
+  {
+    this->LinearThreadedGenerateDataWithInterpolator(
+      outputRegionForThread, static_cast<const NearestNeighborInterpolatorType *>(interpolator));
+  }
+  else
+  {
+    this->LinearThreadedGenerateDataWithInterpolator(outputRegionForThread, interpolator);
+  }
+}
+
+template <typename TInputImage,
+          typename TOutputImage,
+          typename TInterpolatorPrecisionType,
+          typename TTransformPrecisionType>
+template <typename TConcreteInterpolator>
+void
+ResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTransformPrecisionType>::
+  LinearThreadedGenerateDataWithInterpolator(const OutputImageRegionType & outputRegionForThread,
+                                             const TConcreteInterpolator * interpolator)
 {
   OutputImageType *      outputPtr = this->GetOutput();
   const InputImageType * inputPtr = this->GetInput();
@@ -504,9 +537,9 @@ ResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTran
       }
 
       // Evaluate input at right position and copy to the output
-      if (m_Interpolator->IsInsideBuffer(inputIndex))
+      if (interpolator->IsInsideBuffer(inputIndex))
       {
-        outIt.Set(Self::CastPixelWithBoundsChecking(m_Interpolator->EvaluateAtContinuousIndex(inputIndex)));
+        outIt.Set(Self::CastPixelWithBoundsChecking(Self::EvaluateInterpolatorExact(interpolator, inputIndex)));
       }
       else
       {
@@ -595,11 +628,110 @@ ResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTran
 
   // Otherwise, determining the actual input region is non-trivial, especially
   // when we cannot assume anything about the transform being used.
-  // So we do the easy thing and request the entire input image.
-  //
+  // When requested, estimate a footprint by sampling the transform over the
+  // output requested region so both sides of the pipeline can stream.
+  if (m_UseNonlinearInputFootprint)
+  {
+    typename TInputImage::RegionType inputRequestedRegion =
+      this->ComputeNonlinearInputFootprint(output->GetRequestedRegion());
+    if (inputRequestedRegion.Crop(input->GetLargestPossibleRegion()))
+    {
+      input->SetRequestedRegion(inputRequestedRegion);
+    }
+    else
+    {
+      // The sampled footprint lies entirely outside the input: the output
+      // division maps to background.  Request an empty region so upstream
+      // does not produce data that will not be read.
+      typename TInputImage::RegionType emptyRegion;
+      emptyRegion.SetIndex(input->GetLargestPossibleRegion().GetIndex());
+      input->SetRequestedRegion(emptyRegion);
+    }
+    return;
+  }
+
+  // Do the easy thing and request the entire input image.
   input->SetRequestedRegionToLargestPossibleRegion();
 }
 
+template <typename TInputImage,
+          typename TOutputImage,
+          typename TInterpolatorPrecisionType,
+          typename TTransformPrecisionType>
+auto
+ResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTransformPrecisionType>::
+  ComputeNonlinearInputFootprint(const OutputImageRegionType & outputRegion) const -> InputImageRegionType
+{
+  const OutputImageType * outputPtr = this->GetOutput();
+  const InputImageType *  inputPtr = this->GetInput();
+  const TransformType *   transformPtr = this->GetTransform();
+
+  const unsigned int samples = m_NonlinearFootprintSamplesPerDimension;
+
+  ContinuousInputIndexType minIndex;
+  ContinuousInputIndexType maxIndex;
+
+  // Walk a samples^Dim grid of continuous indices spanning the output
+  // region, corners included, and bound the mapped input continuous indices
+  FixedArray<unsigned int, OutputImageDimension> counter;
+  counter.Fill(0);
+  bool first = true;
+  bool done = false;
+  while (!done)
+  {
+    ContinuousIndex<double, OutputImageDimension> outputIndex;
+    for (unsigned int d = 0; d < OutputImageDimension; ++d)
+    {
+      outputIndex[d] = static_cast<double>(outputRegion.GetIndex(d)) +
+                       static_cast<double>(outputRegion.GetSize(d) - 1) * counter[d] / (samples - 1);
+    }
+
+    OutputPointType outputPoint;
+    outputPtr->TransformContinuousIndexToPhysicalPoint(outputIndex, outputPoint);
+
+    InputPointType inputPoint;
+    inputPoint = transformPtr->TransformPoint(outputPoint);
+
+    ContinuousInputIndexType inputIndex;
+    inputPtr->TransformPhysicalPointToContinuousIndex(inputPoint, inputIndex);
+
+    for (unsigned int d = 0; d < InputImageDimension; ++d)
+    {
+      if (first || inputIndex[d] < minIndex[d])
+      {
+        minIndex[d] = inputIndex[d];
+      }
+      if (first || inputIndex[d] > maxIndex[d])
+      {
+        maxIndex[d] = inputIndex[d];
+      }
+    }
+    first = false;
+
+    // Advance the sample counter, odometer style
+    unsigned int d = 0;
+    while (d < OutputImageDimension && ++counter[d] == samples)
+    {
+      counter[d] = 0;
+      ++d;
+    }
+    done = (d == OutputImageDimension);
+  }
+
+  InputImageRegionType footprint;
+  for (unsigned int d = 0; d < InputImageDimension; ++d)
+  {
+    const auto low = static_cast<IndexValueType>(std::floor(minIndex[d]));
+    const auto high = static_cast<IndexValueType>(std::ceil(maxIndex[d]));
+    footprint.SetIndex(d, low);
+    footprint.SetSize(d, static_cast<SizeValueType>(high - low) + 1);
+  }
+  footprint.PadByRadius(m_Interpolator->GetRadius());
+  footprint.PadByRadius(m_NonlinearFootprintPadding);
+
+  return footprint;
+}
+
 template <typename TInputImage,
           typename TOutputImage,
           typename TInterpolatorPrecisionType,
@@ -689,6 +821,9 @@ ResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTran
   os << indent << "Interpolator: " << m_Interpolator.GetPointer() << std::endl;
   os << indent << "Extrapolator: " << m_Extrapolator.GetPointer() << std::endl;
   os << indent << "UseReferenceImage: " << (m_UseReferenceImage ? "On" : "Off") << std::endl;
+  os << indent << "UseNonlinearInputFootprint: " << (m_UseNonlinearInputFootprint ? "On" : "Off") << std::endl;
+  os << indent << "NonlinearFootprintSamplesPerDimension: " << m_NonlinearFootprintSamplesPerDimension << std::endl;
+  os << indent << "NonlinearFootprintPadding: " << m_NonlinearFootprintPadding << std::endl;
 }
 } // end namespace itk
 
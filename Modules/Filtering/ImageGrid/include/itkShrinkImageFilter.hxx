@@ -29,7 +29,7 @@
 #define itkShrinkImageFilter_hxx
 
 #include "itkShrinkImageFilter.h"
-#include "itkImageRegionIteratorWithIndex.h"
+#include "itkImageScanlineIterator.h"
 #include "itkContinuousIndex.h"
 #include "itkObjectFactory.h"
 #include "itkTotalProgressReporter.h"
@@ -154,12 +154,12 @@ ShrinkImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(
 
   // Define/declare an iterator that will walk the output region for this
   // thread.
-  using OutputIterator = ImageRegionIteratorWithIndex<TOutputImage>;
+  using OutputIterator = ImageScanlineIterator<TOutputImage>;
   OutputIterator outIt(outputPtr, outputRegionForThread);
 
   while (!outIt.IsAtEnd())
   {
-    // Determine the index and physical location of the output pixel
+    // Determine the index of the first output pixel of the scanline
     outputIndex = outIt.GetIndex();
 
     // An optimized version of
@@ -168,10 +168,18 @@ ShrinkImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(
     // but without the rounding and precision issues
     inputIndex = outputIndex * factorSize + offsetIndex;
 
-    // Copy the input pixel to the output
-    outIt.Set(inputPtr->GetPixel(inputIndex));
-    ++outIt;
-    progress.CompletedPixel();
+    // Walk the scanline, advancing the input index along the fastest axis by
+    // the shrink factor instead of recomputing the full mapping per pixel
+    while (!outIt.IsAtEndOfLine())
+    {
+      // Copy the input pixel to the output
+      outIt.Set(inputPtr->GetPixel(inputIndex));
+      ++outIt;
+      inputIndex[0] += static_cast<OffsetValueType>(factorSize[0]);
+    }
+
+    outIt.NextLine();
+    progress.Completed(outputRegionForThread.GetSize(0));
   }
 }
 
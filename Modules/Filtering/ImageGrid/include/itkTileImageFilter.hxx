@@ -62,24 +62,35 @@ TileImageFilter<TInputImage, TOutputImage>::GenerateData()
     }
   }
 
-  // Allocate the output and initialize to default value
+  // Allocate the output
   this->AllocateOutputs();
-  output->FillBuffer(defaultPixelValue);
 
   ImageRegionIterator<TileImageType> it(m_TileImage, m_TileImage->GetBufferedRegion());
   it.GoToBegin();
 
   SizeValueType numPastes = 0;
+  SizeValueType numCoveredPixels = 0;
   while (!it.IsAtEnd())
   {
     if (it.Get().m_ImageNumber >= 0)
     {
       ++numPastes;
+      numCoveredPixels += it.Get().m_Region.GetNumberOfPixels();
     }
     ++it;
   }
   const float progressContrib = 1.0f / numPastes;
 
+  // Initialize the output to the default value, unless the tile regions
+  // completely cover it: the pastes below then write every output pixel.
+  // The tile regions are disjoint by construction, so comparing pixel
+  // counts suffices.
+  if (output->GetBufferedRegion() != output->GetLargestPossibleRegion() ||
+      numCoveredPixels < output->GetLargestPossibleRegion().GetNumberOfPixels())
+  {
+    output->FillBuffer(defaultPixelValue);
+  }
+
   it.GoToBegin();
   while (!it.IsAtEnd())
   {
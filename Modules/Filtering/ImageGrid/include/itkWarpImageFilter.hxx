@@ -284,10 +284,11 @@ WarpImageFilter<TInputImage, TOutputImage, TDisplacementField>::DynamicThreadedG
   TotalProgressReporter progress(this, outputPtr->GetRequestedRegion().GetNumberOfPixels());
 
   // iterator for the output image
-  ImageRegionIteratorWithIndex<OutputImageType> outputIt(outputPtr, outputRegionForThread);
-  IndexType                                     index;
-  PointType                                     point;
-  DisplacementType                              displacement;
+  ImageRegionIteratorWithIndex<OutputImageType>  outputIt(outputPtr, outputRegionForThread);
+  IndexType                                      index;
+  PointType                                      point;
+  typename InterpolatorType::ContinuousIndexType inputIndex;
+  DisplacementType                               displacement;
   NumericTraits<DisplacementType>::SetLength(displacement, ImageDimension);
   static_assert(PointType::Dimension == ImageDimension, "ERROR: Point type and ImageDimension must be the same!");
   if (this->m_DefFieldSameInformation)
@@ -310,10 +311,13 @@ WarpImageFilter<TInputImage, TOutputImage, TDisplacementField>::DynamicThreadedG
         point[j] += displacement[j];
       }
 
-      // get the interpolated value
-      if (m_Interpolator->IsInsideBuffer(point))
+      // get the interpolated value, converting the mapped point to a
+      // continuous index once instead of inside both IsInsideBuffer and
+      // Evaluate
+      m_Interpolator->ConvertPointToContinuousIndex(point, inputIndex);
+      if (m_Interpolator->IsInsideBuffer(inputIndex))
       {
-        auto value = static_cast<PixelType>(m_Interpolator->Evaluate(point));
+        auto value = static_cast<PixelType>(m_Interpolator->EvaluateAtContinuousIndex(inputIndex));
         outputIt.Set(value);
       }
       else
@@ -341,9 +345,10 @@ WarpImageFilter<TInputImage, TOutputImage, TDisplacementField>::DynamicThreadedG
       }
 
       // get the interpolated value
-      if (m_Interpolator->IsInsideBuffer(point))
+      m_Interpolator->ConvertPointToContinuousIndex(point, inputIndex);
+      if (m_Interpolator->IsInsideBuffer(inputIndex))
       {
-        auto value = static_cast<PixelType>(m_Interpolator->Evaluate(point));
+        auto value = static_cast<PixelType>(m_Interpolator->EvaluateAtContinuousIndex(inputIndex));
         outputIt.Set(value);
       }
       else
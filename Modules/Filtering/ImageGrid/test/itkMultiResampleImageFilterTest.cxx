@@ -0,0 +1,130 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include <iostream>
+
+#include "itkAffineTransform.h"
+#include "itkMultiResampleImageFilter.h"
+#include "itkResampleImageFilter.h"
+#include "itkNearestNeighborInterpolateImageFunction.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkMath.h"
+#include "itkTestingMacros.h"
+
+int
+itkMultiResampleImageFilterTest(int, char *[])
+{
+  constexpr unsigned int NDimensions = 2;
+
+  using PixelType = float;
+  using ImageType = itk::Image<PixelType, NDimensions>;
+  using ImageIndexType = ImageType::IndexType;
+  using ImageRegionType = ImageType::RegionType;
+  using ImageSizeType = ImageType::SizeType;
+  using CoordRepType = double;
+
+  using AffineTransformType = itk::AffineTransform<CoordRepType, NDimensions>;
+  using NearestInterpolatorType = itk::NearestNeighborInterpolateImageFunction<ImageType, CoordRepType>;
+
+  // Create and configure two images on different grids: an intensity ramp
+  // and a coarser "label" image with a small number of values
+  ImageIndexType  index = { { 0, 0 } };
+  ImageSizeType   size = { { 18, 12 } };
+  ImageRegionType region;
+  region.SetSize(size);
+  region.SetIndex(index);
+
+  auto intensityImage = ImageType::New();
+  intensityImage->SetRegions(region);
+  intensityImage->Allocate();
+
+  itk::ImageRegionIteratorWithIndex<ImageType> iter(intensityImage, region);
+  for (iter.GoToBegin(); !iter.IsAtEnd(); ++iter)
+  {
+    index = iter.GetIndex();
+    iter.Set(index[0] + index[1]);
+  }
+
+  auto labelImage = ImageType::New();
+  labelImage->SetRegions(region);
+  ImageType::SpacingType labelSpacing;
+  labelSpacing.Fill(1.5);
+  labelImage->SetSpacing(labelSpacing);
+  labelImage->Allocate();
+
+  itk::ImageRegionIteratorWithIndex<ImageType> labelIter(labelImage, region);
+  for (labelIter.GoToBegin(); !labelIter.IsAtEnd(); ++labelIter)
+  {
+    index = labelIter.GetIndex();
+    labelIter.Set((index[0] / 4 + index[1] / 4) % 3);
+  }
+
+  // Create an affine transformation
+  auto aff = AffineTransformType::New();
+  aff->Scale(0.75);
+
+  // Create and configure the joint resampling filter: linear interpolation
+  // (the default) for the intensity image, nearest neighbor for the labels
+  using MultiResampleType = itk::MultiResampleImageFilter<ImageType, ImageType>;
+  auto multiResample = MultiResampleType::New();
+
+  ITK_EXERCISE_BASIC_OBJECT_METHODS(multiResample, MultiResampleImageFilter, ImageToImageFilter);
+
+  auto nearestInterpolator = NearestInterpolatorType::New();
+
+  multiResample->SetInput(0, intensityImage);
+  multiResample->SetInput(1, labelImage);
+  multiResample->SetInterpolator(1, nearestInterpolator);
+  ITK_TEST_EXPECT_EQUAL(multiResample->GetInterpolator(1), nearestInterpolator.GetPointer());
+  multiResample->SetTransform(aff);
+  multiResample->SetSize(size);
+  multiResample->SetDefaultPixelValue(-1.0f);
+  ITK_TRY_EXPECT_NO_EXCEPTION(multiResample->Update());
+
+  // Each output must match the equivalent individual resampling
+  using ResampleType = itk::ResampleImageFilter<ImageType, ImageType>;
+  for (unsigned int n = 0; n < 2; ++n)
+  {
+    auto resample = ResampleType::New();
+    resample->SetInput(n == 0 ? intensityImage : labelImage);
+    if (n == 1)
+    {
+      auto referenceNearestInterpolator = NearestInterpolatorType::New();
+      resample->SetInterpolator(referenceNearestInterpolator);
+    }
+    resample->SetTransform(aff);
+    resample->SetSize(size);
+    resample->SetDefaultPixelValue(-1.0f);
+    resample->Update();
+
+    itk::ImageRegionConstIterator<ImageType> jointIter(multiResample->GetOutput(n), region);
+    itk::ImageRegionConstIterator<ImageType> singleIter(resample->GetOutput(), region);
+    for (; !jointIter.IsAtEnd(); ++jointIter, ++singleIter)
+    {
+      if (itk::Math::NotExactlyEquals(jointIter.Get(), singleIter.Get()))
+      {
+        std::cout << "Test failed! Output " << n << " differs at " << jointIter.GetIndex() << ": "
+                  << jointIter.Get() << " vs " << singleIter.Get() << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
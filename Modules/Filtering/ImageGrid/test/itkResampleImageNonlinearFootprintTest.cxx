@@ -0,0 +1,157 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include <iostream>
+
+#include "itkAffineTransform.h"
+#include "itkResampleImageFilter.h"
+#include "itkStreamingImageFilter.h"
+#include "itkPipelineMonitorImageFilter.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkMath.h"
+#include "itkTestingMacros.h"
+
+/* Tests the sampled input footprint computation for nonlinear transforms.
+ * An affine transform that reports a nonlinear category forces the
+ * nonlinear code paths while keeping the expected result exact. */
+
+namespace
+{
+
+template <typename TCoordRepType, unsigned int NDimensions>
+class NonlinearAffineTransform : public itk::AffineTransform<TCoordRepType, NDimensions>
+{
+public:
+  /** Standard class type aliases.   */
+  using Self = NonlinearAffineTransform;
+  using Superclass = itk::AffineTransform<TCoordRepType, NDimensions>;
+  using Pointer = itk::SmartPointer<Self>;
+  using ConstPointer = itk::SmartPointer<const Self>;
+
+  /** New macro for creation of through a smart pointer. */
+  itkSimpleNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(NonlinearAffineTransform, AffineTransform);
+
+  /** Override this so not linear. See test below. */
+  typename itk::TransformBaseTemplate<TCoordRepType>::TransformCategoryEnum
+  GetTransformCategory() const override
+  {
+    return itk::TransformBaseTemplate<TCoordRepType>::TransformCategoryEnum::UnknownTransformCategory;
+  }
+};
+} // namespace
+
+int
+itkResampleImageNonlinearFootprintTest(int, char *[])
+{
+  constexpr unsigned int NDimensions = 2;
+
+  using PixelType = float;
+  using ImageType = itk::Image<PixelType, NDimensions>;
+  using CoordRepType = double;
+
+  using TransformType = NonlinearAffineTransform<CoordRepType, NDimensions>;
+  using ResampleFilterType = itk::ResampleImageFilter<ImageType, ImageType>;
+
+  // Create an image with a ramp
+  ImageType::SizeType size = { { 64, 64 } };
+
+  auto image = ImageType::New();
+  image->SetRegions(ImageType::RegionType(size));
+  image->Allocate();
+
+  itk::ImageRegionIteratorWithIndex<ImageType> iter(image, image->GetLargestPossibleRegion());
+  for (iter.GoToBegin(); !iter.IsAtEnd(); ++iter)
+  {
+    iter.Set(iter.GetIndex()[0] + iter.GetIndex()[1]);
+  }
+
+  auto transform = TransformType::New();
+  transform->Scale(0.6);
+  TransformType::OutputVectorType translation;
+  translation[0] = 3.7;
+  translation[1] = -2.1;
+  transform->Translate(translation);
+
+  // Reference: default behavior, whole input resident
+  auto reference = ResampleFilterType::New();
+  reference->SetInput(image);
+  reference->SetTransform(transform);
+  reference->SetSize(size);
+  reference->SetDefaultPixelValue(-1.0f);
+  ITK_TRY_EXPECT_NO_EXCEPTION(reference->Update());
+
+  // Streamed: sampled input footprint per division
+  using MonitorFilterType = itk::PipelineMonitorImageFilter<ImageType>;
+  auto monitor = MonitorFilterType::New();
+  monitor->SetInput(image);
+
+  auto resample = ResampleFilterType::New();
+  resample->SetInput(monitor->GetOutput());
+  resample->SetTransform(transform);
+  resample->SetSize(size);
+  resample->SetDefaultPixelValue(-1.0f);
+
+  bool useNonlinearInputFootprint = true;
+  ITK_TEST_SET_GET_BOOLEAN(resample, UseNonlinearInputFootprint, useNonlinearInputFootprint);
+
+  unsigned int nonlinearFootprintSamplesPerDimension = 8;
+  resample->SetNonlinearFootprintSamplesPerDimension(nonlinearFootprintSamplesPerDimension);
+  ITK_TEST_SET_GET_VALUE(nonlinearFootprintSamplesPerDimension,
+                         resample->GetNonlinearFootprintSamplesPerDimension());
+
+  itk::SizeValueType nonlinearFootprintPadding = 2;
+  resample->SetNonlinearFootprintPadding(nonlinearFootprintPadding);
+  ITK_TEST_SET_GET_VALUE(nonlinearFootprintPadding, resample->GetNonlinearFootprintPadding());
+
+  using StreamerType = itk::StreamingImageFilter<ImageType, ImageType>;
+  auto streamer = StreamerType::New();
+  streamer->SetInput(resample->GetOutput());
+  streamer->SetNumberOfStreamDivisions(4);
+  ITK_TRY_EXPECT_NO_EXCEPTION(streamer->Update());
+
+  // The input must have been requested in proper sub-regions
+  const itk::SizeValueType totalPixels = image->GetLargestPossibleRegion().GetNumberOfPixels();
+  for (const auto & requestedRegion : monitor->GetOutputRequestedRegions())
+  {
+    if (requestedRegion.GetNumberOfPixels() >= totalPixels)
+    {
+      std::cout << "Test failed! Input requested region " << requestedRegion << " is not a proper sub-region."
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // The streamed result must match the fully resident one
+  itk::ImageRegionConstIterator<ImageType> streamedIter(streamer->GetOutput(), streamer->GetOutput()->GetLargestPossibleRegion());
+  itk::ImageRegionConstIterator<ImageType> referenceIter(reference->GetOutput(), reference->GetOutput()->GetLargestPossibleRegion());
+  for (; !streamedIter.IsAtEnd(); ++streamedIter, ++referenceIter)
+  {
+    if (itk::Math::NotExactlyEquals(streamedIter.Get(), referenceIter.Get()))
+    {
+      std::cout << "Test failed! Streamed output differs at " << streamedIter.GetIndex() << ": " << streamedIter.Get()
+                << " vs " << referenceIter.Get() << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -19,7 +19,7 @@
 #define itkHistogramMatchingImageFilter_hxx
 
 #include "itkHistogramMatchingImageFilter.h"
-#include "itkImageRegionIterator.h"
+#include "itkImageScanlineIterator.h"
 #include "itkNumericTraits.h"
 #include "itkMath.h"
 #include <vector>
@@ -321,42 +321,49 @@ HistogramMatchingImageFilter<TInputImage, TOutputImage, THistogramMeasurement>::
   OutputImagePointer     output = this->GetOutput();
 
   // Transform the source image and write to output.
-  using InputConstIterator = ImageRegionConstIterator<InputImageType>;
-  using OutputIterator = ImageRegionIterator<OutputImageType>;
+  using InputConstIterator = ImageScanlineConstIterator<InputImageType>;
+  using OutputIterator = ImageScanlineIterator<OutputImageType>;
 
   InputConstIterator inIter(input, outputRegionForThread);
   OutputIterator     outIter(output, outputRegionForThread);
 
-  for (SizeValueType i = 0; !outIter.IsAtEnd(); ++inIter, ++outIter, i++)
+  while (!outIter.IsAtEnd())
   {
-    const auto    srcValue = static_cast<double>(inIter.Get());
-    SizeValueType j = 0;
-    for (; j < m_NumberOfMatchPoints + 2; ++j)
+    while (!outIter.IsAtEndOfLine())
     {
-      if (srcValue < m_QuantileTable[0][j])
+      const auto    srcValue = static_cast<double>(inIter.Get());
+      SizeValueType j = 0;
+      for (; j < m_NumberOfMatchPoints + 2; ++j)
       {
-        break;
+        if (srcValue < m_QuantileTable[0][j])
+        {
+          break;
+        }
       }
-    }
 
-    double mappedValue;
-    if (j == 0)
-    {
-      // Linear interpolate from min to point[0]
-      mappedValue = m_ReferenceMinValue + (srcValue - m_SourceMinValue) * m_LowerGradient;
-    }
-    else if (j == m_NumberOfMatchPoints + 2)
-    {
-      // Linear interpolate from point[m_NumberOfMatchPoints+1] to max
-      mappedValue = m_ReferenceMaxValue + (srcValue - m_SourceMaxValue) * m_UpperGradient;
-    }
-    else
-    {
-      // Linear interpolate from point[j] and point[j+1].
-      mappedValue = m_QuantileTable[1][j - 1] + (srcValue - m_QuantileTable[0][j - 1]) * m_Gradients[j - 1];
-    }
+      double mappedValue;
+      if (j == 0)
+      {
+        // Linear interpolate from min to point[0]
+        mappedValue = m_ReferenceMinValue + (srcValue - m_SourceMinValue) * m_LowerGradient;
+      }
+      else if (j == m_NumberOfMatchPoints + 2)
+      {
+        // Linear interpolate from point[m_NumberOfMatchPoints+1] to max
+        mappedValue = m_ReferenceMaxValue + (srcValue - m_SourceMaxValue) * m_UpperGradient;
+      }
+      else
+      {
+        // Linear interpolate from point[j] and point[j+1].
+        mappedValue = m_QuantileTable[1][j - 1] + (srcValue - m_QuantileTable[0][j - 1]) * m_Gradients[j - 1];
+      }
 
-    outIter.Set(static_cast<OutputPixelType>(mappedValue));
+      outIter.Set(static_cast<OutputPixelType>(mappedValue));
+      ++inIter;
+      ++outIter;
+    }
+    inIter.NextLine();
+    outIter.NextLine();
   }
 }
 
@@ -371,7 +378,7 @@ HistogramMatchingImageFilter<TInputImage, TOutputImage, THistogramMeasurement>::
   THistogramMeasurement & maxValue,
   THistogramMeasurement & meanValue)
 {
-  using ConstIterator = ImageRegionConstIterator<InputImageType>;
+  using ConstIterator = ImageScanlineConstIterator<InputImageType>;
   ConstIterator iter(image, image->GetBufferedRegion());
 
   double        sum = 0.0;
@@ -382,20 +389,24 @@ HistogramMatchingImageFilter<TInputImage, TOutputImage, THistogramMeasurement>::
 
   while (!iter.IsAtEnd())
   {
-    const auto value = static_cast<THistogramMeasurement>(iter.Get());
-    sum += static_cast<double>(value);
-
-    if (value < minValue)
-    {
-      minValue = value;
-    }
-    if (value > maxValue)
+    while (!iter.IsAtEndOfLine())
     {
-      maxValue = value;
-    }
+      const auto value = static_cast<THistogramMeasurement>(iter.Get());
+      sum += static_cast<double>(value);
 
-    ++iter;
-    ++count;
+      if (value < minValue)
+      {
+        minValue = value;
+      }
+      if (value > maxValue)
+      {
+        maxValue = value;
+      }
+
+      ++iter;
+      ++count;
+    }
+    iter.NextLine();
   }
 
   meanValue = static_cast<THistogramMeasurement>(sum / static_cast<double>(count));
@@ -442,25 +453,30 @@ HistogramMatchingImageFilter<TInputImage, TOutputImage, THistogramMeasurement>::
 
   {
     // put each image pixel into the histogram
-    using ConstIterator = ImageRegionConstIterator<InputImageType>;
+    using ConstIterator = ImageScanlineConstIterator<InputImageType>;
     ConstIterator iter(image, image->GetBufferedRegion());
 
     iter.GoToBegin();
     while (!iter.IsAtEnd())
     {
-      const InputPixelType & value = iter.Value();
-
-      if (static_cast<double>(value) >= minHistogramValidValue && static_cast<double>(value) <= maxHistogramValidValue)
+      while (!iter.IsAtEndOfLine())
       {
-        // add sample to histogram
-        measurement[0] = value;
-        const bool is_inside_histogram = histogram->GetIndex(measurement, index);
-        if (is_inside_histogram)
+        const InputPixelType & value = iter.Value();
+
+        if (static_cast<double>(value) >= minHistogramValidValue &&
+            static_cast<double>(value) <= maxHistogramValidValue)
         {
-          histogram->IncreaseFrequencyOfIndex(index, 1);
+          // add sample to histogram
+          measurement[0] = value;
+          const bool is_inside_histogram = histogram->GetIndex(measurement, index);
+          if (is_inside_histogram)
+          {
+            histogram->IncreaseFrequencyOfIndex(index, 1);
+          }
         }
+        ++iter;
       }
-      ++iter;
+      iter.NextLine();
     }
   }
 }
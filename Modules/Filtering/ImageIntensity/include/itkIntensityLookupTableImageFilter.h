@@ -0,0 +1,195 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkIntensityLookupTableImageFilter_h
+#define itkIntensityLookupTableImageFilter_h
+
+#include "itkInPlaceImageFilter.h"
+#include "itkNumericTraits.h"
+
+#include <type_traits>
+#include <vector>
+
+namespace itk
+{
+/**
+ *\class IntensityLookupTableImageFilter
+ * \brief Applies a precomputed intensity lookup table to an integer image.
+ *
+ * For images with 8-bit or 16-bit integer pixels, any per-pixel intensity
+ * transform reduces to a table lookup over at most 65536 distinct input
+ * values. This filter evaluates a user-supplied transfer function once per
+ * possible input value with BuildLookupTable() and then applies the
+ * resulting table in a single pass over the image.
+ *
+ * Several transforms can be fused into one image pass: after building the
+ * table from the first transfer function, ComposeLookupTable() maps each
+ * table entry through a further output-to-output transform. A chain such as
+ * intensity windowing followed by rescaling therefore reads and writes the
+ * image only once, and each transfer function is evaluated once per table
+ * entry instead of once per pixel. The output is identical to running the
+ * transforms pixel by pixel, since the same function values are assigned.
+ *
+ * The transfer function passed to BuildLookupTable() may be any callable
+ * mapping the input pixel type to the output pixel type, including the
+ * functors of the existing intensity filters such as
+ * Functor::IntensityWindowingTransform or Functor::IntensityLinearTransform.
+ *
+ * \ingroup IntensityImageFilters  MultiThreaded
+ * \ingroup ITKImageIntensity
+ *
+ * \sa IntensityWindowingImageFilter
+ * \sa RescaleIntensityImageFilter
+ * \sa HistogramMatchingImageFilter
+ */
+template <typename TInputImage, typename TOutputImage = TInputImage>
+class ITK_TEMPLATE_EXPORT IntensityLookupTableImageFilter : public InPlaceImageFilter<TInputImage, TOutputImage>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(IntensityLookupTableImageFilter);
+
+  /** Standard class type aliases. */
+  using Self = IntensityLookupTableImageFilter;
+  using Superclass = InPlaceImageFilter<TInputImage, TOutputImage>;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Runtime information support. */
+  itkTypeMacro(IntensityLookupTableImageFilter, InPlaceImageFilter);
+
+  using InputImageType = TInputImage;
+  using OutputImageType = TOutputImage;
+  using InputPixelType = typename TInputImage::PixelType;
+  using OutputPixelType = typename TOutputImage::PixelType;
+  using OutputImageRegionType = typename TOutputImage::RegionType;
+
+  static_assert(std::is_integral<InputPixelType>::value && !std::is_same<InputPixelType, bool>::value &&
+                  sizeof(InputPixelType) <= 2,
+                "IntensityLookupTableImageFilter requires an 8-bit or 16-bit integer input pixel type.");
+
+  /** Number of entries in the lookup table: one per possible input value. */
+  static constexpr SizeValueType LookupTableSize = SizeValueType{ 1 } << (8 * sizeof(InputPixelType));
+
+  using LookupTableType = std::vector<OutputPixelType>;
+
+  /** Fill the lookup table by evaluating the given transfer function at
+   * every possible input value. The transfer function must be callable with
+   * an InputPixelType argument and return a value convertible to
+   * OutputPixelType. */
+  template <typename TTransferFunction>
+  void
+  BuildLookupTable(const TTransferFunction & transferFunction)
+  {
+    m_LookupTable.resize(LookupTableSize);
+    for (SizeValueType i = 0; i < LookupTableSize; ++i)
+    {
+      m_LookupTable[i] = static_cast<OutputPixelType>(transferFunction(Self::ComputeInputValue(i)));
+    }
+    this->Modified();
+  }
+
+  /** Map every entry of an already built lookup table through a further
+   * transfer function on the output pixel type, fusing the additional
+   * transform into the same image pass. */
+  template <typename TTransferFunction>
+  void
+  ComposeLookupTable(const TTransferFunction & transferFunction)
+  {
+    if (m_LookupTable.size() != LookupTableSize)
+    {
+      itkExceptionMacro("The lookup table must be built before it can be composed with another transform.");
+    }
+    for (SizeValueType i = 0; i < LookupTableSize; ++i)
+    {
+      m_LookupTable[i] = static_cast<OutputPixelType>(transferFunction(m_LookupTable[i]));
+    }
+    this->Modified();
+  }
+
+  /** Set an externally computed lookup table. The table must hold exactly
+   * LookupTableSize entries, ordered from the smallest possible input value
+   * to the largest. */
+  void
+  SetLookupTable(const LookupTableType & lookupTable)
+  {
+    if (lookupTable.size() != LookupTableSize)
+    {
+      itkExceptionMacro("The lookup table must hold " << LookupTableSize << " entries but holds "
+                                                      << lookupTable.size() << ".");
+    }
+    m_LookupTable = lookupTable;
+    this->Modified();
+  }
+
+  /** Get the current lookup table. */
+  const LookupTableType &
+  GetLookupTable() const
+  {
+    return m_LookupTable;
+  }
+
+#ifdef ITK_USE_CONCEPT_CHECKING
+  // Begin concept checking
+  itkConceptMacro(SameDimensionCheck,
+                  (Concept::SameDimension<TInputImage::ImageDimension, TOutputImage::ImageDimension>));
+  // End concept checking
+#endif
+
+protected:
+  IntensityLookupTableImageFilter() = default;
+  ~IntensityLookupTableImageFilter() override = default;
+
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+  void
+  BeforeThreadedGenerateData() override;
+
+  void
+  DynamicThreadedGenerateData(const OutputImageRegionType & outputRegionForThread) override;
+
+  /** Table index of an input value: its offset from the smallest possible
+   * input value. */
+  static SizeValueType
+  ComputeLookupIndex(InputPixelType value)
+  {
+    using UnsignedInputType = typename std::make_unsigned<InputPixelType>::type;
+    return static_cast<SizeValueType>(static_cast<UnsignedInputType>(
+      static_cast<UnsignedInputType>(value) - static_cast<UnsignedInputType>(NumericTraits<InputPixelType>::min())));
+  }
+
+  /** Input value corresponding to a table index. */
+  static InputPixelType
+  ComputeInputValue(SizeValueType index)
+  {
+    return static_cast<InputPixelType>(static_cast<IndexValueType>(index) +
+                                       static_cast<IndexValueType>(NumericTraits<InputPixelType>::min()));
+  }
+
+private:
+  LookupTableType m_LookupTable;
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkIntensityLookupTableImageFilter.hxx"
+#endif
+
+#endif
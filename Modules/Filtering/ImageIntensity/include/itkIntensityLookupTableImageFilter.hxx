@@ -0,0 +1,74 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkIntensityLookupTableImageFilter_hxx
+#define itkIntensityLookupTableImageFilter_hxx
+
+#include "itkIntensityLookupTableImageFilter.h"
+#include "itkImageScanlineIterator.h"
+
+namespace itk
+{
+
+template <typename TInputImage, typename TOutputImage>
+void
+IntensityLookupTableImageFilter<TInputImage, TOutputImage>::BeforeThreadedGenerateData()
+{
+  if (m_LookupTable.size() != LookupTableSize)
+  {
+    itkExceptionMacro("No lookup table has been set. Call BuildLookupTable() or SetLookupTable() before Update().");
+  }
+}
+
+template <typename TInputImage, typename TOutputImage>
+void
+IntensityLookupTableImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(
+  const OutputImageRegionType & outputRegionForThread)
+{
+  const InputImageType * input = this->GetInput();
+  OutputImageType *      output = this->GetOutput();
+
+  const OutputPixelType * lookupTable = m_LookupTable.data();
+
+  ImageScanlineConstIterator<InputImageType> inputIt(input, outputRegionForThread);
+  ImageScanlineIterator<OutputImageType>     outputIt(output, outputRegionForThread);
+
+  while (!inputIt.IsAtEnd())
+  {
+    while (!inputIt.IsAtEndOfLine())
+    {
+      outputIt.Set(lookupTable[Self::ComputeLookupIndex(inputIt.Get())]);
+      ++inputIt;
+      ++outputIt;
+    }
+    inputIt.NextLine();
+    outputIt.NextLine();
+  }
+}
+
+template <typename TInputImage, typename TOutputImage>
+void
+IntensityLookupTableImageFilter<TInputImage, TOutputImage>::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "LookupTable: " << (m_LookupTable.empty() ? "(not built)" : "(built)") << std::endl;
+}
+
+} // end namespace itk
+
+#endif
@@ -19,6 +19,8 @@
 #define itkMaskImageFilter_h
 
 #include "itkBinaryGeneratorImageFilter.h"
+#include "itkMaskRegionOccupancyGrid.h"
+#include "itkImageScanlineIterator.h"
 #include "itkNumericTraits.h"
 #include "itkVariableLengthVector.h"
 #include "itkMath.h"
@@ -224,6 +226,17 @@ public:
     return this->GetFunctor().GetMaskingValue();
   }
 
+  /** Precompute a per-tile occupancy grid of the mask before the threaded
+   * pass and dispatch on it: tiles entirely at the masking value are filled
+   * with the outside value without reading the input, tiles entirely off it
+   * are copied without the per-pixel mask test, and only mixed tiles run the
+   * ordinary functor loop. The output is identical either way. Worthwhile
+   * when the mask covers a small fraction of the image; off by default
+   * because the grid costs one extra pass over the mask. */
+  itkSetMacro(PrecomputeMaskOccupancy, bool);
+  itkGetConstMacro(PrecomputeMaskOccupancy, bool);
+  itkBooleanMacro(PrecomputeMaskOccupancy);
+
 #ifdef ITK_USE_CONCEPT_CHECKING
   // Begin concept checking
   itkConceptMacro(MaskEqualityComparableCheck, (Concept::EqualityComparable<typename TMaskImage::PixelType>));
@@ -241,6 +254,7 @@ protected:
   {
     Superclass::PrintSelf(os, indent);
     os << indent << "OutsideValue: " << this->GetOutsideValue() << std::endl;
+    os << indent << "PrecomputeMaskOccupancy: " << (m_PrecomputeMaskOccupancy ? "On" : "Off") << std::endl;
   }
 
   void
@@ -250,9 +264,108 @@ protected:
     this->CheckOutsideValue(static_cast<PixelType *>(nullptr));
 
     this->SetFunctor(this->GetFunctor());
+
+    if (m_PrecomputeMaskOccupancy)
+    {
+      m_OccupancyGrid.Compute(this->GetMaskImage(),
+                              this->GetOutput()->GetRequestedRegion(),
+                              this->GetMaskingValue(),
+                              this->GetMultiThreader());
+    }
+  }
+
+  void
+  DynamicThreadedGenerateData(const typename Superclass::OutputImageRegionType & outputRegionForThread) override
+  {
+    if (m_PrecomputeMaskOccupancy)
+    {
+      this->ThreadedMaskOccupancyDispatch(outputRegionForThread);
+    }
+    else
+    {
+      Superclass::DynamicThreadedGenerateData(outputRegionForThread);
+    }
+  }
+
+  /** Classify the region against the occupancy grid; handle uniform regions
+   * without per-pixel mask tests and split mixed ones down to tile-sized
+   * pieces before falling back to the functor loop. */
+  void
+  ThreadedMaskOccupancyDispatch(const typename Superclass::OutputImageRegionType & region)
+  {
+    using OccupancyEnum = typename OccupancyGridType::OccupancyEnum;
+
+    switch (m_OccupancyGrid.ClassifyRegion(region))
+    {
+      case OccupancyEnum::AllOutside:
+      {
+        // Every pixel takes the outside value; the inputs are not read
+        const typename TOutputImage::PixelType outsideValue = this->GetOutsideValue();
+        ImageScanlineIterator<TOutputImage>    outIt(this->GetOutput(), region);
+        while (!outIt.IsAtEnd())
+        {
+          while (!outIt.IsAtEndOfLine())
+          {
+            outIt.Set(outsideValue);
+            ++outIt;
+          }
+          outIt.NextLine();
+        }
+        return;
+      }
+      case OccupancyEnum::AllInside:
+      {
+        // No pixel is masked; cast-copy without the per-pixel test
+        ImageScanlineConstIterator<TInputImage> inIt(this->GetInput(), region);
+        ImageScanlineIterator<TOutputImage>     outIt(this->GetOutput(), region);
+        while (!outIt.IsAtEnd())
+        {
+          while (!outIt.IsAtEndOfLine())
+          {
+            outIt.Set(static_cast<typename TOutputImage::PixelType>(inIt.Get()));
+            ++inIt;
+            ++outIt;
+          }
+          inIt.NextLine();
+          outIt.NextLine();
+        }
+        return;
+      }
+      case OccupancyEnum::Mixed:
+      default:
+        break;
+    }
+
+    // Split the mixed region in half along the largest dimension still
+    // above the tile length, so uniform tiles inside it are recovered
+    unsigned int splitDimension = TOutputImage::ImageDimension;
+    for (unsigned int d = 0; d < TOutputImage::ImageDimension; ++d)
+    {
+      if (region.GetSize(d) > m_OccupancyGrid.GetTileSize()[d] &&
+          (splitDimension == TOutputImage::ImageDimension || region.GetSize(d) > region.GetSize(splitDimension)))
+      {
+        splitDimension = d;
+      }
+    }
+    if (splitDimension == TOutputImage::ImageDimension)
+    {
+      // Tile-sized, genuinely mixed: run the ordinary functor loop
+      Superclass::DynamicThreadedGenerateData(region);
+      return;
+    }
+
+    typename Superclass::OutputImageRegionType lowerRegion = region;
+    typename Superclass::OutputImageRegionType upperRegion = region;
+    const SizeValueType                        lowerSize = region.GetSize(splitDimension) / 2;
+    lowerRegion.SetSize(splitDimension, lowerSize);
+    upperRegion.SetIndex(splitDimension, region.GetIndex(splitDimension) + static_cast<IndexValueType>(lowerSize));
+    upperRegion.SetSize(splitDimension, region.GetSize(splitDimension) - lowerSize);
+    this->ThreadedMaskOccupancyDispatch(lowerRegion);
+    this->ThreadedMaskOccupancyDispatch(upperRegion);
   }
 
 private:
+  using OccupancyGridType = MaskRegionOccupancyGrid<TMaskImage>;
   itkGetConstReferenceMacro(Functor, FunctorType);
   FunctorType &
   GetFunctor()
@@ -262,6 +375,9 @@ private:
 
   FunctorType m_Functor;
 
+  bool              m_PrecomputeMaskOccupancy{ false };
+  OccupancyGridType m_OccupancyGrid;
+
   template <typename TPixelType>
   void
   CheckOutsideValue(const TPixelType *)
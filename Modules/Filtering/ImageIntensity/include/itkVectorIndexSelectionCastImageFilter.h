@@ -19,6 +19,11 @@
 #define itkVectorIndexSelectionCastImageFilter_h
 
 #include "itkUnaryFunctorImageFilter.h"
+#include "itkImage.h"
+#include "itkVectorImage.h"
+#include "itkVectorImageComponentAlgorithm.h"
+#include "itkImageScanlineIterator.h"
+#include "itkTotalProgressReporter.h"
 
 namespace itk
 {
@@ -103,6 +108,8 @@ public:
   using Pointer = SmartPointer<Self>;
   using ConstPointer = SmartPointer<const Self>;
 
+  using OutputImageRegionType = typename Superclass::OutputImageRegionType;
+
   /** Method for creation through the object factory. */
   itkNewMacro(Self);
 
@@ -165,6 +172,57 @@ protected:
                         << " is greater than the number of components = " << numberOfComponents);
     }
   }
+
+  void
+  DynamicThreadedGenerateData(const OutputImageRegionType & outputRegionForThread) override
+  {
+    this->GenerateDataInRegion(outputRegionForThread, std::integral_constant<bool, UseGatherFastPath>{});
+  }
+
+private:
+  /** True when the input is a VectorImage and the output a plain Image of
+   * equal dimension, so the component can be extracted with a blocked
+   * strided gather instead of per-pixel functor calls. */
+  static constexpr bool UseGatherFastPath =
+    std::is_same<TInputImage,
+                 VectorImage<typename TInputImage::InternalPixelType, TInputImage::ImageDimension>>::value &&
+    std::is_same<TOutputImage, Image<typename TOutputImage::PixelType, TOutputImage::ImageDimension>>::value &&
+    TInputImage::ImageDimension == TOutputImage::ImageDimension;
+
+  void
+  GenerateDataInRegion(const OutputImageRegionType & outputRegionForThread, std::true_type)
+  {
+    const TInputImage * input = this->GetInput();
+    TOutputImage *      output = this->GetOutput();
+
+    const unsigned int numberOfComponents = input->GetNumberOfComponentsPerPixel();
+    const unsigned int component = this->GetIndex();
+
+    const typename TInputImage::InternalPixelType * inputBuffer = input->GetBufferPointer();
+    typename TOutputImage::PixelType *              outputBuffer = output->GetBufferPointer();
+
+    TotalProgressReporter progress(this, output->GetRequestedRegion().GetNumberOfPixels());
+
+    const SizeValueType spanLength = outputRegionForThread.GetSize()[0];
+
+    // The scanline iterator is used only as a line cursor; each scanline of
+    // the interleaved input is gathered into the contiguous output span.
+    ImageScanlineIterator<TOutputImage> outputIt(output, outputRegionForThread);
+    for (outputIt.GoToBegin(); !outputIt.IsAtEnd(); outputIt.NextLine())
+    {
+      const auto   index = outputIt.GetIndex();
+      const auto * inputSpan = inputBuffer + input->ComputeOffset(index) * numberOfComponents;
+      auto *       outputSpan = outputBuffer + output->ComputeOffset(index);
+      VectorImageComponentAlgorithm::GatherComponent(inputSpan, spanLength, numberOfComponents, component, outputSpan);
+      progress.Completed(spanLength);
+    }
+  }
+
+  void
+  GenerateDataInRegion(const OutputImageRegionType & outputRegionForThread, std::false_type)
+  {
+    Superclass::DynamicThreadedGenerateData(outputRegionForThread);
+  }
 };
 } // end namespace itk
 
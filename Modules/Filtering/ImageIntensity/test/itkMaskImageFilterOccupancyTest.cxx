@@ -0,0 +1,109 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkMaskImageFilter.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkTestingMacros.h"
+
+// The occupancy fast path has to produce exactly the same output as the
+// ordinary per-pixel functor loop
+int
+itkMaskImageFilterOccupancyTest(int, char *[])
+{
+  constexpr unsigned int Dimension = 2;
+  using InputImageType = itk::Image<float, Dimension>;
+  using MaskImageType = itk::Image<unsigned char, Dimension>;
+  using FilterType = itk::MaskImageFilter<InputImageType, MaskImageType>;
+
+  InputImageType::SizeType size;
+  size[0] = 253;
+  size[1] = 147;
+
+  auto input = InputImageType::New();
+  input->SetRegions(size);
+  input->Allocate();
+
+  auto mask = MaskImageType::New();
+  mask->SetRegions(size);
+  mask->Allocate();
+
+  // Sparse mask: a few rectangles, covering roughly a tenth of the image,
+  // with one of them deliberately not aligned to the tile grid
+  itk::ImageRegionIteratorWithIndex<InputImageType> inIt(input, input->GetBufferedRegion());
+  itk::ImageRegionIteratorWithIndex<MaskImageType>  maskIt(mask, mask->GetBufferedRegion());
+  for (inIt.GoToBegin(), maskIt.GoToBegin(); !inIt.IsAtEnd(); ++inIt, ++maskIt)
+  {
+    const itk::IndexValueType x = inIt.GetIndex()[0];
+    const itk::IndexValueType y = inIt.GetIndex()[1];
+    inIt.Set(0.5f * static_cast<float>(x) - 0.25f * static_cast<float>(y));
+
+    const bool inside = (x >= 64 && x < 128 && y >= 0 && y < 64) || (x >= 171 && x < 203 && y >= 77 && y < 140);
+    maskIt.Set(inside ? 1 : 0);
+  }
+
+  auto referenceFilter = FilterType::New();
+  referenceFilter->SetInput(input);
+  referenceFilter->SetMaskImage(mask);
+  referenceFilter->SetOutsideValue(-3.5f);
+  ITK_TRY_EXPECT_NO_EXCEPTION(referenceFilter->Update());
+
+  auto occupancyFilter = FilterType::New();
+
+  ITK_TEST_SET_GET_BOOLEAN(occupancyFilter, PrecomputeMaskOccupancy, true);
+
+  occupancyFilter->SetInput(input);
+  occupancyFilter->SetMaskImage(mask);
+  occupancyFilter->SetOutsideValue(-3.5f);
+  occupancyFilter->PrecomputeMaskOccupancyOn();
+  ITK_TRY_EXPECT_NO_EXCEPTION(occupancyFilter->Update());
+
+  itk::ImageRegionIteratorWithIndex<InputImageType> refIt(referenceFilter->GetOutput(),
+                                                          referenceFilter->GetOutput()->GetBufferedRegion());
+  itk::ImageRegionIteratorWithIndex<InputImageType> occIt(occupancyFilter->GetOutput(),
+                                                          occupancyFilter->GetOutput()->GetBufferedRegion());
+  for (refIt.GoToBegin(), occIt.GoToBegin(); !refIt.IsAtEnd(); ++refIt, ++occIt)
+  {
+    if (itk::Math::NotExactlyEquals(refIt.Get(), occIt.Get()))
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "Outputs differ at index " << refIt.GetIndex() << ": " << refIt.Get() << " vs " << occIt.Get()
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Same check with a non-zero masking value, which flips the roles of the
+  // mask values
+  referenceFilter->SetMaskingValue(1);
+  referenceFilter->Update();
+  occupancyFilter->SetMaskingValue(1);
+  occupancyFilter->Update();
+
+  for (refIt.GoToBegin(), occIt.GoToBegin(); !refIt.IsAtEnd(); ++refIt, ++occIt)
+  {
+    if (itk::Math::NotExactlyEquals(refIt.Get(), occIt.Get()))
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "Outputs with non-zero masking value differ at index " << refIt.GetIndex() << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -20,10 +20,12 @@
 
 #include "itkImageToImageFilter.h"
 #include "itkConstShapedNeighborhoodIterator.h"
+#include <algorithm>
 #include <atomic>
 #include <deque>
 #include <functional>
 #include <mutex>
+#include <utility>
 #include <vector>
 
 namespace itk
@@ -133,7 +135,9 @@ protected:
 
   using LineMapType = std::vector<LineEncodingType>;
 
-  using UnionFindType = std::vector<InternalLabelType>;
+  // The union-find entries are atomic so that the equivalence resolution
+  // threads can link labels without taking a lock.
+  using UnionFindType = std::vector<std::atomic<InternalLabelType>>;
   using ConsecutiveVectorType = std::vector<OutputPixelType>;
 
   SizeValueType
@@ -178,9 +182,20 @@ protected:
   LookupSet(const InternalLabelType label)
   {
     InternalLabelType l = label;
-    while (l != m_UnionFind[l])
+    InternalLabelType parent = m_UnionFind[l].load(std::memory_order_relaxed);
+    while (l != parent)
     {
-      l = m_UnionFind[l]; // transitively sets equivalence
+      // Halve the path while walking it, so later lookups of the same
+      // chain terminate faster. A racing update can only shortcut a
+      // label to one of its ancestors, so a lost exchange is harmless.
+      const InternalLabelType grandparent = m_UnionFind[parent].load(std::memory_order_relaxed);
+      if (parent != grandparent)
+      {
+        InternalLabelType expected = parent;
+        m_UnionFind[l].compare_exchange_weak(expected, grandparent, std::memory_order_relaxed);
+      }
+      l = parent;
+      parent = grandparent;
     }
     return l;
   }
@@ -188,17 +203,25 @@ protected:
   void
   LinkLabels(const InternalLabelType label1, const InternalLabelType label2)
   {
-    std::lock_guard<std::mutex> mutexHolder(m_Mutex);
-    InternalLabelType           E1 = this->LookupSet(label1);
-    InternalLabelType           E2 = this->LookupSet(label2);
+    InternalLabelType E1 = this->LookupSet(label1);
+    InternalLabelType E2 = this->LookupSet(label2);
 
-    if (E1 < E2)
-    {
-      m_UnionFind[E2] = E1;
-    }
-    else
+    while (E1 != E2)
     {
-      m_UnionFind[E1] = E2;
+      if (E1 > E2)
+      {
+        std::swap(E1, E2);
+      }
+      // Attach the larger root below the smaller one, so the root of a
+      // component is always its lowest label. When the exchange loses a
+      // race the new parent is looked up and the link is retried.
+      InternalLabelType expected = E2;
+      if (m_UnionFind[E2].compare_exchange_strong(expected, E1, std::memory_order_relaxed))
+      {
+        return;
+      }
+      E1 = this->LookupSet(E1);
+      E2 = this->LookupSet(expected);
     }
   }
 
@@ -230,6 +253,57 @@ protected:
     return count;
   }
 
+  /** Like CreateConsecutive(), but the consecutive labels are assigned
+   * by decreasing component size, the largest component first, as
+   * RelabelComponentImageFilter would order them. */
+  SizeValueType
+  CreateConsecutiveSortedBySize(OutputPixelType backgroundValue)
+  {
+    const size_t N = m_UnionFind.size();
+
+    // Accumulate the run lengths of each component on its root.
+    std::vector<SizeValueType> sizeOfRoot(N, 0);
+    for (const LineEncodingType & line : m_LineMap)
+    {
+      for (const RunLength & run : line)
+      {
+        sizeOfRoot[this->LookupSet(run.label)] += run.length;
+      }
+    }
+
+    std::vector<InternalLabelType> roots;
+    for (size_t i = 1; i < N; ++i)
+    {
+      if (static_cast<size_t>(m_UnionFind[i]) == i)
+      {
+        roots.push_back(i);
+      }
+    }
+    // Sort the roots by decreasing size; components of equal size keep
+    // their raster scan order.
+    std::stable_sort(roots.begin(), roots.end(), [&sizeOfRoot](InternalLabelType a, InternalLabelType b) {
+      return sizeOfRoot[a] > sizeOfRoot[b];
+    });
+
+    m_Consecutive = ConsecutiveVectorType(N);
+    m_Consecutive[0] = backgroundValue;
+
+    OutputPixelType consecutiveLabel = 0;
+    SizeValueType   count = 0;
+
+    for (const InternalLabelType root : roots)
+    {
+      if (consecutiveLabel == backgroundValue)
+      {
+        ++consecutiveLabel;
+      }
+      m_Consecutive[root] = consecutiveLabel;
+      ++consecutiveLabel;
+      ++count;
+    }
+    return count;
+  }
+
   bool
   CheckNeighbors(const OutputIndexType & A, const OutputIndexType & B) const
   {
@@ -20,7 +20,8 @@
 
 #include "itkGaussianImageSource.h"
 #include "itkGaussianSpatialFunction.h"
-#include "itkImageRegionIterator.h"
+#include "itkImagePhysicalPointStepper.h"
+#include "itkImageScanlineIterator.h"
 #include "itkProgressReporter.h"
 #include "itkObjectFactory.h"
 
@@ -97,26 +98,31 @@ GaussianImageSource<TOutputImage>::GenerateData()
   gaussian->SetNormalized(m_Normalized);
 
   // Create an iterator that will walk the output region
-  using OutputIterator = ImageRegionIterator<TOutputImage>;
+  using OutputIterator = ImageScanlineIterator<TOutputImage>;
   OutputIterator outIt = OutputIterator(outputPtr, outputPtr->GetRequestedRegion());
 
+  // The position at which the function is evaluated is stepped
+  // incrementally along each scanline
+  ImagePhysicalPointStepper<TOutputImage> stepper(outputPtr);
 
   ProgressReporter progress(this, 0, outputPtr->GetRequestedRegion().GetNumberOfPixels());
   // Walk the output image, evaluating the spatial function at each pixel
   outIt.GoToBegin();
   while (!outIt.IsAtEnd())
   {
-    const typename TOutputImage::IndexType index = outIt.GetIndex();
-    // The position at which the function is evaluated
-    typename FunctionType::InputType evalPoint;
-    outputPtr->TransformIndexToPhysicalPoint(index, evalPoint);
-    const double value = gaussian->Evaluate(evalPoint);
-
-    // Set the pixel value to the function value
-    outIt.Set(static_cast<typename TOutputImage::PixelType>(value));
-    progress.CompletedPixel();
-
-    ++outIt;
+    stepper.SetIndex(outIt.GetIndex());
+    while (!outIt.IsAtEndOfLine())
+    {
+      const double value = gaussian->Evaluate(stepper.GetPoint());
+
+      // Set the pixel value to the function value
+      outIt.Set(static_cast<typename TOutputImage::PixelType>(value));
+      progress.CompletedPixel();
+
+      stepper.MoveAlongDimension(0);
+      ++outIt;
+    }
+    outIt.NextLine();
   }
 }
 
@@ -21,6 +21,7 @@
 #include "itkGaussianKernelFunction.h"
 #include "itkGridImageSource.h"
 #include "itkImageLinearIteratorWithIndex.h"
+#include "itkImagePhysicalPointStepper.h"
 #include "itkImageRegionIteratorWithIndex.h"
 #include "itkTotalProgressReporter.h"
 
@@ -63,15 +64,19 @@ GridImageSource<TOutputImage>::BeforeThreadedGenerateData()
       ImageLinearIteratorWithIndex<ImageType> It(output, output->GetRequestedRegion());
       It.SetDirection(i);
 
+      // The physical position is stepped incrementally along the line
+      ImagePhysicalPointStepper<ImageType> stepper(output);
+
       // Add two extra functions in the front and one in the back to ensure
       // coverage.
       unsigned int numberOfGaussians =
         Math::Ceil<unsigned int>(this->GetSize()[i] * output->GetSpacing()[i] / this->m_GridSpacing[i]) + 4u;
-      for (It.GoToBegin(); !It.IsAtEndOfLine(); ++It)
+      It.GoToBegin();
+      stepper.SetIndex(It.GetIndex());
+      for (; !It.IsAtEndOfLine(); ++It, stepper.MoveAlongDimension(i))
       {
         typename ImageType::IndexType index = It.GetIndex();
-        typename ImageType::PointType point;
-        output->TransformIndexToPhysicalPoint(index, point);
+        const typename ImageType::PointType & point = stepper.GetPoint();
 
         RealType val = 0;
         for (unsigned int j = 0; j < numberOfGaussians; ++j)
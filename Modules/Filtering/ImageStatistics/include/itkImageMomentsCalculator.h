@@ -132,7 +132,12 @@ public:
    * This method computes the moments of the image given as a
    * parameter and stores them in the object.  The values of these
    * moments and related parameters can then be retrieved by using
-   * other methods of this object. */
+   * other methods of this object.
+   *
+   * The moment partials are accumulated in parallel over the work units
+   * of the MultiThreaderBase with compensated summation, and when a
+   * spatial object mask is set the sweep is restricted to the pixels
+   * inside the world bounding box of the mask. */
   void
   Compute();
 
@@ -22,6 +22,11 @@
 #include "vnl/algo/vnl_real_eigensystem.h"
 #include "vnl/algo/vnl_symmetric_eigensystem.h"
 #include "itkImageRegionConstIteratorWithIndex.h"
+#include "itkCompensatedSummation.h"
+#include "itkContinuousIndex.h"
+#include "itkMultiThreaderBase.h"
+#include <cmath>
+#include <mutex>
 
 namespace itk
 {
@@ -73,50 +78,140 @@ ImageMomentsCalculator<TImage>::Compute()
   m_Cm.Fill(NumericTraits<typename MatrixType::ValueType>::ZeroValue());
 
   using IndexType = typename ImageType::IndexType;
+  using RegionType = typename ImageType::RegionType;
 
   if (!m_Image)
   {
     return;
   }
 
-  ImageRegionConstIteratorWithIndex<ImageType> it(m_Image, m_Image->GetRequestedRegion());
+  RegionType region = m_Image->GetRequestedRegion();
 
-  while (!it.IsAtEnd())
+  if (m_SpatialObjectMask.IsNotNull())
   {
-    double value = it.Value();
+    // Restrict the sweep to the pixels inside the world bounding box of
+    // the mask; pixels outside of the bounding box cannot be inside the
+    // mask and would not contribute. Each remaining pixel is still
+    // tested against the mask below.
+    const typename SpatialObjectType::BoundingBoxType * boundingBox =
+      m_SpatialObjectMask->GetMyBoundingBoxInWorldSpace();
+    if (boundingBox->GetDiagonalLength2() > 0.0)
+    {
+      const typename SpatialObjectType::PointType bbMin = boundingBox->GetMinimum();
+      const typename SpatialObjectType::PointType bbMax = boundingBox->GetMaximum();
 
-    IndexType indexPosition = it.GetIndex();
+      IndexType lowerIndex;
+      IndexType upperIndex;
+      for (unsigned int corner = 0; corner < (1u << ImageDimension); ++corner)
+      {
+        Point<double, ImageDimension> cornerPoint;
+        for (unsigned int dim = 0; dim < ImageDimension; ++dim)
+        {
+          cornerPoint[dim] = (corner & (1u << dim)) ? bbMax[dim] : bbMin[dim];
+        }
 
-    Point<double, ImageDimension> physicalPosition;
-    m_Image->TransformIndexToPhysicalPoint(indexPosition, physicalPosition);
+        ContinuousIndex<double, ImageDimension> cornerIndex;
+        m_Image->TransformPhysicalPointToContinuousIndex(cornerPoint, cornerIndex);
+        for (unsigned int dim = 0; dim < ImageDimension; ++dim)
+        {
+          const auto floorIndex = static_cast<IndexValueType>(std::floor(cornerIndex[dim]));
+          const auto ceilIndex = static_cast<IndexValueType>(std::ceil(cornerIndex[dim]));
+          if (corner == 0)
+          {
+            lowerIndex[dim] = floorIndex;
+            upperIndex[dim] = ceilIndex;
+          }
+          else
+          {
+            lowerIndex[dim] = std::min(lowerIndex[dim], floorIndex);
+            upperIndex[dim] = std::max(upperIndex[dim], ceilIndex);
+          }
+        }
+      }
 
-    if (m_SpatialObjectMask.IsNull() || m_SpatialObjectMask->IsInsideInWorldSpace(physicalPosition))
-    {
-      m_M0 += value;
+      RegionType maskRegion;
+      maskRegion.SetIndex(lowerIndex);
+      maskRegion.SetUpperIndex(upperIndex);
+      if (maskRegion.Crop(region))
+      {
+        region = maskRegion;
+      }
+      else
+      {
+        // the mask does not overlap the requested region; the zero-mass
+        // exception below reports the situation
+        region = RegionType();
+      }
+    }
+  }
 
-      for (unsigned int i = 0; i < ImageDimension; ++i)
+  // Accumulate the moment partials per chunk with compensated sums and
+  // merge them under a mutex, following StatisticsImageFilter
+  std::mutex mergeMutex;
+
+  MultiThreaderBase::Pointer threader = MultiThreaderBase::New();
+  threader->template ParallelizeImageRegion<ImageDimension>(
+    region,
+    [this, &mergeMutex](const RegionType & chunkRegion) {
+      CompensatedSummation<ScalarType> chunkM0;
+      CompensatedSummation<double>     chunkM1[ImageDimension];
+      CompensatedSummation<double>     chunkM2[ImageDimension][ImageDimension];
+      CompensatedSummation<double>     chunkCg[ImageDimension];
+      CompensatedSummation<double>     chunkCm[ImageDimension][ImageDimension];
+
+      ImageRegionConstIteratorWithIndex<ImageType> it(m_Image, chunkRegion);
+
+      while (!it.IsAtEnd())
       {
-        m_M1[i] += static_cast<double>(indexPosition[i]) * value;
-        for (unsigned int j = 0; j < ImageDimension; ++j)
+        double value = it.Value();
+
+        IndexType indexPosition = it.GetIndex();
+
+        Point<double, ImageDimension> physicalPosition;
+        m_Image->TransformIndexToPhysicalPoint(indexPosition, physicalPosition);
+
+        if (m_SpatialObjectMask.IsNull() || m_SpatialObjectMask->IsInsideInWorldSpace(physicalPosition))
         {
-          double weight = value * static_cast<double>(indexPosition[i]) * static_cast<double>(indexPosition[j]);
-          m_M2[i][j] += weight;
+          chunkM0 += value;
+
+          for (unsigned int i = 0; i < ImageDimension; ++i)
+          {
+            chunkM1[i] += static_cast<double>(indexPosition[i]) * value;
+            for (unsigned int j = 0; j < ImageDimension; ++j)
+            {
+              double weight = value * static_cast<double>(indexPosition[i]) * static_cast<double>(indexPosition[j]);
+              chunkM2[i][j] += weight;
+            }
+          }
+
+          for (unsigned int i = 0; i < ImageDimension; ++i)
+          {
+            chunkCg[i] += physicalPosition[i] * value;
+            for (unsigned int j = 0; j < ImageDimension; ++j)
+            {
+              double weight = value * physicalPosition[i] * physicalPosition[j];
+              chunkCm[i][j] += weight;
+            }
+          }
         }
+
+        ++it;
       }
 
+      const std::lock_guard<std::mutex> lockGuard(mergeMutex);
+      m_M0 += chunkM0.GetSum();
       for (unsigned int i = 0; i < ImageDimension; ++i)
       {
-        m_Cg[i] += physicalPosition[i] * value;
+        m_M1[i] += chunkM1[i].GetSum();
+        m_Cg[i] += chunkCg[i].GetSum();
         for (unsigned int j = 0; j < ImageDimension; ++j)
         {
-          double weight = value * physicalPosition[i] * physicalPosition[j];
-          m_Cm[i][j] += weight;
+          m_M2[i][j] += chunkM2[i][j].GetSum();
+          m_Cm[i][j] += chunkCm[i][j].GetSum();
         }
       }
-    }
-
-    ++it;
-  }
+    },
+    nullptr);
 
   // Throw an error if the total mass is zero
   if (m_M0 == 0.0)
@@ -18,9 +18,10 @@
 #ifndef itkLabelOverlapMeasuresImageFilter_h
 #define itkLabelOverlapMeasuresImageFilter_h
 
-#include "itkImageToImageFilter.h"
+#include "itkImageSink.h"
 #include "itkNumericTraits.h"
 
+#include <mutex>
 #include <unordered_map>
 
 namespace itk
@@ -30,6 +31,11 @@ namespace itk
  * \brief Computes overlap measures between the set same set of labels of
  * pixels of two images. Background is assumed to be 0.
  *
+ * This filter is automatically multi-threaded and can stream its
+ * inputs when NumberOfStreamDivisions is set to more than 1. The
+ * measures are independently accumulated for each streamed and
+ * threaded region and then merged.
+ *
  * This code was contributed in the Insight Journal paper:
  * "Introducing Dice, Jaccard, and Other Label Overlap Measures To ITK"
  * by Nicholas J. Tustison, James C. Gee
@@ -42,14 +48,14 @@ namespace itk
  * \ingroup MultiThreaded
  */
 template <typename TLabelImage>
-class ITK_TEMPLATE_EXPORT LabelOverlapMeasuresImageFilter : public ImageToImageFilter<TLabelImage, TLabelImage>
+class ITK_TEMPLATE_EXPORT LabelOverlapMeasuresImageFilter : public ImageSink<TLabelImage>
 {
 public:
   ITK_DISALLOW_COPY_AND_MOVE(LabelOverlapMeasuresImageFilter);
 
   /** Standard Self type alias */
   using Self = LabelOverlapMeasuresImageFilter;
-  using Superclass = ImageToImageFilter<TLabelImage, TLabelImage>;
+  using Superclass = ImageSink<TLabelImage>;
   using Pointer = SmartPointer<Self>;
   using ConstPointer = SmartPointer<const Self>;
 
@@ -57,7 +63,7 @@ public:
   itkNewMacro(Self);
 
   /** Runtime information support. */
-  itkTypeMacro(LabelOverlapMeasuresImageFilter, ImageToImageFilter);
+  itkTypeMacro(LabelOverlapMeasuresImageFilter, ImageSink);
 
   /** Image related type alias. */
   using LabelImageType = TLabelImage;
@@ -124,32 +130,24 @@ public:
   static constexpr unsigned int ImageDimension = TLabelImage::ImageDimension;
 
   /** Set the source image. */
-  void
+  virtual void
   SetSourceImage(const LabelImageType * image)
   {
-    this->SetNthInput(0, const_cast<LabelImageType *>(image));
+    this->SetInput(image);
   }
 
   /** Set the target image. */
-  void
-  SetTargetImage(const LabelImageType * image)
-  {
-    this->SetNthInput(1, const_cast<LabelImageType *>(image));
-  }
+  itkSetInputMacro(TargetImage, LabelImageType);
 
   /** Get the source image. */
   const LabelImageType *
-  GetSourceImage()
+  GetSourceImage() const
   {
-    return this->GetInput(0);
+    return this->GetInput();
   }
 
   /** Get the target image. */
-  const LabelImageType *
-  GetTargetImage()
-  {
-    return this->GetInput(1);
-  }
+  itkGetInputMacro(TargetImage, LabelImageType);
 
   /** Get the label set measures. */
   MapType
@@ -226,6 +224,19 @@ public:
   /** Get the false positive error for the specified individual label. */
   RealType GetFalsePositiveError(LabelType) const;
 
+  // Change the access from protected to public to expose streaming option, a using statement can not be used due to
+  // limitations of wrapping.
+  void
+  SetNumberOfStreamDivisions(const unsigned int n) override
+  {
+    Superclass::SetNumberOfStreamDivisions(n);
+  }
+  unsigned int
+  GetNumberOfStreamDivisions() const override
+  {
+    return Superclass::GetNumberOfStreamDivisions();
+  }
+
 #ifdef ITK_USE_CONCEPT_CHECKING
   // Begin concept checking
   itkConceptMacro(Input1HasNumericTraitsCheck, (Concept::HasNumericTraits<LabelType>));
@@ -238,37 +249,22 @@ protected:
   void
   PrintSelf(std::ostream & os, Indent indent) const override;
 
-  /**
-   * Pass the input through unmodified. Do this by setting the output to the
-   * source this by setting the output to the source image in the
-   * AllocateOutputs() method.
-   */
-  void
-  AllocateOutputs() override;
-
-  void
-  BeforeThreadedGenerateData() override;
-
   void
-  AfterThreadedGenerateData() override;
-
-  /** Multi-thread version GenerateData. */
-  void
-  ThreadedGenerateData(const RegionType &, ThreadIdType) override;
-
-  void
-  DynamicThreadedGenerateData(const RegionType &) override
+  BeforeStreamedGenerateData() override
   {
-    itkExceptionMacro("This class requires threadId so it must use classic multi-threading model");
+    this->AllocateOutputs();
+    this->m_LabelSetMeasures.clear();
   }
 
-  // Override since the filter produces all of its output
   void
-  EnlargeOutputRequestedRegion(DataObject * data) override;
+  ThreadedStreamedGenerateData(const RegionType &) override;
 
 private:
-  std::vector<MapType> m_LabelSetMeasuresPerThread;
-  MapType              m_LabelSetMeasures;
+  void
+  MergeMap(MapType & m1, MapType & m2) const;
+
+  MapType    m_LabelSetMeasures;
+  std::mutex m_Mutex;
 }; // end of class
 
 } // end namespace itk
@@ -20,8 +20,7 @@
 
 #include "itkLabelOverlapMeasuresImageFilter.h"
 
-#include "itkImageRegionConstIterator.h"
-#include "itkTotalProgressReporter.h"
+#include "itkImageScanlineConstIterator.h"
 
 namespace itk
 {
@@ -30,130 +29,119 @@ template <typename TLabelImage>
 LabelOverlapMeasuresImageFilter<TLabelImage>::LabelOverlapMeasuresImageFilter()
 {
   // This filter requires two input images
-  this->SetNumberOfRequiredInputs(2);
-  this->DynamicMultiThreadingOff();
+  Self::AddRequiredInputName("TargetImage", 1);
 }
 
 template <typename TLabelImage>
 void
-LabelOverlapMeasuresImageFilter<TLabelImage>::EnlargeOutputRequestedRegion(DataObject * data)
+LabelOverlapMeasuresImageFilter<TLabelImage>::MergeMap(MapType & m1, MapType & m2) const
 {
-  Superclass::EnlargeOutputRequestedRegion(data);
-  data->SetRequestedRegionToLargestPossibleRegion();
-}
-
-template <typename TLabelImage>
-void
-LabelOverlapMeasuresImageFilter<TLabelImage>::AllocateOutputs()
-{
-  // Pass the source through as the output
-  LabelImagePointer image = const_cast<TLabelImage *>(this->GetSourceImage());
-  this->GraftOutput(image);
-}
-
-template <typename TLabelImage>
-void
-LabelOverlapMeasuresImageFilter<TLabelImage>::BeforeThreadedGenerateData()
-{
-  ThreadIdType numberOfWorkUnits = this->GetNumberOfWorkUnits();
-
-  // Resize the thread temporaries
-  this->m_LabelSetMeasuresPerThread.resize(numberOfWorkUnits);
-
-  // Initialize the temporaries
-  for (ThreadIdType n = 0; n < numberOfWorkUnits; ++n)
+  for (auto & m2_value : m2)
   {
-    this->m_LabelSetMeasuresPerThread[n].clear();
+    // Does this label exist in the cumulative structure yet?
+    auto m1It = m1.find(m2_value.first);
+    if (m1It == m1.end())
+    {
+      // Move the m2 entry into m1
+      m1.emplace(m2_value.first, m2_value.second);
+    }
+    else
+    {
+      LabelSetMeasures & labelMeasures = (*m1It).second;
+
+      // Accumulate the information from this chunk
+      labelMeasures.m_Source += m2_value.second.m_Source;
+      labelMeasures.m_Target += m2_value.second.m_Target;
+      labelMeasures.m_Union += m2_value.second.m_Union;
+      labelMeasures.m_Intersection += m2_value.second.m_Intersection;
+      labelMeasures.m_SourceComplement += m2_value.second.m_SourceComplement;
+      labelMeasures.m_TargetComplement += m2_value.second.m_TargetComplement;
+    }
   }
-
-  // Initialize the final map
-  this->m_LabelSetMeasures.clear();
 }
 
 template <typename TLabelImage>
 void
-LabelOverlapMeasuresImageFilter<TLabelImage>::AfterThreadedGenerateData()
+LabelOverlapMeasuresImageFilter<TLabelImage>::ThreadedStreamedGenerateData(const RegionType & regionForThread)
 {
-  // Run through the map for each thread and accumulate the set measures.
-  for (ThreadIdType n = 0; n < this->GetNumberOfWorkUnits(); ++n)
+  if (regionForThread.GetNumberOfPixels() == 0)
   {
-    // Iterate over the map for this thread
-    for (MapConstIterator threadIt = this->m_LabelSetMeasuresPerThread[n].begin();
-         threadIt != this->m_LabelSetMeasuresPerThread[n].end();
-         ++threadIt)
-    {
-      // Does this label exist in the cumulative structure yet?
-      auto mapIt = this->m_LabelSetMeasures.find((*threadIt).first);
-      if (mapIt == this->m_LabelSetMeasures.end())
-      {
-        // Create a new entry
-        using MapValueType = typename MapType::value_type;
-        mapIt = this->m_LabelSetMeasures.insert(MapValueType((*threadIt).first, LabelSetMeasures())).first;
-      }
+    return;
+  }
 
-      // Accumulate the information from this thread
-      (*mapIt).second.m_Source += (*threadIt).second.m_Source;
-      (*mapIt).second.m_Target += (*threadIt).second.m_Target;
-      (*mapIt).second.m_Union += (*threadIt).second.m_Union;
-      (*mapIt).second.m_Intersection += (*threadIt).second.m_Intersection;
-      (*mapIt).second.m_SourceComplement += (*threadIt).second.m_SourceComplement;
-      (*mapIt).second.m_TargetComplement += (*threadIt).second.m_TargetComplement;
-    } // end of thread map iterator loop
-  }   // end of thread loop
-}
+  MapType localMeasures;
 
-template <typename TLabelImage>
-void
-LabelOverlapMeasuresImageFilter<TLabelImage>::ThreadedGenerateData(const RegionType & outputRegionForThread,
-                                                                   ThreadIdType       threadId)
-{
-  ImageRegionConstIterator<LabelImageType> itS(this->GetSourceImage(), outputRegionForThread);
-  ImageRegionConstIterator<LabelImageType> itT(this->GetTargetImage(), outputRegionForThread);
+  ImageScanlineConstIterator<LabelImageType> itS(this->GetSourceImage(), regionForThread);
+  ImageScanlineConstIterator<LabelImageType> itT(this->GetTargetImage(), regionForThread);
 
-  // Support progress methods/callbacks
-  ProgressReporter progress(this, threadId, 2 * outputRegionForThread.GetNumberOfPixels());
+  // Label images are dominated by runs of equal labels, so the entries of the
+  // previous pixel are cached and reused. The cached addresses of the mapped
+  // values stay valid when the map rehashes.
+  LabelSetMeasures * sourceMeasures = nullptr;
+  LabelSetMeasures * targetMeasures = nullptr;
+  LabelType          lastSourceLabel = LabelType();
+  LabelType          lastTargetLabel = LabelType();
 
-  for (itS.GoToBegin(), itT.GoToBegin(); !itS.IsAtEnd(); ++itS, ++itT)
+  for (itS.GoToBegin(), itT.GoToBegin(); !itS.IsAtEnd(); itS.NextLine(), itT.NextLine())
   {
-    LabelType sourceLabel = itS.Get();
-    LabelType targetLabel = itT.Get();
+    for (; !itS.IsAtEndOfLine(); ++itS, ++itT)
+    {
+      const LabelType sourceLabel = itS.Get();
+      const LabelType targetLabel = itT.Get();
 
-    // Is the label already in this thread?
-    auto mapItS = this->m_LabelSetMeasuresPerThread[threadId].find(sourceLabel);
-    auto mapItT = this->m_LabelSetMeasuresPerThread[threadId].find(targetLabel);
+      if (sourceMeasures == nullptr || lastSourceLabel != sourceLabel)
+      {
+        sourceMeasures = &localMeasures[sourceLabel];
+        lastSourceLabel = sourceLabel;
+      }
+      if (targetMeasures == nullptr || lastTargetLabel != targetLabel)
+      {
+        targetMeasures = &localMeasures[targetLabel];
+        lastTargetLabel = targetLabel;
+      }
 
-    if (mapItS == this->m_LabelSetMeasuresPerThread[threadId].end())
-    {
-      // Create a new label set measures object
-      using MapValueType = typename MapType::value_type;
-      mapItS = this->m_LabelSetMeasuresPerThread[threadId].insert(MapValueType(sourceLabel, LabelSetMeasures())).first;
-    }
+      sourceMeasures->m_Source++;
+      targetMeasures->m_Target++;
 
-    if (mapItT == this->m_LabelSetMeasuresPerThread[threadId].end())
-    {
-      // Create a new label set measures object
-      using MapValueType = typename MapType::value_type;
-      mapItT = this->m_LabelSetMeasuresPerThread[threadId].insert(MapValueType(targetLabel, LabelSetMeasures())).first;
+      if (sourceLabel == targetLabel)
+      {
+        sourceMeasures->m_Intersection++;
+        sourceMeasures->m_Union++;
+      }
+      else
+      {
+        sourceMeasures->m_Union++;
+        targetMeasures->m_Union++;
+
+        sourceMeasures->m_SourceComplement++;
+        targetMeasures->m_TargetComplement++;
+      }
     }
+  }
 
-    (*mapItS).second.m_Source++;
-    (*mapItT).second.m_Target++;
+  // Merge localMeasures and m_LabelSetMeasures concurrently safe in a
+  // local copy, this thread may do multiple merges.
+  while (true)
+  {
+    std::unique_lock<std::mutex> lock(m_Mutex);
 
-    if (sourceLabel == targetLabel)
+    if (m_LabelSetMeasures.empty())
     {
-      (*mapItS).second.m_Intersection++;
-      (*mapItS).second.m_Union++;
+      swap(m_LabelSetMeasures, localMeasures);
+      break;
     }
     else
     {
-      (*mapItS).second.m_Union++;
-      (*mapItT).second.m_Union++;
+      // Copy the output map to thread local storage
+      MapType toMerge;
+      swap(m_LabelSetMeasures, toMerge);
 
-      (*mapItS).second.m_SourceComplement++;
-      (*mapItT).second.m_TargetComplement++;
-    }
+      // Allow other threads to merge data
+      lock.unlock();
 
-    progress.CompletedPixel();
+      // Merge toMerge into localMeasures, locally
+      this->MergeMap(localMeasures, toMerge);
+    }
   }
 }
 
@@ -425,8 +413,9 @@ template <typename TLabelImage>
 void
 LabelOverlapMeasuresImageFilter<TLabelImage>::PrintSelf(std::ostream & os, Indent indent) const
 {
-  // todo!!!
   Superclass::PrintSelf(os, indent);
+
+  os << indent << "Number of labels: " << this->m_LabelSetMeasures.size() << std::endl;
 }
 
 
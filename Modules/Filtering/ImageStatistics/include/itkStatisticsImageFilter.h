@@ -21,8 +21,10 @@
 #include "itkImageSink.h"
 #include "itkNumericTraits.h"
 #include "itkArray.h"
+#include "itkHistogram.h"
 #include "itkSimpleDataObjectDecorator.h"
 #include <mutex>
+#include <vector>
 #include "itkCompensatedSummation.h"
 
 namespace itk
@@ -44,6 +46,10 @@ namespace itk
  * Internally a compensated summation algorithm is used for the
  * accumulation of intensities to improve accuracy for large images.
  *
+ * Optionally a fixed-bin histogram can be accumulated in the same
+ * pass over the image, avoiding an additional traversal with a
+ * separate histogram filter; see SetHistogramParameters.
+ *
  * \ingroup MathematicalStatisticsImageFilters
  * \ingroup ITKImageStatistics
  *
@@ -90,6 +96,10 @@ public:
   using RealObjectType = SimpleDataObjectDecorator<RealType>;
   using PixelObjectType = SimpleDataObjectDecorator<PixelType>;
 
+  /** Histogram-related type alias */
+  using HistogramType = itk::Statistics::Histogram<RealType>;
+  using HistogramPointer = typename HistogramType::Pointer;
+
   /** Return the computed Minimum. */
   itkGetDecoratedOutputMacro(Minimum, PixelType);
 
@@ -111,6 +121,26 @@ public:
   /** Return the compute Sum of Squares. */
   itkGetDecoratedOutputMacro(SumOfSquares, RealType);
 
+  // macros for Histogram enables
+  itkSetMacro(UseHistogram, bool);
+  itkGetConstMacro(UseHistogram, bool);
+  itkBooleanMacro(UseHistogram);
+
+  /** Specify histogram parameters and enable the histogram
+   * accumulation. The histogram has \c numBins bins of equal width
+   * covering [\c lowerBound, \c upperBound]; pixel values outside of
+   * the bounds are not counted. */
+  void
+  SetHistogramParameters(const unsigned int numBins, RealType lowerBound, RealType upperBound);
+
+  /** Return the histogram accumulated during the last update, or
+   * nullptr when the histogram is not enabled. */
+  HistogramPointer
+  GetHistogram() const
+  {
+    return m_Histogram;
+  }
+
   // Change the access from protected to public to expose streaming option, a using statement can not be used due to
   // limitations of wrapping.
   void
@@ -164,13 +194,33 @@ protected:
   itkSetDecoratedOutputMacro(SumOfSquares, RealType);
 
 private:
+  /** Partial sums of one work unit region, recorded when the global
+   * deterministic-reductions mode of MultiThreaderBase is enabled and
+   * combined in region order in AfterStreamedGenerateData(). */
+  struct RegionPartialSum
+  {
+    IndexType StartIndex;
+    RealType  Sum;
+    RealType  SumOfSquares;
+  };
+
   CompensatedSummation<RealType> m_ThreadSum{ 1 };
   CompensatedSummation<RealType> m_SumOfSquares{ 1 };
 
+  std::vector<RegionPartialSum> m_RegionPartialSums;
+
   SizeValueType m_Count{ 1 };
   PixelType     m_ThreadMin{ 1 };
   PixelType     m_ThreadMax{ 1 };
 
+  bool             m_UseHistogram{ false };
+  unsigned int     m_NumBins{ 256 };
+  RealType         m_LowerBound;
+  RealType         m_UpperBound;
+  HistogramPointer m_Histogram;
+
+  std::vector<SizeValueType> m_HistogramCounts;
+
   std::mutex m_Mutex;
 }; // end of class
 } // end namespace itk
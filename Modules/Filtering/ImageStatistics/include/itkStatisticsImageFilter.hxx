@@ -21,6 +21,8 @@
 
 
 #include "itkImageScanlineIterator.h"
+#include "itkMultiThreaderBase.h"
+#include <algorithm>
 #include <mutex>
 
 namespace itk
@@ -37,6 +39,22 @@ StatisticsImageFilter<TInputImage>::StatisticsImageFilter()
   Self::SetVariance(NumericTraits<RealType>::max());
   Self::SetSum(NumericTraits<RealType>::ZeroValue());
   Self::SetSumOfSquares(NumericTraits<RealType>::ZeroValue());
+
+  m_LowerBound = static_cast<RealType>(NumericTraits<PixelType>::NonpositiveMin());
+  m_UpperBound = static_cast<RealType>(NumericTraits<PixelType>::max());
+}
+
+template <typename TInputImage>
+void
+StatisticsImageFilter<TInputImage>::SetHistogramParameters(const unsigned int numBins,
+                                                           RealType           lowerBound,
+                                                           RealType           upperBound)
+{
+  m_NumBins = numBins;
+  m_LowerBound = lowerBound;
+  m_UpperBound = upperBound;
+  m_UseHistogram = true;
+  this->Modified();
 }
 
 template <typename TInputImage>
@@ -66,6 +84,13 @@ StatisticsImageFilter<TInputImage>::BeforeStreamedGenerateData()
   m_ThreadSum = NumericTraits<RealType>::ZeroValue();
   m_ThreadMin = NumericTraits<PixelType>::max();
   m_ThreadMax = NumericTraits<PixelType>::NonpositiveMin();
+  m_RegionPartialSums.clear();
+
+  m_Histogram = nullptr;
+  if (m_UseHistogram)
+  {
+    m_HistogramCounts.assign(m_NumBins, 0);
+  }
 }
 
 template <typename TInputImage>
@@ -74,6 +99,32 @@ StatisticsImageFilter<TInputImage>::AfterStreamedGenerateData()
 {
   Superclass::AfterStreamedGenerateData();
 
+  if (!m_RegionPartialSums.empty())
+  {
+    // Combine the per-region partial sums in region order; with the fixed
+    // work unit count of the deterministic-reductions mode this makes the
+    // sums bit-identical across runs and thread counts
+    std::sort(m_RegionPartialSums.begin(),
+              m_RegionPartialSums.end(),
+              [](const RegionPartialSum & a, const RegionPartialSum & b) {
+                for (unsigned int d = ImageDimension; d > 0; --d)
+                {
+                  const unsigned int dim = d - 1;
+                  if (a.StartIndex[dim] != b.StartIndex[dim])
+                  {
+                    return a.StartIndex[dim] < b.StartIndex[dim];
+                  }
+                }
+                return false;
+              });
+    for (const RegionPartialSum & partial : m_RegionPartialSums)
+    {
+      m_ThreadSum += partial.Sum;
+      m_SumOfSquares += partial.SumOfSquares;
+    }
+    m_RegionPartialSums.clear();
+  }
+
   const SizeValueType count = m_Count;
   const RealType      sumOfSquares(m_SumOfSquares);
   const PixelType     minimum = m_ThreadMin;
@@ -93,6 +144,32 @@ StatisticsImageFilter<TInputImage>::AfterStreamedGenerateData()
   this->SetVariance(variance);
   this->SetSum(sum);
   this->SetSumOfSquares(sumOfSquares);
+
+  if (m_UseHistogram)
+  {
+    m_Histogram = HistogramType::New();
+    typename HistogramType::SizeType              hsize;
+    typename HistogramType::MeasurementVectorType lb;
+    typename HistogramType::MeasurementVectorType ub;
+    hsize.SetSize(1);
+    lb.SetSize(1);
+    ub.SetSize(1);
+    m_Histogram->SetMeasurementVectorSize(1);
+    hsize[0] = m_NumBins;
+    lb[0] = m_LowerBound;
+    ub[0] = m_UpperBound;
+    m_Histogram->Initialize(hsize, lb, ub);
+
+    typename HistogramType::IndexType index(1);
+    for (unsigned int bin = 0; bin < m_NumBins; ++bin)
+    {
+      index[0] = bin;
+      m_Histogram->SetFrequencyOfIndex(index,
+                                       static_cast<typename HistogramType::AbsoluteFrequencyType>(
+                                         m_HistogramCounts[bin]));
+    }
+    m_HistogramCounts.clear();
+  }
 }
 
 template <typename TInputImage>
@@ -106,6 +183,19 @@ StatisticsImageFilter<TInputImage>::ThreadedStreamedGenerateData(const RegionTyp
   PixelType                      min = NumericTraits<PixelType>::max();
   PixelType                      max = NumericTraits<PixelType>::NonpositiveMin();
 
+  // Per-thread histogram partial, merged under the mutex below.
+  const bool                 useHistogram = m_UseHistogram;
+  const RealType             lowerBound = m_LowerBound;
+  const RealType             upperBound = m_UpperBound;
+  const SizeValueType        numBins = m_NumBins;
+  const RealType             binScale =
+    useHistogram ? static_cast<RealType>(numBins) / (upperBound - lowerBound) : NumericTraits<RealType>::ZeroValue();
+  std::vector<SizeValueType> histogramCounts;
+  if (useHistogram)
+  {
+    histogramCounts.assign(numBins, 0);
+  }
+
   ImageScanlineConstIterator<TInputImage> it(this->GetInput(), regionForThread);
 
   // do the work
@@ -121,17 +211,41 @@ StatisticsImageFilter<TInputImage>::ThreadedStreamedGenerateData(const RegionTyp
       sum += realValue;
       sumOfSquares += (realValue * realValue);
       ++count;
+
+      if (useHistogram && realValue >= lowerBound && realValue <= upperBound)
+      {
+        auto bin = static_cast<SizeValueType>((realValue - lowerBound) * binScale);
+        bin = std::min(bin, numBins - 1);
+        ++histogramCounts[bin];
+      }
       ++it;
     }
     it.NextLine();
   }
 
   std::lock_guard<std::mutex> mutexHolder(m_Mutex);
-  m_ThreadSum += sum;
-  m_SumOfSquares += sumOfSquares;
+  if (MultiThreaderBase::GetGlobalDeterministicReductions())
+  {
+    // Keep the region partials apart: they are combined in region order in
+    // AfterStreamedGenerateData(), independently of the completion order
+    m_RegionPartialSums.push_back(
+      RegionPartialSum{ regionForThread.GetIndex(), sum.GetSum(), sumOfSquares.GetSum() });
+  }
+  else
+  {
+    m_ThreadSum += sum;
+    m_SumOfSquares += sumOfSquares;
+  }
   m_Count += count;
   m_ThreadMin = std::min(min, m_ThreadMin);
   m_ThreadMax = std::max(max, m_ThreadMax);
+  if (useHistogram)
+  {
+    for (SizeValueType bin = 0; bin < numBins; ++bin)
+    {
+      m_HistogramCounts[bin] += histogramCounts[bin];
+    }
+  }
 }
 
 template <typename TImage>
@@ -151,6 +265,10 @@ StatisticsImageFilter<TImage>::PrintSelf(std::ostream & os, Indent indent) const
   os << indent << "Sigma: " << this->GetSigma() << std::endl;
   os << indent << "Variance: " << this->GetVariance() << std::endl;
   os << indent << "SumOfSquares: " << this->GetSumOfSquares() << std::endl;
+  os << indent << "UseHistogram: " << this->m_UseHistogram << std::endl;
+  os << indent << "NumBins: " << this->m_NumBins << std::endl;
+  os << indent << "LowerBound: " << this->m_LowerBound << std::endl;
+  os << indent << "UpperBound: " << this->m_UpperBound << std::endl;
 }
 } // end namespace itk
 #endif
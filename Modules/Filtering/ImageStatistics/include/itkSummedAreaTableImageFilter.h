@@ -0,0 +1,158 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkSummedAreaTableImageFilter_h
+#define itkSummedAreaTableImageFilter_h
+
+#include "itkImageToImageFilter.h"
+#include "itkImage.h"
+#include "itkImageLinearIteratorWithIndex.h"
+#include "itkMultiThreaderBase.h"
+#include "itkNumericTraits.h"
+
+namespace itk
+{
+
+/** Replace the pixels of \c region with their inclusive N-D prefix sums.
+ *
+ * The prefix sums are computed separably, one dimension at a time; the lines
+ * running along the current dimension are distributed over the work units of
+ * the given multi threader. After the call, each pixel holds the sum of all
+ * pixels with indices less than or equal to its own in every dimension,
+ * relative to the corner of \c region. The pixel type only needs to support
+ * \c operator+=, so joint tables (e.g. a Vector of sums and sums of squares)
+ * can be accumulated in a single sweep.
+ */
+template <typename TImage>
+void
+SummedAreaTableInPlaceAccumulateFunction(TImage *                            image,
+                                         const typename TImage::RegionType & region,
+                                         MultiThreaderBase *                 threader)
+{
+  using RegionType = typename TImage::RegionType;
+  using PixelType = typename TImage::PixelType;
+
+  for (unsigned int d = 0; d < TImage::ImageDimension; ++d)
+  {
+    // Collapse the current dimension so the region splitter only partitions
+    // the others; each line along the current dimension then stays within a
+    // single work unit.
+    RegionType lineHeads = region;
+    lineHeads.SetSize(d, 1);
+    threader->template ParallelizeImageRegion<TImage::ImageDimension>(
+      lineHeads,
+      [image, region, d](const RegionType & chunk) {
+        RegionType lineRegion = chunk;
+        lineRegion.SetSize(d, region.GetSize(d));
+        lineRegion.SetIndex(d, region.GetIndex(d));
+
+        ImageLinearIteratorWithIndex<TImage> it(image, lineRegion);
+        it.SetDirection(d);
+        for (it.GoToBegin(); !it.IsAtEnd(); it.NextLine())
+        {
+          PixelType runningSum = NumericTraits<PixelType>::ZeroValue();
+          while (!it.IsAtEndOfLine())
+          {
+            runningSum += it.Get();
+            it.Set(runningSum);
+            ++it;
+          }
+        }
+      },
+      nullptr);
+  }
+}
+
+/**
+ * \class SummedAreaTableImageFilter
+ * \brief Computes the summed area table (integral image) of the input.
+ *
+ * Each output pixel holds the sum of all input pixels with indices less than
+ * or equal to its own in every dimension, relative to the corner of the
+ * requested region. Any box sum can then be evaluated in 2^N table lookups
+ * regardless of the box size, which is the building block of the fast
+ * rectangular filters (BoxMeanImageFilter, BoxSigmaImageFilter) and of
+ * windowed correlation measures.
+ *
+ * The accumulation is carried out in the output pixel type, which defaults
+ * to the RealType of the input pixel. For integer inputs whose total sum
+ * exceeds the mantissa of that type, an image of a wide integer type can be
+ * used as the second template argument to keep the table exact.
+ *
+ * The table is computed separably with one multithreaded prefix-sum sweep
+ * per dimension, so it supports any image dimension.
+ *
+ * \sa BoxMeanImageFilter
+ * \sa BoxSigmaImageFilter
+ * \ingroup ITKImageStatistics
+ */
+template <typename TInputImage,
+          typename TOutputImage =
+            Image<typename NumericTraits<typename TInputImage::PixelType>::RealType, TInputImage::ImageDimension>>
+class ITK_TEMPLATE_EXPORT SummedAreaTableImageFilter : public ImageToImageFilter<TInputImage, TOutputImage>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(SummedAreaTableImageFilter);
+
+  /** Standard class type aliases. */
+  using Self = SummedAreaTableImageFilter;
+  using Superclass = ImageToImageFilter<TInputImage, TOutputImage>;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Standard New method. */
+  itkNewMacro(Self);
+
+  /** Runtime information support. */
+  itkTypeMacro(SummedAreaTableImageFilter, ImageToImageFilter);
+
+  /** Image related type alias. */
+  using InputImageType = TInputImage;
+  using OutputImageType = TOutputImage;
+  using RegionType = typename TOutputImage::RegionType;
+  using PixelType = typename TInputImage::PixelType;
+  using OutputPixelType = typename TOutputImage::PixelType;
+  using typename Superclass::OutputImageRegionType;
+
+  /** Image related type alias. */
+  static constexpr unsigned int OutputImageDimension = TOutputImage::ImageDimension;
+  static constexpr unsigned int InputImageDimension = TInputImage::ImageDimension;
+
+#ifdef ITK_USE_CONCEPT_CHECKING
+  // Begin concept checking
+  itkConceptMacro(SameDimension, (Concept::SameDimension<Self::InputImageDimension, Self::OutputImageDimension>));
+  itkConceptMacro(InputConvertibleToOutput, (Concept::Convertible<PixelType, OutputPixelType>));
+  // End concept checking
+#endif
+
+protected:
+  SummedAreaTableImageFilter() = default;
+  ~SummedAreaTableImageFilter() override = default;
+
+  /** Casts the input into the accumulation type and runs the per-dimension
+   * prefix-sum sweeps, each of them multithreaded. */
+  void
+  GenerateData() override;
+
+}; // end of class
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkSummedAreaTableImageFilter.hxx"
+#endif
+
+#endif
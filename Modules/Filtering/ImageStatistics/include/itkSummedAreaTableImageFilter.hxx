@@ -0,0 +1,61 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkSummedAreaTableImageFilter_hxx
+#define itkSummedAreaTableImageFilter_hxx
+
+#include "itkSummedAreaTableImageFilter.h"
+#include "itkImageScanlineIterator.h"
+
+namespace itk
+{
+
+template <typename TInputImage, typename TOutputImage>
+void
+SummedAreaTableImageFilter<TInputImage, TOutputImage>::GenerateData()
+{
+  this->AllocateOutputs();
+
+  const InputImageType * inputImage = this->GetInput();
+  OutputImageType *      outputImage = this->GetOutput();
+  const RegionType       outputRegion = outputImage->GetRequestedRegion();
+
+  // Cast the input into the accumulation type
+  this->GetMultiThreader()->template ParallelizeImageRegion<OutputImageDimension>(
+    outputRegion,
+    [inputImage, outputImage](const RegionType & region) {
+      ImageScanlineConstIterator<InputImageType> inIt(inputImage, region);
+      ImageScanlineIterator<OutputImageType>     outIt(outputImage, region);
+      while (!outIt.IsAtEnd())
+      {
+        while (!outIt.IsAtEndOfLine())
+        {
+          outIt.Set(static_cast<OutputPixelType>(inIt.Get()));
+          ++inIt;
+          ++outIt;
+        }
+        inIt.NextLine();
+        outIt.NextLine();
+      }
+    },
+    nullptr);
+
+  SummedAreaTableInPlaceAccumulateFunction(outputImage, outputRegion, this->GetMultiThreader());
+}
+
+} // end namespace itk
+#endif
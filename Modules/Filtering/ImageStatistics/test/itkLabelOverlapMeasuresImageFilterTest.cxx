@@ -82,6 +82,28 @@ LabelOverlapMeasures(int, char * argv[])
   }
 
 
+  // Check that a streamed execution produces the same measures
+  //
+  auto streamedFilter = FilterType::New();
+  streamedFilter->SetSourceImage(reader1->GetOutput());
+  streamedFilter->SetTargetImage(reader2->GetOutput());
+  streamedFilter->SetNumberOfStreamDivisions(4);
+  ITK_TEST_SET_GET_VALUE(4, streamedFilter->GetNumberOfStreamDivisions());
+  streamedFilter->Update();
+
+  if (itk::Math::NotExactlyEquals(streamedFilter->GetTotalOverlap(), filter->GetTotalOverlap()) ||
+      itk::Math::NotExactlyEquals(streamedFilter->GetUnionOverlap(), filter->GetUnionOverlap()) ||
+      itk::Math::NotExactlyEquals(streamedFilter->GetMeanOverlap(), filter->GetMeanOverlap()) ||
+      itk::Math::NotExactlyEquals(streamedFilter->GetVolumeSimilarity(), filter->GetVolumeSimilarity()) ||
+      itk::Math::NotExactlyEquals(streamedFilter->GetFalseNegativeError(), filter->GetFalseNegativeError()) ||
+      itk::Math::NotExactlyEquals(streamedFilter->GetFalsePositiveError(), filter->GetFalsePositiveError()))
+  {
+    std::cout << "Error: streamed execution produced different overlap measures" << std::endl;
+    std::cout << "Test failed" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+
   // Check results when a non-existing label's metrics are queried
   //
 
@@ -160,8 +182,7 @@ itkLabelOverlapMeasuresImageFilterTest(int argc, char * argv[])
   // Exercise basic object methods
   // Done outside the helper function in the test because GCC is limited
   // when calling overloaded base class functions.
-  ITK_EXERCISE_BASIC_OBJECT_METHODS(
-    labelOverlapMeasuresImageFilter, LabelOverlapMeasuresImageFilter, ImageToImageFilter);
+  ITK_EXERCISE_BASIC_OBJECT_METHODS(labelOverlapMeasuresImageFilter, LabelOverlapMeasuresImageFilter, ImageSink);
 
 
   switch (std::stoi(argv[1]))
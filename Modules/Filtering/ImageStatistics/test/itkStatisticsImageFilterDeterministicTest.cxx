@@ -0,0 +1,113 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkStatisticsImageFilter.h"
+#include "itkMultiThreaderBase.h"
+
+#include <cmath>
+#include <iostream>
+#include <random>
+
+int
+itkStatisticsImageFilterDeterministicTest(int, char *[])
+{
+  using ImageType = itk::Image<float, 2>;
+  using FilterType = itk::StatisticsImageFilter<ImageType>;
+
+  // Pixel values of strongly varying magnitude expose any change in the
+  // floating point accumulation order
+  auto image = ImageType::New();
+  ImageType::RegionType region;
+  region.SetSize(0, 253);
+  region.SetSize(1, 211);
+  image->SetRegions(region);
+  image->Allocate();
+
+  std::mt19937                          generator(42);
+  std::uniform_real_distribution<float> magnitude(-8.0f, 8.0f);
+  for (itk::ImageRegionIterator<ImageType> it(image, region); !it.IsAtEnd(); ++it)
+  {
+    it.Set(std::ldexp(1.0f + 1e-3f * static_cast<float>(generator() % 997), static_cast<int>(magnitude(generator))));
+  }
+
+  if (itk::MultiThreaderBase::GetGlobalDeterministicReductions())
+  {
+    std::cerr << "Deterministic reductions expected to be disabled by default" << std::endl;
+    return EXIT_FAILURE;
+  }
+  itk::MultiThreaderBase::SetGlobalDeterministicReductions(true);
+  if (!itk::MultiThreaderBase::GetGlobalDeterministicReductions())
+  {
+    std::cerr << "SetGlobalDeterministicReductions(true) did not stick" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Multi-threaders created in this mode use a fixed work unit count
+  itk::MultiThreaderBase::Pointer threader = itk::MultiThreaderBase::New();
+  const itk::ThreadIdType         expectedWorkUnits =
+    std::min<itk::ThreadIdType>(itk::MultiThreaderBase::DeterministicNumberOfWorkUnits,
+                                itk::MultiThreaderBase::GetGlobalMaximumNumberOfThreads());
+  if (threader->GetNumberOfWorkUnits() != expectedWorkUnits)
+  {
+    std::cerr << "Expected " << expectedWorkUnits << " work units in deterministic mode, got "
+              << threader->GetNumberOfWorkUnits() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The statistics must be bit-identical across runs with different thread
+  // counts
+  double          referenceSum = 0.0;
+  double          referenceVariance = 0.0;
+  constexpr int   runs = 4;
+  const unsigned  threadCounts[runs] = { 1, 2, 3, 8 };
+  for (int run = 0; run < runs; ++run)
+  {
+    auto filter = FilterType::New();
+    filter->GetMultiThreader()->SetMaximumNumberOfThreads(threadCounts[run]);
+    filter->SetInput(image);
+    filter->Update();
+
+    if (run == 0)
+    {
+      referenceSum = filter->GetSum();
+      referenceVariance = filter->GetVariance();
+    }
+    else if (filter->GetSum() != referenceSum || filter->GetVariance() != referenceVariance)
+    {
+      std::cerr.precision(17);
+      std::cerr << "Run with " << threadCounts[run] << " threads differs: sum " << filter->GetSum() << " vs "
+                << referenceSum << ", variance " << filter->GetVariance() << " vs " << referenceVariance << std::endl;
+      itk::MultiThreaderBase::SetGlobalDeterministicReductions(false);
+      return EXIT_FAILURE;
+    }
+
+    // Repeated execution of the same filter must reproduce the result too
+    filter->Modified();
+    filter->Update();
+    if (filter->GetSum() != referenceSum)
+    {
+      std::cerr << "Repeated execution changed the sum" << std::endl;
+      itk::MultiThreaderBase::SetGlobalDeterministicReductions(false);
+      return EXIT_FAILURE;
+    }
+  }
+
+  itk::MultiThreaderBase::SetGlobalDeterministicReductions(false);
+
+  return EXIT_SUCCESS;
+}
@@ -179,5 +179,34 @@ itkStatisticsImageFilterTest(int argc, char * argv[])
     return EXIT_FAILURE;
   }
   std::cout << "Expected variance is " << knownVariance << ", computed variance is " << testVariance << std::endl;
+
+  // Exercise the optional histogram, accumulated during the same pass.
+  using IntFilterType = itk::StatisticsImageFilter<FloatImage>;
+  auto histogramFilter = IntFilterType::New();
+  histogramFilter->SetInput(image);
+  histogramFilter->SetNumberOfStreamDivisions(numberOfStreamDivisions);
+  histogramFilter->SetHistogramParameters(16, -200.0, 200.0);
+  ITK_TEST_EXPECT_TRUE(histogramFilter->GetUseHistogram());
+  ITK_TRY_EXPECT_NO_EXCEPTION(histogramFilter->Update());
+
+  IntFilterType::HistogramPointer histogram = histogramFilter->GetHistogram();
+  if (histogram.IsNull())
+  {
+    std::cerr << "GetHistogram failed! Expected a non-null histogram" << std::endl;
+    status++;
+  }
+  else
+  {
+    // The constant image holds a single value, so a single bin gets
+    // all of the pixels.
+    ITK_TEST_EXPECT_EQUAL(histogram->GetTotalFrequency(), region.GetNumberOfPixels());
+
+    IntFilterType::HistogramType::MeasurementVectorType measurement(1);
+    measurement[0] = fillValue;
+    IntFilterType::HistogramType::IndexType histogramIndex(1);
+    ITK_TEST_EXPECT_TRUE(histogram->GetIndex(measurement, histogramIndex));
+    ITK_TEST_EXPECT_EQUAL(histogram->GetFrequency(histogramIndex), region.GetNumberOfPixels());
+  }
+
   return status;
 }
@@ -0,0 +1,165 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkSummedAreaTableImageFilter.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkTestingMacros.h"
+
+namespace
+{
+
+// Brute-force sum of all input pixels with indices <= idx in every dimension
+template <typename TImage>
+double
+BruteForceCornerSum(const TImage * image, const typename TImage::IndexType & idx)
+{
+  double                                           sum = 0.0;
+  itk::ImageRegionConstIteratorWithIndex<TImage> it(image, image->GetBufferedRegion());
+  for (it.GoToBegin(); !it.IsAtEnd(); ++it)
+  {
+    bool inside = true;
+    for (unsigned int d = 0; d < TImage::ImageDimension; ++d)
+    {
+      if (it.GetIndex()[d] > idx[d])
+      {
+        inside = false;
+        break;
+      }
+    }
+    if (inside)
+    {
+      sum += static_cast<double>(it.Get());
+    }
+  }
+  return sum;
+}
+
+template <unsigned int VDimension>
+int
+RunDimensionTest(const itk::Size<VDimension> & size)
+{
+  using InputImageType = itk::Image<unsigned char, VDimension>;
+  using FilterType = itk::SummedAreaTableImageFilter<InputImageType>;
+  using OutputImageType = typename FilterType::OutputImageType;
+
+  auto image = InputImageType::New();
+  image->SetRegions(size);
+  image->Allocate();
+
+  // Deterministic, index-dependent values
+  unsigned int counter = 0;
+  itk::ImageRegionIteratorWithIndex<InputImageType> it(image, image->GetBufferedRegion());
+  for (it.GoToBegin(); !it.IsAtEnd(); ++it)
+  {
+    it.Set(static_cast<unsigned char>((counter * 31 + 7) % 251));
+    ++counter;
+  }
+
+  auto filter = FilterType::New();
+  filter->SetInput(image);
+  ITK_TRY_EXPECT_NO_EXCEPTION(filter->Update());
+
+  const OutputImageType * table = filter->GetOutput();
+
+  // Integer sums of this magnitude are exact in the double accumulator, so
+  // every table entry must match the brute-force corner sum exactly
+  itk::ImageRegionConstIteratorWithIndex<OutputImageType> tableIt(table, table->GetBufferedRegion());
+  for (tableIt.GoToBegin(); !tableIt.IsAtEnd(); ++tableIt)
+  {
+    const double expected = BruteForceCornerSum(image.GetPointer(), tableIt.GetIndex());
+    if (tableIt.Get() != expected)
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "Wrong table entry at index " << tableIt.GetIndex() << std::endl;
+      std::cerr << "Expected: " << expected << ", but got: " << tableIt.Get() << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
+
+} // namespace
+
+int
+itkSummedAreaTableImageFilterTest(int, char *[])
+{
+  using InputImageType = itk::Image<unsigned char, 2>;
+  using FilterType = itk::SummedAreaTableImageFilter<InputImageType>;
+
+  auto filter = FilterType::New();
+
+  ITK_EXERCISE_BASIC_OBJECT_METHODS(filter, SummedAreaTableImageFilter, ImageToImageFilter);
+
+  itk::Size<2> size2;
+  size2[0] = 17;
+  size2[1] = 11;
+  if (RunDimensionTest<2>(size2) != EXIT_SUCCESS)
+  {
+    return EXIT_FAILURE;
+  }
+
+  itk::Size<3> size3;
+  size3[0] = 7;
+  size3[1] = 5;
+  size3[2] = 4;
+  if (RunDimensionTest<3>(size3) != EXIT_SUCCESS)
+  {
+    return EXIT_FAILURE;
+  }
+
+  // The in-place accumulation also has to work for non-scalar pixels, which
+  // the box sigma filter relies on for its joint sum / sum-of-squares table
+  using VectorPixelType = itk::Vector<double, 2>;
+  using VectorImageType = itk::Image<VectorPixelType, 2>;
+
+  auto vectorImage = VectorImageType::New();
+  vectorImage->SetRegions(size2);
+  vectorImage->Allocate();
+
+  itk::ImageRegionIteratorWithIndex<VectorImageType> vectorIt(vectorImage, vectorImage->GetBufferedRegion());
+  for (vectorIt.GoToBegin(); !vectorIt.IsAtEnd(); ++vectorIt)
+  {
+    VectorPixelType pixel;
+    pixel[0] = static_cast<double>(vectorIt.GetIndex()[0] + 1);
+    pixel[1] = static_cast<double>(vectorIt.GetIndex()[1] + 2);
+    vectorIt.Set(pixel);
+  }
+
+  itk::SummedAreaTableInPlaceAccumulateFunction(
+    vectorImage.GetPointer(), vectorImage->GetBufferedRegion(), itk::MultiThreaderBase::New());
+
+  // Closed-form check of the last corner: sums of 1..n are exact in double
+  const double        nx = static_cast<double>(size2[0]);
+  const double        ny = static_cast<double>(size2[1]);
+  itk::Index<2>       lastIndex = { { static_cast<itk::IndexValueType>(size2[0]) - 1,
+                                      static_cast<itk::IndexValueType>(size2[1]) - 1 } };
+  const VectorPixelType lastPixel = vectorImage->GetPixel(lastIndex);
+  const double          expected0 = ny * nx * (nx + 1.0) / 2.0;
+  const double          expected1 = nx * ny * (ny + 3.0) / 2.0;
+  if (lastPixel[0] != expected0 || lastPixel[1] != expected1)
+  {
+    std::cerr << "Test failed!" << std::endl;
+    std::cerr << "Wrong vector table corner " << lastPixel << ", expected [" << expected0 << ", " << expected1 << "]"
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
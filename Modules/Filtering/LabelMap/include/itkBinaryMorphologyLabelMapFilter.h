@@ -0,0 +1,162 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkBinaryMorphologyLabelMapFilter_h
+#define itkBinaryMorphologyLabelMapFilter_h
+
+#include "itkInPlaceLabelMapFilter.h"
+
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace itk
+{
+/**
+ *\class BinaryMorphologyLabelMapFilter
+ * \brief Erode or dilate the objects of a label map by a box, directly
+ * on their run-length representation.
+ *
+ * Each object of the label map is treated as a binary mask given by its
+ * lines and is eroded or dilated by a box structuring element of the
+ * given radius. The structuring element is decomposed into one pass per
+ * dimension: along the line dimension the runs are lengthened or
+ * shortened in place, and along every other dimension the run lists of
+ * the neighboring rows are united or intersected. The run time is
+ * therefore proportional to the number of runs, not to the number of
+ * pixels, which makes this filter well suited to sparse masks where the
+ * foreground covers only a small fraction of the image.
+ *
+ * The region outside the largest possible region of the label map is
+ * treated as background: a dilation is cropped to that region, and an
+ * erosion removes the border pixels of objects touching it, like
+ * BinaryErodeImageFilter with BoundaryToForeground turned off. Objects
+ * completely removed by an erosion are discarded from the label map.
+ * Note that each object is processed independently, so a dilation can
+ * produce objects with overlapping lines; as usual, the conversion of
+ * such a label map to a label image resolves the overlaps in the order
+ * of the objects in the map.
+ *
+ * \sa BinaryDilateImageFilter, BinaryErodeImageFilter
+ * \sa BinaryImageToLabelMapFilter, MergeLabelMapFilter
+ * \ingroup ImageEnhancement  MathematicalMorphologyImageFilters
+ * \ingroup ITKLabelMap
+ */
+template <typename TImage>
+class ITK_TEMPLATE_EXPORT BinaryMorphologyLabelMapFilter : public InPlaceLabelMapFilter<TImage>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(BinaryMorphologyLabelMapFilter);
+
+  /** Standard class type aliases. */
+  using Self = BinaryMorphologyLabelMapFilter;
+  using Superclass = InPlaceLabelMapFilter<TImage>;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Some convenient type alias. */
+  using ImageType = TImage;
+  using ImagePointer = typename ImageType::Pointer;
+  using ImageConstPointer = typename ImageType::ConstPointer;
+  using PixelType = typename ImageType::PixelType;
+  using IndexType = typename ImageType::IndexType;
+  using SizeType = typename ImageType::SizeType;
+  using RegionType = typename ImageType::RegionType;
+  using LabelObjectType = typename ImageType::LabelObjectType;
+  using LengthType = typename LabelObjectType::LengthType;
+
+  /** ImageDimension constants */
+  static constexpr unsigned int ImageDimension = TImage::ImageDimension;
+
+  /** Standard New method. */
+  itkNewMacro(Self);
+
+  /** Runtime information support. */
+  itkTypeMacro(BinaryMorphologyLabelMapFilter, InPlaceLabelMapFilter);
+
+  /** Set/Get the radius of the box structuring element. */
+  itkSetMacro(Radius, SizeType);
+  itkGetConstReferenceMacro(Radius, SizeType);
+
+  /** Set the radius of the box to the same value in all dimensions. */
+  void
+  SetRadius(SizeValueType radius)
+  {
+    SizeType s;
+    s.Fill(radius);
+    this->SetRadius(s);
+  }
+
+  /** Set/Get whether the objects are dilated (the default) or eroded. */
+  itkSetMacro(PerformDilation, bool);
+  itkGetConstReferenceMacro(PerformDilation, bool);
+  itkBooleanMacro(PerformDilation);
+
+protected:
+  BinaryMorphologyLabelMapFilter();
+  ~BinaryMorphologyLabelMapFilter() override = default;
+
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+  void
+  GenerateData() override;
+
+private:
+  /** A run along the line dimension, stored as the first and the last
+   * coordinate covered, both included. */
+  using IntervalType = std::pair<OffsetValueType, OffsetValueType>;
+  using IntervalListType = std::vector<IntervalType>;
+
+  /** Order the rows by their coordinates in the non-line dimensions;
+   * the line coordinate of the keys is always zero. */
+  struct RowComparator
+  {
+    bool
+    operator()(const IndexType & lhs, const IndexType & rhs) const
+    {
+      for (unsigned int d = ImageDimension - 1; d > 0; --d)
+      {
+        if (lhs[d] != rhs[d])
+        {
+          return lhs[d] < rhs[d];
+        }
+      }
+      return false;
+    }
+  };
+
+  using RowMapType = std::map<IndexType, IntervalListType, RowComparator>;
+
+  /** Sort the intervals and merge the ones which overlap or touch. */
+  static void
+  MergeIntervals(IntervalListType & intervals);
+
+  /** Intersect two sorted, disjoint interval lists. */
+  static IntervalListType
+  IntersectIntervals(const IntervalListType & intervalsA, const IntervalListType & intervalsB);
+
+  SizeType m_Radius;
+  bool     m_PerformDilation{ true };
+}; // end of class
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkBinaryMorphologyLabelMapFilter.hxx"
+#endif
+
+#endif
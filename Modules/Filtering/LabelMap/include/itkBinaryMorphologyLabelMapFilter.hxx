@@ -0,0 +1,308 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkBinaryMorphologyLabelMapFilter_hxx
+#define itkBinaryMorphologyLabelMapFilter_hxx
+
+#include "itkBinaryMorphologyLabelMapFilter.h"
+#include "itkProgressReporter.h"
+
+#include <algorithm>
+
+namespace itk
+{
+template <typename TImage>
+BinaryMorphologyLabelMapFilter<TImage>::BinaryMorphologyLabelMapFilter()
+{
+  m_Radius.Fill(1);
+}
+
+template <typename TImage>
+void
+BinaryMorphologyLabelMapFilter<TImage>::MergeIntervals(IntervalListType & intervals)
+{
+  if (intervals.empty())
+  {
+    return;
+  }
+  std::sort(intervals.begin(), intervals.end());
+  IntervalListType merged;
+  merged.push_back(intervals.front());
+  for (size_t i = 1; i < intervals.size(); ++i)
+  {
+    if (intervals[i].first <= merged.back().second + 1)
+    {
+      merged.back().second = std::max(merged.back().second, intervals[i].second);
+    }
+    else
+    {
+      merged.push_back(intervals[i]);
+    }
+  }
+  intervals.swap(merged);
+}
+
+template <typename TImage>
+auto
+BinaryMorphologyLabelMapFilter<TImage>::IntersectIntervals(const IntervalListType & intervalsA,
+                                                           const IntervalListType & intervalsB) -> IntervalListType
+{
+  IntervalListType result;
+  size_t           a = 0;
+  size_t           b = 0;
+  while (a < intervalsA.size() && b < intervalsB.size())
+  {
+    const OffsetValueType first = std::max(intervalsA[a].first, intervalsB[b].first);
+    const OffsetValueType last = std::min(intervalsA[a].second, intervalsB[b].second);
+    if (first <= last)
+    {
+      result.emplace_back(first, last);
+    }
+    if (intervalsA[a].second < intervalsB[b].second)
+    {
+      ++a;
+    }
+    else
+    {
+      ++b;
+    }
+  }
+  return result;
+}
+
+template <typename TImage>
+void
+BinaryMorphologyLabelMapFilter<TImage>::GenerateData()
+{
+  // Allocate the output
+  this->AllocateOutputs();
+
+  ImageType * output = this->GetOutput();
+
+  const RegionType region = output->GetLargestPossibleRegion();
+  const IndexType  regionIndex = region.GetIndex();
+  const SizeType   regionSize = region.GetSize();
+
+  ProgressReporter progress(this, 0, output->GetNumberOfLabelObjects());
+
+  std::vector<LabelObjectType *> emptyObjects;
+
+  typename ImageType::Iterator loIt(output);
+  while (!loIt.IsAtEnd())
+  {
+    LabelObjectType * labelObject = loIt.GetLabelObject();
+
+    // Gather the lines of the object into one sorted, disjoint interval
+    // list per row of the non-line dimensions.
+    RowMapType rows;
+    typename LabelObjectType::ConstLineIterator lit(labelObject);
+    while (!lit.IsAtEnd())
+    {
+      const typename LabelObjectType::LineType & line = lit.GetLine();
+      IndexType                                  key = line.GetIndex();
+      const OffsetValueType                      first = key[0];
+      key[0] = 0;
+      rows[key].emplace_back(first, first + static_cast<OffsetValueType>(line.GetLength()) - 1);
+      ++lit;
+    }
+    for (auto & row : rows)
+    {
+      this->MergeIntervals(row.second);
+    }
+
+    // Pass along the line dimension: lengthen or shorten the runs in
+    // place.
+    const auto lineRadius = static_cast<OffsetValueType>(m_Radius[0]);
+    if (lineRadius > 0)
+    {
+      for (auto rowIt = rows.begin(); rowIt != rows.end();)
+      {
+        IntervalListType & intervals = rowIt->second;
+        if (m_PerformDilation)
+        {
+          for (auto & interval : intervals)
+          {
+            interval.first -= lineRadius;
+            interval.second += lineRadius;
+          }
+          this->MergeIntervals(intervals);
+        }
+        else
+        {
+          IntervalListType shortened;
+          for (const auto & interval : intervals)
+          {
+            if (interval.second - interval.first >= 2 * lineRadius)
+            {
+              shortened.emplace_back(interval.first + lineRadius, interval.second - lineRadius);
+            }
+          }
+          intervals.swap(shortened);
+        }
+        if (intervals.empty())
+        {
+          rowIt = rows.erase(rowIt);
+        }
+        else
+        {
+          ++rowIt;
+        }
+      }
+    }
+
+    // One pass per remaining dimension: the runs of a row are the union
+    // (dilation) or the intersection (erosion) of the runs of the
+    // neighboring rows along that dimension.
+    for (unsigned int d = 1; d < ImageDimension; ++d)
+    {
+      const auto radius = static_cast<OffsetValueType>(m_Radius[d]);
+      if (radius == 0)
+      {
+        continue;
+      }
+      RowMapType newRows;
+      if (m_PerformDilation)
+      {
+        for (const auto & row : rows)
+        {
+          for (OffsetValueType k = -radius; k <= radius; ++k)
+          {
+            IndexType key = row.first;
+            key[d] += k;
+            IntervalListType & intervals = newRows[key];
+            intervals.insert(intervals.end(), row.second.begin(), row.second.end());
+          }
+        }
+        for (auto & row : newRows)
+        {
+          this->MergeIntervals(row.second);
+        }
+      }
+      else
+      {
+        for (const auto & row : rows)
+        {
+          IntervalListType intervals = row.second;
+          for (OffsetValueType k = -radius; k <= radius && !intervals.empty(); ++k)
+          {
+            if (k == 0)
+            {
+              continue;
+            }
+            IndexType key = row.first;
+            key[d] += k;
+            const auto neighbor = rows.find(key);
+            if (neighbor == rows.end())
+            {
+              intervals.clear();
+            }
+            else
+            {
+              intervals = this->IntersectIntervals(intervals, neighbor->second);
+            }
+          }
+          if (!intervals.empty())
+          {
+            newRows[row.first].swap(intervals);
+          }
+        }
+      }
+      rows.swap(newRows);
+    }
+
+    // A dilation is cropped to the largest possible region; an erosion
+    // cannot grow the object, so there is nothing to crop there.
+    if (m_PerformDilation)
+    {
+      const OffsetValueType lineFirst = regionIndex[0];
+      const OffsetValueType lineLast = regionIndex[0] + static_cast<OffsetValueType>(regionSize[0]) - 1;
+      for (auto rowIt = rows.begin(); rowIt != rows.end();)
+      {
+        bool inside = true;
+        for (unsigned int d = 1; d < ImageDimension; ++d)
+        {
+          if (rowIt->first[d] < regionIndex[d] ||
+              rowIt->first[d] > regionIndex[d] + static_cast<OffsetValueType>(regionSize[d]) - 1)
+          {
+            inside = false;
+            break;
+          }
+        }
+        IntervalListType cropped;
+        if (inside)
+        {
+          for (const auto & interval : rowIt->second)
+          {
+            const OffsetValueType first = std::max(interval.first, lineFirst);
+            const OffsetValueType last = std::min(interval.second, lineLast);
+            if (first <= last)
+            {
+              cropped.emplace_back(first, last);
+            }
+          }
+        }
+        if (cropped.empty())
+        {
+          rowIt = rows.erase(rowIt);
+        }
+        else
+        {
+          rowIt->second.swap(cropped);
+          ++rowIt;
+        }
+      }
+    }
+
+    // Refill the object with the new runs; they are already sorted and
+    // disjoint.
+    labelObject->Clear();
+    for (const auto & row : rows)
+    {
+      for (const auto & interval : row.second)
+      {
+        IndexType idx = row.first;
+        idx[0] = interval.first;
+        labelObject->AddLine(idx, static_cast<LengthType>(interval.second - interval.first + 1));
+      }
+    }
+    if (labelObject->Empty())
+    {
+      emptyObjects.push_back(labelObject);
+    }
+
+    progress.CompletedPixel();
+    ++loIt;
+  }
+
+  // Objects completely removed by an erosion are discarded.
+  for (auto * labelObject : emptyObjects)
+  {
+    output->RemoveLabelObject(labelObject);
+  }
+}
+
+template <typename TImage>
+void
+BinaryMorphologyLabelMapFilter<TImage>::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "Radius: " << m_Radius << std::endl;
+  os << indent << "PerformDilation: " << m_PerformDilation << std::endl;
+}
+} // end namespace itk
+#endif
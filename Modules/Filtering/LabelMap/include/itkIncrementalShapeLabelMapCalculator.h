@@ -0,0 +1,184 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkIncrementalShapeLabelMapCalculator_h
+#define itkIncrementalShapeLabelMapCalculator_h
+
+#include "itkObject.h"
+#include "itkObjectFactory.h"
+#include "itkNumericTraits.h"
+
+#include <map>
+
+namespace itk
+{
+/**
+ *\class IncrementalShapeLabelMapCalculator
+ * \brief Maintain the shape attributes of the objects of a label map
+ * under run level edits.
+ *
+ * ShapeLabelMapFilter recomputes the attributes of every object from
+ * scratch, which is too slow for interactive editing of label maps with
+ * many objects. This calculator keeps the raw accumulators each shape
+ * attribute is derived from - the pixel count, the coordinate sums, the
+ * bounding box and the uncentered second order physical moment sums -
+ * for every object, so a run added to or removed from a single object
+ * only updates that object's accumulators and rederives its attributes
+ * in constant time. Removing a run which touches the bounding box of
+ * its object triggers a rescan of that object's lines only.
+ *
+ * Compute() builds the accumulators for all the objects and writes their
+ * attributes, like ShapeLabelMapFilter would; AddLine() and RemoveLine()
+ * then apply an edit to both the label map and the attributes of the
+ * affected object. A removed run must be completely covered by the
+ * object it is removed from. An object completely removed is discarded
+ * from the label map, and a run added with a new label creates its
+ * object.
+ *
+ * The attributes maintained are the ones derived from the moments and
+ * the bounding box: NumberOfPixels, PhysicalSize, Centroid, BoundingBox,
+ * PrincipalMoments, PrincipalAxes, Elongation, Flatness and the
+ * equivalent spherical and ellipsoid descriptors. The perimeter, Feret
+ * diameter and oriented bounding box attributes are not computed, since
+ * they cannot be updated from stored moments.
+ *
+ * \sa ShapeLabelObject, ShapeLabelMapFilter, LabelImageToShapeLabelMapFilter
+ * \ingroup ITKLabelMap
+ */
+template <typename TLabelMap>
+class ITK_TEMPLATE_EXPORT IncrementalShapeLabelMapCalculator : public Object
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(IncrementalShapeLabelMapCalculator);
+
+  /** Standard class type aliases. */
+  using Self = IncrementalShapeLabelMapCalculator;
+  using Superclass = Object;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(IncrementalShapeLabelMapCalculator, Object);
+
+  /** Some convenient type alias. */
+  using LabelMapType = TLabelMap;
+  using LabelMapPointer = typename LabelMapType::Pointer;
+  using LabelObjectType = typename LabelMapType::LabelObjectType;
+  using LabelType = typename LabelMapType::PixelType;
+  using IndexType = typename LabelMapType::IndexType;
+  using LengthType = typename LabelObjectType::LengthType;
+  using RegionType = typename LabelObjectType::RegionType;
+  using CentroidType = typename LabelObjectType::CentroidType;
+  using MatrixType = typename LabelObjectType::MatrixType;
+  using VectorType = typename LabelObjectType::VectorType;
+
+  /** ImageDimension constants */
+  static constexpr unsigned int ImageDimension = TLabelMap::ImageDimension;
+
+  /** Set/Get the label map whose attributes are maintained. */
+  itkSetObjectMacro(LabelMap, LabelMapType);
+  itkGetModifiableObjectMacro(LabelMap, LabelMapType);
+
+  /** Build the accumulators of all the objects of the label map and
+   * write their shape attributes. Must be called once before the first
+   * edit, and again whenever the label map is changed behind the back
+   * of this calculator. */
+  void
+  Compute();
+
+  /** Add a run to the object with the given label, creating the object
+   * if it does not exist yet, and update its attributes. The run must
+   * not overlap a pixel already in the object. */
+  void
+  AddLine(const LabelType & label, const IndexType & index, LengthType length);
+
+  /** Remove a run from the object with the given label and update its
+   * attributes. The run must be completely covered by the object. An
+   * object left without any pixel is removed from the label map. */
+  void
+  RemoveLine(const LabelType & label, const IndexType & index, LengthType length);
+
+protected:
+  IncrementalShapeLabelMapCalculator() = default;
+  ~IncrementalShapeLabelMapCalculator() override = default;
+
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  /** The raw sums the attributes are derived from. The moment matrix
+   * holds the uncentered, undivided second order physical moments. */
+  struct Accumulator
+  {
+    SizeValueType nbOfPixels{ 0 };
+    double        centroidSum[ImageDimension];
+    IndexType     mins;
+    IndexType     maxs;
+    MatrixType    rawMoments;
+
+    Accumulator()
+    {
+      for (unsigned int i = 0; i < ImageDimension; ++i)
+      {
+        centroidSum[i] = 0.0;
+        mins[i] = NumericTraits<IndexValueType>::max();
+        maxs[i] = NumericTraits<IndexValueType>::NonpositiveMin();
+      }
+      rawMoments.Fill(0.0);
+    }
+  };
+
+  using AccumulatorMapType = std::map<LabelType, Accumulator>;
+
+  /** Add (sign +1) or subtract (sign -1) the contribution of one run
+   * from the count, the coordinate sums and the raw moments. The
+   * bounding box is handled by the callers. */
+  void
+  AccumulateLine(Accumulator & accumulator, const IndexType & index, LengthType length, double sign) const;
+
+  /** Grow the bounding box of the accumulator to contain the run. */
+  static void
+  ExpandBoundingBox(Accumulator & accumulator, const IndexType & index, LengthType length);
+
+  /** Recompute the bounding box of the accumulator from the lines of
+   * the object. */
+  static void
+  RecomputeBoundingBox(Accumulator & accumulator, const LabelObjectType * labelObject);
+
+  /** Derive the shape attributes from the accumulator and write them to
+   * the object. */
+  void
+  WriteAttributes(LabelObjectType * labelObject, const Accumulator & accumulator) const;
+
+  /** Remove the run from the line container of the object, splitting
+   * the lines which extend beyond it. */
+  static void
+  RemoveLineFromObject(LabelObjectType * labelObject, const IndexType & index, LengthType length);
+
+  LabelMapPointer    m_LabelMap;
+  AccumulatorMapType m_Accumulators;
+}; // end of class
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkIncrementalShapeLabelMapCalculator.hxx"
+#endif
+
+#endif
@@ -0,0 +1,427 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkIncrementalShapeLabelMapCalculator_hxx
+#define itkIncrementalShapeLabelMapCalculator_hxx
+
+#include "itkIncrementalShapeLabelMapCalculator.h"
+#include "itkContinuousIndex.h"
+#include "itkGeometryUtilities.h"
+#include "vnl/algo/vnl_real_eigensystem.h"
+#include "vnl/algo/vnl_symmetric_eigensystem.h"
+
+#include <algorithm>
+#include <complex>
+#include <vector>
+
+namespace itk
+{
+template <typename TLabelMap>
+void
+IncrementalShapeLabelMapCalculator<TLabelMap>::AccumulateLine(Accumulator &     accumulator,
+                                                              const IndexType & index,
+                                                              LengthType        length,
+                                                              double            sign) const
+{
+  if (sign > 0)
+  {
+    accumulator.nbOfPixels += length;
+  }
+  else
+  {
+    accumulator.nbOfPixels -= length;
+  }
+
+  // First, the axes that are not 0, then axis 0, as the run extends
+  // along it.
+  for (unsigned int i = 1; i < ImageDimension; ++i)
+  {
+    accumulator.centroidSum[i] += sign * static_cast<OffsetValueType>(length) * index[i];
+  }
+  accumulator.centroidSum[0] += sign * (index[0] * static_cast<OffsetValueType>(length) + (length * (length - 1)) / 2.0);
+
+  // Uncentered second order physical moments of the run, accumulated
+  // with the same closed forms ShapeLabelMapFilter uses.
+  CentroidType physicalPosition;
+  m_LabelMap->TransformIndexToPhysicalPoint(index, physicalPosition);
+
+  const typename LabelMapType::DirectionType & direction = m_LabelMap->GetDirection();
+  VectorType                                   scale(m_LabelMap->GetSpacing()[0]);
+  for (unsigned int i = 0; i < ImageDimension; ++i)
+  {
+    scale[i] *= direction(i, 0);
+  }
+
+  const double lcoff_1 = (length - 1.0) / 2.0;
+  const double lcoff_2 = (2.0 * length - 1.0) / 3.0;
+
+  for (unsigned int i = 0; i < ImageDimension; ++i)
+  {
+    accumulator.rawMoments[i][i] +=
+      sign * length *
+      (physicalPosition[i] * physicalPosition[i] +
+       lcoff_1 * (2.0 * physicalPosition[i] * scale[i] + lcoff_2 * scale[i] * scale[i]));
+
+    for (unsigned int j = i + 1; j < ImageDimension; ++j)
+    {
+      const double cm = sign * length *
+                        (physicalPosition[i] * physicalPosition[j] +
+                         lcoff_1 * (physicalPosition[i] * scale[j] + scale[i] * physicalPosition[j] +
+                                    lcoff_2 * scale[i] * scale[j]));
+      accumulator.rawMoments[j][i] += cm;
+      accumulator.rawMoments[i][j] += cm;
+    }
+  }
+}
+
+template <typename TLabelMap>
+void
+IncrementalShapeLabelMapCalculator<TLabelMap>::ExpandBoundingBox(Accumulator &     accumulator,
+                                                                 const IndexType & index,
+                                                                 LengthType        length)
+{
+  for (unsigned int i = 1; i < ImageDimension; ++i)
+  {
+    accumulator.mins[i] = std::min(accumulator.mins[i], index[i]);
+    accumulator.maxs[i] = std::max(accumulator.maxs[i], index[i]);
+  }
+  accumulator.mins[0] = std::min(accumulator.mins[0], index[0]);
+  accumulator.maxs[0] = std::max(accumulator.maxs[0], index[0] + static_cast<IndexValueType>(length) - 1);
+}
+
+template <typename TLabelMap>
+void
+IncrementalShapeLabelMapCalculator<TLabelMap>::RecomputeBoundingBox(Accumulator &           accumulator,
+                                                                    const LabelObjectType * labelObject)
+{
+  for (unsigned int i = 0; i < ImageDimension; ++i)
+  {
+    accumulator.mins[i] = NumericTraits<IndexValueType>::max();
+    accumulator.maxs[i] = NumericTraits<IndexValueType>::NonpositiveMin();
+  }
+  typename LabelObjectType::ConstLineIterator lit(labelObject);
+  while (!lit.IsAtEnd())
+  {
+    Self::ExpandBoundingBox(accumulator, lit.GetLine().GetIndex(), lit.GetLine().GetLength());
+    ++lit;
+  }
+}
+
+template <typename TLabelMap>
+void
+IncrementalShapeLabelMapCalculator<TLabelMap>::WriteAttributes(LabelObjectType *   labelObject,
+                                                               const Accumulator & accumulator) const
+{
+  const SizeValueType nbOfPixels = accumulator.nbOfPixels;
+
+  ContinuousIndex<double, ImageDimension> centroid;
+  typename RegionType::SizeType           boundingBoxSize;
+  MatrixType                              centralMoments = accumulator.rawMoments;
+  for (unsigned int i = 0; i < ImageDimension; ++i)
+  {
+    centroid[i] = accumulator.centroidSum[i] / nbOfPixels;
+    boundingBoxSize[i] = accumulator.maxs[i] - accumulator.mins[i] + 1;
+    for (unsigned int j = 0; j < ImageDimension; ++j)
+    {
+      centralMoments[i][j] /= nbOfPixels;
+    }
+  }
+  RegionType   boundingBox(accumulator.mins, boundingBoxSize);
+  CentroidType physicalCentroid;
+  m_LabelMap->TransformContinuousIndexToPhysicalPoint(centroid, physicalCentroid);
+
+  // Center the second order moments
+  for (unsigned int i = 0; i < ImageDimension; ++i)
+  {
+    for (unsigned int j = 0; j < ImageDimension; ++j)
+    {
+      centralMoments[i][j] -= physicalCentroid[i] * physicalCentroid[j];
+    }
+  }
+
+  // Compute principal moments and axes
+  VectorType                        principalMoments;
+  vnl_symmetric_eigensystem<double> eigen{ centralMoments.GetVnlMatrix().as_matrix() };
+  vnl_diag_matrix<double>           pm = eigen.D;
+  for (unsigned int i = 0; i < ImageDimension; ++i)
+  {
+    principalMoments[i] = pm(i);
+  }
+  MatrixType principalAxes(eigen.V.transpose());
+
+  // Add a final reflection if needed for a proper rotation,
+  // by multiplying the last row by the determinant
+  vnl_real_eigensystem                  eigenrot{ principalAxes.GetVnlMatrix().as_matrix() };
+  vnl_diag_matrix<std::complex<double>> eigenval{ eigenrot.D };
+  std::complex<double>                  det(1.0, 0.0);
+
+  for (unsigned int i = 0; i < ImageDimension; ++i)
+  {
+    det *= eigenval(i);
+  }
+
+  for (unsigned int i = 0; i < ImageDimension; ++i)
+  {
+    principalAxes[ImageDimension - 1][i] *= std::real(det);
+  }
+
+  double elongation = 0;
+  double flatness = 0;
+  if (ImageDimension < 2)
+  {
+    elongation = 1;
+    flatness = 1;
+  }
+  else
+  {
+    if (Math::NotAlmostEquals(principalMoments[0], itk::NumericTraits<typename VectorType::ValueType>::ZeroValue()))
+    {
+      const double flatnessRatio = principalMoments[1] / principalMoments[0];
+      flatness = 0.0;
+      if (flatnessRatio > 0.0)
+      {
+        flatness = std::sqrt(flatnessRatio);
+      }
+    }
+    if (Math::NotAlmostEquals(principalMoments[ImageDimension - 2],
+                              itk::NumericTraits<typename VectorType::ValueType>::ZeroValue()))
+    {
+      const double elongationRatio = principalMoments[ImageDimension - 1] / principalMoments[ImageDimension - 2];
+      elongation = 0.0;
+      if (elongationRatio > 0.0)
+      {
+        elongation = std::sqrt(elongationRatio);
+      }
+    }
+  }
+
+  double sizePerPixel = 1.0;
+  for (unsigned int i = 0; i < ImageDimension; ++i)
+  {
+    sizePerPixel *= m_LabelMap->GetSpacing()[i];
+  }
+  double physicalSize = nbOfPixels * sizePerPixel;
+  double equivalentRadius = GeometryUtilities::HyperSphereRadiusFromVolume(ImageDimension, physicalSize);
+  double equivalentPerimeter = GeometryUtilities::HyperSpherePerimeter(ImageDimension, equivalentRadius);
+
+  // Compute equivalent ellipsoid radius
+  VectorType ellipsoidDiameter;
+  double     edet = 1.0;
+  for (unsigned int i = 0; i < ImageDimension; ++i)
+  {
+    edet *= principalMoments[i];
+  }
+  edet = std::pow(edet, 1.0 / ImageDimension);
+  for (unsigned int i = 0; i < ImageDimension; ++i)
+  {
+    ellipsoidDiameter[i] = 0.0;
+    if (edet != 0.0 && principalMoments[i] / edet > 0.0)
+    {
+      ellipsoidDiameter[i] = 2.0 * equivalentRadius * std::sqrt(principalMoments[i] / edet);
+    }
+  }
+
+  // Set the values in the object
+  labelObject->SetNumberOfPixels(nbOfPixels);
+  labelObject->SetPhysicalSize(physicalSize);
+  labelObject->SetBoundingBox(boundingBox);
+  labelObject->SetCentroid(physicalCentroid);
+  labelObject->SetPrincipalMoments(principalMoments);
+  labelObject->SetPrincipalAxes(principalAxes);
+  labelObject->SetElongation(elongation);
+  labelObject->SetFlatness(flatness);
+  labelObject->SetEquivalentSphericalRadius(equivalentRadius);
+  labelObject->SetEquivalentSphericalPerimeter(equivalentPerimeter);
+  labelObject->SetEquivalentEllipsoidDiameter(ellipsoidDiameter);
+}
+
+template <typename TLabelMap>
+void
+IncrementalShapeLabelMapCalculator<TLabelMap>::Compute()
+{
+  if (m_LabelMap.IsNull())
+  {
+    itkExceptionMacro(<< "LabelMap is not set");
+  }
+
+  m_Accumulators.clear();
+
+  typename LabelMapType::Iterator it(m_LabelMap);
+  while (!it.IsAtEnd())
+  {
+    LabelObjectType * labelObject = it.GetLabelObject();
+    Accumulator       accumulator;
+
+    typename LabelObjectType::ConstLineIterator lit(labelObject);
+    while (!lit.IsAtEnd())
+    {
+      const IndexType & idx = lit.GetLine().GetIndex();
+      const LengthType  length = lit.GetLine().GetLength();
+      this->AccumulateLine(accumulator, idx, length, 1.0);
+      Self::ExpandBoundingBox(accumulator, idx, length);
+      ++lit;
+    }
+
+    this->WriteAttributes(labelObject, accumulator);
+    m_Accumulators[labelObject->GetLabel()] = accumulator;
+    ++it;
+  }
+}
+
+template <typename TLabelMap>
+void
+IncrementalShapeLabelMapCalculator<TLabelMap>::AddLine(const LabelType & label,
+                                                       const IndexType & index,
+                                                       LengthType        length)
+{
+  if (m_LabelMap.IsNull())
+  {
+    itkExceptionMacro(<< "LabelMap is not set");
+  }
+
+  LabelObjectType * labelObject;
+  if (m_LabelMap->HasLabel(label))
+  {
+    labelObject = m_LabelMap->GetLabelObject(label);
+  }
+  else
+  {
+    auto newObject = LabelObjectType::New();
+    newObject->SetLabel(label);
+    m_LabelMap->AddLabelObject(newObject);
+    labelObject = newObject;
+  }
+  labelObject->AddLine(index, length);
+  labelObject->Optimize();
+
+  Accumulator & accumulator = m_Accumulators[label];
+  this->AccumulateLine(accumulator, index, length, 1.0);
+  Self::ExpandBoundingBox(accumulator, index, length);
+  this->WriteAttributes(labelObject, accumulator);
+}
+
+template <typename TLabelMap>
+void
+IncrementalShapeLabelMapCalculator<TLabelMap>::RemoveLine(const LabelType & label,
+                                                          const IndexType & index,
+                                                          LengthType        length)
+{
+  if (m_LabelMap.IsNull())
+  {
+    itkExceptionMacro(<< "LabelMap is not set");
+  }
+
+  LabelObjectType * labelObject = m_LabelMap->GetLabelObject(label);
+  Self::RemoveLineFromObject(labelObject, index, length);
+
+  Accumulator & accumulator = m_Accumulators[label];
+  this->AccumulateLine(accumulator, index, length, -1.0);
+
+  if (labelObject->Empty())
+  {
+    m_LabelMap->RemoveLabelObject(labelObject);
+    m_Accumulators.erase(label);
+    return;
+  }
+
+  // The bounding box can only shrink when the removed run lies on one
+  // of its faces; only then rescan the lines of the object.
+  bool onFace = (index[0] == accumulator.mins[0]) ||
+                (index[0] + static_cast<IndexValueType>(length) - 1 == accumulator.maxs[0]);
+  for (unsigned int i = 1; i < ImageDimension; ++i)
+  {
+    onFace = onFace || index[i] == accumulator.mins[i] || index[i] == accumulator.maxs[i];
+  }
+  if (onFace)
+  {
+    Self::RecomputeBoundingBox(accumulator, labelObject);
+  }
+
+  this->WriteAttributes(labelObject, accumulator);
+}
+
+template <typename TLabelMap>
+void
+IncrementalShapeLabelMapCalculator<TLabelMap>::RemoveLineFromObject(LabelObjectType * labelObject,
+                                                                    const IndexType & index,
+                                                                    LengthType        length)
+{
+  using LineType = typename LabelObjectType::LineType;
+
+  const OffsetValueType first = index[0];
+  const OffsetValueType last = first + static_cast<OffsetValueType>(length) - 1;
+
+  std::vector<LineType> newLines;
+  newLines.reserve(labelObject->GetNumberOfLines());
+
+  typename LabelObjectType::ConstLineIterator lit(labelObject);
+  while (!lit.IsAtEnd())
+  {
+    const LineType &  line = lit.GetLine();
+    const IndexType & lineIndex = line.GetIndex();
+
+    bool sameRow = true;
+    for (unsigned int i = 1; i < ImageDimension; ++i)
+    {
+      if (lineIndex[i] != index[i])
+      {
+        sameRow = false;
+        break;
+      }
+    }
+
+    const OffsetValueType lineFirst = lineIndex[0];
+    const OffsetValueType lineLast = lineFirst + static_cast<OffsetValueType>(line.GetLength()) - 1;
+    if (!sameRow || lineLast < first || lineFirst > last)
+    {
+      newLines.push_back(line);
+    }
+    else
+    {
+      if (lineFirst < first)
+      {
+        IndexType leftIndex = lineIndex;
+        newLines.push_back(LineType(leftIndex, static_cast<LengthType>(first - lineFirst)));
+      }
+      if (lineLast > last)
+      {
+        IndexType rightIndex = lineIndex;
+        rightIndex[0] = last + 1;
+        newLines.push_back(LineType(rightIndex, static_cast<LengthType>(lineLast - last)));
+      }
+    }
+    ++lit;
+  }
+
+  labelObject->Clear();
+  for (const LineType & line : newLines)
+  {
+    labelObject->AddLine(line);
+  }
+}
+
+template <typename TLabelMap>
+void
+IncrementalShapeLabelMapCalculator<TLabelMap>::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  itkPrintSelfObjectMacro(LabelMap);
+  os << indent << "NumberOfTrackedObjects: " << m_Accumulators.size() << std::endl;
+}
+} // end namespace itk
+#endif
@@ -0,0 +1,158 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkIntersectLabelMapFilter_h
+#define itkIntersectLabelMapFilter_h
+
+#include "itkInPlaceLabelMapFilter.h"
+
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace itk
+{
+/**
+ *\class IntersectLabelMapFilter
+ * \brief Keep the parts of the objects of a label map covered by the
+ * foreground of a second label map.
+ *
+ * The second input is interpreted as a binary mask given by the union of
+ * the lines of all its objects, whatever their labels. Every object of
+ * the first input is intersected with that mask, directly on the
+ * run-length representation of both maps: the run lists of matching rows
+ * are intersected, so the run time is proportional to the number of runs
+ * rather than to the number of pixels. The labels and the attributes of
+ * the objects of the first input are preserved, and objects with no
+ * remaining pixel are discarded.
+ *
+ * The union of two label maps is provided by MergeLabelMapFilter.
+ *
+ * \sa MergeLabelMapFilter, LabelMapMaskImageFilter
+ * \ingroup ImageEnhancement  MathematicalMorphologyImageFilters
+ * \ingroup ITKLabelMap
+ */
+template <typename TImage>
+class ITK_TEMPLATE_EXPORT IntersectLabelMapFilter : public InPlaceLabelMapFilter<TImage>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(IntersectLabelMapFilter);
+
+  /** Standard class type aliases. */
+  using Self = IntersectLabelMapFilter;
+  using Superclass = InPlaceLabelMapFilter<TImage>;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Some convenient type alias. */
+  using ImageType = TImage;
+  using ImagePointer = typename ImageType::Pointer;
+  using ImageConstPointer = typename ImageType::ConstPointer;
+  using PixelType = typename ImageType::PixelType;
+  using IndexType = typename ImageType::IndexType;
+  using LabelObjectType = typename ImageType::LabelObjectType;
+  using LengthType = typename LabelObjectType::LengthType;
+
+  /** ImageDimension constants */
+  static constexpr unsigned int ImageDimension = TImage::ImageDimension;
+
+  /** Standard New method. */
+  itkNewMacro(Self);
+
+  /** Runtime information support. */
+  itkTypeMacro(IntersectLabelMapFilter, InPlaceLabelMapFilter);
+
+  /** Set/Get the label map whose foreground masks the first input. */
+  void
+  SetMaskImage(const ImageType * input)
+  {
+    // Process object is not const-correct so the const casting is required.
+    this->SetNthInput(1, const_cast<ImageType *>(input));
+  }
+
+  const ImageType *
+  GetMaskImage() const
+  {
+    return itkDynamicCastInDebugMode<ImageType *>(const_cast<DataObject *>(this->ProcessObject::GetInput(1)));
+  }
+
+  /** Set the first input */
+  void
+  SetInput1(const ImageType * input)
+  {
+    this->SetInput(input);
+  }
+
+  /** Set the mask input */
+  void
+  SetInput2(const ImageType * input)
+  {
+    this->SetMaskImage(input);
+  }
+
+protected:
+  IntersectLabelMapFilter();
+  ~IntersectLabelMapFilter() override = default;
+
+  void
+  GenerateData() override;
+
+private:
+  /** A run along the line dimension, stored as the first and the last
+   * coordinate covered, both included. */
+  using IntervalType = std::pair<OffsetValueType, OffsetValueType>;
+  using IntervalListType = std::vector<IntervalType>;
+
+  /** Order the rows by their coordinates in the non-line dimensions;
+   * the line coordinate of the keys is always zero. */
+  struct RowComparator
+  {
+    bool
+    operator()(const IndexType & lhs, const IndexType & rhs) const
+    {
+      for (unsigned int d = ImageDimension - 1; d > 0; --d)
+      {
+        if (lhs[d] != rhs[d])
+        {
+          return lhs[d] < rhs[d];
+        }
+      }
+      return false;
+    }
+  };
+
+  using RowMapType = std::map<IndexType, IntervalListType, RowComparator>;
+
+  /** Gather the lines of an object into sorted, disjoint interval lists. */
+  static void
+  GatherRows(const LabelObjectType * labelObject, RowMapType & rows);
+
+  /** Sort the intervals and merge the ones which overlap or touch. */
+  static void
+  MergeIntervals(IntervalListType & intervals);
+
+  /** Intersect two sorted, disjoint interval lists. */
+  static IntervalListType
+  IntersectIntervals(const IntervalListType & intervalsA, const IntervalListType & intervalsB);
+}; // end of class
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkIntersectLabelMapFilter.hxx"
+#endif
+
+#endif
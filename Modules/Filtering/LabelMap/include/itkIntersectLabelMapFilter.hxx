@@ -0,0 +1,169 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkIntersectLabelMapFilter_hxx
+#define itkIntersectLabelMapFilter_hxx
+
+#include "itkIntersectLabelMapFilter.h"
+#include "itkProgressReporter.h"
+
+#include <algorithm>
+
+namespace itk
+{
+template <typename TImage>
+IntersectLabelMapFilter<TImage>::IntersectLabelMapFilter()
+{
+  this->SetNumberOfRequiredInputs(2);
+}
+
+template <typename TImage>
+void
+IntersectLabelMapFilter<TImage>::GatherRows(const LabelObjectType * labelObject, RowMapType & rows)
+{
+  typename LabelObjectType::ConstLineIterator lit(labelObject);
+  while (!lit.IsAtEnd())
+  {
+    const typename LabelObjectType::LineType & line = lit.GetLine();
+    IndexType                                  key = line.GetIndex();
+    const OffsetValueType                      first = key[0];
+    key[0] = 0;
+    rows[key].emplace_back(first, first + static_cast<OffsetValueType>(line.GetLength()) - 1);
+    ++lit;
+  }
+}
+
+template <typename TImage>
+void
+IntersectLabelMapFilter<TImage>::MergeIntervals(IntervalListType & intervals)
+{
+  if (intervals.empty())
+  {
+    return;
+  }
+  std::sort(intervals.begin(), intervals.end());
+  IntervalListType merged;
+  merged.push_back(intervals.front());
+  for (size_t i = 1; i < intervals.size(); ++i)
+  {
+    if (intervals[i].first <= merged.back().second + 1)
+    {
+      merged.back().second = std::max(merged.back().second, intervals[i].second);
+    }
+    else
+    {
+      merged.push_back(intervals[i]);
+    }
+  }
+  intervals.swap(merged);
+}
+
+template <typename TImage>
+auto
+IntersectLabelMapFilter<TImage>::IntersectIntervals(const IntervalListType & intervalsA,
+                                                    const IntervalListType & intervalsB) -> IntervalListType
+{
+  IntervalListType result;
+  size_t           a = 0;
+  size_t           b = 0;
+  while (a < intervalsA.size() && b < intervalsB.size())
+  {
+    const OffsetValueType first = std::max(intervalsA[a].first, intervalsB[b].first);
+    const OffsetValueType last = std::min(intervalsA[a].second, intervalsB[b].second);
+    if (first <= last)
+    {
+      result.emplace_back(first, last);
+    }
+    if (intervalsA[a].second < intervalsB[b].second)
+    {
+      ++a;
+    }
+    else
+    {
+      ++b;
+    }
+  }
+  return result;
+}
+
+template <typename TImage>
+void
+IntersectLabelMapFilter<TImage>::GenerateData()
+{
+  // Allocate the output
+  this->AllocateOutputs();
+
+  ImageType *       output = this->GetOutput();
+  const ImageType * mask = this->GetMaskImage();
+
+  // The mask is the union of the lines of all the objects of the second
+  // input, whatever their labels.
+  RowMapType maskRows;
+  for (SizeValueType i = 0; i < mask->GetNumberOfLabelObjects(); ++i)
+  {
+    this->GatherRows(mask->GetNthLabelObject(i), maskRows);
+  }
+  for (auto & row : maskRows)
+  {
+    this->MergeIntervals(row.second);
+  }
+
+  ProgressReporter progress(this, 0, output->GetNumberOfLabelObjects());
+
+  std::vector<LabelObjectType *> emptyObjects;
+
+  typename ImageType::Iterator loIt(output);
+  while (!loIt.IsAtEnd())
+  {
+    LabelObjectType * labelObject = loIt.GetLabelObject();
+
+    RowMapType rows;
+    this->GatherRows(labelObject, rows);
+
+    labelObject->Clear();
+    for (auto & row : rows)
+    {
+      const auto maskRow = maskRows.find(row.first);
+      if (maskRow == maskRows.end())
+      {
+        continue;
+      }
+      this->MergeIntervals(row.second);
+      for (const auto & interval : this->IntersectIntervals(row.second, maskRow->second))
+      {
+        IndexType idx = row.first;
+        idx[0] = interval.first;
+        labelObject->AddLine(idx, static_cast<LengthType>(interval.second - interval.first + 1));
+      }
+    }
+    if (labelObject->Empty())
+    {
+      emptyObjects.push_back(labelObject);
+    }
+
+    progress.CompletedPixel();
+    ++loIt;
+  }
+
+  // Objects with no remaining pixel are discarded.
+  for (auto * labelObject : emptyObjects)
+  {
+    output->RemoveLabelObject(labelObject);
+  }
+}
+} // end namespace itk
+#endif
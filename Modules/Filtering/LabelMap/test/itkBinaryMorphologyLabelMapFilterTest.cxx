@@ -0,0 +1,204 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkBinaryMorphologyLabelMapFilter.h"
+#include "itkIntersectLabelMapFilter.h"
+#include "itkBinaryImageToLabelMapFilter.h"
+#include "itkLabelMapToBinaryImageFilter.h"
+#include "itkBinaryDilateImageFilter.h"
+#include "itkBinaryErodeImageFilter.h"
+#include "itkFlatStructuringElement.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkTestingMacros.h"
+
+namespace
+{
+
+using ImageType = itk::Image<unsigned char, 2>;
+
+bool
+ImagesAreIdentical(const ImageType * imageA, const ImageType * imageB)
+{
+  itk::ImageRegionConstIterator<ImageType> itA(imageA, imageA->GetLargestPossibleRegion());
+  itk::ImageRegionConstIterator<ImageType> itB(imageB, imageB->GetLargestPossibleRegion());
+  for (; !itA.IsAtEnd(); ++itA, ++itB)
+  {
+    if (itA.Get() != itB.Get())
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+void
+FillBox(ImageType * image, int x0, int x1, int y0, int y1)
+{
+  for (int y = y0; y <= y1; ++y)
+  {
+    for (int x = x0; x <= x1; ++x)
+    {
+      image->SetPixel({ { x, y } }, 255);
+    }
+  }
+}
+
+} // namespace
+
+int
+itkBinaryMorphologyLabelMapFilterTest(int, char *[])
+{
+  using ConverterType = itk::BinaryImageToLabelMapFilter<ImageType>;
+  using LabelMapType = ConverterType::OutputImageType;
+  using MorphologyType = itk::BinaryMorphologyLabelMapFilter<LabelMapType>;
+  using IntersectType = itk::IntersectLabelMapFilter<LabelMapType>;
+  using BackConverterType = itk::LabelMapToBinaryImageFilter<LabelMapType, ImageType>;
+  using KernelType = itk::FlatStructuringElement<2>;
+
+  // Two well separated blobs plus a tiny one near the image border; the
+  // first blob is the union of two overlapping rectangles so its lines
+  // are not all of the same length.
+  auto                input = ImageType::New();
+  ImageType::SizeType size;
+  size[0] = 80;
+  size[1] = 60;
+  input->SetRegions(size);
+  input->Allocate(true);
+  FillBox(input, 10, 30, 10, 20);
+  FillBox(input, 20, 40, 15, 30);
+  FillBox(input, 55, 70, 40, 52);
+  FillBox(input, 1, 2, 50, 51);
+
+  ImageType::SizeType radius;
+  radius[0] = 3;
+  radius[1] = 2;
+  const KernelType kernel = KernelType::Box(radius);
+
+  // Dilation on the runs must match the dense dilation exactly.
+  auto converter = ConverterType::New();
+  converter->SetInput(input);
+  converter->SetInputForegroundValue(255);
+
+  auto dilate = MorphologyType::New();
+  dilate->SetInput(converter->GetOutput());
+  dilate->SetRadius(radius);
+  ITK_TEST_SET_GET_VALUE(radius, dilate->GetRadius());
+  ITK_TEST_EXPECT_TRUE(dilate->GetPerformDilation());
+
+  ITK_EXERCISE_BASIC_OBJECT_METHODS(dilate, BinaryMorphologyLabelMapFilter, InPlaceLabelMapFilter);
+
+  auto backConverter = BackConverterType::New();
+  backConverter->SetInput(dilate->GetOutput());
+  backConverter->SetForegroundValue(255);
+  backConverter->SetBackgroundValue(0);
+  ITK_TRY_EXPECT_NO_EXCEPTION(backConverter->Update());
+
+  auto denseDilate = itk::BinaryDilateImageFilter<ImageType, ImageType, KernelType>::New();
+  denseDilate->SetInput(input);
+  denseDilate->SetKernel(kernel);
+  denseDilate->SetForegroundValue(255);
+  ITK_TRY_EXPECT_NO_EXCEPTION(denseDilate->Update());
+
+  if (!ImagesAreIdentical(backConverter->GetOutput(), denseDilate->GetOutput()))
+  {
+    std::cerr << "Test failed!" << std::endl;
+    std::cerr << "Run-based dilation differs from BinaryDilateImageFilter." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Erosion: the region outside the image is background, so compare
+  // against the dense erosion with BoundaryToForeground turned off. The
+  // tiny blob is smaller than the structuring element and must be
+  // discarded from the label map.
+  auto erodeConverter = ConverterType::New();
+  erodeConverter->SetInput(input);
+  erodeConverter->SetInputForegroundValue(255);
+
+  auto erode = MorphologyType::New();
+  erode->SetInput(erodeConverter->GetOutput());
+  erode->SetRadius(radius);
+  erode->PerformDilationOff();
+
+  auto erodeBackConverter = BackConverterType::New();
+  erodeBackConverter->SetInput(erode->GetOutput());
+  erodeBackConverter->SetForegroundValue(255);
+  erodeBackConverter->SetBackgroundValue(0);
+  ITK_TRY_EXPECT_NO_EXCEPTION(erodeBackConverter->Update());
+
+  ITK_TEST_EXPECT_EQUAL(itk::SizeValueType{ 2 }, erode->GetOutput()->GetNumberOfLabelObjects());
+
+  auto denseErode = itk::BinaryErodeImageFilter<ImageType, ImageType, KernelType>::New();
+  denseErode->SetInput(input);
+  denseErode->SetKernel(kernel);
+  denseErode->SetForegroundValue(255);
+  denseErode->SetBackgroundValue(0);
+  denseErode->SetBoundaryToForeground(false);
+  ITK_TRY_EXPECT_NO_EXCEPTION(denseErode->Update());
+
+  if (!ImagesAreIdentical(erodeBackConverter->GetOutput(), denseErode->GetOutput()))
+  {
+    std::cerr << "Test failed!" << std::endl;
+    std::cerr << "Run-based erosion differs from BinaryErodeImageFilter." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Intersection with a shifted copy of the mask, compared against the
+  // pixel-wise AND of the two binary images.
+  auto maskInput = ImageType::New();
+  maskInput->SetRegions(size);
+  maskInput->Allocate(true);
+  FillBox(maskInput, 14, 34, 13, 23);
+  FillBox(maskInput, 59, 74, 43, 55);
+
+  auto firstConverter = ConverterType::New();
+  firstConverter->SetInput(input);
+  firstConverter->SetInputForegroundValue(255);
+
+  auto maskConverter = ConverterType::New();
+  maskConverter->SetInput(maskInput);
+  maskConverter->SetInputForegroundValue(255);
+
+  auto intersect = IntersectType::New();
+  intersect->SetInput1(firstConverter->GetOutput());
+  intersect->SetInput2(maskConverter->GetOutput());
+
+  ITK_EXERCISE_BASIC_OBJECT_METHODS(intersect, IntersectLabelMapFilter, InPlaceLabelMapFilter);
+
+  auto intersectBackConverter = BackConverterType::New();
+  intersectBackConverter->SetInput(intersect->GetOutput());
+  intersectBackConverter->SetForegroundValue(255);
+  intersectBackConverter->SetBackgroundValue(0);
+  ITK_TRY_EXPECT_NO_EXCEPTION(intersectBackConverter->Update());
+
+  itk::ImageRegionConstIterator<ImageType> itA(input, input->GetLargestPossibleRegion());
+  itk::ImageRegionConstIterator<ImageType> itB(maskInput, maskInput->GetLargestPossibleRegion());
+  itk::ImageRegionConstIterator<ImageType> itAnd(intersectBackConverter->GetOutput(),
+                                                 intersectBackConverter->GetOutput()->GetLargestPossibleRegion());
+  for (; !itA.IsAtEnd(); ++itA, ++itB, ++itAnd)
+  {
+    const unsigned char expected = (itA.Get() == 255 && itB.Get() == 255) ? 255 : 0;
+    if (itAnd.Get() != expected)
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "Run-based intersection differs from the pixel-wise AND." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,169 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkIncrementalShapeLabelMapCalculator.h"
+#include "itkLabelImageToShapeLabelMapFilter.h"
+#include "itkShapeLabelObject.h"
+#include "itkTestingMacros.h"
+
+namespace
+{
+
+using LabelImageType = itk::Image<unsigned char, 2>;
+using ShapeLabelObjectType = itk::ShapeLabelObject<unsigned char, 2>;
+using LabelMapType = itk::LabelMap<ShapeLabelObjectType>;
+
+bool
+CloseEnough(double a, double b)
+{
+  return itk::Math::abs(a - b) <= 1e-6 * (1.0 + itk::Math::abs(b));
+}
+
+bool
+AttributesMatch(const ShapeLabelObjectType * object, const ShapeLabelObjectType * reference)
+{
+  if (object->GetNumberOfPixels() != reference->GetNumberOfPixels() ||
+      object->GetBoundingBox() != reference->GetBoundingBox() ||
+      !CloseEnough(object->GetPhysicalSize(), reference->GetPhysicalSize()) ||
+      !CloseEnough(object->GetElongation(), reference->GetElongation()) ||
+      !CloseEnough(object->GetFlatness(), reference->GetFlatness()) ||
+      !CloseEnough(object->GetEquivalentSphericalRadius(), reference->GetEquivalentSphericalRadius()))
+  {
+    return false;
+  }
+  for (unsigned int i = 0; i < 2; ++i)
+  {
+    if (!CloseEnough(object->GetCentroid()[i], reference->GetCentroid()[i]) ||
+        !CloseEnough(object->GetPrincipalMoments()[i], reference->GetPrincipalMoments()[i]))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+LabelMapType::Pointer
+MakeShapeLabelMap(const LabelImageType * image)
+{
+  using ConverterType = itk::LabelImageToShapeLabelMapFilter<LabelImageType, LabelMapType>;
+  auto converter = ConverterType::New();
+  converter->SetInput(image);
+  converter->Update();
+  LabelMapType::Pointer map = converter->GetOutput();
+  map->DisconnectPipeline();
+  return map;
+}
+
+void
+FillBox(LabelImageType * image, int x0, int x1, int y0, int y1, unsigned char label)
+{
+  for (int y = y0; y <= y1; ++y)
+  {
+    for (int x = x0; x <= x1; ++x)
+    {
+      image->SetPixel({ { x, y } }, label);
+    }
+  }
+}
+
+} // namespace
+
+int
+itkIncrementalShapeLabelMapCalculatorTest(int, char *[])
+{
+  using CalculatorType = itk::IncrementalShapeLabelMapCalculator<LabelMapType>;
+
+  // A label image with anisotropic spacing, so the physical attributes
+  // are exercised too.
+  auto                     image = LabelImageType::New();
+  LabelImageType::SizeType size;
+  size[0] = 60;
+  size[1] = 50;
+  image->SetRegions(size);
+  image->Allocate(true);
+  LabelImageType::SpacingType spacing;
+  spacing[0] = 0.5;
+  spacing[1] = 2.0;
+  image->SetSpacing(spacing);
+  FillBox(image, 5, 24, 5, 19, 1);
+  FillBox(image, 35, 50, 10, 30, 2);
+  FillBox(image, 35, 40, 31, 40, 2);
+
+  // A full Compute() must reproduce the attributes of the standard
+  // shape pipeline.
+  LabelMapType::Pointer map = MakeShapeLabelMap(image);
+
+  auto calculator = CalculatorType::New();
+  calculator->SetLabelMap(map);
+  ITK_EXERCISE_BASIC_OBJECT_METHODS(calculator, IncrementalShapeLabelMapCalculator, Object);
+  calculator->Compute();
+
+  LabelMapType::Pointer reference = MakeShapeLabelMap(image);
+  for (const unsigned char label : { 1, 2 })
+  {
+    if (!AttributesMatch(map->GetLabelObject(label), reference->GetLabelObject(label)))
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "Attributes of label " << static_cast<int>(label) << " differ after Compute()." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Apply run level edits through the calculator: shrink label 1 at its
+  // bounding box face, grow label 2, and create then remove label 3.
+  calculator->RemoveLine(1, { { 5, 5 } }, 20);
+  calculator->AddLine(2, { { 35, 41 } }, 6);
+  calculator->AddLine(3, { { 2, 45 } }, 4);
+
+  ITK_TEST_EXPECT_TRUE(map->HasLabel(3));
+  calculator->RemoveLine(3, { { 2, 45 } }, 4);
+  ITK_TEST_EXPECT_TRUE(!map->HasLabel(3));
+
+  // The same edits applied to the label image give the reference
+  // attributes.
+  FillBox(image, 5, 24, 5, 5, 0);
+  FillBox(image, 35, 40, 41, 41, 2);
+  image->Modified();
+  LabelMapType::Pointer editedReference = MakeShapeLabelMap(image);
+
+  ITK_TEST_EXPECT_EQUAL(editedReference->GetNumberOfLabelObjects(), map->GetNumberOfLabelObjects());
+  for (const unsigned char label : { 1, 2 })
+  {
+    if (!AttributesMatch(map->GetLabelObject(label), editedReference->GetLabelObject(label)))
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "Attributes of label " << static_cast<int>(label) << " differ after the incremental edits."
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Removing a run in the middle of a line must split it.
+  calculator->RemoveLine(2, { { 40, 20 } }, 5);
+  FillBox(image, 40, 44, 20, 20, 0);
+  image->Modified();
+  LabelMapType::Pointer splitReference = MakeShapeLabelMap(image);
+  if (!AttributesMatch(map->GetLabelObject(2), splitReference->GetLabelObject(2)))
+  {
+    std::cerr << "Test failed!" << std::endl;
+    std::cerr << "Attributes of label 2 differ after removing a run inside a line." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -20,7 +20,9 @@
 
 #include "itkQuadEdgeMeshToQuadEdgeMeshFilter.h"
 #include "itkConceptChecking.h"
+#include "itkMultiThreaderBase.h"
 #include "itkTriangleHelper.h"
+#include <vector>
 
 namespace itk
 {
@@ -75,6 +77,11 @@ protected:
   {}
   ~DiscreteCurvatureQuadEdgeMeshFilter() override = default;
 
+  /** Estimate the curvature at the given point.
+   *
+   * \note GenerateData() invokes this method concurrently from multiple
+   * work units, so overriding implementations may only read the output
+   * mesh and must not modify member data. */
   virtual OutputCurvatureType
   EstimateCurvature(const OutputPointType & iP) = 0;
 
@@ -108,15 +115,36 @@ protected:
     OutputPointsContainerPointer  points = output->GetPoints();
     OutputPointsContainerIterator p_it = points->Begin();
 
-    OutputCurvatureType curvature;
-
     this->m_OutputMesh = this->GetOutput();
+
+    // Snapshot the point identifiers and values, so that the curvatures
+    // can be estimated in parallel regardless of the points container
+    // type
+    std::vector<OutputPointIdentifier> pointIds;
+    std::vector<OutputPointType>       pointValues;
+    pointIds.reserve(points->Size());
+    pointValues.reserve(points->Size());
     while (p_it != points->End())
     {
-      curvature = this->EstimateCurvature(p_it->Value());
-      output->SetPointData(p_it->Index(), curvature);
+      pointIds.push_back(p_it->Index());
+      pointValues.push_back(p_it->Value());
       ++p_it;
     }
+
+    // Each curvature estimate only reads the output mesh, so the
+    // estimates are independent of each other; the point data is written
+    // back serially below
+    std::vector<OutputCurvatureType> curvatures(pointValues.size());
+    this->GetMultiThreader()->ParallelizeArray(
+      0,
+      static_cast<SizeValueType>(pointValues.size()),
+      [this, &pointValues, &curvatures](SizeValueType i) { curvatures[i] = this->EstimateCurvature(pointValues[i]); },
+      this);
+
+    for (size_t i = 0; i < pointIds.size(); ++i)
+    {
+      output->SetPointData(pointIds[i], curvatures[i]);
+    }
   }
 
 private:
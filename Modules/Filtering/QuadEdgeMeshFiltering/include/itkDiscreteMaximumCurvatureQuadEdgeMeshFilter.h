@@ -78,8 +78,9 @@ protected:
   OutputCurvatureType
   EstimateCurvature(const OutputPointType & iP) override
   {
-    this->ComputeMeanAndGaussianCurvatures(iP);
-    return this->m_Mean + std::sqrt(this->ComputeDelta());
+    OutputCurvatureType mean, gaussian;
+    this->ComputeMeanAndGaussianCurvatures(iP, mean, gaussian);
+    return mean + std::sqrt(this->ComputeDelta(mean, gaussian));
   }
 };
 } // namespace itk
@@ -71,24 +71,25 @@ public:
 #endif
 
 protected:
-  DiscretePrincipalCurvaturesQuadEdgeMeshFilter()
-    : m_Gaussian(0.0)
-    , m_Mean(0.0)
-  {}
+  DiscretePrincipalCurvaturesQuadEdgeMeshFilter() = default;
   ~DiscretePrincipalCurvaturesQuadEdgeMeshFilter() override = default;
 
-  OutputCurvatureType m_Gaussian;
-  OutputCurvatureType m_Mean;
-
+  /** Compute the mean and Gaussian curvatures at the given point.
+   *
+   * The results are returned through the reference arguments instead of
+   * member data, so that EstimateCurvature() can be invoked concurrently
+   * from multiple work units. */
   void
-  ComputeMeanAndGaussianCurvatures(const OutputPointType & iP)
+  ComputeMeanAndGaussianCurvatures(const OutputPointType & iP,
+                                   OutputCurvatureType &   oMean,
+                                   OutputCurvatureType &   oGaussian)
   {
     OutputMeshPointer output = this->GetOutput();
 
     OutputQEType * qe = iP.GetEdge();
 
-    m_Mean = 0.;
-    m_Gaussian = 0.;
+    oMean = 0.;
+    oGaussian = 0.;
 
     if (qe != nullptr)
     {
@@ -140,17 +141,17 @@ protected:
         {
           area = 1. / area;
           Laplace *= 0.25 * area;
-          m_Mean = Laplace * normal;
-          m_Gaussian = (2. * itk::Math::pi - sum_theta) * area;
+          oMean = Laplace * normal;
+          oGaussian = (2. * itk::Math::pi - sum_theta) * area;
         }
       }
     }
   }
 
   virtual OutputCurvatureType
-  ComputeDelta()
+  ComputeDelta(const OutputCurvatureType & iMean, const OutputCurvatureType & iGaussian)
   {
-    return std::max(static_cast<OutputCurvatureType>(0.), m_Mean * m_Mean - m_Gaussian);
+    return std::max(static_cast<OutputCurvatureType>(0.), iMean * iMean - iGaussian);
   }
 };
 } // namespace itk
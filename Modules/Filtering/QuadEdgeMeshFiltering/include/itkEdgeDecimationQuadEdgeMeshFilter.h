@@ -103,6 +103,10 @@ protected:
    * \brief Compute the measure value for iEdge
    * \param[in] iEdge
    * \return measure value
+   *
+   * \note FillPriorityQueue() invokes this method concurrently from
+   * multiple work units, so overriding implementations may only read
+   * the output mesh and must not modify member data.
    */
   virtual MeasureType
   MeasureEdge(OutputQEType * iEdge) = 0;
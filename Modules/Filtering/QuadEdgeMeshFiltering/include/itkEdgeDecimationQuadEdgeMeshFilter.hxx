@@ -19,6 +19,8 @@
 #define itkEdgeDecimationQuadEdgeMeshFilter_hxx
 
 #include "itkEdgeDecimationQuadEdgeMeshFilter.h"
+#include "itkMultiThreaderBase.h"
+#include <vector>
 
 namespace itk
 {
@@ -64,16 +66,40 @@ EdgeDecimationQuadEdgeMeshFilter<TInput, TOutput, TCriterion>::FillPriorityQueue
   // cache for use in MeasureEdge
   this->m_OutputMesh = this->GetOutput();
 
+  // Snapshot the canonical half-edges, so that the measures can be
+  // computed in parallel regardless of the cells container type
+  std::vector<OutputQEType *> edgeArray;
+  edgeArray.reserve(output->GetEdgeCells()->Size());
   while (it != end)
   {
     edge = dynamic_cast<OutputEdgeCellType *>(it.Value());
 
     if (edge)
     {
-      PushElement(edge->GetQEGeom());
+      OutputQEType * qe = edge->GetQEGeom();
+      edgeArray.push_back((qe->GetOrigin() < qe->GetDestination()) ? qe : qe->GetSym());
     }
     ++it;
   }
+
+  // The measures only read the mesh at this point, so they can be
+  // evaluated concurrently; the queue items are allocated and pushed
+  // serially below in the original edge order, which keeps the queue
+  // identical to a serial fill
+  std::vector<MeasureType> measures(edgeArray.size());
+  this->GetMultiThreader()->ParallelizeArray(
+    0,
+    static_cast<SizeValueType>(edgeArray.size()),
+    [this, &edgeArray, &measures](SizeValueType i) { measures[i] = this->MeasureEdge(edgeArray[i]); },
+    this);
+
+  for (size_t i = 0; i < edgeArray.size(); ++i)
+  {
+    auto * qi = new PriorityQueueItemType(edgeArray[i], PriorityType(false, measures[i]));
+
+    m_QueueMapper[edgeArray[i]] = qi;
+    m_PriorityQueue->Push(qi);
+  }
 }
 
 template <typename TInput, typename TOutput, typename TCriterion>
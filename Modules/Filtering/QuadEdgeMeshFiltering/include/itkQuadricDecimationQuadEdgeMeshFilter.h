@@ -122,7 +122,15 @@ protected:
   {
     OutputPointIdentifier id_org = iEdge->GetOrigin();
     OutputPointIdentifier id_dest = iEdge->GetDestination();
-    QuadricElementType    Q = m_Quadric[id_org] + m_Quadric[id_dest];
+
+    // Initialize() has filled the quadric of every edge endpoint; look
+    // the quadrics up without operator[], which could otherwise insert
+    // into the map and is invoked concurrently during FillPriorityQueue()
+    const auto quadric_org = m_Quadric.find(id_org);
+    const auto quadric_dest = m_Quadric.find(id_dest);
+    itkAssertInDebugAndIgnoreInReleaseMacro(quadric_org != m_Quadric.end());
+    itkAssertInDebugAndIgnoreInReleaseMacro(quadric_dest != m_Quadric.end());
+    QuadricElementType Q = quadric_org->second + quadric_dest->second;
 
     OutputPointType org = this->m_OutputMesh->GetPoint(id_org);
     OutputPointType dest = this->m_OutputMesh->GetPoint(id_dest);
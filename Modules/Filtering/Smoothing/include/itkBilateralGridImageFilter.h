@@ -0,0 +1,142 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkBilateralGridImageFilter_h
+#define itkBilateralGridImageFilter_h
+
+#include "itkImageToImageFilter.h"
+#include "itkFixedArray.h"
+
+#include <vector>
+
+namespace itk
+{
+/**
+ * \class BilateralGridImageFilter
+ * \brief Approximate bilateral smoothing using a bilateral grid.
+ *
+ * This filter approximates the edge-preserving Gaussian smoothing of
+ * BilateralImageFilter by accumulating the image into a coarse grid
+ * over the joint domain-range space, blurring the grid, and reading
+ * the result back with multilinear interpolation (the splat / blur /
+ * slice decomposition of Chen, Paris and Durand, "Real-time
+ * edge-aware image processing with the bilateral grid", ACM
+ * SIGGRAPH 2007). The grid is sampled at one
+ * cell per sigma along each axis, so the amount of work in the blur
+ * is independent of the kernel size and the cost of the filter is
+ * dominated by the two bandwidth-bound passes over the image. For
+ * large domain sigmas this is orders of magnitude faster than the
+ * exact filter, at the price of a small intensity error (typically
+ * well below one percent of the range sigma).
+ *
+ * The parameters have the same meaning as in BilateralImageFilter:
+ * DomainSigma is specified in the units of the image spacing,
+ * RangeSigma in the units of intensity. Both stages of the algorithm
+ * run multi-threaded; the filter requires the complete input and
+ * therefore does not stream.
+ *
+ * \sa BilateralImageFilter
+ *
+ * \ingroup ImageEnhancement
+ * \ingroup ITKSmoothing
+ */
+template <typename TInputImage, typename TOutputImage>
+class ITK_TEMPLATE_EXPORT BilateralGridImageFilter : public ImageToImageFilter<TInputImage, TOutputImage>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(BilateralGridImageFilter);
+
+  /** Standard class type aliases. */
+  using Self = BilateralGridImageFilter;
+  using Superclass = ImageToImageFilter<TInputImage, TOutputImage>;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(BilateralGridImageFilter, ImageToImageFilter);
+
+  /** Image type information. */
+  using InputImageType = TInputImage;
+  using OutputImageType = TOutputImage;
+
+  using InputPixelType = typename TInputImage::PixelType;
+  using OutputPixelType = typename TOutputImage::PixelType;
+  using InputRealType = typename NumericTraits<InputPixelType>::RealType;
+
+  using RegionType = typename TInputImage::RegionType;
+  using SizeType = typename TInputImage::SizeType;
+  using IndexType = typename TInputImage::IndexType;
+
+  /** Extract some information from the image types.  Dimensionality
+   * of the two images is assumed to be the same. */
+  static constexpr unsigned int ImageDimension = TOutputImage::ImageDimension;
+
+  /** Typedef of double containers */
+  using ArrayType = FixedArray<double, Self::ImageDimension>;
+
+  /** Standard get/set macros for filter parameters.
+   * DomainSigma is specified in the same units as the Image spacing.
+   * RangeSigma is specified in the units of intensity. */
+  itkSetMacro(DomainSigma, ArrayType);
+  itkGetConstMacro(DomainSigma, const ArrayType);
+  itkSetMacro(RangeSigma, double);
+  itkGetConstMacro(RangeSigma, double);
+
+  /** Convenience get/set methods for setting all domain parameters to the
+   * same values.  */
+  void
+  SetDomainSigma(const double v)
+  {
+    m_DomainSigma.Fill(v);
+  }
+
+#ifdef ITK_USE_CONCEPT_CHECKING
+  // Begin concept checking
+  itkConceptMacro(OutputHasNumericTraitsCheck, (Concept::HasNumericTraits<OutputPixelType>));
+  // End concept checking
+#endif
+
+protected:
+  BilateralGridImageFilter() = default;
+  ~BilateralGridImageFilter() override = default;
+
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+  /** The grid is built from the complete input, so the filter
+   * requires the largest possible region of its input. */
+  void
+  GenerateInputRequestedRegion() override;
+
+  /** Splat, blur and slice; each stage is internally parallelized. */
+  void
+  GenerateData() override;
+
+private:
+  ArrayType m_DomainSigma{ 4.0 };
+  double    m_RangeSigma{ 50.0 };
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkBilateralGridImageFilter.hxx"
+#endif
+
+#endif
@@ -0,0 +1,290 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkBilateralGridImageFilter_hxx
+#define itkBilateralGridImageFilter_hxx
+
+#include "itkBilateralGridImageFilter.h"
+
+#include "itkImageAlgorithm.h"
+#include "itkImageRegionIterator.h"
+#include "itkImageScanlineIterator.h"
+#include "itkProgressTransformer.h"
+
+#include <cmath>
+#include <mutex>
+
+namespace itk
+{
+
+template <typename TInputImage, typename TOutputImage>
+void
+BilateralGridImageFilter<TInputImage, TOutputImage>::GenerateInputRequestedRegion()
+{
+  Superclass::GenerateInputRequestedRegion();
+
+  auto * input = const_cast<InputImageType *>(this->GetInput());
+  if (input != nullptr)
+  {
+    input->SetRequestedRegionToLargestPossibleRegion();
+  }
+}
+
+template <typename TInputImage, typename TOutputImage>
+void
+BilateralGridImageFilter<TInputImage, TOutputImage>::GenerateData()
+{
+  this->AllocateOutputs();
+
+  const InputImageType * input = this->GetInput();
+  OutputImageType *      output = this->GetOutput();
+
+  if (m_RangeSigma <= 0.0)
+  {
+    itkExceptionMacro("RangeSigma must be positive, is " << m_RangeSigma);
+  }
+
+  const RegionType region = input->GetBufferedRegion();
+  const SizeType   size = region.GetSize();
+  const IndexType  regionIndex = region.GetIndex();
+
+  // Find the intensity range of the input.
+  double minimum = NumericTraits<double>::max();
+  double maximum = NumericTraits<double>::NonpositiveMin();
+  {
+    ImageScanlineConstIterator<InputImageType> it(input, region);
+    while (!it.IsAtEnd())
+    {
+      while (!it.IsAtEndOfLine())
+      {
+        const auto value = static_cast<double>(it.Get());
+        minimum = std::min(minimum, value);
+        maximum = std::max(maximum, value);
+        ++it;
+      }
+      it.NextLine();
+    }
+  }
+
+  if (maximum <= minimum)
+  {
+    // A constant image is unchanged by bilateral smoothing.
+    ImageAlgorithm::Copy(input, output, output->GetRequestedRegion(), output->GetRequestedRegion());
+    return;
+  }
+
+  // Grid geometry: one cell per sigma along each image axis and along
+  // the range axis, with one cell of padding on every side so that the
+  // blur and the interpolation never read outside of the grid. The
+  // range axis is innermost (stride one).
+  const typename InputImageType::SpacingType & spacing = input->GetSpacing();
+
+  double        cellSize[ImageDimension];
+  SizeValueType gridSize[ImageDimension];
+  for (unsigned int d = 0; d < ImageDimension; ++d)
+  {
+    cellSize[d] = std::max(1.0, m_DomainSigma[d] / static_cast<double>(spacing[d]));
+    gridSize[d] = static_cast<SizeValueType>(static_cast<double>(size[d] - 1) / cellSize[d]) + 3;
+  }
+  const double        rangeScale = 1.0 / m_RangeSigma;
+  const SizeValueType rangeBins = static_cast<SizeValueType>((maximum - minimum) * rangeScale) + 3;
+
+  SizeValueType strides[ImageDimension];
+  strides[0] = rangeBins;
+  for (unsigned int d = 1; d < ImageDimension; ++d)
+  {
+    strides[d] = strides[d - 1] * gridSize[d - 1];
+  }
+  const SizeValueType gridCount = strides[ImageDimension - 1] * gridSize[ImageDimension - 1];
+
+  std::vector<double> gridValue(gridCount, 0.0);
+  std::vector<double> gridWeight(gridCount, 0.0);
+
+  // Splat: accumulate each pixel into its nearest grid cell. Each
+  // thread fills a private grid that is merged under a mutex.
+  std::mutex          mutex;
+  ProgressTransformer splatProgress(0.0f, 0.45f, this);
+  this->GetMultiThreader()->template ParallelizeImageRegion<ImageDimension>(
+    region,
+    [&](const RegionType & splatRegion) {
+      std::vector<double> localValue(gridCount, 0.0);
+      std::vector<double> localWeight(gridCount, 0.0);
+
+      ImageScanlineConstIterator<InputImageType> it(input, splatRegion);
+      while (!it.IsAtEnd())
+      {
+        const IndexType lineIndex = it.GetIndex();
+        SizeValueType   base = 0;
+        for (unsigned int d = 1; d < ImageDimension; ++d)
+        {
+          const auto gridCoordinate =
+            static_cast<SizeValueType>(std::lround((lineIndex[d] - regionIndex[d]) / cellSize[d])) + 1;
+          base += gridCoordinate * strides[d];
+        }
+        double x = static_cast<double>(lineIndex[0] - regionIndex[0]);
+        while (!it.IsAtEndOfLine())
+        {
+          const auto value = static_cast<double>(it.Get());
+          const auto xGrid = static_cast<SizeValueType>(std::lround(x / cellSize[0])) + 1;
+          const auto zGrid = static_cast<SizeValueType>(std::lround((value - minimum) * rangeScale)) + 1;
+          const SizeValueType cell = base + xGrid * strides[0] + zGrid;
+          localValue[cell] += value;
+          localWeight[cell] += 1.0;
+          x += 1.0;
+          ++it;
+        }
+        it.NextLine();
+      }
+
+      const std::lock_guard<std::mutex> lockGuard(mutex);
+      for (SizeValueType i = 0; i < gridCount; ++i)
+      {
+        gridValue[i] += localValue[i];
+        gridWeight[i] += localWeight[i];
+      }
+    },
+    splatProgress.GetProcessObject());
+
+  // Blur: one 1-2-1 pass along every grid axis, including the range
+  // axis; with one cell per sigma this approximates the Gaussian.
+  {
+    std::vector<double> scratchValue(gridCount);
+    std::vector<double> scratchWeight(gridCount);
+
+    const auto blurPass = [this, gridCount](const std::vector<double> & sourceValue,
+                                            const std::vector<double> & sourceWeight,
+                                            std::vector<double> &       destinationValue,
+                                            std::vector<double> &       destinationWeight,
+                                            SizeValueType               stride,
+                                            SizeValueType               axisSize) {
+      this->GetMultiThreader()->ParallelizeArray(
+        0,
+        gridCount,
+        [&](SizeValueType i) {
+          const SizeValueType coordinate = (i / stride) % axisSize;
+          double              value = 2.0 * sourceValue[i];
+          double              weight = 2.0 * sourceWeight[i];
+          if (coordinate > 0)
+          {
+            value += sourceValue[i - stride];
+            weight += sourceWeight[i - stride];
+          }
+          if (coordinate + 1 < axisSize)
+          {
+            value += sourceValue[i + stride];
+            weight += sourceWeight[i + stride];
+          }
+          destinationValue[i] = 0.25 * value;
+          destinationWeight[i] = 0.25 * weight;
+        },
+        nullptr);
+    };
+
+    blurPass(gridValue, gridWeight, scratchValue, scratchWeight, 1, rangeBins);
+    gridValue.swap(scratchValue);
+    gridWeight.swap(scratchWeight);
+    for (unsigned int d = 0; d < ImageDimension; ++d)
+    {
+      blurPass(gridValue, gridWeight, scratchValue, scratchWeight, strides[d], gridSize[d]);
+      gridValue.swap(scratchValue);
+      gridWeight.swap(scratchWeight);
+    }
+  }
+  this->UpdateProgress(0.5f);
+
+  // Slice: read the smoothed result back with multilinear
+  // interpolation over the 2^(ImageDimension+1) surrounding cells.
+  ProgressTransformer sliceProgress(0.5f, 0.99f, this);
+  this->GetMultiThreader()->template ParallelizeImageRegion<ImageDimension>(
+    output->GetRequestedRegion(),
+    [&](const RegionType & sliceRegion) {
+      constexpr unsigned int cornerCount = 1u << (ImageDimension + 1);
+
+      ImageScanlineConstIterator<InputImageType> inputIt(input, sliceRegion);
+      ImageScanlineIterator<OutputImageType>     outputIt(output, sliceRegion);
+      while (!inputIt.IsAtEnd())
+      {
+        const IndexType lineIndex = inputIt.GetIndex();
+        double          continuous[ImageDimension + 1];
+        for (unsigned int d = 1; d < ImageDimension; ++d)
+        {
+          continuous[d] = (lineIndex[d] - regionIndex[d]) / cellSize[d] + 1.0;
+        }
+        double x = static_cast<double>(lineIndex[0] - regionIndex[0]);
+        while (!inputIt.IsAtEndOfLine())
+        {
+          const auto value = static_cast<double>(inputIt.Get());
+          continuous[0] = x / cellSize[0] + 1.0;
+          continuous[ImageDimension] = (value - minimum) * rangeScale + 1.0;
+
+          SizeValueType lowerCell[ImageDimension + 1];
+          double        fraction[ImageDimension + 1];
+          for (unsigned int d = 0; d <= ImageDimension; ++d)
+          {
+            const double floorValue = std::floor(continuous[d]);
+            lowerCell[d] = static_cast<SizeValueType>(floorValue);
+            fraction[d] = continuous[d] - floorValue;
+          }
+
+          double interpolatedValue = 0.0;
+          double interpolatedWeight = 0.0;
+          for (unsigned int corner = 0; corner < cornerCount; ++corner)
+          {
+            double        cornerWeight = 1.0;
+            SizeValueType cell = 0;
+            for (unsigned int d = 0; d < ImageDimension; ++d)
+            {
+              const SizeValueType offset = (corner >> d) & 1u;
+              cornerWeight *= offset ? fraction[d] : 1.0 - fraction[d];
+              cell += (lowerCell[d] + offset) * strides[d];
+            }
+            const SizeValueType rangeOffset = (corner >> ImageDimension) & 1u;
+            cornerWeight *= rangeOffset ? fraction[ImageDimension] : 1.0 - fraction[ImageDimension];
+            cell += lowerCell[ImageDimension] + rangeOffset;
+
+            interpolatedValue += cornerWeight * gridValue[cell];
+            interpolatedWeight += cornerWeight * gridWeight[cell];
+          }
+
+          outputIt.Set(interpolatedWeight > 0.0 ? static_cast<OutputPixelType>(interpolatedValue / interpolatedWeight)
+                                                : static_cast<OutputPixelType>(value));
+          x += 1.0;
+          ++inputIt;
+          ++outputIt;
+        }
+        inputIt.NextLine();
+        outputIt.NextLine();
+      }
+    },
+    sliceProgress.GetProcessObject());
+
+  this->UpdateProgress(1.0f);
+}
+
+template <typename TInputImage, typename TOutputImage>
+void
+BilateralGridImageFilter<TInputImage, TOutputImage>::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "DomainSigma: " << m_DomainSigma << std::endl;
+  os << indent << "RangeSigma: " << m_RangeSigma << std::endl;
+}
+
+} // end namespace itk
+
+#endif
@@ -82,9 +82,10 @@ protected:
   BoxMeanImageFilter();
   ~BoxMeanImageFilter() override = default;
 
-  /** Multi-thread version GenerateData. */
+  /** Builds the shared summed area table, then evaluates the box means in
+   * parallel tiles. */
   void
-  DynamicThreadedGenerateData(const OutputImageRegionType & outputRegionForThread) override;
+  GenerateData() override;
 
 }; // end of class
 } // end namespace itk
@@ -21,6 +21,7 @@
 #include "itkBoxMeanImageFilter.h"
 #include "itkProgressAccumulator.h"
 #include "itkBoxUtilities.h"
+#include "itkSummedAreaTableImageFilter.h"
 
 
 /*
@@ -35,16 +36,14 @@
 namespace itk
 {
 template <typename TInputImage, typename TOutputImage>
-BoxMeanImageFilter<TInputImage, TOutputImage>::BoxMeanImageFilter()
-{
-  this->DynamicMultiThreadingOn();
-}
+BoxMeanImageFilter<TInputImage, TOutputImage>::BoxMeanImageFilter() = default;
 
 template <typename TInputImage, typename TOutputImage>
 void
-BoxMeanImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(
-  const OutputImageRegionType & outputRegionForThread)
+BoxMeanImageFilter<TInputImage, TOutputImage>::GenerateData()
 {
+  this->AllocateOutputs();
+
   // Accumulate type is too small
   using AccPixType = typename NumericTraits<PixelType>::RealType;
   using AccumImageType = Image<AccPixType, TInputImage::ImageDimension>;
@@ -57,40 +56,43 @@ BoxMeanImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(
 
   const InputImageType * inputImage = this->GetInput();
   OutputImageType *      outputImage = this->GetOutput();
-  RegionType             accumRegion = outputRegionForThread;
+  const RegionType       outputRegion = outputImage->GetRequestedRegion();
+  RegionType             accumRegion = outputRegion;
   accumRegion.PadByRadius(internalRadius);
   accumRegion.Crop(inputImage->GetRequestedRegion());
 
-  auto accImage = AccumImageType::New();
-  accImage->SetRegions(accumRegion);
-  accImage->Allocate();
+  // Build one shared summed area table over the padded output region,
+  // instead of one accumulator image per work unit
+  using AccumulatorFilterType = SummedAreaTableImageFilter<TInputImage, AccumImageType>;
+  auto accumulatorFilter = AccumulatorFilterType::New();
+  accumulatorFilter->SetInput(inputImage);
+  accumulatorFilter->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+  accumulatorFilter->GetOutput()->SetRequestedRegion(accumRegion);
+  accumulatorFilter->Update();
+  const typename AccumImageType::Pointer accImage = accumulatorFilter->GetOutput();
 
+  // Evaluate the means in parallel tiles against the shared table
+  const SizeType radius = this->GetRadius();
+  this->GetMultiThreader()->template ParallelizeImageRegion<OutputImageDimension>(
+    outputRegion,
+    [this, accImage, outputImage, accumRegion, radius](const RegionType & region) {
 #if defined(ITKV4_COMPATIBILITY)
-  // Dummy reporter for compatibility
-  ProgressReporter progress(this, 1, 2 * accumRegion.GetNumberOfPixels());
-#endif
-
-  BoxAccumulateFunction<TInputImage, AccumImageType>(inputImage,
-                                                     accImage,
-                                                     accumRegion,
-                                                     accumRegion
-#if defined(ITKV4_COMPATIBILITY)
-                                                     ,
-                                                     progress);
-#else
-  );
+      // Dummy reporter for compatibility
+      ProgressReporter progress(this, 1, region.GetNumberOfPixels());
 #endif
-  BoxMeanCalculatorFunction<AccumImageType, TOutputImage>(accImage.GetPointer(),
-                                                          outputImage,
-                                                          accumRegion,
-                                                          outputRegionForThread,
-                                                          this->GetRadius()
+      BoxMeanCalculatorFunction<AccumImageType, TOutputImage>(accImage.GetPointer(),
+                                                              outputImage,
+                                                              accumRegion,
+                                                              region,
+                                                              radius
 #if defined(ITKV4_COMPATIBILITY)
-                                                            ,
-                                                          progress);
+                                                                ,
+                                                              progress);
 #else
-  );
+      );
 #endif
+    },
+    nullptr);
 }
 } // end namespace itk
 #endif
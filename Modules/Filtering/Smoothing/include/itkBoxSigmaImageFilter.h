@@ -80,9 +80,10 @@ protected:
   BoxSigmaImageFilter();
   ~BoxSigmaImageFilter() override = default;
 
-  /** Multi-thread version GenerateData. */
+  /** Builds the shared joint summed area table of sums and sums of squares,
+   * then evaluates the sigmas in parallel tiles. */
   void
-  DynamicThreadedGenerateData(const OutputImageRegionType & outputRegionForThread) override;
+  GenerateData() override;
 
 }; // end of class
 } // end namespace itk
@@ -22,6 +22,8 @@
 #include "itkProgressAccumulator.h"
 #include "itkNumericTraits.h"
 #include "itkBoxUtilities.h"
+#include "itkImageScanlineIterator.h"
+#include "itkSummedAreaTableImageFilter.h"
 
 
 /*
@@ -36,16 +38,14 @@
 namespace itk
 {
 template <typename TInputImage, typename TOutputImage>
-BoxSigmaImageFilter<TInputImage, TOutputImage>::BoxSigmaImageFilter()
-{
-  this->DynamicMultiThreadingOn();
-}
+BoxSigmaImageFilter<TInputImage, TOutputImage>::BoxSigmaImageFilter() = default;
 
 template <typename TInputImage, typename TOutputImage>
 void
-BoxSigmaImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(
-  const OutputImageRegionType & outputRegionForThread)
+BoxSigmaImageFilter<TInputImage, TOutputImage>::GenerateData()
 {
+  this->AllocateOutputs();
+
   // Accumulate type is too small
   using AccValueType = typename itk::NumericTraits<PixelType>::RealType;
   using AccPixType = typename itk::Vector<AccValueType, 2>;
@@ -59,40 +59,66 @@ BoxSigmaImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(
 
   const InputImageType * inputImage = this->GetInput();
   OutputImageType *      outputImage = this->GetOutput();
-  RegionType             accumRegion = outputRegionForThread;
+  const RegionType       outputRegion = outputImage->GetRequestedRegion();
+  RegionType             accumRegion = outputRegion;
   accumRegion.PadByRadius(internalRadius);
   accumRegion.Crop(inputImage->GetRequestedRegion());
 
+  // One shared accumulator image over the padded output region, instead of
+  // one per work unit
   auto accImage = AccumImageType::New();
   accImage->SetRegions(accumRegion);
   accImage->Allocate();
 
-#if defined(ITKV4_COMPATIBILITY)
-  // Dummy reporter for compatibility
-  ProgressReporter progress(this, 1, 2 * accumRegion.GetNumberOfPixels());
-#endif
+  // Fill the accumulator with (value, value^2) pairs, then turn it into a
+  // joint summed area table of sums and sums of squares in a single sweep
+  this->GetMultiThreader()->template ParallelizeImageRegion<OutputImageDimension>(
+    accumRegion,
+    [inputImage, &accImage](const RegionType & region) {
+      ImageScanlineConstIterator<TInputImage>    inIt(inputImage, region);
+      ImageScanlineIterator<AccumImageType>      accIt(accImage, region);
+      while (!accIt.IsAtEnd())
+      {
+        while (!accIt.IsAtEndOfLine())
+        {
+          const auto value = static_cast<AccValueType>(inIt.Get());
+          AccPixType accPixel;
+          accPixel[0] = value;
+          accPixel[1] = value * value;
+          accIt.Set(accPixel);
+          ++inIt;
+          ++accIt;
+        }
+        inIt.NextLine();
+        accIt.NextLine();
+      }
+    },
+    nullptr);
+
+  SummedAreaTableInPlaceAccumulateFunction(accImage.GetPointer(), accumRegion, this->GetMultiThreader());
 
-  BoxSquareAccumulateFunction<TInputImage, AccumImageType>(inputImage,
-                                                           accImage,
-                                                           accumRegion,
-                                                           accumRegion
+  // Evaluate the sigmas in parallel tiles against the shared table
+  const SizeType radius = this->GetRadius();
+  this->GetMultiThreader()->template ParallelizeImageRegion<OutputImageDimension>(
+    outputRegion,
+    [this, accImage, outputImage, accumRegion, radius](const RegionType & region) {
 #if defined(ITKV4_COMPATIBILITY)
-                                                           ,
-                                                           progress);
-#else
-  );
+      // Dummy reporter for compatibility
+      ProgressReporter progress(this, 1, region.GetNumberOfPixels());
 #endif
-  BoxSigmaCalculatorFunction<AccumImageType, TOutputImage>(accImage,
-                                                           outputImage,
-                                                           accumRegion,
-                                                           outputRegionForThread,
-                                                           this->GetRadius()
+      BoxSigmaCalculatorFunction<AccumImageType, TOutputImage>(accImage.GetPointer(),
+                                                               outputImage,
+                                                               accumRegion,
+                                                               region,
+                                                               radius
 #if defined(ITKV4_COMPATIBILITY)
-                                                             ,
-                                                           progress);
+                                                                 ,
+                                                               progress);
 #else
-  );
+      );
 #endif
+    },
+    nullptr);
 }
 } // end namespace itk
 #endif
@@ -287,11 +287,14 @@ public:
    *
    * The default value is $ImageDimension^2$.
    *
-   * This parameter was introduced to reduce the memory used by images
-   * internally, at the cost of performance.
+   * Streaming pulls each piece through every separable convolution
+   * pass before the next piece starts, so the real-typed intermediate
+   * images only exist at piece size instead of being materialized as
+   * full volumes between passes. Set to 1 to disable the internal
+   * streaming and run each pass over the whole image.
    */
-  itkLegacyMacro(unsigned int GetInternalNumberOfStreamDivisions() const);
-  itkLegacyMacro(void SetInternalNumberOfStreamDivisions(unsigned int));
+  itkSetMacro(InternalNumberOfStreamDivisions, unsigned int);
+  itkGetConstMacro(InternalNumberOfStreamDivisions, unsigned int);
 
   /** DiscreteGaussianImageFilter needs a larger input requested region
    * than the output requested region (larger by the size of the
@@ -320,6 +323,7 @@ protected:
     m_FilterDimensionality = ImageDimension;
     m_InputBoundaryCondition = &m_InputDefaultBoundaryCondition;
     m_RealBoundaryCondition = &m_RealDefaultBoundaryCondition;
+    m_InternalNumberOfStreamDivisions = ImageDimension * ImageDimension;
   }
 
   ~DiscreteGaussianImageFilter() override = default;
@@ -366,6 +370,10 @@ private:
 
   /** Default boundary condition use for the intermediate filters */
   RealDefaultBoundaryConditionType m_RealDefaultBoundaryCondition;
+
+  /** Number of pieces to divide the input on the internal composite
+      pipeline. The upstream pipeline will not be effected. */
+  unsigned int m_InternalNumberOfStreamDivisions;
 };
 } // end namespace itk
 
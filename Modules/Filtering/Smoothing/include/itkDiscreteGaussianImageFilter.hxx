@@ -23,6 +23,7 @@
 #include "itkGaussianOperator.h"
 #include "itkImageRegionIterator.h"
 #include "itkProgressAccumulator.h"
+#include "itkStreamingImageFilter.h"
 #include "itkImageAlgorithm.h"
 
 namespace itk
@@ -154,11 +155,13 @@ DiscreteGaussianImageFilter<TInputImage, TOutputImage>::GenerateData()
   using LastFilterType =
     NeighborhoodOperatorImageFilter<RealOutputImageType, OutputImageType, RealOutputPixelValueType>;
   using SingleFilterType = NeighborhoodOperatorImageFilter<InputImageType, OutputImageType, RealOutputPixelValueType>;
+  using StreamingFilterType = StreamingImageFilter<OutputImageType, OutputImageType>;
 
   using FirstFilterPointer = typename FirstFilterType::Pointer;
   using IntermediateFilterPointer = typename IntermediateFilterType::Pointer;
   using LastFilterPointer = typename LastFilterType::Pointer;
   using SingleFilterPointer = typename SingleFilterType::Pointer;
+  using StreamingFilterPointer = typename StreamingFilterType::Pointer;
 
   // Create a series of operators
   using OperatorType = GaussianOperator<RealOutputPixelValueType, ImageDimension>;
@@ -234,7 +237,7 @@ DiscreteGaussianImageFilter<TInputImage, TOutputImage>::GenerateData()
   {
     // Setup a full mini-pipeline and stream the data through the
     // pipeline.
-    const unsigned int numberOfStages = filterDimensionality;
+    const unsigned int numberOfStages = filterDimensionality + 1;
 
     // First filter convolves and changes type from input type to real type
     FirstFilterPointer firstFilter = FirstFilterType::New();
@@ -285,13 +288,23 @@ DiscreteGaussianImageFilter<TInputImage, TOutputImage>::GenerateData()
     }
     progress->RegisterInternalFilter(lastFilter, 1.0f / numberOfStages);
 
+    // Put in a StreamingImageFilter so the mini-pipeline is processed
+    // in chunks. Each chunk is pulled through every convolution pass
+    // before the next one starts, so the real-typed intermediate
+    // images only ever exist at chunk size and stay cache resident
+    // instead of being written out as full volumes between passes.
+    StreamingFilterPointer streamingFilter = StreamingFilterType::New();
+    streamingFilter->SetInput(lastFilter->GetOutput());
+    streamingFilter->SetNumberOfStreamDivisions(this->GetInternalNumberOfStreamDivisions());
+    progress->RegisterInternalFilter(streamingFilter, 1.0f / numberOfStages);
+
     // Graft this filters output onto the mini-pipeline so the mini-pipeline
     // has the correct region ivars and will write to this filters bulk data
     // output.
-    lastFilter->GraftOutput(output);
+    streamingFilter->GraftOutput(output);
 
     // Update the last filter in the chain
-    lastFilter->Update();
+    streamingFilter->Update();
 
     // Graft the last output of the mini-pipeline onto this filters output so
     // the final output has the correct region ivars and a handle to the final
@@ -300,24 +313,6 @@ DiscreteGaussianImageFilter<TInputImage, TOutputImage>::GenerateData()
   }
 }
 
-#if !defined(ITK_LEGACY_REMOVE)
-template <typename TInputImage, typename TOutputImage>
-unsigned int
-DiscreteGaussianImageFilter<TInputImage, TOutputImage>::GetInternalNumberOfStreamDivisions() const
-{
-  return 1;
-}
-
-template <typename TInputImage, typename TOutputImage>
-void
-DiscreteGaussianImageFilter<TInputImage, TOutputImage>::SetInternalNumberOfStreamDivisions(unsigned int)
-{
-#  if !defined(ITK_LEGACY_SILENT)
-  itkWarningMacro("SetInternalNumberOfStreamDivisions has been removed as the filter no longer internally streams!");
-#  endif
-}
-#endif
-
 template <typename TInputImage, typename TOutputImage>
 void
 DiscreteGaussianImageFilter<TInputImage, TOutputImage>::PrintSelf(std::ostream & os, Indent indent) const
@@ -329,6 +324,7 @@ DiscreteGaussianImageFilter<TInputImage, TOutputImage>::PrintSelf(std::ostream &
   os << indent << "MaximumKernelWidth: " << m_MaximumKernelWidth << std::endl;
   os << indent << "FilterDimensionality: " << m_FilterDimensionality << std::endl;
   os << indent << "UseImageSpacing: " << m_UseImageSpacing << std::endl;
+  os << indent << "InternalNumberOfStreamDivisions: " << m_InternalNumberOfStreamDivisions << std::endl;
   os << indent << "RealBoundaryCondition: " << m_RealBoundaryCondition << std::endl;
 }
 } // end namespace itk
@@ -21,8 +21,12 @@
 #include "itkBoxImageFilter.h"
 #include "itkImage.h"
 
+#include <type_traits>
+
 namespace itk
 {
+class TotalProgressReporter;
+
 /**
  *\class MedianImageFilter
  * \brief Applies a median filter to an image
@@ -108,6 +112,34 @@ protected:
    *     ImageToImageFilter::GenerateData() */
   void
   DynamicThreadedGenerateData(const OutputImageRegionType & outputRegionForThread) override;
+
+private:
+  /** Small integer pixel types are processed with a sliding two-level
+   * histogram over the interior region: moving the box one pixel along
+   * the fastest axis subtracts the trailing hyperplane of the
+   * neighborhood from the histogram and adds the leading one, so the
+   * per-pixel cost is proportional to a face of the box instead of its
+   * volume. Other pixel types use per-pixel selection. */
+  using HistogramMedianEnabledType = std::integral_constant<bool,
+                                                            std::is_integral<InputPixelType>::value &&
+                                                              !std::is_same<InputPixelType, bool>::value &&
+                                                              sizeof(InputPixelType) <= 2>;
+
+  /** Sliding-histogram median over the interior (non-boundary) region.
+   * A member template so that explicit instantiation of the class does
+   * not instantiate the histogram body for pixel types where it is
+   * never called and would not compile. */
+  template <typename TPixel = InputPixelType>
+  void
+  GenerateDataInInteriorRegion(const OutputImageRegionType & interiorRegion,
+                               TotalProgressReporter &       progress,
+                               std::true_type);
+
+  /** Per-pixel selection median over the interior (non-boundary) region. */
+  void
+  GenerateDataInInteriorRegion(const OutputImageRegionType & interiorRegion,
+                               TotalProgressReporter &       progress,
+                               std::false_type);
 };
 } // end namespace itk
 
@@ -28,8 +28,9 @@
 #include "itkShapedImageNeighborhoodRange.h"
 #include "itkTotalProgressReporter.h"
 
-#include <vector>
 #include <algorithm>
+#include <cstdint>
+#include <vector>
 
 namespace itk
 {
@@ -69,21 +70,7 @@ MedianImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(
   const auto nonBoundaryRegion = calculatorResult.GetNonBoundaryRegion();
   if (!nonBoundaryRegion.GetSize().empty())
   {
-    // Process the non-boundary subregion, using a faster pixel access policy without boundary extrapolation.
-    auto neighborhoodRange =
-      ShapedImageNeighborhoodRange<const InputImageType, BufferedImageNeighborhoodPixelAccessPolicy<InputImageType>>(
-        *input, Index<InputImageDimension>(), neighborhoodOffsets);
-    auto outputIterator = ImageRegionRange<OutputImageType>(*output, nonBoundaryRegion).begin();
-
-    for (const auto & index : ImageRegionIndexRange<InputImageDimension>(nonBoundaryRegion))
-    {
-      neighborhoodRange.SetLocation(index);
-      std::copy_n(neighborhoodRange.cbegin(), neighborhoodSize, pixels.begin());
-      std::nth_element(pixels.begin(), medianIterator, pixels.end());
-      *outputIterator = *medianIterator;
-      ++outputIterator;
-      progress.CompletedPixel();
-    }
+    this->GenerateDataInInteriorRegion(nonBoundaryRegion, progress, HistogramMedianEnabledType());
   }
 
   // Process each of the boundary faces.  These are N-d regions which border
@@ -105,6 +92,169 @@ MedianImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(
     }
   }
 }
+
+template <typename TInputImage, typename TOutputImage>
+void
+MedianImageFilter<TInputImage, TOutputImage>::GenerateDataInInteriorRegion(const OutputImageRegionType & interiorRegion,
+                                                                           TotalProgressReporter &       progress,
+                                                                           std::false_type)
+{
+  OutputImageType *      output = this->GetOutput();
+  const InputImageType * input = this->GetInput();
+
+  const auto radius = this->GetRadius();
+  const auto neighborhoodOffsets = GenerateRectangularImageNeighborhoodOffsets<InputImageDimension>(radius);
+  const auto neighborhoodSize = neighborhoodOffsets.size();
+
+  std::vector<InputPixelType> pixels(neighborhoodSize);
+  const auto                  medianIterator = pixels.begin() + (neighborhoodSize / 2);
+
+  // Process the non-boundary subregion, using a faster pixel access policy without boundary extrapolation.
+  auto neighborhoodRange =
+    ShapedImageNeighborhoodRange<const InputImageType, BufferedImageNeighborhoodPixelAccessPolicy<InputImageType>>(
+      *input, Index<InputImageDimension>(), neighborhoodOffsets);
+  auto outputIterator = ImageRegionRange<OutputImageType>(*output, interiorRegion).begin();
+
+  for (const auto & index : ImageRegionIndexRange<InputImageDimension>(interiorRegion))
+  {
+    neighborhoodRange.SetLocation(index);
+    std::copy_n(neighborhoodRange.cbegin(), neighborhoodSize, pixels.begin());
+    std::nth_element(pixels.begin(), medianIterator, pixels.end());
+    *outputIterator = *medianIterator;
+    ++outputIterator;
+    progress.CompletedPixel();
+  }
+}
+
+template <typename TInputImage, typename TOutputImage>
+template <typename TPixel>
+void
+MedianImageFilter<TInputImage, TOutputImage>::GenerateDataInInteriorRegion(const OutputImageRegionType & interiorRegion,
+                                                                           TotalProgressReporter &       progress,
+                                                                           std::true_type)
+{
+  OutputImageType *      output = this->GetOutput();
+  const InputImageType * input = this->GetInput();
+
+  const auto radius = this->GetRadius();
+  const auto neighborhoodOffsets = GenerateRectangularImageNeighborhoodOffsets<InputImageDimension>(radius);
+  const auto neighborhoodSize = neighborhoodOffsets.size();
+
+  // The trailing and leading hyperplanes of the box: sliding the box
+  // one pixel along the fastest axis removes the former from the
+  // histogram and adds the latter.
+  std::vector<Offset<InputImageDimension>> trailingOffsets;
+  std::vector<Offset<InputImageDimension>> leadingOffsets;
+  for (const auto & offset : neighborhoodOffsets)
+  {
+    if (offset[0] == -static_cast<OffsetValueType>(radius[0]))
+    {
+      trailingOffsets.push_back(offset);
+    }
+    if (offset[0] == static_cast<OffsetValueType>(radius[0]))
+    {
+      leadingOffsets.push_back(offset);
+    }
+  }
+
+  // Bins are the pixel values shifted to an unsigned range; a second
+  // level of buckets keeps the median search short. The counters are
+  // plain contiguous arrays so the per-hyperplane updates and the
+  // bucket scans compile to straight, vectorizable loops.
+  using UnsignedPixelType = typename std::make_unsigned<InputPixelType>::type;
+  constexpr std::size_t  binCount = std::size_t{ 1 } << (8 * sizeof(InputPixelType));
+  constexpr unsigned int bucketShift = (sizeof(InputPixelType) == 1) ? 4 : 8;
+  constexpr std::size_t  bucketCount = binCount >> bucketShift;
+  constexpr auto         signFlip =
+    static_cast<UnsignedPixelType>(std::is_signed<InputPixelType>::value
+                                     ? UnsignedPixelType{ 1 } << (8 * sizeof(InputPixelType) - 1)
+                                     : UnsignedPixelType{ 0 });
+
+  std::vector<std::uint32_t> fineHistogram(binCount, 0);
+  std::vector<std::uint32_t> bucketHistogram(bucketCount, 0);
+
+  const auto medianRank = static_cast<std::uint32_t>(neighborhoodSize / 2);
+
+  using NeighborhoodRangeType =
+    ShapedImageNeighborhoodRange<const InputImageType, BufferedImageNeighborhoodPixelAccessPolicy<InputImageType>>;
+  NeighborhoodRangeType boxRange(*input, Index<InputImageDimension>(), neighborhoodOffsets);
+  NeighborhoodRangeType trailingRange(*input, Index<InputImageDimension>(), trailingOffsets);
+  NeighborhoodRangeType leadingRange(*input, Index<InputImageDimension>(), leadingOffsets);
+
+  auto outputIterator = ImageRegionRange<OutputImageType>(*output, interiorRegion).begin();
+
+  OutputImageRegionType rowRegion = interiorRegion;
+  rowRegion.SetSize(0, 1);
+  const SizeValueType rowLength = interiorRegion.GetSize(0);
+
+  for (const auto & rowIndex : ImageRegionIndexRange<InputImageDimension>(rowRegion))
+  {
+    auto index = rowIndex;
+
+    // Build the histogram of the full box at the start of the row.
+    boxRange.SetLocation(index);
+    for (const InputPixelType pixel : boxRange)
+    {
+      const auto bin = static_cast<UnsignedPixelType>(static_cast<UnsignedPixelType>(pixel) ^ signFlip);
+      ++fineHistogram[bin];
+      ++bucketHistogram[bin >> bucketShift];
+    }
+
+    for (SizeValueType x = 0;;)
+    {
+      // Find the bucket holding the median, then the bin within it.
+      std::uint32_t cumulative = 0;
+      std::size_t   bucket = 0;
+      while (cumulative + bucketHistogram[bucket] <= medianRank)
+      {
+        cumulative += bucketHistogram[bucket];
+        ++bucket;
+      }
+      std::size_t bin = bucket << bucketShift;
+      while (cumulative + fineHistogram[bin] <= medianRank)
+      {
+        cumulative += fineHistogram[bin];
+        ++bin;
+      }
+      *outputIterator = static_cast<InputPixelType>(static_cast<UnsignedPixelType>(bin) ^ signFlip);
+      ++outputIterator;
+      progress.CompletedPixel();
+
+      if (++x == rowLength)
+      {
+        break;
+      }
+
+      // Slide the box one pixel along the row.
+      trailingRange.SetLocation(index);
+      for (const InputPixelType pixel : trailingRange)
+      {
+        const auto updateBin = static_cast<UnsignedPixelType>(static_cast<UnsignedPixelType>(pixel) ^ signFlip);
+        --fineHistogram[updateBin];
+        --bucketHistogram[updateBin >> bucketShift];
+      }
+      ++index[0];
+      leadingRange.SetLocation(index);
+      for (const InputPixelType pixel : leadingRange)
+      {
+        const auto updateBin = static_cast<UnsignedPixelType>(static_cast<UnsignedPixelType>(pixel) ^ signFlip);
+        ++fineHistogram[updateBin];
+        ++bucketHistogram[updateBin >> bucketShift];
+      }
+    }
+
+    // Return the counters to zero for the next row by removing the
+    // final box; cheaper than clearing the whole array for wide value
+    // ranges.
+    boxRange.SetLocation(index);
+    for (const InputPixelType pixel : boxRange)
+    {
+      const auto bin = static_cast<UnsignedPixelType>(static_cast<UnsignedPixelType>(pixel) ^ signFlip);
+      --fineHistogram[bin];
+      --bucketHistogram[bin >> bucketShift];
+    }
+  }
+}
 } // end namespace itk
 
 #endif
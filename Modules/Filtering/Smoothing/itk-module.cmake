@@ -6,6 +6,7 @@ itk_module(ITKSmoothing
   ENABLE_SHARED
   COMPILE_DEPENDS
     ITKImageFunction
+    ITKImageStatistics
   TEST_DEPENDS
     ITKTestKernel
   DESCRIPTION
@@ -0,0 +1,132 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkBilateralGridImageFilter.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkTestingMacros.h"
+
+int
+itkBilateralGridImageFilterTest(int, char *[])
+{
+  using ImageType = itk::Image<float, 2>;
+
+  // A noisy step edge: left half around 10, right half around 100,
+  // with a deterministic +/- 2 perturbation.
+  auto                input = ImageType::New();
+  ImageType::SizeType size;
+  size.Fill(64);
+  input->SetRegions(size);
+  input->Allocate();
+
+  itk::ImageRegionIteratorWithIndex<ImageType> inputIt(input, input->GetLargestPossibleRegion());
+  for (inputIt.GoToBegin(); !inputIt.IsAtEnd(); ++inputIt)
+  {
+    const ImageType::IndexType index = inputIt.GetIndex();
+    const float                base = (index[0] < 32) ? 10.0f : 100.0f;
+    const float                noise = static_cast<float>((index[0] * 7 + index[1] * 3) % 5) - 2.0f;
+    inputIt.Set(base + noise);
+  }
+
+  using FilterType = itk::BilateralGridImageFilter<ImageType, ImageType>;
+  auto filter = FilterType::New();
+
+  ITK_EXERCISE_BASIC_OBJECT_METHODS(filter, BilateralGridImageFilter, ImageToImageFilter);
+
+  filter->SetInput(input);
+  filter->SetDomainSigma(4.0);
+  filter->SetRangeSigma(20.0);
+
+  FilterType::ArrayType domainSigma;
+  domainSigma.Fill(4.0);
+  ITK_TEST_SET_GET_VALUE(domainSigma, filter->GetDomainSigma());
+  ITK_TEST_SET_GET_VALUE(20.0, filter->GetRangeSigma());
+
+  ITK_TRY_EXPECT_NO_EXCEPTION(filter->Update());
+
+  const ImageType * output = filter->GetOutput();
+
+  // Away from the edge the noise must be attenuated while the two
+  // plateaus keep their levels; across the edge the step must remain.
+  itk::ImageRegionConstIteratorWithIndex<ImageType> outputIt(output, output->GetLargestPossibleRegion());
+  for (outputIt.GoToBegin(); !outputIt.IsAtEnd(); ++outputIt)
+  {
+    const ImageType::IndexType index = outputIt.GetIndex();
+    if (index[0] >= 10 && index[0] < 22)
+    {
+      if (itk::Math::abs(outputIt.Get() - 10.0f) > 1.0f)
+      {
+        std::cerr << "Test failed!" << std::endl;
+        std::cerr << "Value " << outputIt.Get() << " at " << index << " is not smoothed towards the plateau level 10"
+                  << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+    else if (index[0] >= 42 && index[0] < 54)
+    {
+      if (itk::Math::abs(outputIt.Get() - 100.0f) > 1.0f)
+      {
+        std::cerr << "Test failed!" << std::endl;
+        std::cerr << "Value " << outputIt.Get() << " at " << index << " is not smoothed towards the plateau level 100"
+                  << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  ImageType::IndexType darkIndex = { { 30, 32 } };
+  ImageType::IndexType brightIndex = { { 33, 32 } };
+  if (output->GetPixel(brightIndex) - output->GetPixel(darkIndex) < 60.0f)
+  {
+    std::cerr << "Test failed!" << std::endl;
+    std::cerr << "The step edge was not preserved: " << output->GetPixel(darkIndex) << " vs "
+              << output->GetPixel(brightIndex) << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // A constant image passes through unchanged.
+  auto constantImage = ImageType::New();
+  constantImage->SetRegions(size);
+  constantImage->Allocate();
+  constantImage->FillBuffer(42.0f);
+
+  auto constantFilter = FilterType::New();
+  constantFilter->SetInput(constantImage);
+  constantFilter->SetDomainSigma(4.0);
+  constantFilter->SetRangeSigma(20.0);
+  ITK_TRY_EXPECT_NO_EXCEPTION(constantFilter->Update());
+
+  itk::ImageRegionConstIteratorWithIndex<ImageType> constantIt(constantFilter->GetOutput(),
+                                                               constantFilter->GetOutput()->GetLargestPossibleRegion());
+  for (constantIt.GoToBegin(); !constantIt.IsAtEnd(); ++constantIt)
+  {
+    if (itk::Math::NotAlmostEquals(constantIt.Get(), 42.0f))
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "Constant image was changed: " << constantIt.Get() << " at " << constantIt.GetIndex() << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // An invalid range sigma is reported.
+  auto invalidFilter = FilterType::New();
+  invalidFilter->SetInput(input);
+  invalidFilter->SetRangeSigma(0.0);
+  ITK_TRY_EXPECT_EXCEPTION(invalidFilter->Update());
+
+  return EXIT_SUCCESS;
+}
@@ -99,6 +99,10 @@ itkDiscreteGaussianImageFilterTest(int argc, char * argv[])
   filter->SetFilterDimensionality(Dimension);
   ITK_TEST_SET_GET_VALUE(Dimension, filter->GetFilterDimensionality());
 
+  unsigned int internalNumberOfStreamDivisions = Dimension * Dimension;
+  filter->SetInternalNumberOfStreamDivisions(internalNumberOfStreamDivisions);
+  ITK_TEST_SET_GET_VALUE(internalNumberOfStreamDivisions, filter->GetInternalNumberOfStreamDivisions());
+
   auto useImageSpacing = static_cast<bool>(std::stoi(argv[1]));
 #if !defined(ITK_FUTURE_LEGACY_REMOVE)
   if (useImageSpacing)
@@ -17,6 +17,7 @@
  *=========================================================================*/
 
 #include "itkRandomImageSource.h"
+#include "itkImageRegionIteratorWithIndex.h"
 #include "itkMedianImageFilter.h"
 #include "itkTextOutput.h"
 #include "itkSimpleFilterWatcher.h"
@@ -65,6 +66,61 @@ itkMedianImageFilterTest(int, char *[])
   const FloatImage2DType::SizeType & radius = median->GetRadius();
   std::cout << "median->GetRadius():" << radius << std::endl;
 
+  // Verify that the sliding-histogram code path used for small integer
+  // pixel types produces the same result as the per-pixel selection
+  // path, which is exercised here through an equivalent float image.
+  using ShortImage2DType = itk::Image<short, 2>;
+
+  auto shortImage = ShortImage2DType::New();
+  auto floatImage = FloatImage2DType::New();
+
+  ShortImage2DType::SizeType size;
+  size[0] = 32;
+  size[1] = 27;
+  shortImage->SetRegions(size);
+  shortImage->Allocate();
+  floatImage->SetRegions(size);
+  floatImage->Allocate();
+
+  itk::ImageRegionIteratorWithIndex<ShortImage2DType> shortInputIt(shortImage, shortImage->GetLargestPossibleRegion());
+  while (!shortInputIt.IsAtEnd())
+  {
+    const ShortImage2DType::IndexType index = shortInputIt.GetIndex();
+    const auto value = static_cast<short>((index[0] * 31 + index[1] * 17) % 2001 - 1000);
+    shortInputIt.Set(value);
+    floatImage->SetPixel(index, static_cast<float>(value));
+    ++shortInputIt;
+  }
+
+  ShortImage2DType::SizeType asymmetricRadius;
+  asymmetricRadius[0] = 2;
+  asymmetricRadius[1] = 1;
+
+  auto shortMedian = itk::MedianImageFilter<ShortImage2DType, ShortImage2DType>::New();
+  shortMedian->SetInput(shortImage);
+  shortMedian->SetRadius(asymmetricRadius);
+  shortMedian->Update();
+
+  auto floatMedian = itk::MedianImageFilter<FloatImage2DType, FloatImage2DType>::New();
+  floatMedian->SetInput(floatImage);
+  floatMedian->SetRadius(asymmetricRadius);
+  floatMedian->Update();
+
+  itk::ImageRegionIteratorWithIndex<ShortImage2DType> shortOutputIt(shortMedian->GetOutput(),
+                                                                    shortMedian->GetOutput()->GetLargestPossibleRegion());
+  while (!shortOutputIt.IsAtEnd())
+  {
+    const ShortImage2DType::IndexType index = shortOutputIt.GetIndex();
+    const auto                        expected = static_cast<short>(floatMedian->GetOutput()->GetPixel(index));
+    if (shortOutputIt.Get() != expected)
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "Histogram median value " << shortOutputIt.Get() << " at " << index
+                << " differs from expected value " << expected << std::endl;
+      return EXIT_FAILURE;
+    }
+    ++shortOutputIt;
+  }
 
   return EXIT_SUCCESS;
 }
@@ -21,7 +21,7 @@
 #include "itkImageToImageFilter.h"
 #include "itkFixedArray.h"
 #include "itkOtsuMultipleThresholdsCalculator.h"
-#include "itkScalarImageToHistogramGenerator.h"
+#include "itkImageToHistogramFilter.h"
 
 namespace itk
 {
@@ -38,6 +38,15 @@ namespace itk
  * for the Calculator. The LabelOffset can be set
  * for the ThresholdLabelerImageFilter.
  *
+ * The histogram is accumulated by ImageToHistogramFilter with one
+ * histogram per thread, merged once after the pass. When
+ * NumberOfStreamDivisions is larger than one the histogram pass
+ * additionally streams over the input in that many pieces, so the
+ * thresholds of an out-of-core volume can be computed with bounded
+ * memory; in that mode the histogram covers the complete range of
+ * the pixel type, since the intensity extrema are not known before
+ * the single pass.
+ *
  * This filter also includes an option to use the valley emphasis algorithm from
  * H.F. Ng, "Automatic thresholding for defect detection", Pattern Recognition Letters, (27): 1644-1649, 2006.
  * The valley emphasis algorithm is particularly effective when the object to be thresholded is small.
@@ -46,7 +55,7 @@ namespace itk
  * To use this algorithm, simple call the setter: SetValleyEmphasis(true)
  * It is turned off by default.
  *
- * \sa ScalarImageToHistogramGenerator
+ * \sa ImageToHistogramFilter
  * \sa OtsuMultipleThresholdsCalculator
  * \sa ThresholdLabelerImageFilter
  * \ingroup IntensityImageFilters  MultiThreaded
@@ -91,7 +100,7 @@ public:
   using OutputImageRegionType = typename TOutputImage::RegionType;
 
   /** Threshold vector types. */
-  using HistogramGeneratorType = itk::Statistics::ScalarImageToHistogramGenerator<TInputImage>;
+  using HistogramGeneratorType = itk::Statistics::ImageToHistogramFilter<TInputImage>;
   using HistogramType = typename HistogramGeneratorType::HistogramType;
   using OtsuCalculatorType = OtsuMultipleThresholdsCalculator<HistogramType>;
   using ThresholdVectorType = typename OtsuCalculatorType::OutputType;
@@ -126,6 +135,14 @@ public:
   itkGetConstReferenceMacro(ReturnBinMidpoint, bool);
   itkBooleanMacro(ReturnBinMidpoint);
 
+  /** Set/Get the number of pieces the input is streamed over during
+   * the histogram pass. Default is 1, i.e. no streaming. When larger
+   * than one the full input is no longer requested up front, so the
+   * output of this filter can itself be streamed; note that every
+   * streamed output piece then recomputes the histogram. */
+  itkSetClampMacro(NumberOfStreamDivisions, unsigned int, 1, NumericTraits<unsigned int>::max());
+  itkGetConstMacro(NumberOfStreamDivisions, unsigned int);
+
   /** Get the computed threshold. */
   const ThresholdVectorType &
   GetThresholds() const
@@ -158,6 +175,7 @@ private:
   OutputPixelType     m_LabelOffset;
   ThresholdVectorType m_Thresholds;
   bool                m_ValleyEmphasis{ false };
+  unsigned int        m_NumberOfStreamDivisions{ 1 };
 #if defined(ITKV4_COMPATIBILITY)
   bool m_ReturnBinMidpoint{ true };
 #else
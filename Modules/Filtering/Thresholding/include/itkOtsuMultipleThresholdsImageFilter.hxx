@@ -39,11 +39,33 @@ OtsuMultipleThresholdsImageFilter<TInputImage, TOutputImage>::GenerateData()
   auto progress = ProgressAccumulator::New();
   progress->SetMiniPipelineFilter(this);
 
-  // Create a histogram of the image intensities
+  // Create a histogram of the image intensities, accumulated with one
+  // histogram per thread and merged once after the pass.
   auto histogramGenerator = HistogramGeneratorType::New();
   histogramGenerator->SetInput(this->GetInput());
-  histogramGenerator->SetNumberOfBins(m_NumberOfHistogramBins);
-  histogramGenerator->Compute();
+  histogramGenerator->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+  typename HistogramType::SizeType histogramSize(1);
+  histogramSize.Fill(m_NumberOfHistogramBins);
+  histogramGenerator->SetHistogramSize(histogramSize);
+  if (m_NumberOfStreamDivisions > 1)
+  {
+    // The intensity extrema are not known before the single streamed
+    // pass, so bin the complete range of the pixel type.
+    typename HistogramGeneratorType::HistogramMeasurementVectorType lowerBound(1);
+    typename HistogramGeneratorType::HistogramMeasurementVectorType upperBound(1);
+    lowerBound.Fill(NumericTraits<InputPixelType>::NonpositiveMin());
+    upperBound.Fill(NumericTraits<InputPixelType>::max());
+    histogramGenerator->SetAutoMinimumMaximum(false);
+    histogramGenerator->SetHistogramBinMinimum(lowerBound);
+    histogramGenerator->SetHistogramBinMaximum(upperBound);
+    histogramGenerator->SetNumberOfStreamDivisions(m_NumberOfStreamDivisions);
+  }
+  else
+  {
+    histogramGenerator->SetAutoMinimumMaximum(true);
+  }
+  progress->RegisterInternalFilter(histogramGenerator, .4f);
+  histogramGenerator->Update();
 
   // Compute the multiple Otsu Thresholds for the input image
   auto otsuHistogramThresholdCalculator = OtsuCalculatorType::New();
@@ -58,7 +80,7 @@ OtsuMultipleThresholdsImageFilter<TInputImage, TOutputImage>::GenerateData()
   typename ThresholdLabelerImageFilter<TInputImage, TOutputImage>::Pointer threshold =
     ThresholdLabelerImageFilter<TInputImage, TOutputImage>::New();
 
-  progress->RegisterInternalFilter(threshold, 1.0f);
+  progress->RegisterInternalFilter(threshold, .6f);
   threshold->GraftOutput(this->GetOutput());
   threshold->SetInput(this->GetInput());
   threshold->SetRealThresholds(m_Thresholds);
@@ -72,11 +94,19 @@ template <typename TInputImage, typename TOutputImage>
 void
 OtsuMultipleThresholdsImageFilter<TInputImage, TOutputImage>::GenerateInputRequestedRegion()
 {
-  auto * input = const_cast<TInputImage *>(this->GetInput());
+  Superclass::GenerateInputRequestedRegion();
 
-  if (input)
+  // In streaming mode the internal histogram pass requests its own
+  // pieces of the input, so the full input does not have to be made
+  // resident here; otherwise the whole input is needed at once.
+  if (m_NumberOfStreamDivisions <= 1)
   {
-    input->SetRequestedRegionToLargestPossibleRegion();
+    auto * input = const_cast<TInputImage *>(this->GetInput());
+
+    if (input)
+    {
+      input->SetRequestedRegionToLargestPossibleRegion();
+    }
   }
 }
 
@@ -88,6 +118,7 @@ OtsuMultipleThresholdsImageFilter<TInputImage, TOutputImage>::PrintSelf(std::ost
 
   os << indent << "NumberOfHistogramBins: " << m_NumberOfHistogramBins << std::endl;
   os << indent << "NumberOfThresholds: " << m_NumberOfThresholds << std::endl;
+  os << indent << "NumberOfStreamDivisions: " << m_NumberOfStreamDivisions << std::endl;
   os << indent << "LabelOffset: " << m_LabelOffset << std::endl;
   os << indent << "Thresholds: " << std::endl;
   for (SizeValueType j = 0; j < m_Thresholds.size(); ++j)
@@ -0,0 +1,100 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkOtsuMultipleThresholdsImageFilter.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkTestingMacros.h"
+
+int
+itkOtsuMultipleThresholdsImageFilterStreamingTest(int, char *[])
+{
+  using ImageType = itk::Image<unsigned char, 2>;
+  using FilterType = itk::OtsuMultipleThresholdsImageFilter<ImageType, ImageType>;
+
+  // A trimodal image with classes around 40, 120 and 210.
+  auto                input = ImageType::New();
+  ImageType::SizeType size;
+  size.Fill(60);
+  input->SetRegions(size);
+  input->Allocate();
+
+  itk::ImageRegionIteratorWithIndex<ImageType> it(input, input->GetLargestPossibleRegion());
+  for (it.GoToBegin(); !it.IsAtEnd(); ++it)
+  {
+    const ImageType::IndexType index = it.GetIndex();
+    const unsigned char        base = (index[1] < 20) ? 40 : (index[1] < 40) ? 120 : 210;
+    it.Set(static_cast<unsigned char>(base + (index[0] * 3 + index[1]) % 7));
+  }
+
+  // The streamed histogram pass must produce the same thresholds and
+  // labels regardless of the number of stream divisions.
+  auto referenceFilter = FilterType::New();
+  referenceFilter->SetInput(input);
+  referenceFilter->SetNumberOfThresholds(2);
+  referenceFilter->SetNumberOfHistogramBins(256);
+  referenceFilter->SetNumberOfStreamDivisions(2);
+  ITK_TEST_SET_GET_VALUE(2, referenceFilter->GetNumberOfStreamDivisions());
+  ITK_TRY_EXPECT_NO_EXCEPTION(referenceFilter->Update());
+
+  auto streamedFilter = FilterType::New();
+  streamedFilter->SetInput(input);
+  streamedFilter->SetNumberOfThresholds(2);
+  streamedFilter->SetNumberOfHistogramBins(256);
+  streamedFilter->SetNumberOfStreamDivisions(8);
+  ITK_TRY_EXPECT_NO_EXCEPTION(streamedFilter->Update());
+
+  const FilterType::ThresholdVectorType & referenceThresholds = referenceFilter->GetThresholds();
+  const FilterType::ThresholdVectorType & streamedThresholds = streamedFilter->GetThresholds();
+  ITK_TEST_EXPECT_EQUAL(referenceThresholds.size(), streamedThresholds.size());
+  for (size_t i = 0; i < referenceThresholds.size(); ++i)
+  {
+    if (itk::Math::NotAlmostEquals(referenceThresholds[i], streamedThresholds[i]))
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "Threshold #" << i << " differs between stream divisions: " << referenceThresholds[i] << " vs "
+                << streamedThresholds[i] << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // The thresholds must separate the three classes.
+  if (!(referenceThresholds[0] > 46.0 && referenceThresholds[0] < 120.0 && referenceThresholds[1] > 126.0 &&
+        referenceThresholds[1] < 210.0))
+  {
+    std::cerr << "Test failed!" << std::endl;
+    std::cerr << "Thresholds do not separate the classes: " << referenceThresholds[0] << ", "
+              << referenceThresholds[1] << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  itk::ImageRegionConstIteratorWithIndex<ImageType> outputIt(streamedFilter->GetOutput(),
+                                                             streamedFilter->GetOutput()->GetLargestPossibleRegion());
+  for (outputIt.GoToBegin(); !outputIt.IsAtEnd(); ++outputIt)
+  {
+    const auto expected = static_cast<unsigned char>(outputIt.GetIndex()[1] / 20);
+    if (outputIt.Get() != expected)
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "Label " << static_cast<int>(outputIt.Get()) << " at " << outputIt.GetIndex()
+                << " differs from expected class " << static_cast<int>(expected) << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -22,6 +22,8 @@
 #include "itkCSVFileReaderBase.h"
 #include "itkCSVArray2DDataObject.h"
 
+#include <type_traits>
+
 namespace itk
 {
 
@@ -73,6 +75,13 @@ namespace itk
  *
  * reader->Parse();
  *
+ * When the string delimiter character is not in use, Parse() reads the
+ * whole file in one transfer, splits it at line boundaries and converts
+ * the rows in parallel with direct in-buffer number parsing; headers are
+ * built once from the corresponding buffer slices. Files using the
+ * string delimiter character are parsed with the field-by-field path of
+ * CSVFileReaderBase.
+ *
  * \ingroup ITKIOCSV
  */
 template <typename TData>
@@ -130,6 +139,25 @@ protected:
   PrintSelf(std::ostream & os, Indent indent) const override;
 
 private:
+  /** The field-by-field path of CSVFileReaderBase; used when the string
+   *  delimiter character is in use. */
+  void
+  ParseSerially();
+
+  /** Split the file content at line boundaries and convert the rows in
+   *  parallel, writing each value directly into the Array2D object. */
+  void
+  ParseFromBuffer(const std::string & buffer);
+
+  /** Convert one field in place, mirroring ConvertStringToValueType():
+   *  surrounding whitespace is allowed and anything else unparsed makes
+   *  the field NaN. */
+  static TData
+  ConvertField(const char * begin, const char * end, std::true_type isFloatingPoint);
+
+  static TData
+  ConvertField(const char * begin, const char * end, std::false_type isFloatingPoint);
+
   Array2DDataObjectPointer m_Array2DDataObject;
 };
 
@@ -19,9 +19,14 @@
 #define itkCSVArray2DFileReader_hxx
 
 #include "itkCSVArray2DFileReader.h"
+#include "itkMultiThreaderBase.h"
 
 #include "itksys/SystemTools.hxx"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
 #include <limits>
+#include <vector>
 
 namespace itk
 {
@@ -43,12 +48,245 @@ CSVArray2DFileReader<TData>::PrintSelf(std::ostream & os, Indent indent) const
 template <typename TData>
 void
 CSVArray2DFileReader<TData>::Parse()
+{
+  this->PrepareForParsing();
+
+  if (this->m_UseStringDelimiterCharacter)
+  {
+    // quoted headers need the stateful field-by-field parser
+    this->ParseSerially();
+    return;
+  }
+
+  std::ifstream file(this->m_FileName.c_str(), std::ios::in | std::ios::binary);
+  if (file.fail())
+  {
+    itkExceptionMacro("The file " << this->m_FileName << " cannot be opened for reading!" << std::endl
+                                  << "Reason: " << itksys::SystemTools::GetLastSystemError());
+  }
+
+  // one bulk transfer of the whole file
+  file.seekg(0, std::ios::end);
+  std::string buffer(static_cast<std::string::size_type>(file.tellg()), '\0');
+  file.seekg(0, std::ios::beg);
+  file.read(&buffer[0], static_cast<std::streamsize>(buffer.size()));
+  if (file.fail())
+  {
+    itkExceptionMacro("Failed reading " << this->m_FileName);
+  }
+  file.close();
+
+  this->ParseFromBuffer(buffer);
+}
+
+template <typename TData>
+TData
+CSVArray2DFileReader<TData>::ConvertField(const char * begin, const char * end, std::true_type)
+{
+  while (begin < end && (*begin == ' ' || *begin == '\t'))
+  {
+    ++begin;
+  }
+  if (begin == end)
+  {
+    return std::numeric_limits<TData>::quiet_NaN();
+  }
+  char *       endOfNumber = nullptr;
+  const double value = std::strtod(begin, &endOfNumber);
+  while (endOfNumber < end && (*endOfNumber == ' ' || *endOfNumber == '\t'))
+  {
+    ++endOfNumber;
+  }
+  if (endOfNumber != end)
+  {
+    return std::numeric_limits<TData>::quiet_NaN();
+  }
+  return static_cast<TData>(value);
+}
+
+template <typename TData>
+TData
+CSVArray2DFileReader<TData>::ConvertField(const char * begin, const char * end, std::false_type)
+{
+  while (begin < end && (*begin == ' ' || *begin == '\t'))
+  {
+    ++begin;
+  }
+  if (begin == end)
+  {
+    return std::numeric_limits<TData>::quiet_NaN();
+  }
+  char *          endOfNumber = nullptr;
+  const long long value = std::strtoll(begin, &endOfNumber, 10);
+  while (endOfNumber < end && (*endOfNumber == ' ' || *endOfNumber == '\t'))
+  {
+    ++endOfNumber;
+  }
+  if (endOfNumber != end)
+  {
+    return std::numeric_limits<TData>::quiet_NaN();
+  }
+  return static_cast<TData>(value);
+}
+
+template <typename TData>
+void
+CSVArray2DFileReader<TData>::ParseFromBuffer(const std::string & buffer)
+{
+  const char   delimiter = this->m_FieldDelimiterCharacter;
+  const char * bufferEnd = buffer.data() + buffer.size();
+
+  // split at line boundaries; like std::getline, an empty line counts
+  // but nothing follows the final newline
+  std::vector<std::pair<const char *, const char *>> lines;
+  const char *                                       lineBegin = buffer.data();
+  while (lineBegin < bufferEnd)
+  {
+    const char * newline = static_cast<const char *>(std::memchr(lineBegin, '\n', bufferEnd - lineBegin));
+    const char * lineEnd = newline ? newline : bufferEnd;
+    if (lineEnd > lineBegin && *(lineEnd - 1) == '\r')
+    {
+      --lineEnd;
+    }
+    lines.emplace_back(lineBegin, lineEnd);
+    lineBegin = newline ? newline + 1 : bufferEnd;
+  }
+
+  // like std::getline with the field delimiter, an empty trailing field
+  // after a final delimiter is not counted
+  const auto countFields = [delimiter](const char * begin, const char * end) {
+    SizeValueType fields = 0;
+    while (begin < end)
+    {
+      const char * next = static_cast<const char *>(std::memchr(begin, delimiter, end - begin));
+      ++fields;
+      begin = next ? next + 1 : end;
+    }
+    return fields;
+  };
+
+  // determine the dimensions exactly as GetDataDimension() does
+  SizeValueType firstDataLine = 0;
+  SizeValueType maximumColumns = 0;
+  bool          isSame = true;
+  if (this->m_HasColumnHeaders && !lines.empty())
+  {
+    SizeValueType headerColumns = countFields(lines[0].first, lines[0].second);
+    if (this->m_HasRowHeaders)
+    {
+      headerColumns -= 1;
+    }
+    maximumColumns = headerColumns;
+    firstDataLine = 1;
+  }
+  const SizeValueType rows = static_cast<SizeValueType>(lines.size()) - firstDataLine;
+  SizeValueType       previousColumns = maximumColumns;
+  for (SizeValueType line = firstDataLine; line < lines.size(); ++line)
+  {
+    SizeValueType columns = countFields(lines[line].first, lines[line].second);
+    if (this->m_HasRowHeaders && columns > 0)
+    {
+      columns -= 1;
+    }
+    if (!this->m_HasColumnHeaders && line == firstDataLine)
+    {
+      previousColumns = columns;
+      maximumColumns = columns;
+    }
+    if (columns != previousColumns)
+    {
+      isSame = false;
+      maximumColumns = std::max(maximumColumns, columns);
+      previousColumns = columns;
+    }
+  }
+  if (!isSame)
+  {
+    itkWarningMacro(<< "Warning: Data appears to contain missing data! "
+                    << "These will be set to NaN.");
+  }
+
+  this->m_Array2DDataObject->SetMatrixSize(rows, maximumColumns);
+  this->m_Array2DDataObject->FillMatrix(std::numeric_limits<TData>::quiet_NaN());
+
+  if (this->m_HasColumnHeaders)
+  {
+    this->m_Array2DDataObject->HasColumnHeadersOn();
+    if (!lines.empty())
+    {
+      const char * field = lines[0].first;
+      while (field < lines[0].second)
+      {
+        const char * next = static_cast<const char *>(std::memchr(field, delimiter, lines[0].second - field));
+        const char * fieldEnd = next ? next : lines[0].second;
+        this->m_Array2DDataObject->ColumnHeadersPushBack(std::string(field, fieldEnd));
+        field = next ? next + 1 : lines[0].second;
+      }
+      if (this->m_HasRowHeaders)
+      {
+        this->m_Array2DDataObject->EraseFirstColumnHeader();
+      }
+    }
+  }
+
+  // row headers are collected serially so their order is preserved; the
+  // remainder of each line is recorded for the parallel numeric pass
+  std::vector<const char *> dataBegin(rows);
+  for (SizeValueType row = 0; row < rows; ++row)
+  {
+    const char * field = lines[row + firstDataLine].first;
+    if (this->m_HasRowHeaders)
+    {
+      this->m_Array2DDataObject->HasRowHeadersOn();
+      const char * lineEnd = lines[row + firstDataLine].second;
+      const char * next = static_cast<const char *>(std::memchr(field, delimiter, lineEnd - field));
+      const char * fieldEnd = next ? next : lineEnd;
+      this->m_Array2DDataObject->RowHeadersPushBack(std::string(field, fieldEnd));
+      field = next ? next + 1 : lineEnd;
+    }
+    dataBegin[row] = field;
+  }
+
+  // each row writes a disjoint slice of the matrix, so the conversion
+  // can run fully in parallel
+  const auto convertRow = [this, &lines, &dataBegin, firstDataLine, maximumColumns, delimiter](SizeValueType row) {
+    const char * field = dataBegin[row];
+    const char * lineEnd = lines[row + firstDataLine].second;
+    for (SizeValueType column = 0; column < maximumColumns && field <= lineEnd; ++column)
+    {
+      const char * next = static_cast<const char *>(std::memchr(field, delimiter, lineEnd - field));
+      const char * fieldEnd = next ? next : lineEnd;
+      this->m_Array2DDataObject->SetMatrixData(
+        row, column, ConvertField(field, fieldEnd, std::is_floating_point<TData>{}));
+      if (!next)
+      {
+        break;
+      }
+      field = next + 1;
+    }
+  };
+
+  constexpr SizeValueType parallelRowThreshold = 256;
+  if (rows >= parallelRowThreshold && MultiThreaderBase::GetGlobalDefaultNumberOfThreads() > 1)
+  {
+    MultiThreaderBase::New()->ParallelizeArray(0, rows, convertRow, nullptr);
+  }
+  else
+  {
+    for (SizeValueType row = 0; row < rows; ++row)
+    {
+      convertRow(row);
+    }
+  }
+}
+
+template <typename TData>
+void
+CSVArray2DFileReader<TData>::ParseSerially()
 {
   SizeValueType rows = 0;
   SizeValueType columns = 0;
 
-  this->PrepareForParsing();
-
   this->m_InputStream.clear();
   this->m_InputStream.open(this->m_FileName.c_str());
   if (this->m_InputStream.fail())
@@ -0,0 +1,117 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkCSVArray2DFileReader.h"
+#include "itkMath.h"
+#include "itkTestingMacros.h"
+
+#include <fstream>
+
+// Exercises the bulk, row-parallel parse path of CSVArray2DFileReader
+// on a generated file large enough to cross the parallel threshold,
+// including missing and non-numeric fields.
+int
+itkCSVArray2DFileReaderParallelTest(int argc, char * argv[])
+{
+  if (argc < 2)
+  {
+    std::cerr << "Usage: " << itkNameOfTestExecutableMacro(argv) << " outputFileName" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const std::string fileName = argv[1];
+
+  constexpr unsigned int numberOfRows = 600;
+  constexpr unsigned int numberOfColumns = 5;
+
+  {
+    std::ofstream file(fileName.c_str());
+    if (file.fail())
+    {
+      std::cerr << "Cannot write " << fileName << std::endl;
+      return EXIT_FAILURE;
+    }
+    file << "Table";
+    for (unsigned int jj = 0; jj < numberOfColumns; ++jj)
+    {
+      file << ",Col" << jj;
+    }
+    file << "\n";
+    for (unsigned int ii = 0; ii < numberOfRows; ++ii)
+    {
+      file << "Row" << ii;
+      for (unsigned int jj = 0; jj < numberOfColumns; ++jj)
+      {
+        if (ii == 17 && jj == 4)
+        {
+          break; // missing trailing field
+        }
+        if (ii == 23 && jj == 2)
+        {
+          file << ",not-a-number";
+          continue;
+        }
+        file << ',' << 0.5 * ii + 0.25 * jj;
+      }
+      file << "\n";
+    }
+  }
+
+  using ReaderType = itk::CSVArray2DFileReader<double>;
+  auto reader = ReaderType::New();
+  reader->SetFileName(fileName);
+  reader->SetFieldDelimiterCharacter(',');
+  reader->HasColumnHeadersOn();
+  reader->HasRowHeadersOn();
+  ITK_TRY_EXPECT_NO_EXCEPTION(reader->Parse());
+
+  const ReaderType::Array2DDataObjectPointer data = reader->GetOutput();
+
+  ITK_TEST_EXPECT_EQUAL(data->GetMatrix().rows(), numberOfRows);
+  ITK_TEST_EXPECT_EQUAL(data->GetMatrix().cols(), numberOfColumns);
+  ITK_TEST_EXPECT_EQUAL(data->GetColumnHeaders().size(), numberOfColumns);
+  ITK_TEST_EXPECT_EQUAL(data->GetColumnHeaders()[0], "Col0");
+  ITK_TEST_EXPECT_EQUAL(data->GetRowHeaders().size(), numberOfRows);
+  ITK_TEST_EXPECT_EQUAL(data->GetRowHeaders()[599], "Row599");
+
+  for (unsigned int ii = 0; ii < numberOfRows; ++ii)
+  {
+    for (unsigned int jj = 0; jj < numberOfColumns; ++jj)
+    {
+      const double value = data->GetData(ii, jj);
+      if ((ii == 17 && jj == 4) || (ii == 23 && jj == 2))
+      {
+        if (!itk::Math::isnan(value))
+        {
+          std::cerr << "Expected NaN at (" << ii << ", " << jj << "), got " << value << std::endl;
+          return EXIT_FAILURE;
+        }
+        continue;
+      }
+      const double expected = 0.5 * ii + 0.25 * jj;
+      if (!itk::Math::FloatAlmostEqual(value, expected, 4, 1e-10))
+      {
+        std::cerr << "Wrong value at (" << ii << ", " << jj << "): " << value << " instead of " << expected
+                  << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -192,6 +192,30 @@ public:
   itkGetConstMacro(ReadYBRtoRGB, bool);
   itkBooleanMacro(ReadYBRtoRGB);
 
+  /** In lazy metadata mode ReadImageInformation parses only the tags
+   * the geometry and pixel description require, plus any tags added
+   * with AddLazyMetaDataTag, seeking over the values of every other
+   * element. In particular the pixel data and other bulk data elements
+   * are never read, which makes header interrogation of large files
+   * considerably faster. The MetaDataDictionary then holds only the
+   * parsed tags. Default is false. */
+  itkSetMacro(UseLazyMetaData, bool);
+  itkGetConstMacro(UseLazyMetaData, bool);
+  itkBooleanMacro(UseLazyMetaData);
+
+  /** Add a tag, in the "group|element" format used as the keys of the
+   * MetaDataDictionary (e.g. "0010|0010"), to the set parsed in lazy
+   * metadata mode. */
+  void
+  AddLazyMetaDataTag(const std::string & tag);
+
+  /** The tags added with AddLazyMetaDataTag. */
+  const std::vector<std::string> &
+  GetLazyMetaDataTags() const
+  {
+    return m_LazyMetaDataTags;
+  }
+
 #if defined(ITKIO_DEPRECATED_GDCM1_API)
   /** Convenience methods to query patient information and scanner
    * information. These methods are here for compatibility with the
@@ -362,6 +386,11 @@ protected:
   void
   InternalReadImageInformation();
 
+  /** The lazy metadata implementation of the above, reading only the
+   * selected tags. */
+  void
+  LazyReadImageInformation();
+
   double m_RescaleSlope;
 
   double m_RescaleIntercept;
@@ -421,6 +450,10 @@ private:
 
   bool m_SingleBit;
 
+  bool m_UseLazyMetaData{ false };
+
+  std::vector<std::string> m_LazyMetaDataTags;
+
   IOComponentEnum m_InternalComponentType;
 
   InternalHeader * m_DICOMHeader;
@@ -185,6 +185,29 @@ public:
   itkGetConstMacro(LoadPrivateTags, bool);
   itkBooleanMacro(LoadPrivateTags);
 
+  /** Maintain a persistent index of the series found in the input
+   * directory in a sidecar file, so that repeated opens of an unchanged
+   * study skip the per-file DICOM header parsing entirely. The index
+   * records the series UIDs with their ordered file lists and is
+   * validated against the names, sizes and modification times of the
+   * files in the directory; any change falls back to a full scan, which
+   * rewrites the index. Defaults to false.
+   * Must be set before the call to SetInputDirectory(). */
+  itkSetMacro(UseSeriesIndexCache, bool);
+  itkGetConstMacro(UseSeriesIndexCache, bool);
+  itkBooleanMacro(UseSeriesIndexCache);
+
+  /** The location of the series index sidecar file. When left empty a
+   * file named ".itkGDCMSeriesIndex" inside the input directory is
+   * used. Pointing several processes at the same file shares the index
+   * between them. Must be set before the call to SetInputDirectory(). */
+  itkSetMacro(SeriesIndexCacheFileName, std::string);
+  itkGetConstMacro(SeriesIndexCacheFileName, std::string);
+
+  /** Returns true when the last call to SetInputDirectory() was served
+   * from a valid series index instead of a directory scan. */
+  itkGetConstMacro(SeriesIndexCacheHit, bool);
+
 protected:
   GDCMSeriesFileNames();
   ~GDCMSeriesFileNames() override;
@@ -192,6 +215,20 @@ protected:
   PrintSelf(std::ostream & os, Indent indent) const override;
 
 private:
+  /** The sidecar file consulted for the given directory. */
+  std::string
+  GetActualSeriesIndexCacheFileName() const;
+
+  /** Load the series index and validate it against the directory
+   * contents. Returns false when the index is absent or stale. */
+  bool
+  ReadSeriesIndexCache();
+
+  /** Order the series found by the scan, keep them as the in-memory
+   * index and persist them to the sidecar file. */
+  void
+  BuildAndWriteSeriesIndexCache();
+
   /** Contains the input directory where the DICOM serie is found */
   std::string m_InputDirectory = "";
 
@@ -212,6 +249,18 @@ private:
   bool m_Recursive = false;
   bool m_LoadSequences = false;
   bool m_LoadPrivateTags = false;
+
+  /** The persistent series index: UIDs with their ordered file lists. */
+  std::string                         m_SeriesIndexCacheFileName = "";
+  SeriesUIDContainerType              m_CachedSeriesUIDs;
+  std::vector<FileNamesContainerType> m_CachedSeriesFileNames;
+
+  /** Restrictions are part of how files split into series, so they are
+   * recorded in the index for validation. */
+  std::vector<std::string> m_SeriesRestrictionTags;
+
+  bool m_UseSeriesIndexCache = false;
+  bool m_SeriesIndexCacheHit = false;
 };
 } // namespace itk
 
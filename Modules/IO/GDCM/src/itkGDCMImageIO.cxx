@@ -46,6 +46,7 @@
 #include "gdcmStringFilter.h"
 #include "gdcmImageApplyLookupTable.h"
 #include "gdcmImageChangePlanarConfiguration.h"
+#include "gdcmReader.h"
 #include "gdcmRescaler.h"
 #include "gdcmImageReader.h"
 #include "gdcmImageWriter.h"
@@ -54,12 +55,112 @@
 #include "gdcmGlobal.h"
 #include "gdcmMediaStorage.h"
 
+#include <cstdio>
 #include <fstream>
+#include <set>
 #include <sstream>
 
 namespace itk
 {
 
+namespace
+{
+
+// Map a GDCM scalar type onto the ITK component type, returning
+// UNKNOWNCOMPONENTTYPE when there is no match.
+IOComponentEnum
+GDCMToITKComponentType(const gdcm::PixelFormat::ScalarType scalarType)
+{
+  switch (scalarType)
+  {
+    case gdcm::PixelFormat::INT8:
+      return IOComponentEnum::CHAR; // Is it signed char ?
+    case gdcm::PixelFormat::UINT8:
+      return IOComponentEnum::UCHAR;
+    /* INT12 / UINT12 should not happen anymore in any modern DICOM */
+    case gdcm::PixelFormat::INT12:
+      return IOComponentEnum::SHORT;
+    case gdcm::PixelFormat::UINT12:
+      return IOComponentEnum::USHORT;
+    case gdcm::PixelFormat::INT16:
+      return IOComponentEnum::SHORT;
+    case gdcm::PixelFormat::UINT16:
+      return IOComponentEnum::USHORT;
+    // RT / SC have 32bits
+    case gdcm::PixelFormat::INT32:
+      return IOComponentEnum::INT;
+    case gdcm::PixelFormat::UINT32:
+      return IOComponentEnum::UINT;
+    // case gdcm::PixelFormat::FLOAT16: // TODO
+    case gdcm::PixelFormat::FLOAT32:
+      return IOComponentEnum::FLOAT;
+    case gdcm::PixelFormat::FLOAT64:
+      return IOComponentEnum::DOUBLE;
+    default:
+      return IOComponentEnum::UNKNOWNCOMPONENTTYPE;
+  }
+}
+
+// Copy the elements of the data set into the itk dictionary, encoding
+// binary fields as mime64.
+void
+CopyDataSetToDictionary(const gdcm::File & f, const gdcm::DataSet & ds, MetaDataDictionary & dico, bool loadPrivateTags)
+{
+  gdcm::StringFilter sf;
+  sf.SetFile(f);
+
+  for (auto it = ds.Begin(); it != ds.End(); ++it)
+  {
+    const gdcm::DataElement & ref = *it;
+    const gdcm::Tag &         tag = ref.GetTag();
+    // Compute VR from the toplevel file, and the currently processed dataset:
+    gdcm::VR vr = gdcm::DataSetHelper::ComputeVR(f, ds, tag);
+
+    // Process binary field and encode them as mime64: only when we do not know
+    // of any better
+    // representation. VR::US is binary, but user want ASCII representation.
+    if (vr & (gdcm::VR::OB | gdcm::VR::OF | gdcm::VR::OW | gdcm::VR::SQ | gdcm::VR::UN))
+    {
+      // itkAssertInDebugAndIgnoreInReleaseMacro( vr & gdcm::VR::VRBINARY );
+      /*
+       * Old behavior was to skip SQ, Pixel Data element. I decided that it is not safe to mime64
+       * VR::UN element. There used to be a bug in gdcm 1.2.0 and VR:UN element.
+       */
+      if ((loadPrivateTags || tag.IsPublic()) && vr != gdcm::VR::SQ &&
+          tag != gdcm::Tag(0x7fe0, 0x0010) /* && vr != gdcm::VR::UN*/)
+      {
+        const gdcm::ByteValue * bv = ref.GetByteValue();
+        if (bv)
+        {
+          // base64 streams have to be a multiple of 4 bytes in length
+          int encodedLengthEstimate = 2 * bv->GetLength();
+          encodedLengthEstimate = ((encodedLengthEstimate / 4) + 1) * 4;
+
+          auto * bin = new char[encodedLengthEstimate];
+          auto   encodedLengthActual =
+            static_cast<unsigned int>(itksysBase64_Encode((const unsigned char *)bv->GetPointer(),
+                                                          static_cast<SizeValueType>(bv->GetLength()),
+                                                          (unsigned char *)bin,
+                                                          static_cast<int>(0)));
+          std::string encodedValue(bin, encodedLengthActual);
+          EncapsulateMetaData<std::string>(dico, tag.PrintAsPipeSeparatedString(), encodedValue);
+          delete[] bin;
+        }
+      }
+    }
+    else /* if ( vr & gdcm::VR::VRASCII ) */
+    {
+      // Only copying field from the public DICOM dictionary
+      if (loadPrivateTags || tag.IsPublic())
+      {
+        EncapsulateMetaData<std::string>(dico, tag.PrintAsPipeSeparatedString(), sf.ToString(tag));
+      }
+    }
+  }
+}
+
+} // namespace
+
 
 class InternalHeader
 {
@@ -447,6 +548,12 @@ GDCMImageIO::InternalReadImageInformation()
   this->OpenFileForReading(inputFileStream, m_FileName);
   inputFileStream.close();
 
+  if (m_UseLazyMetaData)
+  {
+    this->LazyReadImageInformation();
+    return;
+  }
+
   // In general this should be relatively safe to assume
   gdcm::ImageHelper::SetForceRescaleInterceptSlope(true);
 
@@ -718,59 +825,8 @@ GDCMImageIO::InternalReadImageInformation()
   // before populating it.
   dico.Clear();
 
-  gdcm::StringFilter sf;
-  sf.SetFile(f);
-  auto it = ds.Begin();
-
   // Copy of the header->content
-  for (; it != ds.End(); ++it)
-  {
-    const gdcm::DataElement & ref = *it;
-    const gdcm::Tag &         tag = ref.GetTag();
-    // Compute VR from the toplevel file, and the currently processed dataset:
-    gdcm::VR vr = gdcm::DataSetHelper::ComputeVR(f, ds, tag);
-
-    // Process binary field and encode them as mime64: only when we do not know
-    // of any better
-    // representation. VR::US is binary, but user want ASCII representation.
-    if (vr & (gdcm::VR::OB | gdcm::VR::OF | gdcm::VR::OW | gdcm::VR::SQ | gdcm::VR::UN))
-    {
-      // itkAssertInDebugAndIgnoreInReleaseMacro( vr & gdcm::VR::VRBINARY );
-      /*
-       * Old behavior was to skip SQ, Pixel Data element. I decided that it is not safe to mime64
-       * VR::UN element. There used to be a bug in gdcm 1.2.0 and VR:UN element.
-       */
-      if ((m_LoadPrivateTags || tag.IsPublic()) && vr != gdcm::VR::SQ &&
-          tag != gdcm::Tag(0x7fe0, 0x0010) /* && vr != gdcm::VR::UN*/)
-      {
-        const gdcm::ByteValue * bv = ref.GetByteValue();
-        if (bv)
-        {
-          // base64 streams have to be a multiple of 4 bytes in length
-          int encodedLengthEstimate = 2 * bv->GetLength();
-          encodedLengthEstimate = ((encodedLengthEstimate / 4) + 1) * 4;
-
-          auto * bin = new char[encodedLengthEstimate];
-          auto   encodedLengthActual =
-            static_cast<unsigned int>(itksysBase64_Encode((const unsigned char *)bv->GetPointer(),
-                                                          static_cast<SizeValueType>(bv->GetLength()),
-                                                          (unsigned char *)bin,
-                                                          static_cast<int>(0)));
-          std::string encodedValue(bin, encodedLengthActual);
-          EncapsulateMetaData<std::string>(dico, tag.PrintAsPipeSeparatedString(), encodedValue);
-          delete[] bin;
-        }
-      }
-    }
-    else /* if ( vr & gdcm::VR::VRASCII ) */
-    {
-      // Only copying field from the public DICOM dictionary
-      if (m_LoadPrivateTags || tag.IsPublic())
-      {
-        EncapsulateMetaData<std::string>(dico, tag.PrintAsPipeSeparatedString(), sf.ToString(tag));
-      }
-    }
-  }
+  CopyDataSetToDictionary(f, ds, dico, m_LoadPrivateTags);
 
 #if defined(ITKIO_DEPRECATED_GDCM1_API)
   // Now is a good time to fill in the class member:
@@ -794,6 +850,184 @@ GDCMImageIO::InternalReadImageInformation()
 #endif
 }
 
+void
+GDCMImageIO::AddLazyMetaDataTag(const std::string & tag)
+{
+  m_LazyMetaDataTags.push_back(tag);
+  this->Modified();
+}
+
+void
+GDCMImageIO::LazyReadImageInformation()
+{
+  // the tags the geometry and the pixel description require; every tag
+  // past the last one of these, the pixel data in particular, is never
+  // visited, and the values of unselected tags in between are seeked
+  // over without reading them
+  std::set<gdcm::Tag> selectedTags = {
+    gdcm::Tag(0x0008, 0x0016), // SOP Class UID
+    gdcm::Tag(0x0008, 0x0060), // Modality
+    gdcm::Tag(0x0018, 0x0050), // Slice Thickness
+    gdcm::Tag(0x0018, 0x0088), // Spacing Between Slices
+    gdcm::Tag(0x0018, 0x1164), // Imager Pixel Spacing
+    gdcm::Tag(0x0020, 0x0032), // Image Position (Patient)
+    gdcm::Tag(0x0020, 0x0037), // Image Orientation (Patient)
+    gdcm::Tag(0x0028, 0x0002), // Samples per Pixel
+    gdcm::Tag(0x0028, 0x0004), // Photometric Interpretation
+    gdcm::Tag(0x0028, 0x0006), // Planar Configuration
+    gdcm::Tag(0x0028, 0x0008), // Number of Frames
+    gdcm::Tag(0x0028, 0x0010), // Rows
+    gdcm::Tag(0x0028, 0x0011), // Columns
+    gdcm::Tag(0x0028, 0x0030), // Pixel Spacing
+    gdcm::Tag(0x0028, 0x0100), // Bits Allocated
+    gdcm::Tag(0x0028, 0x0101), // Bits Stored
+    gdcm::Tag(0x0028, 0x0102), // High Bit
+    gdcm::Tag(0x0028, 0x0103), // Pixel Representation
+    gdcm::Tag(0x0028, 0x1052), // Rescale Intercept
+    gdcm::Tag(0x0028, 0x1053), // Rescale Slope
+  };
+  for (const std::string & tagString : m_LazyMetaDataTags)
+  {
+    unsigned int group = 0;
+    unsigned int element = 0;
+    if (sscanf(tagString.c_str(), "%x|%x", &group, &element) == 2)
+    {
+      selectedTags.insert(gdcm::Tag(group, element));
+    }
+    else
+    {
+      itkWarningMacro(<< "Ignoring tag \"" << tagString << "\", which is not in the \"group|element\" format");
+    }
+  }
+
+  gdcm::ImageHelper::SetForceRescaleInterceptSlope(true);
+
+  gdcm::Reader reader;
+  reader.SetFileName(m_FileName.c_str());
+  if (!reader.ReadSelectedTags(selectedTags))
+  {
+    itkExceptionMacro(<< "Cannot read requested file");
+  }
+  gdcm::File &          f = reader.GetFile();
+  const gdcm::DataSet & ds = f.GetDataSet();
+
+  const gdcm::PixelFormat pixeltype = gdcm::ImageHelper::GetPixelFormatValue(f);
+  if (pixeltype == gdcm::PixelFormat::SINGLEBIT)
+  {
+    m_SingleBit = true;
+    m_InternalComponentType = IOComponentEnum::UCHAR;
+  }
+  else
+  {
+    m_InternalComponentType = GDCMToITKComponentType(pixeltype.GetScalarType());
+    if (m_InternalComponentType == IOComponentEnum::UNKNOWNCOMPONENTTYPE)
+    {
+      itkExceptionMacro("Unhandled PixelFormat: " << pixeltype);
+    }
+  }
+
+  gdcm::PixelFormat::ScalarType outputpt = pixeltype.GetScalarType();
+  if (!m_SingleBit)
+  {
+    const std::vector<double> interceptSlope = gdcm::ImageHelper::GetRescaleInterceptSlopeValue(f);
+    m_RescaleIntercept = interceptSlope[0];
+    m_RescaleSlope = interceptSlope[1];
+    if (m_RescaleSlope != 1.0 || m_RescaleIntercept != 0.0)
+    {
+      gdcm::Rescaler r;
+      r.SetIntercept(m_RescaleIntercept);
+      r.SetSlope(m_RescaleSlope);
+      r.SetPixelFormat(pixeltype);
+      outputpt = r.ComputeInterceptSlopePixelType();
+    }
+  }
+  else
+  {
+    outputpt = gdcm::PixelFormat::UINT8;
+  }
+  m_ComponentType = GDCMToITKComponentType(outputpt);
+  if (m_ComponentType == IOComponentEnum::UNKNOWNCOMPONENTTYPE)
+  {
+    itkExceptionMacro("Unhandled PixelFormat: " << outputpt);
+  }
+
+  m_NumberOfComponents = pixeltype.GetSamplesPerPixel();
+
+  const gdcm::PhotometricInterpretation pi = gdcm::ImageHelper::GetPhotometricInterpretationValue(f);
+  if (pi == gdcm::PhotometricInterpretation::PALETTE_COLOR)
+  {
+    // PALETTE_COLOR is always expanded in RGB image
+    itkAssertInDebugAndIgnoreInReleaseMacro(m_NumberOfComponents == 1);
+    m_NumberOfComponents = 3;
+  }
+  if (m_NumberOfComponents == 1)
+  {
+    this->SetPixelType(IOPixelEnum::SCALAR);
+  }
+  else if (m_NumberOfComponents == 3)
+  {
+    const bool rgb_from_ybr =
+      m_ReadYBRtoRGB &&
+      (pi == gdcm::PhotometricInterpretation::YBR_FULL || pi == gdcm::PhotometricInterpretation::YBR_FULL_422) &&
+      (outputpt == gdcm::PixelFormat::UINT8 || outputpt == gdcm::PixelFormat::INT8);
+    const bool ybr_jp2 =
+      pi == gdcm::PhotometricInterpretation::YBR_ICT || pi == gdcm::PhotometricInterpretation::YBR_RCT;
+    const bool rgb = pi == gdcm::PhotometricInterpretation::RGB ||
+                     pi == gdcm::PhotometricInterpretation::PALETTE_COLOR || rgb_from_ybr || ybr_jp2;
+    if (rgb)
+    {
+      this->SetPixelType(IOPixelEnum::RGB);
+    }
+    else
+    {
+      this->SetPixelType(IOPixelEnum::VECTOR);
+    }
+  }
+  else
+  {
+    this->SetPixelType(IOPixelEnum::VECTOR);
+  }
+
+  const std::vector<unsigned int> dims = gdcm::ImageHelper::GetDimensionsValue(f);
+  m_Dimensions[0] = dims[0];
+  m_Dimensions[1] = dims[1];
+  m_Dimensions[2] = (dims.size() > 2) ? dims[2] : 1;
+
+  const std::vector<double> spacing = gdcm::ImageHelper::GetSpacingValue(f);
+  const std::vector<double> origin = gdcm::ImageHelper::GetOriginValue(f);
+  for (unsigned int i = 0; i < 3; ++i)
+  {
+    m_Spacing[i] = (i < spacing.size()) ? spacing[i] : 1.0;
+    m_Origin[i] = (i < origin.size()) ? origin[i] : 0.0;
+  }
+
+  const std::vector<double> dircos = gdcm::ImageHelper::GetDirectionCosinesValue(f);
+  vnl_vector<double>        rowDirection(3), columnDirection(3);
+  rowDirection[0] = dircos[0];
+  rowDirection[1] = dircos[1];
+  rowDirection[2] = dircos[2];
+
+  columnDirection[0] = dircos[3];
+  columnDirection[1] = dircos[4];
+  columnDirection[2] = dircos[5];
+
+  vnl_vector<double> sliceDirection = vnl_cross_3d(rowDirection, columnDirection);
+
+  // orthogonalize
+  sliceDirection.normalize();
+  rowDirection = vnl_cross_3d(columnDirection, sliceDirection).normalize();
+  columnDirection = vnl_cross_3d(sliceDirection, rowDirection);
+
+  this->SetDirection(0, rowDirection);
+  this->SetDirection(1, columnDirection);
+  this->SetDirection(2, sliceDirection);
+
+  // the dictionary ends up holding only the selected tags
+  MetaDataDictionary & dico = this->GetMetaDataDictionary();
+  dico.Clear();
+  CopyDataSetToDictionary(f, ds, dico, m_LoadPrivateTags);
+}
+
 void
 GDCMImageIO::ReadImageInformation()
 {
@@ -1604,6 +1838,7 @@ GDCMImageIO::PrintSelf(std::ostream & os, Indent indent) const
   os << indent << "RescaleIntercept: " << m_RescaleIntercept << std::endl;
   os << indent << "KeepOriginalUID:" << (m_KeepOriginalUID ? "On" : "Off") << std::endl;
   os << indent << "LoadPrivateTags:" << (m_LoadPrivateTags ? "On" : "Off") << std::endl;
+  os << indent << "UseLazyMetaData:" << (m_UseLazyMetaData ? "On" : "Off") << std::endl;
   os << indent << "UIDPrefix: " << m_UIDPrefix << std::endl;
   os << indent << "StudyInstanceUID: " << m_StudyInstanceUID << std::endl;
   os << indent << "SeriesInstanceUID: " << m_SeriesInstanceUID << std::endl;
@@ -17,13 +17,87 @@
  *=========================================================================*/
 
 #include "itkGDCMSeriesFileNames.h"
+#include "itksys/Directory.hxx"
 #include "itksys/SystemTools.hxx"
 #include "itkProgressReporter.h"
 #include "gdcmSerieHelper.h"
 
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
 namespace itk
 {
 
+namespace
+{
+
+constexpr const char * seriesIndexCacheMagic = "ITKGDCMSeriesIndex";
+constexpr unsigned int seriesIndexCacheVersion = 1;
+
+// One line of the validation section: the size, modification time and
+// path of a file in the input directory.
+struct SeriesIndexDirectoryEntry
+{
+  std::string   Path;
+  long int      ModifiedTime;
+  unsigned long Length;
+
+  bool
+  operator==(const SeriesIndexDirectoryEntry & other) const
+  {
+    return Path == other.Path && ModifiedTime == other.ModifiedTime && Length == other.Length;
+  }
+};
+
+// Collect all files below the given directory (sorted by path), except
+// the index file itself, recording what invalidates the index: the file
+// names, sizes and modification times. Much cheaper than parsing the
+// files, even for very large studies.
+void
+ListSeriesIndexDirectoryEntries(const std::string &                     directory,
+                                bool                                    recursive,
+                                const std::string &                     excludedFile,
+                                std::vector<SeriesIndexDirectoryEntry> & entries)
+{
+  itksys::Directory listing;
+  if (!listing.Load(directory))
+  {
+    return;
+  }
+  for (unsigned long i = 0; i < listing.GetNumberOfFiles(); ++i)
+  {
+    const std::string name = listing.GetFile(i);
+    if (name == "." || name == "..")
+    {
+      continue;
+    }
+    const std::string path = directory + '/' + name;
+    if (itksys::SystemTools::FileIsDirectory(path))
+    {
+      if (recursive)
+      {
+        ListSeriesIndexDirectoryEntries(path, recursive, excludedFile, entries);
+      }
+      continue;
+    }
+    if (itksys::SystemTools::CollapseFullPath(path) == excludedFile)
+    {
+      continue;
+    }
+    entries.push_back({ path,
+                        static_cast<long int>(itksys::SystemTools::ModifiedTime(path)),
+                        itksys::SystemTools::FileLength(path) });
+  }
+  std::sort(entries.begin(), entries.end(), [](const SeriesIndexDirectoryEntry & a, const SeriesIndexDirectoryEntry & b) {
+    return a.Path < b.Path;
+  });
+}
+
+} // namespace
+
 
 GDCMSeriesFileNames::GDCMSeriesFileNames()
   : m_SerieHelper{ new gdcm::SerieHelper() }
@@ -47,6 +121,7 @@ void
 GDCMSeriesFileNames::AddSeriesRestriction(const std::string & tag)
 {
   m_SerieHelper->AddRestriction(tag);
+  m_SeriesRestrictionTags.push_back(tag);
 }
 
 void
@@ -68,10 +143,24 @@ GDCMSeriesFileNames::SetInputDirectory(std::string const & name)
     return;
   }
   m_InputDirectory = name;
+  m_SeriesIndexCacheHit = false;
+  m_CachedSeriesUIDs.clear();
+  m_CachedSeriesFileNames.clear();
+  if (m_UseSeriesIndexCache && this->ReadSeriesIndexCache())
+  {
+    // the index is current, no header has to be parsed
+    m_SeriesIndexCacheHit = true;
+    this->Modified();
+    return;
+  }
   m_SerieHelper->Clear();
   m_SerieHelper->SetUseSeriesDetails(m_UseSeriesDetails);
   m_SerieHelper->SetLoadMode((m_LoadSequences ? 0 : gdcm::LD_NOSEQ) | (m_LoadPrivateTags ? 0 : gdcm::LD_NOSHADOW));
   m_SerieHelper->SetDirectory(name, m_Recursive);
+  if (m_UseSeriesIndexCache)
+  {
+    this->BuildAndWriteSeriesIndexCache();
+  }
   // as a side effect it also execute
   this->Modified();
 }
@@ -80,6 +169,11 @@ const GDCMSeriesFileNames::SeriesUIDContainerType &
 GDCMSeriesFileNames::GetSeriesUIDs()
 {
   m_SeriesUIDs.clear();
+  if (m_UseSeriesIndexCache && !m_CachedSeriesUIDs.empty())
+  {
+    m_SeriesUIDs = m_CachedSeriesUIDs;
+    return m_SeriesUIDs;
+  }
   // Accessing the first serie found (assume there is at least one)
   gdcm::FileList * flist = m_SerieHelper->GetFirstSingleSerieUIDFileSet();
   while (flist)
@@ -106,6 +200,19 @@ const GDCMSeriesFileNames::FileNamesContainerType &
 GDCMSeriesFileNames::GetFileNames(const std::string serie)
 {
   m_InputFileNames.clear();
+  if (m_UseSeriesIndexCache && !m_CachedSeriesUIDs.empty())
+  {
+    for (size_t i = 0; i < m_CachedSeriesUIDs.size(); ++i)
+    {
+      if (serie.empty() || m_CachedSeriesUIDs[i] == serie)
+      {
+        m_InputFileNames = m_CachedSeriesFileNames[i];
+        return m_InputFileNames;
+      }
+    }
+    itkWarningMacro(<< "No Series were found");
+    return m_InputFileNames;
+  }
   // Accessing the first serie found (assume there is at least one)
   gdcm::FileList * flist = m_SerieHelper->GetFirstSingleSerieUIDFileSet();
   if (!flist)
@@ -261,6 +368,194 @@ GDCMSeriesFileNames::GetOutputFileNames()
   return m_OutputFileNames;
 }
 
+std::string
+GDCMSeriesFileNames::GetActualSeriesIndexCacheFileName() const
+{
+  if (!m_SeriesIndexCacheFileName.empty())
+  {
+    return itksys::SystemTools::CollapseFullPath(m_SeriesIndexCacheFileName);
+  }
+  return itksys::SystemTools::CollapseFullPath(m_InputDirectory + "/.itkGDCMSeriesIndex");
+}
+
+bool
+GDCMSeriesFileNames::ReadSeriesIndexCache()
+{
+  const std::string cacheFileName = this->GetActualSeriesIndexCacheFileName();
+  std::ifstream     cacheFile(cacheFileName.c_str());
+  if (!cacheFile)
+  {
+    return false;
+  }
+
+  std::string  magic;
+  unsigned int version = 0;
+  cacheFile >> magic >> version;
+  cacheFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+  if (magic != seriesIndexCacheMagic || version != seriesIndexCacheVersion)
+  {
+    return false;
+  }
+
+  std::string keyword;
+  bool        recursive = false;
+  bool        useSeriesDetails = false;
+  cacheFile >> keyword >> recursive >> useSeriesDetails;
+  cacheFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+  if (keyword != "options" || recursive != m_Recursive || useSeriesDetails != m_UseSeriesDetails)
+  {
+    return false;
+  }
+
+  size_t count = 0;
+  cacheFile >> keyword >> count;
+  cacheFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+  if (keyword != "restrictions" || count != m_SeriesRestrictionTags.size())
+  {
+    return false;
+  }
+  for (size_t i = 0; i < count; ++i)
+  {
+    std::string tag;
+    if (!std::getline(cacheFile, tag) || tag != m_SeriesRestrictionTags[i])
+    {
+      return false;
+    }
+  }
+
+  cacheFile >> keyword >> count;
+  cacheFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+  if (keyword != "files")
+  {
+    return false;
+  }
+  std::vector<SeriesIndexDirectoryEntry> recordedEntries(count);
+  for (auto & entry : recordedEntries)
+  {
+    std::string line;
+    if (!std::getline(cacheFile, line))
+    {
+      return false;
+    }
+    std::istringstream lineStream(line);
+    lineStream >> entry.ModifiedTime >> entry.Length >> std::ws;
+    if (!std::getline(lineStream, entry.Path))
+    {
+      return false;
+    }
+  }
+
+  // the index is only valid while the directory holds exactly the
+  // recorded files, unchanged in size and modification time
+  std::vector<SeriesIndexDirectoryEntry> currentEntries;
+  ListSeriesIndexDirectoryEntries(m_InputDirectory, m_Recursive, cacheFileName, currentEntries);
+  if (currentEntries != recordedEntries)
+  {
+    return false;
+  }
+
+  size_t numberOfSeries = 0;
+  cacheFile >> keyword >> numberOfSeries;
+  cacheFile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+  if (keyword != "series")
+  {
+    return false;
+  }
+  for (size_t i = 0; i < numberOfSeries; ++i)
+  {
+    cacheFile >> keyword >> count >> std::ws;
+    std::string uid;
+    if (keyword != "serie" || !std::getline(cacheFile, uid))
+    {
+      return false;
+    }
+    FileNamesContainerType fileNames(count);
+    for (auto & fileName : fileNames)
+    {
+      if (!std::getline(cacheFile, fileName))
+      {
+        return false;
+      }
+    }
+    m_CachedSeriesUIDs.push_back(uid);
+    m_CachedSeriesFileNames.push_back(fileNames);
+  }
+  return true;
+}
+
+void
+GDCMSeriesFileNames::BuildAndWriteSeriesIndexCache()
+{
+  // order every series once and keep the result as the in-memory index
+  gdcm::FileList * flist = m_SerieHelper->GetFirstSingleSerieUIDFileSet();
+  while (flist)
+  {
+    if (!flist->empty())
+    {
+      const std::string uid = m_SerieHelper->CreateUniqueSeriesIdentifier((*flist)[0]).c_str();
+      m_SerieHelper->OrderFileList(flist);
+
+      FileNamesContainerType fileNames;
+      fileNames.reserve(flist->size());
+      for (gdcm::FileWithName * header : *flist)
+      {
+        fileNames.push_back(header->filename);
+      }
+      m_CachedSeriesUIDs.push_back(uid);
+      m_CachedSeriesFileNames.push_back(fileNames);
+    }
+    flist = m_SerieHelper->GetNextSingleSerieUIDFileSet();
+  }
+
+  const std::string cacheFileName = this->GetActualSeriesIndexCacheFileName();
+
+  std::vector<SeriesIndexDirectoryEntry> entries;
+  ListSeriesIndexDirectoryEntries(m_InputDirectory, m_Recursive, cacheFileName, entries);
+
+  // write through a temporary so a concurrent reader never sees a
+  // partial index
+  const std::string temporaryFileName = cacheFileName + ".tmp";
+  {
+    std::ofstream cacheFile(temporaryFileName.c_str(), std::ios::trunc);
+    if (!cacheFile)
+    {
+      itkWarningMacro(<< "Could not write the series index " << cacheFileName);
+      return;
+    }
+    cacheFile << seriesIndexCacheMagic << ' ' << seriesIndexCacheVersion << '\n';
+    cacheFile << "options " << m_Recursive << ' ' << m_UseSeriesDetails << '\n';
+    cacheFile << "restrictions " << m_SeriesRestrictionTags.size() << '\n';
+    for (const auto & tag : m_SeriesRestrictionTags)
+    {
+      cacheFile << tag << '\n';
+    }
+    cacheFile << "files " << entries.size() << '\n';
+    for (const auto & entry : entries)
+    {
+      cacheFile << entry.ModifiedTime << ' ' << entry.Length << ' ' << entry.Path << '\n';
+    }
+    cacheFile << "series " << m_CachedSeriesUIDs.size() << '\n';
+    for (size_t i = 0; i < m_CachedSeriesUIDs.size(); ++i)
+    {
+      cacheFile << "serie " << m_CachedSeriesFileNames[i].size() << ' ' << m_CachedSeriesUIDs[i] << '\n';
+      for (const auto & fileName : m_CachedSeriesFileNames[i])
+      {
+        cacheFile << fileName << '\n';
+      }
+    }
+    if (!cacheFile)
+    {
+      itkWarningMacro(<< "Could not write the series index " << cacheFileName);
+      return;
+    }
+  }
+  if (std::rename(temporaryFileName.c_str(), cacheFileName.c_str()) != 0)
+  {
+    itkWarningMacro(<< "Could not move the series index into place at " << cacheFileName);
+    itksys::SystemTools::RemoveFile(temporaryFileName);
+  }
+}
+
 void
 GDCMSeriesFileNames::PrintSelf(std::ostream & os, Indent indent) const
 {
@@ -270,6 +565,9 @@ GDCMSeriesFileNames::PrintSelf(std::ostream & os, Indent indent) const
   os << indent << "InputDirectory: " << m_InputDirectory << std::endl;
   os << indent << "LoadSequences:" << m_LoadSequences << std::endl;
   os << indent << "LoadPrivateTags:" << m_LoadPrivateTags << std::endl;
+  os << indent << "UseSeriesIndexCache:" << m_UseSeriesIndexCache << std::endl;
+  os << indent << "SeriesIndexCacheFileName: " << m_SeriesIndexCacheFileName << std::endl;
+  os << indent << "SeriesIndexCacheHit:" << m_SeriesIndexCacheHit << std::endl;
   if (m_Recursive)
   {
     os << indent << "Recursive: True" << std::endl;
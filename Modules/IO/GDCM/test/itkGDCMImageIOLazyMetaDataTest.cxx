@@ -0,0 +1,117 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkGDCMImageIO.h"
+#include "itkImageFileReader.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkMetaDataObject.h"
+#include "itkTestingMacros.h"
+
+// Verifies that the lazy metadata mode reproduces the geometry, pixel
+// description and pixel values of a full read while parsing only the
+// selected tags, and that whitelisted tags become available.
+
+int
+itkGDCMImageIOLazyMetaDataTest(int argc, char * argv[])
+{
+  if (argc < 2)
+  {
+    std::cerr << "Missing Parameters." << std::endl;
+    std::cerr << "Usage: " << itkNameOfTestExecutableMacro(argv) << " DicomImage" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  using ImageType = itk::Image<short, 3>;
+  using ReaderType = itk::ImageFileReader<ImageType>;
+
+  auto fullIO = itk::GDCMImageIO::New();
+  auto fullReader = ReaderType::New();
+  fullReader->SetFileName(argv[1]);
+  fullReader->SetImageIO(fullIO);
+  ITK_TRY_EXPECT_NO_EXCEPTION(fullReader->Update());
+
+  auto lazyIO = itk::GDCMImageIO::New();
+  lazyIO->UseLazyMetaDataOn();
+  ITK_TEST_EXPECT_TRUE(lazyIO->GetUseLazyMetaData());
+  auto lazyReader = ReaderType::New();
+  lazyReader->SetFileName(argv[1]);
+  lazyReader->SetImageIO(lazyIO);
+  ITK_TRY_EXPECT_NO_EXCEPTION(lazyReader->Update());
+
+  // same geometry and pixel description
+  ITK_TEST_EXPECT_TRUE(lazyReader->GetOutput()->GetOrigin() == fullReader->GetOutput()->GetOrigin());
+  ITK_TEST_EXPECT_TRUE(lazyReader->GetOutput()->GetSpacing() == fullReader->GetOutput()->GetSpacing());
+  ITK_TEST_EXPECT_TRUE(lazyReader->GetOutput()->GetDirection() == fullReader->GetOutput()->GetDirection());
+  ITK_TEST_EXPECT_TRUE(lazyReader->GetOutput()->GetLargestPossibleRegion() ==
+                       fullReader->GetOutput()->GetLargestPossibleRegion());
+  ITK_TEST_EXPECT_TRUE(lazyIO->GetComponentType() == fullIO->GetComponentType());
+  ITK_TEST_EXPECT_TRUE(lazyIO->GetPixelType() == fullIO->GetPixelType());
+
+  // same pixel values
+  itk::ImageRegionConstIterator<ImageType> fullIt(fullReader->GetOutput(),
+                                                  fullReader->GetOutput()->GetBufferedRegion());
+  itk::ImageRegionConstIterator<ImageType> lazyIt(lazyReader->GetOutput(),
+                                                  lazyReader->GetOutput()->GetBufferedRegion());
+  for (; !fullIt.IsAtEnd(); ++fullIt, ++lazyIt)
+  {
+    if (fullIt.Get() != lazyIt.Get())
+    {
+      std::cerr << "Pixel mismatch between full and lazy read." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // the lazy dictionary skips unselected tags; find one to whitelist
+  const itk::MetaDataDictionary & fullDictionary = fullIO->GetMetaDataDictionary();
+  const itk::MetaDataDictionary & lazyDictionary = lazyIO->GetMetaDataDictionary();
+  std::string                     skippedKey;
+  for (auto it = fullDictionary.Begin(); it != fullDictionary.End(); ++it)
+  {
+    if (!lazyDictionary.HasKey(it->first))
+    {
+      skippedKey = it->first;
+      break;
+    }
+  }
+  if (skippedKey.empty())
+  {
+    std::cerr << "Expected the lazy dictionary to skip at least one tag." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // whitelisting the skipped tag makes it available
+  auto whitelistIO = itk::GDCMImageIO::New();
+  whitelistIO->UseLazyMetaDataOn();
+  whitelistIO->AddLazyMetaDataTag(skippedKey);
+  ITK_TEST_EXPECT_EQUAL(whitelistIO->GetLazyMetaDataTags().size(), 1);
+  whitelistIO->SetFileName(argv[1]);
+  ITK_TRY_EXPECT_NO_EXCEPTION(whitelistIO->ReadImageInformation());
+
+  std::string fullValue;
+  std::string whitelistValue;
+  itk::ExposeMetaData<std::string>(fullDictionary, skippedKey, fullValue);
+  if (!itk::ExposeMetaData<std::string>(whitelistIO->GetMetaDataDictionary(), skippedKey, whitelistValue) ||
+      whitelistValue != fullValue)
+  {
+    std::cerr << "The whitelisted tag " << skippedKey << " was not read correctly." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,116 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkGDCMSeriesFileNames.h"
+#include "itkTestingMacros.h"
+#include "itksys/Directory.hxx"
+#include "itksys/SystemTools.hxx"
+
+// Copies a small DICOM series into a scratch directory and verifies
+// that the persistent series index returns the same series as a scan,
+// is reported as a hit only while the directory is unchanged, and falls
+// back to a scan after a file is removed.
+
+int
+itkGDCMSeriesIndexCacheTest(int argc, char * argv[])
+{
+  if (argc < 3)
+  {
+    std::cerr << "Missing Parameters." << std::endl;
+    std::cerr << "Usage: " << itkNameOfTestExecutableMacro(argv) << " DicomDirectory WorkDirectory" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  const std::string inputDirectory = argv[1];
+  const std::string workDirectory = argv[2];
+
+  itksys::SystemTools::RemoveADirectory(workDirectory);
+  itksys::SystemTools::MakeDirectory(workDirectory);
+
+  itksys::Directory listing;
+  if (!listing.Load(inputDirectory))
+  {
+    std::cerr << "Could not list " << inputDirectory << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::vector<std::string> copiedFiles;
+  for (unsigned long i = 0; i < listing.GetNumberOfFiles(); ++i)
+  {
+    const std::string name = listing.GetFile(i);
+    const std::string path = inputDirectory + '/' + name;
+    if (name == "." || name == ".." || itksys::SystemTools::FileIsDirectory(path))
+    {
+      continue;
+    }
+    const std::string copy = workDirectory + '/' + name;
+    if (!itksys::SystemTools::CopyFileAlways(path, copy))
+    {
+      std::cerr << "Could not copy " << path << std::endl;
+      return EXIT_FAILURE;
+    }
+    copiedFiles.push_back(copy);
+  }
+  if (copiedFiles.size() < 2)
+  {
+    std::cerr << "The input directory holds fewer than two files." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // reference result from a plain scan
+  auto scanNames = itk::GDCMSeriesFileNames::New();
+  scanNames->SetDirectory(workDirectory);
+  const std::vector<std::string> scanUIDs = scanNames->GetSeriesUIDs();
+  const std::vector<std::string> scanFiles = scanNames->GetInputFileNames();
+
+  // first use builds the index from a scan
+  auto buildNames = itk::GDCMSeriesFileNames::New();
+  buildNames->UseSeriesIndexCacheOn();
+  ITK_TEST_EXPECT_TRUE(buildNames->GetUseSeriesIndexCache());
+  buildNames->SetDirectory(workDirectory);
+  ITK_TEST_EXPECT_TRUE(!buildNames->GetSeriesIndexCacheHit());
+  ITK_TEST_EXPECT_TRUE(buildNames->GetSeriesUIDs() == scanUIDs);
+  ITK_TEST_EXPECT_TRUE(buildNames->GetInputFileNames() == scanFiles);
+  ITK_TEST_EXPECT_TRUE(itksys::SystemTools::FileExists(workDirectory + "/.itkGDCMSeriesIndex"));
+
+  // a fresh object is served from the index without parsing any header
+  auto cachedNames = itk::GDCMSeriesFileNames::New();
+  cachedNames->UseSeriesIndexCacheOn();
+  cachedNames->SetDirectory(workDirectory);
+  ITK_TEST_EXPECT_TRUE(cachedNames->GetSeriesIndexCacheHit());
+  ITK_TEST_EXPECT_TRUE(cachedNames->GetSeriesUIDs() == scanUIDs);
+  ITK_TEST_EXPECT_TRUE(cachedNames->GetInputFileNames() == scanFiles);
+  ITK_TEST_EXPECT_TRUE(cachedNames->GetFileNames(scanUIDs[0]) == scanFiles);
+
+  // changing the directory invalidates the index and falls back to a scan
+  itksys::SystemTools::RemoveFile(copiedFiles.back());
+  auto staleNames = itk::GDCMSeriesFileNames::New();
+  staleNames->UseSeriesIndexCacheOn();
+  staleNames->SetDirectory(workDirectory);
+  ITK_TEST_EXPECT_TRUE(!staleNames->GetSeriesIndexCacheHit());
+  ITK_TEST_EXPECT_EQUAL(staleNames->GetInputFileNames().size(), scanFiles.size() - 1);
+
+  // the rebuilt index reflects the new directory contents
+  auto rebuiltNames = itk::GDCMSeriesFileNames::New();
+  rebuiltNames->UseSeriesIndexCacheOn();
+  rebuiltNames->SetDirectory(workDirectory);
+  ITK_TEST_EXPECT_TRUE(rebuiltNames->GetSeriesIndexCacheHit());
+  ITK_TEST_EXPECT_TRUE(rebuiltNames->GetInputFileNames() == staleNames->GetInputFileNames());
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
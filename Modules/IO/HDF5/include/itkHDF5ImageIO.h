@@ -109,6 +109,22 @@ public:
   bool
   CanReadFile(const char * FileNameToRead) override;
 
+  /** Set/Get the size in bytes of the HDF5 chunk cache attached to the
+   * voxel dataset. Streamed reads of compressed volumes re-decode every
+   * chunk a division touches, so a cache large enough to hold a chunk row
+   * avoids repeated decompression. Zero keeps the HDF5 library default
+   * (1 MB). Takes effect at the next ReadImageInformation() call. */
+  itkSetMacro(ChunkCacheSize, SizeValueType);
+  itkGetConstMacro(ChunkCacheSize, SizeValueType);
+
+  /** Use multiple threads, each with its own HDF5 file handle, to read
+   * disjoint slabs of the requested region concurrently. Off by default.
+   * Honored only when the HDF5 library was built thread-safe; otherwise
+   * the regular single-handle read is used. */
+  itkSetMacro(UseParallelRead, bool);
+  itkGetConstMacro(UseParallelRead, bool);
+  itkBooleanMacro(UseParallelRead);
+
   /** Set the spacing and dimension information for the set filename. */
   void
   ReadImageInformation() override;
@@ -203,6 +219,9 @@ private:
   void
   SetupStreaming(H5::DataSpace * imageSpace, H5::DataSpace * slabSpace);
 
+  bool
+  ParallelRead(void * buffer);
+
   void
   CloseH5File();
   void
@@ -211,6 +230,8 @@ private:
   H5::H5File *  m_H5File{ nullptr };
   H5::DataSet * m_VoxelDataSet{ nullptr };
   bool          m_ImageInformationWritten{ false };
+  SizeValueType m_ChunkCacheSize{ 0 };
+  bool          m_UseParallelRead{ false };
 };
 } // end namespace itk
 
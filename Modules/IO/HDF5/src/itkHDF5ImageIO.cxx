@@ -19,10 +19,12 @@
 #include "itkHDF5ImageIO.h"
 #include "itkMetaDataObject.h"
 #include "itkArray.h"
+#include "itkMultiThreaderBase.h"
 #include "itksys/SystemTools.hxx"
 #include "itk_H5Cpp.h"
 
 #include <algorithm>
+#include <atomic>
 
 namespace itk
 {
@@ -55,6 +57,8 @@ HDF5ImageIO ::PrintSelf(std::ostream & os, Indent indent) const
   Superclass::PrintSelf(os, indent);
   // just prints out the pointer value.
   os << indent << "H5File: " << this->m_H5File << std::endl;
+  os << indent << "ChunkCacheSize: " << this->m_ChunkCacheSize << std::endl;
+  os << indent << "UseParallelRead: " << (this->m_UseParallelRead ? "On" : "Off") << std::endl;
 }
 
 //
@@ -259,6 +263,69 @@ doesAttrExist(const H5::H5Object & object, const char * const name)
   return (H5Aexists(object.getId(), name) > 0 ? true : false);
 }
 
+// file access property list carrying the requested chunk cache size;
+// zero keeps the HDF5 library default
+H5::FileAccPropList
+MakeFileAccPropList(SizeValueType chunkCacheSize)
+{
+  H5::FileAccPropList fapl;
+  if (chunkCacheSize > 0)
+  {
+    int    mdc_nelmts;
+    size_t rdcc_nslots;
+    size_t rdcc_nbytes;
+    double rdcc_w0;
+    fapl.getCache(mdc_nelmts, rdcc_nslots, rdcc_nbytes, rdcc_w0);
+    fapl.setCache(mdc_nelmts, rdcc_nslots, chunkCacheSize, rdcc_w0);
+  }
+  return fapl;
+}
+
+// select the hyperslab corresponding to an ImageIORegion on the image
+// dataspace and size the slab dataspace to match
+void
+SelectHyperslab(const ImageIORegion & region,
+                unsigned int          numberOfDimensions,
+                int                   numComponents,
+                H5::DataSpace *       imageSpace,
+                H5::DataSpace *       slabSpace)
+{
+  ImageIORegion::SizeType  size = region.GetSize();
+  ImageIORegion::IndexType start = region.GetIndex();
+
+  const int HDFDim(numberOfDimensions + (numComponents > 1 ? 1 : 0));
+
+  const std::unique_ptr<hsize_t[]> offset(new hsize_t[HDFDim]);
+  const std::unique_ptr<hsize_t[]> HDFSize(new hsize_t[HDFDim]);
+  const int                        limit = region.GetImageDimension();
+  //
+  // fastest moving dimension is intra-voxel
+  // index
+  int i = 0;
+  if (numComponents > 1)
+  {
+    offset[HDFDim - 1] = 0;
+    HDFSize[HDFDim - 1] = numComponents;
+    ++i;
+  }
+
+  for (int j = 0; j < limit && i < HDFDim; ++i, ++j)
+  {
+    offset[HDFDim - i - 1] = start[j];
+    HDFSize[HDFDim - i - 1] = size[j];
+  }
+
+  while (i < HDFDim)
+  {
+    offset[HDFDim - i - 1] = 0;
+    HDFSize[HDFDim - i - 1] = 1;
+    ++i;
+  }
+
+  slabSpace->setExtentSimple(HDFDim, HDFSize.get());
+  imageSpace->selectHyperslab(H5S_SELECT_SET, HDFSize.get(), offset.get());
+}
+
 } // namespace
 
 void
@@ -661,7 +728,8 @@ HDF5ImageIO ::ReadImageInformation()
   {
     this->CloseH5File();
     this->CloseDataSet();
-    this->m_H5File = new H5::H5File(this->GetFileName(), H5F_ACC_RDONLY);
+    this->m_H5File =
+      new H5::H5File(this->GetFileName(), H5F_ACC_RDONLY, H5::FileCreatPropList::DEFAULT, MakeFileAccPropList(this->m_ChunkCacheSize));
     this->m_VoxelDataSet = new H5::DataSet();
 
     // not sure what to do with this initially
@@ -908,51 +976,92 @@ HDF5ImageIO ::ReadImageInformation()
 void
 HDF5ImageIO ::SetupStreaming(H5::DataSpace * imageSpace, H5::DataSpace * slabSpace)
 {
-  ImageIORegion            regionToRead = this->GetIORegion();
-  ImageIORegion::SizeType  size = regionToRead.GetSize();
-  ImageIORegion::IndexType start = regionToRead.GetIndex();
-  //
-  int numComponents = this->GetNumberOfComponents();
-
-  const int HDFDim(this->GetNumberOfDimensions() + (numComponents > 1 ? 1 : 0));
+  SelectHyperslab(this->GetIORegion(), this->GetNumberOfDimensions(), this->GetNumberOfComponents(), imageSpace, slabSpace);
+}
 
-  const std::unique_ptr<hsize_t[]> offset(new hsize_t[HDFDim]);
-  const std::unique_ptr<hsize_t[]> HDFSize(new hsize_t[HDFDim]);
-  const int                        limit = regionToRead.GetImageDimension();
-  //
-  // fastest moving dimension is intra-voxel
-  // index
-  int i = 0;
-  if (numComponents > 1)
+bool
+HDF5ImageIO ::ParallelRead(void * buffer)
+{
+  hbool_t threadSafeLibrary{ 0 };
+  if (H5is_library_threadsafe(&threadSafeLibrary) < 0 || !threadSafeLibrary)
   {
-    offset[HDFDim - 1] = 0;
-    HDFSize[HDFDim - 1] = numComponents;
-    ++i;
+    return false;
+  }
+  const ThreadIdType numberOfWorkers = MultiThreaderBase::GetGlobalDefaultNumberOfThreads();
+  if (numberOfWorkers <= 1)
+  {
+    return false;
   }
 
-  for (int j = 0; j < limit && i < HDFDim; ++i, ++j)
+  const ImageIORegion regionToRead = this->GetIORegion();
+  const unsigned int  slowestDim = regionToRead.GetImageDimension() - 1;
+  const auto          slowestSize = static_cast<SizeValueType>(regionToRead.GetSize(slowestDim));
+  if (slowestSize < 2)
   {
-    offset[HDFDim - i - 1] = start[j];
-    HDFSize[HDFDim - i - 1] = size[j];
+    return false;
   }
+  const SizeValueType numberOfSlabs = std::min(static_cast<SizeValueType>(numberOfWorkers), slowestSize);
 
-  while (i < HDFDim)
+  // a slab is contiguous in the buffer: the split is along the
+  // slowest-moving image dimension
+  SizeValueType bytesPerSlice = static_cast<SizeValueType>(this->GetComponentSize()) * this->GetNumberOfComponents();
+  for (unsigned int i = 0; i < slowestDim; ++i)
   {
-    offset[HDFDim - i - 1] = 0;
-    HDFSize[HDFDim - i - 1] = 1;
-    ++i;
+    bytesPerSlice *= regionToRead.GetSize(i);
   }
 
-  slabSpace->setExtentSimple(HDFDim, HDFSize.get());
-  imageSpace->selectHyperslab(H5S_SELECT_SET, HDFSize.get(), offset.get());
+  std::string VoxelDataName(ImageGroup);
+  VoxelDataName += "/0";
+  VoxelDataName += VoxelData;
+
+  std::atomic<bool> failed{ false };
+
+  MultiThreaderBase::Pointer threader = MultiThreaderBase::New();
+  threader->ParallelizeArray(
+    0,
+    numberOfSlabs,
+    [&](SizeValueType slab) {
+      try
+      {
+        const SizeValueType sliceBegin = slab * slowestSize / numberOfSlabs;
+        const SizeValueType sliceEnd = (slab + 1) * slowestSize / numberOfSlabs;
+
+        ImageIORegion slabRegion = regionToRead;
+        slabRegion.SetIndex(slowestDim, regionToRead.GetIndex(slowestDim) + static_cast<IndexValueType>(sliceBegin));
+        slabRegion.SetSize(slowestDim, sliceEnd - sliceBegin);
+
+        // each worker uses its own file handle so the reads do not
+        // serialize on the shared dataset
+        H5::H5File file(
+          this->GetFileName(), H5F_ACC_RDONLY, H5::FileCreatPropList::DEFAULT, MakeFileAccPropList(this->m_ChunkCacheSize));
+        H5::DataSet   voxelDataSet = file.openDataSet(VoxelDataName);
+        H5::DataType  voxelType = voxelDataSet.getDataType();
+        H5::DataSpace imageSpace = voxelDataSet.getSpace();
+        H5::DataSpace slabSpace;
+        SelectHyperslab(slabRegion, this->GetNumberOfDimensions(), this->GetNumberOfComponents(), &imageSpace, &slabSpace);
+        voxelDataSet.read(static_cast<char *>(buffer) + sliceBegin * bytesPerSlice, voxelType, slabSpace, imageSpace);
+      }
+      catch (...)
+      {
+        failed = true;
+      }
+    },
+    nullptr);
+
+  if (failed)
+  {
+    itkExceptionMacro(<< "Parallel read of " << this->GetFileName() << " failed");
+  }
+  return true;
 }
 
 void
 HDF5ImageIO ::Read(void * buffer)
 {
-  ImageIORegion            regionToRead = this->GetIORegion();
-  ImageIORegion::SizeType  size = regionToRead.GetSize();
-  ImageIORegion::IndexType start = regionToRead.GetIndex();
+  if (this->m_UseParallelRead && this->ParallelRead(buffer))
+  {
+    return;
+  }
 
   H5::DataType  voxelType = this->m_VoxelDataSet->getDataType();
   H5::DataSpace imageSpace = this->m_VoxelDataSet->getSpace();
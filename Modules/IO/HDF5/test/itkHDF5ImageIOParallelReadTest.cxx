@@ -0,0 +1,110 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkHDF5ImageIO.h"
+#include "itkHDF5ImageIOFactory.h"
+#include "itkIOTestHelper.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkMath.h"
+
+// Writes a volume and reads it back once through the regular path and
+// once with UseParallelRead and an enlarged chunk cache, verifying both
+// reads agree. When the HDF5 library is not thread safe the parallel
+// request silently falls back to the single-handle read, so this test
+// is valid for either library configuration.
+
+template <typename TPixel>
+int
+HDF5ParallelReadTest(const char * fileName)
+{
+  using ImageType = itk::Image<TPixel, 3>;
+
+  typename ImageType::RegionType region;
+  region.SetSize(0, 37);
+  region.SetSize(1, 23);
+  region.SetSize(2, 16);
+  typename ImageType::SpacingType spacing;
+  spacing.Fill(1.0);
+  typename ImageType::Pointer image =
+    itk::IOTestHelper::AllocateImageFromRegionAndSpacing<ImageType>(region, spacing);
+  itk::ImageRegionIteratorWithIndex<ImageType> it(image, region);
+  for (it.GoToBegin(); !it.IsAtEnd(); ++it)
+  {
+    const typename ImageType::IndexType idx = it.GetIndex();
+    it.Set(static_cast<TPixel>(idx[2] * 100 + idx[1] * 10 + idx[0]));
+  }
+  itk::IOTestHelper::WriteImage<ImageType, itk::HDF5ImageIO>(image, std::string(fileName));
+
+  typename ImageType::Pointer serialImage = itk::IOTestHelper::ReadImage<ImageType>(std::string(fileName));
+
+  auto parallelIO = itk::HDF5ImageIO::New();
+  parallelIO->UseParallelReadOn();
+  parallelIO->SetChunkCacheSize(8 * 1024 * 1024);
+  if (!parallelIO->GetUseParallelRead() || parallelIO->GetChunkCacheSize() != 8 * 1024 * 1024)
+  {
+    std::cout << "Parallel read settings were not stored." << std::endl;
+    return EXIT_FAILURE;
+  }
+  using ReaderType = itk::ImageFileReader<ImageType>;
+  auto reader = ReaderType::New();
+  reader->SetFileName(fileName);
+  reader->SetImageIO(parallelIO);
+  try
+  {
+    reader->Update();
+  }
+  catch (const itk::ExceptionObject & err)
+  {
+    std::cout << "itkHDF5ImageIOParallelReadTest" << std::endl
+              << "Exception Object caught: " << std::endl
+              << err << std::endl;
+    return EXIT_FAILURE;
+  }
+  typename ImageType::Pointer parallelImage = reader->GetOutput();
+
+  itk::ImageRegionIteratorWithIndex<ImageType> serialIt(serialImage, serialImage->GetBufferedRegion());
+  for (serialIt.GoToBegin(); !serialIt.IsAtEnd(); ++serialIt)
+  {
+    if (itk::Math::NotAlmostEquals(serialIt.Get(), parallelImage->GetPixel(serialIt.GetIndex())))
+    {
+      std::cout << "Serial Pixel (" << serialIt.Get() << ") doesn't match parallel-read Pixel ("
+                << parallelImage->GetPixel(serialIt.GetIndex()) << ") at " << serialIt.GetIndex() << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  itk::IOTestHelper::Remove(fileName);
+  return EXIT_SUCCESS;
+}
+
+int
+itkHDF5ImageIOParallelReadTest(int ac, char * av[])
+{
+  std::string prefix("");
+  if (ac > 1)
+  {
+    prefix = *++av;
+    --ac;
+    itksys::SystemTools::ChangeDirectory(prefix.c_str());
+  }
+  itk::ObjectFactoryBase::RegisterFactory(itk::HDF5ImageIOFactory::New());
+
+  int result(0);
+  result += HDF5ParallelReadTest<unsigned char>("ParallelUCharImage.hdf5");
+  result += HDF5ParallelReadTest<float>("ParallelFloatImage.hdf5");
+  return result != 0;
+}
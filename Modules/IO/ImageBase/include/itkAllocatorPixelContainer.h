@@ -0,0 +1,92 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkAllocatorPixelContainer_h
+#define itkAllocatorPixelContainer_h
+
+#include "itkImportImageContainer.h"
+#include "itkBufferAllocatorBase.h"
+
+namespace itk
+{
+/** \class AllocatorPixelContainer
+ * \brief A pixel container whose buffer comes from a BufferAllocatorBase.
+ *
+ * The container behaves like an ImportImageContainer whose imported
+ * buffer was obtained from a user-supplied allocation policy — pinned
+ * host memory, for example — instead of new[]. The allocator is held by
+ * smart pointer and its DeallocateBuffer is invoked when the container
+ * is destroyed or reallocated.
+ *
+ * ImageFileReader attaches this container to its output when a
+ * BufferAllocator has been set on the reader.
+ *
+ * \sa BufferAllocatorBase
+ * \sa ImportImageContainer
+ * \ingroup ImageObjects
+ * \ingroup IOFilters
+ * \ingroup ITKIOImageBase
+ */
+template <typename TElementIdentifier, typename TElement>
+class ITK_TEMPLATE_EXPORT AllocatorPixelContainer : public ImportImageContainer<TElementIdentifier, TElement>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(AllocatorPixelContainer);
+
+  /** Standard class type aliases. */
+  using Self = AllocatorPixelContainer;
+  using Superclass = ImportImageContainer<TElementIdentifier, TElement>;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Save the template parameters. */
+  using ElementIdentifier = TElementIdentifier;
+  using Element = TElement;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Standard part of every itk Object. */
+  itkTypeMacro(AllocatorPixelContainer, ImportImageContainer);
+
+  /** Obtain a buffer for numberOfElements elements from the given
+   * allocator and adopt it as the container's buffer. Throws a
+   * MemoryAllocationError when the allocator returns nullptr. */
+  void
+  AllocateFromAllocator(BufferAllocatorBase * allocator, ElementIdentifier numberOfElements);
+
+protected:
+  AllocatorPixelContainer() = default;
+  ~AllocatorPixelContainer() override = default;
+
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+  /** Return the buffer to the allocator instead of delete[]-ing it. */
+  void
+  DeallocateManagedMemory() override;
+
+private:
+  BufferAllocatorBase::Pointer m_Allocator;
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkAllocatorPixelContainer.hxx"
+#endif
+
+#endif
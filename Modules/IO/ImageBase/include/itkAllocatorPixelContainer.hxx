@@ -0,0 +1,72 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkAllocatorPixelContainer_hxx
+#define itkAllocatorPixelContainer_hxx
+
+#include "itkAllocatorPixelContainer.h"
+
+namespace itk
+{
+
+template <typename TElementIdentifier, typename TElement>
+void
+AllocatorPixelContainer<TElementIdentifier, TElement>::AllocateFromAllocator(BufferAllocatorBase * allocator,
+                                                                             ElementIdentifier     numberOfElements)
+{
+  void * buffer = allocator->AllocateBuffer(static_cast<SizeValueType>(numberOfElements) * sizeof(Element));
+  if (buffer == nullptr)
+  {
+    throw MemoryAllocationError(__FILE__, __LINE__, "Failed to allocate memory for image.", ITK_LOCATION);
+  }
+
+  // Release any previous buffer before adopting the new one; passing
+  // LetContainerManageMemory routes the release of the new buffer
+  // through our DeallocateManagedMemory override.
+  this->SetImportPointer(static_cast<Element *>(buffer), numberOfElements, true);
+  m_Allocator = allocator;
+}
+
+template <typename TElementIdentifier, typename TElement>
+void
+AllocatorPixelContainer<TElementIdentifier, TElement>::DeallocateManagedMemory()
+{
+  if (m_Allocator.IsNotNull())
+  {
+    m_Allocator->DeallocateBuffer(this->GetImportPointer());
+    m_Allocator = nullptr;
+    this->SetImportPointer(nullptr);
+    this->SetCapacity(0);
+    this->SetSize(0);
+  }
+  else
+  {
+    Superclass::DeallocateManagedMemory();
+  }
+}
+
+template <typename TElementIdentifier, typename TElement>
+void
+AllocatorPixelContainer<TElementIdentifier, TElement>::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+  itkPrintSelfObjectMacro(Allocator);
+}
+
+} // end namespace itk
+
+#endif
@@ -0,0 +1,75 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkBufferAllocatorBase_h
+#define itkBufferAllocatorBase_h
+
+#include "ITKIOImageBaseExport.h"
+#include "itkObject.h"
+#include "itkObjectFactory.h"
+
+namespace itk
+{
+/** \class BufferAllocatorBase
+ * \brief Allocation policy for the destination pixel buffer of a read.
+ *
+ * An allocator set on ImageFileReader supplies the memory the image
+ * data is read into, replacing the default new[] allocation of the
+ * output pixel container. Subclasses can return pinned (page-locked)
+ * host memory or device-mapped memory so a subsequent GPU upload runs
+ * at DMA speed without an intermediate copy.
+ *
+ * The buffer returned by AllocateBuffer must be suitably aligned for
+ * any pixel component type. DeallocateBuffer is called from the pixel
+ * container's destructor, so the allocator must outlive every image it
+ * provided memory for — holding it by smart pointer, as the container
+ * does, guarantees this.
+ *
+ * \sa ImageFileReader
+ * \sa AllocatorPixelContainer
+ * \ingroup IOFilters
+ * \ingroup ITKIOImageBase
+ */
+class ITKIOImageBase_EXPORT BufferAllocatorBase : public Object
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(BufferAllocatorBase);
+
+  /** Standard class type aliases. */
+  using Self = BufferAllocatorBase;
+  using Superclass = Object;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(BufferAllocatorBase, Object);
+
+  /** Allocate numberOfBytes bytes. Returns nullptr on failure. */
+  virtual void *
+  AllocateBuffer(SizeValueType numberOfBytes) = 0;
+
+  /** Release a buffer previously returned by AllocateBuffer. */
+  virtual void
+  DeallocateBuffer(void * buffer) = 0;
+
+protected:
+  BufferAllocatorBase() = default;
+  ~BufferAllocatorBase() override = default;
+};
+} // end namespace itk
+
+#endif
@@ -0,0 +1,187 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkBulkAsciiReader_h
+#define itkBulkAsciiReader_h
+#include "ITKIOImageBaseExport.h"
+
+#include "itkIntTypes.h"
+#include "itkMacro.h"
+#include "itkMultiThreaderBase.h"
+
+#include <cctype>
+#include <cstdlib>
+#include <istream>
+#include <type_traits>
+#include <vector>
+
+namespace itk
+{
+namespace BulkAsciiReaderDetail
+{
+/** Convert one null-terminated token to a numeric value. The tokens of
+ * the legacy ASCII formats these helpers serve (VTK and friends) use
+ * the classic "C" numeric syntax, so the conversion is done with the
+ * char-level strto* family instead of stream extraction. */
+inline void
+ConvertToken(const char * token, float & value)
+{
+  value = std::strtof(token, nullptr);
+}
+
+inline void
+ConvertToken(const char * token, double & value)
+{
+  value = std::strtod(token, nullptr);
+}
+
+inline void
+ConvertToken(const char * token, long double & value)
+{
+  value = std::strtold(token, nullptr);
+}
+
+template <typename TInteger>
+inline void
+ConvertToken(const char * token, TInteger & value)
+{
+  static_assert(std::is_integral<TInteger>::value, "ConvertToken only handles arithmetic types");
+  if (std::is_signed<TInteger>::value)
+  {
+    value = static_cast<TInteger>(std::strtoll(token, nullptr, 10));
+  }
+  else
+  {
+    value = static_cast<TInteger>(std::strtoull(token, nullptr, 10));
+  }
+}
+} // namespace BulkAsciiReaderDetail
+
+/** Read \a count whitespace-separated numeric values from \a is into
+ * \a buffer.
+ *
+ * The stream is consumed in multi-megabyte chunks which are tokenized
+ * in memory and converted with locale-classic char-level parsers, so no
+ * per-value stream extraction or virtual call is made; large chunks are
+ * converted in parallel. This makes ASCII payload parsing IO bound
+ * instead of tokenization bound.
+ *
+ * On return the stream is positioned directly after the last value
+ * consumed, so interleaved header lines following the values can be
+ * read as before. Throws when the stream ends before \a count values
+ * were found. The stream must count positions in bytes (open file
+ * streams in binary mode). \a chunkSize only needs to be lowered for
+ * testing the chunk boundary handling.
+ */
+template <typename TValue>
+void
+ReadBulkAsciiValues(std::istream & is,
+                    TValue *       buffer,
+                    SizeValueType  count,
+                    SizeValueType  chunkSize = SizeValueType{ 1 } << 22)
+{
+  constexpr SizeValueType parallelThreshold = SizeValueType{ 1 } << 15;
+
+  std::vector<char>   chunk(chunkSize + 1);
+  std::vector<char *> tokens;
+  SizeValueType       valuesRead = 0;
+
+  while (valuesRead < count)
+  {
+    is.read(chunk.data(), static_cast<std::streamsize>(chunkSize));
+    const auto bytesRead = static_cast<SizeValueType>(is.gcount());
+    if (bytesRead == 0)
+    {
+      itkGenericExceptionMacro("Premature end of stream: expected " << count << " ASCII values but found "
+                                                                    << valuesRead << '.');
+    }
+    const bool lastChunk = bytesRead < chunkSize;
+    chunk[bytesRead] = '\0';
+
+    // Tokenize no more values than still needed; null-terminate each
+    // token in place. A trailing token possibly cut off by the chunk
+    // boundary is pushed back to the next pass.
+    tokens.clear();
+    SizeValueType pos = 0;
+    SizeValueType consumedEnd = 0;
+    while (tokens.size() < count - valuesRead && pos < bytesRead)
+    {
+      while (pos < bytesRead && std::isspace(static_cast<unsigned char>(chunk[pos])))
+      {
+        ++pos;
+      }
+      if (pos == bytesRead)
+      {
+        break;
+      }
+      const SizeValueType tokenStart = pos;
+      while (pos < bytesRead && !std::isspace(static_cast<unsigned char>(chunk[pos])))
+      {
+        ++pos;
+      }
+      if (pos == bytesRead && !lastChunk)
+      {
+        pos = tokenStart;
+        break;
+      }
+      tokens.push_back(&chunk[tokenStart]);
+      consumedEnd = pos;
+      if (pos < bytesRead)
+      {
+        chunk[pos] = '\0';
+        ++pos;
+      }
+    }
+
+    const auto    numberOfTokens = static_cast<SizeValueType>(tokens.size());
+    TValue *      values = buffer + valuesRead;
+    char * const * tokenData = tokens.data();
+    if (numberOfTokens >= parallelThreshold && MultiThreaderBase::GetGlobalDefaultNumberOfThreads() > 1)
+    {
+      MultiThreaderBase::Pointer threader = MultiThreaderBase::New();
+      threader->ParallelizeArray(
+        0,
+        numberOfTokens,
+        [tokenData, values](SizeValueType ii) { BulkAsciiReaderDetail::ConvertToken(tokenData[ii], values[ii]); },
+        nullptr);
+    }
+    else
+    {
+      for (SizeValueType ii = 0; ii < numberOfTokens; ++ii)
+      {
+        BulkAsciiReaderDetail::ConvertToken(tokenData[ii], values[ii]);
+      }
+    }
+    valuesRead += numberOfTokens;
+
+    if (valuesRead == count)
+    {
+      // leave the stream directly after the last consumed value
+      is.clear();
+      is.seekg(-static_cast<std::streamoff>(bytesRead - consumedEnd), std::ios::cur);
+    }
+    else if (pos < bytesRead)
+    {
+      // re-read the token cut off by the chunk boundary
+      is.clear();
+      is.seekg(-static_cast<std::streamoff>(bytesRead - pos), std::ios::cur);
+    }
+  }
+}
+} // end namespace itk
+
+#endif // itkBulkAsciiReader_h
@@ -0,0 +1,113 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkChunkCompressorBase_h
+#define itkChunkCompressorBase_h
+#include "ITKIOImageBaseExport.h"
+
+#include "itkObject.h"
+#include "itkIntTypes.h"
+
+#include <vector>
+
+namespace itk
+{
+/** \class ChunkCompressorBase
+ * \brief Thread-pooled chunk compression engine for image IO classes.
+ *
+ * The input buffer is cut into fixed-size chunks which are compressed
+ * concurrently through the global thread pool, each as an independently
+ * decodable stream. The compressed chunks are concatenated in order and
+ * the per-chunk compressed sizes are reported back, so an ImageIO class
+ * can persist them and later decompress the chunks concurrently as well.
+ *
+ * The codec is supplied by a subclass through CompressChunk() and
+ * DecompressChunk(), which must be callable concurrently from multiple
+ * threads. The meaning and range of the compression level are
+ * codec-specific and documented by the subclass.
+ *
+ * \sa GzipChunkCompressor
+ * \sa ImageIOBase
+ * \ingroup IOFilters
+ * \ingroup ITKIOImageBase
+ */
+class ITKIOImageBase_EXPORT ChunkCompressorBase : public Object
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(ChunkCompressorBase);
+
+  /** Standard class type aliases. */
+  using Self = ChunkCompressorBase;
+  using Superclass = Object;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(ChunkCompressorBase, Object);
+
+  /** The compressed size of each chunk, in chunk order. */
+  using ChunkSizesType = std::vector<SizeValueType>;
+
+  /** Set/Get the number of uncompressed bytes per chunk. Smaller chunks
+   * expose more parallelism but compress slightly worse; the default of
+   * 1 MB is far above typical codec window sizes, so the size penalty
+   * against a single stream is negligible. */
+  itkSetMacro(ChunkSize, SizeValueType);
+  itkGetConstMacro(ChunkSize, SizeValueType);
+
+  /** Set/Get the codec-specific compression level, trading compression
+   * ratio for speed. A negative value selects the codec default. */
+  itkSetMacro(CompressionLevel, int);
+  itkGetConstMacro(CompressionLevel, int);
+
+  /** Compress the input buffer chunk by chunk into the given vector,
+   * recording the compressed size of each chunk. Throws when the codec
+   * fails. */
+  void
+  Compress(const void * input, SizeValueType inputSize, std::vector<char> & compressed, ChunkSizesType & chunkSizes);
+
+  /** Decompress chunks produced by Compress() with the same ChunkSize,
+   * concurrently, straight into the output buffer. The chunk sizes must
+   * be the ones Compress() reported and outputSize the original input
+   * size; a mismatch or a codec failure throws. */
+  void
+  Decompress(const void * compressed, const ChunkSizesType & chunkSizes, void * output, SizeValueType outputSize);
+
+protected:
+  ChunkCompressorBase() = default;
+  ~ChunkCompressorBase() override = default;
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+  /** Compress one chunk as an independently decodable stream. Returns
+   * false on codec failure. Called concurrently from multiple threads. */
+  virtual bool
+  CompressChunk(const char * input, SizeValueType inputSize, std::vector<char> & chunk) = 0;
+
+  /** Decompress one chunk, which must expand to exactly outputSize
+   * bytes. Returns false on codec failure. Called concurrently from
+   * multiple threads. */
+  virtual bool
+  DecompressChunk(const char * input, SizeValueType inputSize, char * output, SizeValueType outputSize) = 0;
+
+private:
+  SizeValueType m_ChunkSize{ SizeValueType{ 1 } << 20 };
+  int           m_CompressionLevel{ -1 };
+};
+} // end namespace itk
+
+#endif // itkChunkCompressorBase_h
@@ -160,6 +160,19 @@ protected:
                                  OutputPixelType * outputData,
                                  size_t            size);
 
+  /** Run one of the per-range conversion functions over the whole buffer,
+   * processing chunks of the buffer in parallel when it is large enough to
+   * amortize the threading overhead. The convert argument is called as
+   * convert(inputData, outputData, size) on each chunk. Each conversion
+   * consumes inputStride input components and produces one output element. */
+  template <typename TConvertFunction>
+  static void
+  ParallelConvert(TConvertFunction  convert,
+                  InputPixelType *  inputData,
+                  size_t            inputStride,
+                  OutputPixelType * outputData,
+                  size_t            size);
+
   /** the most common case, where InputComponentType == unsigned
    *  char, the alpha is in the range 0..255. I presume in the
    *  mythical world of rgba<X> for all integral scalar types X, alpha
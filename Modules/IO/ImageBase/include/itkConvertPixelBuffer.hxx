@@ -21,6 +21,8 @@
 
 #include "itkRGBPixel.h"
 #include "itkDefaultConvertPixelTraits.h"
+#include "itkMultiThreaderBase.h"
+#include <algorithm>
 #include <cstddef>
 
 
@@ -43,6 +45,39 @@ ConvertPixelBuffer<InputPixelType, OutputPixelType, OutputConvertTraits>::Defaul
   return NumericTraits<UComponentType>::max();
 }
 
+template <typename InputPixelType, typename OutputPixelType, typename OutputConvertTraits>
+template <typename TConvertFunction>
+void
+ConvertPixelBuffer<InputPixelType, OutputPixelType, OutputConvertTraits>::ParallelConvert(TConvertFunction convert,
+                                                                                          InputPixelType * inputData,
+                                                                                          size_t           inputStride,
+                                                                                          OutputPixelType * outputData,
+                                                                                          size_t            size)
+{
+  // Buffers below this size are converted on the calling thread; the
+  // conversion is a simple sweep and threading only pays off once the buffer
+  // no longer fits the cost of spinning up the work units.
+  constexpr size_t minimumChunkSize = 65536;
+
+  const size_t numberOfWorkUnits = MultiThreaderBase::GetGlobalDefaultNumberOfThreads();
+  const size_t numberOfChunks = std::min(numberOfWorkUnits, size / minimumChunkSize);
+  if (numberOfChunks < 2)
+  {
+    convert(inputData, outputData, size);
+    return;
+  }
+
+  MultiThreaderBase::New()->ParallelizeArray(
+    0,
+    numberOfChunks,
+    [&](SizeValueType chunk) {
+      const size_t chunkBegin = size * chunk / numberOfChunks;
+      const size_t chunkEnd = size * (chunk + 1) / numberOfChunks;
+      convert(inputData + chunkBegin * inputStride, outputData + chunkBegin, chunkEnd - chunkBegin);
+    },
+    nullptr);
+}
+
 template <typename InputPixelType, typename OutputPixelType, typename OutputConvertTraits>
 void
 ConvertPixelBuffer<InputPixelType, OutputPixelType, OutputConvertTraits>::Convert(InputPixelType * inputData,
@@ -58,16 +93,23 @@ ConvertPixelBuffer<InputPixelType, OutputPixelType, OutputConvertTraits>::Conver
       switch (inputNumberOfComponents)
       {
         case 1:
-          ConvertGrayToGray(inputData, outputData, size);
+          ParallelConvert(&Self::ConvertGrayToGray, inputData, 1, outputData, size);
           break;
         case 3:
-          ConvertRGBToGray(inputData, outputData, size);
+          ParallelConvert(&Self::ConvertRGBToGray, inputData, 3, outputData, size);
           break;
         case 4:
-          ConvertRGBAToGray(inputData, outputData, size);
+          ParallelConvert(&Self::ConvertRGBAToGray, inputData, 4, outputData, size);
           break;
         default:
-          ConvertMultiComponentToGray(inputData, inputNumberOfComponents, outputData, size);
+          ParallelConvert(
+            [inputNumberOfComponents](InputPixelType * in, OutputPixelType * out, size_t n) {
+              ConvertMultiComponentToGray(in, inputNumberOfComponents, out, n);
+            },
+            inputData,
+            static_cast<size_t>(inputNumberOfComponents),
+            outputData,
+            size);
           break;
       }
       break;
@@ -78,13 +120,20 @@ ConvertPixelBuffer<InputPixelType, OutputPixelType, OutputConvertTraits>::Conver
       switch (inputNumberOfComponents)
       {
         case 1:
-          ConvertGrayToComplex(inputData, outputData, size);
+          ParallelConvert(&Self::ConvertGrayToComplex, inputData, 1, outputData, size);
           break;
         case 2:
-          ConvertComplexToComplex(inputData, outputData, size);
+          ParallelConvert(&Self::ConvertComplexToComplex, inputData, 2, outputData, size);
           break;
         default:
-          ConvertMultiComponentToComplex(inputData, inputNumberOfComponents, outputData, size);
+          ParallelConvert(
+            [inputNumberOfComponents](InputPixelType * in, OutputPixelType * out, size_t n) {
+              ConvertMultiComponentToComplex(in, inputNumberOfComponents, out, n);
+            },
+            inputData,
+            static_cast<size_t>(inputNumberOfComponents),
+            outputData,
+            size);
           break;
       }
       break;
@@ -96,16 +145,23 @@ ConvertPixelBuffer<InputPixelType, OutputPixelType, OutputConvertTraits>::Conver
       switch (inputNumberOfComponents)
       {
         case 1:
-          ConvertGrayToRGB(inputData, outputData, size);
+          ParallelConvert(&Self::ConvertGrayToRGB, inputData, 1, outputData, size);
           break;
         case 3:
-          ConvertRGBToRGB(inputData, outputData, size);
+          ParallelConvert(&Self::ConvertRGBToRGB, inputData, 3, outputData, size);
           break;
         case 4:
-          ConvertRGBAToRGB(inputData, outputData, size);
+          ParallelConvert(&Self::ConvertRGBAToRGB, inputData, 4, outputData, size);
           break;
         default:
-          ConvertMultiComponentToRGB(inputData, inputNumberOfComponents, outputData, size);
+          ParallelConvert(
+            [inputNumberOfComponents](InputPixelType * in, OutputPixelType * out, size_t n) {
+              ConvertMultiComponentToRGB(in, inputNumberOfComponents, out, n);
+            },
+            inputData,
+            static_cast<size_t>(inputNumberOfComponents),
+            outputData,
+            size);
       }
       break;
     }
@@ -115,16 +171,23 @@ ConvertPixelBuffer<InputPixelType, OutputPixelType, OutputConvertTraits>::Conver
       switch (inputNumberOfComponents)
       {
         case 1:
-          ConvertGrayToRGBA(inputData, outputData, size);
+          ParallelConvert(&Self::ConvertGrayToRGBA, inputData, 1, outputData, size);
           break;
         case 3:
-          ConvertRGBToRGBA(inputData, outputData, size);
+          ParallelConvert(&Self::ConvertRGBToRGBA, inputData, 3, outputData, size);
           break;
         case 4:
-          ConvertRGBAToRGBA(inputData, outputData, size);
+          ParallelConvert(&Self::ConvertRGBAToRGBA, inputData, 4, outputData, size);
           break;
         default:
-          ConvertMultiComponentToRGBA(inputData, inputNumberOfComponents, outputData, size);
+          ParallelConvert(
+            [inputNumberOfComponents](InputPixelType * in, OutputPixelType * out, size_t n) {
+              ConvertMultiComponentToRGBA(in, inputNumberOfComponents, out, n);
+            },
+            inputData,
+            static_cast<size_t>(inputNumberOfComponents),
+            outputData,
+            size);
       }
       break;
     }
@@ -134,10 +197,10 @@ ConvertPixelBuffer<InputPixelType, OutputPixelType, OutputConvertTraits>::Conver
       switch (inputNumberOfComponents)
       {
         case 6:
-          ConvertTensor6ToTensor6(inputData, outputData, size);
+          ParallelConvert(&Self::ConvertTensor6ToTensor6, inputData, 6, outputData, size);
           break;
         case 9:
-          ConvertTensor9ToTensor6(inputData, outputData, size);
+          ParallelConvert(&Self::ConvertTensor9ToTensor6, inputData, 9, outputData, size);
           break;
         default:
           itkGenericExceptionMacro("No conversion available from " << inputNumberOfComponents
@@ -591,12 +654,21 @@ ConvertPixelBuffer<InputPixelType, OutputPixelType, OutputConvertTraits>::Conver
 {
   size_t length = size * (size_t)inputNumberOfComponents;
 
-  for (size_t i = 0; i < length; ++i)
-  {
-    OutputConvertTraits::SetNthComponent(0, *outputData, static_cast<OutputComponentType>(*inputData));
-    ++outputData;
-    ++inputData;
-  }
+  // Each component is converted independently, so the buffer can be chunked
+  // at component granularity
+  ParallelConvert(
+    [](InputPixelType * in, OutputPixelType * out, size_t n) {
+      for (size_t i = 0; i < n; ++i)
+      {
+        OutputConvertTraits::SetNthComponent(0, *out, static_cast<OutputComponentType>(*in));
+        ++out;
+        ++in;
+      }
+    },
+    inputData,
+    1,
+    outputData,
+    length);
 }
 } // end namespace itk
 
@@ -0,0 +1,71 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkGzipChunkCompressor_h
+#define itkGzipChunkCompressor_h
+#include "ITKIOImageBaseExport.h"
+
+#include "itkChunkCompressorBase.h"
+#include "itkObjectFactory.h"
+
+namespace itk
+{
+/** \class GzipChunkCompressor
+ * \brief Chunk compression codec producing standard gzip members.
+ *
+ * Each chunk is deflated as a complete gzip (RFC 1952) member. Since
+ * concatenated gzip members form a single valid gzip stream, the
+ * concatenation produced by Compress() can also be inflated by any
+ * regular gzip decoder that does not know the chunk layout.
+ *
+ * The compression level follows zlib: 1 is fastest, 9 compresses best,
+ * and a negative value selects the zlib default.
+ *
+ * \sa ChunkCompressorBase
+ * \ingroup IOFilters
+ * \ingroup ITKIOImageBase
+ */
+class ITKIOImageBase_EXPORT GzipChunkCompressor : public ChunkCompressorBase
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(GzipChunkCompressor);
+
+  /** Standard class type aliases. */
+  using Self = GzipChunkCompressor;
+  using Superclass = ChunkCompressorBase;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(GzipChunkCompressor, ChunkCompressorBase);
+
+protected:
+  GzipChunkCompressor() = default;
+  ~GzipChunkCompressor() override = default;
+
+  bool
+  CompressChunk(const char * input, SizeValueType inputSize, std::vector<char> & chunk) override;
+
+  bool
+  DecompressChunk(const char * input, SizeValueType inputSize, char * output, SizeValueType outputSize) override;
+};
+} // end namespace itk
+
+#endif // itkGzipChunkCompressor_h
@@ -21,6 +21,7 @@
 
 #include "ITKIOImageBaseExport.h"
 
+#include "itkBufferAllocatorBase.h"
 #include "itkImageIOBase.h"
 #include "itkImageSource.h"
 #include "itkMacro.h"
@@ -118,6 +119,26 @@ public:
   itkGetConstReferenceMacro(UseStreaming, bool);
   itkBooleanMacro(UseStreaming);
 
+  /** Use a zero-copy memory mapping of the file as the output pixel
+   * buffer when the ImageIO reports that the on-disk layout and
+   * endianness match (see ImageIOBase::CanReadMemoryMapped). The
+   * mapping is private, so downstream in-place filters write to
+   * copy-on-write pages and never to the file. When mapping is not
+   * possible the reader silently falls back to a normal buffered read.
+   * Off by default. */
+  itkSetMacro(UseMemoryMappedReading, bool);
+  itkGetConstReferenceMacro(UseMemoryMappedReading, bool);
+  itkBooleanMacro(UseMemoryMappedReading);
+
+  /** Set/Get the allocation policy for the output pixel buffer. When an
+   * allocator is set the file is read directly into memory it provides
+   * — pinned (page-locked) host memory, for example, so a subsequent
+   * GPU upload avoids the extra copy from pageable memory. When no
+   * allocator is set (the default) the output is allocated normally.
+   * Ignored when a memory-mapped read takes over the buffer. */
+  itkSetObjectMacro(BufferAllocator, BufferAllocatorBase);
+  itkGetModifiableObjectMacro(BufferAllocator, BufferAllocatorBase);
+
 protected:
   ImageFileReader();
   ~ImageFileReader() override = default;
@@ -160,7 +181,22 @@ protected:
 
   bool m_UseStreaming;
 
+  bool m_UseMemoryMappedReading;
+
 private:
+  /** Attempt to attach a memory mapping of the file as the output
+   * pixel container. Returns false when the file layout does not allow
+   * a zero-copy read, in which case the normal buffered path is used. */
+  bool
+  TryMemoryMappedRead();
+
+  /** Allocate the output pixel buffer through m_BufferAllocator and
+   * attach it as the output's pixel container. */
+  void
+  AllocateOutputsUsingAllocator();
+
+  BufferAllocatorBase::Pointer m_BufferAllocator;
+
   std::string m_ExceptionMessage;
 
   // The region that the ImageIO class will return when we ask to
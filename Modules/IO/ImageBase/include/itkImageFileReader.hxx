@@ -21,7 +21,9 @@
 
 #include "itkObjectFactory.h"
 #include "itkImageIOFactory.h"
+#include "itkAllocatorPixelContainer.h"
 #include "itkConvertPixelBuffer.h"
+#include "itkMemoryMappedPixelContainer.h"
 #include "itkPixelTraits.h"
 #include "itkVectorImage.h"
 #include "itkMetaDataObject.h"
@@ -39,6 +41,7 @@ ImageFileReader<TOutputImage, ConvertPixelTraits>::ImageFileReader()
   this->SetFileName("");
   m_UserSpecifiedImageIO = false;
   m_UseStreaming = true;
+  m_UseMemoryMappedReading = false;
 }
 
 template <typename TOutputImage, typename ConvertPixelTraits>
@@ -51,6 +54,9 @@ ImageFileReader<TOutputImage, ConvertPixelTraits>::PrintSelf(std::ostream & os,
 
   os << indent << "UserSpecifiedImageIO flag: " << m_UserSpecifiedImageIO << "\n";
   os << indent << "m_UseStreaming: " << m_UseStreaming << "\n";
+  os << indent << "m_UseMemoryMappedReading: " << m_UseMemoryMappedReading << "\n";
+
+  itkPrintSelfObjectMacro(BufferAllocator);
 }
 
 template <typename TOutputImage, typename ConvertPixelTraits>
@@ -360,8 +366,22 @@ ImageFileReader<TOutputImage, ConvertPixelTraits>::GenerateData()
                 << "Allocating the buffer with the EnlargedRequestedRegion \n"
                 << output->GetRequestedRegion() << "\n");
 
+  if (m_UseMemoryMappedReading && this->TryMemoryMappedRead())
+  {
+    itkDebugMacro(<< "Attached a memory mapping of the file as the pixel buffer");
+    this->UpdateProgress(1.0f);
+    return;
+  }
+
   // allocated the output image to the size of the enlarge requested region
-  this->AllocateOutputs();
+  if (m_BufferAllocator.IsNotNull())
+  {
+    this->AllocateOutputsUsingAllocator();
+  }
+  else
+  {
+    this->AllocateOutputs();
+  }
 
   // Test if the file exists and if it can be opened.
   // An exception will be thrown otherwise, since we can't
@@ -441,6 +461,80 @@ ImageFileReader<TOutputImage, ConvertPixelTraits>::GenerateData()
   this->UpdateProgress(1.0f);
 }
 
+template <typename TOutputImage, typename ConvertPixelTraits>
+void
+ImageFileReader<TOutputImage, ConvertPixelTraits>::AllocateOutputsUsingAllocator()
+{
+  typename TOutputImage::Pointer output = this->GetOutput();
+
+  using PixelContainerType = typename TOutputImage::PixelContainer;
+  using AllocatorContainerType =
+    AllocatorPixelContainer<typename PixelContainerType::ElementIdentifier, typename PixelContainerType::Element>;
+
+  // for a VectorImage the container holds the individual components
+  auto numberOfElements =
+    static_cast<typename PixelContainerType::ElementIdentifier>(output->GetRequestedRegion().GetNumberOfPixels());
+  if (strcmp(output->GetNameOfClass(), "VectorImage") == 0)
+  {
+    numberOfElements *= output->GetNumberOfComponentsPerPixel();
+  }
+
+  auto container = AllocatorContainerType::New();
+  container->AllocateFromAllocator(m_BufferAllocator, numberOfElements);
+
+  output->SetBufferedRegion(output->GetRequestedRegion());
+  output->SetPixelContainer(container);
+}
+
+template <typename TOutputImage, typename ConvertPixelTraits>
+bool
+ImageFileReader<TOutputImage, ConvertPixelTraits>::TryMemoryMappedRead()
+{
+  typename TOutputImage::Pointer output = this->GetOutput();
+
+  m_ImageIO->SetFileName(this->GetFileName().c_str());
+
+  const IOComponentEnum ioType = ImageIOBase::MapPixelType<typename ConvertPixelTraits::ComponentType>::CType;
+  if (m_ImageIO->GetComponentType() != ioType ||
+      m_ImageIO->GetNumberOfComponents() != ConvertPixelTraits::GetNumberOfComponents())
+  {
+    // a pixel conversion is needed, so the read cannot be zero-copy
+    return false;
+  }
+
+  if (output->GetRequestedRegion() != output->GetLargestPossibleRegion() ||
+      m_ActualIORegion.GetNumberOfPixels() != output->GetRequestedRegion().GetNumberOfPixels())
+  {
+    // only whole-image reads correspond to one contiguous file region
+    return false;
+  }
+
+  if (!m_ImageIO->CanReadMemoryMapped())
+  {
+    return false;
+  }
+
+  using PixelContainerType = typename TOutputImage::PixelContainer;
+  using MappedContainerType =
+    MemoryMappedPixelContainer<typename PixelContainerType::ElementIdentifier, typename PixelContainerType::Element>;
+
+  const size_t sizeOfImageInBytes =
+    m_ActualIORegion.GetNumberOfPixels() * (m_ImageIO->GetComponentSize() * m_ImageIO->GetNumberOfComponents());
+  const auto numberOfElements = static_cast<typename PixelContainerType::ElementIdentifier>(
+    sizeOfImageInBytes / sizeof(typename PixelContainerType::Element));
+
+  auto container = MappedContainerType::New();
+  if (!container->MapFileRegion(
+        m_ImageIO->GetImageDataFileName(), m_ImageIO->GetImageDataByteOffset(), numberOfElements))
+  {
+    return false;
+  }
+
+  output->SetBufferedRegion(output->GetRequestedRegion());
+  output->SetPixelContainer(container);
+  return true;
+}
+
 template <typename TOutputImage, typename ConvertPixelTraits>
 void
 ImageFileReader<TOutputImage, ConvertPixelTraits>::DoConvertBuffer(void * inputData, size_t numberOfPixels)
@@ -357,7 +357,9 @@ ImageFileWriter<TInputImage>::GenerateData()
       cacheImage->SetBufferedRegion(ioRegion);
       cacheImage->Allocate();
 
-      ImageAlgorithm::Copy(input, cacheImage.GetPointer(), ioRegion, ioRegion);
+      // the staging copy gathers the region row by row, so spread it over
+      // the thread pool
+      ImageAlgorithm::ParallelCopy(input, cacheImage.GetPointer(), ioRegion, ioRegion);
 
       dataPtr = cacheImage->GetBufferPointer();
     }
@@ -431,6 +431,34 @@ public:
     return false;
   }
 
+  /** Determine if the pixel data can be memory mapped directly from the
+      file with the current settings: uncompressed binary data stored in
+      a contiguous file region with the same layout and endianness as in
+      memory. Default is false. Must be queried after the header of the
+      file has been read. */
+  virtual bool
+  CanReadMemoryMapped()
+  {
+    return false;
+  }
+
+  /** The file holding the pixel data; for formats with a detached
+      header this differs from the file name. Only meaningful when
+      CanReadMemoryMapped() returns true. */
+  virtual std::string
+  GetImageDataFileName()
+  {
+    return this->GetFileName();
+  }
+
+  /** The byte offset of the pixel data inside GetImageDataFileName().
+      Only meaningful when CanReadMemoryMapped() returns true. */
+  virtual SizeValueType
+  GetImageDataByteOffset()
+  {
+    return 0;
+  }
+
   /** Read the spacing and dimensions of the image.
    * Assumes SetFileName has been called with a valid file name. */
   virtual void
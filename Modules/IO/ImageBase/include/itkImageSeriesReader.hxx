@@ -24,6 +24,7 @@
 #include "itkArray.h"
 #include "itkVector.h"
 #include "itkMath.h"
+#include "itkMultiThreaderBase.h"
 #include "itkProgressReporter.h"
 #include "itkMetaDataObject.h"
 #include <iomanip>
@@ -55,6 +56,7 @@ ImageSeriesReader<TOutputImage>::PrintSelf(std::ostream & os, Indent indent) con
   os << indent << "ReverseOrder: " << m_ReverseOrder << std::endl;
   os << indent << "ForceOrthogonalDirection: " << m_ForceOrthogonalDirection << std::endl;
   os << indent << "UseStreaming: " << m_UseStreaming << std::endl;
+  os << indent << "UseParallelReading: " << m_UseParallelReading << std::endl;
 
   itkPrintSelfObjectMacro(ImageIO);
 
@@ -282,9 +284,6 @@ ImageSeriesReader<TOutputImage>::GenerateData()
   output->SetBufferedRegion(requestedRegion);
   output->Allocate();
 
-  // progress reported on a per slice basis
-  ProgressReporter progress(this, 0, requestedRegion.GetSize(TOutputImage::ImageDimension - 1), 100);
-
   // We utilize the modified time of the output information to
   // know when the meta array needs to be updated, when the output
   // information is updated so should the meta array.
@@ -302,6 +301,210 @@ ImageSeriesReader<TOutputImage>::GenerateData()
   double                             maxSpacingDeviation = 0.0;
   bool                               prevSliceIsValid = false;
 
+  // When enabled, decode the files concurrently: each worker owns its
+  // ImageFileReader and writes directly into the matching slice of the
+  // pre-allocated output buffer, overlapping file IO with decompression.
+  // A user-supplied ImageIO cannot be shared between threads, so its
+  // presence forces the sequential path below.
+  if (m_UseParallelReading && numberOfFiles > 1 && m_ImageIO.IsNull() &&
+      MultiThreaderBase::GetGlobalDefaultNumberOfThreads() > 1)
+  {
+    std::vector<DictionaryRawPointer>             sliceDictionaries(numberOfFiles, nullptr);
+    std::vector<typename TOutputImage::PointType> sliceOrigins(numberOfFiles);
+    std::vector<char>                             sliceWasRead(numberOfFiles, 0);
+
+    try
+    {
+      this->GetMultiThreader()->ParallelizeArray(
+        0,
+        static_cast<SizeValueType>(numberOfFiles),
+        [&](SizeValueType i) {
+          IndexType sliceIndex = requestedRegion.GetIndex();
+          if (TOutputImage::ImageDimension != this->m_NumberOfDimensionsInImage)
+          {
+            sliceIndex[this->m_NumberOfDimensionsInImage] = static_cast<IndexValueType>(i);
+          }
+
+          const bool insideRequestedRegion = requestedRegion.IsInside(sliceIndex);
+          const int  iFileName = (m_ReverseOrder ? numberOfFiles - static_cast<int>(i) - 1 : static_cast<int>(i));
+
+          // check if we need this slice
+          if (!insideRequestedRegion && !needToUpdateMetaDataDictionaryArray)
+          {
+            return;
+          }
+
+          // configure reader
+          auto reader = ReaderType::New();
+          reader->SetFileName(m_FileNames[iFileName].c_str());
+          reader->SetUseStreaming(m_UseStreaming);
+
+          TOutputImage * readerOutput = reader->GetOutput();
+          readerOutput->SetRequestedRegion(sliceRegionToRequest);
+
+          if (!insideRequestedRegion)
+          {
+            reader->UpdateOutputInformation();
+          }
+          else
+          {
+            readerOutput->UpdateOutputInformation();
+            readerOutput->PropagateRequestedRegion();
+
+            // check that the size of each slice is the same
+            if (readerOutput->GetLargestPossibleRegion().GetSize() != validSize)
+            {
+              itkExceptionMacro(<< "Size mismatch! The size of  " << m_FileNames[iFileName].c_str() << " is "
+                                << readerOutput->GetLargestPossibleRegion().GetSize()
+                                << " and does not match the required size " << validSize << " from file "
+                                << m_FileNames[m_ReverseOrder ? numberOfFiles - 1 : 0].c_str());
+            }
+
+            SizeType readSize = readerOutput->GetRequestedRegion().GetSize();
+
+            if (readSize == sliceRegionToRequest.GetSize())
+            {
+              // read straight into the matching section of our buffer
+              const size_t numberOfPixelsInSlice = sliceRegionToRequest.GetNumberOfPixels();
+
+              using AccessorFunctorType = typename TOutputImage::AccessorFunctorType;
+              const size_t numberOfInternalComponentsPerPixel = AccessorFunctorType::GetVectorLength(output);
+
+              const ptrdiff_t sliceOffset =
+                (TOutputImage::ImageDimension != this->m_NumberOfDimensionsInImage)
+                  ? (static_cast<ptrdiff_t>(i) - requestedRegion.GetIndex(this->m_NumberOfDimensionsInImage))
+                  : 0;
+
+              const ptrdiff_t numberOfPixelComponentsUpToSlice =
+                numberOfPixelsInSlice * numberOfInternalComponentsPerPixel * sliceOffset;
+              const bool bufferDelete = false;
+
+              typename TOutputImage::InternalPixelType * outputSliceBuffer =
+                outputBuffer + numberOfPixelComponentsUpToSlice;
+
+              if (strcmp(output->GetNameOfClass(), "VectorImage") == 0)
+              {
+                readerOutput->GetPixelContainer()->SetImportPointer(
+                  outputSliceBuffer,
+                  static_cast<unsigned long>(numberOfPixelsInSlice * numberOfInternalComponentsPerPixel),
+                  bufferDelete);
+              }
+              else
+              {
+                readerOutput->GetPixelContainer()->SetImportPointer(
+                  outputSliceBuffer, static_cast<unsigned long>(numberOfPixelsInSlice), bufferDelete);
+              }
+              readerOutput->UpdateOutputData();
+            }
+            else
+            {
+              // the read region does not match exactly, copy from the
+              // buffer created by the reader
+              reader->Update();
+
+              ImageRegionType outRegion = requestedRegion;
+              outRegion.SetIndex(sliceIndex);
+              if (TOutputImage::ImageDimension != this->m_NumberOfDimensionsInImage)
+              {
+                outRegion.SetSize(this->m_NumberOfDimensionsInImage, 1);
+              }
+
+              ImageAlgorithm::Copy(readerOutput, output, sliceRegionToRequest, outRegion);
+            }
+
+            sliceOrigins[i] = readerOutput->GetOrigin();
+            sliceWasRead[i] = 1;
+          }
+
+          // Deep copy the MetaDataDictionary into the per slice slot
+          if (reader->GetImageIO() && needToUpdateMetaDataDictionaryArray)
+          {
+            auto newDictionary = new DictionaryType;
+            *newDictionary = reader->GetImageIO()->GetMetaDataDictionary();
+            sliceDictionaries[i] = newDictionary;
+          }
+        },
+        this);
+    }
+    catch (...)
+    {
+      for (const auto & dictionary : sliceDictionaries)
+      {
+        delete dictionary;
+      }
+      throw;
+    }
+
+    // the uniform sampling verification needs consecutive slice origins,
+    // so it runs as a sequential pass over the collected origins
+    for (int i = 0; i != numberOfFiles; ++i)
+    {
+      if (!sliceWasRead[i])
+      {
+        continue;
+      }
+      if (prevSliceIsValid)
+      {
+        using SpacingScalarType = typename TOutputImage::SpacingValueType;
+        Vector<SpacingScalarType, TOutputImage::ImageDimension> dirN;
+        for (size_t j = 0; j < TOutputImage::ImageDimension; ++j)
+        {
+          dirN[j] =
+            static_cast<SpacingScalarType>(sliceOrigins[i][j]) - static_cast<SpacingScalarType>(prevSliceOrigin[j]);
+        }
+        SpacingScalarType dirNnorm = dirN.GetNorm();
+
+        if (this->m_SpacingDefined &&
+            !Math::AlmostEquals(dirNnorm, outputSpacing[this->m_NumberOfDimensionsInImage]))
+        {
+          const double spacingDeviation = Math::abs(outputSpacing[this->m_NumberOfDimensionsInImage] - dirNnorm);
+          if (spacingDeviation > maxSpacingDeviation)
+          {
+            maxSpacingDeviation = spacingDeviation;
+          }
+          if (sliceDictionaries[i] != nullptr)
+          {
+            // slice-specific information
+            EncapsulateMetaData<double>(*sliceDictionaries[i], "ITK_non_uniform_sampling_deviation", spacingDeviation);
+          }
+        }
+      }
+      prevSliceOrigin = sliceOrigins[i];
+      prevSliceIsValid = true;
+    }
+
+    for (const auto & dictionary : sliceDictionaries)
+    {
+      if (dictionary != nullptr)
+      {
+        m_MetaDataDictionaryArray.push_back(dictionary);
+      }
+    }
+
+    if (TOutputImage::ImageDimension != this->m_NumberOfDimensionsInImage &&
+        maxSpacingDeviation > m_SpacingWarningRelThreshold * outputSpacing[this->m_NumberOfDimensionsInImage])
+    {
+      itkWarningMacro(<< "Non uniform sampling or missing slices detected,  maximum nonuniformity:"
+                      << maxSpacingDeviation);
+    }
+    if (maxSpacingDeviation > 0.0)
+    {
+      EncapsulateMetaData<double>(output->GetMetaDataDictionary(),
+                                  "ITK_non_uniform_sampling_deviation",
+                                  maxSpacingDeviation); // maximum deviation
+    }
+
+    // update the time if we modified the meta array
+    if (needToUpdateMetaDataDictionaryArray)
+    {
+      m_MetaDataDictionaryArrayMTime.Modified();
+    }
+    return;
+  }
+
+  // progress reported on a per slice basis
+  ProgressReporter progress(this, 0, requestedRegion.GetSize(TOutputImage::ImageDimension - 1), 100);
+
   for (int i = 0; i != numberOfFiles; ++i)
   {
     if (TOutputImage::ImageDimension != this->m_NumberOfDimensionsInImage)
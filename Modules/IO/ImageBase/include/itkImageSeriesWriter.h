@@ -210,6 +210,17 @@ public:
   itkGetConstReferenceMacro(UseCompression, bool);
   itkBooleanMacro(UseCompression);
 
+  /** Encode and write several slices concurrently, each worker using
+   * its own writer and ImageIO and a single-slice staging image, so
+   * per-file encoding (PNG deflate, for example) overlaps with the IO
+   * of the other slices. Off by default. The flag is ignored when a
+   * user-supplied ImageIO has been set — one shared ImageIO instance
+   * (and the MetaDataDictionaryArray it carries) cannot be driven from
+   * several threads. */
+  itkSetMacro(UseParallelWriting, bool);
+  itkGetConstReferenceMacro(UseParallelWriting, bool);
+  itkBooleanMacro(UseParallelWriting);
+
 protected:
   ImageSeriesWriter();
   ~ImageSeriesWriter() override = default;
@@ -245,6 +256,8 @@ private:
 
   bool m_UseCompression;
 
+  bool m_UseParallelWriting{ false };
+
   /** Array of MetaDataDictionary used for passing information to each slice */
   DictionaryArrayRawPointer m_MetaDataDictionaryArray{ nullptr };
 
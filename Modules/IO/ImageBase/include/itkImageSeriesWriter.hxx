@@ -25,6 +25,7 @@
 #include "itkProgressReporter.h"
 #include "itkImageAlgorithm.h"
 #include "itkMetaDataObject.h"
+#include "itkMultiThreaderBase.h"
 #include "itkArray.h"
 #include "vnl/algo/vnl_determinant.h"
 #include <cstdio>
@@ -249,6 +250,41 @@ ImageSeriesWriter<TInputImage, TOutputImage>::WriteFiles()
 
   itkDebugMacro(<< "Number of files to write = " << m_FileNames.size());
 
+  if (m_UseParallelWriting && m_FileNames.size() > 1 && m_ImageIO.IsNull() &&
+      MultiThreaderBase::GetGlobalDefaultNumberOfThreads() > 1)
+  {
+    // Each worker stages its slice in a private single-slice image and
+    // writes it through its own writer (and factory-created ImageIO),
+    // so the slice encodings run concurrently. Progress is reported by
+    // ParallelizeArray. The per-slice metadata branches below only
+    // apply when an ImageIO was supplied, which this mode excludes.
+    this->GetMultiThreader()->ParallelizeArray(
+      0,
+      static_cast<SizeValueType>(m_FileNames.size()),
+      [&](SizeValueType slice) {
+        auto sliceOutput = OutputImageType::New();
+        sliceOutput->CopyInformation(outputImage);
+        sliceOutput->SetRegions(outRegion);
+        sliceOutput->Allocate();
+
+        ImageRegion<TInputImage::ImageDimension> sliceInRegion;
+        sliceInRegion.SetIndex(
+          inputImage->ComputeIndex(static_cast<typename InputImageType::OffsetValueType>(slice * pixelsPerFile)));
+        sliceInRegion.SetSize(inSize);
+
+        ImageAlgorithm::Copy(inputImage, sliceOutput.GetPointer(), sliceInRegion, outRegion);
+
+        auto writer = WriterType::New();
+        writer->UseInputMetaDataDictionaryOff();
+        writer->SetInput(sliceOutput);
+        writer->SetFileName(m_FileNames[slice].c_str());
+        writer->SetUseCompression(m_UseCompression);
+        writer->Update();
+      },
+      this);
+    return;
+  }
+
   ProgressReporter progress(this, 0, expectedNumberOfFiles, expectedNumberOfFiles);
 
   // For each "slice" in the input, copy the region to the output,
@@ -377,6 +413,7 @@ ImageSeriesWriter<TInputImage, TOutputImage>::PrintSelf(std::ostream & os, Inden
   {
     os << indent << "Compression: Off\n";
   }
+  os << indent << "UseParallelWriting: " << (m_UseParallelWriting ? "On" : "Off") << std::endl;
 }
 } // end namespace itk
 
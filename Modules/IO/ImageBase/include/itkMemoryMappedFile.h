@@ -0,0 +1,93 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkMemoryMappedFile_h
+#define itkMemoryMappedFile_h
+#include "ITKIOImageBaseExport.h"
+
+#include "itkIntTypes.h"
+#include "itkMacro.h"
+
+#include <string>
+
+namespace itk
+{
+/** \class MemoryMappedFile
+ * \brief A private copy-on-write memory mapping of a file region.
+ *
+ * The mapping is backed by the operating system page cache, so no read
+ * or copy is performed up front and pages are faulted in on first
+ * access. The mapping is private: the buffer is writable, but stores
+ * only dirty private pages and never write through to the file, which
+ * is what in-place filters downstream of a zero-copy read require.
+ *
+ * The requested byte offset does not need to be aligned to the system
+ * page granularity; the mapping is extended downward internally and
+ * GetBuffer() points at the requested offset.
+ *
+ * \sa MemoryMappedPixelContainer
+ * \ingroup IOFilters
+ * \ingroup ITKIOImageBase
+ */
+class ITKIOImageBase_EXPORT MemoryMappedFile
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(MemoryMappedFile);
+
+  MemoryMappedFile() = default;
+  ~MemoryMappedFile();
+
+  /** Map length bytes of the named file starting at the given byte
+   * offset. Any previous mapping is released first. Returns false —
+   * with no mapping held — if the file cannot be opened, is shorter
+   * than offset + length, or the mapping fails. */
+  bool
+  Map(const std::string & fileName, SizeValueType offset, SizeValueType length);
+
+  /** Release the mapping, if any. */
+  void
+  Unmap();
+
+  /** The mapped bytes at the requested offset; null when not mapped. */
+  void *
+  GetBuffer() const
+  {
+    return m_Buffer;
+  }
+
+  bool
+  IsMapped() const
+  {
+    return m_Buffer != nullptr;
+  }
+
+private:
+  void * m_Buffer{ nullptr };
+
+  /** The page-aligned start and total length of the underlying mapping,
+   * which may begin before m_Buffer. */
+  void *        m_MappingStart{ nullptr };
+  SizeValueType m_MappingLength{ 0 };
+
+#ifdef _WIN32
+  void * m_FileHandle{ nullptr };
+  void * m_MappingHandle{ nullptr };
+#endif
+};
+} // end namespace itk
+
+#endif // itkMemoryMappedFile_h
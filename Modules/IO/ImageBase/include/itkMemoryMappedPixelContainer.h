@@ -0,0 +1,96 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkMemoryMappedPixelContainer_h
+#define itkMemoryMappedPixelContainer_h
+
+#include "itkImportImageContainer.h"
+#include "itkMemoryMappedFile.h"
+
+#include <memory>
+
+namespace itk
+{
+/** \class MemoryMappedPixelContainer
+ * \brief A pixel container whose buffer is a memory mapping of a file.
+ *
+ * The container behaves like an ImportImageContainer whose imported
+ * buffer is a private copy-on-write mapping of a file region: pixels
+ * are faulted in from the page cache on first access instead of being
+ * read and copied up front, and writes — from in-place filters, for
+ * example — dirty private pages without touching the file. The mapping
+ * is released when the container is destroyed or reallocated.
+ *
+ * ImageFileReader attaches this container to its output for zero-copy
+ * reads when the on-disk layout matches the requested image.
+ *
+ * \sa MemoryMappedFile
+ * \sa ImportImageContainer
+ * \ingroup ImageObjects
+ * \ingroup IOFilters
+ * \ingroup ITKIOImageBase
+ */
+template <typename TElementIdentifier, typename TElement>
+class ITK_TEMPLATE_EXPORT MemoryMappedPixelContainer : public ImportImageContainer<TElementIdentifier, TElement>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(MemoryMappedPixelContainer);
+
+  /** Standard class type aliases. */
+  using Self = MemoryMappedPixelContainer;
+  using Superclass = ImportImageContainer<TElementIdentifier, TElement>;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Save the template parameters. */
+  using ElementIdentifier = TElementIdentifier;
+  using Element = TElement;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Standard part of every itk Object. */
+  itkTypeMacro(MemoryMappedPixelContainer, ImportImageContainer);
+
+  /** Map numberOfElements elements of the named file starting at the
+   * given byte offset and adopt the mapping as the container's buffer.
+   * Returns false — leaving the container unchanged — when the region
+   * cannot be mapped. */
+  bool
+  MapFileRegion(const std::string & fileName, SizeValueType byteOffset, ElementIdentifier numberOfElements);
+
+protected:
+  MemoryMappedPixelContainer() = default;
+  ~MemoryMappedPixelContainer() override = default;
+
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+  /** Release the mapping instead of delete[]-ing the buffer. */
+  void
+  DeallocateManagedMemory() override;
+
+private:
+  std::unique_ptr<MemoryMappedFile> m_MappedFile;
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkMemoryMappedPixelContainer.hxx"
+#endif
+
+#endif
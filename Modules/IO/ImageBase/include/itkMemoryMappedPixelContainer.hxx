@@ -0,0 +1,73 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkMemoryMappedPixelContainer_hxx
+#define itkMemoryMappedPixelContainer_hxx
+
+#include "itkMemoryMappedPixelContainer.h"
+
+namespace itk
+{
+
+template <typename TElementIdentifier, typename TElement>
+bool
+MemoryMappedPixelContainer<TElementIdentifier, TElement>::MapFileRegion(const std::string & fileName,
+                                                                        SizeValueType       byteOffset,
+                                                                        ElementIdentifier   numberOfElements)
+{
+  std::unique_ptr<MemoryMappedFile> mappedFile(new MemoryMappedFile);
+  if (!mappedFile->Map(fileName, byteOffset, static_cast<SizeValueType>(numberOfElements) * sizeof(Element)))
+  {
+    return false;
+  }
+
+  // Release any previous buffer (or mapping) before adopting the new
+  // mapping; passing LetContainerManageMemory routes the release of the
+  // new buffer through our DeallocateManagedMemory override.
+  this->SetImportPointer(static_cast<Element *>(mappedFile->GetBuffer()), numberOfElements, true);
+  m_MappedFile = std::move(mappedFile);
+  return true;
+}
+
+template <typename TElementIdentifier, typename TElement>
+void
+MemoryMappedPixelContainer<TElementIdentifier, TElement>::DeallocateManagedMemory()
+{
+  if (m_MappedFile)
+  {
+    m_MappedFile.reset();
+    this->SetImportPointer(nullptr);
+    this->SetCapacity(0);
+    this->SetSize(0);
+  }
+  else
+  {
+    Superclass::DeallocateManagedMemory();
+  }
+}
+
+template <typename TElementIdentifier, typename TElement>
+void
+MemoryMappedPixelContainer<TElementIdentifier, TElement>::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+  os << indent << "MappedFile: " << (m_MappedFile ? "mapped" : "none") << std::endl;
+}
+
+} // end namespace itk
+
+#endif
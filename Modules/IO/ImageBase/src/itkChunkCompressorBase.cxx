@@ -0,0 +1,144 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkChunkCompressorBase.h"
+#include "itkMultiThreaderBase.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace itk
+{
+
+void
+ChunkCompressorBase::Compress(const void *        input,
+                              SizeValueType       inputSize,
+                              std::vector<char> & compressed,
+                              ChunkSizesType &    chunkSizes)
+{
+  compressed.clear();
+  chunkSizes.clear();
+
+  if (m_ChunkSize == 0)
+  {
+    itkExceptionMacro("A positive chunk size is required.");
+  }
+  if (inputSize == 0)
+  {
+    return;
+  }
+
+  const SizeValueType            numberOfChunks = (inputSize + m_ChunkSize - 1) / m_ChunkSize;
+  std::vector<std::vector<char>> chunks(numberOfChunks);
+  std::atomic<bool>              failed(false);
+
+  MultiThreaderBase::Pointer threader = MultiThreaderBase::New();
+  threader->ParallelizeArray(
+    0,
+    numberOfChunks,
+    [&](SizeValueType chunk) {
+      const SizeValueType offset = chunk * m_ChunkSize;
+      const SizeValueType size = std::min(m_ChunkSize, inputSize - offset);
+      if (!this->CompressChunk(static_cast<const char *>(input) + offset, size, chunks[chunk]))
+      {
+        failed = true;
+      }
+    },
+    nullptr);
+  if (failed)
+  {
+    itkExceptionMacro("Chunk compression failed.");
+  }
+
+  SizeValueType compressedBytes = 0;
+  for (const auto & chunk : chunks)
+  {
+    compressedBytes += static_cast<SizeValueType>(chunk.size());
+  }
+  compressed.reserve(compressedBytes);
+  chunkSizes.reserve(numberOfChunks);
+  for (const auto & chunk : chunks)
+  {
+    compressed.insert(compressed.end(), chunk.begin(), chunk.end());
+    chunkSizes.push_back(static_cast<SizeValueType>(chunk.size()));
+  }
+}
+
+void
+ChunkCompressorBase::Decompress(const void *           compressed,
+                                const ChunkSizesType & chunkSizes,
+                                void *                 output,
+                                SizeValueType          outputSize)
+{
+  if (outputSize == 0 && chunkSizes.empty())
+  {
+    return;
+  }
+  if (m_ChunkSize == 0)
+  {
+    itkExceptionMacro("A positive chunk size is required.");
+  }
+  const SizeValueType numberOfChunks = (outputSize + m_ChunkSize - 1) / m_ChunkSize;
+  if (chunkSizes.size() != numberOfChunks)
+  {
+    itkExceptionMacro("The number of chunks " << chunkSizes.size() << " does not match the " << numberOfChunks
+                                              << " expected for " << outputSize << " bytes in chunks of " << m_ChunkSize
+                                              << ".");
+  }
+
+  std::vector<SizeValueType> chunkOffsets(numberOfChunks);
+  SizeValueType              compressedBytes = 0;
+  for (SizeValueType chunk = 0; chunk < numberOfChunks; ++chunk)
+  {
+    chunkOffsets[chunk] = compressedBytes;
+    compressedBytes += chunkSizes[chunk];
+  }
+
+  std::atomic<bool> failed(false);
+
+  MultiThreaderBase::Pointer threader = MultiThreaderBase::New();
+  threader->ParallelizeArray(
+    0,
+    numberOfChunks,
+    [&](SizeValueType chunk) {
+      const SizeValueType offset = chunk * m_ChunkSize;
+      const SizeValueType size = std::min(m_ChunkSize, outputSize - offset);
+      if (!this->DecompressChunk(static_cast<const char *>(compressed) + chunkOffsets[chunk],
+                                 chunkSizes[chunk],
+                                 static_cast<char *>(output) + offset,
+                                 size))
+      {
+        failed = true;
+      }
+    },
+    nullptr);
+  if (failed)
+  {
+    itkExceptionMacro("Chunk decompression failed.");
+  }
+}
+
+void
+ChunkCompressorBase::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "ChunkSize: " << m_ChunkSize << std::endl;
+  os << indent << "CompressionLevel: " << m_CompressionLevel << std::endl;
+}
+} // end namespace itk
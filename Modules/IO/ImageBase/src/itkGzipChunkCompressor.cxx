@@ -0,0 +1,70 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkGzipChunkCompressor.h"
+
+#include "itk_zlib.h"
+
+namespace itk
+{
+
+bool
+GzipChunkCompressor::CompressChunk(const char * input, SizeValueType inputSize, std::vector<char> & chunk)
+{
+  const int level = (this->GetCompressionLevel() < 0) ? Z_DEFAULT_COMPRESSION : this->GetCompressionLevel();
+
+  z_stream stream{};
+  // windowBits 15 + 16 selects the gzip wrapper
+  if (deflateInit2(&stream, level, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+  {
+    return false;
+  }
+  chunk.resize(deflateBound(&stream, static_cast<uLong>(inputSize)));
+  stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(input));
+  stream.avail_in = static_cast<uInt>(inputSize);
+  stream.next_out = reinterpret_cast<Bytef *>(chunk.data());
+  stream.avail_out = static_cast<uInt>(chunk.size());
+  const int    status = deflate(&stream, Z_FINISH);
+  const size_t producedSize = stream.total_out;
+  deflateEnd(&stream);
+  if (status != Z_STREAM_END)
+  {
+    return false;
+  }
+  chunk.resize(producedSize);
+  return true;
+}
+
+bool
+GzipChunkCompressor::DecompressChunk(const char * input, SizeValueType inputSize, char * output, SizeValueType outputSize)
+{
+  z_stream stream{};
+  if (inflateInit2(&stream, 15 + 16) != Z_OK)
+  {
+    return false;
+  }
+  stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(input));
+  stream.avail_in = static_cast<uInt>(inputSize);
+  stream.next_out = reinterpret_cast<Bytef *>(output);
+  stream.avail_out = static_cast<uInt>(outputSize);
+  const int    status = inflate(&stream, Z_FINISH);
+  const size_t producedSize = stream.total_out;
+  inflateEnd(&stream);
+  return status == Z_STREAM_END && producedSize == outputSize;
+}
+} // end namespace itk
@@ -17,7 +17,10 @@
  *=========================================================================*/
 
 #include "itkImageIOFactory.h"
+#include "itksys/SystemTools.hxx"
 
+#include <cstring>
+#include <fstream>
 #include <mutex>
 
 
@@ -27,7 +30,83 @@ namespace itk
 namespace
 {
 std::mutex createImageIOLock;
+
+// Most ImageIO classes answer CanReadFile by opening and parsing the
+// file, so probing every registered IO in turn reads the header once
+// per candidate. The tables below route a file directly to the IO that
+// almost certainly owns it, from a single 512-byte read of the header
+// (or, failing that, from the file name extension). The routed IO still
+// confirms with CanReadFile, and any miss falls back to the full
+// trial loop, so a wrong or missing hint only costs the old behavior.
+
+struct SignatureEntry
+{
+  size_t       Offset;
+  size_t       Length;
+  const char * Signature;
+  const char * IOClassName;
+};
+
+constexpr SignatureEntry signatureTable[] = {
+  { 128, 4, "DICM", "GDCMImageIO" },
+  { 0, 8, "\x89HDF\r\n\x1a\n", "HDF5ImageIO" },
+  { 344, 4, "n+1\0", "NiftiImageIO" }, // single-file NIFTI
+  { 344, 4, "ni1\0", "NiftiImageIO" }, // header of a NIFTI header/image pair
+  { 0, 7, "NRRD000", "NrrdImageIO" },
+  { 0, 8, "\x89PNG\r\n\x1a\n", "PNGImageIO" },
+  { 0, 3, "\xff\xd8\xff", "JPEGImageIO" },
+  { 0, 4, "II*\0", "TIFFImageIO" },
+  { 0, 4, "MM\0*", "TIFFImageIO" },
+  { 0, 22, "# vtk DataFile Version", "VTKImageIO" },
+  { 0, 10, "ObjectType", "MetaImageIO" },
+  { 208, 4, "MAP ", "MRCImageIO" },
+};
+
+const char *
+ClassNameFromSignature(const char * header, size_t length)
+{
+  for (const SignatureEntry & entry : signatureTable)
+  {
+    if (entry.Offset + entry.Length <= length &&
+        std::memcmp(header + entry.Offset, entry.Signature, entry.Length) == 0)
+    {
+      return entry.IOClassName;
+    }
+  }
+  return nullptr;
+}
+
+const char *
+ClassNameFromExtension(const std::string & fileName)
+{
+  static const std::pair<const char *, const char *> extensionTable[] = {
+    { ".dcm", "GDCMImageIO" },  { ".dicom", "GDCMImageIO" }, { ".h5", "HDF5ImageIO" },
+    { ".hdf5", "HDF5ImageIO" }, { ".nii", "NiftiImageIO" },  { ".nia", "NiftiImageIO" },
+    { ".nrrd", "NrrdImageIO" }, { ".nhdr", "NrrdImageIO" },  { ".png", "PNGImageIO" },
+    { ".jpg", "JPEGImageIO" },  { ".jpeg", "JPEGImageIO" },  { ".tif", "TIFFImageIO" },
+    { ".tiff", "TIFFImageIO" }, { ".vtk", "VTKImageIO" },    { ".mha", "MetaImageIO" },
+    { ".mhd", "MetaImageIO" },  { ".mrc", "MRCImageIO" },    { ".bmp", "BMPImageIO" },
+    { ".gipl", "GiplImageIO" },
+  };
+
+  std::string extension = itksys::SystemTools::LowerCase(itksys::SystemTools::GetFilenameLastExtension(fileName));
+  if (extension == ".gz")
+  {
+    // compressed formats identified by their inner extension
+    const std::string lowerCaseFileName = itksys::SystemTools::LowerCase(fileName);
+    extension = itksys::SystemTools::GetFilenameLastExtension(
+      lowerCaseFileName.substr(0, lowerCaseFileName.size() - extension.size()));
+  }
+  for (const auto & entry : extensionTable)
+  {
+    if (extension == entry.first)
+    {
+      return entry.second;
+    }
+  }
+  return nullptr;
 }
+} // namespace
 
 ImageIOBase::Pointer
 ImageIOFactory::CreateImageIO(const char * path, IOFileModeEnum mode)
@@ -48,8 +127,41 @@ ImageIOFactory::CreateImageIO(const char * path, IOFileModeEnum mode)
       std::cerr << "Error ImageIO factory did not return an ImageIOBase: " << allobject->GetNameOfClass() << std::endl;
     }
   }
+
+  // sniff the header once and route directly to the matching IO
+  const char * preferredIOClassName = nullptr;
+  if (mode == IOFileModeEnum::ReadMode)
+  {
+    char          header[512] = {};
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    if (!file.fail())
+    {
+      file.read(header, sizeof(header));
+      preferredIOClassName = ClassNameFromSignature(header, static_cast<size_t>(file.gcount()));
+    }
+    if (preferredIOClassName == nullptr)
+    {
+      preferredIOClassName = ClassNameFromExtension(path);
+    }
+    if (preferredIOClassName != nullptr)
+    {
+      for (auto & k : possibleImageIO)
+      {
+        if (std::strcmp(k->GetNameOfClass(), preferredIOClassName) == 0 && k->CanReadFile(path))
+        {
+          return k;
+        }
+      }
+    }
+  }
+
   for (auto & k : possibleImageIO)
   {
+    if (preferredIOClassName != nullptr && std::strcmp(k->GetNameOfClass(), preferredIOClassName) == 0)
+    {
+      // already probed on the fast path
+      continue;
+    }
     if (mode == IOFileModeEnum::ReadMode)
     {
       if (k->CanReadFile(path))
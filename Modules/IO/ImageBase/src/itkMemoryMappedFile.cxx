@@ -0,0 +1,133 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkMemoryMappedFile.h"
+
+#include "itksys/SystemTools.hxx"
+
+#ifdef _WIN32
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <unistd.h>
+#endif
+
+namespace itk
+{
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+  this->Unmap();
+}
+
+bool
+MemoryMappedFile::Map(const std::string & fileName, SizeValueType offset, SizeValueType length)
+{
+  this->Unmap();
+
+  const SizeValueType fileLength = itksys::SystemTools::FileLength(fileName);
+  if (length == 0 || fileLength < offset + length)
+  {
+    return false;
+  }
+
+#ifdef _WIN32
+  SYSTEM_INFO systemInfo;
+  GetSystemInfo(&systemInfo);
+  const SizeValueType granularity = systemInfo.dwAllocationGranularity;
+  const SizeValueType alignedOffset = (offset / granularity) * granularity;
+  const SizeValueType alignmentSlack = offset - alignedOffset;
+
+  HANDLE fileHandle = CreateFileA(
+    fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (fileHandle == INVALID_HANDLE_VALUE)
+  {
+    return false;
+  }
+  HANDLE mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+  if (mappingHandle == nullptr)
+  {
+    CloseHandle(fileHandle);
+    return false;
+  }
+  void * mappingStart = MapViewOfFile(mappingHandle,
+                                      FILE_MAP_COPY,
+                                      static_cast<DWORD>(alignedOffset >> 32),
+                                      static_cast<DWORD>(alignedOffset & 0xffffffff),
+                                      static_cast<SIZE_T>(alignmentSlack + length));
+  if (mappingStart == nullptr)
+  {
+    CloseHandle(mappingHandle);
+    CloseHandle(fileHandle);
+    return false;
+  }
+  m_FileHandle = fileHandle;
+  m_MappingHandle = mappingHandle;
+#else
+  const SizeValueType granularity = static_cast<SizeValueType>(sysconf(_SC_PAGESIZE));
+  const SizeValueType alignedOffset = (offset / granularity) * granularity;
+  const SizeValueType alignmentSlack = offset - alignedOffset;
+
+  const int fileDescriptor = open(fileName.c_str(), O_RDONLY);
+  if (fileDescriptor < 0)
+  {
+    return false;
+  }
+  void * mappingStart = mmap(nullptr,
+                             static_cast<size_t>(alignmentSlack + length),
+                             PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE,
+                             fileDescriptor,
+                             static_cast<off_t>(alignedOffset));
+  // the mapping keeps its own reference to the file
+  close(fileDescriptor);
+  if (mappingStart == MAP_FAILED)
+  {
+    return false;
+  }
+#endif
+
+  m_MappingStart = mappingStart;
+  m_MappingLength = alignmentSlack + length;
+  m_Buffer = static_cast<char *>(mappingStart) + alignmentSlack;
+  return true;
+}
+
+void
+MemoryMappedFile::Unmap()
+{
+  if (m_MappingStart == nullptr)
+  {
+    return;
+  }
+#ifdef _WIN32
+  UnmapViewOfFile(m_MappingStart);
+  CloseHandle(static_cast<HANDLE>(m_MappingHandle));
+  CloseHandle(static_cast<HANDLE>(m_FileHandle));
+  m_MappingHandle = nullptr;
+  m_FileHandle = nullptr;
+#else
+  munmap(m_MappingStart, static_cast<size_t>(m_MappingLength));
+#endif
+  m_MappingStart = nullptr;
+  m_MappingLength = 0;
+  m_Buffer = nullptr;
+}
+
+} // end namespace itk
@@ -0,0 +1,88 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkBulkAsciiReader.h"
+#include "itkMath.h"
+#include "itkTestingMacros.h"
+
+#include <sstream>
+#include <vector>
+
+// Exercises the bulk ASCII value parser: values split over chunk
+// boundaries, mixed separators, exact stream positioning after the last
+// consumed value, and the premature end-of-stream failure.
+int
+itkBulkAsciiReaderTest(int, char *[])
+{
+  constexpr itk::SizeValueType count = 1000;
+
+  // mixed separators and lines, like a legacy VTK payload
+  std::ostringstream source;
+  for (itk::SizeValueType ii = 0; ii < count; ++ii)
+  {
+    source << 0.25 * static_cast<double>(ii) - 100.0;
+    source << ((ii % 5 == 0) ? '\n' : ' ');
+  }
+  source << "NEXT_SECTION 42\n";
+  const std::string text = source.str();
+
+  // small chunk sizes force tokens onto every kind of chunk boundary
+  for (const itk::SizeValueType chunkSize :
+       { itk::SizeValueType{ 7 }, itk::SizeValueType{ 64 }, itk::SizeValueType{ 1 } << 20 })
+  {
+    std::istringstream  stream(text);
+    std::vector<double> values(count);
+    ITK_TRY_EXPECT_NO_EXCEPTION(itk::ReadBulkAsciiValues(stream, values.data(), count, chunkSize));
+
+    for (itk::SizeValueType ii = 0; ii < count; ++ii)
+    {
+      if (itk::Math::NotExactlyEquals(values[ii], 0.25 * static_cast<double>(ii) - 100.0))
+      {
+        std::cerr << "Value " << ii << " parsed as " << values[ii] << " with chunk size " << chunkSize << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+
+    // the stream must be positioned directly after the last value, so
+    // the following section header is still readable
+    std::string trailer;
+    stream >> trailer;
+    ITK_TEST_EXPECT_EQUAL(trailer, "NEXT_SECTION");
+  }
+
+  // integer parsing
+  {
+    std::istringstream        stream("7 -3 250000 11");
+    std::vector<int>          values(4);
+    ITK_TRY_EXPECT_NO_EXCEPTION(itk::ReadBulkAsciiValues(stream, values.data(), 4));
+    ITK_TEST_EXPECT_EQUAL(values[0], 7);
+    ITK_TEST_EXPECT_EQUAL(values[1], -3);
+    ITK_TEST_EXPECT_EQUAL(values[2], 250000);
+    ITK_TEST_EXPECT_EQUAL(values[3], 11);
+  }
+
+  // a stream ending before the requested count must throw
+  {
+    std::istringstream stream("1 2 3");
+    std::vector<float> values(5);
+    ITK_TRY_EXPECT_EXCEPTION(itk::ReadBulkAsciiValues(stream, values.data(), 5));
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,112 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkGzipChunkCompressor.h"
+#include "itkTestingMacros.h"
+
+namespace
+{
+
+bool
+RoundTrip(itk::SizeValueType inputSize, itk::SizeValueType chunkSize, int compressionLevel)
+{
+  std::vector<char> input(inputSize);
+  for (itk::SizeValueType i = 0; i < inputSize; ++i)
+  {
+    // compressible but not constant
+    input[i] = static_cast<char>((i * i) >> 5);
+  }
+
+  auto compressor = itk::GzipChunkCompressor::New();
+  compressor->SetChunkSize(chunkSize);
+  compressor->SetCompressionLevel(compressionLevel);
+
+  std::vector<char>                             compressed;
+  itk::GzipChunkCompressor::ChunkSizesType      chunkSizes;
+  compressor->Compress(input.data(), inputSize, compressed, chunkSizes);
+
+  const itk::SizeValueType expectedChunks = (inputSize + chunkSize - 1) / chunkSize;
+  if (chunkSizes.size() != expectedChunks)
+  {
+    std::cerr << "Expected " << expectedChunks << " chunks, got " << chunkSizes.size() << std::endl;
+    return false;
+  }
+
+  itk::SizeValueType compressedBytes = 0;
+  for (const auto size : chunkSizes)
+  {
+    compressedBytes += size;
+  }
+  if (compressedBytes != compressed.size())
+  {
+    std::cerr << "The chunk sizes do not add up to the compressed byte count." << std::endl;
+    return false;
+  }
+
+  std::vector<char> output(inputSize);
+  compressor->Decompress(compressed.data(), chunkSizes, output.data(), inputSize);
+
+  if (input != output)
+  {
+    std::cerr << "Round trip mismatch for inputSize " << inputSize << " chunkSize " << chunkSize << std::endl;
+    return false;
+  }
+  return true;
+}
+
+} // namespace
+
+int
+itkGzipChunkCompressorTest(int, char *[])
+{
+  // multiple chunks, a partial trailing chunk, a single chunk, and the
+  // fastest / best compression levels
+  ITK_TEST_EXPECT_TRUE(RoundTrip(1 << 20, 1 << 16, 1));
+  ITK_TEST_EXPECT_TRUE(RoundTrip((1 << 20) + 12345, 1 << 16, 9));
+  ITK_TEST_EXPECT_TRUE(RoundTrip(1000, 1 << 16, -1));
+
+  // empty input produces no chunks
+  {
+    auto compressor = itk::GzipChunkCompressor::New();
+
+    std::vector<char>                        compressed;
+    itk::GzipChunkCompressor::ChunkSizesType chunkSizes;
+    compressor->Compress(nullptr, 0, compressed, chunkSizes);
+    ITK_TEST_EXPECT_TRUE(compressed.empty());
+    ITK_TEST_EXPECT_TRUE(chunkSizes.empty());
+    ITK_TRY_EXPECT_NO_EXCEPTION(compressor->Decompress(nullptr, chunkSizes, nullptr, 0));
+  }
+
+  // a chunk count that does not match the output size is rejected
+  {
+    auto compressor = itk::GzipChunkCompressor::New();
+    compressor->SetChunkSize(1 << 16);
+
+    std::vector<char>                        input(1 << 17);
+    std::vector<char>                        compressed;
+    itk::GzipChunkCompressor::ChunkSizesType chunkSizes;
+    compressor->Compress(input.data(), static_cast<itk::SizeValueType>(input.size()), compressed, chunkSizes);
+
+    std::vector<char> output(input.size());
+    ITK_TRY_EXPECT_EXCEPTION(
+      compressor->Decompress(compressed.data(), chunkSizes, output.data(), static_cast<itk::SizeValueType>(1 << 16)));
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
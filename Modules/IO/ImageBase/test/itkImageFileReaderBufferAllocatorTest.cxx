@@ -0,0 +1,135 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkBufferAllocatorBase.h"
+#include "itkImageFileReader.h"
+#include "itkImageFileWriter.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkTestingMacros.h"
+
+// Verifies that a BufferAllocator set on ImageFileReader supplies the
+// output pixel buffer, that the read contents match a plain read, and
+// that the buffer is returned to the allocator when the image goes
+// away.
+
+namespace
+{
+
+class CountingAllocator : public itk::BufferAllocatorBase
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(CountingAllocator);
+
+  using Self = CountingAllocator;
+  using Superclass = itk::BufferAllocatorBase;
+  using Pointer = itk::SmartPointer<Self>;
+
+  itkNewMacro(Self);
+  itkTypeMacro(CountingAllocator, BufferAllocatorBase);
+
+  void *
+  AllocateBuffer(itk::SizeValueType numberOfBytes) override
+  {
+    ++m_AllocationCount;
+    m_LastAllocationSize = numberOfBytes;
+    return ::operator new(numberOfBytes);
+  }
+
+  void
+  DeallocateBuffer(void * buffer) override
+  {
+    ++m_DeallocationCount;
+    ::operator delete(buffer);
+  }
+
+  itkGetConstMacro(AllocationCount, unsigned int);
+  itkGetConstMacro(DeallocationCount, unsigned int);
+  itkGetConstMacro(LastAllocationSize, itk::SizeValueType);
+
+protected:
+  CountingAllocator() = default;
+  ~CountingAllocator() override = default;
+
+private:
+  unsigned int       m_AllocationCount{ 0 };
+  unsigned int       m_DeallocationCount{ 0 };
+  itk::SizeValueType m_LastAllocationSize{ 0 };
+};
+
+} // namespace
+
+int
+itkImageFileReaderBufferAllocatorTest(int argc, char * argv[])
+{
+  if (argc < 2)
+  {
+    std::cerr << "Missing Parameters." << std::endl;
+    std::cerr << "Usage: " << itkNameOfTestExecutableMacro(argv) << " OutputFileName" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  using ImageType = itk::Image<unsigned short, 3>;
+
+  auto image = ImageType::New();
+  auto region = ImageType::RegionType(itk::MakeSize(19, 17, 11));
+  image->SetRegions(region);
+  image->Allocate();
+  itk::ImageRegionIteratorWithIndex<ImageType> it(image, region);
+  for (it.GoToBegin(); !it.IsAtEnd(); ++it)
+  {
+    const ImageType::IndexType idx = it.GetIndex();
+    it.Set(static_cast<unsigned short>(idx[2] * 1000 + idx[1] * 30 + idx[0]));
+  }
+  ITK_TRY_EXPECT_NO_EXCEPTION(itk::WriteImage(image, argv[1]));
+
+  ImageType::Pointer plainImage;
+  ITK_TRY_EXPECT_NO_EXCEPTION(plainImage = itk::ReadImage<ImageType>(argv[1]));
+
+  auto allocator = CountingAllocator::New();
+  {
+    using ReaderType = itk::ImageFileReader<ImageType>;
+    auto reader = ReaderType::New();
+    reader->SetFileName(argv[1]);
+    reader->SetBufferAllocator(allocator);
+    ITK_TEST_EXPECT_TRUE(reader->GetBufferAllocator() == allocator.GetPointer());
+    ITK_TRY_EXPECT_NO_EXCEPTION(reader->Update());
+
+    ITK_TEST_EXPECT_EQUAL(allocator->GetAllocationCount(), 1);
+    ITK_TEST_EXPECT_EQUAL(allocator->GetLastAllocationSize(),
+                          region.GetNumberOfPixels() * sizeof(ImageType::PixelType));
+
+    ImageType::Pointer allocatedImage = reader->GetOutput();
+    itk::ImageRegionIteratorWithIndex<ImageType> plainIt(plainImage, plainImage->GetBufferedRegion());
+    for (plainIt.GoToBegin(); !plainIt.IsAtEnd(); ++plainIt)
+    {
+      if (plainIt.Get() != allocatedImage->GetPixel(plainIt.GetIndex()))
+      {
+        std::cerr << "Pixel mismatch at " << plainIt.GetIndex() << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+    ITK_TEST_EXPECT_EQUAL(allocator->GetDeallocationCount(), 0);
+  }
+
+  // the reader and its output are gone; the buffer went back to the
+  // allocator
+  ITK_TEST_EXPECT_EQUAL(allocator->GetDeallocationCount(), 1);
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,70 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkImageIOFactory.h"
+#include "itkMetaImageIOFactory.h"
+#include "itkImage.h"
+#include "itkImageFileWriter.h"
+#include "itkTestingMacros.h"
+
+// Verifies that CreateImageIO resolves a file through the header
+// signature / extension fast path and still confirms with CanReadFile.
+int
+itkImageIOFactorySniffTest(int argc, char * argv[])
+{
+  if (argc < 2)
+  {
+    std::cerr << "Usage: " << itkNameOfTestExecutableMacro(argv) << " outputFileName.mha" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const std::string fileName = argv[1];
+
+  itk::MetaImageIOFactory::RegisterOneFactory();
+
+  using ImageType = itk::Image<unsigned char, 2>;
+  auto image = ImageType::New();
+  image->SetRegions(itk::MakeSize(8, 8));
+  image->Allocate(true);
+  ITK_TRY_EXPECT_NO_EXCEPTION(itk::WriteImage(image.GetPointer(), fileName));
+
+  // read mode: the header signature routes straight to MetaImageIO
+  {
+    const itk::ImageIOBase::Pointer io =
+      itk::ImageIOFactory::CreateImageIO(fileName.c_str(), itk::IOFileModeEnum::ReadMode);
+    ITK_TEST_EXPECT_TRUE(io.IsNotNull());
+    ITK_TEST_EXPECT_EQUAL(std::string(io->GetNameOfClass()), "MetaImageIO");
+  }
+
+  // write mode keeps the trial loop
+  {
+    const itk::ImageIOBase::Pointer io =
+      itk::ImageIOFactory::CreateImageIO(fileName.c_str(), itk::IOFileModeEnum::WriteMode);
+    ITK_TEST_EXPECT_TRUE(io.IsNotNull());
+    ITK_TEST_EXPECT_EQUAL(std::string(io->GetNameOfClass()), "MetaImageIO");
+  }
+
+  // a file that cannot be opened must still yield no IO
+  {
+    const itk::ImageIOBase::Pointer io =
+      itk::ImageIOFactory::CreateImageIO("/this/file/does/not/exist.mha", itk::IOFileModeEnum::ReadMode);
+    ITK_TEST_EXPECT_TRUE(io.IsNull());
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
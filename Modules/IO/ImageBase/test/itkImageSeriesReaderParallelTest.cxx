@@ -0,0 +1,134 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkImageSeriesReader.h"
+#include "itkImageFileWriter.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkTestingMacros.h"
+
+#include <iomanip>
+#include <sstream>
+
+// Writes a series of 2D slices with evenly spaced origins and verifies
+// that the concurrent reading mode produces the same volume, meta data
+// dictionary array and geometry as the sequential one.
+
+int
+itkImageSeriesReaderParallelTest(int argc, char * argv[])
+{
+  if (argc < 2)
+  {
+    std::cerr << "Missing Parameters." << std::endl;
+    std::cerr << "Usage: " << itkNameOfTestExecutableMacro(argv) << " OutputPrefix" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  using SliceType = itk::Image<unsigned short, 2>;
+  using VolumeType = itk::Image<unsigned short, 3>;
+
+  constexpr unsigned int numberOfSlices = 16;
+  constexpr double       sliceSpacing = 1.5;
+
+  std::vector<std::string> fileNames;
+  for (unsigned int i = 0; i < numberOfSlices; ++i)
+  {
+    auto slice = SliceType::New();
+    slice->SetRegions(SliceType::SizeType{ { 32, 24 } });
+    slice->Allocate();
+
+    itk::ImageRegionIteratorWithIndex<SliceType> it(slice, slice->GetBufferedRegion());
+    for (; !it.IsAtEnd(); ++it)
+    {
+      const auto index = it.GetIndex();
+      it.Set(static_cast<unsigned short>(index[0] + 100 * index[1] + 10000 * i));
+    }
+
+    SliceType::PointType origin;
+    origin[0] = 0.0;
+    origin[1] = i * sliceSpacing;
+    slice->SetOrigin(origin);
+
+    std::ostringstream fileName;
+    fileName << argv[1] << std::setfill('0') << std::setw(3) << i << ".mha";
+    fileNames.push_back(fileName.str());
+
+    auto writer = itk::ImageFileWriter<SliceType>::New();
+    writer->SetFileName(fileNames.back());
+    writer->SetInput(slice);
+    ITK_TRY_EXPECT_NO_EXCEPTION(writer->Update());
+  }
+
+  using ReaderType = itk::ImageSeriesReader<VolumeType>;
+
+  auto sequentialReader = ReaderType::New();
+  sequentialReader->SetFileNames(fileNames);
+  ITK_TEST_EXPECT_TRUE(!sequentialReader->GetUseParallelReading());
+  ITK_TRY_EXPECT_NO_EXCEPTION(sequentialReader->Update());
+
+  auto parallelReader = ReaderType::New();
+  parallelReader->SetFileNames(fileNames);
+  parallelReader->UseParallelReadingOn();
+  ITK_TEST_EXPECT_TRUE(parallelReader->GetUseParallelReading());
+  ITK_TRY_EXPECT_NO_EXCEPTION(parallelReader->Update());
+
+  const VolumeType * sequentialVolume = sequentialReader->GetOutput();
+  const VolumeType * parallelVolume = parallelReader->GetOutput();
+
+  ITK_TEST_EXPECT_TRUE(parallelVolume->GetBufferedRegion() == sequentialVolume->GetBufferedRegion());
+  ITK_TEST_EXPECT_TRUE(parallelVolume->GetOrigin() == sequentialVolume->GetOrigin());
+  ITK_TEST_EXPECT_TRUE(parallelVolume->GetSpacing() == sequentialVolume->GetSpacing());
+
+  itk::ImageRegionConstIteratorWithIndex<VolumeType> volumeIt(parallelVolume, parallelVolume->GetBufferedRegion());
+  for (; !volumeIt.IsAtEnd(); ++volumeIt)
+  {
+    if (volumeIt.Get() != sequentialVolume->GetPixel(volumeIt.GetIndex()))
+    {
+      std::cerr << "Pixel mismatch between sequential and parallel read at " << volumeIt.GetIndex() << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // the meta data dictionaries are collected for all slices in series order
+  ITK_TEST_EXPECT_EQUAL(parallelReader->GetMetaDataDictionaryArray()->size(), numberOfSlices);
+  ITK_TEST_EXPECT_EQUAL(sequentialReader->GetMetaDataDictionaryArray()->size(), numberOfSlices);
+
+  // a streamed read of an inner sub-volume must also match
+  auto streamedReader = ReaderType::New();
+  streamedReader->SetFileNames(fileNames);
+  streamedReader->UseParallelReadingOn();
+  streamedReader->MetaDataDictionaryArrayUpdateOff();
+
+  VolumeType::RegionType streamedRegion;
+  streamedRegion.SetIndex({ { 0, 0, 5 } });
+  streamedRegion.SetSize({ { 32, 24, 6 } });
+  streamedReader->GetOutput()->SetRequestedRegion(streamedRegion);
+  ITK_TRY_EXPECT_NO_EXCEPTION(streamedReader->Update());
+
+  itk::ImageRegionConstIteratorWithIndex<VolumeType> streamedIt(streamedReader->GetOutput(), streamedRegion);
+  for (; !streamedIt.IsAtEnd(); ++streamedIt)
+  {
+    if (streamedIt.Get() != sequentialVolume->GetPixel(streamedIt.GetIndex()))
+    {
+      std::cerr << "Pixel mismatch in the streamed parallel read at " << streamedIt.GetIndex() << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,122 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkImageSeriesReader.h"
+#include "itkImageSeriesWriter.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkTestingMacros.h"
+
+#include <iomanip>
+#include <sstream>
+
+// Writes the slices of a volume once sequentially and once with
+// UseParallelWriting, then reads both series back and verifies they
+// are identical.
+
+namespace
+{
+
+std::vector<std::string>
+MakeSliceFileNames(const std::string & prefix, unsigned int numberOfSlices)
+{
+  std::vector<std::string> fileNames;
+  for (unsigned int i = 0; i < numberOfSlices; ++i)
+  {
+    std::ostringstream name;
+    name << prefix << std::setfill('0') << std::setw(3) << i << ".mha";
+    fileNames.push_back(name.str());
+  }
+  return fileNames;
+}
+
+} // namespace
+
+int
+itkImageSeriesWriterParallelTest(int argc, char * argv[])
+{
+  if (argc < 2)
+  {
+    std::cerr << "Missing Parameters." << std::endl;
+    std::cerr << "Usage: " << itkNameOfTestExecutableMacro(argv) << " OutputPrefix" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const std::string prefix = argv[1];
+
+  constexpr unsigned int numberOfSlices = 13;
+
+  using VolumeType = itk::Image<unsigned short, 3>;
+  using SliceType = itk::Image<unsigned short, 2>;
+
+  auto volume = VolumeType::New();
+  auto region = VolumeType::RegionType(itk::MakeSize(32, 24, numberOfSlices));
+  volume->SetRegions(region);
+  volume->Allocate();
+  VolumeType::SpacingType spacing;
+  spacing[0] = 1.0;
+  spacing[1] = 1.0;
+  spacing[2] = 2.5;
+  volume->SetSpacing(spacing);
+  itk::ImageRegionIteratorWithIndex<VolumeType> it(volume, region);
+  for (it.GoToBegin(); !it.IsAtEnd(); ++it)
+  {
+    const VolumeType::IndexType idx = it.GetIndex();
+    it.Set(static_cast<unsigned short>(idx[2] * 1000 + idx[1] * 40 + idx[0]));
+  }
+
+  using WriterType = itk::ImageSeriesWriter<VolumeType, SliceType>;
+
+  const std::vector<std::string> sequentialNames = MakeSliceFileNames(prefix + "Sequential", numberOfSlices);
+  auto                           sequentialWriter = WriterType::New();
+  sequentialWriter->SetInput(volume);
+  sequentialWriter->SetFileNames(sequentialNames);
+  ITK_TRY_EXPECT_NO_EXCEPTION(sequentialWriter->Update());
+
+  const std::vector<std::string> parallelNames = MakeSliceFileNames(prefix + "Parallel", numberOfSlices);
+  auto                           parallelWriter = WriterType::New();
+  parallelWriter->SetInput(volume);
+  parallelWriter->SetFileNames(parallelNames);
+  parallelWriter->UseParallelWritingOn();
+  ITK_TEST_EXPECT_TRUE(parallelWriter->GetUseParallelWriting());
+  ITK_TRY_EXPECT_NO_EXCEPTION(parallelWriter->Update());
+
+  using ReaderType = itk::ImageSeriesReader<VolumeType>;
+  auto sequentialReader = ReaderType::New();
+  sequentialReader->SetFileNames(sequentialNames);
+  ITK_TRY_EXPECT_NO_EXCEPTION(sequentialReader->Update());
+  auto parallelReader = ReaderType::New();
+  parallelReader->SetFileNames(parallelNames);
+  ITK_TRY_EXPECT_NO_EXCEPTION(parallelReader->Update());
+
+  VolumeType::ConstPointer sequentialVolume = sequentialReader->GetOutput();
+  VolumeType::ConstPointer parallelVolume = parallelReader->GetOutput();
+  ITK_TEST_EXPECT_TRUE(sequentialVolume->GetLargestPossibleRegion() == parallelVolume->GetLargestPossibleRegion());
+
+  itk::ImageRegionIteratorWithIndex<VolumeType> checkIt(volume, region);
+  for (checkIt.GoToBegin(); !checkIt.IsAtEnd(); ++checkIt)
+  {
+    const VolumeType::IndexType idx = checkIt.GetIndex();
+    if (sequentialVolume->GetPixel(idx) != checkIt.Get() || parallelVolume->GetPixel(idx) != checkIt.Get())
+    {
+      std::cerr << "Pixel mismatch at " << idx << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
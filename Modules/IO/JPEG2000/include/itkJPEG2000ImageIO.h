@@ -145,6 +145,21 @@ public:
   void
   SetTileSize(int x, int y);
 
+  /** Set/Get the number of highest resolution levels to discard when
+   * reading. Each discarded level halves the decoded extent along every
+   * dimension, so level \c r decodes only about 4^-r of the full
+   * resolution data directly from the codestream. The level must be set
+   * before calling ReadImageInformation(): the reported dimensions
+   * describe the reduced image, and the spacing is scaled by 2^r so the
+   * physical extent is preserved. The default of 0 reads the full
+   * resolution. Reading fails if the codestream holds fewer resolution
+   * levels than requested. */
+  void
+  SetResolutionLevel(unsigned int level);
+
+  unsigned int
+  GetResolutionLevel() const;
+
   /** Currently JPEG2000 does not support streamed writing
    *
    * These methods are re-overridden to not support streaming for
@@ -163,6 +178,8 @@ protected:
 private:
   std::unique_ptr<JPEG2000ImageIOInternal> m_Internal;
 
+  unsigned int m_ResolutionLevel{ 0 };
+
   using SizeValueType = ImageIORegion::SizeValueType;
   using IndexValueType = ImageIORegion::IndexValueType;
 
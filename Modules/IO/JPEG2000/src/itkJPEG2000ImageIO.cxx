@@ -19,6 +19,9 @@
 #include "itkJPEG2000ImageIO.h"
 #include "itksys/SystemTools.hxx"
 
+#include <algorithm>
+#include <cstdint>
+
 // for memset
 // for malloc
 
@@ -104,6 +107,8 @@ void
 JPEG2000ImageIO::PrintSelf(std::ostream & os, Indent indent) const
 {
   Superclass::PrintSelf(os, indent);
+
+  os << indent << "ResolutionLevel: " << this->m_ResolutionLevel << std::endl;
 }
 
 bool
@@ -133,6 +138,22 @@ JPEG2000ImageIO::SetTileSize(int x, int y)
   this->Modified();
 }
 
+void
+JPEG2000ImageIO::SetResolutionLevel(unsigned int level)
+{
+  if (this->m_ResolutionLevel != level)
+  {
+    this->m_ResolutionLevel = level;
+    this->Modified();
+  }
+}
+
+unsigned int
+JPEG2000ImageIO::GetResolutionLevel() const
+{
+  return this->m_ResolutionLevel;
+}
+
 
 void
 JPEG2000ImageIO::ReadImageInformation()
@@ -153,6 +174,9 @@ JPEG2000ImageIO::ReadImageInformation()
   /* set decoding parameters to default values */
   opj_set_default_decoder_parameters(&(this->m_Internal->m_DecompressionParameters));
 
+  /* discard the requested number of highest resolution levels */
+  this->m_Internal->m_DecompressionParameters.cp_reduce = this->m_ResolutionLevel;
+
   opj_stream_t * cio = opj_stream_create_default_file_stream(l_file, true);
 
   this->m_Internal->m_Dinfo = nullptr; /* handle to a decompressor */
@@ -283,11 +307,20 @@ JPEG2000ImageIO::ReadImageInformation()
                                                               << "Reason: Error whle reading image header");
   }
 
-  this->m_Internal->m_TileStartX = l_tile_x0;
-  this->m_Internal->m_TileStartY = l_tile_y0;
+  // The codestream reports its geometry on the full resolution reference
+  // grid; with a resolution level r every coordinate shrinks by 2^r,
+  // rounding up as the wavelet transform does.
+  const auto reduced = [this](OPJ_UINT32 coordinate) -> OPJ_UINT32 {
+    return static_cast<OPJ_UINT32>(
+      (static_cast<uint64_t>(coordinate) + ((uint64_t{ 1 } << this->m_ResolutionLevel) - 1)) >>
+      this->m_ResolutionLevel);
+  };
 
-  this->m_Internal->m_TileWidth = l_tile_width;
-  this->m_Internal->m_TileHeight = l_tile_height;
+  this->m_Internal->m_TileStartX = reduced(l_tile_x0);
+  this->m_Internal->m_TileStartY = reduced(l_tile_y0);
+
+  this->m_Internal->m_TileWidth = reduced(l_tile_width);
+  this->m_Internal->m_TileHeight = reduced(l_tile_height);
 
   this->m_Internal->m_NumberOfTilesInX = l_nb_tiles_x;
   this->m_Internal->m_NumberOfTilesInY = l_nb_tiles_y;
@@ -341,11 +374,13 @@ JPEG2000ImageIO::ReadImageInformation()
   itkDebugMacro(<< "image->x1 = " << l_image->x1);
   itkDebugMacro(<< "image->y1 = " << l_image->y1);
 
-  this->SetDimensions(0, l_image->x1);
-  this->SetDimensions(1, l_image->y1);
+  this->SetDimensions(0, reduced(l_image->x1));
+  this->SetDimensions(1, reduced(l_image->y1));
 
-  this->SetSpacing(0, 1.0); // FIXME : Get the real pixel resolution.
-  this->SetSpacing(1, 1.0); // FIXME : Get the real pixel resolution.
+  // FIXME : Get the real pixel resolution. One pixel at resolution level
+  // r covers 2^r pixels of the full resolution image.
+  this->SetSpacing(0, static_cast<double>(uint64_t{ 1 } << this->m_ResolutionLevel));
+  this->SetSpacing(1, static_cast<double>(uint64_t{ 1 } << this->m_ResolutionLevel));
 
   /* close the byte stream */
   opj_stream_destroy(cio);
@@ -441,6 +476,9 @@ JPEG2000ImageIO::Read(void * buffer)
   }
   /* catch events using our callbacks and give a local context */
 
+  /* keep the resolution reduction consistent with ReadImageInformation() */
+  this->m_Internal->m_DecompressionParameters.cp_reduce = this->m_ResolutionLevel;
+
   /* setup the decoder decoding parameters using user parameters */
   if (!opj_setup_decoder(this->m_Internal->m_Dinfo, &(this->m_Internal->m_DecompressionParameters)))
   {
@@ -488,10 +526,15 @@ JPEG2000ImageIO::Read(void * buffer)
   const unsigned int starty = start[1];
   // const unsigned int startz = start[2];
 
-  auto p_start_x = static_cast<OPJ_INT32>(startx);
-  auto p_start_y = static_cast<OPJ_INT32>(starty);
-  auto p_end_x = static_cast<OPJ_INT32>(startx + sizex);
-  auto p_end_y = static_cast<OPJ_INT32>(starty + sizey);
+  // The IORegion lives on the reduced grid of the selected resolution
+  // level, while opj_set_decode_area expects full resolution reference
+  // grid coordinates.
+  const unsigned int level = this->m_ResolutionLevel;
+
+  auto p_start_x = static_cast<OPJ_INT32>(startx << level);
+  auto p_start_y = static_cast<OPJ_INT32>(starty << level);
+  auto p_end_x = static_cast<OPJ_INT32>(std::min<OPJ_UINT32>((startx + sizex) << level, l_image->x1));
+  auto p_end_y = static_cast<OPJ_INT32>(std::min<OPJ_UINT32>((starty + sizey) << level, l_image->y1));
 
   itkDebugMacro(<< "opj_set_decode_area() before");
   itkDebugMacro(<< "p_start_x = " << p_start_x);
@@ -599,8 +642,20 @@ JPEG2000ImageIO::Read(void * buffer)
 
       OPJ_BYTE * l_data_ptr = l_data;
 
-      const SizeValueType tsizex = l_current_tile_x1 - l_current_tile_x0;
-      const SizeValueType tsizey = l_current_tile_y1 - l_current_tile_y0;
+      // Tile coordinates come back on the full resolution reference grid,
+      // while the decoded samples and the output buffer live on the
+      // reduced grid: rescale before computing the buffer strides.
+      const auto reduced = [level](OPJ_INT32 coordinate) {
+        return static_cast<OPJ_INT32>(
+          (static_cast<uint64_t>(coordinate) + ((uint64_t{ 1 } << level) - 1)) >> level);
+      };
+      const OPJ_INT32 l_reduced_tile_x0 = reduced(l_current_tile_x0);
+      const OPJ_INT32 l_reduced_tile_y0 = reduced(l_current_tile_y0);
+      const OPJ_INT32 l_reduced_tile_x1 = reduced(l_current_tile_x1);
+      const OPJ_INT32 l_reduced_tile_y1 = reduced(l_current_tile_y1);
+
+      const SizeValueType tsizex = l_reduced_tile_x1 - l_reduced_tile_x0;
+      const SizeValueType tsizey = l_reduced_tile_y1 - l_reduced_tile_y0;
       const SizeValueType numberOfPixels = tsizex * tsizey;
       const SizeValueType numberOfComponents = this->GetNumberOfComponents();
       const SizeValueType sizePerComponentInBytes = l_data_size / (numberOfPixels * numberOfComponents);
@@ -611,11 +666,11 @@ JPEG2000ImageIO::Read(void * buffer)
 
       const SizeValueType sizePerStrideXInBytes = sizePerChannelInBytes / tsizey;
       const SizeValueType initialStrideInBytes =
-        (l_current_tile_y0 - p_start_y) * sizex * sizePerComponentInBytes * numberOfComponents;
+        (l_reduced_tile_y0 - static_cast<OPJ_INT32>(starty)) * sizex * sizePerComponentInBytes * numberOfComponents;
       const SizeValueType priorStrideInBytes =
-        (l_current_tile_x0 - p_start_x) * sizePerComponentInBytes * numberOfComponents;
+        (l_reduced_tile_x0 - static_cast<OPJ_INT32>(startx)) * sizePerComponentInBytes * numberOfComponents;
       const SizeValueType postStrideInBytes =
-        (p_end_x - l_current_tile_x1) * sizePerComponentInBytes * numberOfComponents;
+        (static_cast<OPJ_INT32>(startx + sizex) - l_reduced_tile_x1) * sizePerComponentInBytes * numberOfComponents;
 
       itkDebugMacro(<< "sizePerStrideYInBytes:   " << sizePerChannelInBytes / tsizex);
       itkDebugMacro(<< "sizePerStrideXInBytes:   " << sizePerStrideXInBytes);
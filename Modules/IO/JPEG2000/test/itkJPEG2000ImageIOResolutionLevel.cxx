@@ -0,0 +1,99 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkImageFileReader.h"
+#include "itkImageFileWriter.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkJPEG2000ImageIO.h"
+#include "itkMath.h"
+#include "itkTestingMacros.h"
+
+// Reads a lossless codestream back at reduced resolution levels and
+// verifies the reported geometry. The reversible 5/3 wavelet maps a
+// constant image to the same constant at every level, so the decoded
+// pixel values can be checked exactly.
+int
+itkJPEG2000ImageIOResolutionLevel(int argc, char * argv[])
+{
+  if (argc < 2)
+  {
+    std::cerr << "Missing parameters." << std::endl;
+    std::cerr << "Usage: " << itkNameOfTestExecutableMacro(argv);
+    std::cerr << " output.j2k" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const std::string fileName = argv[1];
+
+  using PixelType = unsigned char;
+  using ImageType = itk::Image<PixelType, 2>;
+
+  constexpr PixelType     pixelValue = 87;
+  constexpr unsigned int  fullWidth = 128;
+  constexpr unsigned int  fullHeight = 96;
+
+  {
+    auto image = ImageType::New();
+    image->SetRegions(itk::MakeSize(fullWidth, fullHeight));
+    image->Allocate();
+    image->FillBuffer(pixelValue);
+
+    auto writerIO = itk::JPEG2000ImageIO::New();
+    auto writer = itk::ImageFileWriter<ImageType>::New();
+    writer->SetFileName(fileName);
+    writer->SetImageIO(writerIO);
+    writer->SetInput(image);
+    ITK_TRY_EXPECT_NO_EXCEPTION(writer->Update());
+  }
+
+  for (unsigned int level = 0; level < 3; ++level)
+  {
+    auto io = itk::JPEG2000ImageIO::New();
+    io->SetResolutionLevel(level);
+    ITK_TEST_EXPECT_EQUAL(io->GetResolutionLevel(), level);
+
+    auto reader = itk::ImageFileReader<ImageType>::New();
+    reader->SetFileName(fileName);
+    reader->SetImageIO(io);
+    ITK_TRY_EXPECT_NO_EXCEPTION(reader->Update());
+
+    const ImageType::ConstPointer image = reader->GetOutput();
+    const ImageType::SizeType     size = image->GetLargestPossibleRegion().GetSize();
+
+    ITK_TEST_EXPECT_EQUAL(size[0], fullWidth >> level);
+    ITK_TEST_EXPECT_EQUAL(size[1], fullHeight >> level);
+
+    const double expectedSpacing = static_cast<double>(1u << level);
+    ITK_TEST_EXPECT_TRUE(itk::Math::ExactlyEquals(image->GetSpacing()[0], expectedSpacing));
+    ITK_TEST_EXPECT_TRUE(itk::Math::ExactlyEquals(image->GetSpacing()[1], expectedSpacing));
+
+    itk::ImageRegionConstIterator<ImageType> it(image, image->GetLargestPossibleRegion());
+    for (it.GoToBegin(); !it.IsAtEnd(); ++it)
+    {
+      if (it.Get() != pixelValue)
+      {
+        std::cerr << "Level " << level << ": wrong pixel value " << static_cast<int>(it.Get()) << " at " << it.GetIndex()
+                  << ", expected " << static_cast<int>(pixelValue) << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+
+    io->Print(std::cout);
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
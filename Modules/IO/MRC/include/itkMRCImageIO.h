@@ -90,6 +90,19 @@ public:
   void
   Read(void * buffer) override;
 
+  /** Determine if the voxel data can be memory mapped directly: MRC
+   * voxel data is never compressed and follows the (extended) header
+   * contiguously, so mapping is possible whenever the file byte order
+   * matches the host. ReadImageInformation must be called prior to
+   * this function. */
+  bool
+  CanReadMemoryMapped() override;
+
+  /** The byte offset of the voxel data: the fixed header plus the
+   * extended header. */
+  SizeValueType
+  GetImageDataByteOffset() override;
+
   // -------- This part of the interfaces deals with writing data. -----
 
   /** \brief Returns true if this ImageIO can write the specified
@@ -7,6 +7,7 @@ itk_module(ITKIOMRC
     ITKIOImageBase
   TEST_DEPENDS
     ITKTestKernel
+    ITKImageGrid
     ITKImageSources
   FACTORY_NAMES
     ImageIO::MRC
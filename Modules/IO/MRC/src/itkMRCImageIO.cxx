@@ -334,6 +334,24 @@ MRCImageIO ::Read(void * buffer)
   }
 }
 
+bool
+MRCImageIO::CanReadMemoryMapped()
+{
+  if (m_MRCHeader.IsNull())
+  {
+    return false;
+  }
+
+  // only a byte order mismatch forces the swapping buffered path
+  return m_MRCHeader->IsOriginalHeaderBigEndian() == ByteSwapper<void *>::SystemIsBigEndian();
+}
+
+SizeValueType
+MRCImageIO::GetImageDataByteOffset()
+{
+  return static_cast<SizeValueType>(this->GetHeaderSize());
+}
+
 bool
 MRCImageIO::CanWriteFile(const char * fname)
 {
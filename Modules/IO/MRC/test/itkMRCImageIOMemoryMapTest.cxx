@@ -0,0 +1,132 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkImage.h"
+#include "itkImageFileReader.h"
+#include "itkImageFileWriter.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkMemoryMappedPixelContainer.h"
+#include "itkMRCImageIO.h"
+#include "itkRegionOfInterestImageFilter.h"
+#include "itkTestingMacros.h"
+
+// Write a native-endian .mrc volume and verify that the reader can
+// attach a copy-on-write memory mapping of the voxel data as the
+// output pixel buffer, that writes to the mapped buffer never reach
+// the file, and that a region-of-interest extraction driven by a
+// streamed read buffers only the requested sub-volume.
+int
+itkMRCImageIOMemoryMapTest(int argc, char * argv[])
+{
+  if (argc < 2)
+  {
+    std::cerr << "Usage: " << itkNameOfTestExecutableMacro(argv) << " outputFileBase" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  using ImageType = itk::Image<float, 3>;
+  using MappedContainerType = itk::MemoryMappedPixelContainer<itk::SizeValueType, float>;
+
+  const std::string fileName = std::string(argv[1]) + ".mrc";
+
+  auto                  image = ImageType::New();
+  ImageType::SizeType   size = { { 31, 27, 13 } };
+  ImageType::RegionType region(size);
+  image->SetRegions(region);
+  image->Allocate();
+
+  itk::ImageRegionIteratorWithIndex<ImageType> fillIterator(image, region);
+  for (fillIterator.GoToBegin(); !fillIterator.IsAtEnd(); ++fillIterator)
+  {
+    const ImageType::IndexType idx = fillIterator.GetIndex();
+    fillIterator.Set(static_cast<float>(idx[2] * 1000 + idx[1] * 40 + idx[0]));
+  }
+
+  auto writer = itk::ImageFileWriter<ImageType>::New();
+  writer->SetInput(image);
+  writer->SetFileName(fileName);
+  ITK_TRY_EXPECT_NO_EXCEPTION(writer->Update());
+
+  // after the header is read the IO must report the data as mappable
+  auto io = itk::MRCImageIO::New();
+  io->SetFileName(fileName);
+  io->ReadImageInformation();
+  ITK_TEST_EXPECT_TRUE(io->CanReadMemoryMapped());
+  ITK_TEST_EXPECT_EQUAL(io->GetImageDataByteOffset(), 1024u);
+
+  auto reader = itk::ImageFileReader<ImageType>::New();
+  reader->SetFileName(fileName);
+  reader->UseMemoryMappedReadingOn();
+  ITK_TRY_EXPECT_NO_EXCEPTION(reader->Update());
+
+  auto * mappedContainer = dynamic_cast<MappedContainerType *>(reader->GetOutput()->GetPixelContainer());
+  ITK_TEST_EXPECT_TRUE(mappedContainer != nullptr);
+
+  itk::ImageRegionIteratorWithIndex<ImageType> outputIterator(reader->GetOutput(), region);
+  for (outputIterator.GoToBegin(); !outputIterator.IsAtEnd(); ++outputIterator)
+  {
+    if (outputIterator.Get() != image->GetPixel(outputIterator.GetIndex()))
+    {
+      std::cerr << "Mapped pixel differs at " << outputIterator.GetIndex() << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // The mapping is copy-on-write: scribbling over the mapped buffer must
+  // not change what a second reader sees in the file.
+  reader->GetOutput()->FillBuffer(0.0f);
+  auto verifyingReader = itk::ImageFileReader<ImageType>::New();
+  verifyingReader->SetFileName(fileName);
+  ITK_TRY_EXPECT_NO_EXCEPTION(verifyingReader->Update());
+  const ImageType::IndexType probeIndex = { { 11, 7, 5 } };
+  ITK_TEST_EXPECT_EQUAL(verifyingReader->GetOutput()->GetPixel(probeIndex), image->GetPixel(probeIndex));
+
+  // A region-of-interest extraction with a streaming reader must buffer
+  // only the requested sub-volume (the particle extraction pattern).
+  ImageType::RegionType particleRegion;
+  particleRegion.SetIndex({ { 5, 3, 4 } });
+  particleRegion.SetSize({ { 8, 8, 4 } });
+
+  auto roiReader = itk::ImageFileReader<ImageType>::New();
+  roiReader->SetFileName(fileName);
+  roiReader->UseStreamingOn();
+  auto roiFilter = itk::RegionOfInterestImageFilter<ImageType, ImageType>::New();
+  roiFilter->SetInput(roiReader->GetOutput());
+  roiFilter->SetRegionOfInterest(particleRegion);
+  ITK_TRY_EXPECT_NO_EXCEPTION(roiFilter->Update());
+  ITK_TEST_EXPECT_TRUE(roiReader->GetOutput()->GetBufferedRegion() == particleRegion);
+
+  itk::ImageRegionIteratorWithIndex<ImageType> roiIterator(roiFilter->GetOutput(),
+                                                           roiFilter->GetOutput()->GetBufferedRegion());
+  for (roiIterator.GoToBegin(); !roiIterator.IsAtEnd(); ++roiIterator)
+  {
+    ImageType::IndexType idx = roiIterator.GetIndex();
+    for (unsigned int d = 0; d < 3; ++d)
+    {
+      idx[d] += particleRegion.GetIndex(d);
+    }
+    if (roiIterator.Get() != image->GetPixel(idx))
+    {
+      std::cerr << "Extracted pixel differs at " << idx << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  std::cout << "Test passed." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -19,6 +19,7 @@
 #define itkVTKPolyDataMeshIO_h
 #include "ITKIOMeshVTKExport.h"
 
+#include "itkBulkAsciiReader.h"
 #include "itkByteSwapper.h"
 #include "itkMetaDataObject.h"
 #include "itkMeshIOBase.h"
@@ -202,10 +203,7 @@ protected:
       {
         /**  Load the point coordinates into the itk::Mesh */
         SizeValueType numberOfComponents = this->m_NumberOfPoints * this->m_PointDimension;
-        for (SizeValueType ii = 0; ii < numberOfComponents; ++ii)
-        {
-          inputFile >> buffer[ii];
-        }
+        ReadBulkAsciiValues(inputFile, buffer, numberOfComponents);
       }
     }
   }
@@ -278,10 +276,7 @@ protected:
 
         /** for VECTORS or NORMALS or TENSORS, we could read them directly */
         SizeValueType numberOfComponents = this->m_NumberOfPointPixels * this->m_NumberOfPointPixelComponents;
-        for (SizeValueType ii = 0; ii < numberOfComponents; ++ii)
-        {
-          inputFile >> buffer[ii];
-        }
+        ReadBulkAsciiValues(inputFile, buffer, numberOfComponents);
       }
     }
   }
@@ -373,10 +368,7 @@ protected:
 
         /** for VECTORS or NORMALS or TENSORS, we could read them directly */
         SizeValueType numberOfComponents = this->m_NumberOfCellPixels * this->m_NumberOfCellPixelComponents;
-        for (SizeValueType ii = 0; ii < numberOfComponents; ++ii)
-        {
-          inputFile >> buffer[ii];
-        }
+        ReadBulkAsciiValues(inputFile, buffer, numberOfComponents);
       }
     }
   }
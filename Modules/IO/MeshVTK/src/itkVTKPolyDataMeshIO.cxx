@@ -760,7 +760,9 @@ VTKPolyDataMeshIO ::ReadPoints(void * buffer)
 
   if (this->m_FileType == IOFileEnum::ASCII)
   {
-    inputFile.open(this->m_FileName.c_str(), std::ios::in);
+    // binary mode also for ASCII payloads: ReadBulkAsciiValues
+    // repositions the stream by byte offsets
+    inputFile.open(this->m_FileName.c_str(), std::ios::in | std::ios::binary);
   }
   else if (m_FileType == IOFileEnum::BINARY)
   {
@@ -814,7 +816,7 @@ VTKPolyDataMeshIO ::ReadCells(void * buffer)
 
   if (this->m_FileType == IOFileEnum::ASCII)
   {
-    inputFile.open(this->m_FileName.c_str(), std::ios::in);
+    inputFile.open(this->m_FileName.c_str(), std::ios::in | std::ios::binary);
   }
   else if (m_FileType == IOFileEnum::BINARY)
   {
@@ -850,63 +852,64 @@ VTKPolyDataMeshIO::ReadCellsBufferAsASCII(std::ifstream & inputFile, void * buff
 {
   std::string   line;
   SizeValueType index = 0;
-  unsigned int  numPoints; // number of point in each cell
 
   MetaDataDictionary & metaDic = this->GetMetaDataDictionary();
   using GeometryIntegerType = unsigned int;
   auto * data = static_cast<GeometryIntegerType *>(buffer);
 
+  // each section is parsed in one bulk pass into a flat "n id0 .. idn-1"
+  // run list and then expanded with the cell type inserted
+  std::vector<GeometryIntegerType> runs;
+  const auto                       expandRuns =
+    [&runs, &index, data](unsigned int numberOfCells, CellGeometryEnum cellType) {
+      SizeValueType runPosition = 0;
+      for (unsigned int ii = 0; ii < numberOfCells; ++ii)
+      {
+        const GeometryIntegerType numPoints = runs[runPosition++];
+        data[index++] = static_cast<GeometryIntegerType>(cellType);
+        data[index++] = numPoints;
+        for (GeometryIntegerType jj = 0; jj < numPoints; ++jj)
+        {
+          data[index++] = runs[runPosition++];
+        }
+      }
+    };
+
   while (!inputFile.eof())
   {
     std::getline(inputFile, line, '\n');
     if (line.find("VERTICES") != std::string::npos)
     {
       unsigned int numberOfVertices = 0;
+      unsigned int numberOfVertexIndices = 0;
       ExposeMetaData<unsigned int>(metaDic, "numberOfVertices", numberOfVertices);
+      ExposeMetaData<unsigned int>(metaDic, "numberOfVertexIndices", numberOfVertexIndices);
 
-      for (unsigned int ii = 0; ii < numberOfVertices; ++ii)
-      {
-        inputFile >> numPoints;
-        data[index++] = static_cast<GeometryIntegerType>(CellGeometryEnum::VERTEX_CELL);
-        data[index++] = numPoints;
-        for (unsigned int jj = 0; jj < numPoints; ++jj)
-        {
-          inputFile >> data[index++];
-        }
-      }
+      runs.resize(numberOfVertexIndices);
+      ReadBulkAsciiValues(inputFile, runs.data(), numberOfVertexIndices);
+      expandRuns(numberOfVertices, CellGeometryEnum::VERTEX_CELL);
     }
     else if (line.find("LINES") != std::string::npos)
     {
       unsigned int numberOfLines = 0;
+      unsigned int numberOfLineIndices = 0;
       ExposeMetaData<unsigned int>(metaDic, "numberOfLines", numberOfLines);
+      ExposeMetaData<unsigned int>(metaDic, "numberOfLineIndices", numberOfLineIndices);
 
-      for (unsigned int ii = 0; ii < numberOfLines; ++ii)
-      {
-        inputFile >> numPoints;
-        data[index++] = static_cast<GeometryIntegerType>(CellGeometryEnum::LINE_CELL);
-        data[index++] = numPoints;
-        for (unsigned int jj = 0; jj < numPoints; ++jj)
-        {
-          inputFile >> data[index++];
-        }
-      }
+      runs.resize(numberOfLineIndices);
+      ReadBulkAsciiValues(inputFile, runs.data(), numberOfLineIndices);
+      expandRuns(numberOfLines, CellGeometryEnum::LINE_CELL);
     }
     else if (line.find("POLYGONS") != std::string::npos)
     {
       unsigned int numberOfPolygons = 0;
+      unsigned int numberOfPolygonIndices = 0;
       ExposeMetaData<unsigned int>(metaDic, "numberOfPolygons", numberOfPolygons);
+      ExposeMetaData<unsigned int>(metaDic, "numberOfPolygonIndices", numberOfPolygonIndices);
 
-      for (unsigned int ii = 0; ii < numberOfPolygons; ++ii)
-      {
-        inputFile >> numPoints;
-
-        data[index++] = static_cast<GeometryIntegerType>(CellGeometryEnum::POLYGON_CELL);
-        data[index++] = numPoints;
-        for (unsigned int jj = 0; jj < numPoints; ++jj)
-        {
-          inputFile >> data[index++];
-        }
-      }
+      runs.resize(numberOfPolygonIndices);
+      ReadBulkAsciiValues(inputFile, runs.data(), numberOfPolygonIndices);
+      expandRuns(numberOfPolygons, CellGeometryEnum::POLYGON_CELL);
     }
   }
 }
@@ -1000,7 +1003,7 @@ VTKPolyDataMeshIO ::ReadPointData(void * buffer)
 
   if (this->m_FileType == IOFileEnum::ASCII)
   {
-    inputFile.open(this->m_FileName.c_str(), std::ios::in);
+    inputFile.open(this->m_FileName.c_str(), std::ios::in | std::ios::binary);
   }
   else if (m_FileType == IOFileEnum::BINARY)
   {
@@ -1054,7 +1057,7 @@ VTKPolyDataMeshIO ::ReadCellData(void * buffer)
 
   if (this->m_FileType == IOFileEnum::ASCII)
   {
-    inputFile.open(this->m_FileName.c_str(), std::ios::in);
+    inputFile.open(this->m_FileName.c_str(), std::ios::in | std::ios::binary);
   }
   else if (m_FileType == IOFileEnum::BINARY)
   {
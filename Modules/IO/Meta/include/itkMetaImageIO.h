@@ -146,6 +146,21 @@ public:
     return true;
   }
 
+  /** Determine if the pixel data can be memory mapped directly: binary
+   *  uncompressed data stored in a single separate data file whose byte
+   *  order matches the host. ReadImageInformation must be called prior
+   *  to this function. */
+  bool
+  CanReadMemoryMapped() override;
+
+  /** The resolved path of the separate element data file. */
+  std::string
+  GetImageDataFileName() override;
+
+  /** The byte offset of the pixel data inside the element data file. */
+  SizeValueType
+  GetImageDataByteOffset() override;
+
   /** Determine if the ImageIO can stream writing to this
    *  file. Only time cannot stream read/write is if compression is used.
    *  Assumes file passes a CanRead call and its pixels are of the same
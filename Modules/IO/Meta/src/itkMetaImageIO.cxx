@@ -499,6 +499,59 @@ MetaImageIO::GetMetaImagePointer()
   return &m_MetaImage;
 }
 
+bool
+MetaImageIO::CanReadMemoryMapped()
+{
+  if (!m_MetaImage.BinaryData() || m_MetaImage.CompressedData())
+  {
+    return false;
+  }
+
+  // only a single separate data file maps to one contiguous file
+  // region; LOCAL data follows the header and LIST/patterned names
+  // spread the volume over several files
+  const char * elementDataFileName = m_MetaImage.ElementDataFileName();
+  if (elementDataFileName == nullptr)
+  {
+    return false;
+  }
+  const std::string dataFileName = elementDataFileName;
+  if (dataFileName.empty() || dataFileName == "LOCAL" || dataFileName.find("LIST") == 0 ||
+      dataFileName.find('%') != std::string::npos)
+  {
+    return false;
+  }
+
+  if (m_MetaImage.BinaryDataByteOrderMSB() != MET_SystemByteOrderMSB())
+  {
+    return false;
+  }
+
+  return true;
+}
+
+std::string
+MetaImageIO::GetImageDataFileName()
+{
+  std::string dataFileName = m_MetaImage.ElementDataFileName();
+  if (!itksys::SystemTools::FileIsFullPath(dataFileName.c_str()))
+  {
+    const std::string headerPath = itksys::SystemTools::GetFilenamePath(m_FileName);
+    if (!headerPath.empty())
+    {
+      dataFileName = headerPath + "/" + dataFileName;
+    }
+  }
+  return dataFileName;
+}
+
+SizeValueType
+MetaImageIO::GetImageDataByteOffset()
+{
+  const int headerSize = m_MetaImage.HeaderSize();
+  return headerSize > 0 ? static_cast<SizeValueType>(headerSize) : 0;
+}
+
 bool
 MetaImageIO::CanWriteFile(const char * name)
 {
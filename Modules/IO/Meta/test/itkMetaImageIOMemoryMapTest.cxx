@@ -0,0 +1,111 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkImage.h"
+#include "itkImageFileReader.h"
+#include "itkImageFileWriter.h"
+#include "itkImageRegionIterator.h"
+#include "itkMemoryMappedPixelContainer.h"
+#include "itkMetaImageIO.h"
+#include "itkTestingMacros.h"
+
+// Write an uncompressed .mhd/.raw pair and verify that the reader can
+// attach a copy-on-write memory mapping of the .raw file as the output
+// pixel buffer, that writes to the mapped buffer never reach the file,
+// and that compressed data falls back to the normal buffered path.
+int
+itkMetaImageIOMemoryMapTest(int argc, char * argv[])
+{
+  if (argc < 2)
+  {
+    std::cerr << "Usage: " << itkNameOfTestExecutableMacro(argv) << " outputFileBase" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  using ImageType = itk::Image<unsigned short, 2>;
+  using MappedContainerType = itk::MemoryMappedPixelContainer<itk::SizeValueType, unsigned short>;
+
+  const std::string uncompressedFileName = std::string(argv[1]) + ".mhd";
+  const std::string compressedFileName = std::string(argv[1]) + "Compressed.mha";
+
+  auto                  image = ImageType::New();
+  ImageType::SizeType   size = { { 32, 24 } };
+  ImageType::RegionType region(size);
+  image->SetRegions(region);
+  image->Allocate();
+
+  itk::ImageRegionIterator<ImageType> fillIterator(image, region);
+  unsigned short                      value = 0;
+  for (; !fillIterator.IsAtEnd(); ++fillIterator, ++value)
+  {
+    fillIterator.Set(value);
+  }
+
+  auto writer = itk::ImageFileWriter<ImageType>::New();
+  writer->SetInput(image);
+  writer->SetFileName(uncompressedFileName);
+  writer->UseCompressionOff();
+  ITK_TRY_EXPECT_NO_EXCEPTION(writer->Update());
+
+  writer->SetFileName(compressedFileName);
+  writer->UseCompressionOn();
+  ITK_TRY_EXPECT_NO_EXCEPTION(writer->Update());
+
+  // The uncompressed .mhd stores its pixels in a separate .raw file and
+  // must be memory mapped.
+  auto reader = itk::ImageFileReader<ImageType>::New();
+  reader->SetFileName(uncompressedFileName);
+  reader->UseMemoryMappedReadingOn();
+  ITK_TRY_EXPECT_NO_EXCEPTION(reader->Update());
+
+  auto * mappedContainer = dynamic_cast<MappedContainerType *>(reader->GetOutput()->GetPixelContainer());
+  ITK_TEST_EXPECT_TRUE(mappedContainer != nullptr);
+
+  itk::ImageRegionIterator<ImageType> inputIterator(image, region);
+  itk::ImageRegionIterator<ImageType> outputIterator(reader->GetOutput(), region);
+  for (; !outputIterator.IsAtEnd(); ++inputIterator, ++outputIterator)
+  {
+    if (outputIterator.Get() != inputIterator.Get())
+    {
+      std::cerr << "Mapped pixel differs at " << outputIterator.GetIndex() << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // The mapping is copy-on-write: scribbling over the mapped buffer must
+  // not change what a second reader sees in the file.
+  reader->GetOutput()->FillBuffer(0);
+  auto verifyingReader = itk::ImageFileReader<ImageType>::New();
+  verifyingReader->SetFileName(uncompressedFileName);
+  ITK_TRY_EXPECT_NO_EXCEPTION(verifyingReader->Update());
+  const ImageType::IndexType probeIndex = { { 11, 7 } };
+  ITK_TEST_EXPECT_EQUAL(verifyingReader->GetOutput()->GetPixel(probeIndex), image->GetPixel(probeIndex));
+
+  // Compressed data cannot be mapped; the reader must silently fall
+  // back to a buffered read and still produce the right pixels.
+  auto compressedReader = itk::ImageFileReader<ImageType>::New();
+  compressedReader->SetFileName(compressedFileName);
+  compressedReader->UseMemoryMappedReadingOn();
+  ITK_TRY_EXPECT_NO_EXCEPTION(compressedReader->Update());
+  ITK_TEST_EXPECT_TRUE(dynamic_cast<MappedContainerType *>(compressedReader->GetOutput()->GetPixelContainer()) ==
+                       nullptr);
+  ITK_TEST_EXPECT_EQUAL(compressedReader->GetOutput()->GetPixel(probeIndex), image->GetPixel(probeIndex));
+
+  std::cout << "Test passed." << std::endl;
+  return EXIT_SUCCESS;
+}
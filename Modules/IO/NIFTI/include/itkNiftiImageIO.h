@@ -149,6 +149,13 @@ public:
   void
   Read(void * buffer) override;
 
+  /** Nifti images can be read one sub-region at a time: the scanline
+   * runs the region covers are seek+read from an uncompressed file,
+   * and decompressed incrementally for .nii.gz. ASCII-stored .nia
+   * files cannot be seeked and are excluded. */
+  bool
+  CanStreamRead() override;
+
   //-------- This part of the interfaces deals with writing data. -----
 
   /** Determine if the file can be written with this ImageIO implementation.
@@ -240,6 +247,10 @@ private:
 
   IOComponentEnum m_OnDiskComponentType{ IOComponentEnum::UNKNOWNCOMPONENTTYPE };
 
+  // the file the cached header in m_NiftiImage was parsed from, so
+  // successive streamed Read() calls do not re-open and re-parse it
+  std::string m_HeaderFileNameRead;
+
   NiftiImageIOEnums::Analyze75Flavor m_LegacyAnalyze75Mode;
 };
 
@@ -487,6 +487,14 @@ NiftiImageIO ::CanWriteFile(const char * FileNameToWrite)
   return ValidFileNameFound;
 }
 
+bool
+NiftiImageIO ::CanStreamRead()
+{
+  // ASCII-stored .nia files cannot be seeked into
+  const std::string fileName(this->GetFileName());
+  return fileName.size() < 4 || fileName.compare(fileName.size() - 4, 4, ".nia") != 0;
+}
+
 bool
 NiftiImageIO::MustRescale() const
 {
@@ -558,15 +566,20 @@ NiftiImageIO::Read(void * buffer)
     // sizes = x y z t vecsize
     _size[4] = numComponents;
   }
-  // Free memory if any was occupied already (incase of re-using the IO filter).
-  nifti_image_free(this->m_NiftiImage);
-
-  //
-  // allocate nifti image...
-  this->m_NiftiImage = nifti_image_read(this->GetFileName(), false);
-  if (this->m_NiftiImage == nullptr)
+  // Re-use the header parsed by ReadImageInformation (or a previous
+  // Read) when it belongs to the current file: streamed reads call
+  // Read() once per division and re-opening and re-parsing the header
+  // each time is wasted IO. Free and re-read otherwise (incase of
+  // re-using the IO filter).
+  if (this->m_NiftiImage == nullptr || this->m_HeaderFileNameRead != this->GetFileName())
   {
-    itkExceptionMacro(<< "nifti_image_read (just header) failed for file: " << this->GetFileName());
+    nifti_image_free(this->m_NiftiImage);
+    this->m_NiftiImage = nifti_image_read(this->GetFileName(), false);
+    if (this->m_NiftiImage == nullptr)
+    {
+      itkExceptionMacro(<< "nifti_image_read (just header) failed for file: " << this->GetFileName());
+    }
+    this->m_HeaderFileNameRead = this->GetFileName();
   }
 
   //
@@ -1016,6 +1029,7 @@ NiftiImageIO ::ReadImageInformation()
     }
   }
 
+  nifti_image_free(this->m_NiftiImage);
   this->m_NiftiImage = nifti_image_read(this->GetFileName(), false);
   static std::string prev;
   if (prev != this->GetFileName())
@@ -1029,6 +1043,7 @@ NiftiImageIO ::ReadImageInformation()
   {
     itkExceptionMacro(<< this->GetFileName() << " is not recognized as a NIFTI file");
   }
+  this->m_HeaderFileNameRead = this->GetFileName();
   // Check the intent code, it is a vector image, or matrix image, then this is
   // not true.
   //
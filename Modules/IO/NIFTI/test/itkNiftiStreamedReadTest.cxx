@@ -0,0 +1,142 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkNiftiImageIO.h"
+#include "itkImageFileReader.h"
+#include "itkImageFileWriter.h"
+#include "itkImageRegionConstIteratorWithIndex.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkPipelineMonitorImageFilter.h"
+#include "itkStreamingImageFilter.h"
+#include "itkTestingMacros.h"
+
+// Verifies that NiftiImageIO serves streamed sub-region reads: a
+// multi-division streamed read of .nii and .nii.gz volumes must issue
+// one IO read per division and reproduce the written pixels, and a
+// requested sub-volume read must buffer only that sub-volume.
+
+namespace
+{
+
+template <typename TImage>
+typename TImage::Pointer
+MakeTestVolume()
+{
+  auto image = TImage::New();
+  auto region = typename TImage::RegionType(itk::MakeSize(17, 13, 11, 7));
+  image->SetRegions(region);
+  image->Allocate();
+  itk::ImageRegionIteratorWithIndex<TImage> it(image, region);
+  for (it.GoToBegin(); !it.IsAtEnd(); ++it)
+  {
+    const typename TImage::IndexType idx = it.GetIndex();
+    it.Set(static_cast<typename TImage::PixelType>(idx[3] * 4000 + idx[2] * 300 + idx[1] * 20 + idx[0]));
+  }
+  return image;
+}
+
+template <typename TImage>
+int
+StreamedReadTest(const TImage * referenceImage, const std::string & fileName)
+{
+  constexpr unsigned int numberOfDivisions = 7;
+
+  ITK_TRY_EXPECT_NO_EXCEPTION(itk::WriteImage(referenceImage, fileName));
+
+  auto io = itk::NiftiImageIO::New();
+  io->SetFileName(fileName);
+  ITK_TEST_EXPECT_TRUE(io->CanStreamRead());
+
+  using ReaderType = itk::ImageFileReader<TImage>;
+  auto reader = ReaderType::New();
+  reader->SetFileName(fileName);
+  reader->SetUseStreaming(true);
+  using MonitorFilterType = itk::PipelineMonitorImageFilter<TImage>;
+  auto monitor = MonitorFilterType::New();
+  monitor->SetInput(reader->GetOutput());
+  using StreamingFilterType = itk::StreamingImageFilter<TImage, TImage>;
+  auto streamer = StreamingFilterType::New();
+  streamer->SetInput(monitor->GetOutput());
+  streamer->SetNumberOfStreamDivisions(numberOfDivisions);
+  ITK_TRY_EXPECT_NO_EXCEPTION(streamer->Update());
+
+  if (!monitor->VerifyInputFilterExecutedStreaming(numberOfDivisions))
+  {
+    std::cerr << "The reader did not execute in " << numberOfDivisions << " streamed divisions." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  itk::ImageRegionConstIteratorWithIndex<TImage> it(referenceImage, referenceImage->GetBufferedRegion());
+  for (it.GoToBegin(); !it.IsAtEnd(); ++it)
+  {
+    if (streamer->GetOutput()->GetPixel(it.GetIndex()) != it.Get())
+    {
+      std::cerr << "Streamed pixel mismatch at " << it.GetIndex() << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // a direct sub-volume request buffers only the requested slab
+  typename TImage::RegionType subRegion;
+  subRegion.SetIndex({ { 2, 1, 3, 2 } });
+  subRegion.SetSize({ { 9, 8, 5, 3 } });
+  auto subReader = ReaderType::New();
+  subReader->SetFileName(fileName);
+  subReader->SetUseStreaming(true);
+  subReader->GetOutput()->SetRequestedRegion(subRegion);
+  ITK_TRY_EXPECT_NO_EXCEPTION(subReader->Update());
+  ITK_TEST_EXPECT_TRUE(subReader->GetOutput()->GetBufferedRegion() == subRegion);
+  itk::ImageRegionConstIteratorWithIndex<TImage> subIt(subReader->GetOutput(), subRegion);
+  for (subIt.GoToBegin(); !subIt.IsAtEnd(); ++subIt)
+  {
+    if (referenceImage->GetPixel(subIt.GetIndex()) != subIt.Get())
+    {
+      std::cerr << "Sub-volume pixel mismatch at " << subIt.GetIndex() << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
+
+} // namespace
+
+int
+itkNiftiStreamedReadTest(int argc, char * argv[])
+{
+  if (argc < 2)
+  {
+    std::cerr << "Missing Parameters." << std::endl;
+    std::cerr << "Usage: " << itkNameOfTestExecutableMacro(argv) << " OutputDirectory" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const std::string outputDirectory = argv[1];
+
+  using ImageType = itk::Image<short, 4>;
+  ImageType::Pointer referenceImage = MakeTestVolume<ImageType>();
+
+  int result = EXIT_SUCCESS;
+  result += StreamedReadTest(referenceImage.GetPointer(), outputDirectory + "/NiftiStreamedRead.nii");
+  result += StreamedReadTest(referenceImage.GetPointer(), outputDirectory + "/NiftiStreamedRead.nii.gz");
+
+  if (result == EXIT_SUCCESS)
+  {
+    std::cout << "Test finished." << std::endl;
+  }
+  return result == EXIT_SUCCESS ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -22,11 +22,177 @@
 #include "itkMetaDataObject.h"
 #include "itkIOCommon.h"
 #include "itkFloatingPointExceptions.h"
+#include "itkGzipChunkCompressor.h"
+#include "itkMultiThreaderBase.h"
+#include "itksys/SystemTools.hxx"
+
+#include <sstream>
+#include <vector>
 
 namespace itk
 {
 #define KEY_PREFIX "NRRD_"
 
+namespace
+{
+// Key under which the writer records the layout of independently deflated
+// gzip members: "<uncompressed bytes per block> <compressed size of member
+// 0> <compressed size of member 1> ...".  Concatenated gzip members form a
+// single valid gzip stream, so readers that do not know the key simply
+// inflate the data as usual; readers that do can inflate the members
+// concurrently.
+const char * const parallelGzipLayoutKey = "ITK_gzip_member_layout";
+
+// Uncompressed bytes per gzip member.  The deflate window is only 32kB, so
+// blocks this large compress essentially as well as a single stream while
+// giving enough members to keep all threads busy.
+constexpr size_t parallelGzipBlockSize = static_cast<size_t>(1) << 20;
+
+// Below this data size the setup cost outweighs the parallel speedup.
+constexpr size_t parallelGzipMinimumBytes = static_cast<size_t>(4) << 20;
+
+// Inflate the gzip members recorded under parallelGzipLayoutKey
+// concurrently, straight into the ITK-allocated buffer.  Returns false
+// whenever the file was not written in that layout (or anything else is
+// unexpected), in which case the caller falls back to the regular
+// single-threaded nrrdLoad() path.
+bool
+TryParallelGzipRead(const char * fileName, void * buffer, size_t expectedBytes)
+{
+  Nrrd *        nrrd = nrrdNew();
+  NrrdIoState * nio = nrrdIoStateNew();
+
+  nrrdIoStateSet(nio, nrrdIoStateSkipData, 1);
+  nrrdIoStateSet(nio, nrrdIoStateKeepNrrdDataFileOpen, 1);
+
+  bool success = false;
+  if (nrrdLoad(nrrd, fileName, nio) == 0)
+  {
+    char *       layout = nrrdKeyValueGet(nrrd, parallelGzipLayoutKey);
+    unsigned int rangeAxisIdx[NRRD_DIM_MAX];
+    unsigned int rangeAxisNum = nrrdRangeAxesGet(nrrd, rangeAxisIdx);
+    // the non-scalar axis (if any) has to already be the fastest one,
+    // because the bytes go into the buffer without any permutation
+    if (layout != nullptr && nio->dataFile != nullptr && nio->encoding == nrrdEncodingGzip && 0 == nio->byteSkip &&
+        0 == nio->lineSkip && (0 == rangeAxisNum || (1 == rangeAxisNum && 0 == rangeAxisIdx[0])) &&
+        (nio->endian == airMyEndian() || 1 == nrrdElementSize(nrrd)) &&
+        nrrdElementSize(nrrd) * nrrdElementNumber(nrrd) == expectedBytes)
+    {
+      size_t                                   blockSize = 0;
+      SizeValueType                            memberSize = 0;
+      GzipChunkCompressor::ChunkSizesType      memberSizes;
+      std::istringstream                       layoutStream(layout);
+      layoutStream >> blockSize;
+      while (layoutStream >> memberSize)
+      {
+        memberSizes.push_back(memberSize);
+      }
+      const size_t expectedMembers = (blockSize > 0) ? (expectedBytes + blockSize - 1) / blockSize : 0;
+      if (blockSize > 0 && !memberSizes.empty() && memberSizes.size() == expectedMembers)
+      {
+        size_t compressedBytes = 0;
+        for (const auto size : memberSizes)
+        {
+          compressedBytes += size;
+        }
+        std::vector<char> compressed(compressedBytes);
+        if (fread(compressed.data(), 1, compressedBytes, nio->dataFile) == compressedBytes)
+        {
+          auto compressor = GzipChunkCompressor::New();
+          compressor->SetChunkSize(static_cast<SizeValueType>(blockSize));
+          try
+          {
+            compressor->Decompress(compressed.data(), memberSizes, buffer, static_cast<SizeValueType>(expectedBytes));
+            success = true;
+          }
+          catch (const ExceptionObject &)
+          {
+            // fall back to the regular nrrdLoad() path
+            success = false;
+          }
+        }
+      }
+    }
+    free(layout);
+  }
+  else
+  {
+    char * err = biffGetDone(NRRD);
+    free(err);
+  }
+
+  if (nio->dataFile != nullptr)
+  {
+    airFclose(nio->dataFile);
+    nio->dataFile = nullptr;
+  }
+  nrrdNix(nrrd);
+  nrrdIoStateNix(nio);
+  return success;
+}
+
+// Deflate the buffer wrapped by the given nrrd as concatenated gzip
+// members, write the header through nrrdSave() with the data skipped, and
+// append the members afterwards.  A key/value pair records the member
+// layout for TryParallelGzipRead() above.  Returns false, leaving the nrrd
+// and the io state usable for a regular nrrdSave(), when the data is too
+// small (or the deflate fails) and chunking is not worthwhile.
+bool
+TryParallelGzipWrite(const char * fileName, Nrrd * nrrd, NrrdIoState * nio, int compressionLevel)
+{
+  const size_t totalBytes = nrrdElementSize(nrrd) * nrrdElementNumber(nrrd);
+  if (totalBytes < parallelGzipMinimumBytes || MultiThreaderBase::GetGlobalDefaultNumberOfThreads() < 2)
+  {
+    return false;
+  }
+
+  auto compressor = GzipChunkCompressor::New();
+  compressor->SetChunkSize(static_cast<SizeValueType>(parallelGzipBlockSize));
+  compressor->SetCompressionLevel(compressionLevel);
+
+  std::vector<char>                   compressed;
+  GzipChunkCompressor::ChunkSizesType memberSizes;
+  try
+  {
+    compressor->Compress(nrrd->data, static_cast<SizeValueType>(totalBytes), compressed, memberSizes);
+  }
+  catch (const ExceptionObject &)
+  {
+    return false;
+  }
+
+  std::ostringstream layout;
+  layout << parallelGzipBlockSize;
+  for (const auto size : memberSizes)
+  {
+    layout << ' ' << size;
+  }
+  if (nrrdKeyValueAdd(nrrd, parallelGzipLayoutKey, layout.str().c_str()))
+  {
+    return false;
+  }
+
+  // the members hold the buffer's bytes as they are in memory, so the
+  // header has to record the native byte order
+  nio->endian = airMyEndian();
+  nrrdIoStateSet(nio, nrrdIoStateSkipData, 1);
+  if (nrrdSave(fileName, nrrd, nio))
+  {
+    char * err = biffGetDone(NRRD); // would be nice to free(err)
+    itkGenericExceptionMacro("Write: Error writing " << fileName << ":\n" << err);
+  }
+
+  std::ofstream dataStream(fileName, std::ios::binary | std::ios::app);
+  dataStream.write(compressed.data(), static_cast<std::streamsize>(compressed.size()));
+  if (!dataStream)
+  {
+    itkGenericExceptionMacro("Write: Error appending compressed data to " << fileName);
+  }
+  return true;
+}
+
+} // namespace
+
 NrrdImageIO::NrrdImageIO()
 {
   this->SetNumberOfDimensions(3);
@@ -589,7 +755,11 @@ NrrdImageIO::ReadImageInformation()
     for (unsigned int kvpi = 0; kvpi < nrrdKeyValueSize(nrrd); ++kvpi)
     {
       nrrdKeyValueIndex(nrrd, &keyPtr, &valPtr, kvpi);
-      EncapsulateMetaData<std::string>(thisDic, std::string(keyPtr), std::string(valPtr));
+      // the gzip member layout is bookkeeping for Read() below, not metadata
+      if (strcmp(keyPtr, parallelGzipLayoutKey) != 0)
+      {
+        EncapsulateMetaData<std::string>(thisDic, std::string(keyPtr), std::string(valPtr));
+      }
       keyPtr = (char *)airFree(keyPtr);
       valPtr = (char *)airFree(valPtr);
     }
@@ -761,6 +931,20 @@ NrrdImageIO::Read(void * buffer)
   FloatingPointExceptions::Disable();
 #endif
 
+  // Fast path: files written by this class record the layout of their
+  // independently deflated gzip members, which can be inflated
+  // concurrently straight into the ITK-allocated buffer.  Anything
+  // unexpected falls back to the regular nrrdLoad() below.
+  if (!nrrdAllocated && TryParallelGzipRead(this->GetFileName(), buffer, this->GetImageSizeInBytes()))
+  {
+#if !defined(__MINGW32__) && (defined(ITK_HAS_FEENABLEEXCEPT) || defined(_MSC_VER))
+    FloatingPointExceptions::SetEnabled(saveFPEState);
+#endif
+    // "buffer" == nrrd->data was ITK-allocated; lose the nrrd struct
+    nrrdNix(nrrd);
+    return;
+  }
+
   // Read in the nrrd.  Yes, this means that the header is being read
   // twice: once by NrrdImageIO::ReadImageInformation, and once here
   if (nrrdLoad(nrrd, this->GetFileName(), nullptr) != 0)
@@ -1062,9 +1246,11 @@ NrrdImageIO::Write(const void * buffer)
         }
       }
     }
-    else
+    else if (*keyIt != parallelGzipLayoutKey)
     {
       // not a NRRD field packed into meta data; just a regular key/value
+      // (a stale gzip member layout is never passed through; the writer
+      // below records its own when it applies)
       std::string value;
       ExposeMetaData<std::string>(thisDic, *keyIt, value);
       nrrdKeyValueAdd(nrrd, (*keyIt).c_str(), value.c_str());
@@ -1111,6 +1297,21 @@ NrrdImageIO::Write(const void * buffer)
       break;
   }
 
+  // For gzip-compressed files with attached data, deflate blocks of the
+  // buffer concurrently and store them as concatenated gzip members: any
+  // NRRD reader inflates those as a single stream, while Read() above can
+  // inflate the members in parallel.  Detached headers (.nhdr) keep the
+  // regular path, since nrrdSave() manages the separate data file itself.
+  if (nio->encoding == nrrdEncodingGzip &&
+      itksys::SystemTools::LowerCase(itksys::SystemTools::GetFilenameLastExtension(this->GetFileName())) == ".nrrd" &&
+      TryParallelGzipWrite(this->GetFileName(), nrrd, nio, this->GetCompressionLevel()))
+  {
+    // Free the nrrd struct but don't touch nrrd->data
+    nrrdNix(nrrd);
+    nrrdIoStateNix(nio);
+    return;
+  }
+
   // Write the nrrd to file.
   if (nrrdSave(this->GetFileName(), nrrd, nio))
   {
@@ -0,0 +1,123 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include <fstream>
+#include "itkImageFileReader.h"
+#include "itkImageFileWriter.h"
+#include "itkImageRegionIterator.h"
+#include "itkMultiThreaderBase.h"
+#include "itkNrrdImageIO.h"
+#include "itkTestingMacros.h"
+
+// The writer stores gzip-compressed data large enough to chunk as
+// concatenated gzip members and records their layout in a key/value
+// pair, so that the reader can inflate the members concurrently.  This
+// test round-trips such a file and checks the layout key is present in
+// the header but kept out of the metadata dictionary.
+
+namespace
+{
+
+bool
+HeaderContainsLayoutKey(const char * fileName)
+{
+  std::ifstream header(fileName);
+  std::string   line;
+  while (std::getline(header, line) && !line.empty())
+  {
+    if (line.find("ITK_gzip_member_layout") != std::string::npos)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+} // namespace
+
+int
+itkNrrdParallelGzipReadWriteTest(int ac, char * av[])
+{
+  if (ac < 2)
+  {
+    std::cerr << "Missing Parameters." << std::endl;
+    std::cerr << "Usage: " << itkNameOfTestExecutableMacro(av) << " Output" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  constexpr unsigned int Dimension = 3;
+
+  using PixelType = unsigned short;
+  using myImage = itk::Image<PixelType, Dimension>;
+
+  // ~8 MB of pixels, above the writer's chunking threshold
+  auto              image = myImage::New();
+  myImage::SizeType size = { { 256, 256, 64 } };
+  image->SetRegions(myImage::RegionType(size));
+  image->Allocate();
+
+  itk::ImageRegionIterator<myImage> it(image, image->GetLargestPossibleRegion());
+  unsigned short                    value = 0;
+  for (; !it.IsAtEnd(); ++it)
+  {
+    it.Set(value);
+    value = static_cast<unsigned short>(value * 31 + 7);
+  }
+
+  itk::ImageFileWriter<myImage>::Pointer writer = itk::ImageFileWriter<myImage>::New();
+  writer->SetImageIO(itk::NrrdImageIO::New());
+  writer->SetInput(image);
+  writer->SetFileName(av[1]);
+  writer->UseCompressionOn();
+
+  ITK_TRY_EXPECT_NO_EXCEPTION(writer->Update());
+
+  if (itk::MultiThreaderBase::GetGlobalDefaultNumberOfThreads() > 1 && !HeaderContainsLayoutKey(av[1]))
+  {
+    std::cerr << "Written header lacks the gzip member layout key." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  using ReaderType = itk::ImageFileReader<myImage>;
+  auto reader = ReaderType::New();
+  reader->SetImageIO(itk::NrrdImageIO::New());
+  reader->SetFileName(av[1]);
+
+  ITK_TRY_EXPECT_NO_EXCEPTION(reader->Update());
+
+  itk::ImageRegionIterator<myImage> expected(image, image->GetLargestPossibleRegion());
+  itk::ImageRegionIterator<myImage> actual(reader->GetOutput(), image->GetLargestPossibleRegion());
+  for (; !actual.IsAtEnd(); ++expected, ++actual)
+  {
+    if (actual.Get() != expected.Get())
+    {
+      std::cerr << "Pixel mismatch at " << actual.GetIndex() << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // the layout key is internal bookkeeping, not image metadata
+  if (reader->GetOutput()->GetMetaDataDictionary().HasKey("ITK_gzip_member_layout"))
+  {
+    std::cerr << "Gzip member layout key leaked into the metadata dictionary." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
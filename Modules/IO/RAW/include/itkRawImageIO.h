@@ -141,6 +141,24 @@ public:
   ReadHeader(const std::string = std::string())
   {}
 
+  /** Raw binary data can be memory mapped directly when no mask is
+   * applied and the file byte order matches the host. */
+  bool
+  CanReadMemoryMapped() override
+  {
+    return this->GetFileType() == IOFileEnum::Binary && m_ImageMask == 0 &&
+           (sizeof(ComponentType) == 1 ||
+            (ByteSwapperType::SystemIsBigEndian() && this->GetByteOrder() == IOByteOrderEnum::BigEndian) ||
+            (ByteSwapperType::SystemIsLittleEndian() && this->GetByteOrder() == IOByteOrderEnum::LittleEndian));
+  }
+
+  /** The pixel data starts right after the header. */
+  SizeValueType
+  GetImageDataByteOffset() override
+  {
+    return this->GetHeaderSize();
+  }
+
   /*-------- This part of the interfaces deals with writing data. ----- */
 
   /** Returns true if this ImageIO can write the specified file.
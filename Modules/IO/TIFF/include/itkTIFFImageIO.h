@@ -75,6 +75,18 @@ public:
   void
   ReadImageInformation() override;
 
+  /** Returns true when the file is a single-page tiled TIFF read through
+   * the RGBA interface, in which case a sub-region can be produced by
+   * decoding only the tiles it touches. */
+  bool
+  CanStreamRead() override;
+
+  /** Returns the requested region when the tiled read path of Read() can
+   * service it and streamed reading is enabled, the whole image
+   * otherwise. */
+  ImageIORegion
+  GenerateStreamableReadRegionFromRequestedRegion(const ImageIORegion & requestedRegion) const override;
+
   /** Reads the data from disk into the memory buffer provided. */
   void
   Read(void * buffer) override;
@@ -255,6 +267,11 @@ private:
   void
   ReadCurrentPage(void * buffer, size_t pixelOffset);
 
+  // Decode the tiles touched by the given region concurrently through the
+  // RGBA interface, each worker using its own TIFF handle.
+  void
+  ReadTiles(void * buffer, const ImageIORegion & region);
+
   template <typename TComponent>
   void
   ReadGenericImage(void * _out, unsigned int width, unsigned int height);
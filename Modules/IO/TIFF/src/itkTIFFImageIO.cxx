@@ -20,9 +20,13 @@
 #include "itkTIFFReaderInternal.h"
 #include "itksys/SystemTools.hxx"
 #include "itkMetaDataObject.h"
+#include "itkMultiThreaderBase.h"
 
 #include "itk_tiff.h"
 
+#include <atomic>
+#include <vector>
+
 namespace itk
 {
 
@@ -176,6 +180,31 @@ TIFFImageIO::ReadVolume(void * buffer)
   }
 }
 
+bool
+TIFFImageIO::CanStreamRead()
+{
+  // Only the single-page tiled RGBA read path can service sub-regions:
+  // tiles are compressed independently, so a region can be produced by
+  // decoding just the tiles it touches.  The pixel type checks make sure
+  // ReadImageInformation() selected the RGBA interface for this file.
+  return m_InternalImage->m_IsOpen && m_InternalImage->m_NumberOfTiles > 0 &&
+         m_InternalImage->m_NumberOfPages - m_InternalImage->m_IgnoredSubFiles <= 1 &&
+         this->GetPixelType() == IOPixelEnum::RGBA && this->GetComponentType() == IOComponentEnum::UCHAR &&
+         TIFFIsCODECConfigured(m_InternalImage->m_Compression) == 1;
+}
+
+ImageIORegion
+TIFFImageIO::GenerateStreamableReadRegionFromRequestedRegion(const ImageIORegion & requestedRegion) const
+{
+  // This implementation returns the requestedRegion if
+  // streaming is enabled and we are capable
+  if (!m_UseStreamedReading || !const_cast<TIFFImageIO *>(this)->CanStreamRead())
+  {
+    return Superclass::GenerateStreamableReadRegionFromRequestedRegion(requestedRegion);
+  }
+  return requestedRegion;
+}
+
 void
 TIFFImageIO::Read(void * buffer)
 {
@@ -189,6 +218,21 @@ TIFFImageIO::Read(void * buffer)
     }
   }
 
+  // Tiled files go through the parallel tile decoder, which also services
+  // sub-region requests by touching only the tiles the region overlaps
+  const ImageIORegion & ioRegion = this->GetIORegion();
+  bool                  flatRegion = ioRegion.GetNumberOfPixels() > 0;
+  for (unsigned int dim = 2; dim < ioRegion.GetImageDimension(); ++dim)
+  {
+    flatRegion &= ioRegion.GetSize(dim) <= 1;
+  }
+  if (flatRegion && this->CanStreamRead() && ioRegion.GetImageDimension() >= 2)
+  {
+    this->ReadTiles(buffer, ioRegion);
+    m_InternalImage->Clean();
+    return;
+  }
+
   // The IO region should be of dimensions 3 otherwise we read only the first
   // page
   if (m_InternalImage->m_NumberOfPages > 0 && this->GetIORegion().GetImageDimension() > 2)
@@ -203,6 +247,90 @@ TIFFImageIO::Read(void * buffer)
   m_InternalImage->Clean();
 }
 
+void
+TIFFImageIO::ReadTiles(void * buffer, const ImageIORegion & region)
+{
+  const uint32_t tileWidth = m_InternalImage->m_TileWidth;
+  const uint32_t tileHeight = m_InternalImage->m_TileHeight;
+
+  const auto regionX = static_cast<uint32_t>(region.GetIndex(0));
+  const auto regionY = static_cast<uint32_t>(region.GetIndex(1));
+  const auto regionWidth = static_cast<uint32_t>(region.GetSize(0));
+  const auto regionHeight = static_cast<uint32_t>(region.GetSize(1));
+
+  if (regionX + regionWidth > m_InternalImage->m_Width || regionY + regionHeight > m_InternalImage->m_Height)
+  {
+    itkExceptionMacro("ReadTiles: requested region is outside the image on disk");
+  }
+
+  const uint32_t firstTileColumn = regionX / tileWidth;
+  const uint32_t lastTileColumn = (regionX + regionWidth - 1) / tileWidth;
+  const uint32_t firstTileRow = regionY / tileHeight;
+  const uint32_t lastTileRow = (regionY + regionHeight - 1) / tileHeight;
+
+  const std::string fileName = m_FileName;
+  const auto        directory = TIFFCurrentDirectory(m_InternalImage->m_Image);
+  std::atomic<bool> failed(false);
+
+  // Each worker decodes one row of tiles through its own TIFF handle; a
+  // single handle cannot be shared across threads.
+  MultiThreaderBase::Pointer threader = MultiThreaderBase::New();
+  threader->ParallelizeArray(
+    firstTileRow,
+    lastTileRow + 1,
+    [&](SizeValueType tileRow) {
+      TIFF * tiff = TIFFOpen(fileName.c_str(), "r");
+      if (tiff == nullptr || !TIFFSetDirectory(tiff, directory))
+      {
+        failed = true;
+        if (tiff != nullptr)
+        {
+          TIFFClose(tiff);
+        }
+        return;
+      }
+      std::vector<uint32_t> tile(static_cast<size_t>(tileWidth) * tileHeight);
+      const auto            tileY = static_cast<uint32_t>(tileRow) * tileHeight;
+      for (uint32_t tileX = firstTileColumn * tileWidth; tileX <= lastTileColumn * tileWidth && !failed;
+           tileX += tileWidth)
+      {
+        if (!TIFFReadRGBATile(tiff, tileX, tileY, tile.data()))
+        {
+          failed = true;
+          break;
+        }
+        // window of this tile inside the requested region
+        const uint32_t startX = std::max(regionX, tileX);
+        const uint32_t endX = std::min(regionX + regionWidth, tileX + tileWidth);
+        const uint32_t startY = std::max(regionY, tileY);
+        const uint32_t endY = std::min(regionY + regionHeight, tileY + tileHeight);
+        for (uint32_t y = startY; y < endY; ++y)
+        {
+          // the RGBA tile raster is organized bottom-up
+          const uint32_t * rasterRow = tile.data() + static_cast<size_t>(tileHeight - 1 - (y - tileY)) * tileWidth;
+          auto *           out = static_cast<unsigned char *>(buffer) +
+                       (static_cast<size_t>(y - regionY) * regionWidth + (startX - regionX)) * 4;
+          for (uint32_t x = startX; x < endX; ++x)
+          {
+            const uint32_t rgba = rasterRow[x - tileX];
+            out[0] = static_cast<unsigned char>(TIFFGetR(rgba));
+            out[1] = static_cast<unsigned char>(TIFFGetG(rgba));
+            out[2] = static_cast<unsigned char>(TIFFGetB(rgba));
+            out[3] = static_cast<unsigned char>(TIFFGetA(rgba));
+            out += 4;
+          }
+        }
+      }
+      TIFFClose(tiff);
+    },
+    nullptr);
+
+  if (failed)
+  {
+    itkExceptionMacro("ReadTiles: error decoding tiles of " << fileName);
+  }
+}
+
 TIFFImageIO::TIFFImageIO()
   : m_ColorPalette(0)
 
@@ -0,0 +1,147 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkImageFileReader.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkRGBAPixel.h"
+#include "itkTestingMacros.h"
+
+#include "itk_tiff.h"
+
+// ITK's TIFF writer emits strips, so the tiled file that exercises the
+// streamed tile decoder is generated here through libtiff directly.
+
+namespace
+{
+
+constexpr uint32_t imageSize = 256;
+constexpr uint32_t tileSize = 64;
+
+bool
+WriteTiledTIFF(const char * fileName)
+{
+  TIFF * tiff = TIFFOpen(fileName, "w");
+  if (tiff == nullptr)
+  {
+    return false;
+  }
+  TIFFSetField(tiff, TIFFTAG_IMAGEWIDTH, imageSize);
+  TIFFSetField(tiff, TIFFTAG_IMAGELENGTH, imageSize);
+  TIFFSetField(tiff, TIFFTAG_SAMPLESPERPIXEL, 3);
+  TIFFSetField(tiff, TIFFTAG_BITSPERSAMPLE, 8);
+  TIFFSetField(tiff, TIFFTAG_PHOTOMETRIC, PHOTOMETRIC_RGB);
+  TIFFSetField(tiff, TIFFTAG_PLANARCONFIG, PLANARCONFIG_CONTIG);
+  TIFFSetField(tiff, TIFFTAG_ORIENTATION, ORIENTATION_TOPLEFT);
+  TIFFSetField(tiff, TIFFTAG_COMPRESSION, COMPRESSION_ADOBE_DEFLATE);
+  TIFFSetField(tiff, TIFFTAG_TILEWIDTH, tileSize);
+  TIFFSetField(tiff, TIFFTAG_TILELENGTH, tileSize);
+
+  unsigned char tile[tileSize * tileSize * 3];
+  for (uint32_t tileY = 0; tileY < imageSize; tileY += tileSize)
+  {
+    for (uint32_t tileX = 0; tileX < imageSize; tileX += tileSize)
+    {
+      unsigned char * pixel = tile;
+      for (uint32_t y = tileY; y < tileY + tileSize; ++y)
+      {
+        for (uint32_t x = tileX; x < tileX + tileSize; ++x)
+        {
+          pixel[0] = static_cast<unsigned char>(x);
+          pixel[1] = static_cast<unsigned char>(y);
+          pixel[2] = static_cast<unsigned char>(x + y);
+          pixel += 3;
+        }
+      }
+      if (TIFFWriteTile(tiff, tile, tileX, tileY, 0, 0) < 0)
+      {
+        TIFFClose(tiff);
+        return false;
+      }
+    }
+  }
+  TIFFClose(tiff);
+  return true;
+}
+
+} // namespace
+
+int
+itkTIFFImageIOTiledStreamedReadTest(int argc, char * argv[])
+{
+  if (argc < 2)
+  {
+    std::cerr << "Missing Parameters." << std::endl;
+    std::cerr << "Usage: " << itkNameOfTestExecutableMacro(argv) << " Output" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if (!WriteTiledTIFF(argv[1]))
+  {
+    std::cerr << "Could not write the tiled input file." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // tiled files are read through the RGBA interface
+  using ImageType = itk::Image<itk::RGBAPixel<unsigned char>, 2>;
+  using ReaderType = itk::ImageFileReader<ImageType>;
+
+  auto reader = ReaderType::New();
+  reader->SetFileName(argv[1]);
+  reader->UseStreamingOn();
+
+  ImageType::RegionType requestedRegion;
+  requestedRegion.SetIndex({ { 70, 50 } });
+  requestedRegion.SetSize({ { 100, 90 } });
+  reader->GetOutput()->SetRequestedRegion(requestedRegion);
+
+  ITK_TRY_EXPECT_NO_EXCEPTION(reader->Update());
+
+  // only the requested tiles may have been read and buffered
+  if (reader->GetOutput()->GetBufferedRegion() != requestedRegion)
+  {
+    std::cerr << "Expected the buffered region to match the requested region, got "
+              << reader->GetOutput()->GetBufferedRegion() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  itk::ImageRegionConstIteratorWithIndex<ImageType> it(reader->GetOutput(), requestedRegion);
+  for (; !it.IsAtEnd(); ++it)
+  {
+    const auto index = it.GetIndex();
+    const auto pixel = it.Get();
+    if (pixel.GetRed() != static_cast<unsigned char>(index[0]) ||
+        pixel.GetGreen() != static_cast<unsigned char>(index[1]) ||
+        pixel.GetBlue() != static_cast<unsigned char>(index[0] + index[1]) || pixel.GetAlpha() != 255)
+    {
+      std::cerr << "Unexpected pixel value at " << index << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // a full, non-streamed read goes through the same parallel tile decoder
+  auto fullReader = ReaderType::New();
+  fullReader->SetFileName(argv[1]);
+  ITK_TRY_EXPECT_NO_EXCEPTION(fullReader->Update());
+
+  const ImageType::IndexType probeIndex = { { 200, 17 } };
+  ITK_TEST_EXPECT_EQUAL(fullReader->GetOutput()->GetPixel(probeIndex).GetRed(), 200);
+  ITK_TEST_EXPECT_EQUAL(fullReader->GetOutput()->GetPixel(probeIndex).GetGreen(), 17);
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
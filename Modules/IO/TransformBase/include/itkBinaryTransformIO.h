@@ -0,0 +1,139 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkBinaryTransformIO_h
+#define itkBinaryTransformIO_h
+
+#include "ITKIOTransformBaseExport.h"
+
+#include "itkTransformIOBase.h"
+
+namespace itk
+{
+/** \class BinaryTransformIOTemplate
+ * \brief Read and write transforms in a compact binary format (".tfb").
+ *
+ * The format stores each transform as its type string followed by the
+ * fixed and variable parameter blocks as raw, 8-byte aligned arrays in
+ * the byte order of the writing machine, with an endianness marker in
+ * the file header. Reading a large parameter block is one bulk
+ * transfer — a memory mapping of the file when the byte order and
+ * scalar type match the host, a single read with an in-place range
+ * swap otherwise — instead of the per-value text parsing of the
+ * ".tfm" format. On the mapped path the parameter array handed to
+ * the transform references the mapping directly, so the only copy
+ * made is the one SetParameters itself performs.
+ *
+ * \ingroup ITKIOTransformBase
+ */
+template <typename TParametersValueType>
+class ITK_TEMPLATE_EXPORT BinaryTransformIOTemplate : public TransformIOBaseTemplate<TParametersValueType>
+{
+public:
+  using Self = BinaryTransformIOTemplate;
+  using Superclass = TransformIOBaseTemplate<TParametersValueType>;
+  using Pointer = SmartPointer<Self>;
+  using typename Superclass::TransformType;
+  using typename Superclass::TransformPointer;
+  using typename Superclass::TransformListType;
+  using ConstTransformListType = typename TransformIOBaseTemplate<TParametersValueType>::ConstTransformListType;
+
+  using ParametersType = typename TransformType::ParametersType;
+  using ParametersValueType = typename TransformType::ParametersValueType;
+  using FixedParametersType = typename TransformType::FixedParametersType;
+  using FixedParametersValueType = typename TransformType::FixedParametersValueType;
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(BinaryTransformIOTemplate, Superclass);
+  itkNewMacro(Self);
+
+  /** Determine the file type. Returns true if this TransformIO can read the
+   * file specified. */
+  bool
+  CanReadFile(const char *) override;
+
+  /** Determine the file type. Returns true if this TransformIO can write the
+   * file specified. */
+  bool
+  CanWriteFile(const char *) override;
+
+  /** Reads the transform list from disk. */
+  void
+  Read() override;
+
+  /** Writes the transform list to disk. */
+  void
+  Write() override;
+
+protected:
+  BinaryTransformIOTemplate();
+  ~BinaryTransformIOTemplate() override;
+
+private:
+  /** Parse the records following the file header from a memory mapping
+   * of the whole file; only used when byte order and scalar size match
+   * the host. */
+  void
+  ReadMapped(const char * data, SizeValueType length, uint32_t numberOfTransforms);
+
+  /** Parse the records following the file header from the stream,
+   * swapping each block in place when the file byte order differs from
+   * the host and converting when the stored scalar type differs. */
+  void
+  ReadBuffered(std::istream & in, bool fileIsBigEndian, uint32_t scalarSize, uint32_t numberOfTransforms);
+};
+
+/** This helps to meet backward compatibility */
+using BinaryTransformIO = BinaryTransformIOTemplate<double>;
+
+} // namespace itk
+
+// Note: Explicit instantiation is done in itkBinaryTransformIO.cxx
+
+#endif // itkBinaryTransformIO_h
+
+/** Explicit instantiations */
+#ifndef ITK_TEMPLATE_EXPLICIT_BinaryTransformIO
+// Explicit instantiation is required to ensure correct dynamic_cast
+// behavior across shared libraries.
+//
+// IMPORTANT: Since within the same compilation unit,
+//            ITK_TEMPLATE_EXPLICIT_<classname> defined and undefined states
+//            need to be considered. This code *MUST* be *OUTSIDE* the header
+//            guards.
+//
+#if defined(ITKIOTransformBase_EXPORTS)
+//   We are building this library
+#  define ITKIOTransformBase_EXPORT_EXPLICIT ITK_FORWARD_EXPORT
+#else
+//   We are using this library
+#  define ITKIOTransformBase_EXPORT_EXPLICIT ITKIOTransformBase_EXPORT
+#endif
+namespace itk
+{
+
+ITK_GCC_PRAGMA_DIAG_PUSH()
+ITK_GCC_PRAGMA_DIAG(ignored "-Wattributes")
+
+extern template class ITKIOTransformBase_EXPORT_EXPLICIT BinaryTransformIOTemplate<double>;
+extern template class ITKIOTransformBase_EXPORT_EXPLICIT BinaryTransformIOTemplate<float>;
+
+ITK_GCC_PRAGMA_DIAG_POP()
+
+} // end namespace itk
+#undef ITKIOTransformBase_EXPORT_EXPLICIT
+#endif
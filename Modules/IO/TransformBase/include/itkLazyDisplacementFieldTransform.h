@@ -0,0 +1,174 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkLazyDisplacementFieldTransform_h
+#define itkLazyDisplacementFieldTransform_h
+
+#include "itkDisplacementFieldTransform.h"
+#include "itkLexicographicCompare.h"
+#include "itkVectorLinearInterpolateImageFunction.h"
+
+#include <list>
+#include <map>
+#include <mutex>
+
+namespace itk
+{
+
+/** \class LazyDisplacementFieldTransform
+ * \brief Displacement field transform whose field is loaded on demand
+ * in tiles from a file.
+ *
+ * The regular DisplacementFieldTransform holds the whole vector field in
+ * memory, which makes composing several large fields (e.g. a 4D
+ * registration chain) impractical. This transform is instead given the
+ * file name of the field with SetFieldFileName(); only the image
+ * information is read up front. During TransformPoint the tile of the
+ * field containing the queried point is streamed from the file through
+ * an ImageFileReader — one voxel of overlap is added so linear
+ * interpolation never crosses a tile boundary — and kept in a
+ * least-recently-used cache of at most GetMaximumNumberOfTiles() tiles,
+ * bounding the memory footprint regardless of the field size. The file
+ * format must support streamed region reads (e.g. MetaImage, HDF5,
+ * NIFTI, MRC); formats that cannot stream still work but each tile load
+ * reads the full file.
+ *
+ * Only the point, vector and covariant vector transform methods are
+ * lazily backed. The parameter interface (GetParameters,
+ * UpdateTransformParameters) and the Jacobian computations require the
+ * dense field and must not be used while the transform operates in lazy
+ * mode; calling SetDisplacementField() with an in-memory field reverts
+ * to the eager behavior of the superclass.
+ *
+ * Tile loads are serialized with a mutex, so concurrent TransformPoint
+ * callers only contend on cache misses.
+ *
+ * \ingroup ITKIOTransformBase
+ */
+template <typename TParametersValueType, unsigned int NDimensions>
+class ITK_TEMPLATE_EXPORT LazyDisplacementFieldTransform
+  : public DisplacementFieldTransform<TParametersValueType, NDimensions>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(LazyDisplacementFieldTransform);
+
+  /** Standard class type aliases. */
+  using Self = LazyDisplacementFieldTransform;
+  using Superclass = DisplacementFieldTransform<TParametersValueType, NDimensions>;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(LazyDisplacementFieldTransform, DisplacementFieldTransform);
+
+  /** New macro for creation of through a Smart Pointer */
+  itkNewMacro(Self);
+
+  using typename Superclass::ScalarType;
+  using typename Superclass::InputPointType;
+  using typename Superclass::OutputPointType;
+
+  using typename Superclass::DisplacementFieldType;
+  using DisplacementFieldPointer = typename DisplacementFieldType::Pointer;
+  using typename Superclass::IndexType;
+  using typename Superclass::RegionType;
+  using typename Superclass::SizeType;
+
+  /** Set the file holding the displacement field. Reads the image
+   * information immediately and drops any cached tiles; the voxel data
+   * is read tile by tile during TransformPoint. */
+  void
+  SetFieldFileName(const std::string & fileName);
+
+  itkGetConstReferenceMacro(FieldFileName, std::string);
+
+  /** Set the edge length, in voxels, of the cubic tiles streamed from
+   * the field file. Changing the size drops the cache. Default is 32. */
+  void
+  SetTileSize(SizeValueType tileSize);
+
+  itkGetConstMacro(TileSize, SizeValueType);
+
+  /** Set the capacity of the least-recently-used tile cache. The cache
+   * holds at most this many tiles of
+   * (TileSize + 1)^Dimension * sizeof(vector pixel) bytes each.
+   * Default is 16. */
+  void
+  SetMaximumNumberOfTiles(SizeValueType maximumNumberOfTiles);
+
+  itkGetConstMacro(MaximumNumberOfTiles, SizeValueType);
+
+  /** Number of tiles currently resident, for monitoring and testing. */
+  SizeValueType
+  GetNumberOfCachedTiles() const;
+
+  /** Transform the point, streaming the containing field tile from the
+   * file if it is not cached. Points outside the field domain map to
+   * themselves, as in the superclass. */
+  OutputPointType
+  TransformPoint(const InputPointType & inputPoint) const override;
+
+protected:
+  LazyDisplacementFieldTransform();
+  ~LazyDisplacementFieldTransform() override = default;
+
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  using TileInterpolatorType = VectorLinearInterpolateImageFunction<DisplacementFieldType, ScalarType>;
+
+  struct CacheEntry
+  {
+    IndexType TileIndex;
+    DisplacementFieldPointer Tile;
+    typename TileInterpolatorType::Pointer Interpolator;
+  };
+
+  using CacheListType = std::list<CacheEntry>;
+  using CacheMapType = std::map<IndexType, typename CacheListType::iterator, Functor::LexicographicCompare>;
+
+  /** Return the interpolator of the tile containing the continuous
+   * index, loading the tile if needed. Called with the cache mutex
+   * held. */
+  typename TileInterpolatorType::Pointer
+  GetTileInterpolator(const ContinuousIndex<ScalarType, NDimensions> & cindex) const;
+
+  /** Stream the requested tile from the field file. */
+  DisplacementFieldPointer
+  LoadTile(const RegionType & tileRegion) const;
+
+  std::string m_FieldFileName;
+  SizeValueType m_TileSize{ 32 };
+  SizeValueType m_MaximumNumberOfTiles{ 16 };
+
+  /** Field geometry read from the file header; the pixel buffer is
+   * never allocated. */
+  DisplacementFieldPointer m_FieldGeometry;
+
+  mutable std::mutex m_CacheMutex;
+  mutable CacheListType m_CacheList; // front is most recently used
+  mutable CacheMapType m_CacheMap;
+};
+
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkLazyDisplacementFieldTransform.hxx"
+#endif
+
+#endif // itkLazyDisplacementFieldTransform_h
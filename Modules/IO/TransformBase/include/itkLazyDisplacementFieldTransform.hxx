@@ -0,0 +1,235 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkLazyDisplacementFieldTransform_hxx
+#define itkLazyDisplacementFieldTransform_hxx
+
+#include "itkLazyDisplacementFieldTransform.h"
+#include "itkImageFileReader.h"
+#include "itkMath.h"
+
+namespace itk
+{
+
+template <typename TParametersValueType, unsigned int NDimensions>
+LazyDisplacementFieldTransform<TParametersValueType, NDimensions>::LazyDisplacementFieldTransform() = default;
+
+template <typename TParametersValueType, unsigned int NDimensions>
+void
+LazyDisplacementFieldTransform<TParametersValueType, NDimensions>::SetFieldFileName(const std::string & fileName)
+{
+  if (fileName == m_FieldFileName)
+  {
+    return;
+  }
+  m_FieldFileName = fileName;
+
+  const auto reader = ImageFileReader<DisplacementFieldType>::New();
+  reader->SetFileName(fileName);
+  reader->UpdateOutputInformation();
+
+  // keep only the geometry; the pixel buffer stays unallocated
+  m_FieldGeometry = DisplacementFieldType::New();
+  m_FieldGeometry->CopyInformation(reader->GetOutput());
+  m_FieldGeometry->SetRegions(reader->GetOutput()->GetLargestPossibleRegion());
+
+  const std::lock_guard<std::mutex> lockGuard(m_CacheMutex);
+  m_CacheMap.clear();
+  m_CacheList.clear();
+  this->Modified();
+}
+
+template <typename TParametersValueType, unsigned int NDimensions>
+void
+LazyDisplacementFieldTransform<TParametersValueType, NDimensions>::SetTileSize(SizeValueType tileSize)
+{
+  if (tileSize == m_TileSize)
+  {
+    return;
+  }
+  if (tileSize == 0)
+  {
+    itkExceptionMacro("Tile size must be positive.");
+  }
+  m_TileSize = tileSize;
+
+  const std::lock_guard<std::mutex> lockGuard(m_CacheMutex);
+  m_CacheMap.clear();
+  m_CacheList.clear();
+  this->Modified();
+}
+
+template <typename TParametersValueType, unsigned int NDimensions>
+void
+LazyDisplacementFieldTransform<TParametersValueType, NDimensions>::SetMaximumNumberOfTiles(
+  SizeValueType maximumNumberOfTiles)
+{
+  if (maximumNumberOfTiles == m_MaximumNumberOfTiles)
+  {
+    return;
+  }
+  if (maximumNumberOfTiles == 0)
+  {
+    itkExceptionMacro("The tile cache must hold at least one tile.");
+  }
+  m_MaximumNumberOfTiles = maximumNumberOfTiles;
+
+  const std::lock_guard<std::mutex> lockGuard(m_CacheMutex);
+  while (m_CacheList.size() > m_MaximumNumberOfTiles)
+  {
+    m_CacheMap.erase(m_CacheList.back().TileIndex);
+    m_CacheList.pop_back();
+  }
+  this->Modified();
+}
+
+template <typename TParametersValueType, unsigned int NDimensions>
+SizeValueType
+LazyDisplacementFieldTransform<TParametersValueType, NDimensions>::GetNumberOfCachedTiles() const
+{
+  const std::lock_guard<std::mutex> lockGuard(m_CacheMutex);
+  return static_cast<SizeValueType>(m_CacheList.size());
+}
+
+template <typename TParametersValueType, unsigned int NDimensions>
+auto
+LazyDisplacementFieldTransform<TParametersValueType, NDimensions>::TransformPoint(
+  const InputPointType & inputPoint) const -> OutputPointType
+{
+  if (m_FieldFileName.empty())
+  {
+    // no file: behave exactly like an eagerly loaded field transform
+    return Superclass::TransformPoint(inputPoint);
+  }
+
+  typename DisplacementFieldType::PointType point;
+  point.CastFrom(inputPoint);
+
+  OutputPointType outputPoint;
+  outputPoint.CastFrom(inputPoint);
+
+  ContinuousIndex<ScalarType, NDimensions> cindex;
+  m_FieldGeometry->TransformPhysicalPointToContinuousIndex(point, cindex);
+
+  // linear interpolation needs the support [floor, floor + 1]; clamp
+  // the inside test to the region covered by the field
+  const RegionType & fieldRegion = m_FieldGeometry->GetLargestPossibleRegion();
+  for (unsigned int dim = 0; dim < NDimensions; ++dim)
+  {
+    const auto lower = static_cast<ScalarType>(fieldRegion.GetIndex(dim));
+    const auto upper = static_cast<ScalarType>(fieldRegion.GetIndex(dim)) +
+                       static_cast<ScalarType>(fieldRegion.GetSize(dim)) - static_cast<ScalarType>(1);
+    if (cindex[dim] < lower || cindex[dim] > upper)
+    {
+      // outside the field domain the transform is the identity
+      return outputPoint;
+    }
+  }
+
+  typename TileInterpolatorType::Pointer interpolator;
+  {
+    const std::lock_guard<std::mutex> lockGuard(m_CacheMutex);
+    interpolator = this->GetTileInterpolator(cindex);
+  }
+
+  // evaluation is outside the lock; the tile is immutable once loaded
+  const typename TileInterpolatorType::OutputType displacement = interpolator->EvaluateAtContinuousIndex(cindex);
+  for (unsigned int dim = 0; dim < NDimensions; ++dim)
+  {
+    outputPoint[dim] += displacement[dim];
+  }
+  return outputPoint;
+}
+
+template <typename TParametersValueType, unsigned int NDimensions>
+auto
+LazyDisplacementFieldTransform<TParametersValueType, NDimensions>::GetTileInterpolator(
+  const ContinuousIndex<ScalarType, NDimensions> & cindex) const -> typename TileInterpolatorType::Pointer
+{
+  const RegionType & fieldRegion = m_FieldGeometry->GetLargestPossibleRegion();
+
+  IndexType tileIndex;
+  for (unsigned int dim = 0; dim < NDimensions; ++dim)
+  {
+    const auto voxel = Math::Floor<IndexValueType>(cindex[dim]);
+    tileIndex[dim] = (voxel - fieldRegion.GetIndex(dim)) / static_cast<IndexValueType>(m_TileSize);
+  }
+
+  const auto mapIterator = m_CacheMap.find(tileIndex);
+  if (mapIterator != m_CacheMap.end())
+  {
+    m_CacheList.splice(m_CacheList.begin(), m_CacheList, mapIterator->second);
+    return mapIterator->second->Interpolator;
+  }
+
+  // one voxel of overlap keeps the linear interpolation support of
+  // every point whose containing voxel is in this tile inside the tile
+  RegionType tileRegion;
+  for (unsigned int dim = 0; dim < NDimensions; ++dim)
+  {
+    tileRegion.SetIndex(dim, fieldRegion.GetIndex(dim) + tileIndex[dim] * static_cast<IndexValueType>(m_TileSize));
+    tileRegion.SetSize(dim, m_TileSize + 1);
+  }
+  tileRegion.Crop(fieldRegion);
+
+  CacheEntry entry;
+  entry.TileIndex = tileIndex;
+  entry.Tile = this->LoadTile(tileRegion);
+  entry.Interpolator = TileInterpolatorType::New();
+  entry.Interpolator->SetInputImage(entry.Tile);
+
+  m_CacheList.push_front(entry);
+  m_CacheMap[tileIndex] = m_CacheList.begin();
+  while (m_CacheList.size() > m_MaximumNumberOfTiles)
+  {
+    m_CacheMap.erase(m_CacheList.back().TileIndex);
+    m_CacheList.pop_back();
+  }
+  return entry.Interpolator;
+}
+
+template <typename TParametersValueType, unsigned int NDimensions>
+auto
+LazyDisplacementFieldTransform<TParametersValueType, NDimensions>::LoadTile(const RegionType & tileRegion) const
+  -> DisplacementFieldPointer
+{
+  const auto reader = ImageFileReader<DisplacementFieldType>::New();
+  reader->SetFileName(m_FieldFileName);
+  reader->UseStreamingOn();
+  reader->GetOutput()->SetRequestedRegion(tileRegion);
+  reader->Update();
+
+  DisplacementFieldPointer tile = reader->GetOutput();
+  tile->DisconnectPipeline();
+  return tile;
+}
+
+template <typename TParametersValueType, unsigned int NDimensions>
+void
+LazyDisplacementFieldTransform<TParametersValueType, NDimensions>::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "FieldFileName: " << m_FieldFileName << std::endl;
+  os << indent << "TileSize: " << m_TileSize << std::endl;
+  os << indent << "MaximumNumberOfTiles: " << m_MaximumNumberOfTiles << std::endl;
+  os << indent << "NumberOfCachedTiles: " << this->GetNumberOfCachedTiles() << std::endl;
+}
+
+} // end namespace itk
+
+#endif
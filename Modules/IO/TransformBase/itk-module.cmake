@@ -5,12 +5,15 @@ itk_module(ITKIOTransformBase
   ENABLE_SHARED
   DEPENDS
     ITKCommon
+    ITKIOImageBase
     ITKTransform
     ITKTransformFactory
   COMPILE_DEPENDS
     ITKDisplacementField
   TEST_DEPENDS
     ITKTestKernel
+  FACTORY_NAMES
+    TransformIO::Binary
   DESCRIPTION
     "${DOCUMENTATION}"
 )
@@ -0,0 +1,397 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#define ITK_TEMPLATE_EXPLICIT_BinaryTransformIO
+#include "itkBinaryTransformIO.h"
+#include "itkByteSwapper.h"
+#include "itkCompositeTransformIOHelper.h"
+#include "itkMemoryMappedFile.h"
+#include "itksys/SystemTools.hxx"
+
+#include <cstring>
+
+namespace itk
+{
+namespace
+{
+// file layout: 24-byte header, then per transform the type string and
+// the two parameter blocks, each block preceded by its uint64 element
+// count and the records padded to 8-byte alignment so the blocks can be
+// referenced directly inside a memory mapping
+constexpr char BinaryTransformFileMagic[8] = { 'I', 'T', 'K', 'T', 'F', 'M', 'B', '\0' };
+
+constexpr uint32_t BinaryTransformFileVersion = 1;
+
+constexpr uint32_t BinaryTransformEndianCheck = 0x01020304;
+
+constexpr SizeValueType BinaryTransformHeaderSize = 24;
+
+inline SizeValueType
+AlignToEight(SizeValueType offset)
+{
+  return (offset + 7) & ~SizeValueType{ 7 };
+}
+
+template <typename TValue>
+void
+SwapRangeToFileOrder(TValue * values, SizeValueType count, bool fileIsBigEndian)
+{
+  // no-op when the file order matches the host
+  if (fileIsBigEndian)
+  {
+    ByteSwapper<TValue>::SwapRangeFromSystemToBigEndian(values, count);
+  }
+  else
+  {
+    ByteSwapper<TValue>::SwapRangeFromSystemToLittleEndian(values, count);
+  }
+}
+} // namespace
+
+template <typename TParametersValueType>
+BinaryTransformIOTemplate<TParametersValueType>::BinaryTransformIOTemplate() = default;
+
+template <typename TParametersValueType>
+BinaryTransformIOTemplate<TParametersValueType>::~BinaryTransformIOTemplate() = default;
+
+template <typename TParametersValueType>
+bool
+BinaryTransformIOTemplate<TParametersValueType>::CanReadFile(const char * fileName)
+{
+  if (itksys::SystemTools::GetFilenameLastExtension(fileName) != ".tfb")
+  {
+    return false;
+  }
+
+  std::ifstream in(fileName, std::ios::in | std::ios::binary);
+  char          magic[8];
+  in.read(magic, 8);
+  return in.gcount() == 8 && std::memcmp(magic, BinaryTransformFileMagic, 8) == 0;
+}
+
+template <typename TParametersValueType>
+bool
+BinaryTransformIOTemplate<TParametersValueType>::CanWriteFile(const char * fileName)
+{
+  return itksys::SystemTools::GetFilenameLastExtension(fileName) == ".tfb";
+}
+
+template <typename TParametersValueType>
+void
+BinaryTransformIOTemplate<TParametersValueType>::Read()
+{
+  std::ifstream in(this->GetFileName(), std::ios::in | std::ios::binary);
+  if (in.fail())
+  {
+    itkExceptionMacro("Failed opening " << this->GetFileName() << " for reading.");
+  }
+
+  char     magic[8];
+  uint32_t version = 0;
+  uint32_t endianCheck = 0;
+  uint32_t scalarSize = 0;
+  uint32_t numberOfTransforms = 0;
+  in.read(magic, 8);
+  in.read(reinterpret_cast<char *>(&version), 4);
+  in.read(reinterpret_cast<char *>(&endianCheck), 4);
+  in.read(reinterpret_cast<char *>(&scalarSize), 4);
+  in.read(reinterpret_cast<char *>(&numberOfTransforms), 4);
+  if (in.fail() || std::memcmp(magic, BinaryTransformFileMagic, 8) != 0)
+  {
+    itkExceptionMacro("Not a binary transform file: " << this->GetFileName());
+  }
+
+  const bool hostIsBigEndian = ByteSwapper<void *>::SystemIsBigEndian();
+  bool       fileIsBigEndian = hostIsBigEndian;
+  if (endianCheck != BinaryTransformEndianCheck)
+  {
+    uint32_t swappedCheck = endianCheck;
+    ByteSwapper<uint32_t>::SwapFromSystemToBigEndian(&swappedCheck);
+    ByteSwapper<uint32_t>::SwapFromSystemToLittleEndian(&swappedCheck);
+    // one of the two calls above swapped; a foreign-endian file yields
+    // the expected marker after one swap
+    if (swappedCheck != BinaryTransformEndianCheck)
+    {
+      itkExceptionMacro("Corrupt endianness marker in " << this->GetFileName());
+    }
+    fileIsBigEndian = !hostIsBigEndian;
+    ByteSwapper<uint32_t>::SwapFromSystemToBigEndian(&version);
+    ByteSwapper<uint32_t>::SwapFromSystemToLittleEndian(&version);
+    ByteSwapper<uint32_t>::SwapFromSystemToBigEndian(&scalarSize);
+    ByteSwapper<uint32_t>::SwapFromSystemToLittleEndian(&scalarSize);
+    ByteSwapper<uint32_t>::SwapFromSystemToBigEndian(&numberOfTransforms);
+    ByteSwapper<uint32_t>::SwapFromSystemToLittleEndian(&numberOfTransforms);
+  }
+  if (version != BinaryTransformFileVersion)
+  {
+    itkExceptionMacro("Unsupported binary transform file version " << version);
+  }
+
+  // the zero-copy path: a native-order file holding the reader's scalar
+  // type can be parsed directly inside a memory mapping
+  if (fileIsBigEndian == hostIsBigEndian && scalarSize == sizeof(ParametersValueType))
+  {
+    const auto       fileLength = static_cast<SizeValueType>(itksys::SystemTools::FileLength(this->GetFileName()));
+    MemoryMappedFile mapping;
+    if (mapping.Map(this->GetFileName(), 0, fileLength))
+    {
+      in.close();
+      this->ReadMapped(static_cast<const char *>(mapping.GetBuffer()), fileLength, numberOfTransforms);
+      return;
+    }
+  }
+
+  this->ReadBuffered(in, fileIsBigEndian, scalarSize, numberOfTransforms);
+}
+
+template <typename TParametersValueType>
+void
+BinaryTransformIOTemplate<TParametersValueType>::ReadMapped(const char *  data,
+                                                            SizeValueType length,
+                                                            uint32_t      numberOfTransforms)
+{
+  SizeValueType offset = BinaryTransformHeaderSize;
+
+  const auto require = [this, length](bool condition) {
+    if (!condition)
+    {
+      itkExceptionMacro("Premature end of binary transform file " << this->GetFileName() << " (" << length
+                                                                  << " bytes).");
+    }
+  };
+
+  for (uint32_t tt = 0; tt < numberOfTransforms; ++tt)
+  {
+    uint64_t typeNameLength = 0;
+    require(offset + 8 <= length);
+    std::memcpy(&typeNameLength, data + offset, 8);
+    offset += 8;
+    require(offset + typeNameLength <= length);
+    std::string typeName(data + offset, static_cast<std::string::size_type>(typeNameLength));
+    offset = AlignToEight(offset + static_cast<SizeValueType>(typeNameLength));
+
+    Superclass::CorrectTransformPrecisionType(typeName);
+    TransformPointer transform;
+    this->CreateTransform(transform, typeName);
+
+    uint64_t numberOfFixedParameters = 0;
+    require(offset + 8 <= length);
+    std::memcpy(&numberOfFixedParameters, data + offset, 8);
+    offset += 8;
+    require(offset + numberOfFixedParameters * sizeof(FixedParametersValueType) <= length);
+    const char * fixedBlock = data + offset;
+    offset += static_cast<SizeValueType>(numberOfFixedParameters) * sizeof(FixedParametersValueType);
+
+    uint64_t numberOfParameters = 0;
+    require(offset + 8 <= length);
+    std::memcpy(&numberOfParameters, data + offset, 8);
+    offset += 8;
+    require(offset + numberOfParameters * sizeof(ParametersValueType) <= length);
+    const char * parametersBlock = data + offset;
+    offset = AlignToEight(offset + static_cast<SizeValueType>(numberOfParameters) * sizeof(ParametersValueType));
+
+    if (typeName.find("CompositeTransform") == std::string::npos)
+    {
+      // the arrays reference the mapping; SetFixedParameters and
+      // SetParameters make the transform's own copy
+      FixedParametersType fixedParameters;
+      fixedParameters.SetData(reinterpret_cast<FixedParametersValueType *>(const_cast<char *>(fixedBlock)),
+                              static_cast<SizeValueType>(numberOfFixedParameters),
+                              false);
+      transform->SetFixedParameters(fixedParameters);
+
+      ParametersType parameters;
+      parameters.SetData(reinterpret_cast<ParametersValueType *>(const_cast<char *>(parametersBlock)),
+                         static_cast<SizeValueType>(numberOfParameters),
+                         false);
+      transform->SetParameters(parameters);
+    }
+    this->GetReadTransformList().push_back(transform);
+  }
+}
+
+template <typename TParametersValueType>
+void
+BinaryTransformIOTemplate<TParametersValueType>::ReadBuffered(std::istream & in,
+                                                              bool           fileIsBigEndian,
+                                                              uint32_t       scalarSize,
+                                                              uint32_t       numberOfTransforms)
+{
+  if (scalarSize != 4 && scalarSize != 8)
+  {
+    itkExceptionMacro("Unsupported parameter scalar size " << scalarSize << " in " << this->GetFileName());
+  }
+
+  const auto readU64 = [&in, fileIsBigEndian, this]() {
+    uint64_t value = 0;
+    in.read(reinterpret_cast<char *>(&value), 8);
+    if (in.fail())
+    {
+      itkExceptionMacro("Premature end of binary transform file " << this->GetFileName());
+    }
+    SwapRangeToFileOrder(&value, 1, fileIsBigEndian);
+    return value;
+  };
+
+  for (uint32_t tt = 0; tt < numberOfTransforms; ++tt)
+  {
+    const uint64_t typeNameLength = readU64();
+    std::string    typeName(static_cast<std::string::size_type>(typeNameLength), '\0');
+    in.read(&typeName[0], static_cast<std::streamsize>(typeNameLength));
+    in.seekg(static_cast<std::streamoff>(AlignToEight(static_cast<SizeValueType>(in.tellg()))), std::ios::beg);
+
+    Superclass::CorrectTransformPrecisionType(typeName);
+    TransformPointer transform;
+    this->CreateTransform(transform, typeName);
+
+    const auto          numberOfFixedParameters = static_cast<SizeValueType>(readU64());
+    FixedParametersType fixedParameters(numberOfFixedParameters);
+    in.read(reinterpret_cast<char *>(fixedParameters.data_block()),
+            static_cast<std::streamsize>(numberOfFixedParameters * sizeof(FixedParametersValueType)));
+    SwapRangeToFileOrder(fixedParameters.data_block(), numberOfFixedParameters, fileIsBigEndian);
+
+    const auto     numberOfParameters = static_cast<SizeValueType>(readU64());
+    ParametersType parameters(numberOfParameters);
+    if (scalarSize == sizeof(ParametersValueType))
+    {
+      // one bulk read straight into the final storage
+      in.read(reinterpret_cast<char *>(parameters.data_block()),
+              static_cast<std::streamsize>(numberOfParameters * sizeof(ParametersValueType)));
+      SwapRangeToFileOrder(parameters.data_block(), numberOfParameters, fileIsBigEndian);
+    }
+    else if (scalarSize == 4)
+    {
+      std::vector<float> stored(numberOfParameters);
+      in.read(reinterpret_cast<char *>(stored.data()), static_cast<std::streamsize>(numberOfParameters * 4));
+      SwapRangeToFileOrder(stored.data(), numberOfParameters, fileIsBigEndian);
+      std::copy(stored.begin(), stored.end(), parameters.begin());
+    }
+    else
+    {
+      std::vector<double> stored(numberOfParameters);
+      in.read(reinterpret_cast<char *>(stored.data()), static_cast<std::streamsize>(numberOfParameters * 8));
+      SwapRangeToFileOrder(stored.data(), numberOfParameters, fileIsBigEndian);
+      std::copy(stored.begin(), stored.end(), parameters.begin());
+    }
+    in.seekg(static_cast<std::streamoff>(AlignToEight(static_cast<SizeValueType>(in.tellg()))), std::ios::beg);
+    if (in.fail())
+    {
+      itkExceptionMacro("Premature end of binary transform file " << this->GetFileName());
+    }
+
+    if (typeName.find("CompositeTransform") == std::string::npos)
+    {
+      transform->SetFixedParameters(fixedParameters);
+      transform->SetParameters(parameters);
+    }
+    this->GetReadTransformList().push_back(transform);
+  }
+}
+
+template <typename TParametersValueType>
+void
+BinaryTransformIOTemplate<TParametersValueType>::Write()
+{
+  ConstTransformListType & transformList = this->GetWriteTransformList();
+
+  std::ofstream out;
+  this->OpenStream(out, true);
+
+  const std::string CompositeTransformTypeName = transformList.front()->GetTransformTypeAsString();
+  //
+  // if the first transform in the list is a
+  // composite transform, use its internal list
+  // instead of the IO
+  CompositeTransformIOHelperTemplate<TParametersValueType> helper;
+  if (CompositeTransformTypeName.find("CompositeTransform") != std::string::npos)
+  {
+    transformList = helper.GetTransformList(transformList.front().GetPointer());
+  }
+
+  out.write(BinaryTransformFileMagic, 8);
+  const uint32_t version = BinaryTransformFileVersion;
+  const uint32_t endianCheck = BinaryTransformEndianCheck;
+  const auto     scalarSize = static_cast<uint32_t>(sizeof(ParametersValueType));
+  const auto     numberOfTransforms = static_cast<uint32_t>(transformList.size());
+  out.write(reinterpret_cast<const char *>(&version), 4);
+  out.write(reinterpret_cast<const char *>(&endianCheck), 4);
+  out.write(reinterpret_cast<const char *>(&scalarSize), 4);
+  out.write(reinterpret_cast<const char *>(&numberOfTransforms), 4);
+
+  constexpr char padding[8] = {};
+  const auto     padToEight = [&out, &padding]() {
+    const auto position = static_cast<SizeValueType>(out.tellp());
+    out.write(padding, static_cast<std::streamsize>(AlignToEight(position) - position));
+  };
+
+  int count = 0;
+  for (typename ConstTransformListType::const_iterator it = transformList.begin(); it != transformList.end();
+       ++it, ++count)
+  {
+    const std::string typeName = (*it)->GetTransformTypeAsString();
+    if (typeName.find("CompositeTransform") != std::string::npos && count > 0)
+    {
+      itkExceptionMacro(<< "Composite Transform can only be 1st transform in a file");
+    }
+
+    const auto typeNameLength = static_cast<uint64_t>(typeName.size());
+    out.write(reinterpret_cast<const char *>(&typeNameLength), 8);
+    out.write(typeName.data(), static_cast<std::streamsize>(typeName.size()));
+    padToEight();
+
+    // Composite Transforms are written with empty parameter blocks;
+    // their parameters are the union of their components' parameters.
+    const bool writeParameters = typeName.find("CompositeTransform") == std::string::npos;
+
+    const FixedParametersType fixedParameters =
+      writeParameters ? (*it)->GetFixedParameters() : FixedParametersType();
+    const auto numberOfFixedParameters = static_cast<uint64_t>(fixedParameters.size());
+    out.write(reinterpret_cast<const char *>(&numberOfFixedParameters), 8);
+    if (!fixedParameters.empty())
+    {
+      out.write(reinterpret_cast<const char *>(fixedParameters.data_block()),
+                static_cast<std::streamsize>(fixedParameters.size() * sizeof(FixedParametersValueType)));
+    }
+
+    const ParametersType parameters = writeParameters ? (*it)->GetParameters() : ParametersType();
+    const auto           numberOfParameters = static_cast<uint64_t>(parameters.size());
+    out.write(reinterpret_cast<const char *>(&numberOfParameters), 8);
+    if (!parameters.empty())
+    {
+      out.write(reinterpret_cast<const char *>(parameters.data_block()),
+                static_cast<std::streamsize>(parameters.size() * sizeof(ParametersValueType)));
+    }
+    padToEight();
+  }
+
+  if (out.fail())
+  {
+    itkExceptionMacro("Failure writing " << this->GetFileName());
+  }
+  out.close();
+}
+
+ITK_GCC_PRAGMA_DIAG_PUSH()
+ITK_GCC_PRAGMA_DIAG(ignored "-Wattributes")
+
+template class ITKIOTransformBase_EXPORT BinaryTransformIOTemplate<double>;
+template class ITKIOTransformBase_EXPORT BinaryTransformIOTemplate<float>;
+
+ITK_GCC_PRAGMA_DIAG_POP()
+
+} // end namespace itk
@@ -0,0 +1,134 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkBinaryTransformIOFactory.h"
+#include "itkBinaryTransformIO.h"
+#include "itkTransformFileWriter.h"
+#include "itkTransformFileReader.h"
+#include "itkAffineTransform.h"
+#include "itkBSplineTransform.h"
+#include "itkMath.h"
+#include "itkTestingMacros.h"
+
+// Round-trips an affine and a large BSpline transform through the
+// binary ".tfb" format and verifies the parameters, including the
+// float-precision read of a double-precision file.
+int
+itkBinaryTransformIOTest(int argc, char * argv[])
+{
+  if (argc < 2)
+  {
+    std::cerr << "Usage: " << itkNameOfTestExecutableMacro(argv) << " outputFileBase" << std::endl;
+    return EXIT_FAILURE;
+  }
+  itk::BinaryTransformIOFactory::RegisterOneFactory();
+
+  const std::string fileName = std::string(argv[1]) + ".tfb";
+
+  using AffineTransformType = itk::AffineTransform<double, 3>;
+  auto affine = AffineTransformType::New();
+  {
+    AffineTransformType::OutputVectorType translation;
+    translation[0] = 12.5;
+    translation[1] = -7.25;
+    translation[2] = 3.0;
+    affine->Translate(translation);
+    AffineTransformType::OutputVectorType axis;
+    axis.Fill(0.0);
+    axis[2] = 1.0;
+    affine->Rotate3D(axis, 0.25);
+  }
+
+  using BSplineTransformType = itk::BSplineTransform<double, 3, 3>;
+  auto bspline = BSplineTransformType::New();
+  {
+    BSplineTransformType::MeshSizeType meshSize;
+    meshSize.Fill(8);
+    bspline->SetTransformDomainMeshSize(meshSize);
+    BSplineTransformType::ParametersType parameters(bspline->GetNumberOfParameters());
+    for (itk::SizeValueType ii = 0; ii < parameters.size(); ++ii)
+    {
+      parameters[ii] = 0.001 * static_cast<double>(ii % 997);
+    }
+    bspline->SetParametersByValue(parameters);
+  }
+
+  auto writer = itk::TransformFileWriterTemplate<double>::New();
+  writer->SetFileName(fileName);
+  writer->AddTransform(affine);
+  writer->AddTransform(bspline);
+  ITK_TRY_EXPECT_NO_EXCEPTION(writer->Update());
+
+  // double-precision read: exact round trip
+  {
+    auto reader = itk::TransformFileReaderTemplate<double>::New();
+    reader->SetFileName(fileName);
+    ITK_TRY_EXPECT_NO_EXCEPTION(reader->Update());
+
+    const auto * transformList = reader->GetTransformList();
+    ITK_TEST_EXPECT_EQUAL(transformList->size(), 2u);
+    const auto readAffine = transformList->front();
+    const auto readBSpline = transformList->back();
+    ITK_TEST_EXPECT_EQUAL(readAffine->GetTransformTypeAsString(), affine->GetTransformTypeAsString());
+    ITK_TEST_EXPECT_EQUAL(readBSpline->GetTransformTypeAsString(), bspline->GetTransformTypeAsString());
+
+    if (readAffine->GetParameters() != affine->GetParameters() ||
+        readAffine->GetFixedParameters() != affine->GetFixedParameters())
+    {
+      std::cerr << "Affine parameters changed by binary round trip." << std::endl;
+      return EXIT_FAILURE;
+    }
+    if (readBSpline->GetParameters() != bspline->GetParameters() ||
+        readBSpline->GetFixedParameters() != bspline->GetFixedParameters())
+    {
+      std::cerr << "BSpline parameters changed by binary round trip." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // float-precision read of the double-precision file: values convert
+  {
+    auto reader = itk::TransformFileReaderTemplate<float>::New();
+    reader->SetFileName(fileName);
+    ITK_TRY_EXPECT_NO_EXCEPTION(reader->Update());
+
+    const auto * transformList = reader->GetTransformList();
+    ITK_TEST_EXPECT_EQUAL(transformList->size(), 2u);
+    const auto & readParameters = transformList->back()->GetParameters();
+    const auto & writtenParameters = bspline->GetParameters();
+    ITK_TEST_EXPECT_EQUAL(readParameters.size(), writtenParameters.size());
+    for (itk::SizeValueType ii = 0; ii < readParameters.size(); ++ii)
+    {
+      if (itk::Math::NotAlmostEquals(readParameters[ii], static_cast<float>(writtenParameters[ii])))
+      {
+        std::cerr << "Parameter " << ii << " changed by float-precision read." << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  // a text transform file must be rejected
+  {
+    auto io = itk::BinaryTransformIO::New();
+    ITK_TEST_EXPECT_TRUE(!io->CanReadFile((std::string(argv[1]) + ".tfm").c_str()));
+    ITK_TEST_EXPECT_TRUE(io->CanWriteFile(fileName.c_str()));
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
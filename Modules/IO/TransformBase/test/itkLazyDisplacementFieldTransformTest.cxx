@@ -0,0 +1,145 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkLazyDisplacementFieldTransform.h"
+#include "itkImageFileWriter.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkMath.h"
+#include "itkTestingMacros.h"
+
+// Compares the tile-cached, lazily loaded transform against the eager
+// DisplacementFieldTransform over the whole field domain and verifies
+// that the tile cache stays within its capacity.
+int
+itkLazyDisplacementFieldTransformTest(int argc, char * argv[])
+{
+  if (argc < 2)
+  {
+    std::cerr << "Usage: " << itkNameOfTestExecutableMacro(argv) << " outputFileName" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const std::string fieldFileName = argv[1];
+
+  constexpr unsigned int Dimension = 3;
+  using ScalarType = double;
+  using TransformType = itk::LazyDisplacementFieldTransform<ScalarType, Dimension>;
+  using FieldType = TransformType::DisplacementFieldType;
+
+  // deterministic field on a non-trivial geometry
+  auto field = FieldType::New();
+  FieldType::RegionType fieldRegion;
+  fieldRegion.SetSize({ { 40, 30, 20 } });
+  field->SetRegions(fieldRegion);
+  FieldType::SpacingType spacing;
+  spacing[0] = 1.25;
+  spacing[1] = 0.75;
+  spacing[2] = 2.0;
+  field->SetSpacing(spacing);
+  FieldType::PointType origin;
+  origin[0] = -10.0;
+  origin[1] = 5.0;
+  origin[2] = 2.5;
+  field->SetOrigin(origin);
+  field->Allocate();
+
+  itk::ImageRegionIteratorWithIndex<FieldType> it(field, fieldRegion);
+  for (; !it.IsAtEnd(); ++it)
+  {
+    const FieldType::IndexType index = it.GetIndex();
+    FieldType::PixelType       displacement;
+    displacement[0] = 0.01 * index[0] + 0.002 * index[1];
+    displacement[1] = -0.03 * index[1] + 0.001 * index[2];
+    displacement[2] = 0.05 * std::sin(0.2 * index[0]);
+    it.Set(displacement);
+  }
+  ITK_TRY_EXPECT_NO_EXCEPTION(itk::WriteImage(field, fieldFileName));
+
+  // eager reference transform over the in-memory field
+  using ReferenceTransformType = itk::DisplacementFieldTransform<ScalarType, Dimension>;
+  auto referenceTransform = ReferenceTransformType::New();
+  referenceTransform->SetDisplacementField(field);
+
+  auto lazyTransform = TransformType::New();
+  lazyTransform->SetTileSize(8);
+  lazyTransform->SetMaximumNumberOfTiles(4);
+  ITK_TEST_EXPECT_EQUAL(lazyTransform->GetTileSize(), 8u);
+  ITK_TEST_EXPECT_EQUAL(lazyTransform->GetMaximumNumberOfTiles(), 4u);
+  ITK_TRY_EXPECT_NO_EXCEPTION(lazyTransform->SetFieldFileName(fieldFileName));
+  ITK_TEST_EXPECT_EQUAL(lazyTransform->GetFieldFileName(), fieldFileName);
+  ITK_TEST_EXPECT_EQUAL(lazyTransform->GetNumberOfCachedTiles(), 0u);
+
+  // sweep points across the domain, including off-voxel positions
+  for (double zz = 0.0; zz < 19.0; zz += 2.4)
+  {
+    for (double yy = 0.0; yy < 29.0; yy += 3.3)
+    {
+      for (double xx = 0.0; xx < 39.0; xx += 2.7)
+      {
+        TransformType::InputPointType point;
+        point[0] = origin[0] + spacing[0] * xx;
+        point[1] = origin[1] + spacing[1] * yy;
+        point[2] = origin[2] + spacing[2] * zz;
+
+        const TransformType::OutputPointType lazyPoint = lazyTransform->TransformPoint(point);
+        const TransformType::OutputPointType referencePoint = referenceTransform->TransformPoint(point);
+        for (unsigned int dim = 0; dim < Dimension; ++dim)
+        {
+          if (!itk::Math::FloatAlmostEqual(lazyPoint[dim], referencePoint[dim], 4, 1e-10))
+          {
+            std::cerr << "Lazy transform disagrees with the eager transform at " << point << ": " << lazyPoint
+                      << " vs " << referencePoint << std::endl;
+            return EXIT_FAILURE;
+          }
+        }
+      }
+    }
+  }
+
+  // the cache must have been bounded throughout the sweep
+  ITK_TEST_EXPECT_TRUE(lazyTransform->GetNumberOfCachedTiles() >= 1);
+  ITK_TEST_EXPECT_TRUE(lazyTransform->GetNumberOfCachedTiles() <= 4);
+
+  // a repeated query is a cache hit
+  {
+    TransformType::InputPointType point;
+    point[0] = origin[0] + spacing[0] * 1.5;
+    point[1] = origin[1] + spacing[1] * 1.5;
+    point[2] = origin[2] + spacing[2] * 1.5;
+    lazyTransform->TransformPoint(point);
+    const itk::SizeValueType cachedTiles = lazyTransform->GetNumberOfCachedTiles();
+    lazyTransform->TransformPoint(point);
+    ITK_TEST_EXPECT_EQUAL(lazyTransform->GetNumberOfCachedTiles(), cachedTiles);
+  }
+
+  // outside the field domain the transform is the identity
+  {
+    TransformType::InputPointType point;
+    point[0] = origin[0] - 100.0;
+    point[1] = origin[1];
+    point[2] = origin[2];
+    const TransformType::OutputPointType outputPoint = lazyTransform->TransformPoint(point);
+    ITK_TEST_EXPECT_TRUE(itk::Math::ExactlyEquals(outputPoint[0], point[0]) &&
+                         itk::Math::ExactlyEquals(outputPoint[1], point[1]) &&
+                         itk::Math::ExactlyEquals(outputPoint[2], point[2]));
+  }
+
+  lazyTransform->Print(std::cout);
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -16,6 +16,7 @@
  *
  *=========================================================================*/
 #include "itkVTKImageIO.h"
+#include "itkBulkAsciiReader.h"
 #include "itkByteSwapper.h"
 
 #include "itksys/SystemTools.hxx"
@@ -487,7 +488,50 @@ VTKImageIO::ReadBufferAsASCII(std::istream &              is,
   }
   else
   {
-    this->ImageIOBase::ReadBufferAsASCII(is, buffer, ctype, numComp);
+    // bulk tokenization instead of the per-value stream extraction of
+    // ImageIOBase::ReadBufferAsASCII
+    switch (ctype)
+    {
+      case IOComponentEnum::UCHAR:
+        ReadBulkAsciiValues(is, static_cast<unsigned char *>(buffer), numComp);
+        break;
+      case IOComponentEnum::CHAR:
+        ReadBulkAsciiValues(is, static_cast<char *>(buffer), numComp);
+        break;
+      case IOComponentEnum::USHORT:
+        ReadBulkAsciiValues(is, static_cast<unsigned short *>(buffer), numComp);
+        break;
+      case IOComponentEnum::SHORT:
+        ReadBulkAsciiValues(is, static_cast<short *>(buffer), numComp);
+        break;
+      case IOComponentEnum::UINT:
+        ReadBulkAsciiValues(is, static_cast<unsigned int *>(buffer), numComp);
+        break;
+      case IOComponentEnum::INT:
+        ReadBulkAsciiValues(is, static_cast<int *>(buffer), numComp);
+        break;
+      case IOComponentEnum::ULONG:
+        ReadBulkAsciiValues(is, static_cast<unsigned long *>(buffer), numComp);
+        break;
+      case IOComponentEnum::LONG:
+        ReadBulkAsciiValues(is, static_cast<long *>(buffer), numComp);
+        break;
+      case IOComponentEnum::ULONGLONG:
+        ReadBulkAsciiValues(is, static_cast<unsigned long long *>(buffer), numComp);
+        break;
+      case IOComponentEnum::LONGLONG:
+        ReadBulkAsciiValues(is, static_cast<long long *>(buffer), numComp);
+        break;
+      case IOComponentEnum::FLOAT:
+        ReadBulkAsciiValues(is, static_cast<float *>(buffer), numComp);
+        break;
+      case IOComponentEnum::DOUBLE:
+        ReadBulkAsciiValues(is, static_cast<double *>(buffer), numComp);
+        break;
+      default:
+        this->ImageIOBase::ReadBufferAsASCII(is, buffer, ctype, numComp);
+        break;
+    }
   }
 }
 
@@ -0,0 +1,178 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkBenchmark_h
+#define itkBenchmark_h
+
+#include "itkIntTypes.h"
+#include "itkMemoryProbe.h"
+#include "itkMultiThreaderBase.h"
+#include "itkTimeProbe.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace itk
+{
+
+/**
+ *\class Benchmark
+ * \brief Runs a timed workload repeatedly and writes a JSON report
+ *
+ * This class is the common harness of the benchmarks in this module. A
+ * benchmark constructs it with a name, records the relevant parameters
+ * (image size, kernel radius, pixel type, ...), runs the workload a number
+ * of iterations and writes the report. The report contains the individual
+ * wall times of each iteration together with their minimum and mean, the
+ * number of bytes the workload moves per iteration, the memory the workload
+ * allocated, and the global number of work units, so sweeps over sizes and
+ * thread counts can be compared between runs and between releases.
+ *
+ * The JSON is written as a single object so reports from several benchmarks
+ * can be collected into an array by the caller.
+ *
+ * \ingroup ITKBenchmarks
+ */
+class Benchmark
+{
+public:
+  explicit Benchmark(std::string name)
+    : m_Name(std::move(name))
+  {}
+
+  /** Record a parameter of the workload under the "parameters" key */
+  void
+  SetParameter(const std::string & key, const std::string & value)
+  {
+    m_Parameters[key] = std::string("\"") + value + "\"";
+  }
+  void
+  SetParameter(const std::string & key, double value)
+  {
+    std::ostringstream oss;
+    oss << value;
+    m_Parameters[key] = oss.str();
+  }
+
+  /** Record the number of bytes the workload reads and writes per iteration */
+  void
+  SetBytesProcessed(SizeValueType bytes)
+  {
+    m_BytesProcessed = bytes;
+  }
+
+  /** Run the workload the given number of iterations, recording the wall
+   * time of each one and the memory allocated over the whole run. The first
+   * iteration is often slower because of allocations and page faults; the
+   * report keeps all iterations so the caller can decide what to discard. */
+  template <typename TFunction>
+  void
+  Run(TFunction workload, unsigned int iterations)
+  {
+    MemoryProbe memoryProbe;
+    memoryProbe.Start();
+    for (unsigned int i = 0; i < iterations; ++i)
+    {
+      TimeProbe timeProbe;
+      timeProbe.Start();
+      workload();
+      timeProbe.Stop();
+      m_TimesSeconds.push_back(timeProbe.GetTotal());
+    }
+    memoryProbe.Stop();
+    m_MemoryKiloBytes = static_cast<double>(memoryProbe.GetTotal());
+  }
+
+  /** Write the JSON report */
+  void
+  WriteReport(std::ostream & os) const
+  {
+    double sum = 0.0;
+    double minimum = 0.0;
+    for (const double t : m_TimesSeconds)
+    {
+      sum += t;
+    }
+    if (!m_TimesSeconds.empty())
+    {
+      minimum = *std::min_element(m_TimesSeconds.begin(), m_TimesSeconds.end());
+    }
+
+    os << "{\n";
+    os << "  \"name\": \"" << m_Name << "\",\n";
+    os << "  \"threads\": " << MultiThreaderBase::GetGlobalDefaultNumberOfThreads() << ",\n";
+    os << "  \"iterations\": " << m_TimesSeconds.size() << ",\n";
+    os << "  \"times_sec\": [";
+    for (size_t i = 0; i < m_TimesSeconds.size(); ++i)
+    {
+      os << (i ? ", " : "") << m_TimesSeconds[i];
+    }
+    os << "],\n";
+    os << "  \"min_sec\": " << minimum << ",\n";
+    os << "  \"mean_sec\": " << (m_TimesSeconds.empty() ? 0.0 : sum / static_cast<double>(m_TimesSeconds.size()))
+       << ",\n";
+    os << "  \"bytes_processed\": " << m_BytesProcessed << ",\n";
+    os << "  \"memory_kb\": " << m_MemoryKiloBytes << ",\n";
+    os << "  \"parameters\": {";
+    bool first = true;
+    for (const auto & parameter : m_Parameters)
+    {
+      os << (first ? "" : ", ") << '"' << parameter.first << "\": " << parameter.second;
+      first = false;
+    }
+    os << "}\n";
+    os << "}" << std::endl;
+  }
+
+  /** Write the JSON report to the given file, or to std::cout when the file
+   * name is empty */
+  int
+  WriteReport(const std::string & fileName) const
+  {
+    if (fileName.empty())
+    {
+      this->WriteReport(std::cout);
+      return EXIT_SUCCESS;
+    }
+    std::ofstream file(fileName.c_str());
+    if (!file)
+    {
+      std::cerr << "Could not open " << fileName << " for writing" << std::endl;
+      return EXIT_FAILURE;
+    }
+    this->WriteReport(file);
+    return EXIT_SUCCESS;
+  }
+
+private:
+  std::string                        m_Name;
+  std::map<std::string, std::string> m_Parameters;
+  std::vector<double>                m_TimesSeconds;
+  SizeValueType                      m_BytesProcessed{ 0 };
+  double                             m_MemoryKiloBytes{ 0.0 };
+};
+
+} // end namespace itk
+
+#endif
@@ -0,0 +1,24 @@
+set(DOCUMENTATION "This module contains micro-benchmarks for the hot filters
+of the toolkit. Each benchmark runs a filter on synthetic data and emits a
+JSON report with per-iteration wall times, bytes processed and memory usage,
+so performance can be tracked between releases and regressions can be
+quantified. The module is excluded from the default build.")
+
+itk_module(ITKBenchmarks
+  DEPENDS
+    ITKCommon
+  TEST_DEPENDS
+    ITKTestKernel
+    ITKImageSources
+    ITKSmoothing
+    ITKImageGrid
+    ITKThresholding
+    ITKConnectedComponents
+    ITKRegistrationCommon
+    ITKIOImageBase
+    ITKIOMeta
+    ITKIONRRD
+  DESCRIPTION
+    "${DOCUMENTATION}"
+  EXCLUDE_FROM_DEFAULT
+)
@@ -0,0 +1,70 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkBenchmark.h"
+#include "itkBinaryThresholdImageFilter.h"
+#include "itkConnectedComponentImageFilter.h"
+#include "itkRandomImageSource.h"
+
+#include <cstdlib>
+
+int
+itkConnectedComponentImageFilterBenchmark(int argc, char * argv[])
+{
+  const unsigned int sideLength = (argc > 1) ? std::atoi(argv[1]) : 128;
+  const unsigned int iterations = (argc > 2) ? std::atoi(argv[2]) : 3;
+  if (argc > 3)
+  {
+    itk::MultiThreaderBase::SetGlobalDefaultNumberOfThreads(std::atoi(argv[3]));
+  }
+
+  using ImageType = itk::Image<unsigned char, 3>;
+  using LabelImageType = itk::Image<unsigned int, 3>;
+
+  auto source = itk::RandomImageSource<ImageType>::New();
+  ImageType::SizeType size;
+  size.Fill(sideLength);
+  source->SetSize(size);
+  source->Update();
+
+  // Threshold the random input so roughly half the voxels are foreground,
+  // which produces many small components to label
+  auto threshold = itk::BinaryThresholdImageFilter<ImageType, ImageType>::New();
+  threshold->SetInput(source->GetOutput());
+  threshold->SetLowerThreshold(128);
+  threshold->Update();
+  ImageType::Pointer input = threshold->GetOutput();
+
+  auto filter = itk::ConnectedComponentImageFilter<ImageType, LabelImageType>::New();
+  filter->SetInput(input);
+
+  itk::Benchmark benchmark("ConnectedComponentImageFilter");
+  benchmark.SetParameter("size", static_cast<double>(sideLength));
+  benchmark.SetParameter("pixel_type", "unsigned char");
+  benchmark.SetBytesProcessed(input->GetLargestPossibleRegion().GetNumberOfPixels() *
+                              (sizeof(unsigned char) + sizeof(unsigned int)));
+
+  benchmark.Run(
+    [&filter]() {
+      filter->Modified();
+      filter->Update();
+    },
+    iterations);
+
+  return benchmark.WriteReport((argc > 4) ? argv[4] : "");
+}
@@ -0,0 +1,64 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkBenchmark.h"
+#include "itkDiscreteGaussianImageFilter.h"
+#include "itkRandomImageSource.h"
+
+#include <cstdlib>
+
+int
+itkDiscreteGaussianImageFilterBenchmark(int argc, char * argv[])
+{
+  const unsigned int sideLength = (argc > 1) ? std::atoi(argv[1]) : 128;
+  const unsigned int iterations = (argc > 2) ? std::atoi(argv[2]) : 3;
+  if (argc > 3)
+  {
+    itk::MultiThreaderBase::SetGlobalDefaultNumberOfThreads(std::atoi(argv[3]));
+  }
+
+  using ImageType = itk::Image<float, 3>;
+
+  auto source = itk::RandomImageSource<ImageType>::New();
+  ImageType::SizeType size;
+  size.Fill(sideLength);
+  source->SetSize(size);
+  source->Update();
+  ImageType::Pointer input = source->GetOutput();
+
+  constexpr double variance = 4.0;
+
+  auto filter = itk::DiscreteGaussianImageFilter<ImageType, ImageType>::New();
+  filter->SetInput(input);
+  filter->SetVariance(variance);
+
+  itk::Benchmark benchmark("DiscreteGaussianImageFilter");
+  benchmark.SetParameter("size", static_cast<double>(sideLength));
+  benchmark.SetParameter("variance", variance);
+  benchmark.SetParameter("pixel_type", "float");
+  benchmark.SetBytesProcessed(2 * input->GetLargestPossibleRegion().GetNumberOfPixels() * sizeof(float));
+
+  benchmark.Run(
+    [&filter]() {
+      filter->Modified();
+      filter->Update();
+    },
+    iterations);
+
+  return benchmark.WriteReport((argc > 4) ? argv[4] : "");
+}
@@ -0,0 +1,86 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkBenchmark.h"
+#include "itkImageFileReader.h"
+#include "itkImageFileWriter.h"
+#include "itkRandomImageSource.h"
+
+#include <cstdlib>
+#include <string>
+
+int
+itkImageFileReaderBenchmark(int argc, char * argv[])
+{
+  if (argc < 2)
+  {
+    std::cerr << "Usage: " << argv[0] << " outputDirectory [sideLength] [iterations] [threads] [jsonFile]"
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+  const std::string  outputDirectory = argv[1];
+  const unsigned int sideLength = (argc > 2) ? std::atoi(argv[2]) : 128;
+  const unsigned int iterations = (argc > 3) ? std::atoi(argv[3]) : 3;
+  if (argc > 4)
+  {
+    itk::MultiThreaderBase::SetGlobalDefaultNumberOfThreads(std::atoi(argv[4]));
+  }
+
+  using ImageType = itk::Image<unsigned char, 3>;
+
+  auto source = itk::RandomImageSource<ImageType>::New();
+  ImageType::SizeType size;
+  size.Fill(sideLength);
+  source->SetSize(size);
+  source->Update();
+
+  // One benchmark run per file format
+  const char * extensions[] = { ".mha", ".nrrd" };
+  for (const char * extension : extensions)
+  {
+    const std::string fileName = outputDirectory + "/ImageFileReaderBenchmark" + extension;
+
+    auto writer = itk::ImageFileWriter<ImageType>::New();
+    writer->SetInput(source->GetOutput());
+    writer->SetFileName(fileName);
+    writer->Update();
+
+    itk::Benchmark benchmark(std::string("ImageFileReader") + extension);
+    benchmark.SetParameter("size", static_cast<double>(sideLength));
+    benchmark.SetParameter("format", extension);
+    benchmark.SetParameter("pixel_type", "unsigned char");
+    benchmark.SetBytesProcessed(source->GetOutput()->GetLargestPossibleRegion().GetNumberOfPixels() *
+                                sizeof(unsigned char));
+
+    benchmark.Run(
+      [&fileName]() {
+        auto reader = itk::ImageFileReader<ImageType>::New();
+        reader->SetFileName(fileName);
+        reader->Update();
+      },
+      iterations);
+
+    const int status = benchmark.WriteReport((argc > 5) ? std::string(argv[5]) + extension : std::string(""));
+    if (status != EXIT_SUCCESS)
+    {
+      return status;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,84 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkBenchmark.h"
+#include "itkLinearInterpolateImageFunction.h"
+#include "itkMattesMutualInformationImageToImageMetric.h"
+#include "itkRandomImageSource.h"
+#include "itkTranslationTransform.h"
+
+#include <cstdlib>
+
+int
+itkMattesMutualInformationMetricBenchmark(int argc, char * argv[])
+{
+  const unsigned int sideLength = (argc > 1) ? std::atoi(argv[1]) : 64;
+  const unsigned int iterations = (argc > 2) ? std::atoi(argv[2]) : 3;
+  if (argc > 3)
+  {
+    itk::MultiThreaderBase::SetGlobalDefaultNumberOfThreads(std::atoi(argv[3]));
+  }
+
+  using ImageType = itk::Image<float, 3>;
+
+  ImageType::SizeType size;
+  size.Fill(sideLength);
+
+  auto fixedSource = itk::RandomImageSource<ImageType>::New();
+  fixedSource->SetSize(size);
+  fixedSource->Update();
+  ImageType::Pointer fixedImage = fixedSource->GetOutput();
+
+  auto movingSource = itk::RandomImageSource<ImageType>::New();
+  movingSource->SetSize(size);
+  movingSource->Update();
+  ImageType::Pointer movingImage = movingSource->GetOutput();
+
+  using TransformType = itk::TranslationTransform<double, 3>;
+  auto transform = TransformType::New();
+
+  auto interpolator = itk::LinearInterpolateImageFunction<ImageType, double>::New();
+
+  using MetricType = itk::MattesMutualInformationImageToImageMetric<ImageType, ImageType>;
+  auto metric = MetricType::New();
+  metric->SetFixedImage(fixedImage);
+  metric->SetMovingImage(movingImage);
+  metric->SetFixedImageRegion(fixedImage->GetLargestPossibleRegion());
+  metric->SetTransform(transform);
+  metric->SetInterpolator(interpolator);
+  metric->SetNumberOfHistogramBins(50);
+  metric->UseAllPixelsOn();
+  metric->Initialize();
+
+  MetricType::ParametersType parameters(transform->GetNumberOfParameters());
+  parameters.Fill(0.5);
+
+  itk::Benchmark benchmark("MattesMutualInformationImageToImageMetric");
+  benchmark.SetParameter("size", static_cast<double>(sideLength));
+  benchmark.SetParameter("histogram_bins", 50.0);
+  benchmark.SetParameter("pixel_type", "float");
+  benchmark.SetBytesProcessed(2 * fixedImage->GetLargestPossibleRegion().GetNumberOfPixels() * sizeof(float));
+
+  MetricType::MeasureType    value;
+  MetricType::DerivativeType derivative(transform->GetNumberOfParameters());
+  benchmark.Run([&metric, &parameters, &value, &derivative]() {
+    metric->GetValueAndDerivative(parameters, value, derivative);
+  }, iterations);
+
+  return benchmark.WriteReport((argc > 4) ? argv[4] : "");
+}
@@ -0,0 +1,64 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkBenchmark.h"
+#include "itkMedianImageFilter.h"
+#include "itkRandomImageSource.h"
+
+#include <cstdlib>
+
+int
+itkMedianImageFilterBenchmark(int argc, char * argv[])
+{
+  const unsigned int sideLength = (argc > 1) ? std::atoi(argv[1]) : 128;
+  const unsigned int iterations = (argc > 2) ? std::atoi(argv[2]) : 3;
+  if (argc > 3)
+  {
+    itk::MultiThreaderBase::SetGlobalDefaultNumberOfThreads(std::atoi(argv[3]));
+  }
+
+  using ImageType = itk::Image<unsigned char, 3>;
+
+  auto source = itk::RandomImageSource<ImageType>::New();
+  ImageType::SizeType size;
+  size.Fill(sideLength);
+  source->SetSize(size);
+  source->Update();
+  ImageType::Pointer input = source->GetOutput();
+
+  auto filter = itk::MedianImageFilter<ImageType, ImageType>::New();
+  filter->SetInput(input);
+  ImageType::SizeType radius;
+  radius.Fill(1);
+  filter->SetRadius(radius);
+
+  itk::Benchmark benchmark("MedianImageFilter");
+  benchmark.SetParameter("size", static_cast<double>(sideLength));
+  benchmark.SetParameter("radius", 1.0);
+  benchmark.SetParameter("pixel_type", "unsigned char");
+  benchmark.SetBytesProcessed(2 * input->GetLargestPossibleRegion().GetNumberOfPixels() * sizeof(unsigned char));
+
+  benchmark.Run(
+    [&filter]() {
+      filter->Modified();
+      filter->Update();
+    },
+    iterations);
+
+  return benchmark.WriteReport((argc > 4) ? argv[4] : "");
+}
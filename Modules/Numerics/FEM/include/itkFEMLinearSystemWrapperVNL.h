@@ -164,7 +164,7 @@ public:
   void
   MultiplyMatrixVector(unsigned int resultVectorIndex, unsigned int matrixIndex, unsigned int vectorIndex) override;
 
-private:
+protected:
   /** vector of pointers to VNL sparse matrices */
   // std::vector< vnl_sparse_matrix<Float>* > *m_Matrices;
   MatrixHolder * m_Matrices{ nullptr };
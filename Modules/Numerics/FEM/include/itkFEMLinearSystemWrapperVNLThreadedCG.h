@@ -0,0 +1,110 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#ifndef itkFEMLinearSystemWrapperVNLThreadedCG_h
+#define itkFEMLinearSystemWrapperVNLThreadedCG_h
+
+#include "itkFEMLinearSystemWrapperVNL.h"
+#include "ITKFEMExport.h"
+
+namespace itk
+{
+namespace fem
+{
+/**
+ * \class LinearSystemWrapperVNLThreadedCG
+ * \brief LinearSystemWrapperVNL variant that solves the system with a
+ *        conjugate-gradient iteration whose matrix-vector products are
+ *        threaded.
+ *
+ * The storage and the assembly interface are inherited from
+ * LinearSystemWrapperVNL. Solve() replaces the LSQR iteration of the
+ * superclass with the conjugate-gradient method; each sparse
+ * matrix-vector product is parallelized over the rows of the matrix
+ * through the MultiThreaderBase, while the scalar products are reduced
+ * serially so that the solution does not depend on the number of work
+ * units.
+ *
+ * The conjugate-gradient method requires the master matrix to be
+ * symmetric positive definite. This holds for the master stiffness
+ * matrix after the essential boundary conditions have been applied, but
+ * not for systems with Lagrange-multiplier multi-freedom constraints,
+ * which are indefinite; such systems should use LinearSystemWrapperVNL.
+ *
+ * \sa LinearSystemWrapperVNL
+ * \ingroup ITKFEM
+ */
+class ITKFEM_EXPORT LinearSystemWrapperVNLThreadedCG : public LinearSystemWrapperVNL
+{
+public:
+  /* values stored in matrices & vectors */
+  using Float = LinearSystemWrapperVNL::Float;
+
+  /* superclass */
+  using Superclass = LinearSystemWrapperVNL;
+
+  /* constructor & destructor */
+  LinearSystemWrapperVNLThreadedCG() = default;
+
+  ~LinearSystemWrapperVNLThreadedCG() override = default;
+
+  /**
+   * Set/Get the maximum number of conjugate-gradient iterations. A value
+   * of zero (the default) stands for three times the system order, which
+   * matches the iteration limit of the superclass.
+   */
+  void
+  SetMaximumNumberOfIterations(unsigned int n)
+  {
+    m_MaximumNumberOfIterations = n;
+  }
+  unsigned int
+  GetMaximumNumberOfIterations() const
+  {
+    return m_MaximumNumberOfIterations;
+  }
+
+  /**
+   * Set/Get the relative residual tolerance. The iteration stops once the
+   * norm of the residual has dropped below the tolerance times the norm
+   * of the right-hand side.
+   */
+  void
+  SetTolerance(Float tolerance)
+  {
+    m_Tolerance = tolerance;
+  }
+  Float
+  GetTolerance() const
+  {
+    return m_Tolerance;
+  }
+
+  /* solving routine */
+  void
+  Solve() override;
+
+private:
+  unsigned int m_MaximumNumberOfIterations{ 0 };
+
+  Float m_Tolerance{ 1e-8 };
+};
+} // end namespace fem
+} // end namespace itk
+
+#endif // itkFEMLinearSystemWrapperVNLThreadedCG_h
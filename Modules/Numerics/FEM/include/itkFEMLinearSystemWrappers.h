@@ -27,6 +27,7 @@
 #include "itkFEMLinearSystemWrapper.h"
 #include "itkFEMLinearSystemWrapperItpack.h"
 #include "itkFEMLinearSystemWrapperVNL.h"
+#include "itkFEMLinearSystemWrapperVNLThreadedCG.h"
 #include "itkFEMLinearSystemWrapperDenseVNL.h"
 
 #endif // itkFEMLinearSystemWrappers_h
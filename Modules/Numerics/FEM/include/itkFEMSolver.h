@@ -342,10 +342,35 @@ protected:
    * master stiffness matrix. Since more complex Solver classes may need to
    * assemble many matrices and may also do some funky stuff to them, this
    * function is and can be overriden in a derived solver class.
+   *
+   * \note AssembleK() no longer calls this function directly. It computes
+   *       the element matrices of all elements in parallel through
+   *       ComputeElementMatrices() and then scatters them in element order
+   *       through ScatterElementMatrices(); derived classes that need a
+   *       different assembly should override that pair of functions.
    */
   virtual void
   AssembleElementMatrix(Element::Pointer e);
 
+  /**
+   * Compute the matrices that AssembleK() assembles for one element. In
+   * this class this is the element stiffness matrix alone. AssembleK()
+   * invokes this function for different elements concurrently, so an
+   * override must not modify the element or any other shared state.
+   */
+  virtual void
+  ComputeElementMatrices(Element::ConstPointer e, std::vector<Element::MatrixType> & matrices) const;
+
+  /**
+   * Copy the precomputed matrices of one element into the correct
+   * positions in the master matrices. AssembleK() invokes this function
+   * serially and in element order, after the parallel
+   * ComputeElementMatrices() phase, so the assembled system is identical
+   * to an element-by-element assembly.
+   */
+  virtual void
+  ScatterElementMatrices(Element::Pointer e, const std::vector<Element::MatrixType> & matrices);
+
   /**
    * Add the contribution of the landmark-containing elements to the
    * correct position in the master stiffness matrix. Since more
@@ -28,6 +28,7 @@
 #include "itkFEMLoadLandmark.h"
 #include "itkTimeProbe.h"
 #include "itkImageRegionIterator.h"
+#include "itkMultiThreaderBase.h"
 
 #include <algorithm>
 #include "itkMath.h"
@@ -231,14 +232,26 @@ Solver<VDimension>::AssembleK()
 
   this->InitializeMatrixForAssembly(NGFN + NMFC);
 
-  // Step over all elements
+  // The assembly runs in two phases. The element matrices are computed
+  // in parallel first, since the numerical integration dominates the
+  // assembly time and only reads shared node, material and DOF data.
+  // They are then scattered into the master matrix serially and in
+  // element order, so the assembled system is identical to an
+  // element-by-element assembly.
   unsigned int numberOfElements = m_FEMObject->GetNumberOfElements();
+
+  std::vector<std::vector<Element::MatrixType>> elementMatrices(numberOfElements);
+  MultiThreaderBase::New()->ParallelizeArray(
+    0,
+    numberOfElements,
+    [this, &elementMatrices](SizeValueType i) {
+      this->ComputeElementMatrices(m_FEMObject->GetElement(i).GetPointer(), elementMatrices[i]);
+    },
+    nullptr);
+
   for (unsigned int i = 0; i < numberOfElements; ++i)
   {
-    // Call the function that actually moves the element matrix
-    // to the master matrix.
-    Element::Pointer e = m_FEMObject->GetElement(i);
-    this->AssembleElementMatrix(e);
+    this->ScatterElementMatrices(m_FEMObject->GetElement(i), elementMatrices[i]);
   }
 
   // Step over all the loads again to add the landmark contributions
@@ -306,10 +319,26 @@ template <unsigned int VDimension>
 void
 Solver<VDimension>::AssembleElementMatrix(Element::Pointer e)
 {
-  // Copy the element stiffness matrix for faster access.
-  Element::MatrixType Ke;
+  std::vector<Element::MatrixType> matrices;
+
+  this->ComputeElementMatrices(e.GetPointer(), matrices);
+  this->ScatterElementMatrices(e, matrices);
+}
+
+template <unsigned int VDimension>
+void
+Solver<VDimension>::ComputeElementMatrices(Element::ConstPointer e, std::vector<Element::MatrixType> & matrices) const
+{
+  // Only the element stiffness matrix is assembled in this class.
+  matrices.resize(1);
+  e->GetStiffnessMatrix(matrices[0]);
+}
 
-  e->GetStiffnessMatrix(Ke);
+template <unsigned int VDimension>
+void
+Solver<VDimension>::ScatterElementMatrices(Element::Pointer e, const std::vector<Element::MatrixType> & matrices)
+{
+  const Element::MatrixType & Ke = matrices[0];
 
   // Same for number of DOF
   int Ne = e->GetNumberOfDegreesOfFreedom();
@@ -95,10 +95,13 @@ protected:
 
   /**
    * When assembling the element matrix into master matrix, we
-   * need to assemble the mass matrix too.
+   * need to compute and assemble the mass matrix too.
    */
   void
-  AssembleElementMatrix(Element::Pointer e) override;
+  ComputeElementMatrices(Element::ConstPointer e, std::vector<Element::MatrixType> & matrices) const override;
+
+  void
+  ScatterElementMatrices(Element::Pointer e, const std::vector<Element::MatrixType> & matrices) override;
 
   /** Initialize the storage for all master matrices. */
   void
@@ -51,13 +51,23 @@ SolverHyperbolic<VDimension>::InitializeLinearSystemWrapper()
 
 template <unsigned int VDimension>
 void
-SolverHyperbolic<VDimension>::AssembleElementMatrix(Element::Pointer e)
+SolverHyperbolic<VDimension>::ComputeElementMatrices(Element::ConstPointer              e,
+                                                     std::vector<Element::MatrixType> & matrices) const
 {
-  // Copy the element stiffness matrix for faster access.
-  Element::MatrixType Ke;
-  e->GetStiffnessMatrix(Ke);
-  Element::MatrixType Me;
-  e->GetMassMatrix(Me);
+  // Both the element stiffness matrix and the element mass matrix are
+  // assembled for hyperbolic problems.
+  matrices.resize(2);
+  e->GetStiffnessMatrix(matrices[0]);
+  e->GetMassMatrix(matrices[1]);
+}
+
+template <unsigned int VDimension>
+void
+SolverHyperbolic<VDimension>::ScatterElementMatrices(Element::Pointer                         e,
+                                                     const std::vector<Element::MatrixType> & matrices)
+{
+  const Element::MatrixType & Ke = matrices[0];
+  const Element::MatrixType & Me = matrices[1];
 
   // ... same for number of DOF
   int Ne = e->GetNumberOfDegreesOfFreedom();
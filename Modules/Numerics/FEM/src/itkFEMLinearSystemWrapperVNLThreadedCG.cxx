@@ -0,0 +1,112 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkFEMLinearSystemWrapperVNLThreadedCG.h"
+#include "itkMultiThreaderBase.h"
+#include <cmath>
+
+namespace itk
+{
+namespace fem
+{
+
+void
+LinearSystemWrapperVNLThreadedCG::Solve()
+{
+  if ((m_Matrices->empty()) || (m_Vectors->empty()) || (m_Solutions->empty()))
+  {
+    itkGenericExceptionMacro(
+      << "LinearSystemWrapperVNLThreadedCG::Solve(): m_Matrices, m_Vectors and m_Solutions size's are all zero.");
+  }
+
+  MatrixRepresentation &    A = *((*m_Matrices)[0]);
+  const vnl_vector<Float> & b = *((*m_Vectors)[0]);
+  vnl_vector<Float> &       x = *((*m_Solutions)[0]);
+
+  const unsigned int order = this->GetSystemOrder();
+
+  unsigned int maximumNumberOfIterations = m_MaximumNumberOfIterations;
+  if (maximumNumberOfIterations == 0)
+  {
+    // matches the iteration limit used by the LSQR solve of the superclass
+    maximumNumberOfIterations = 3 * order;
+  }
+
+  auto threader = MultiThreaderBase::New();
+
+  // The sparse matrix-vector product is the dominant cost of the
+  // conjugate-gradient iteration; each row product only reads the shared
+  // operand vector and writes its own result component, so the rows are
+  // distributed over the work units.
+  vnl_vector<Float> q(order);
+
+  const auto multiply = [&threader, &A, &q](const vnl_vector<Float> & p) {
+    threader->ParallelizeArray(
+      0,
+      q.size(),
+      [&A, &p, &q](SizeValueType r) {
+        Float sum = 0.0;
+        for (const auto & entry : A.get_row(static_cast<unsigned int>(r)))
+        {
+          sum += entry.second * p[entry.first];
+        }
+        q[r] = sum;
+      },
+      nullptr);
+  };
+
+  x.set_size(order);
+  x.fill(0.0);
+
+  vnl_vector<Float> residual = b;
+  vnl_vector<Float> direction = residual;
+
+  const Float absoluteTolerance = m_Tolerance * b.two_norm();
+
+  // The scalar products below are reduced serially and in row order, so
+  // the computed solution does not depend on the number of work units.
+  Float rho = dot_product(residual, residual);
+
+  for (unsigned int iteration = 0; iteration < maximumNumberOfIterations; ++iteration)
+  {
+    if (std::sqrt(rho) <= absoluteTolerance)
+    {
+      break;
+    }
+
+    multiply(direction);
+
+    const Float curvature = dot_product(direction, q);
+    if (curvature <= 0.0)
+    {
+      itkGenericExceptionMacro(<< "LinearSystemWrapperVNLThreadedCG::Solve(): the master matrix is not positive "
+                                  "definite. Use LinearSystemWrapperVNL for indefinite systems.");
+    }
+
+    const Float alpha = rho / curvature;
+    x += alpha * direction;
+    residual -= alpha * q;
+
+    const Float rhoNew = dot_product(residual, residual);
+    direction = residual + (rhoNew / rho) * direction;
+    rho = rhoNew;
+  }
+}
+
+} // end namespace fem
+} // end namespace itk
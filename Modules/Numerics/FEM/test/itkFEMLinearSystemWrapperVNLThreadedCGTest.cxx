@@ -0,0 +1,140 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkFEMLinearSystemWrapperVNL.h"
+#include "itkFEMLinearSystemWrapperVNLThreadedCG.h"
+#include <cmath>
+#include <iostream>
+
+/* Testing the threaded conjugate-gradient linear system wrapper against
+ * the LSQR-based one on a symmetric positive definite system */
+int
+itkFEMLinearSystemWrapperVNLThreadedCGTest(int, char *[])
+{
+
+  /* loop vars for printing */
+  unsigned int i;
+  unsigned int j;
+
+  /* declare wrappers */
+  itk::fem::LinearSystemWrapperVNL           reference;
+  itk::fem::LinearSystemWrapperVNLThreadedCG it;
+
+  it.SetTolerance(1e-12);
+  if (it.GetTolerance() != 1e-12)
+  {
+    std::cout << "ERROR: GetTolerance" << std::endl;
+    return EXIT_FAILURE;
+  }
+  it.SetMaximumNumberOfIterations(100);
+  if (it.GetMaximumNumberOfIterations() != 100)
+  {
+    std::cout << "ERROR: GetMaximumNumberOfIterations" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  /* system parameters */
+  unsigned int N = 5;
+
+  /* Set up both systems */
+  reference.SetSystemOrder(N);
+  reference.SetNumberOfMatrices(1);
+  reference.SetNumberOfVectors(1);
+  reference.SetNumberOfSolutions(1);
+  reference.InitializeMatrix(0);
+  reference.InitializeVector(0);
+  reference.InitializeSolution(0);
+
+  it.SetSystemOrder(N);
+  it.SetNumberOfMatrices(1);
+  it.SetNumberOfVectors(1);
+  it.SetNumberOfSolutions(1);
+  it.InitializeMatrix(0);
+  it.InitializeVector(0);
+  it.InitializeSolution(0);
+
+  /*     matrix 0 (symmetric positive definite)
+   * |11  0  0 14 15|
+   * | 0 22  0  0  0|
+   * | 0  0 33  0  0|
+   * |14  0  0 44 45|
+   * |15  0  0 45 55|
+   */
+  for (i = 0; i < N; ++i)
+  {
+    reference.SetMatrixValue(i, i, 11.0 * (i + 1), 0);
+    it.SetMatrixValue(i, i, 11.0 * (i + 1), 0);
+  }
+  reference.SetMatrixValue(0, 3, 14, 0);
+  reference.SetMatrixValue(0, 4, 15, 0);
+  reference.SetMatrixValue(3, 0, 14, 0);
+  reference.SetMatrixValue(3, 4, 45, 0);
+  reference.SetMatrixValue(4, 0, 15, 0);
+  reference.SetMatrixValue(4, 3, 45, 0);
+  it.SetMatrixValue(0, 3, 14, 0);
+  it.SetMatrixValue(0, 4, 15, 0);
+  it.SetMatrixValue(3, 0, 14, 0);
+  it.SetMatrixValue(3, 4, 45, 0);
+  it.SetMatrixValue(4, 0, 15, 0);
+  it.SetMatrixValue(4, 3, 45, 0);
+
+  /* Vector 0 = [1 2 3 4 5] */
+  for (i = 0; i < N; ++i)
+  {
+    reference.SetVectorValue(i, i + 1.0, 0);
+    it.SetVectorValue(i, i + 1.0, 0);
+  }
+
+  /* print matrix 0 */
+  std::cout << "Matrix 0" << std::endl;
+  for (i = 0; i < N; ++i)
+  {
+    for (j = 0; j < N; ++j)
+    {
+      std::cout << it.GetMatrixValue(i, j, 0) << " ";
+    }
+    std::cout << std::endl;
+  }
+  std::cout << std::endl;
+
+  /* solve with both wrappers */
+  reference.Solve();
+  it.Solve();
+
+  std::cout << "Solution" << std::endl;
+  for (i = 0; i < N; ++i)
+  {
+    std::cout << it.GetSolutionValue(i, 0) << " ";
+  }
+  std::cout << std::endl << std::endl;
+
+  /* the conjugate-gradient solution must match the LSQR one */
+  for (i = 0; i < N; ++i)
+  {
+    if (std::fabs(it.GetSolutionValue(i, 0) - reference.GetSolutionValue(i, 0)) > 1e-6)
+    {
+      std::cout << "ERROR: solution component " << i << " is " << it.GetSolutionValue(i, 0) << ", expected "
+                << reference.GetSolutionValue(i, 0) << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  std::cout << "Done" << std::endl;
+
+  return EXIT_SUCCESS;
+}
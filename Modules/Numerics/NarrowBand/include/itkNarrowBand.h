@@ -21,6 +21,7 @@
 #include "itkLightObject.h"
 #include "itkObjectFactory.h"
 #include "itkNumericTraits.h"
+#include <algorithm>
 #include <vector>
 
 namespace itk
@@ -86,6 +87,14 @@ public:
 
 #endif
 
+  /** Sort the nodes of the band by their index, in the raster order of
+   * the image buffer (the first index component varies fastest). The
+   * band filters visit the image through the node indices, so a sorted
+   * band turns the scattered pixel accesses of a band sweep into an
+   * ordered walk over the image buffer. */
+  void
+  SortByIndex();
+
   Iterator
   Begin()
   {
@@ -193,6 +202,24 @@ protected:
   float m_InnerRadius{ 0.0 };
 
 private:
+  /** Compare two indices in the raster order of the image buffer. The
+   * first overload handles array-like index types such as itk::Index,
+   * whose last component varies slowest in the buffer; the second one
+   * handles scalar index types. */
+  template <typename TIndex>
+  static auto
+  IndexIsLess(const TIndex & a, const TIndex & b, int) -> decltype(a.rbegin(), bool())
+  {
+    return std::lexicographical_compare(a.rbegin(), a.rend(), b.rbegin(), b.rend());
+  }
+
+  template <typename TIndex>
+  static bool
+  IndexIsLess(const TIndex & a, const TIndex & b, long)
+  {
+    return a < b;
+  }
+
   NodeContainerType m_NodeContainer;
 };
 } // end namespace itk
@@ -77,6 +77,15 @@ NarrowBand<NodeType>::SplitBand(const SizeType & n)
 }
 
 #endif
+
+template <typename NodeType>
+void
+NarrowBand<NodeType>::SortByIndex()
+{
+  std::sort(m_NodeContainer.begin(), m_NodeContainer.end(), [](const NodeType & a, const NodeType & b) {
+    return Self::IndexIsLess(a.m_Index, b.m_Index, 0);
+  });
+}
 } // end namespace itk
 
 #endif
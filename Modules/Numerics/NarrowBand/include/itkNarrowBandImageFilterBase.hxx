@@ -180,6 +180,11 @@ NarrowBandImageFilterBase<TInputImage, TOutputImage>::Initialize()
   // It should use the InsertNarrowBandNode function, which takes care of
   // memory management issues, to create the desired narrow band.
 
+  // Sort the band nodes into the raster order of the image buffer, so
+  // that the band sweeps of the threads walk the output image in memory
+  // order instead of the insertion order of the band creation.
+  m_NarrowBand->SortByIndex();
+
   m_RegionList = m_NarrowBand->SplitBand(this->GetNumberOfWorkUnits());
 
   // The narrow band is split into multi-threading regions once here for
@@ -209,6 +214,9 @@ NarrowBandImageFilterBase<TInputImage, TOutputImage>::InitializeIteration()
     // Reinitialize the narrowband properly
     CreateNarrowBand();
 
+    // Restore the raster order of the rebuilt band
+    m_NarrowBand->SortByIndex();
+
     // Rebuild the narrow band splits used in multithreading
     m_RegionList = m_NarrowBand->SplitBand(this->GetNumberOfWorkUnits());
 
@@ -17,6 +17,7 @@
  *=========================================================================*/
 
 #include "itkNarrowBand.h"
+#include "itkIndex.h"
 
 
 int
@@ -75,6 +76,48 @@ itkNarrowBandTest(int, char *[])
       std::cout << "Index: " << regions[i].Begin->m_Index << " Data: " << regions[i].Begin->m_Data << std::endl;
     i++;
   }
+  // Sort a band with scalar indices
+  auto scalarBand = BandType::New();
+  for (i = 0; i < 20; ++i)
+  {
+    node.m_Data = i * 5.0;
+    node.m_Index = 19 - i;
+    scalarBand->PushBack(node);
+  }
+  scalarBand->SortByIndex();
+  for (i = 0; i < 20; ++i)
+  {
+    if ((*scalarBand)[i].m_Index != i)
+    {
+      std::cout << "Scalar band not sorted at position " << i << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Sort a band with image indices; the first index component must vary
+  // fastest after sorting, matching the raster order of an image buffer
+  using ImageBandNodeType = itk::BandNode<itk::Index<2>, DataType>;
+  using ImageBandType = itk::NarrowBand<ImageBandNodeType>;
+
+  auto              imageBand = ImageBandType::New();
+  ImageBandNodeType imageNode;
+  for (i = 0; i < 6; ++i)
+  {
+    imageNode.m_Index[0] = static_cast<itk::IndexValueType>(i % 2);
+    imageNode.m_Index[1] = static_cast<itk::IndexValueType>(2 - i / 2);
+    imageBand->PushBack(imageNode);
+  }
+  imageBand->SortByIndex();
+  for (i = 0; i < 6; ++i)
+  {
+    if ((*imageBand)[i].m_Index[0] != static_cast<itk::IndexValueType>(i % 2) ||
+        (*imageBand)[i].m_Index[1] != static_cast<itk::IndexValueType>(i / 2))
+    {
+      std::cout << "Image band not sorted at position " << i << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
   std::cout << "Test Passed. " << std::endl;
   return EXIT_SUCCESS;
 }
@@ -108,98 +108,85 @@ GradientDescentLineSearchOptimizerv4Template<TInternalComputationValueType>::Gol
   TInternalComputationValueType c,
   TInternalComputationValueType metricb)
 {
-  itkDebugMacro("GoldenSectionSearch: " << a << " " << b << " " << c << " " << metricb);
-
-  if (this->m_LineSearchIterations > this->m_MaximumLineSearchIterations)
-  {
-    return (c + a) / 2;
-  }
-  this->m_LineSearchIterations++;
-
-  TInternalComputationValueType x;
-  if (c - b > b - a)
-  {
-    x = b + this->m_Resphi * (c - b);
-  }
-  else
-  {
-    x = b - this->m_Resphi * (b - a);
-  }
-  if (std::abs(c - a) < this->m_Epsilon * (std::abs(b) + std::abs(x)))
+  /* Cache the parameters once for the whole search.  Each probe applies
+   * the candidate step length through the update factor and restores this
+   * position afterwards, so neither m_Gradient nor m_LearningRate is
+   * modified during the search.  With dense transforms the previous
+   * per-probe gradient and parameter copies dominated the line search
+   * cost.  Not const because the metric's SetParameters() takes a
+   * non-const reference. */
+  ParametersType baseParameters(this->GetCurrentPosition());
+
+  while (true)
   {
-    return (c + a) / 2;
-  }
-
-  TInternalComputationValueType metricx;
-
-  {
-    // Cache the learning rate , parameters , gradient
-    // Contain this in a block so these variables go out of
-    // scope before we call recursively below. With dense transforms
-    // we would otherwise eat up a lot of memory unnecessarily.
-    TInternalComputationValueType baseLearningRate = this->m_LearningRate;
-    DerivativeType                baseGradient(this->m_Gradient);
-    ParametersType                baseParameters(this->GetCurrentPosition());
-
-    this->m_LearningRate = x;
-    this->ModifyGradientByLearningRate();
-    this->m_Metric->UpdateTransformParameters(this->m_Gradient);
-    metricx = this->GetMetric()->GetValue();
-
-    /** reset position of transform and gradient */
-    this->m_Metric->SetParameters(baseParameters);
-    this->m_Gradient = baseGradient;
+    itkDebugMacro("GoldenSectionSearch: " << a << " " << b << " " << c << " " << metricb);
 
-    if (metricb == NumericTraits<TInternalComputationValueType>::max())
+    if (this->m_LineSearchIterations > this->m_MaximumLineSearchIterations)
     {
-      this->m_LearningRate = b;
-      this->ModifyGradientByLearningRate();
-
-      this->m_Metric->UpdateTransformParameters(this->m_Gradient);
-      metricb = this->GetMetric()->GetValue();
-
-      /** reset position of transform and learning rate */
-      this->m_Metric->SetParameters(baseParameters);
-      this->m_Gradient = baseGradient;
-      this->m_LearningRate = baseLearningRate;
+      return (c + a) / 2;
     }
-  }
+    this->m_LineSearchIterations++;
 
-  /** golden section */
-  if (metricx < metricb)
-  {
+    TInternalComputationValueType x;
     if (c - b > b - a)
     {
-      return this->GoldenSectionSearch(b, x, c, metricx);
+      x = b + this->m_Resphi * (c - b);
     }
     else
     {
-      return this->GoldenSectionSearch(a, x, b, metricx);
+      x = b - this->m_Resphi * (b - a);
     }
-  }
-  else
-  {
-    if (c - b > b - a)
+    if (std::abs(c - a) < this->m_Epsilon * (std::abs(b) + std::abs(x)))
     {
-      return this->GoldenSectionSearch(a, b, x, metricb);
+      return (c + a) / 2;
     }
-    else if (metricx == NumericTraits<TInternalComputationValueType>::max())
+
+    /* Step to the candidate position by passing the step length as the
+     * update factor, evaluate, and step back. */
+    this->m_Metric->UpdateTransformParameters(this->m_Gradient, x);
+    const TInternalComputationValueType metricx = this->GetMetric()->GetValue();
+    this->m_Metric->SetParameters(baseParameters);
+
+    if (metricb == NumericTraits<TInternalComputationValueType>::max())
     {
-      // Keep the lower bounds when metricx and metricb are both max,
-      // likely due to no valid sample points, from too large of a
-      // learning rate.
-      return this->GoldenSectionSearch(a, x, b, metricx);
+      this->m_Metric->UpdateTransformParameters(this->m_Gradient, b);
+      metricb = this->GetMetric()->GetValue();
+      this->m_Metric->SetParameters(baseParameters);
     }
-    else if (metricx == NumericTraits<TInternalComputationValueType>::max())
+
+    /** golden section */
+    if (metricx < metricb)
     {
-      // Keep the lower bounds when metricx and metricb are both max,
-      // likely due to no valid sample points, from too large of a
-      // learning rate.
-      return this->GoldenSectionSearch(a, x, b);
+      if (c - b > b - a)
+      {
+        a = b;
+      }
+      else
+      {
+        c = b;
+      }
+      b = x;
+      metricb = metricx;
     }
     else
     {
-      return this->GoldenSectionSearch(x, b, c, metricb);
+      if (c - b > b - a)
+      {
+        c = x;
+      }
+      else if (metricx == NumericTraits<TInternalComputationValueType>::max())
+      {
+        // Keep the lower bounds when metricx and metricb are both max,
+        // likely due to no valid sample points, from too large of a
+        // learning rate.
+        c = b;
+        b = x;
+        metricb = metricx;
+      }
+      else
+      {
+        a = x;
+      }
     }
   }
 }
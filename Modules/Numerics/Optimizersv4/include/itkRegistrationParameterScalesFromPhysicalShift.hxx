@@ -19,6 +19,7 @@
 #define itkRegistrationParameterScalesFromPhysicalShift_hxx
 
 #include "itkRegistrationParameterScalesFromPhysicalShift.h"
+#include "itkMultiThreaderBase.h"
 
 namespace itk
 {
@@ -54,32 +55,40 @@ RegistrationParameterScalesFromPhysicalShift<TMetric>::ComputeSampleShiftsIntern
 
   const auto numSamples = static_cast<const SizeValueType>(this->m_SamplePoints.size());
 
-  VirtualPointType    point;
-  TransformOutputType newMappedVoxel;
-
   // store the old mapped indices to reduce calls to Transform::SetParameters()
   std::vector<TransformOutputType> oldMappedVoxels(numSamples);
   sampleShifts.SetSize(numSamples);
 
+  // Each sample is mapped independently, with only const access to the
+  // transform, so the mapping may be distributed over the threads of the
+  // MultiThreader. Every sample writes its own element of the output, so the
+  // result is identical to that of a serial loop.
+  MultiThreaderBase::Pointer threader = MultiThreaderBase::New();
+
   // compute the indices mapped by the old transform
-  for (SizeValueType c = 0; c < numSamples; ++c)
-  {
-    point = this->m_SamplePoints[c];
-    this->template TransformPoint<TransformOutputType>(point, oldMappedVoxels[c]);
-  }
+  threader->ParallelizeArray(
+    0,
+    numSamples,
+    [this, &oldMappedVoxels](SizeValueType c) {
+      this->template TransformPoint<TransformOutputType>(this->m_SamplePoints[c], oldMappedVoxels[c]);
+    },
+    nullptr);
 
   // Apply the delta parameters to the transform
   this->UpdateTransformParameters(deltaParameters);
 
   // compute the indices mapped by the new transform
-  for (SizeValueType c = 0; c < numSamples; ++c)
-  {
-    point = this->m_SamplePoints[c];
-    this->template TransformPoint<TransformOutputType>(point, newMappedVoxel);
-
-    // find the local shift for each sample point
-    sampleShifts[c] = newMappedVoxel.EuclideanDistanceTo(oldMappedVoxels[c]);
-  }
+  threader->ParallelizeArray(
+    0,
+    numSamples,
+    [this, &oldMappedVoxels, &sampleShifts](SizeValueType c) {
+      TransformOutputType newMappedVoxel;
+      this->template TransformPoint<TransformOutputType>(this->m_SamplePoints[c], newMappedVoxel);
+
+      // find the local shift for each sample point
+      sampleShifts[c] = newMappedVoxel.EuclideanDistanceTo(oldMappedVoxels[c]);
+    },
+    nullptr);
 
   // restore the parameters in the transform
   transform->SetParameters(oldParameters);
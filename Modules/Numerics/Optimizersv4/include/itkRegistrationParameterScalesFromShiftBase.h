@@ -61,6 +61,7 @@ public:
   /** Type of parameters of the optimizer */
   using typename Superclass::ParametersType;
   using ParametersValueType = typename ParametersType::ValueType;
+  using FixedParametersType = typename TransformBaseTemplate<typename TMetric::MeasureType>::FixedParametersType;
   /** Type of float */
   using typename Superclass::FloatType;
 
@@ -87,6 +88,17 @@ public:
   itkSetMacro(SmallParameterVariation, ParametersValueType);
   itkGetConstMacro(SmallParameterVariation, ParametersValueType);
 
+  /** With caching enabled, EstimateScales() reuses the previously estimated
+   * scales as long as the transform parameters, the virtual domain and the
+   * estimation settings are unchanged. This avoids repeating the costly
+   * sampling of the virtual domain when a registration method re-initializes
+   * its optimizer without changing the transform. Note that with random
+   * sampling a cache hit returns the scales of the previous random draw
+   * instead of estimating from a new one. On by default. */
+  itkSetMacro(UseCachedScales, bool);
+  itkGetConstMacro(UseCachedScales, bool);
+  itkBooleanMacro(UseCachedScales);
+
 protected:
   RegistrationParameterScalesFromShiftBase();
   ~RegistrationParameterScalesFromShiftBase() override = default;
@@ -108,6 +120,18 @@ private:
   // A small variation of parameters
   ParametersValueType m_SmallParameterVariation;
 
+  /** The scales of the last estimation, together with the state of the
+   * inputs they were estimated from (see EstimateScales). */
+  bool                m_UseCachedScales;
+  bool                m_CachedScalesValid;
+  ScalesType          m_CachedScales;
+  const void *        m_CachedScalesTransform;
+  ParametersType      m_CachedScalesTransformParameters;
+  FixedParametersType m_CachedScalesTransformFixedParameters;
+  ModifiedTimeType    m_CachedScalesVirtualDomainTime;
+  bool                m_CachedScalesTransformForward;
+  ParametersValueType m_CachedScalesParameterVariation;
+
 }; // class RegistrationParameterScalesFromShiftBase
 
 
@@ -27,6 +27,12 @@ template <typename TMetric>
 RegistrationParameterScalesFromShiftBase<TMetric>::RegistrationParameterScalesFromShiftBase()
 {
   this->m_SmallParameterVariation = 0.01;
+  this->m_UseCachedScales = true;
+  this->m_CachedScalesValid = false;
+  this->m_CachedScalesTransform = nullptr;
+  this->m_CachedScalesVirtualDomainTime = 0;
+  this->m_CachedScalesTransformForward = true;
+  this->m_CachedScalesParameterVariation = 0.01;
 }
 
 /** Compute parameter scales */
@@ -35,6 +41,26 @@ void
 RegistrationParameterScalesFromShiftBase<TMetric>::EstimateScales(ScalesType & parameterScales)
 {
   this->CheckAndSetInputs();
+
+  // The estimation below temporarily perturbs and then restores the transform
+  // parameters, which updates the transform's modified time without changing
+  // its state. The cache is therefore keyed on the parameter values themselves
+  // (and on the virtual domain and the estimation settings), so that a
+  // re-initialization with an unchanged transform reuses the previous scales.
+  const TransformBaseTemplate<typename TMetric::MeasureType> * transform = this->GetTransform();
+  const ModifiedTimeType virtualDomainTime = this->m_Metric->GetVirtualDomainTimeStamp().GetMTime();
+
+  if (this->m_UseCachedScales && this->m_CachedScalesValid && transform == this->m_CachedScalesTransform &&
+      virtualDomainTime == this->m_CachedScalesVirtualDomainTime &&
+      this->GetTransformForward() == this->m_CachedScalesTransformForward &&
+      Math::ExactlyEquals(this->m_SmallParameterVariation, this->m_CachedScalesParameterVariation) &&
+      this->m_CachedScalesTransformParameters == transform->GetParameters() &&
+      this->m_CachedScalesTransformFixedParameters == transform->GetFixedParameters())
+  {
+    parameterScales = this->m_CachedScales;
+    return;
+  }
+
   this->SetScalesSamplingStrategy();
   this->SampleVirtualDomain();
 
@@ -117,6 +143,17 @@ RegistrationParameterScalesFromShiftBase<TMetric>::EstimateScales(ScalesType & p
       }
     }
   }
+
+  // Record the state the scales were estimated from. The transform parameters
+  // have been restored to their original values at this point.
+  this->m_CachedScales = parameterScales;
+  this->m_CachedScalesTransform = transform;
+  this->m_CachedScalesTransformParameters = transform->GetParameters();
+  this->m_CachedScalesTransformFixedParameters = transform->GetFixedParameters();
+  this->m_CachedScalesVirtualDomainTime = virtualDomainTime;
+  this->m_CachedScalesTransformForward = this->GetTransformForward();
+  this->m_CachedScalesParameterVariation = this->m_SmallParameterVariation;
+  this->m_CachedScalesValid = true;
 }
 
 /** Compute the scale for a step. For transform T(x + t * step), the scale
@@ -227,6 +264,9 @@ void
 RegistrationParameterScalesFromShiftBase<TMetric>::PrintSelf(std::ostream & os, Indent indent) const
 {
   Superclass::PrintSelf(os, indent);
+
+  os << indent << "m_SmallParameterVariation = " << this->m_SmallParameterVariation << std::endl;
+  os << indent << "m_UseCachedScales = " << this->m_UseCachedScales << std::endl;
 }
 
 } // namespace itk
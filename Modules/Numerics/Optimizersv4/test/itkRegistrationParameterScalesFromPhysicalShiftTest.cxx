@@ -171,6 +171,41 @@ itkRegistrationParameterScalesFromPhysicalShiftTest(int, char *[])
   shiftScaleEstimator->EstimateScales(movingScales);
   std::cout << "Shift scales for the affine transform = " << movingScales << std::endl;
 
+  //
+  // Testing the caching of the estimated scales: estimating again without
+  // changing the transform or the virtual domain returns the cached scales,
+  // and estimating with caching disabled recomputes the same scales.
+  //
+  bool cachePass = shiftScaleEstimator->GetUseCachedScales();
+
+  RegistrationParameterScalesFromPhysicalShiftType::ScalesType cachedMovingScales(
+    movingTransform->GetNumberOfParameters());
+  shiftScaleEstimator->EstimateScales(cachedMovingScales);
+
+  shiftScaleEstimator->UseCachedScalesOff();
+  RegistrationParameterScalesFromPhysicalShiftType::ScalesType uncachedMovingScales(
+    movingTransform->GetNumberOfParameters());
+  shiftScaleEstimator->EstimateScales(uncachedMovingScales);
+  shiftScaleEstimator->UseCachedScalesOn();
+
+  for (itk::SizeValueType p = 0; p < movingScales.GetSize(); ++p)
+  {
+    if (itk::Math::NotExactlyEquals(cachedMovingScales[p], movingScales[p]) ||
+        itk::Math::NotExactlyEquals(uncachedMovingScales[p], movingScales[p]))
+    {
+      cachePass = false;
+      break;
+    }
+  }
+  if (!cachePass)
+  {
+    std::cout << "Failed: the cached shift scales are not correct." << std::endl;
+  }
+  else
+  {
+    std::cout << "Passed: the cached shift scales are correct." << std::endl;
+  }
+
   // determine truth
   RegistrationParameterScalesFromPhysicalShiftType::ScalesType theoreticalMovingScales(
     movingTransform->GetNumberOfParameters());
@@ -380,8 +415,8 @@ itkRegistrationParameterScalesFromPhysicalShiftTest(int, char *[])
   // Check the correctness of all cases above
   //
   std::cout << std::endl;
-  if (affinePass && nonUniformForAffine && stepScalePass && displacementPass && localStepScalePass && translationPass &&
-      uniformForTranslation)
+  if (affinePass && nonUniformForAffine && cachePass && stepScalePass && displacementPass && localStepScalePass &&
+      translationPass && uniformForTranslation)
   {
     std::cout << "Test passed" << std::endl;
     return EXIT_SUCCESS;
@@ -207,6 +207,16 @@ public:
     return 0;
   }
 
+  /** Evaluates the polynomial at all points of the scanline that starts
+   * at the given index and runs along the first dimension. The results
+   * vector is resized to the domain size of the first dimension. The
+   * values are computed from a per-axis basis table that caches the
+   * Legendre polynomials at every position of the first dimension, so
+   * each value is a short dot product instead of a Clenshaw recurrence;
+   * the values may differ from Evaluate() by floating-point rounding. */
+  void
+  EvaluateRow(IndexType & index, DoubleArrayType & results);
+
   /** Gets the number of coefficients. */
   unsigned int
   GetNumberOfCoefficients(unsigned int dimension, unsigned int degree);
@@ -226,6 +236,7 @@ public:
       , m_Dimension(m_MultivariateLegendrePolynomial->GetDimension())
       , m_DomainSize(m_MultivariateLegendrePolynomial->GetDomainSize())
       , m_IsAtEnd(false)
+      , m_RowIsCached(false)
     {
       m_Index.resize(m_Dimension);
       std::fill(m_Index.begin(), m_Index.end(), 0);
@@ -235,6 +246,7 @@ public:
     Begin()
     {
       m_IsAtEnd = false;
+      m_RowIsCached = false;
       for (unsigned int dim = 0; dim < m_Dimension; ++dim)
       {
         m_Index[dim] = 0;
@@ -267,6 +279,10 @@ public:
           else
           {
             m_Index[dim] = 0;
+            if (dim == 0)
+            {
+              m_RowIsCached = false;
+            }
           }
         }
       }
@@ -276,7 +292,15 @@ public:
     double
     Get()
     {
-      return m_MultivariateLegendrePolynomial->Evaluate(m_Index);
+      // The whole scanline is evaluated at once when the iterator enters
+      // a new row, so the forward sweep over the domain reduces to a
+      // buffered read per point.
+      if (!m_RowIsCached)
+      {
+        m_MultivariateLegendrePolynomial->EvaluateRow(m_Index, m_RowBuffer);
+        m_RowIsCached = true;
+      }
+      return m_RowBuffer[m_Index[0]];
     }
 
   private:
@@ -285,6 +309,8 @@ public:
     DomainSizeType                   m_DomainSize;
     IndexType                        m_Index;
     bool                             m_IsAtEnd;
+    bool                             m_RowIsCached;
+    DoubleArrayType                  m_RowBuffer;
   }; // end of class Iterator
 
   void
@@ -314,6 +340,12 @@ private:
   CoefficientArrayType m_CachedYCoef;
   CoefficientArrayType m_CachedZCoef;
 
+  /** Legendre polynomials of degree 0 .. m_Degree, tabulated at every
+   * position of the first dimension; the values of one position are
+   * contiguous. The table only depends on the domain size and the
+   * degree, so it is filled once at construction. */
+  DoubleArrayType m_CachedXBasis;
+
   DoubleArrayType m_NormFactor;
   IndexValueType  m_PrevY;
   IndexValueType  m_PrevZ;
@@ -54,6 +54,26 @@ MultivariateLegendrePolynomial::MultivariateLegendrePolynomial(unsigned int
   {
     m_NormFactor[j] = 2.0f / (static_cast<double>(m_DomainSize[j]) - 1.0f);
   }
+
+  // tabulate the Legendre polynomials at every position of the first
+  // dimension; the table only depends on the domain size and the degree
+  m_CachedXBasis.resize((m_Degree + 1) * m_DomainSize[0]);
+  double * basis = m_CachedXBasis.data();
+  for (unsigned long x = 0; x < m_DomainSize[0]; ++x, basis += (m_Degree + 1))
+  {
+    // normalized x [-1, 1], as in Evaluate()
+    const double norm_x = m_NormFactor[0] * static_cast<double>(static_cast<long>(x) - 1);
+
+    basis[0] = 1.0;
+    if (m_Degree >= 1)
+    {
+      basis[1] = norm_x;
+    }
+    for (unsigned int k = 2; k <= m_Degree; ++k)
+    {
+      basis[k] = (norm_x * basis[k - 1] * (2 * k - 1) - basis[k - 2] * (k - 1)) / k;
+    }
+  }
 }
 
 MultivariateLegendrePolynomial::~MultivariateLegendrePolynomial() = default;
@@ -225,6 +245,56 @@ MultivariateLegendrePolynomial::LegendreSum(const double x, int n, const Coeffic
   return -ykp2 / 2 + x * ykp1 + coef[offset];
 }
 
+void
+MultivariateLegendrePolynomial::EvaluateRow(IndexType & index, DoubleArrayType & results)
+{
+  // refresh the y/z coefficient caches exactly as Evaluate() does
+  if (m_Dimension == 3)
+  {
+    if (index[2] != m_PrevZ)
+    {
+      // normalized z [-1, 1]
+      double norm_z = m_NormFactor[2] * static_cast<double>(index[2] - 1);
+      this->CalculateYCoef(norm_z, m_CoefficientArray);
+      m_PrevZ = index[2];
+    }
+
+    if (index[1] != m_PrevY)
+    {
+      // normalized y [-1, 1]
+      double norm_y = m_NormFactor[1] * static_cast<double>(index[1] - 1);
+      this->CalculateXCoef(norm_y, m_CachedYCoef);
+      m_PrevY = index[1];
+    }
+  }
+  else
+  {
+    if (index[1] != m_PrevY)
+    {
+      // normalized y [-1, 1]
+      double norm_y = m_NormFactor[1] * static_cast<double>(index[1] - 1);
+      this->CalculateXCoef(norm_y, m_CoefficientArray);
+      m_PrevY = index[1];
+    }
+  }
+
+  results.resize(m_DomainSize[0]);
+
+  // each value is the dot product of the cached x coefficients with the
+  // tabulated Legendre basis of the position; the loops are contiguous
+  const unsigned int numberOfBasisValues = m_Degree + 1;
+  const double *     basis = m_CachedXBasis.data();
+  for (unsigned long x = 0; x < m_DomainSize[0]; ++x, basis += numberOfBasisValues)
+  {
+    double sum = 0.0;
+    for (unsigned int i = 0; i < numberOfBasisValues; ++i)
+    {
+      sum += m_CachedXCoef[i] * basis[i];
+    }
+    results[x] = sum;
+  }
+}
+
 unsigned int
 MultivariateLegendrePolynomial::GetNumberOfCoefficients(unsigned int dimension, unsigned int degree)
 {
@@ -17,6 +17,7 @@
  *=========================================================================*/
 
 #include <iostream>
+#include "itkMath.h"
 #include "itkMultivariateLegendrePolynomial.h"
 
 /**
@@ -86,6 +87,65 @@ itkMultivariateLegendrePolynomialTest(int, char *[])
     ++bIter;
   }
 
+  // The row evaluation and the iterator must agree with the per-index
+  // evaluation up to floating-point rounding
+  for (unsigned int testDimension = 2; testDimension <= 3; ++testDimension)
+  {
+    PolynomialType::DomainSizeType testDomainSize(testDimension);
+    testDomainSize[0] = 9;
+    testDomainSize[1] = 7;
+    if (testDimension == 3)
+    {
+      testDomainSize[2] = 5;
+    }
+
+    PolynomialType testPolynomial(testDimension, degree, testDomainSize);
+
+    PolynomialType::CoefficientArrayType testCoefficients(testPolynomial.GetNumberOfCoefficients());
+    for (unsigned int i = 0; i < testCoefficients.size(); ++i)
+    {
+      testCoefficients[i] = 0.3 - 0.05 * static_cast<double>(i);
+    }
+    testPolynomial.SetCoefficients(testCoefficients);
+
+    PolynomialType::SimpleForwardIterator testIter(&testPolynomial);
+    testIter.Begin();
+
+    PolynomialType testReference(testDimension, degree, testDomainSize);
+    testReference.SetCoefficients(testCoefficients);
+
+    PolynomialType::IndexType index(testDimension);
+    std::fill(index.begin(), index.end(), 0);
+
+    bool done = false;
+    while (!done)
+    {
+      const double expected = testReference.Evaluate(index);
+      if (itk::Math::abs(testIter.Get() - expected) > 1e-10)
+      {
+        std::cout << "Test fails: EvaluateRow differs from Evaluate in " << testDimension << "D" << std::endl;
+        return EXIT_FAILURE;
+      }
+      ++testIter;
+
+      // advance the index in the iteration order of the iterator
+      unsigned int dim = 0;
+      while (dim < testDimension && index[dim] == static_cast<long>(testDomainSize[dim]) - 1)
+      {
+        index[dim] = 0;
+        ++dim;
+      }
+      if (dim == testDimension)
+      {
+        done = true;
+      }
+      else
+      {
+        index[dim] += 1;
+      }
+    }
+  }
+
   std::cout << "Test succeeded." << std::endl;
   return EXIT_SUCCESS;
 }
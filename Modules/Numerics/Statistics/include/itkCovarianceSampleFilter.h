@@ -121,6 +121,20 @@ public:
   MeasurementVectorSizeType
   GetMeasurementVectorSize() const;
 
+  /** Set/Get whether the accumulation is sharded over the work units of
+   * the multithreader. The mean pass and the centered second-moment pass
+   * are both sharded; each work unit accumulates over a contiguous range
+   * of instance identifiers and the partial moments are merged in shard
+   * order, so the result is deterministic for a fixed number of work
+   * units but may differ from the serial accumulation by floating-point
+   * rounding. The sharded path addresses the measurement vectors by
+   * instance identifier and therefore requires them to be the
+   * consecutive integers 0 .. Size()-1, as in ListSample, the list
+   * sample adaptors and Histogram. Off by default. */
+  itkSetMacro(UseMultipleWorkUnits, bool);
+  itkGetConstMacro(UseMultipleWorkUnits, bool);
+  itkBooleanMacro(UseMultipleWorkUnits);
+
 protected:
   CovarianceSampleFilter();
   ~CovarianceSampleFilter() override = default;
@@ -137,6 +151,9 @@ protected:
 
   void
   GenerateData() override;
+
+private:
+  bool m_UseMultipleWorkUnits{ false };
 }; // end of class
 } // end of namespace Statistics
 } // end of namespace itk
@@ -20,6 +20,7 @@
 
 #include "itkCovarianceSampleFilter.h"
 #include "itkMeanSampleFilter.h"
+#include "itkMultiThreaderBase.h"
 
 namespace itk
 {
@@ -40,6 +41,8 @@ void
 CovarianceSampleFilter<TSample>::PrintSelf(std::ostream & os, Indent indent) const
 {
   Superclass::PrintSelf(os, indent);
+
+  os << indent << "UseMultipleWorkUnits: " << (m_UseMultipleWorkUnits ? "On" : "Off") << std::endl;
 }
 
 template <typename TSample>
@@ -132,42 +135,110 @@ CovarianceSampleFilter<TSample>::GenerateData()
   auto meanFilter = MeanFilterType::New();
 
   meanFilter->SetInput(input);
+  meanFilter->SetUseMultipleWorkUnits(m_UseMultipleWorkUnits);
+  meanFilter->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
   meanFilter->Update();
 
   const typename MeanFilterType::MeasurementVectorRealType mean = meanFilter->GetMean();
   decoratedMeanOutput->Set(mean);
 
   // covariance algorithm
-  MeasurementVectorRealType diff;
-  NumericTraits<MeasurementVectorRealType>::SetLength(diff, measurementVectorSize);
-
   using TotalFrequencyType = typename SampleType::TotalAbsoluteFrequencyType;
   TotalFrequencyType totalFrequency = NumericTraits<TotalFrequencyType>::ZeroValue();
 
-  typename SampleType::ConstIterator       iter = input->Begin();
-  const typename SampleType::ConstIterator end = input->End();
-
-  // fills the lower triangle and the diagonal cells in the covariance matrix
-  for (; iter != end; ++iter)
+  if (m_UseMultipleWorkUnits)
+  {
+    // each work unit accumulates the centered second moments of a
+    // contiguous shard of instance identifiers; because the moments are
+    // centered on the common mean, merging the partial matrices is a
+    // plain addition, done in shard order below
+    using InstanceIdentifier = typename SampleType::InstanceIdentifier;
+    const InstanceIdentifier sampleSize = input->Size();
+    const SizeValueType      numberOfShards = this->GetNumberOfWorkUnits();
+
+    MatrixType zeroMatrix(measurementVectorSize, measurementVectorSize);
+    zeroMatrix.Fill(NumericTraits<typename MatrixType::ValueType>::ZeroValue());
+    std::vector<MatrixType>         shardMatrices(numberOfShards, zeroMatrix);
+    std::vector<TotalFrequencyType> shardFrequencies(numberOfShards, NumericTraits<TotalFrequencyType>::ZeroValue());
+
+    this->GetMultiThreader()->ParallelizeArray(
+      0,
+      numberOfShards,
+      [input, sampleSize, numberOfShards, measurementVectorSize, &mean, &shardMatrices, &shardFrequencies](
+        SizeValueType shard) {
+        MeasurementVectorRealType diff;
+        NumericTraits<MeasurementVectorRealType>::SetLength(diff, measurementVectorSize);
+
+        const InstanceIdentifier beginId = shard * sampleSize / numberOfShards;
+        const InstanceIdentifier endId = (shard + 1) * sampleSize / numberOfShards;
+        for (InstanceIdentifier id = beginId; id < endId; ++id)
+        {
+          const MeasurementVectorType & measurement = input->GetMeasurementVector(id);
+
+          const typename SampleType::AbsoluteFrequencyType frequency = input->GetFrequency(id);
+          shardFrequencies[shard] += frequency;
+
+          for (unsigned int dim = 0; dim < measurementVectorSize; ++dim)
+          {
+            const auto component = static_cast<MeasurementRealType>(measurement[dim]);
+
+            diff[dim] = (component - mean[dim]);
+          }
+
+          // updates the lower triangle of the shard's partial matrix
+          for (unsigned int row = 0; row < measurementVectorSize; ++row)
+          {
+            for (unsigned int col = 0; col < row + 1; ++col)
+            {
+              shardMatrices[shard](row, col) += (static_cast<MeasurementRealType>(frequency) * diff[row] * diff[col]);
+            }
+          }
+        }
+      },
+      nullptr);
+
+    for (SizeValueType shard = 0; shard < numberOfShards; ++shard)
+    {
+      totalFrequency += shardFrequencies[shard];
+      for (unsigned int row = 0; row < measurementVectorSize; ++row)
+      {
+        for (unsigned int col = 0; col < row + 1; ++col)
+        {
+          output(row, col) += shardMatrices[shard](row, col);
+        }
+      }
+    }
+  }
+  else
   {
-    const MeasurementVectorType & measurement = iter.GetMeasurementVector();
+    MeasurementVectorRealType diff;
+    NumericTraits<MeasurementVectorRealType>::SetLength(diff, measurementVectorSize);
 
-    const typename SampleType::AbsoluteFrequencyType frequency = iter.GetFrequency();
-    totalFrequency += frequency;
+    typename SampleType::ConstIterator       iter = input->Begin();
+    const typename SampleType::ConstIterator end = input->End();
 
-    for (unsigned int dim = 0; dim < measurementVectorSize; ++dim)
+    // fills the lower triangle and the diagonal cells in the covariance matrix
+    for (; iter != end; ++iter)
     {
-      const auto component = static_cast<MeasurementRealType>(measurement[dim]);
+      const MeasurementVectorType & measurement = iter.GetMeasurementVector();
 
-      diff[dim] = (component - mean[dim]);
-    }
+      const typename SampleType::AbsoluteFrequencyType frequency = iter.GetFrequency();
+      totalFrequency += frequency;
 
-    // updates the covariance matrix
-    for (unsigned int row = 0; row < measurementVectorSize; ++row)
-    {
-      for (unsigned int col = 0; col < row + 1; ++col)
+      for (unsigned int dim = 0; dim < measurementVectorSize; ++dim)
+      {
+        const auto component = static_cast<MeasurementRealType>(measurement[dim]);
+
+        diff[dim] = (component - mean[dim]);
+      }
+
+      // updates the covariance matrix
+      for (unsigned int row = 0; row < measurementVectorSize; ++row)
       {
-        output(row, col) += (static_cast<MeasurementRealType>(frequency) * diff[row] * diff[col]);
+        for (unsigned int col = 0; col < row + 1; ++col)
+        {
+          output(row, col) += (static_cast<MeasurementRealType>(frequency) * diff[row] * diff[col]);
+        }
       }
     }
   }
@@ -64,6 +64,11 @@ extern ITKStatistics_EXPORT std::ostream &
  * required. The EM procedure terminates when the current iteration
  * reaches the maximum iteration or the model parameters converge.
  *
+ * The expectation step evaluates the responsibilities of the
+ * measurement vectors in parallel over the work units of the
+ * MultiThreaderBase. Each responsibility depends only on its own
+ * measurement vector, so the result is identical to a serial sweep.
+ *
  * <b>Recent API changes:</b>
  * The static const macro to get the length of a measurement vector,
  * \c MeasurementVectorSize  has been removed to allow the length of a measurement
@@ -19,6 +19,7 @@
 #define itkExpectationMaximizationMixtureModelEstimator_hxx
 
 #include "itkExpectationMaximizationMixtureModelEstimator.h"
+#include "itkMultiThreaderBase.h"
 #include "itkNumericTraits.h"
 #include "itkMath.h"
 
@@ -151,65 +152,77 @@ ExpectationMaximizationMixtureModelEstimator<TSample>::CalculateDensities()
     return false;
   }
 
-  double              temp;
-  size_t              numberOfComponents = m_ComponentVector.size();
-  std::vector<double> tempWeights(numberOfComponents, 0.);
-
-  typename TSample::ConstIterator iter = m_Sample->Begin();
-  typename TSample::ConstIterator last = m_Sample->End();
-  // Note: The data type of componentIndex shoub be unsigned int
-  //       because itk::Array only supports 'unsigned int' number of elements.
-  unsigned int componentIndex;
-
-  using FrequencyType = typename TSample::AbsoluteFrequencyType;
-  FrequencyType                           frequency;
-  FrequencyType                           zeroFrequency = NumericTraits<FrequencyType>::ZeroValue();
-  typename TSample::MeasurementVectorType mvector;
-  double                                  density;
-  double                                  densitySum;
-  double                                  minDouble = NumericTraits<double>::epsilon();
-
-  SizeValueType measurementVectorIndex = 0;
-
-  while (iter != last)
-  {
-    mvector = iter.GetMeasurementVector();
-    frequency = iter.GetFrequency();
-    densitySum = 0.0;
-    if (frequency > zeroFrequency)
-    {
-      for (componentIndex = 0; componentIndex < numberOfComponents; ++componentIndex)
+  const size_t        numberOfComponents = m_ComponentVector.size();
+  const SizeValueType sampleSize = m_Sample->Size();
+
+  // The responsibilities of distinct measurement vectors are independent
+  // of each other, so the expectation step is sharded over the work
+  // units of the multithreader; every weight is computed exactly as in a
+  // serial sweep, so the result does not depend on the sharding.
+  auto                threader = MultiThreaderBase::New();
+  const SizeValueType numberOfShards = threader->GetNumberOfWorkUnits();
+
+  threader->ParallelizeArray(
+    0,
+    numberOfShards,
+    [this, numberOfComponents, sampleSize, numberOfShards](SizeValueType shard) {
+      double              temp;
+      std::vector<double> tempWeights(numberOfComponents, 0.);
+
+      // Note: The data type of componentIndex shoub be unsigned int
+      //       because itk::Array only supports 'unsigned int' number of elements.
+      unsigned int componentIndex;
+
+      using FrequencyType = typename TSample::AbsoluteFrequencyType;
+      FrequencyType                           frequency;
+      FrequencyType                           zeroFrequency = NumericTraits<FrequencyType>::ZeroValue();
+      typename TSample::MeasurementVectorType mvector;
+      double                                  density;
+      double                                  densitySum;
+      double                                  minDouble = NumericTraits<double>::epsilon();
+
+      const SizeValueType beginIndex = shard * sampleSize / numberOfShards;
+      const SizeValueType endIndex = (shard + 1) * sampleSize / numberOfShards;
+
+      for (SizeValueType measurementVectorIndex = beginIndex; measurementVectorIndex < endIndex;
+           ++measurementVectorIndex)
       {
-        double t_prop = m_Proportions[componentIndex];
-        double t_value = m_ComponentVector[componentIndex]->Evaluate(mvector);
-        density = t_prop * t_value;
-        tempWeights[componentIndex] = density;
-        densitySum += density;
-      }
-
-      for (componentIndex = 0; componentIndex < numberOfComponents; ++componentIndex)
-      {
-        temp = tempWeights[static_cast<unsigned int>(componentIndex)];
-
-        // just to make sure temp does not blow up!
-        if (densitySum > NumericTraits<double>::epsilon())
+        mvector = m_Sample->GetMeasurementVector(measurementVectorIndex);
+        frequency = m_Sample->GetFrequency(measurementVectorIndex);
+        densitySum = 0.0;
+        if (frequency > zeroFrequency)
         {
-          temp /= densitySum;
+          for (componentIndex = 0; componentIndex < numberOfComponents; ++componentIndex)
+          {
+            double t_prop = m_Proportions[componentIndex];
+            double t_value = m_ComponentVector[componentIndex]->Evaluate(mvector);
+            density = t_prop * t_value;
+            tempWeights[componentIndex] = density;
+            densitySum += density;
+          }
+
+          for (componentIndex = 0; componentIndex < numberOfComponents; ++componentIndex)
+          {
+            temp = tempWeights[static_cast<unsigned int>(componentIndex)];
+
+            // just to make sure temp does not blow up!
+            if (densitySum > NumericTraits<double>::epsilon())
+            {
+              temp /= densitySum;
+            }
+            m_ComponentVector[static_cast<unsigned int>(componentIndex)]->SetWeight(measurementVectorIndex, temp);
+          }
+        }
+        else
+        {
+          for (componentIndex = 0; componentIndex < numberOfComponents; ++componentIndex)
+          {
+            m_ComponentVector[componentIndex]->SetWeight(measurementVectorIndex, minDouble);
+          }
         }
-        m_ComponentVector[static_cast<unsigned int>(componentIndex)]->SetWeight(measurementVectorIndex, temp);
-      }
-    }
-    else
-    {
-      for (componentIndex = 0; componentIndex < numberOfComponents; ++componentIndex)
-      {
-        m_ComponentVector[componentIndex]->SetWeight(measurementVectorIndex, minDouble);
       }
-    }
-
-    ++iter;
-    ++measurementVectorIndex;
-  }
+    },
+    nullptr);
 
   return true;
 }
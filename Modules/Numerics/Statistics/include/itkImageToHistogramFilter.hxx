@@ -20,6 +20,10 @@
 
 #include "itkImageToHistogramFilter.h"
 #include "itkImageRegionConstIterator.h"
+#include "itkMath.h"
+
+#include <algorithm>
+#include <vector>
 
 namespace itk
 {
@@ -245,14 +249,70 @@ ImageToHistogramFilter<TImage>::ThreadedStreamedGenerateData(const RegionType &
   inputIt.GoToBegin();
   HistogramMeasurementVectorType m(nbOfComponents);
 
-  typename HistogramType::IndexType index;
-  while (!inputIt.IsAtEnd())
+  if (nbOfComponents == 1)
   {
-    const PixelType & p = inputIt.Get();
-    NumericTraits<PixelType>::AssignToArray(p, m);
-    histogram->GetIndex(m, index);
-    histogram->IncreaseFrequencyOfIndex(index, 1);
-    ++inputIt;
+    // Fixed-bin fast path for single-component pixels: the bin minimums
+    // of the only dimension are copied into a contiguous table once, and
+    // every sample is binned with a binary search over that table. The
+    // search replicates the edge handling of Histogram::GetIndex, and
+    // for one dimension the bin index is the instance identifier, so the
+    // frequencies match the generic path exactly.
+    using InstanceIdentifier = typename HistogramType::InstanceIdentifier;
+    using MeasurementType = typename HistogramType::MeasurementType;
+
+    const InstanceIdentifier     numberOfBins = histogram->GetSize(0);
+    std::vector<MeasurementType> binMins(numberOfBins);
+    for (InstanceIdentifier j = 0; j < numberOfBins; ++j)
+    {
+      binMins[j] = histogram->GetBinMin(0, j);
+    }
+    const MeasurementType topMax = histogram->GetBinMax(0, numberOfBins - 1);
+    const bool            clipBinsAtEnds = histogram->GetClipBinsAtEnds();
+
+    while (!inputIt.IsAtEnd())
+    {
+      const PixelType & p = inputIt.Get();
+      NumericTraits<PixelType>::AssignToArray(p, m);
+      const MeasurementType v = m[0];
+
+      InstanceIdentifier bin;
+      if (v < binMins[0])
+      {
+        if (clipBinsAtEnds)
+        {
+          ++inputIt;
+          continue;
+        }
+        bin = 0;
+      }
+      else if (v >= topMax)
+      {
+        if (clipBinsAtEnds && !Math::AlmostEquals(v, topMax))
+        {
+          ++inputIt;
+          continue;
+        }
+        bin = numberOfBins - 1;
+      }
+      else
+      {
+        bin = static_cast<InstanceIdentifier>(std::upper_bound(binMins.begin(), binMins.end(), v) - binMins.begin()) - 1;
+      }
+      histogram->IncreaseFrequency(bin, 1);
+      ++inputIt;
+    }
+  }
+  else
+  {
+    typename HistogramType::IndexType index;
+    while (!inputIt.IsAtEnd())
+    {
+      const PixelType & p = inputIt.Get();
+      NumericTraits<PixelType>::AssignToArray(p, m);
+      histogram->GetIndex(m, index);
+      histogram->IncreaseFrequencyOfIndex(index, 1);
+      ++inputIt;
+    }
   }
 
   this->ThreadedMergeHistogram(std::move(histogram));
@@ -284,18 +344,20 @@ ImageToHistogramFilter<TImage>::ThreadedMergeHistogram(HistogramPointer && histo
       // allow other threads to merge data
       lock.unlock();
 
-      using HistogramIterator = typename HistogramType::ConstIterator;
-
-      HistogramIterator hit = tomergeHistogram->Begin();
-      HistogramIterator end = tomergeHistogram->End();
-
-      typename HistogramType::IndexType index;
+      // Both histograms were initialized with the same bin layout, so
+      // the frequencies can be merged bin by bin through the instance
+      // identifiers, without re-binning the measurement vectors through
+      // GetIndex(); empty bins are skipped.
+      using InstanceIdentifier = typename HistogramType::InstanceIdentifier;
+      const InstanceIdentifier numberOfBins = tomergeHistogram->Size();
 
-      while (hit != end)
+      for (InstanceIdentifier id = 0; id < numberOfBins; ++id)
       {
-        histogram->GetIndex(hit.GetMeasurementVector(), index);
-        histogram->IncreaseFrequencyOfIndex(index, hit.GetFrequency());
-        ++hit;
+        const typename HistogramType::AbsoluteFrequencyType frequency = tomergeHistogram->GetFrequency(id);
+        if (frequency != 0)
+        {
+          histogram->IncreaseFrequency(id, frequency);
+        }
       }
     }
   }
@@ -25,6 +25,8 @@
 #include "itkSize.h"
 #include "itkObject.h"
 #include "itkArray.h"
+#include "itkMultiThreaderBase.h"
+#include "itkSmallObjectPool.h"
 
 #include "itkSubsample.h"
 
@@ -67,6 +69,11 @@ struct ITK_TEMPLATE_EXPORT KdTreeNode
   /** type alias for itself */
   using Self = KdTreeNode<TSample>;
 
+  /** A tree is built from many small heap-allocated nodes; the
+   * small-object pool keeps them in contiguous slabs for better locality
+   * during tree walks. The operators are inherited by the subclasses. */
+  itkSmallObjectPoolAllocationMacro();
+
   /** Measurement type, not the measurement vector type */
   using MeasurementType = typename TSample::MeasurementType;
 
@@ -746,6 +753,23 @@ public:
   void
   Search(const MeasurementVectorType &, double, InstanceIdentifierVectorType &) const;
 
+  /** Searches the k-nearest neighbors of many query points in one call.
+   * The queries are distributed over the work units of the
+   * multithreader; the index-th element of the result holds the
+   * neighbors of the index-th query point. */
+  void
+  BatchSearch(const std::vector<MeasurementVectorType> &,
+              unsigned int,
+              std::vector<InstanceIdentifierVectorType> &) const;
+
+  /** Searches the k-nearest neighbors of many query points in one call
+   * and also returns the distances to them. */
+  void
+  BatchSearch(const std::vector<MeasurementVectorType> &,
+              unsigned int,
+              std::vector<InstanceIdentifierVectorType> &,
+              std::vector<std::vector<double>> &) const;
+
   /** Returns true if the intermediate k-nearest neighbors exist within
    * the the bounding box defined by the lowerBound and the
    * upperBound. Otherwise returns false. Returns false if the ball
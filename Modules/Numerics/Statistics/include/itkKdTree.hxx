@@ -221,6 +221,45 @@ KdTree<TSample>::Search(const MeasurementVectorType &  query,
   result = nearestNeighbors.GetNeighbors();
 }
 
+template <typename TSample>
+void
+KdTree<TSample>::BatchSearch(const std::vector<MeasurementVectorType> &  queries,
+                             unsigned int                                numberOfNeighborsRequested,
+                             std::vector<InstanceIdentifierVectorType> & results) const
+{
+  // This function has two different signatures. The other signature, that
+  // returns the distances vectors too, is called here; however, its
+  // distances vectors are discarded.
+  std::vector<std::vector<double>> not_used_distances;
+  this->BatchSearch(queries, numberOfNeighborsRequested, results, not_used_distances);
+}
+
+template <typename TSample>
+void
+KdTree<TSample>::BatchSearch(const std::vector<MeasurementVectorType> &  queries,
+                             unsigned int                                numberOfNeighborsRequested,
+                             std::vector<InstanceIdentifierVectorType> & results,
+                             std::vector<std::vector<double>> &          distances) const
+{
+  if (numberOfNeighborsRequested > this->Size())
+  {
+    itkExceptionMacro("The numberOfNeighborsRequested for the nearest "
+                      << "neighbor search should be less than or equal to the number of "
+                      << "the measurement vectors.");
+  }
+
+  results.resize(queries.size());
+  distances.resize(queries.size());
+
+  MultiThreaderBase::New()->ParallelizeArray(
+    0,
+    queries.size(),
+    [this, &queries, numberOfNeighborsRequested, &results, &distances](SizeValueType i) {
+      this->Search(queries[i], numberOfNeighborsRequested, results[i], distances[i]);
+    },
+    nullptr);
+}
+
 template <typename TSample>
 inline int
 KdTree<TSample>::NearestNeighborSearchLoop(const KdTreeNodeType *        node,
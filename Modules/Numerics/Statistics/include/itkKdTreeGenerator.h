@@ -119,6 +119,16 @@ public:
   void
   SetBucketSize(unsigned int size);
 
+  /** Set/Get the number of work units used for the tree construction.
+   * With more than one work unit, the upper split levels are expanded
+   * serially and the resulting subtrees are built concurrently. The
+   * default is one, which reproduces the serial construction exactly;
+   * a parallel build produces the same tree structure, but the weighted
+   * centroids of the expanded top-level nodes may differ from a serial
+   * build by floating-point summation order. */
+  itkSetClampMacro(NumberOfWorkUnits, unsigned int, 1, ITK_MAX_THREADS);
+  itkGetConstMacro(NumberOfWorkUnits, unsigned int);
+
   /** Returns the pointer to the generated k-d tree. */
   OutputPointer
   GetOutput()
@@ -174,7 +184,65 @@ protected:
                    MeasurementVectorType & upperBound,
                    unsigned int            level);
 
+  /** Creates a nonterminal node for an already partitioned range with
+   * already built children. Used by the parallel construction to create
+   * the expanded top-level nodes after the subtree builds complete. */
+  virtual KdTreeNodeType *
+  MakeNonterminalNode(unsigned int     beginIndex,
+                      unsigned int     endIndex,
+                      unsigned int     partitionDimension,
+                      MeasurementType  partitionValue,
+                      unsigned int     medianIndex,
+                      KdTreeNodeType * left,
+                      KdTreeNodeType * right);
+
 private:
+  /** Partition of a range that has been split but whose node is not
+   * created yet. Non-negative child references index the record vector;
+   * negative child references encode an index into the subtree build
+   * job vector as the bitwise complement. */
+  struct SplitRecord
+  {
+    unsigned int    BeginIndex;
+    unsigned int    EndIndex;
+    unsigned int    PartitionDimension;
+    MeasurementType PartitionValue;
+    unsigned int    MedianIndex;
+    int             Left;
+    int             Right;
+  };
+
+  /** A subtree build that can run concurrently with the others: the
+   * ranges of the jobs are disjoint. */
+  struct SubtreeBuildJob
+  {
+    unsigned int          BeginIndex;
+    unsigned int          EndIndex;
+    unsigned int          Level;
+    MeasurementVectorType LowerBound;
+    MeasurementVectorType UpperBound;
+    KdTreeNodeType *      Result;
+  };
+
+  /** Recursively partitions the range into split records until the
+   * requested number of split levels is reached, collecting the
+   * unexpanded ranges as subtree build jobs. Returns a child reference
+   * in the encoding of SplitRecord. */
+  int
+  ExpandSplits(unsigned int                   beginIndex,
+               unsigned int                   endIndex,
+               MeasurementVectorType &        lowerBound,
+               MeasurementVectorType &        upperBound,
+               unsigned int                   level,
+               unsigned int                   remainingSplitLevels,
+               std::vector<SplitRecord> &     records,
+               std::vector<SubtreeBuildJob> & jobs);
+
+  /** Creates the nodes of the expanded split records bottom-up, stitching
+   * in the subtree build results. */
+  KdTreeNodeType *
+  AssembleSplits(int childReference, const std::vector<SplitRecord> & records, std::vector<SubtreeBuildJob> & jobs);
+
   /** Pointer to the input (source) sample */
   TSample * m_SourceSample;
 
@@ -190,14 +258,8 @@ private:
   /** Pointer to the resulting k-d tree. */
   OutputPointer m_Tree;
 
-  /** Temporary lower bound for the TreeGenerationLoop */
-  MeasurementVectorType m_TempLowerBound;
-
-  /** Temporary upper bound for the TreeGenerationLoop */
-  MeasurementVectorType m_TempUpperBound;
-
-  /** Temporary mean for the TreeGenerationLoop */
-  MeasurementVectorType m_TempMean;
+  /** Number of work units for the tree construction. */
+  unsigned int m_NumberOfWorkUnits;
 
   /** Length of a measurement vector */
   MeasurementVectorSizeType m_MeasurementVectorSize;
@@ -30,6 +30,7 @@ KdTreeGenerator<TSample>::KdTreeGenerator()
   m_SourceSample = nullptr;
   m_BucketSize = 16;
   m_Subsample = SubsampleType::New();
+  m_NumberOfWorkUnits = 1;
   m_MeasurementVectorSize = 0;
 }
 
@@ -50,6 +51,7 @@ KdTreeGenerator<TSample>::PrintSelf(std::ostream & os, Indent indent) const
   }
 
   os << indent << "Bucket Size: " << m_BucketSize << std::endl;
+  os << indent << "NumberOfWorkUnits: " << m_NumberOfWorkUnits << std::endl;
   os << indent << "MeasurementVectorSize: " << m_MeasurementVectorSize << std::endl;
 }
 
@@ -61,9 +63,6 @@ KdTreeGenerator<TSample>::SetSample(TSample * sample)
   m_Subsample->SetSample(sample);
   m_Subsample->InitializeWithAllInstances();
   m_MeasurementVectorSize = sample->GetMeasurementVectorSize();
-  NumericTraits<MeasurementVectorType>::SetLength(m_TempLowerBound, m_MeasurementVectorSize);
-  NumericTraits<MeasurementVectorType>::SetLength(m_TempUpperBound, m_MeasurementVectorSize);
-  NumericTraits<MeasurementVectorType>::SetLength(m_TempMean, m_MeasurementVectorSize);
 }
 
 template <typename TSample>
@@ -109,7 +108,40 @@ KdTreeGenerator<TSample>::GenerateData()
     upperBound[d] = NumericTraits<MeasurementType>::max();
   }
 
-  KdTreeNodeType * root = this->GenerateTreeLoop(0, m_Subsample->Size(), lowerBound, upperBound, 0);
+  KdTreeNodeType * root;
+  if (m_NumberOfWorkUnits <= 1)
+  {
+    root = this->GenerateTreeLoop(0, m_Subsample->Size(), lowerBound, upperBound, 0);
+  }
+  else
+  {
+    // Expand the top split levels serially until there is at least one
+    // subtree build job per work unit, build the subtrees concurrently
+    // (their subsample ranges are disjoint), then create the expanded
+    // nodes bottom-up from the recorded splits.
+    unsigned int splitLevels = 0;
+    while ((1u << splitLevels) < m_NumberOfWorkUnits)
+    {
+      ++splitLevels;
+    }
+
+    std::vector<SplitRecord>     records;
+    std::vector<SubtreeBuildJob> jobs;
+    const int topReference = this->ExpandSplits(0, m_Subsample->Size(), lowerBound, upperBound, 0, splitLevels, records, jobs);
+
+    auto threader = MultiThreaderBase::New();
+    threader->SetNumberOfWorkUnits(m_NumberOfWorkUnits);
+    threader->ParallelizeArray(
+      0,
+      jobs.size(),
+      [this, &jobs](SizeValueType i) {
+        SubtreeBuildJob & job = jobs[i];
+        job.Result = this->GenerateTreeLoop(job.BeginIndex, job.EndIndex, job.LowerBound, job.UpperBound, job.Level);
+      },
+      nullptr);
+
+    root = this->AssembleSplits(topReference, records, jobs);
+  }
   m_Tree->SetRoot(root);
 }
 
@@ -133,14 +165,18 @@ KdTreeGenerator<TSample>::GenerateNonterminalNode(unsigned int            beginI
 
   SubsamplePointer subsample = this->GetSubsample();
 
-  // find most widely spread dimension
+  // find most widely spread dimension; the bounds are function-local so
+  // that concurrent subtree builds do not share state
+  MeasurementVectorType tempLowerBound;
+  MeasurementVectorType tempUpperBound;
+  MeasurementVectorType tempMean;
   Algorithm::FindSampleBoundAndMean<SubsampleType>(
-    subsample, beginIndex, endIndex, m_TempLowerBound, m_TempUpperBound, m_TempMean);
+    subsample, beginIndex, endIndex, tempLowerBound, tempUpperBound, tempMean);
 
   maxSpread = NumericTraits<MeasurementType>::NonpositiveMin();
   for (i = 0; i < m_MeasurementVectorSize; ++i)
   {
-    spread = m_TempUpperBound[i] - m_TempLowerBound[i];
+    spread = tempUpperBound[i] - tempLowerBound[i];
     if (spread >= maxSpread)
     {
       maxSpread = spread;
@@ -218,6 +254,110 @@ KdTreeGenerator<TSample>::GenerateTreeLoop(unsigned int            beginIndex,
     return this->GenerateNonterminalNode(beginIndex, endIndex, lowerBound, upperBound, level + 1);
   }
 }
+
+template <typename TSample>
+typename KdTreeGenerator<TSample>::KdTreeNodeType *
+KdTreeGenerator<TSample>::MakeNonterminalNode(unsigned int itkNotUsed(beginIndex),
+                                              unsigned int itkNotUsed(endIndex),
+                                              unsigned int partitionDimension,
+                                              MeasurementType  partitionValue,
+                                              unsigned int     medianIndex,
+                                              KdTreeNodeType * left,
+                                              KdTreeNodeType * right)
+{
+  auto * nonTerminalNode = new KdTreeNonterminalNode<TSample>(partitionDimension, partitionValue, left, right);
+
+  nonTerminalNode->AddInstanceIdentifier(this->GetSubsample()->GetInstanceIdentifier(medianIndex));
+
+  return nonTerminalNode;
+}
+
+template <typename TSample>
+int
+KdTreeGenerator<TSample>::ExpandSplits(unsigned int                   beginIndex,
+                                       unsigned int                   endIndex,
+                                       MeasurementVectorType &        lowerBound,
+                                       MeasurementVectorType &        upperBound,
+                                       unsigned int                   level,
+                                       unsigned int                   remainingSplitLevels,
+                                       std::vector<SplitRecord> &     records,
+                                       std::vector<SubtreeBuildJob> & jobs)
+{
+  if (remainingSplitLevels == 0 || endIndex - beginIndex <= m_BucketSize)
+  {
+    // the range stays a subtree build job; the bounds are copied because
+    // the jobs run after this expansion has unwound
+    jobs.push_back(SubtreeBuildJob{ beginIndex, endIndex, level, lowerBound, upperBound, nullptr });
+    return ~static_cast<int>(jobs.size() - 1);
+  }
+
+  // find most widely spread dimension, as in GenerateNonterminalNode
+  MeasurementVectorType tempLowerBound;
+  MeasurementVectorType tempUpperBound;
+  MeasurementVectorType tempMean;
+  Algorithm::FindSampleBoundAndMean<SubsampleType>(
+    this->GetSubsample(), beginIndex, endIndex, tempLowerBound, tempUpperBound, tempMean);
+
+  unsigned int    partitionDimension = 0;
+  MeasurementType maxSpread = NumericTraits<MeasurementType>::NonpositiveMin();
+  for (unsigned int i = 0; i < m_MeasurementVectorSize; ++i)
+  {
+    const MeasurementType spread = tempUpperBound[i] - tempLowerBound[i];
+    if (spread >= maxSpread)
+    {
+      maxSpread = spread;
+      partitionDimension = i;
+    }
+  }
+
+  unsigned int medianIndex = (endIndex - beginIndex) / 2;
+
+  const MeasurementType partitionValue =
+    Algorithm::NthElement<SubsampleType>(m_Subsample, partitionDimension, beginIndex, endIndex, medianIndex);
+
+  medianIndex += beginIndex;
+
+  SplitRecord record;
+  record.BeginIndex = beginIndex;
+  record.EndIndex = endIndex;
+  record.PartitionDimension = partitionDimension;
+  record.PartitionValue = partitionValue;
+  record.MedianIndex = medianIndex;
+
+  // save bounds for cutting dimension
+  const MeasurementType dimensionLowerBound = lowerBound[partitionDimension];
+  const MeasurementType dimensionUpperBound = upperBound[partitionDimension];
+
+  upperBound[partitionDimension] = partitionValue;
+  record.Left = this->ExpandSplits(beginIndex, medianIndex, lowerBound, upperBound, level + 1, remainingSplitLevels - 1, records, jobs);
+  upperBound[partitionDimension] = dimensionUpperBound;
+
+  lowerBound[partitionDimension] = partitionValue;
+  record.Right = this->ExpandSplits(medianIndex + 1, endIndex, lowerBound, upperBound, level + 1, remainingSplitLevels - 1, records, jobs);
+  lowerBound[partitionDimension] = dimensionLowerBound;
+
+  records.push_back(record);
+  return static_cast<int>(records.size() - 1);
+}
+
+template <typename TSample>
+typename KdTreeGenerator<TSample>::KdTreeNodeType *
+KdTreeGenerator<TSample>::AssembleSplits(int                              childReference,
+                                         const std::vector<SplitRecord> & records,
+                                         std::vector<SubtreeBuildJob> &   jobs)
+{
+  if (childReference < 0)
+  {
+    return jobs[~childReference].Result;
+  }
+
+  const SplitRecord & record = records[childReference];
+  KdTreeNodeType *    left = this->AssembleSplits(record.Left, records, jobs);
+  KdTreeNodeType *    right = this->AssembleSplits(record.Right, records, jobs);
+
+  return this->MakeNonterminalNode(
+    record.BeginIndex, record.EndIndex, record.PartitionDimension, record.PartitionValue, record.MedianIndex, left, right);
+}
 } // end of namespace Statistics
 } // end of namespace itk
 
@@ -92,6 +92,19 @@ public:
   const MeasurementVectorRealType
   GetMean() const;
 
+  /** Set/Get whether the accumulation is sharded over the work units of
+   * the multithreader. Each work unit accumulates a compensated partial
+   * sum over a contiguous range of instance identifiers and the partial
+   * sums are merged in shard order, so the result is deterministic for a
+   * fixed number of work units but may differ from the serial sum by
+   * floating-point rounding. The sharded path addresses the measurement
+   * vectors by instance identifier and therefore requires them to be the
+   * consecutive integers 0 .. Size()-1, as in ListSample, the list
+   * sample adaptors and Histogram. Off by default. */
+  itkSetMacro(UseMultipleWorkUnits, bool);
+  itkGetConstMacro(UseMultipleWorkUnits, bool);
+  itkBooleanMacro(UseMultipleWorkUnits);
+
   /** MeasurementVector is not a DataObject, we need to decorate it to push it down
    * a ProcessObject's pipeline */
   using MeasurementVectorDecoratedType = SimpleDataObjectDecorator<MeasurementVectorRealType>;
@@ -119,6 +132,9 @@ protected:
 
   void
   GenerateData() override;
+
+private:
+  bool m_UseMultipleWorkUnits{ false };
 }; // end of class
 } // end of namespace Statistics
 } // end of namespace itk
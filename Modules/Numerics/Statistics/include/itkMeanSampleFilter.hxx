@@ -23,6 +23,7 @@
 #include <vector>
 #include "itkCompensatedSummation.h"
 #include "itkMeasurementVectorTraits.h"
+#include "itkMultiThreaderBase.h"
 
 namespace itk
 {
@@ -42,6 +43,8 @@ void
 MeanSampleFilter<TSample>::PrintSelf(std::ostream & os, Indent indent) const
 {
   Superclass::PrintSelf(os, indent);
+
+  os << indent << "UseMultipleWorkUnits: " << (m_UseMultipleWorkUnits ? "On" : "Off") << std::endl;
 }
 
 template <typename TSample>
@@ -135,21 +138,68 @@ MeanSampleFilter<TSample>::GenerateData()
   using TotalFrequencyType = typename SampleType::TotalAbsoluteFrequencyType;
   TotalFrequencyType totalFrequency = NumericTraits<TotalFrequencyType>::ZeroValue();
 
-  typename SampleType::ConstIterator       iter = input->Begin();
-  const typename SampleType::ConstIterator end = input->End();
-
-  for (; iter != end; ++iter)
+  if (m_UseMultipleWorkUnits)
   {
-    const MeasurementVectorType & measurement = iter.GetMeasurementVector();
-
-    const typename SampleType::AbsoluteFrequencyType frequency = iter.GetFrequency();
-    totalFrequency += frequency;
+    // each work unit accumulates a contiguous shard of instance
+    // identifiers; the partial sums are merged in shard order below
+    using InstanceIdentifier = typename SampleType::InstanceIdentifier;
+    const InstanceIdentifier sampleSize = input->Size();
+    const SizeValueType      numberOfShards = this->GetNumberOfWorkUnits();
+
+    std::vector<std::vector<MeasurementRealAccumulateType>> shardSums(
+      numberOfShards, std::vector<MeasurementRealAccumulateType>(measurementVectorSize));
+    std::vector<TotalFrequencyType> shardFrequencies(numberOfShards, NumericTraits<TotalFrequencyType>::ZeroValue());
+
+    this->GetMultiThreader()->ParallelizeArray(
+      0,
+      numberOfShards,
+      [input, sampleSize, numberOfShards, measurementVectorSize, &shardSums, &shardFrequencies](SizeValueType shard) {
+        const InstanceIdentifier beginId = shard * sampleSize / numberOfShards;
+        const InstanceIdentifier endId = (shard + 1) * sampleSize / numberOfShards;
+        for (InstanceIdentifier id = beginId; id < endId; ++id)
+        {
+          const MeasurementVectorType & measurement = input->GetMeasurementVector(id);
+
+          const typename SampleType::AbsoluteFrequencyType frequency = input->GetFrequency(id);
+          shardFrequencies[shard] += frequency;
+
+          for (unsigned int dim = 0; dim < measurementVectorSize; ++dim)
+          {
+            const auto component = static_cast<MeasurementRealType>(measurement[dim]);
+
+            shardSums[shard][dim] += (component * static_cast<MeasurementRealType>(frequency));
+          }
+        }
+      },
+      nullptr);
+
+    for (SizeValueType shard = 0; shard < numberOfShards; ++shard)
+    {
+      totalFrequency += shardFrequencies[shard];
+      for (unsigned int dim = 0; dim < measurementVectorSize; ++dim)
+      {
+        sum[dim] += shardSums[shard][dim].GetSum();
+      }
+    }
+  }
+  else
+  {
+    typename SampleType::ConstIterator       iter = input->Begin();
+    const typename SampleType::ConstIterator end = input->End();
 
-    for (unsigned int dim = 0; dim < measurementVectorSize; ++dim)
+    for (; iter != end; ++iter)
     {
-      const auto component = static_cast<MeasurementRealType>(measurement[dim]);
+      const MeasurementVectorType & measurement = iter.GetMeasurementVector();
+
+      const typename SampleType::AbsoluteFrequencyType frequency = iter.GetFrequency();
+      totalFrequency += frequency;
+
+      for (unsigned int dim = 0; dim < measurementVectorSize; ++dim)
+      {
+        const auto component = static_cast<MeasurementRealType>(measurement[dim]);
 
-      sum[dim] += (component * static_cast<MeasurementRealType>(frequency));
+        sum[dim] += (component * static_cast<MeasurementRealType>(frequency));
+      }
     }
   }
 
@@ -0,0 +1,145 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkReservoirSampler_h
+#define itkReservoirSampler_h
+
+#include "itkSampleToSubsampleFilter.h"
+
+namespace itk
+{
+namespace Statistics
+{
+/** \class ReservoirSampler
+ * \brief Selects a random Subsample of user-provided size from a Sample.
+ *
+ * This filter will take as input a Sample and produce as output a Subsample
+ * containing a randomly selected subset of the instances of the sample. The
+ * output Subsample stores only instance identifiers, so the measurement
+ * vectors are never copied; downstream estimators run on the view while the
+ * data stays in the input sample.
+ *
+ * Three selection strategies are available:
+ *
+ * By default the instances are selected by reservoir sampling (Vitter's
+ * algorithm R), which draws a uniform random subset in a single pass over
+ * the sample.
+ *
+ * When WeightedByFrequency is on, the instances are selected with
+ * probabilities proportional to their frequencies (the Efraimidis-Spirakis
+ * weighted reservoir scheme); instances with zero frequency are never
+ * selected.
+ *
+ * When UseStratifiedSelection is on, the instance range is divided into as
+ * many contiguous strata as requested instances and one instance is drawn
+ * uniformly from each stratum. The strata are processed in parallel over
+ * the work units of the MultiThreaderBase; each stratum draws from its own
+ * generator seeded with the seed plus the stratum number, so the selection
+ * does not depend on the number of work units. This mode ignores
+ * WeightedByFrequency.
+ *
+ * The instance identifiers of the input sample are expected to be the
+ * consecutive integers 0 to Size()-1, as they are for ListSample, the
+ * adaptors and Histogram. The selected identifiers are added to the output
+ * in increasing order, so iterating the subsample visits the measurement
+ * vectors in their storage order.
+ *
+ * The selection is reproducible for a fixed seed, which can be set with
+ * SetSeed().
+ *
+ * \sa Sample, Subsample
+ *
+ * \sa SampleToSubsampleFilter
+ *
+ * \ingroup ITKStatistics
+ */
+
+template <typename TSample>
+class ITK_TEMPLATE_EXPORT ReservoirSampler : public SampleToSubsampleFilter<TSample>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(ReservoirSampler);
+
+  /** Standard class type aliases. */
+  using Self = ReservoirSampler;
+  using Superclass = SampleToSubsampleFilter<TSample>;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Standard macros */
+  itkTypeMacro(ReservoirSampler, SampleToSubsampleFilter);
+  itkNewMacro(Self);
+
+  /** Typedefs for Measurement vector, measurement, Instance Identifier,
+   * frequency, size, size element value from the template argument TSample */
+  using typename Superclass::SampleType;
+  using typename Superclass::MeasurementVectorType;
+  using typename Superclass::MeasurementType;
+  using typename Superclass::InstanceIdentifier;
+  using typename Superclass::SubsampleType;
+  using typename Superclass::OutputType;
+
+  /** Type of the seed of the random number generator. */
+  using SeedType = uint32_t;
+
+  /** Set/Get the number of instances to select. The output contains the
+   * whole input sample when the requested size is not smaller than the
+   * sample size. */
+  itkSetMacro(NumberOfSubsampleInstances, InstanceIdentifier);
+  itkGetConstMacro(NumberOfSubsampleInstances, InstanceIdentifier);
+
+  /** Set/Get the seed of the random number generator. */
+  itkSetMacro(Seed, SeedType);
+  itkGetConstMacro(Seed, SeedType);
+
+  /** Select the instances with probabilities proportional to their
+   * frequencies instead of uniformly. Ignored when the stratified
+   * selection is enabled. Default is off. */
+  itkSetMacro(WeightedByFrequency, bool);
+  itkGetConstMacro(WeightedByFrequency, bool);
+  itkBooleanMacro(WeightedByFrequency);
+
+  /** Draw one instance uniformly from each of as many contiguous strata
+   * as requested instances, instead of reservoir sampling. The strata are
+   * processed in parallel. Default is off. */
+  itkSetMacro(UseStratifiedSelection, bool);
+  itkGetConstMacro(UseStratifiedSelection, bool);
+  itkBooleanMacro(UseStratifiedSelection);
+
+protected:
+  ReservoirSampler() = default;
+  ~ReservoirSampler() override = default;
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+  void
+  GenerateData() override;
+
+private:
+  InstanceIdentifier m_NumberOfSubsampleInstances{ 0 };
+  SeedType           m_Seed{ 0 };
+  bool               m_WeightedByFrequency{ false };
+  bool               m_UseStratifiedSelection{ false };
+}; // end of class
+} // end of namespace Statistics
+} // end of namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkReservoirSampler.hxx"
+#endif
+
+#endif
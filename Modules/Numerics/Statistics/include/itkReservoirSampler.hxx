@@ -0,0 +1,166 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkReservoirSampler_hxx
+#define itkReservoirSampler_hxx
+
+#include "itkReservoirSampler.h"
+#include "itkMersenneTwisterRandomVariateGenerator.h"
+#include "itkMultiThreaderBase.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <queue>
+#include <utility>
+#include <vector>
+
+namespace itk
+{
+namespace Statistics
+{
+
+template <typename TSample>
+void
+ReservoirSampler<TSample>::GenerateData()
+{
+  const SampleType * inputSample = this->GetInput();
+
+  auto * outputSubSample = static_cast<SubsampleType *>(this->ProcessObject::GetOutput(0));
+
+  outputSubSample->SetSample(inputSample);
+  outputSubSample->Clear();
+
+  const InstanceIdentifier totalSize = inputSample->Size();
+  const InstanceIdentifier subsampleSize = std::min(m_NumberOfSubsampleInstances, totalSize);
+
+  if (subsampleSize == 0)
+  {
+    return;
+  }
+
+  using GeneratorType = MersenneTwisterRandomVariateGenerator;
+
+  std::vector<InstanceIdentifier> selected(subsampleSize);
+
+  if (m_UseStratifiedSelection)
+  {
+    // One instance per contiguous stratum. Every stratum draws from its
+    // own generator, so the selection does not depend on how the strata
+    // are distributed over the work units.
+    MultiThreaderBase::Pointer threader = MultiThreaderBase::New();
+    threader->ParallelizeArray(
+      0,
+      subsampleSize,
+      [this, totalSize, subsampleSize, &selected](SizeValueType stratum) {
+        const InstanceIdentifier stratumBegin = stratum * totalSize / subsampleSize;
+        const InstanceIdentifier stratumEnd = (stratum + 1) * totalSize / subsampleSize;
+
+        GeneratorType::Pointer generator = GeneratorType::New();
+        generator->SetSeed(m_Seed + static_cast<SeedType>(stratum));
+        selected[stratum] =
+          stratumBegin + generator->GetIntegerVariate(static_cast<GeneratorType::IntegerType>(
+                           stratumEnd - stratumBegin - 1));
+      },
+      nullptr);
+  }
+  else if (m_WeightedByFrequency)
+  {
+    // Weighted reservoir sampling (Efraimidis-Spirakis): every instance
+    // gets the key u^(1/frequency) and the instances with the largest
+    // keys are kept, so the selection probabilities are proportional to
+    // the frequencies.
+    GeneratorType::Pointer generator = GeneratorType::New();
+    generator->SetSeed(m_Seed);
+
+    using KeyedIdentifier = std::pair<double, InstanceIdentifier>;
+    std::priority_queue<KeyedIdentifier, std::vector<KeyedIdentifier>, std::greater<KeyedIdentifier>> reservoir;
+
+    for (InstanceIdentifier id = 0; id < totalSize; ++id)
+    {
+      const double frequency = static_cast<double>(inputSample->GetFrequency(id));
+      if (frequency <= 0.0)
+      {
+        continue;
+      }
+      const double key = std::pow(generator->GetVariateWithOpenRange(), 1.0 / frequency);
+      if (reservoir.size() < static_cast<std::size_t>(subsampleSize))
+      {
+        reservoir.push(KeyedIdentifier(key, id));
+      }
+      else if (key > reservoir.top().first)
+      {
+        reservoir.pop();
+        reservoir.push(KeyedIdentifier(key, id));
+      }
+    }
+
+    selected.resize(reservoir.size());
+    for (auto it = selected.rbegin(); it != selected.rend(); ++it)
+    {
+      *it = reservoir.top().second;
+      reservoir.pop();
+    }
+  }
+  else
+  {
+    // Reservoir sampling (Vitter's algorithm R): fill the reservoir with
+    // the first instances, then replace a random reservoir entry with a
+    // decreasing probability while streaming over the rest of the sample.
+    GeneratorType::Pointer generator = GeneratorType::New();
+    generator->SetSeed(m_Seed);
+
+    for (InstanceIdentifier id = 0; id < subsampleSize; ++id)
+    {
+      selected[id] = id;
+    }
+    for (InstanceIdentifier id = subsampleSize; id < totalSize; ++id)
+    {
+      const auto slot = static_cast<InstanceIdentifier>(
+        generator->GetIntegerVariate(static_cast<GeneratorType::IntegerType>(id)));
+      if (slot < subsampleSize)
+      {
+        selected[slot] = id;
+      }
+    }
+  }
+
+  // hand the identifiers to the subsample in increasing order, so that
+  // iterating the subsample walks the measurement storage forward
+  std::sort(selected.begin(), selected.end());
+
+  outputSubSample->Reserve(selected.size());
+  for (const InstanceIdentifier id : selected)
+  {
+    outputSubSample->AddInstance(id);
+  }
+}
+
+template <typename TSample>
+void
+ReservoirSampler<TSample>::PrintSelf(std::ostream & os, Indent indent) const
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfSubsampleInstances: " << m_NumberOfSubsampleInstances << std::endl;
+  os << indent << "Seed: " << m_Seed << std::endl;
+  os << indent << "WeightedByFrequency: " << (m_WeightedByFrequency ? "On" : "Off") << std::endl;
+  os << indent << "UseStratifiedSelection: " << (m_UseStratifiedSelection ? "On" : "Off") << std::endl;
+}
+} // end of namespace Statistics
+} // end of namespace itk
+
+#endif
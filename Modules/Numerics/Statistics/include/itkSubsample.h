@@ -112,6 +112,16 @@ public:
   void
   AddInstance(InstanceIdentifier id);
 
+  /** Reserve storage for the given number of instance identifiers, so
+   * that repeated AddInstance() calls do not reallocate and copy the
+   * identifier holder. Only the identifiers are stored; the measurement
+   * data always stays in the Sample. */
+  void
+  Reserve(InstanceIdentifier size)
+  {
+    m_IdHolder.reserve(size);
+  }
+
   /** returns SizeType object whose each element is the number of
    * elements in each dimension */
   InstanceIdentifier
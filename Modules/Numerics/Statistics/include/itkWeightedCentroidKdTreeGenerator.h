@@ -107,10 +107,16 @@ protected:
                           MeasurementVectorType & upperBound,
                           unsigned int            level) override;
 
-private:
-  MeasurementVectorType m_TempLowerBound;
-  MeasurementVectorType m_TempUpperBound;
-  MeasurementVectorType m_TempMean;
+  /** Creates a weighted centroid nonterminal node for an already
+   * partitioned range with already built children. */
+  KdTreeNodeType *
+  MakeNonterminalNode(unsigned int     beginIndex,
+                      unsigned int     endIndex,
+                      unsigned int     partitionDimension,
+                      MeasurementType  partitionValue,
+                      unsigned int     medianIndex,
+                      KdTreeNodeType * left,
+                      KdTreeNodeType * right) override;
 }; // end of class
 } // end of namespace Statistics
 } // end of namespace itk
@@ -75,14 +75,18 @@ WeightedCentroidKdTreeGenerator<TSample>::GenerateNonterminalNode(unsigned int
     }
   }
 
-  // find most widely spread dimension
+  // find most widely spread dimension; the bounds are function-local so
+  // that concurrent subtree builds do not share state
+  MeasurementVectorType tempLowerBound;
+  MeasurementVectorType tempUpperBound;
+  MeasurementVectorType tempMean;
   Algorithm::FindSampleBoundAndMean<SubsampleType>(
-    this->GetSubsample(), beginIndex, endIndex, m_TempLowerBound, m_TempUpperBound, m_TempMean);
+    this->GetSubsample(), beginIndex, endIndex, tempLowerBound, tempUpperBound, tempMean);
 
   maxSpread = NumericTraits<MeasurementType>::NonpositiveMin();
   for (i = 0; i < this->GetMeasurementVectorSize(); ++i)
   {
-    spread = m_TempUpperBound[i] - m_TempLowerBound[i];
+    spread = tempUpperBound[i] - tempLowerBound[i];
     if (spread >= maxSpread)
     {
       maxSpread = spread;
@@ -126,6 +130,42 @@ WeightedCentroidKdTreeGenerator<TSample>::GenerateNonterminalNode(unsigned int
 
   return nonTerminalNode;
 }
+
+template <typename TSample>
+typename WeightedCentroidKdTreeGenerator<TSample>::KdTreeNodeType *
+WeightedCentroidKdTreeGenerator<TSample>::MakeNonterminalNode(unsigned int     beginIndex,
+                                                              unsigned int     endIndex,
+                                                              unsigned int     partitionDimension,
+                                                              MeasurementType  partitionValue,
+                                                              unsigned int     medianIndex,
+                                                              KdTreeNodeType * left,
+                                                              KdTreeNodeType * right)
+{
+  SubsamplePointer subsample = this->GetSubsample();
+
+  // calculates the weighted centroid which is the vector sum
+  // of all the associated instances.
+  typename KdTreeNodeType::CentroidType weightedCentroid;
+  NumericTraits<typename KdTreeNodeType::CentroidType>::SetLength(weightedCentroid, this->GetMeasurementVectorSize());
+  MeasurementVectorType tempVector;
+  weightedCentroid.Fill(NumericTraits<MeasurementType>::ZeroValue());
+
+  for (unsigned int i = beginIndex; i < endIndex; ++i)
+  {
+    tempVector = subsample->GetMeasurementVectorByIndex(i);
+    for (unsigned int j = 0; j < this->GetMeasurementVectorSize(); ++j)
+    {
+      weightedCentroid[j] += tempVector[j];
+    }
+  }
+
+  auto * nonTerminalNode = new KdTreeWeightedCentroidNonterminalNode<TSample>(
+    partitionDimension, partitionValue, left, right, weightedCentroid, endIndex - beginIndex);
+
+  nonTerminalNode->AddInstanceIdentifier(subsample->GetInstanceIdentifier(medianIndex));
+
+  return nonTerminalNode;
+}
 } // end of namespace Statistics
 } // end of namespace itk
 
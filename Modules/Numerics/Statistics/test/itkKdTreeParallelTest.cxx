@@ -0,0 +1,131 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include <algorithm>
+#include <iostream>
+
+#include "itkKdTreeGenerator.h"
+#include "itkListSample.h"
+#include "itkMersenneTwisterRandomVariateGenerator.h"
+
+/* Checks that the parallel k-d tree construction produces the same tree
+ * as the serial one, and that BatchSearch matches per-query Search. */
+
+int
+itkKdTreeParallelTest(int, char *[])
+{
+  using MeasurementVectorType = itk::Array<double>;
+  using SampleType = itk::Statistics::ListSample<MeasurementVectorType>;
+  using TreeGeneratorType = itk::Statistics::KdTreeGenerator<SampleType>;
+  using TreeType = TreeGeneratorType::KdTreeType;
+
+  constexpr unsigned int measurementVectorSize = 2;
+  constexpr unsigned int numberOfDataPoints = 2000;
+  constexpr unsigned int numberOfQueryPoints = 100;
+  constexpr unsigned int numberOfNeighbors = 5;
+
+  auto randomGenerator = itk::Statistics::MersenneTwisterRandomVariateGenerator::New();
+  randomGenerator->SetSeed(4321);
+
+  auto sample = SampleType::New();
+  sample->SetMeasurementVectorSize(measurementVectorSize);
+
+  MeasurementVectorType mv(measurementVectorSize);
+  for (unsigned int i = 0; i < numberOfDataPoints; ++i)
+  {
+    for (unsigned int d = 0; d < measurementVectorSize; ++d)
+    {
+      mv[d] = randomGenerator->GetUniformVariate(-100.0, 100.0);
+    }
+    sample->PushBack(mv);
+  }
+
+  auto serialGenerator = TreeGeneratorType::New();
+  serialGenerator->SetSample(sample);
+  serialGenerator->SetBucketSize(16);
+  serialGenerator->Update();
+
+  auto parallelGenerator = TreeGeneratorType::New();
+  parallelGenerator->SetSample(sample);
+  parallelGenerator->SetBucketSize(16);
+  parallelGenerator->SetNumberOfWorkUnits(4);
+  if (parallelGenerator->GetNumberOfWorkUnits() != 4)
+  {
+    std::cout << "Test failed! GetNumberOfWorkUnits returned " << parallelGenerator->GetNumberOfWorkUnits()
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+  parallelGenerator->Update();
+
+  TreeType::Pointer serialTree = serialGenerator->GetOutput();
+  TreeType::Pointer parallelTree = parallelGenerator->GetOutput();
+
+  std::vector<MeasurementVectorType> queries;
+  for (unsigned int i = 0; i < numberOfQueryPoints; ++i)
+  {
+    MeasurementVectorType query(measurementVectorSize);
+    for (unsigned int d = 0; d < measurementVectorSize; ++d)
+    {
+      query[d] = randomGenerator->GetUniformVariate(-110.0, 110.0);
+    }
+    queries.push_back(query);
+  }
+
+  // The serial and the parallel builds must produce the same tree; the
+  // neighbor sets of each query must therefore be identical.
+  std::vector<TreeType::InstanceIdentifierVectorType> batchResults;
+  parallelTree->BatchSearch(queries, numberOfNeighbors, batchResults);
+
+  if (batchResults.size() != queries.size())
+  {
+    std::cout << "Test failed! BatchSearch returned " << batchResults.size() << " results." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  for (unsigned int i = 0; i < numberOfQueryPoints; ++i)
+  {
+    TreeType::InstanceIdentifierVectorType serialNeighbors;
+    serialTree->Search(queries[i], numberOfNeighbors, serialNeighbors);
+
+    TreeType::InstanceIdentifierVectorType parallelNeighbors;
+    parallelTree->Search(queries[i], numberOfNeighbors, parallelNeighbors);
+
+    TreeType::InstanceIdentifierVectorType batchNeighbors = batchResults[i];
+
+    std::sort(serialNeighbors.begin(), serialNeighbors.end());
+    std::sort(parallelNeighbors.begin(), parallelNeighbors.end());
+    std::sort(batchNeighbors.begin(), batchNeighbors.end());
+
+    if (parallelNeighbors != serialNeighbors)
+    {
+      std::cout << "Test failed! Neighbors of query " << i << " differ between the serial and the parallel tree."
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    if (batchNeighbors != serialNeighbors)
+    {
+      std::cout << "Test failed! BatchSearch neighbors of query " << i << " differ from per-query Search."
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  std::cout << "Test passed." << std::endl;
+  return EXIT_SUCCESS;
+}
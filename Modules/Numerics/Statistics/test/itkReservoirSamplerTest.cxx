@@ -0,0 +1,164 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include <iostream>
+#include "itkListSample.h"
+#include "itkReservoirSampler.h"
+#include "itkMath.h"
+
+int
+itkReservoirSamplerTest(int, char *[])
+{
+
+  using MeasurementVectorType = itk::FixedArray<float, 1>;
+
+  using SampleType = itk::Statistics::ListSample<MeasurementVectorType>;
+
+  using FilterType = itk::Statistics::ReservoirSampler<SampleType>;
+
+  using SubsampleType = FilterType::OutputType;
+  using InstanceIdentifier = FilterType::InstanceIdentifier;
+
+  constexpr InstanceIdentifier sampleSize = 100;
+  constexpr InstanceIdentifier subsampleSize = 10;
+
+  auto sample = SampleType::New();
+
+  MeasurementVectorType measurement;
+  for (InstanceIdentifier id = 0; id < sampleSize; ++id)
+  {
+    measurement[0] = static_cast<float>(id);
+    sample->PushBack(measurement);
+  }
+
+  auto filter = FilterType::New();
+  filter->SetInput(sample);
+  filter->SetNumberOfSubsampleInstances(subsampleSize);
+  filter->SetSeed(42);
+
+  if (filter->GetNumberOfSubsampleInstances() != subsampleSize)
+  {
+    std::cerr << "GetNumberOfSubsampleInstances() didn't match SetNumberOfSubsampleInstances()" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if (filter->GetSeed() != 42)
+  {
+    std::cerr << "GetSeed() didn't match SetSeed()" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  filter->Update();
+
+  const SubsampleType * subsample = filter->GetOutput();
+
+  if (subsample->Size() != subsampleSize)
+  {
+    std::cerr << "Subsample has the wrong size: " << subsample->Size() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The identifiers must be strictly increasing and the subsample must
+  // refer to the measurement vectors of the input sample without copying
+  // them
+  const SubsampleType::InstanceIdentifierHolder & idHolder = subsample->GetIdHolder();
+  for (InstanceIdentifier i = 0; i < subsampleSize; ++i)
+  {
+    if (i > 0 && idHolder[i] <= idHolder[i - 1])
+    {
+      std::cerr << "Identifiers are not strictly increasing" << std::endl;
+      return EXIT_FAILURE;
+    }
+    if (itk::Math::NotExactlyEquals(subsample->GetMeasurementVector(i)[0], static_cast<float>(idHolder[i])))
+    {
+      std::cerr << "Subsample does not refer to the input sample" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // The selection must be reproducible for a fixed seed
+  auto filter2 = FilterType::New();
+  filter2->SetInput(sample);
+  filter2->SetNumberOfSubsampleInstances(subsampleSize);
+  filter2->SetSeed(42);
+  filter2->Update();
+
+  if (filter2->GetOutput()->GetIdHolder() != idHolder)
+  {
+    std::cerr << "Selection is not reproducible for a fixed seed" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The stratified selection must pick one instance from each contiguous
+  // stratum
+  auto stratifiedFilter = FilterType::New();
+  stratifiedFilter->SetInput(sample);
+  stratifiedFilter->SetNumberOfSubsampleInstances(subsampleSize);
+  stratifiedFilter->SetSeed(42);
+  stratifiedFilter->UseStratifiedSelectionOn();
+  stratifiedFilter->Update();
+
+  const SubsampleType::InstanceIdentifierHolder & stratifiedIds = stratifiedFilter->GetOutput()->GetIdHolder();
+  if (stratifiedIds.size() != subsampleSize)
+  {
+    std::cerr << "Stratified subsample has the wrong size: " << stratifiedIds.size() << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (InstanceIdentifier stratum = 0; stratum < subsampleSize; ++stratum)
+  {
+    const InstanceIdentifier stratumBegin = stratum * sampleSize / subsampleSize;
+    const InstanceIdentifier stratumEnd = (stratum + 1) * sampleSize / subsampleSize;
+    if (stratifiedIds[stratum] < stratumBegin || stratifiedIds[stratum] >= stratumEnd)
+    {
+      std::cerr << "Stratified selection picked an instance outside of stratum " << stratum << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // The frequency-weighted selection of a ListSample, where every
+  // frequency is one, must still produce a subsample of the requested
+  // size
+  auto weightedFilter = FilterType::New();
+  weightedFilter->SetInput(sample);
+  weightedFilter->SetNumberOfSubsampleInstances(subsampleSize);
+  weightedFilter->SetSeed(42);
+  weightedFilter->WeightedByFrequencyOn();
+  weightedFilter->Update();
+
+  if (weightedFilter->GetOutput()->Size() != subsampleSize)
+  {
+    std::cerr << "Weighted subsample has the wrong size: " << weightedFilter->GetOutput()->Size() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Requesting more instances than the sample holds must select the
+  // whole sample
+  auto completeFilter = FilterType::New();
+  completeFilter->SetInput(sample);
+  completeFilter->SetNumberOfSubsampleInstances(2 * sampleSize);
+  completeFilter->Update();
+
+  if (completeFilter->GetOutput()->Size() != sampleSize)
+  {
+    std::cerr << "Oversized request did not select the whole sample" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Test passed." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,124 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include <cmath>
+#include <iostream>
+
+#include "itkCovarianceSampleFilter.h"
+#include "itkListSample.h"
+#include "itkMeanSampleFilter.h"
+#include "itkMersenneTwisterRandomVariateGenerator.h"
+
+/* Checks that the sharded mean and covariance accumulation agree with the
+ * serial one up to floating-point merge rounding. */
+
+int
+itkSampleStatisticsShardedTest(int, char *[])
+{
+  using MeasurementVectorType = itk::Array<double>;
+  using SampleType = itk::Statistics::ListSample<MeasurementVectorType>;
+  using MeanFilterType = itk::Statistics::MeanSampleFilter<SampleType>;
+  using CovarianceFilterType = itk::Statistics::CovarianceSampleFilter<SampleType>;
+
+  constexpr unsigned int measurementVectorSize = 3;
+  constexpr unsigned int sampleSize = 10007;
+  constexpr double       tolerance = 1e-8;
+
+  auto randomGenerator = itk::Statistics::MersenneTwisterRandomVariateGenerator::New();
+  randomGenerator->SetSeed(1234);
+
+  auto sample = SampleType::New();
+  sample->SetMeasurementVectorSize(measurementVectorSize);
+
+  MeasurementVectorType mv(measurementVectorSize);
+  for (unsigned int i = 0; i < sampleSize; ++i)
+  {
+    for (unsigned int d = 0; d < measurementVectorSize; ++d)
+    {
+      mv[d] = randomGenerator->GetNormalVariate(static_cast<double>(d), 2.0 + d);
+    }
+    sample->PushBack(mv);
+  }
+
+  auto serialMeanFilter = MeanFilterType::New();
+  serialMeanFilter->SetInput(sample);
+  serialMeanFilter->Update();
+
+  auto shardedMeanFilter = MeanFilterType::New();
+  shardedMeanFilter->SetInput(sample);
+  shardedMeanFilter->UseMultipleWorkUnitsOn();
+  shardedMeanFilter->SetNumberOfWorkUnits(4);
+  if (!shardedMeanFilter->GetUseMultipleWorkUnits())
+  {
+    std::cout << "Test failed! GetUseMultipleWorkUnits expected to be On." << std::endl;
+    return EXIT_FAILURE;
+  }
+  shardedMeanFilter->Update();
+
+  const MeanFilterType::MeasurementVectorRealType serialMean = serialMeanFilter->GetMean();
+  const MeanFilterType::MeasurementVectorRealType shardedMean = shardedMeanFilter->GetMean();
+
+  for (unsigned int d = 0; d < measurementVectorSize; ++d)
+  {
+    if (std::abs(shardedMean[d] - serialMean[d]) > tolerance)
+    {
+      std::cout << "Test failed! Sharded mean " << shardedMean << " differs from serial mean " << serialMean
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  auto serialCovarianceFilter = CovarianceFilterType::New();
+  serialCovarianceFilter->SetInput(sample);
+  serialCovarianceFilter->Update();
+
+  auto shardedCovarianceFilter = CovarianceFilterType::New();
+  shardedCovarianceFilter->SetInput(sample);
+  shardedCovarianceFilter->UseMultipleWorkUnitsOn();
+  shardedCovarianceFilter->SetNumberOfWorkUnits(4);
+  shardedCovarianceFilter->Update();
+
+  const CovarianceFilterType::MatrixType serialCovariance = serialCovarianceFilter->GetCovarianceMatrix();
+  const CovarianceFilterType::MatrixType shardedCovariance = shardedCovarianceFilter->GetCovarianceMatrix();
+
+  for (unsigned int row = 0; row < measurementVectorSize; ++row)
+  {
+    for (unsigned int col = 0; col < measurementVectorSize; ++col)
+    {
+      if (std::abs(shardedCovariance(row, col) - serialCovariance(row, col)) > tolerance)
+      {
+        std::cout << "Test failed! Sharded covariance differs at (" << row << ", " << col
+                  << "): " << shardedCovariance(row, col) << " vs " << serialCovariance(row, col) << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  const CovarianceFilterType::MeasurementVectorRealType shardedCovarianceMean = shardedCovarianceFilter->GetMean();
+  for (unsigned int d = 0; d < measurementVectorSize; ++d)
+  {
+    if (std::abs(shardedCovarianceMean[d] - serialMean[d]) > tolerance)
+    {
+      std::cout << "Test failed! The covariance filter's sharded mean differs from the serial mean." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  std::cout << "Test passed." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -22,6 +22,7 @@
 
 #include "itkBSplineDecompositionImageFilter.h"
 #include "itkBSplineResampleImageFunction.h"
+#include "itkMultiThreaderBase.h"
 #include "itkResampleImageFilter.h"
 
 namespace itk
@@ -236,39 +237,49 @@ BSplineTransformParametersAdaptor<TTransform>::AdaptTransformParameters()
 
   CoefficientImageArray newCoefficientImages;
 
-  // Loop over dimension: each direction is upsampled separately.
-  for (SizeValueType j = 0; j < SpaceDimension; ++j)
-  {
-    /* Set the coefficient image as the input of the upsampler filter.
-     * The upsampler samples the deformation field at the locations
-     * of the new control points, given the current coefficients
-     * (note: it does not just interpolate the coefficient image,
-     * which would be wrong). The B-spline coefficients that
-     * describe the resulting image are computed by the
-     * decomposition filter.
-     *
-     * This code is copied from the itk-example
-     * DeformableRegistration6.cxx .
-     */
-    auto upsampler = UpsampleFilterType::New();
-    auto coeffUpsampleFunction = CoefficientUpsampleFunctionType::New();
-
-    upsampler->SetInterpolator(coeffUpsampleFunction);
-    upsampler->SetSize(newGridSize);
-    upsampler->SetOutputStartIndex(newGridIndex);
-    upsampler->SetOutputSpacing(newGridSpacing);
-    upsampler->SetOutputOrigin(newGridOrigin);
-    upsampler->SetOutputDirection(newGridDirection);
-    upsampler->SetInput(this->m_Transform->GetCoefficientImages()[j]);
-
-    auto decompositionFilter = DecompositionFilterType::New();
-    decompositionFilter->SetSplineOrder(TransformType::SplineOrder);
-    decompositionFilter->SetInput(upsampler->GetOutput());
-
-    newCoefficientImages[j] = decompositionFilter->GetOutput();
-    newCoefficientImages[j]->Update();
-    newCoefficientImages[j]->DisconnectPipeline();
-  }
+  /* Each direction is upsampled separately and independently of the
+   * others, so the per-dimension pipelines run concurrently.  The filters
+   * inside each pipeline are restricted to one work unit so the pipelines
+   * do not wait on the shared thread pool from within its workers. */
+  MultiThreaderBase::Pointer multiThreader = MultiThreaderBase::New();
+  multiThreader->ParallelizeArray(
+    0,
+    SpaceDimension,
+    [this, &newCoefficientImages, &newGridSize, &newGridIndex, &newGridSpacing, &newGridOrigin, &newGridDirection](
+      SizeValueType j) {
+      /* Set the coefficient image as the input of the upsampler filter.
+       * The upsampler samples the deformation field at the locations
+       * of the new control points, given the current coefficients
+       * (note: it does not just interpolate the coefficient image,
+       * which would be wrong). The B-spline coefficients that
+       * describe the resulting image are computed by the
+       * decomposition filter.
+       *
+       * This code is copied from the itk-example
+       * DeformableRegistration6.cxx .
+       */
+      auto upsampler = UpsampleFilterType::New();
+      auto coeffUpsampleFunction = CoefficientUpsampleFunctionType::New();
+
+      upsampler->SetInterpolator(coeffUpsampleFunction);
+      upsampler->SetSize(newGridSize);
+      upsampler->SetOutputStartIndex(newGridIndex);
+      upsampler->SetOutputSpacing(newGridSpacing);
+      upsampler->SetOutputOrigin(newGridOrigin);
+      upsampler->SetOutputDirection(newGridDirection);
+      upsampler->SetInput(this->m_Transform->GetCoefficientImages()[j]);
+      upsampler->SetNumberOfWorkUnits(1);
+
+      auto decompositionFilter = DecompositionFilterType::New();
+      decompositionFilter->SetSplineOrder(TransformType::SplineOrder);
+      decompositionFilter->SetInput(upsampler->GetOutput());
+      decompositionFilter->SetNumberOfWorkUnits(1);
+
+      newCoefficientImages[j] = decompositionFilter->GetOutput();
+      newCoefficientImages[j]->Update();
+      newCoefficientImages[j]->DisconnectPipeline();
+    },
+    nullptr);
 
   this->m_Transform->SetCoefficientImages(newCoefficientImages);
 }
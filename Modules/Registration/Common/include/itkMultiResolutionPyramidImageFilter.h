@@ -213,6 +213,19 @@ public:
   itkGetConstMacro(UseShrinkImageFilter, bool);
   itkBooleanMacro(UseShrinkImageFilter);
 
+  /** Set/Get whether the coarser levels are computed from the next finer
+   * level instead of from the full-resolution input (Gaussian cascade). Each
+   * cascade step smooths with the incremental variance needed to reach the
+   * coarser scale, so far less data is smoothed and shrunk for the coarse
+   * levels. The results approximate the default construction: the cascade is
+   * equivalent in the continuous domain but the intermediate downsampling
+   * introduces small differences. The cascade is only used when the schedule
+   * is downward divisible and all outputs are requested in full; otherwise
+   * the default construction is used. Off by default. */
+  itkSetMacro(UseCascadeMode, bool);
+  itkGetConstMacro(UseCascadeMode, bool);
+  itkBooleanMacro(UseCascadeMode);
+
 #ifdef ITK_USE_CONCEPT_CHECKING
   // Begin concept checking
   itkConceptMacro(SameDimensionCheck, (Concept::SameDimension<ImageDimension, OutputImageDimension>));
@@ -230,12 +243,24 @@ protected:
   void
   GenerateData() override;
 
+  /** Generate the output data by building each coarser level from the next
+   * finer one. Only called when the cascade conditions hold, see
+   * SetUseCascadeMode. */
+  void
+  GenerateDataByCascade();
+
+  /** Whether the current schedule and output requested regions allow the
+   * cascade construction. */
+  bool
+  CanUseCascade();
+
   double m_MaximumError;
 
   unsigned int m_NumberOfLevels;
   ScheduleType m_Schedule;
 
   bool m_UseShrinkImageFilter;
+  bool m_UseCascadeMode;
 };
 } // namespace itk
 
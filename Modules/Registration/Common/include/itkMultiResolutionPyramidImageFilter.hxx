@@ -41,6 +41,7 @@ MultiResolutionPyramidImageFilter<TInputImage, TOutputImage>::MultiResolutionPyr
   this->SetNumberOfLevels(2);
   m_MaximumError = 0.1;
   m_UseShrinkImageFilter = false;
+  m_UseCascadeMode = false;
 }
 
 /**
@@ -220,6 +221,135 @@ MultiResolutionPyramidImageFilter<TInputImage, TOutputImage>::IsScheduleDownward
   return true;
 }
 
+/*
+ * Test whether the cascade construction can be used
+ */
+template <typename TInputImage, typename TOutputImage>
+bool
+MultiResolutionPyramidImageFilter<TInputImage, TOutputImage>::CanUseCascade()
+{
+  if (!m_UseCascadeMode || !Self::IsScheduleDownwardDivisible(m_Schedule))
+  {
+    return false;
+  }
+
+  // Each coarser level is shrunk from the buffered next finer level, so all
+  // levels must be generated in full
+  for (unsigned int ilevel = 0; ilevel < m_NumberOfLevels; ++ilevel)
+  {
+    OutputImagePointer outputPtr = this->GetOutput(ilevel);
+    if (outputPtr->GetRequestedRegion() != outputPtr->GetLargestPossibleRegion())
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/*
+ * GenerateData building each coarser level from the next finer one
+ */
+template <typename TInputImage, typename TOutputImage>
+void
+MultiResolutionPyramidImageFilter<TInputImage, TOutputImage>::GenerateDataByCascade()
+{
+  // Get the input pointer
+  InputImageConstPointer inputPtr = this->GetInput();
+
+  using CasterType = CastImageFilter<TInputImage, TOutputImage>;
+  using SmootherType = DiscreteGaussianImageFilter<TOutputImage, TOutputImage>;
+
+  using ImageToImageType = ImageToImageFilter<TOutputImage, TOutputImage>;
+  using ResampleShrinkerType = ResampleImageFilter<TOutputImage, TOutputImage>;
+  using ShrinkerType = ShrinkImageFilter<TOutputImage, TOutputImage>;
+
+  auto caster = CasterType::New();
+  caster->SetInput(inputPtr);
+
+  unsigned int factors[ImageDimension];
+  double       variance[ImageDimension];
+
+  // The previously built level as a standalone image, used as the input of
+  // the next coarser level
+  OutputImagePointer finerLevel;
+
+  // Build the levels from fine to coarse
+  for (unsigned int i = 0; i < m_NumberOfLevels; ++i)
+  {
+    const unsigned int ilevel = m_NumberOfLevels - 1 - i;
+
+    this->UpdateProgress(static_cast<float>(i) / static_cast<float>(m_NumberOfLevels));
+
+    // Allocate memory for each output
+    OutputImagePointer outputPtr = this->GetOutput(ilevel);
+    outputPtr->SetBufferedRegion(outputPtr->GetRequestedRegion());
+    outputPtr->Allocate();
+
+    auto smoother = SmootherType::New();
+    smoother->SetUseImageSpacing(false);
+    smoother->SetMaximumError(m_MaximumError);
+
+    if (ilevel == m_NumberOfLevels - 1)
+    {
+      // The finest level is built from the input exactly as in the default
+      // construction
+      smoother->SetInput(caster->GetOutput());
+      for (unsigned int idim = 0; idim < ImageDimension; ++idim)
+      {
+        factors[idim] = m_Schedule[ilevel][idim];
+        variance[idim] = itk::Math::sqr(0.5 * static_cast<float>(factors[idim]));
+      }
+    }
+    else
+    {
+      // Coarser levels are built from the next finer level with the relative
+      // shrink factors. The finer level already carries a smoothing of
+      // sigma = 0.5 of its own pixel size and the coarser level needs
+      // 0.5 * factor, so only the incremental variance is applied
+      smoother->SetInput(finerLevel);
+      for (unsigned int idim = 0; idim < ImageDimension; ++idim)
+      {
+        factors[idim] = m_Schedule[ilevel][idim] / m_Schedule[ilevel + 1][idim];
+        variance[idim] = itk::Math::sqr(0.5 * static_cast<float>(factors[idim])) - 0.25;
+      }
+    }
+    smoother->SetVariance(variance);
+
+    typename ImageToImageType::Pointer shrinkerFilter;
+    if (this->GetUseShrinkImageFilter())
+    {
+      auto shrinker = ShrinkerType::New();
+      shrinker->SetShrinkFactors(factors);
+      shrinkerFilter = shrinker.GetPointer();
+    }
+    else
+    {
+      auto resampleShrinker = ResampleShrinkerType::New();
+      using LinearInterpolatorType = itk::LinearInterpolateImageFunction<OutputImageType, double>;
+      auto interpolator = LinearInterpolatorType::New();
+      resampleShrinker->SetInterpolator(interpolator);
+      resampleShrinker->SetDefaultPixelValue(0);
+      using IdentityTransformType = itk::IdentityTransform<double, OutputImageType::ImageDimension>;
+      auto identityTransform = IdentityTransformType::New();
+      resampleShrinker->SetOutputParametersFromImage(outputPtr);
+      resampleShrinker->SetTransform(identityTransform);
+      shrinkerFilter = resampleShrinker.GetPointer();
+    }
+
+    // use mini-pipeline to compute output
+    shrinkerFilter->SetInput(smoother->GetOutput());
+    shrinkerFilter->GraftOutput(outputPtr);
+    shrinkerFilter->UpdateLargestPossibleRegion();
+
+    // keep the result as a standalone image for the next coarser level and
+    // graft it onto our output
+    finerLevel = shrinkerFilter->GetOutput();
+    finerLevel->DisconnectPipeline();
+    this->GraftNthOutput(ilevel, finerLevel);
+  }
+}
+
 /*
  * GenerateData for non downward divisible schedules
  */
@@ -227,6 +357,12 @@ template <typename TInputImage, typename TOutputImage>
 void
 MultiResolutionPyramidImageFilter<TInputImage, TOutputImage>::GenerateData()
 {
+  if (this->CanUseCascade())
+  {
+    this->GenerateDataByCascade();
+    return;
+  }
+
   // Get the input and output pointers
   InputImageConstPointer inputPtr = this->GetInput();
 
@@ -328,6 +464,7 @@ MultiResolutionPyramidImageFilter<TInputImage, TOutputImage>::PrintSelf(std::ost
   os << indent << "Schedule: " << std::endl;
   os << m_Schedule << std::endl;
   os << "Use ShrinkImageFilter= " << m_UseShrinkImageFilter << std::endl;
+  os << "Use CascadeMode= " << m_UseCascadeMode << std::endl;
 }
 
 /*
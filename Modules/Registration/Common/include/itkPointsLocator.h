@@ -87,6 +87,14 @@ public:
   /** Set/Get the points from which the bounding box should be computed. */
   itkGetModifiableObjectMacro(Points, PointsContainer);
 
+  /** Set/Get the number of work units used to build the kd-tree. The
+   * default is the global number of work units of the MultiThreaderBase.
+   * The bulk build partitions the points with exact medians, so the
+   * resulting tree is identical to a serial build regardless of this
+   * setting; set it to one to force the serial construction. */
+  itkSetClampMacro(NumberOfWorkUnits, unsigned int, 1, ITK_MAX_THREADS);
+  itkGetConstMacro(NumberOfWorkUnits, unsigned int);
+
   /** Compute the kd-tree that will facilitate the querying the points. */
   void
   Initialize();
@@ -122,6 +130,7 @@ private:
   SampleAdaptorPointer   m_SampleAdaptor;
   TreeGeneratorPointer   m_KdTreeGenerator;
   TreeConstPointer       m_Tree;
+  unsigned int           m_NumberOfWorkUnits;
 };
 
 } // end namespace itk
@@ -18,6 +18,7 @@
 #ifndef itkPointsLocator_hxx
 #define itkPointsLocator_hxx
 #include "itkPointsLocator.h"
+#include "itkMultiThreaderBase.h"
 
 namespace itk
 {
@@ -27,6 +28,7 @@ PointsLocator<TPointsContainer>::PointsLocator()
 {
   this->m_SampleAdaptor = SampleAdaptorType::New();
   this->m_KdTreeGenerator = TreeGeneratorType::New();
+  this->m_NumberOfWorkUnits = MultiThreaderBase::New()->GetNumberOfWorkUnits();
 }
 
 template <typename TPointsContainer>
@@ -52,6 +54,7 @@ PointsLocator<TPointsContainer>::Initialize()
 
   this->m_KdTreeGenerator->SetSample(this->m_SampleAdaptor);
   this->m_KdTreeGenerator->SetBucketSize(16);
+  this->m_KdTreeGenerator->SetNumberOfWorkUnits(this->m_NumberOfWorkUnits);
 
   this->m_KdTreeGenerator->Update();
 
@@ -128,6 +131,7 @@ void
 PointsLocator<TPointsContainer>::PrintSelf(std::ostream & os, Indent indent) const
 {
   Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfWorkUnits: " << m_NumberOfWorkUnits << std::endl;
 }
 
 } // end namespace itk
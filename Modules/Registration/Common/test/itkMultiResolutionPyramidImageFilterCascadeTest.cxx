@@ -0,0 +1,166 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkMultiResolutionPyramidImageFilter.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkTestingMacros.h"
+
+#include <cmath>
+#include <iostream>
+
+int
+itkMultiResolutionPyramidImageFilterCascadeTest(int argc, char * argv[])
+{
+  using PixelType = float;
+  using ImageType = itk::Image<PixelType, 2>;
+  enum
+  {
+    ImageDimension = ImageType::ImageDimension
+  };
+
+  bool useShrinkFilter(false);
+  if (argc > 1)
+  {
+    std::string s(argv[1]);
+    if (s == "Shrink")
+    {
+      useShrinkFilter = true;
+    }
+  }
+
+  // Create a smooth test image with a few features
+  ImageType::SizeType   size = { { 128, 96 } };
+  ImageType::RegionType region;
+  region.SetSize(size);
+
+  auto input = ImageType::New();
+  input->SetRegions(region);
+  input->Allocate();
+
+  itk::ImageRegionIterator<ImageType> it(input, region);
+  while (!it.IsAtEnd())
+  {
+    const double x = it.GetIndex()[0] - 64.0;
+    const double y = it.GetIndex()[1] - 48.0;
+    it.Set(static_cast<PixelType>(100.0 * std::exp(-(x * x + y * y) / 900.0) + 0.3 * x + 0.1 * y));
+    ++it;
+  }
+
+  using PyramidType = itk::MultiResolutionPyramidImageFilter<ImageType, ImageType>;
+
+  constexpr unsigned int numLevels = 3;
+
+  auto reference = PyramidType::New();
+  reference->SetUseShrinkImageFilter(useShrinkFilter);
+  reference->SetInput(input);
+  reference->SetNumberOfLevels(numLevels);
+
+  auto cascade = PyramidType::New();
+  cascade->SetUseShrinkImageFilter(useShrinkFilter);
+  cascade->SetInput(input);
+  cascade->SetNumberOfLevels(numLevels);
+
+  // exercise the Set/Get methods
+  ITK_TEST_SET_GET_BOOLEAN(cascade, UseCascadeMode, true);
+
+  ITK_TRY_EXPECT_NO_EXCEPTION(reference->UpdateLargestPossibleRegion());
+  ITK_TRY_EXPECT_NO_EXCEPTION(cascade->UpdateLargestPossibleRegion());
+
+  // The cascade approximates the default construction: the two pyramids must
+  // share the same geometry and the pixel values must agree closely
+  for (unsigned int ilevel = 0; ilevel < numLevels; ++ilevel)
+  {
+    ImageType::Pointer referenceLevel = reference->GetOutput(ilevel);
+    ImageType::Pointer cascadeLevel = cascade->GetOutput(ilevel);
+
+    if (cascadeLevel->GetLargestPossibleRegion() != referenceLevel->GetLargestPossibleRegion() ||
+        cascadeLevel->GetSpacing() != referenceLevel->GetSpacing() ||
+        cascadeLevel->GetOrigin() != referenceLevel->GetOrigin())
+    {
+      std::cout << "Level " << ilevel << " geometry differs between cascade and default construction." << std::endl;
+      referenceLevel->Print(std::cout);
+      cascadeLevel->Print(std::cout);
+      return EXIT_FAILURE;
+    }
+
+    if (cascadeLevel->GetBufferedRegion() != cascadeLevel->GetLargestPossibleRegion())
+    {
+      std::cout << "Level " << ilevel << " buffered region incorrect." << std::endl;
+      cascadeLevel->Print(std::cout);
+      return EXIT_FAILURE;
+    }
+
+    itk::ImageRegionConstIterator<ImageType> referenceIt(referenceLevel, referenceLevel->GetBufferedRegion());
+    itk::ImageRegionConstIterator<ImageType> cascadeIt(cascadeLevel, cascadeLevel->GetBufferedRegion());
+
+    double sumSquaredError = 0.0;
+    while (!referenceIt.IsAtEnd())
+    {
+      const double error = static_cast<double>(referenceIt.Get()) - static_cast<double>(cascadeIt.Get());
+      sumSquaredError += error * error;
+      ++referenceIt;
+      ++cascadeIt;
+    }
+    const double rmsError =
+      std::sqrt(sumSquaredError / static_cast<double>(referenceLevel->GetBufferedRegion().GetNumberOfPixels()));
+
+    // pixel values span roughly [-25, 100]; the intermediate downsampling of
+    // the cascade only introduces small differences on a smooth image
+    constexpr double rmsErrorAllowed = 1.0;
+    std::cout << "Level " << ilevel << " RMS difference to default construction: " << rmsError << std::endl;
+    if (rmsError > rmsErrorAllowed)
+    {
+      std::cout << "RMS difference exceeds " << rmsErrorAllowed << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // The finest level is built identically in both modes
+  {
+    itk::ImageRegionConstIterator<ImageType> referenceIt(reference->GetOutput(numLevels - 1),
+                                                         reference->GetOutput(numLevels - 1)->GetBufferedRegion());
+    itk::ImageRegionConstIterator<ImageType> cascadeIt(cascade->GetOutput(numLevels - 1),
+                                                       cascade->GetOutput(numLevels - 1)->GetBufferedRegion());
+    while (!referenceIt.IsAtEnd())
+    {
+      if (itk::Math::NotExactlyEquals(referenceIt.Get(), cascadeIt.Get()))
+      {
+        std::cout << "Finest level differs between cascade and default construction at " << referenceIt.GetIndex()
+                  << std::endl;
+        return EXIT_FAILURE;
+      }
+      ++referenceIt;
+      ++cascadeIt;
+    }
+  }
+
+  // A non downward divisible schedule must fall back to the default
+  // construction without error
+  PyramidType::ScheduleType schedule = cascade->GetSchedule();
+  schedule[0][0] = 3;
+  cascade->SetSchedule(schedule);
+  if (PyramidType::IsScheduleDownwardDivisible(cascade->GetSchedule()))
+  {
+    std::cout << "Schedule expected to not be downward divisible" << std::endl;
+    return EXIT_FAILURE;
+  }
+  ITK_TRY_EXPECT_NO_EXCEPTION(cascade->UpdateLargestPossibleRegion());
+
+  std::cout << "Test passed." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -24,6 +24,7 @@
 #include "itkConstNeighborhoodIterator.h"
 
 #include <deque>
+#include <vector>
 
 namespace itk
 {
@@ -143,6 +144,17 @@ public:
     typename MovingImageType::ConstPointer  movingImage;
     typename VirtualImageType::ConstPointer virtualImage;
     RadiusType                              radius;
+
+    // Per-voxel fixed and moving evaluations precomputed over the scan
+    // region padded by the radius.  Populated by the dense threader so a
+    // voxel shared by neighboring scanning windows is transformed and
+    // interpolated only once instead of once per window line.  Left empty
+    // by the sparse threader, in which case the window voxels are
+    // evaluated directly.
+    ImageRegionType                   evaluationCacheRegion;
+    std::vector<FixedImagePixelType>  cachedFixedValues;
+    std::vector<MovingImagePixelType> cachedMovingValues;
+    std::vector<unsigned char>        cachedPointValidity;
   };
 
 protected:
@@ -256,6 +268,23 @@ protected:
                      ScanMemType &           scanMem,
                      ScanParametersType &    scanParameters) const;
 
+  /** Evaluate the fixed and moving images at every voxel of the scan
+   * region padded by the radius and store the results in \c
+   * scanParameters.  Used by the dense threader, where consecutive
+   * scanning windows revisit the same voxels many times. */
+  void
+  PopulateEvaluationCache(ScanParametersType & scanParameters) const;
+
+  /** Return the fixed and moving intensities for one window voxel,
+   * served from the evaluation cache when it has been populated and
+   * computed directly otherwise.  Returns false when the voxel is
+   * rejected by a mask or falls outside an image buffer. */
+  bool
+  EvaluateWindowVoxel(const typename VirtualImageType::IndexType & index,
+                      const ScanParametersType &                   scanParameters,
+                      FixedImagePixelType &                        fixedImageValue,
+                      MovingImagePixelType &                       movingImageValue) const;
+
   /** Update the queues for the next point.  Calls either \c
    * UpdateQueuesAtBeginningOfLine or \c UpdateQueuesToNextScanWindow. */
   void
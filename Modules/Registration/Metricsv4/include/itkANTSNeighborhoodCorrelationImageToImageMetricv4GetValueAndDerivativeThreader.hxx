@@ -19,6 +19,7 @@
 #define itkANTSNeighborhoodCorrelationImageToImageMetricv4GetValueAndDerivativeThreader_hxx
 
 #include "itkANTSNeighborhoodCorrelationImageToImageMetricv4GetValueAndDerivativeThreader.h"
+#include "itkImageRegionConstIteratorWithIndex.h"
 
 namespace itk
 {
@@ -54,6 +55,12 @@ ANTSNeighborhoodCorrelationImageToImageMetricv4GetValueAndDerivativeThreader<TDo
   // this->m_ANTSAssociate->InitializeScanning( virtualImageSubRegion, scanIt, scanMem, scanParameters );
   this->InitializeScanning(virtualImageSubRegion, scanIt, scanMem, scanParameters);
 
+  /* Evaluate the images over the padded sub region once up front.  The
+   * scanning windows of neighboring lines revisit the same voxels, so
+   * serving the window sums from this cache saves the repeated transform
+   * and interpolation calls without changing any summation order. */
+  this->PopulateEvaluationCache(scanParameters);
+
   /* Iterate over the sub region */
   scanIt.GoToBegin();
   while (!scanIt.IsAtEnd())
@@ -171,33 +178,10 @@ ANTSNeighborhoodCorrelationImageToImageMetricv4GetValueAndDerivativeThreader<
 
       typename VirtualImageType::IndexType index = scanIt.GetIndex(indct);
 
-      VirtualPointType     virtualPoint;
-      FixedImagePointType  mappedFixedPoint;
       FixedImagePixelType  fixedImageValue;
-      MovingImagePointType mappedMovingPoint;
       MovingImagePixelType movingImageValue;
-      bool                 pointIsValid;
-
-      this->m_ANTSAssociate->TransformVirtualIndexToPhysicalPoint(index, virtualPoint);
-
-      try
-      {
-        pointIsValid =
-          this->m_ANTSAssociate->TransformAndEvaluateFixedPoint(virtualPoint, mappedFixedPoint, fixedImageValue);
-        if (pointIsValid)
-        {
-          pointIsValid =
-            this->m_ANTSAssociate->TransformAndEvaluateMovingPoint(virtualPoint, mappedMovingPoint, movingImageValue);
-        }
-      }
-      catch (ExceptionObject & exc)
-      {
-        // NOTE: there must be a cleaner way to do this:
-        std::string msg("Caught exception: \n");
-        msg += exc.what();
-        throw ExceptionObject(__FILE__, __LINE__, msg);
-      }
 
+      const bool pointIsValid = this->EvaluateWindowVoxel(index, scanParameters, fixedImageValue, movingImageValue);
 
       if (pointIsValid)
       {
@@ -256,31 +240,11 @@ ANTSNeighborhoodCorrelationImageToImageMetricv4GetValueAndDerivativeThreader<
 
     typename VirtualImageType::IndexType index = scanIt.GetIndex(indct);
 
-    VirtualPointType     virtualPoint;
-    FixedImagePointType  mappedFixedPoint;
     FixedImagePixelType  fixedImageValue;
-    MovingImagePointType mappedMovingPoint;
     MovingImagePixelType movingImageValue;
-    bool                 pointIsValid;
 
-    this->m_ANTSAssociate->TransformVirtualIndexToPhysicalPoint(index, virtualPoint);
-    try
-    {
-      pointIsValid =
-        this->m_ANTSAssociate->TransformAndEvaluateFixedPoint(virtualPoint, mappedFixedPoint, fixedImageValue);
-      if (pointIsValid)
-      {
-        pointIsValid =
-          this->m_ANTSAssociate->TransformAndEvaluateMovingPoint(virtualPoint, mappedMovingPoint, movingImageValue);
-      }
-    }
-    catch (ExceptionObject & exc)
-    {
-      // NOTE: there must be a cleaner way to do this:
-      std::string msg("Caught exception: \n");
-      msg += exc.what();
-      throw ExceptionObject(__FILE__, __LINE__, msg);
-    }
+    const bool pointIsValid = this->EvaluateWindowVoxel(index, scanParameters, fixedImageValue, movingImageValue);
+
     if (pointIsValid)
     {
       sumFixed2 += fixedImageValue * fixedImageValue;
@@ -347,6 +311,123 @@ ANTSNeighborhoodCorrelationImageToImageMetricv4GetValueAndDerivativeThreader<
   scanMem.mappedMovingPoint.Fill(0.0);
 }
 
+template <typename TDomainPartitioner, typename TImageToImageMetric, typename TNeighborhoodCorrelationMetric>
+void
+ANTSNeighborhoodCorrelationImageToImageMetricv4GetValueAndDerivativeThreader<
+  TDomainPartitioner,
+  TImageToImageMetric,
+  TNeighborhoodCorrelationMetric>::PopulateEvaluationCache(ScanParametersType & scanParameters) const
+{
+  ImageRegionType cacheRegion = scanParameters.scanRegion;
+  cacheRegion.PadByRadius(scanParameters.radius);
+  cacheRegion.Crop(scanParameters.virtualImage->GetBufferedRegion());
+
+  const SizeValueType numberOfVoxels = cacheRegion.GetNumberOfPixels();
+  scanParameters.evaluationCacheRegion = cacheRegion;
+  scanParameters.cachedFixedValues.resize(numberOfVoxels);
+  scanParameters.cachedMovingValues.resize(numberOfVoxels);
+  scanParameters.cachedPointValidity.assign(numberOfVoxels, 0);
+
+  ImageRegionConstIteratorWithIndex<VirtualImageType> it(scanParameters.virtualImage, cacheRegion);
+  SizeValueType                                       offset = 0;
+  for (it.GoToBegin(); !it.IsAtEnd(); ++it, ++offset)
+  {
+    VirtualPointType     virtualPoint;
+    FixedImagePointType  mappedFixedPoint;
+    FixedImagePixelType  fixedImageValue;
+    MovingImagePointType mappedMovingPoint;
+    MovingImagePixelType movingImageValue;
+    bool                 pointIsValid;
+
+    this->m_ANTSAssociate->TransformVirtualIndexToPhysicalPoint(it.GetIndex(), virtualPoint);
+
+    try
+    {
+      pointIsValid =
+        this->m_ANTSAssociate->TransformAndEvaluateFixedPoint(virtualPoint, mappedFixedPoint, fixedImageValue);
+      if (pointIsValid)
+      {
+        pointIsValid =
+          this->m_ANTSAssociate->TransformAndEvaluateMovingPoint(virtualPoint, mappedMovingPoint, movingImageValue);
+      }
+    }
+    catch (ExceptionObject & exc)
+    {
+      // NOTE: there must be a cleaner way to do this:
+      std::string msg("Caught exception: \n");
+      msg += exc.what();
+      throw ExceptionObject(__FILE__, __LINE__, msg);
+    }
+
+    if (pointIsValid)
+    {
+      scanParameters.cachedFixedValues[offset] = fixedImageValue;
+      scanParameters.cachedMovingValues[offset] = movingImageValue;
+      scanParameters.cachedPointValidity[offset] = 1;
+    }
+  }
+}
+
+template <typename TDomainPartitioner, typename TImageToImageMetric, typename TNeighborhoodCorrelationMetric>
+bool
+ANTSNeighborhoodCorrelationImageToImageMetricv4GetValueAndDerivativeThreader<
+  TDomainPartitioner,
+  TImageToImageMetric,
+  TNeighborhoodCorrelationMetric>::EvaluateWindowVoxel(const typename VirtualImageType::IndexType & index,
+                                                       const ScanParametersType &                   scanParameters,
+                                                       FixedImagePixelType &                        fixedImageValue,
+                                                       MovingImagePixelType & movingImageValue) const
+{
+  if (!scanParameters.cachedPointValidity.empty())
+  {
+    /* The cache is stored in the row major order of
+     * ImageRegionConstIteratorWithIndex over the cache region. */
+    const ImageRegionType & cacheRegion = scanParameters.evaluationCacheRegion;
+    SizeValueType           offset = 0;
+    SizeValueType           stride = 1;
+    for (ImageDimensionType d = 0; d < TImageToImageMetric::VirtualImageDimension; ++d)
+    {
+      offset += static_cast<SizeValueType>(index[d] - cacheRegion.GetIndex(d)) * stride;
+      stride *= cacheRegion.GetSize(d);
+    }
+
+    if (!scanParameters.cachedPointValidity[offset])
+    {
+      return false;
+    }
+    fixedImageValue = scanParameters.cachedFixedValues[offset];
+    movingImageValue = scanParameters.cachedMovingValues[offset];
+    return true;
+  }
+
+  VirtualPointType     virtualPoint;
+  FixedImagePointType  mappedFixedPoint;
+  MovingImagePointType mappedMovingPoint;
+  bool                 pointIsValid;
+
+  this->m_ANTSAssociate->TransformVirtualIndexToPhysicalPoint(index, virtualPoint);
+
+  try
+  {
+    pointIsValid =
+      this->m_ANTSAssociate->TransformAndEvaluateFixedPoint(virtualPoint, mappedFixedPoint, fixedImageValue);
+    if (pointIsValid)
+    {
+      pointIsValid =
+        this->m_ANTSAssociate->TransformAndEvaluateMovingPoint(virtualPoint, mappedMovingPoint, movingImageValue);
+    }
+  }
+  catch (ExceptionObject & exc)
+  {
+    // NOTE: there must be a cleaner way to do this:
+    std::string msg("Caught exception: \n");
+    msg += exc.what();
+    throw ExceptionObject(__FILE__, __LINE__, msg);
+  }
+
+  return pointIsValid;
+}
+
 template <typename TDomainPartitioner, typename TImageToImageMetric, typename TNeighborhoodCorrelationMetric>
 void
 ANTSNeighborhoodCorrelationImageToImageMetricv4GetValueAndDerivativeThreader<
@@ -32,6 +32,8 @@
 #include "itkDefaultConvertPixelTraits.h"
 #include "itkDefaultImageToImageMetricTraitsv4.h"
 
+#include <vector>
+
 namespace itk
 {
 /** \class ImageToImageMetricv4
@@ -471,6 +473,21 @@ public:
   itkGetConstReferenceMacro(UseMovingImageGradientFilter, bool);
   itkBooleanMacro(UseMovingImageGradientFilter);
 
+  /** Set/Get caching of the fixed image evaluations. When enabled, the
+   * mapped fixed image point, pixel value and, when required, gradient of
+   * every visited virtual point are stored during the first metric
+   * evaluation and reused by all subsequent evaluations. The cache is
+   * rebuilt whenever the fixed image, the fixed transform, the virtual
+   * domain or any other metric setting is modified, so it only pays off
+   * when the fixed transform is not among the transforms being optimized,
+   * which is the common arrangement during registration. The cache stores
+   * an entry for every pixel of the virtual domain and thus trades a
+   * considerable amount of memory for the per-iteration interpolation
+   * cost. Off by default. */
+  itkSetMacro(UseFixedImageEvaluationCache, bool);
+  itkGetConstReferenceMacro(UseFixedImageEvaluationCache, bool);
+  itkBooleanMacro(UseFixedImageEvaluationCache);
+
   /** Get number of work units to used in the the most recent
    * evaluation.  Only valid after GetValueAndDerivative() or
    * GetValue() has been called. */
@@ -656,6 +673,19 @@ protected:
   virtual void
   ComputeFixedImageGradientAtPoint(const FixedImagePointType & mappedPoint, FixedImageGradientType & gradient) const;
 
+  /** As TransformAndEvaluateFixedPoint followed by
+   * ComputeFixedImageGradientAtPoint, but served from the fixed image
+   * evaluation cache once it has been populated. Called by the threaders
+   * in place of those two methods when UseFixedImageEvaluationCache is
+   * enabled. */
+  bool
+  EvaluateFixedPointThroughCache(const VirtualIndexType & virtualIndex,
+                                 const VirtualPointType & virtualPoint,
+                                 bool                     computeGradient,
+                                 FixedImagePointType &    mappedFixedPoint,
+                                 FixedImagePixelType &    mappedFixedPixelValue,
+                                 FixedImageGradientType & mappedFixedImageGradient) const;
+
   /** Compute image derivatives for a moving point. */
   virtual void
   ComputeMovingImageGradientAtPoint(const MovingImagePointType & mappedPoint, MovingImageGradientType & gradient) const;
@@ -750,6 +780,22 @@ protected:
   FixedSampledPointSet */
   bool m_UseVirtualSampledPointSet;
 
+  /** Flag to reuse fixed image evaluations across metric evaluations. */
+  bool m_UseFixedImageEvaluationCache;
+
+  /** The fixed image evaluation cache. It is populated lazily during the
+   * first evaluation after it has been invalidated; each virtual point is
+   * visited by exactly one work unit, so the population pass needs no
+   * locking. */
+  mutable bool                                m_FixedEvaluationCachePopulated;
+  mutable bool                                m_FixedEvaluationCacheHasGradients;
+  mutable ModifiedTimeType                    m_FixedEvaluationCacheTime;
+  mutable VirtualRegionType                   m_FixedEvaluationCacheRegion;
+  mutable std::vector<unsigned char>          m_FixedCachedPointValidity;
+  mutable std::vector<FixedImagePointType>    m_FixedCachedPoints;
+  mutable std::vector<FixedImagePixelType>    m_FixedCachedPixelValues;
+  mutable std::vector<FixedImageGradientType> m_FixedCachedGradients;
+
   ImageToImageMetricv4();
   ~ImageToImageMetricv4() override = default;
 
@@ -25,6 +25,8 @@
 #include "itkLinearInterpolateImageFunction.h"
 #include "itkIdentityTransform.h"
 
+#include <algorithm>
+
 namespace itk
 {
 
@@ -68,6 +70,11 @@ ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputat
   this->m_UseSampledPointSet = false;
   this->m_UseVirtualSampledPointSet = false;
 
+  this->m_UseFixedImageEvaluationCache = false;
+  this->m_FixedEvaluationCachePopulated = false;
+  this->m_FixedEvaluationCacheHasGradients = false;
+  this->m_FixedEvaluationCacheTime = 0;
+
   this->m_FloatingPointCorrectionResolution = 1e6;
   this->m_UseFloatingPointCorrection = false;
 
@@ -279,6 +286,13 @@ ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputat
   {
     this->m_DenseGetValueAndDerivativeThreader->Execute(const_cast<Self *>(this), this->GetVirtualRegion());
   }
+
+  /* Every virtual point has now been visited once, so the lazily filled
+   * fixed evaluation cache is complete. */
+  if (this->m_UseFixedImageEvaluationCache)
+  {
+    this->m_FixedEvaluationCachePopulated = true;
+  }
 }
 
 template <typename TFixedImage,
@@ -301,6 +315,29 @@ ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputat
     /* Clear derivative final result. */
     this->m_DerivativeResult->Fill(NumericTraits<DerivativeValueType>::ZeroValue());
   }
+
+  if (this->m_UseFixedImageEvaluationCache)
+  {
+    /* Invalidate the fixed evaluation cache when the fixed image, the
+     * fixed transform or any metric setting has been modified since it was
+     * populated, or when gradients are now required but were not cached. */
+    const ModifiedTimeType stamp =
+      std::max({ this->GetMTime(), this->m_FixedTransform->GetMTime(), this->m_FixedImage->GetMTime() });
+    const bool needGradients = this->m_ComputeDerivative && this->GetGradientSourceIncludesFixed();
+    if (stamp != this->m_FixedEvaluationCacheTime ||
+        (needGradients && !this->m_FixedEvaluationCacheHasGradients))
+    {
+      this->m_FixedEvaluationCacheRegion = this->GetVirtualRegion();
+      const SizeValueType numberOfPixels = this->m_FixedEvaluationCacheRegion.GetNumberOfPixels();
+      this->m_FixedCachedPointValidity.assign(numberOfPixels, 0);
+      this->m_FixedCachedPoints.resize(numberOfPixels);
+      this->m_FixedCachedPixelValues.resize(numberOfPixels);
+      this->m_FixedCachedGradients.resize(needGradients ? numberOfPixels : 0);
+      this->m_FixedEvaluationCacheHasGradients = needGradients;
+      this->m_FixedEvaluationCacheTime = stamp;
+      this->m_FixedEvaluationCachePopulated = false;
+    }
+  }
 }
 
 template <typename TFixedImage,
@@ -421,6 +458,66 @@ ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputat
   }
 }
 
+template <typename TFixedImage,
+          typename TMovingImage,
+          typename TVirtualImage,
+          typename TInternalComputationValueType,
+          typename TMetricTraits>
+bool
+ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputationValueType, TMetricTraits>::
+  EvaluateFixedPointThroughCache(const VirtualIndexType & virtualIndex,
+                                 const VirtualPointType & virtualPoint,
+                                 const bool               computeGradient,
+                                 FixedImagePointType &    mappedFixedPoint,
+                                 FixedImagePixelType &    mappedFixedPixelValue,
+                                 FixedImageGradientType & mappedFixedImageGradient) const
+{
+  /* The offset of the virtual index within the cached virtual region. */
+  SizeValueType offset = 0;
+  {
+    const VirtualIndexType & regionIndex = this->m_FixedEvaluationCacheRegion.GetIndex();
+    const auto &             regionSize = this->m_FixedEvaluationCacheRegion.GetSize();
+    SizeValueType            stride = 1;
+    for (unsigned int d = 0; d < VirtualImageDimension; ++d)
+    {
+      offset += static_cast<SizeValueType>(virtualIndex[d] - regionIndex[d]) * stride;
+      stride *= regionSize[d];
+    }
+  }
+
+  if (this->m_FixedEvaluationCachePopulated)
+  {
+    if (!this->m_FixedCachedPointValidity[offset])
+    {
+      return false;
+    }
+    mappedFixedPoint = this->m_FixedCachedPoints[offset];
+    mappedFixedPixelValue = this->m_FixedCachedPixelValues[offset];
+    if (computeGradient)
+    {
+      mappedFixedImageGradient = this->m_FixedCachedGradients[offset];
+    }
+    return true;
+  }
+
+  /* Population pass. Each virtual point is visited by exactly one work
+   * unit, so writing the cache entry needs no synchronization. */
+  const bool pointIsValid =
+    this->TransformAndEvaluateFixedPoint(virtualPoint, mappedFixedPoint, mappedFixedPixelValue);
+  if (pointIsValid)
+  {
+    if (computeGradient)
+    {
+      this->ComputeFixedImageGradientAtPoint(mappedFixedPoint, mappedFixedImageGradient);
+      this->m_FixedCachedGradients[offset] = mappedFixedImageGradient;
+    }
+    this->m_FixedCachedPoints[offset] = mappedFixedPoint;
+    this->m_FixedCachedPixelValues[offset] = mappedFixedPixelValue;
+    this->m_FixedCachedPointValidity[offset] = 1;
+  }
+  return pointIsValid;
+}
+
 template <typename TFixedImage,
           typename TMovingImage,
           typename TVirtualImage,
@@ -673,6 +770,7 @@ ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputat
   os << indent << "ImageToImageMetricv4: " << std::endl
      << indent << "GetUseFixedImageGradientFilter: " << this->GetUseFixedImageGradientFilter() << std::endl
      << indent << "GetUseMovingImageGradientFilter: " << this->GetUseMovingImageGradientFilter() << std::endl
+     << indent << "GetUseFixedImageEvaluationCache: " << this->GetUseFixedImageEvaluationCache() << std::endl
      << indent << "UseFloatingPointCorrection: " << this->GetUseFloatingPointCorrection() << std::endl
      << indent << "FloatingPointCorrectionResolution: " << this->GetFloatingPointCorrectionResolution() << std::endl;
 
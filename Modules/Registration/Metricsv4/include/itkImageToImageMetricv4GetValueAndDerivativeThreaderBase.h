@@ -89,6 +89,11 @@ public:
   using CompensatedDerivativeValueType = CompensatedSummation<DerivativeValueType>;
   using CompensatedDerivativeType = std::vector<CompensatedDerivativeValueType>;
 
+  /** Transforms with at least this many parameters get their per-thread
+   * derivative accumulators zeroed and merged in parallel; below it the
+   * serial loops are cheaper than dispatching work units. */
+  static constexpr NumberOfParametersType ParallelDerivativeAccessThreshold = 16384;
+
   /** Access the GetValueAndDerivative() accesor in image metric base. */
   virtual bool
   GetComputeDerivative() const;
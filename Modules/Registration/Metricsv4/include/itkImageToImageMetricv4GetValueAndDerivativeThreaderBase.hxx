@@ -21,6 +21,8 @@
 #include "itkImageToImageMetricv4GetValueAndDerivativeThreaderBase.h"
 #include "itkNumericTraits.h"
 
+#include <algorithm>
+
 namespace itk
 {
 
@@ -102,17 +104,38 @@ ImageToImageMetricv4GetValueAndDerivativeThreaderBase<TDomainPartitioner,
       NumericTraits<SizeValueType>::ZeroValue();
     this->m_GetValueAndDerivativePerThreadVariables[workUnit].Measure =
       NumericTraits<InternalComputationValueType>::ZeroValue();
-    if (this->m_Associate->GetComputeDerivative())
+  }
+  if (this->m_Associate->GetComputeDerivative())
+  {
+    if (this->m_Associate->m_MovingTransform->GetTransformCategory() !=
+        MovingTransformType::TransformCategoryEnum::DisplacementField)
     {
-      if (this->m_Associate->m_MovingTransform->GetTransformCategory() !=
-          MovingTransformType::TransformCategoryEnum::DisplacementField)
+      /* Be sure to init to 0 here, because the threader may not use
+       * all the threads if the region is better split into fewer
+       * subregions. For high-dimensional transforms zeroing every
+       * per-thread accumulator serially dominates setup time, so the
+       * accumulators are reset concurrently, one work unit each. */
+      if (this->m_CachedNumberOfParameters >= Self::ParallelDerivativeAccessThreshold)
+      {
+        this->GetMultiThreader()->ParallelizeArray(
+          0,
+          numWorkUnitsUsed,
+          [this](SizeValueType workUnit) {
+            for (NumberOfParametersType p = 0; p < this->m_CachedNumberOfParameters; ++p)
+            {
+              this->m_GetValueAndDerivativePerThreadVariables[workUnit].CompensatedDerivatives[p].ResetToZero();
+            }
+          },
+          nullptr);
+      }
+      else
       {
-        /* Be sure to init to 0 here, because the threader may not use
-         * all the threads if the region is better split into fewer
-         * subregions. */
-        for (NumberOfParametersType p = 0; p < this->m_CachedNumberOfParameters; ++p)
+        for (ThreadIdType workUnit = 0; workUnit < numWorkUnitsUsed; ++workUnit)
         {
-          this->m_GetValueAndDerivativePerThreadVariables[workUnit].CompensatedDerivatives[p].ResetToZero();
+          for (NumberOfParametersType p = 0; p < this->m_CachedNumberOfParameters; ++p)
+          {
+            this->m_GetValueAndDerivativePerThreadVariables[workUnit].CompensatedDerivatives[p].ResetToZero();
+          }
         }
       }
     }
@@ -140,16 +163,42 @@ ImageToImageMetricv4GetValueAndDerivativeThreaderBase<TDomainPartitioner,
     if (this->m_Associate->m_MovingTransform->GetTransformCategory() !=
         MovingTransformType::TransformCategoryEnum::DisplacementField)
     {
-      for (NumberOfParametersType p = 0; p < this->m_Associate->GetNumberOfParameters(); ++p)
-      {
-        /* Use a compensated sum to be ready for when there is a very large number of threads */
-        CompensatedDerivativeValueType sum;
-        sum.ResetToZero();
-        for (ThreadIdType i = 0; i < numWorkUnitsUsed; ++i)
+      const NumberOfParametersType numberOfParameters = this->m_Associate->GetNumberOfParameters();
+      /* Each parameter is summed over the work units in fixed order, so
+       * splitting the parameter range over concurrent work units produces
+       * exactly the serial result. */
+      auto mergeParameterRange = [this, numWorkUnitsUsed](NumberOfParametersType begin, NumberOfParametersType end) {
+        for (NumberOfParametersType p = begin; p < end; ++p)
         {
-          sum += this->m_GetValueAndDerivativePerThreadVariables[i].CompensatedDerivatives[p].GetSum();
+          /* Use a compensated sum to be ready for when there is a very large number of threads */
+          CompensatedDerivativeValueType sum;
+          sum.ResetToZero();
+          for (ThreadIdType i = 0; i < numWorkUnitsUsed; ++i)
+          {
+            sum += this->m_GetValueAndDerivativePerThreadVariables[i].CompensatedDerivatives[p].GetSum();
+          }
+          (*(this->m_Associate->m_DerivativeResult))[p] += sum.GetSum();
         }
-        (*(this->m_Associate->m_DerivativeResult))[p] += sum.GetSum();
+      };
+      if (numberOfParameters >= Self::ParallelDerivativeAccessThreshold)
+      {
+        MultiThreaderBase *  threader = this->GetMultiThreader();
+        const SizeValueType  numberOfChunks = threader->GetNumberOfWorkUnits();
+        const SizeValueType  parametersPerChunk = (numberOfParameters + numberOfChunks - 1) / numberOfChunks;
+        threader->ParallelizeArray(
+          0,
+          numberOfChunks,
+          [&mergeParameterRange, parametersPerChunk, numberOfParameters](SizeValueType chunk) {
+            const auto begin = static_cast<NumberOfParametersType>(chunk * parametersPerChunk);
+            const auto end =
+              std::min(static_cast<NumberOfParametersType>(begin + parametersPerChunk), numberOfParameters);
+            mergeParameterRange(begin, end);
+          },
+          nullptr);
+      }
+      else
+      {
+        mergeParameterRange(0, numberOfParameters);
       }
     }
   }
@@ -201,12 +250,26 @@ ImageToImageMetricv4GetValueAndDerivativeThreaderBase<TDomainPartitioner, TImage
    * then we otherwise get when exceptions are caught in MultiThreaderBase. */
   try
   {
-    pointIsValid =
-      this->m_Associate->TransformAndEvaluateFixedPoint(virtualPoint, mappedFixedPoint, mappedFixedPixelValue);
-    if (pointIsValid && this->m_Associate->GetComputeDerivative() &&
-        this->m_Associate->GetGradientSourceIncludesFixed())
+    if (this->m_Associate->GetUseFixedImageEvaluationCache())
+    {
+      const bool computeFixedGradient =
+        this->m_Associate->GetComputeDerivative() && this->m_Associate->GetGradientSourceIncludesFixed();
+      pointIsValid = this->m_Associate->EvaluateFixedPointThroughCache(virtualIndex,
+                                                                       virtualPoint,
+                                                                       computeFixedGradient,
+                                                                       mappedFixedPoint,
+                                                                       mappedFixedPixelValue,
+                                                                       mappedFixedImageGradient);
+    }
+    else
     {
-      this->m_Associate->ComputeFixedImageGradientAtPoint(mappedFixedPoint, mappedFixedImageGradient);
+      pointIsValid =
+        this->m_Associate->TransformAndEvaluateFixedPoint(virtualPoint, mappedFixedPoint, mappedFixedPixelValue);
+      if (pointIsValid && this->m_Associate->GetComputeDerivative() &&
+          this->m_Associate->GetGradientSourceIncludesFixed())
+      {
+        this->m_Associate->ComputeFixedImageGradientAtPoint(mappedFixedPoint, mappedFixedImageGradient);
+      }
     }
   }
   catch (ExceptionObject & exc)
@@ -20,6 +20,7 @@
 
 #include "itkMattesMutualInformationImageToImageMetricv4.h"
 #include "itkCompensatedSummation.h"
+#include "itkMultiThreaderBase.h"
 #include <mutex>
 
 namespace itk
@@ -463,18 +464,40 @@ MattesMutualInformationImageToImageMetricv4<TFixedImage,
   const SizeValueType       numberOfVoxels = this->m_NumberOfHistogramBins * this->m_NumberOfHistogramBins;
   JointPDFValueType * const pdfPtrStart = this->m_ThreaderJointPDF[0]->GetBufferPointer();
 
-  for (unsigned int t = 1; t < localNumberOfWorkUnitsUsed; ++t)
+  if (localNumberOfWorkUnitsUsed > 1)
   {
-    JointPDFValueType *             pdfPtr = pdfPtrStart;
-    JointPDFValueType const *       tPdfPtr = this->m_ThreaderJointPDF[t]->GetBufferPointer();
-    JointPDFValueType const * const tPdfPtrEnd = tPdfPtr + numberOfVoxels;
-    while (tPdfPtr < tPdfPtrEnd)
-    {
-      *(pdfPtr++) += *(tPdfPtr++);
-    }
-    for (SizeValueType i = 0; i < this->m_NumberOfHistogramBins; ++i)
+    // Merge the per-thread joint PDF replicas into the zero'th replica.
+    // The histogram is split into contiguous shards that are reduced
+    // concurrently; every shard sums the replicas in thread order, so
+    // the result is identical to the former serial reduction.
+    MultiThreaderBase::Pointer multiThreader = MultiThreaderBase::New();
+    multiThreader->SetNumberOfWorkUnits(localNumberOfWorkUnitsUsed);
+    const auto numberOfShards = static_cast<SizeValueType>(localNumberOfWorkUnitsUsed);
+    multiThreader->ParallelizeArray(
+      0,
+      numberOfShards,
+      [this, pdfPtrStart, numberOfVoxels, numberOfShards, localNumberOfWorkUnitsUsed](SizeValueType shard) {
+        const SizeValueType shardBegin = shard * numberOfVoxels / numberOfShards;
+        const SizeValueType shardEnd = (shard + 1) * numberOfVoxels / numberOfShards;
+        for (ThreadIdType t = 1; t < localNumberOfWorkUnitsUsed; ++t)
+        {
+          JointPDFValueType *             pdfPtr = pdfPtrStart + shardBegin;
+          JointPDFValueType const *       tPdfPtr = this->m_ThreaderJointPDF[t]->GetBufferPointer() + shardBegin;
+          JointPDFValueType const * const tPdfPtrEnd = this->m_ThreaderJointPDF[t]->GetBufferPointer() + shardEnd;
+          while (tPdfPtr < tPdfPtrEnd)
+          {
+            *(pdfPtr++) += *(tPdfPtr++);
+          }
+        }
+      },
+      nullptr);
+
+    for (unsigned int t = 1; t < localNumberOfWorkUnitsUsed; ++t)
     {
-      this->m_ThreaderFixedImageMarginalPDF[0][i] += this->m_ThreaderFixedImageMarginalPDF[t][i];
+      for (SizeValueType i = 0; i < this->m_NumberOfHistogramBins; ++i)
+      {
+        this->m_ThreaderFixedImageMarginalPDF[0][i] += this->m_ThreaderFixedImageMarginalPDF[t][i];
+      }
     }
   }
 
@@ -19,6 +19,7 @@
 #define itkMattesMutualInformationImageToImageMetricv4GetValueAndDerivativeThreader_hxx
 
 #include "itkMattesMutualInformationImageToImageMetricv4GetValueAndDerivativeThreader.h"
+#include "itkMultiThreaderBase.h"
 
 namespace itk
 {
@@ -341,18 +342,39 @@ MattesMutualInformationImageToImageMetricv4GetValueAndDerivativeThreader<
 
   SizeValueType movingParzenBin = 0;
 
+  // Evaluate the four Parzen window weights, and their derivatives when
+  // needed, up front.  The kernel evaluations are independent of the heavy
+  // accumulation work below, so evaluating them in their own short loops
+  // lets the compiler compute the four weights side by side.
+  PDFValueType parzenValues[4];
+  PDFValueType parzenDerivativeValues[4] = { 0.0, 0.0, 0.0, 0.0 };
+  {
+    PDFValueType parzenWindowArg = movingImageParzenWindowArg;
+    for (SizeValueType bin = 0; bin < 4; ++bin)
+    {
+      parzenValues[bin] = CubicBSplineFunctionType::FastEvaluate(parzenWindowArg);
+      parzenWindowArg += 1.0;
+    }
+    if (doComputeDerivative)
+    {
+      parzenWindowArg = movingImageParzenWindowArg;
+      for (SizeValueType bin = 0; bin < 4; ++bin)
+      {
+        parzenDerivativeValues[bin] = CubicBSplineDerivativeFunctionType::FastEvaluate(parzenWindowArg);
+        parzenWindowArg += 1.0;
+      }
+    }
+  }
+
   const bool transformIsDisplacement = this->m_MattesAssociate->m_MovingTransform->GetTransformCategory() ==
                                        MovingTransformType::TransformCategoryEnum::DisplacementField;
   while (pdfMovingIndex <= pdfMovingIndexMax)
   {
-    const auto val = CubicBSplineFunctionType::FastEvaluate(movingImageParzenWindowArg);
-    *(pdfPtr++) += val;
+    *(pdfPtr++) += parzenValues[movingParzenBin];
 
     if (doComputeDerivative)
     {
-      // Compute the cubicBSplineDerivative for later repeated use.
-      const PDFValueType cubicBSplineDerivativeValue =
-        CubicBSplineDerivativeFunctionType::FastEvaluate(movingImageParzenWindowArg);
+      const PDFValueType cubicBSplineDerivativeValue = parzenDerivativeValues[movingParzenBin];
 
       if (transformIsDisplacement)
       {
@@ -391,7 +413,6 @@ MattesMutualInformationImageToImageMetricv4GetValueAndDerivativeThreader<
       }
     }
 
-    movingImageParzenWindowArg += 1.0;
     ++pdfMovingIndex;
     ++movingParzenBin;
   }
@@ -463,15 +484,28 @@ MattesMutualInformationImageToImageMetricv4GetValueAndDerivativeThreader<
     const PDFValueType nFactor =
       -1.0 / (this->m_MattesAssociate->m_MovingImageBinSize * this->m_MattesAssociate->GetNumberOfValidPoints());
 
+    // Scale the accumulated derivative buffer in parallel shards; for a
+    // transform with many parameters this buffer is by far the largest
+    // object touched in this method.
     JointPDFDerivativesValueType * const accumulatorPdfDPtrStart =
       this->m_MattesAssociate->m_JointPDFDerivatives->GetBufferPointer();
-    JointPDFDerivativesValueType *             accumulatorPdfDPtr = accumulatorPdfDPtrStart;
-    JointPDFDerivativesValueType const * const tempThreadPdfDPtrEnd =
-      accumulatorPdfDPtrStart + histogramTotalElementsSize;
-    while (accumulatorPdfDPtr < tempThreadPdfDPtrEnd)
-    {
-      *(accumulatorPdfDPtr++) *= nFactor;
-    }
+    MultiThreaderBase::Pointer multiThreader = MultiThreaderBase::New();
+    multiThreader->SetNumberOfWorkUnits(localNumberOfWorkUnitsUsed);
+    const auto numberOfShards = static_cast<SizeValueType>(localNumberOfWorkUnitsUsed);
+    multiThreader->ParallelizeArray(
+      0,
+      numberOfShards,
+      [accumulatorPdfDPtrStart, histogramTotalElementsSize, nFactor, numberOfShards](SizeValueType shard) {
+        JointPDFDerivativesValueType * accumulatorPdfDPtr =
+          accumulatorPdfDPtrStart + shard * histogramTotalElementsSize / numberOfShards;
+        JointPDFDerivativesValueType const * const shardPdfDPtrEnd =
+          accumulatorPdfDPtrStart + (shard + 1) * histogramTotalElementsSize / numberOfShards;
+        while (accumulatorPdfDPtr < shardPdfDPtrEnd)
+        {
+          *(accumulatorPdfDPtr++) *= nFactor;
+        }
+      },
+      nullptr);
   }
 
   // Collect and compute results.
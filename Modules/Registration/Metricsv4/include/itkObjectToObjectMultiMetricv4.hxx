@@ -20,6 +20,7 @@
 
 #include "itkObjectToObjectMultiMetricv4.h"
 #include "itkCompositeTransform.h"
+#include "itkMultiThreaderBase.h"
 
 namespace itk
 {
@@ -299,6 +300,14 @@ ObjectToObjectMultiMetricv4<TFixedDimension, TMovingDimension, TVirtualImage, TI
   DerivativeType metricDerivative;
   MeasureType    metricValue = NumericTraits<MeasureType>::ZeroValue();
 
+  // The combination loops below touch each parameter independently, so
+  // they are sharded across work units.  For transforms with local support
+  // the parameter count is on the order of the number of voxels, and these
+  // loops are the cost the combiner itself adds per iteration.
+  const NumberOfParametersType numberOfParameters = this->GetNumberOfParameters();
+  MultiThreaderBase::Pointer   multiThreader = MultiThreaderBase::New();
+  const auto                   numberOfShards = static_cast<SizeValueType>(multiThreader->GetNumberOfWorkUnits());
+
   // Loop over metrics
   DerivativeValueType totalMagnitude = NumericTraits<DerivativeValueType>::ZeroValue();
   for (SizeValueType j = 0; j < this->GetNumberOfMetrics(); ++j)
@@ -315,21 +324,39 @@ ObjectToObjectMultiMetricv4<TFixedDimension, TMovingDimension, TVirtualImage, TI
       weightOverMagnitude = this->m_MetricWeights[j] / magnitude;
     }
     // derivative = \sum_j w_j * (dM_j / ||dM_j||)
-    for (NumberOfParametersType p = 0; p < this->GetNumberOfParameters(); ++p)
-    {
-      // roll our own loop to avoid temporary variable that could be large when using displacement fields.
-      derivativeResult[p] += (metricDerivative[p] * weightOverMagnitude);
-    }
+    // Accumulate in place to avoid a temporary that could be large when
+    // using displacement fields.
+    multiThreader->ParallelizeArray(
+      0,
+      numberOfShards,
+      [&derivativeResult, &metricDerivative, weightOverMagnitude, numberOfParameters, numberOfShards](
+        SizeValueType shard) {
+        const SizeValueType shardBegin = shard * static_cast<SizeValueType>(numberOfParameters) / numberOfShards;
+        const SizeValueType shardEnd = (shard + 1) * static_cast<SizeValueType>(numberOfParameters) / numberOfShards;
+        for (SizeValueType p = shardBegin; p < shardEnd; ++p)
+        {
+          derivativeResult[p] += (metricDerivative[p] * weightOverMagnitude);
+        }
+      },
+      nullptr);
   }
 
   // Scale by totalMagnitude to prevent what amounts to implicit step estimation from magnitude scaling.
   // This keeps the behavior of this metric the same as a regular metric, with respect to derivative
   // magnitudes.
   totalMagnitude /= this->GetNumberOfMetrics();
-  for (NumberOfParametersType p = 0; p < this->GetNumberOfParameters(); ++p)
-  {
-    derivativeResult[p] *= totalMagnitude;
-  }
+  multiThreader->ParallelizeArray(
+    0,
+    numberOfShards,
+    [&derivativeResult, totalMagnitude, numberOfParameters, numberOfShards](SizeValueType shard) {
+      const SizeValueType shardBegin = shard * static_cast<SizeValueType>(numberOfParameters) / numberOfShards;
+      const SizeValueType shardEnd = (shard + 1) * static_cast<SizeValueType>(numberOfParameters) / numberOfShards;
+      for (SizeValueType p = shardBegin; p < shardEnd; ++p)
+      {
+        derivativeResult[p] *= totalMagnitude;
+      }
+    },
+    nullptr);
 
   firstValue = this->m_MetricValueArray[0];
   this->m_Value = firstValue;
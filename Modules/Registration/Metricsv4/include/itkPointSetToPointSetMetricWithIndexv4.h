@@ -394,6 +394,12 @@ protected:
   /**
    * Build point locators for the fixed and moving point sets to speed up
    * derivative and value calculations.
+   *
+   * The locators are reused across iterations and only re-initialized
+   * when the corresponding transformed point set has been regenerated;
+   * the derivative and value calculations then query them concurrently
+   * from multiple work units, which is safe since the queries do not
+   * modify the underlying tree.
    */
   void
   InitializePointsLocators() const;
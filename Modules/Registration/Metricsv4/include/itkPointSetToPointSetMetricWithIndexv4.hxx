@@ -21,6 +21,7 @@
 #include "itkPointSetToPointSetMetricWithIndexv4.h"
 #include "itkIdentityTransform.h"
 #include "itkCompensatedSummation.h"
+#include <vector>
 
 namespace itk
 {
@@ -508,21 +509,36 @@ PointSetToPointSetMetricWithIndexv4<TFixedPointSet, TMovingPointSet, TInternalCo
     typename MovingTransformType::InverseTransformBasePointer inverseTransform =
       this->m_MovingTransform->GetInverseTransform();
 
+    // Snapshot the moving points, so that the transform can be applied in
+    // parallel regardless of the points container type
+    std::vector<typename MovingTransformedPointSetType::PointIdentifier> movingPointIds;
+    std::vector<PointType>                                               movingPoints;
+    movingPointIds.reserve(this->m_MovingPointSet->GetNumberOfPoints());
+    movingPoints.reserve(this->m_MovingPointSet->GetNumberOfPoints());
     typename MovingPointsContainer::ConstIterator It = this->m_MovingPointSet->GetPoints()->Begin();
     while (It != this->m_MovingPointSet->GetPoints()->End())
     {
-      if (this->m_CalculateValueAndDerivativeInTangentSpace)
-      {
-        PointType point = inverseTransform->TransformPoint(It.Value());
-        this->m_MovingTransformedPointSet->SetPoint(It.Index(), point);
-      }
-      else
-      {
-        // evaluation is performed in moving space, so just copy
-        this->m_MovingTransformedPointSet->SetPoint(It.Index(), It.Value());
-      }
+      movingPointIds.push_back(It.Index());
+      movingPoints.push_back(It.Value());
       ++It;
     }
+
+    if (this->m_CalculateValueAndDerivativeInTangentSpace)
+    {
+      MultiThreaderBase::New()->ParallelizeArray(
+        (SizeValueType)0,
+        (SizeValueType)movingPoints.size(),
+        [&movingPoints, &inverseTransform](SizeValueType index) {
+          movingPoints[index] = inverseTransform->TransformPoint(movingPoints[index]);
+        },
+        nullptr);
+    }
+    // else evaluation is performed in moving space, so just copy
+
+    for (size_t index = 0; index < movingPointIds.size(); ++index)
+    {
+      this->m_MovingTransformedPointSet->SetPoint(movingPointIds[index], movingPoints[index]);
+    }
     this->m_MovingTransformedPointSetTime = this->GetMTime();
     if (!this->m_CalculateValueAndDerivativeInTangentSpace)
     {
@@ -556,27 +572,45 @@ PointSetToPointSetMetricWithIndexv4<TFixedPointSet, TMovingPointSet, TInternalCo
     using InverseTransformBasePointer = typename FixedTransformType::InverseTransformBasePointer;
     InverseTransformBasePointer inverseTransform = this->m_FixedTransform->GetInverseTransform();
 
+    // Snapshot the fixed points, so that the transforms can be applied in
+    // parallel regardless of the points container type
+    std::vector<typename VirtualPointSetType::PointIdentifier> fixedPointIds;
+    std::vector<PointType>                                     fixedPoints;
+    fixedPointIds.reserve(this->m_FixedPointSet->GetNumberOfPoints());
+    fixedPoints.reserve(this->m_FixedPointSet->GetNumberOfPoints());
     typename FixedPointsContainer::ConstIterator It = this->m_FixedPointSet->GetPoints()->Begin();
     while (It != this->m_FixedPointSet->GetPoints()->End())
     {
-      if (this->m_CalculateValueAndDerivativeInTangentSpace)
-      {
-        // txf into virtual space
-        PointType point = inverseTransform->TransformPoint(It.Value());
-        this->m_VirtualTransformedPointSet->SetPoint(It.Index(), point);
-        this->m_FixedTransformedPointSet->SetPoint(It.Index(), point);
-      }
-      else
-      {
-        // txf into virtual space
-        PointType point = inverseTransform->TransformPoint(It.Value());
-        this->m_VirtualTransformedPointSet->SetPoint(It.Index(), point);
-        // txf into moving space
-        point = this->m_MovingTransform->TransformPoint(point);
-        this->m_FixedTransformedPointSet->SetPoint(It.Index(), point);
-      }
+      fixedPointIds.push_back(It.Index());
+      fixedPoints.push_back(It.Value());
       ++It;
     }
+
+    std::vector<PointType> virtualPoints(fixedPoints.size());
+    std::vector<PointType> fixedTransformedPoints(fixedPoints.size());
+    const bool             calculateInTangentSpace = this->m_CalculateValueAndDerivativeInTangentSpace;
+    MultiThreaderBase::New()->ParallelizeArray(
+      (SizeValueType)0,
+      (SizeValueType)fixedPoints.size(),
+      [this, &fixedPoints, &virtualPoints, &fixedTransformedPoints, &inverseTransform, calculateInTangentSpace](
+        SizeValueType index) {
+        // txf into virtual space
+        PointType point = inverseTransform->TransformPoint(fixedPoints[index]);
+        virtualPoints[index] = point;
+        if (!calculateInTangentSpace)
+        {
+          // txf into moving space
+          point = this->m_MovingTransform->TransformPoint(point);
+        }
+        fixedTransformedPoints[index] = point;
+      },
+      nullptr);
+
+    for (size_t index = 0; index < fixedPointIds.size(); ++index)
+    {
+      this->m_VirtualTransformedPointSet->SetPoint(fixedPointIds[index], virtualPoints[index]);
+      this->m_FixedTransformedPointSet->SetPoint(fixedPointIds[index], fixedTransformedPoints[index]);
+    }
     this->m_FixedTransformedPointSetTime = std::max(this->GetMTime(), this->m_FixedTransform->GetMTime());
     if (!this->m_CalculateValueAndDerivativeInTangentSpace)
     {
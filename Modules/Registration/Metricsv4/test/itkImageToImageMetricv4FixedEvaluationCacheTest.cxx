@@ -0,0 +1,195 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkMeanSquaresImageToImageMetricv4.h"
+#include "itkTranslationTransform.h"
+#include "itkMath.h"
+
+/* Verify that enabling the fixed image evaluation cache does not change
+ * metric values or derivatives. The cache stores the fixed-space point,
+ * value and gradient of every virtual point during the first evaluation
+ * and serves them from memory afterwards, so every evaluation with the
+ * cache enabled must reproduce the uncached results exactly. */
+
+namespace
+{
+
+template <typename TMetric>
+bool
+EvaluateAndCompare(TMetric *                                metric,
+                   typename TMetric::MeasureType            expectedValue,
+                   const typename TMetric::DerivativeType & expectedDerivative,
+                   const char *                             description)
+{
+  typename TMetric::MeasureType    value = 0;
+  typename TMetric::DerivativeType derivative;
+  metric->GetValueAndDerivative(value, derivative);
+
+  if (itk::Math::NotExactlyEquals(value, expectedValue))
+  {
+    std::cerr << "Value mismatch (" << description << "): expected " << expectedValue << ", got " << value
+              << std::endl;
+    return false;
+  }
+  for (itk::SizeValueType p = 0; p < expectedDerivative.GetSize(); ++p)
+  {
+    if (itk::Math::NotExactlyEquals(derivative[p], expectedDerivative[p]))
+    {
+      std::cerr << "Derivative mismatch (" << description << ") at parameter " << p << ": expected "
+                << expectedDerivative[p] << ", got " << derivative[p] << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+int
+itkImageToImageMetricv4FixedEvaluationCacheTest(int, char ** const)
+{
+  constexpr unsigned int imageSize = 10;
+  constexpr unsigned int imageDimensionality = 2;
+  using ImageType = itk::Image<double, imageDimensionality>;
+
+  ImageType::SizeType size;
+  size.Fill(imageSize);
+  ImageType::RegionType region;
+  region.SetSize(size);
+
+  /* Create simple test images. */
+  auto fixedImage = ImageType::New();
+  fixedImage->SetRegions(region);
+  fixedImage->Allocate();
+
+  auto movingImage = ImageType::New();
+  movingImage->SetRegions(region);
+  movingImage->Allocate();
+
+  itk::ImageRegionIteratorWithIndex<ImageType> itFixed(fixedImage, region);
+  for (itFixed.GoToBegin(); !itFixed.IsAtEnd(); ++itFixed)
+  {
+    const ImageType::IndexType index = itFixed.GetIndex();
+    itFixed.Set(index[0] * index[0] + 2.0 * index[1]);
+  }
+
+  itk::ImageRegionIteratorWithIndex<ImageType> itMoving(movingImage, region);
+  for (itMoving.GoToBegin(); !itMoving.IsAtEnd(); ++itMoving)
+  {
+    const ImageType::IndexType index = itMoving.GetIndex();
+    itMoving.Set(index[0] + index[1] * index[1]);
+  }
+
+  using TransformType = itk::TranslationTransform<double, imageDimensionality>;
+  auto fixedTransform = TransformType::New();
+  auto movingTransform = TransformType::New();
+  fixedTransform->SetIdentity();
+  movingTransform->SetIdentity();
+
+  using MetricType = itk::MeanSquaresImageToImageMetricv4<ImageType, ImageType, ImageType>;
+
+  /* Reference evaluations without the cache, at two different moving
+   * transform positions. */
+  auto reference = MetricType::New();
+  reference->SetFixedImage(fixedImage);
+  reference->SetMovingImage(movingImage);
+  reference->SetFixedTransform(fixedTransform);
+  reference->SetMovingTransform(movingTransform);
+  reference->Initialize();
+
+  MetricType::MeasureType    identityValue = 0;
+  MetricType::DerivativeType identityDerivative;
+  reference->GetValueAndDerivative(identityValue, identityDerivative);
+
+  MetricType::ParametersType offsetParameters(movingTransform->GetNumberOfParameters());
+  offsetParameters.Fill(0.5);
+  reference->SetParameters(offsetParameters);
+  MetricType::MeasureType    offsetValue = 0;
+  MetricType::DerivativeType offsetDerivative;
+  reference->GetValueAndDerivative(offsetValue, offsetDerivative);
+
+  /* The same evaluations with the cache enabled.  The first evaluation
+   * populates the cache, the later ones are served from it. */
+  auto cachedTransform = TransformType::New();
+  cachedTransform->SetIdentity();
+
+  auto cached = MetricType::New();
+  cached->SetFixedImage(fixedImage);
+  cached->SetMovingImage(movingImage);
+  cached->SetFixedTransform(fixedTransform);
+  cached->SetMovingTransform(cachedTransform);
+  cached->SetUseFixedImageEvaluationCache(true);
+  if (!cached->GetUseFixedImageEvaluationCache())
+  {
+    std::cerr << "Set/GetUseFixedImageEvaluationCache failed." << std::endl;
+    return EXIT_FAILURE;
+  }
+  cached->Initialize();
+
+  if (!EvaluateAndCompare(cached.GetPointer(), identityValue, identityDerivative, "cache population"))
+  {
+    return EXIT_FAILURE;
+  }
+  if (!EvaluateAndCompare(cached.GetPointer(), identityValue, identityDerivative, "cached, identity"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  cached->SetParameters(offsetParameters);
+  if (!EvaluateAndCompare(cached.GetPointer(), offsetValue, offsetDerivative, "cached, offset transform"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  /* GetValue must also agree while served from a cache that was populated
+   * with gradients. */
+  if (itk::Math::NotExactlyEquals(cached->GetValue(), offsetValue))
+  {
+    std::cerr << "GetValue mismatch with populated cache." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  /* Modifying the fixed image must invalidate the cache and trigger
+   * repopulation with the new values. */
+  fixedImage->Modified();
+  if (!EvaluateAndCompare(cached.GetPointer(), offsetValue, offsetDerivative, "after cache invalidation"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  /* A cache populated without gradients (GetValue) must be upgraded when
+   * derivatives are requested afterwards. */
+  auto valueFirst = MetricType::New();
+  valueFirst->SetFixedImage(fixedImage);
+  valueFirst->SetMovingImage(movingImage);
+  valueFirst->SetFixedTransform(fixedTransform);
+  valueFirst->SetMovingTransform(cachedTransform);
+  valueFirst->SetUseFixedImageEvaluationCache(true);
+  valueFirst->Initialize();
+  if (itk::Math::NotExactlyEquals(valueFirst->GetValue(), offsetValue))
+  {
+    std::cerr << "GetValue mismatch while populating a value-only cache." << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!EvaluateAndCompare(valueFirst.GetPointer(), offsetValue, offsetDerivative, "value-only cache upgrade"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Test PASSED." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -394,45 +394,68 @@ PDEDeformableRegistrationFilter<TFixedImage, TMovingImage, TDisplacementField>::
   // The update buffer will be overwritten with new data.
   DisplacementFieldPointer field = this->GetUpdateBuffer();
 
+  // Run the separable passes through a single smoother with container
+  // swapping, as in SmoothDisplacementField(), so that the only scratch
+  // buffer is the persistent m_TempField.  The former mini-pipeline of
+  // per-dimension smoothers released and reallocated a full-field buffer
+  // for every dimension on every iteration.
+  m_TempField->SetOrigin(field->GetOrigin());
+  m_TempField->SetSpacing(field->GetSpacing());
+  m_TempField->SetDirection(field->GetDirection());
+  m_TempField->SetLargestPossibleRegion(field->GetLargestPossibleRegion());
+  // smooth the entire allocated update buffer
+  m_TempField->SetRequestedRegion(field->GetBufferedRegion());
+  m_TempField->SetBufferedRegion(field->GetBufferedRegion());
+  m_TempField->Allocate();
+
   using VectorType = typename DisplacementFieldType::PixelType;
   using ScalarType = typename VectorType::ValueType;
   using OperatorType = GaussianOperator<ScalarType, ImageDimension>;
   using SmootherType = VectorNeighborhoodOperatorImageFilter<DisplacementFieldType, DisplacementFieldType>;
 
-  OperatorType                   opers[ImageDimension];
-  typename SmootherType::Pointer smoothers[ImageDimension];
+  OperatorType oper;
+  auto         smoother = SmootherType::New();
+
+  using PixelContainerPointer = typename DisplacementFieldType::PixelContainerPointer;
+  PixelContainerPointer swapPtr;
+
+  // graft the update field onto the mini-pipeline
+  smoother->GraftOutput(m_TempField);
 
   for (unsigned int j = 0; j < ImageDimension; ++j)
   {
     // smooth along this dimension
-    opers[j].SetDirection(j);
+    oper.SetDirection(j);
     double variance = itk::Math::sqr(this->GetUpdateFieldStandardDeviations()[j]);
-    // double variance = itk::Math::sqr( 1.0 );
-    opers[j].SetVariance(variance);
-    opers[j].SetMaximumError(this->GetMaximumError());
-    opers[j].SetMaximumKernelWidth(this->GetMaximumKernelWidth());
-    opers[j].CreateDirectional();
+    oper.SetVariance(variance);
+    oper.SetMaximumError(this->GetMaximumError());
+    oper.SetMaximumKernelWidth(this->GetMaximumKernelWidth());
+    oper.CreateDirectional();
 
-    smoothers[j] = SmootherType::New();
-    smoothers[j]->SetOperator(opers[j]);
-    smoothers[j]->ReleaseDataFlagOn();
+    smoother->SetOperator(oper);
+    smoother->SetInput(field);
+    smoother->Update();
 
-    if (j > 0)
+    if (j + 1 < ImageDimension)
     {
-      smoothers[j]->SetInput(smoothers[j - 1]->GetOutput());
+      // swap the containers
+      swapPtr = smoother->GetOutput()->GetPixelContainer();
+      smoother->GraftOutput(field);
+      field->SetPixelContainer(swapPtr);
+      smoother->Modified();
     }
   }
-  smoothers[0]->SetInput(field);
-  smoothers[ImageDimension - 1]->GetOutput()->SetRequestedRegion(field->GetBufferedRegion());
 
-  smoothers[ImageDimension - 1]->Update();
-
-  // field to contain the final smoothed data, do the equivalent of a graft
-  field->SetPixelContainer(smoothers[ImageDimension - 1]->GetOutput()->GetPixelContainer());
-  field->SetRequestedRegion(smoothers[ImageDimension - 1]->GetOutput()->GetRequestedRegion());
-  field->SetBufferedRegion(smoothers[ImageDimension - 1]->GetOutput()->GetBufferedRegion());
-  field->SetLargestPossibleRegion(smoothers[ImageDimension - 1]->GetOutput()->GetLargestPossibleRegion());
-  field->CopyInformation(smoothers[ImageDimension - 1]->GetOutput());
+  // Keep the update buffer's previous container as next iteration's scratch
+  // space, and do the equivalent of a graft so that the update buffer holds
+  // the final smoothed data.
+  swapPtr = smoother->GetOutput()->GetPixelContainer();
+  m_TempField->SetPixelContainer(field->GetPixelContainer());
+  field->SetPixelContainer(swapPtr);
+  field->SetRequestedRegion(smoother->GetOutput()->GetRequestedRegion());
+  field->SetBufferedRegion(smoother->GetOutput()->GetBufferedRegion());
+  field->SetLargestPossibleRegion(smoother->GetOutput()->GetLargestPossibleRegion());
+  field->CopyInformation(smoother->GetOutput());
 }
 } // end namespace itk
 
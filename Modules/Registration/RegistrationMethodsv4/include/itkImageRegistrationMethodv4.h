@@ -52,7 +52,8 @@ public:
   {
     NONE,
     REGULAR,
-    RANDOM
+    RANDOM,
+    HALTON
   };
 };
 // Define how to print enumeration
@@ -218,6 +219,7 @@ public:
   static constexpr MetricSamplingStrategyEnum NONE = MetricSamplingStrategyEnum::NONE;
   static constexpr MetricSamplingStrategyEnum REGULAR = MetricSamplingStrategyEnum::REGULAR;
   static constexpr MetricSamplingStrategyEnum RANDOM = MetricSamplingStrategyEnum::RANDOM;
+  static constexpr MetricSamplingStrategyEnum HALTON = MetricSamplingStrategyEnum::HALTON;
 #endif
 
 
@@ -303,10 +305,24 @@ public:
   itkSetObjectMacro(Metric, MetricType);
   itkGetModifiableObjectMacro(Metric, MetricType);
 
-  /** Set/Get the metric sampling strategy. */
+  /** Set/Get the metric sampling strategy.  The HALTON strategy draws the
+   * sample points from a Halton low-discrepancy sequence over the virtual
+   * domain; the points are stratified by construction, so an equal coverage
+   * of the domain is reached with considerably fewer samples than with
+   * RANDOM sampling, and the points are generated in parallel. */
   itkSetEnumMacro(MetricSamplingStrategy, MetricSamplingStrategyEnum);
   itkGetEnumMacro(MetricSamplingStrategy, MetricSamplingStrategyEnum);
 
+  /** Set/Get the regeneration of the metric sample points at every
+   * optimizer iteration, rather than once per resolution level.  A fresh
+   * sample set per iteration turns the sampling error into noise that
+   * averages out over the course of the optimization, which permits much
+   * lower sampling percentages for the same convergence.  Only meaningful
+   * when the sampling strategy is not NONE.  Off by default. */
+  itkSetMacro(MetricSamplingResamplePerIteration, bool);
+  itkGetConstMacro(MetricSamplingResamplePerIteration, bool);
+  itkBooleanMacro(MetricSamplingResamplePerIteration);
+
   /** Reinitialize the seed for the random number generators that
    * select the samples for some metric sampling strategies.
    *
@@ -531,6 +547,11 @@ protected:
   virtual void
   SetMetricSamplePoints();
 
+  /** The radical inverse of \c i in the given base; element \c i of the
+   * one-dimensional Halton sequence for that base. */
+  static RealType
+  HaltonRadicalInverse(SizeValueType i, SizeValueType base);
+
   SizeValueType m_CurrentLevel;
   SizeValueType m_NumberOfLevels;
   SizeValueType m_CurrentIteration;
@@ -565,6 +586,13 @@ protected:
   int  m_RandomSeed;
   int  m_CurrentRandomSeed;
 
+  bool m_MetricSamplingResamplePerIteration;
+
+  /** The index of the next unused element of the Halton sequence.  It is
+   * advanced across resamplings so that consecutive sample sets continue
+   * the sequence instead of repeating it. */
+  SizeValueType m_CurrentHaltonIndex;
+
 
   TransformParametersAdaptorsContainerType m_TransformParametersAdaptorsPerLevel;
 
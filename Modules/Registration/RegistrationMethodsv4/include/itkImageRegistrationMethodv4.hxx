@@ -20,6 +20,8 @@
 
 #include "itkImageRegistrationMethodv4.h"
 
+#include "itkCommand.h"
+
 #include "itkSmoothingRecursiveGaussianImageFilter.h"
 #include "itkGradientDescentOptimizerv4.h"
 #include "itkImageRandomConstIteratorWithIndex.h"
@@ -28,6 +30,7 @@
 #include "itkIterationReporter.h"
 #include "itkMattesMutualInformationImageToImageMetricv4.h"
 #include "itkMersenneTwisterRandomVariateGenerator.h"
+#include "itkMultiThreaderBase.h"
 #include "itkRegistrationParameterScalesFromPhysicalShift.h"
 
 namespace itk
@@ -122,6 +125,8 @@ ImageRegistrationMethodv4<TFixedImage, TMovingImage, TTransform, TVirtualImage,
   this->m_SmoothingSigmasAreSpecifiedInPhysicalUnits = true;
 
   this->m_ReseedIterator = false;
+  this->m_MetricSamplingResamplePerIteration = false;
+  this->m_CurrentHaltonIndex = 0;
   this->m_RandomSeed = Statistics::MersenneTwisterRandomVariateGenerator::GetNextSeed();
   this->m_CurrentRandomSeed = this->m_RandomSeed;
 
@@ -829,6 +834,18 @@ ImageRegistrationMethodv4<TFixedImage, TMovingImage, TTransform, TVirtualImage,
 
   // Ensure the same seed is used for each update
   this->m_CurrentRandomSeed = this->m_RandomSeed;
+  this->m_CurrentHaltonIndex = 0;
+
+  // With per-iteration resampling the sample points are regenerated at
+  // every iteration event of the optimizer, in addition to the initial
+  // set generated for each level.
+  typename SimpleMemberCommand<Self>::Pointer resampleCommand;
+  if (this->m_MetricSamplingResamplePerIteration &&
+      this->m_MetricSamplingStrategy != MetricSamplingStrategyEnum::NONE)
+  {
+    resampleCommand = SimpleMemberCommand<Self>::New();
+    resampleCommand->SetCallbackFunction(this, &Self::SetMetricSamplePoints);
+  }
 
   for (this->m_CurrentLevel = 0; this->m_CurrentLevel < this->m_NumberOfLevels; this->m_CurrentLevel++)
   {
@@ -836,7 +853,16 @@ ImageRegistrationMethodv4<TFixedImage, TMovingImage, TTransform, TVirtualImage,
 
     this->m_Metric->Initialize();
 
-    this->m_Optimizer->StartOptimization();
+    if (resampleCommand.IsNotNull())
+    {
+      const unsigned long observerTag = this->m_Optimizer->AddObserver(IterationEvent(), resampleCommand);
+      this->m_Optimizer->StartOptimization();
+      this->m_Optimizer->RemoveObserver(observerTag);
+    }
+    else
+    {
+      this->m_Optimizer->StartOptimization();
+    }
   }
 }
 
@@ -1053,6 +1079,52 @@ ImageRegistrationMethodv4<TFixedImage, TMovingImage, TTransform, TVirtualImage,
         }
         break;
       }
+      case MetricSamplingStrategyEnum::HALTON:
+      {
+        const unsigned long totalVirtualDomainVoxels = virtualDomainRegion.GetNumberOfPixels();
+        const auto          sampleCount =
+          static_cast<unsigned long>(static_cast<float>(totalVirtualDomainVoxels) *
+                                     this->m_MetricSamplingPercentagePerLevel[this->m_CurrentLevel]);
+
+        // The bases of the per-dimension radical inverses must be coprime;
+        // the first primes keep the discrepancy low for image dimensions.
+        static constexpr SizeValueType haltonBases[] = { 2, 3, 5, 7, 11, 13, 17, 19 };
+        static_assert(ImageDimension <= sizeof(haltonBases) / sizeof(haltonBases[0]),
+                      "Insufficient Halton bases for the image dimension.");
+
+        // Element i of the sequence only depends on i, so the points are
+        // generated concurrently.  The sequence is consumed across
+        // resamplings so that every iteration sees fresh points.
+        const SizeValueType          firstHaltonIndex = this->m_CurrentHaltonIndex;
+        std::vector<SamplePointType> haltonPoints(sampleCount);
+        const VirtualDomainImageType * localVirtualImage = virtualImage;
+        MultiThreaderBase::Pointer     multiThreader = MultiThreaderBase::New();
+        multiThreader->ParallelizeArray(
+          0,
+          sampleCount,
+          [&haltonPoints, localVirtualImage, &virtualDomainRegion, firstHaltonIndex](SizeValueType sample) {
+            ContinuousIndex<RealType, ImageDimension> continuousIndex;
+            for (SizeValueType d = 0; d < ImageDimension; ++d)
+            {
+              const RealType unitCoordinate = HaltonRadicalInverse(firstHaltonIndex + sample + 1, haltonBases[d]);
+              continuousIndex[d] = virtualDomainRegion.GetIndex()[d] - 0.5 +
+                                   unitCoordinate * static_cast<RealType>(virtualDomainRegion.GetSize()[d]);
+            }
+            localVirtualImage->TransformContinuousIndexToPhysicalPoint(continuousIndex, haltonPoints[sample]);
+          },
+          nullptr);
+        this->m_CurrentHaltonIndex += sampleCount;
+
+        for (SizeValueType sample = 0; sample < sampleCount; ++sample)
+        {
+          if (!fixedMaskImage || fixedMaskImage->IsInsideInWorldSpace(haltonPoints[sample]))
+          {
+            samplePointSet->SetPoint(index, haltonPoints[sample]);
+            ++index;
+          }
+        }
+        break;
+      }
       default:
       {
         itkExceptionMacro("Invalid sampling strategy requested.");
@@ -1162,6 +1234,23 @@ typename ImageRegistrationMethodv4<TFixedImage, TMovingImage, TTransform, TVirtu
 /*
  * PrintSelf
  */
+template <typename TFixedImage, typename TMovingImage, typename TTransform, typename TVirtualImage, typename TPointSet>
+typename ImageRegistrationMethodv4<TFixedImage, TMovingImage, TTransform, TVirtualImage, TPointSet>::RealType
+ImageRegistrationMethodv4<TFixedImage, TMovingImage, TTransform, TVirtualImage, TPointSet>::HaltonRadicalInverse(
+  SizeValueType       i,
+  const SizeValueType base)
+{
+  RealType result = 0.0;
+  RealType digitWeight = 1.0 / static_cast<RealType>(base);
+  while (i > 0)
+  {
+    result += digitWeight * static_cast<RealType>(i % base);
+    i /= base;
+    digitWeight /= static_cast<RealType>(base);
+  }
+  return result;
+}
+
 template <typename TFixedImage, typename TMovingImage, typename TTransform, typename TVirtualImage, typename TPointSet>
 void
 ImageRegistrationMethodv4<TFixedImage, TMovingImage, TTransform, TVirtualImage, TPointSet>::PrintSelf(
@@ -1195,6 +1284,8 @@ ImageRegistrationMethodv4<TFixedImage, TMovingImage, TTransform, TVirtualImage,
 
   os << indent << "Metric sampling strategy: " << this->m_MetricSamplingStrategy << std::endl;
 
+  os << indent << "Metric sampling resample per iteration: " << this->m_MetricSamplingResamplePerIteration << std::endl;
+
   os << indent << "Metric sampling percentage: ";
   for (SizeValueType i = 0; i < this->m_NumberOfLevels; ++i)
   {
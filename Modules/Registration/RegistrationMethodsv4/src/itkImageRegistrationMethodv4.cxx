@@ -32,6 +32,8 @@ operator<<(std::ostream & out, const ImageRegistrationMethodv4Enums::MetricSampl
         return "itk::ImageRegistrationMethodv4Enums::MetricSamplingStrategy::REGULAR";
       case ImageRegistrationMethodv4Enums::MetricSamplingStrategy::RANDOM:
         return "itk::ImageRegistrationMethodv4Enums::MetricSamplingStrategy::RANDOM";
+      case ImageRegistrationMethodv4Enums::MetricSamplingStrategy::HALTON:
+        return "itk::ImageRegistrationMethodv4Enums::MetricSamplingStrategy::HALTON";
       default:
         return "INVALID VALUE FOR itk::ImageRegistrationMethodv4Enums::MetricSamplingStrategy";
     }
@@ -17,11 +17,15 @@
  *=========================================================================*/
 
 #include "itkImageRegistrationMethodv4.h"
+#include "itkAffineTransform.h"
+#include "itkGradientDescentOptimizerv4.h"
 
 /*
  * Test the SetMetricSamplingPercentage and SetMetricSamplingPercentagePerLevel.
  * We only need to explicitly run the SetMetricSamplingPercentage method because it
  * invokes the SetMetricSamplingPercentagePerLevel method.
+ * Also exercise the HALTON sampling strategy together with per-iteration
+ * resampling on a small registration problem.
  */
 int
 itkImageRegistrationSamplingTest(int, char *[])
@@ -57,5 +61,72 @@ itkImageRegistrationSamplingTest(int, char *[])
       std::cerr << "Caught expected exception." << std::endl;
     }
   }
+
+  // Run a small registration with Halton sampling and a fresh sample set
+  // at every iteration.
+  using ImageType = FixedImageType;
+  ImageType::SizeType size;
+  size.Fill(32);
+
+  auto fixedImage = ImageType::New();
+  fixedImage->SetRegions(size);
+  fixedImage->Allocate();
+
+  auto movingImage = ImageType::New();
+  movingImage->SetRegions(size);
+  movingImage->Allocate();
+
+  itk::ImageRegionIteratorWithIndex<ImageType> it(fixedImage, fixedImage->GetLargestPossibleRegion());
+  for (it.GoToBegin(); !it.IsAtEnd(); ++it)
+  {
+    const ImageType::IndexType index = it.GetIndex();
+    const double               dx = index[0] - 15.0;
+    const double               dy = index[1] - 15.0;
+    it.Set(std::exp(-(dx * dx + dy * dy) / 50.0));
+    const double mx = index[0] - 17.0;
+    const double my = index[1] - 16.0;
+    movingImage->SetPixel(index, std::exp(-(mx * mx + my * my) / 50.0));
+  }
+
+  using TransformType = itk::AffineTransform<double, 2>;
+  using HaltonRegistrationType = itk::ImageRegistrationMethodv4<FixedImageType, MovingImageType, TransformType>;
+  auto registration = HaltonRegistrationType::New();
+  registration->SetFixedImage(fixedImage);
+  registration->SetMovingImage(movingImage);
+  registration->SetNumberOfLevels(1);
+  registration->SetMetricSamplingStrategy(HaltonRegistrationType::MetricSamplingStrategyEnum::HALTON);
+  registration->SetMetricSamplingPercentage(0.2);
+  registration->MetricSamplingResamplePerIterationOn();
+  if (!registration->GetMetricSamplingResamplePerIteration())
+  {
+    std::cerr << "Set/GetMetricSamplingResamplePerIteration failed." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  auto * optimizer = dynamic_cast<itk::GradientDescentOptimizerv4 *>(registration->GetModifiableOptimizer());
+  if (optimizer == nullptr)
+  {
+    std::cerr << "Expected default gradient descent optimizer." << std::endl;
+    return EXIT_FAILURE;
+  }
+  optimizer->SetNumberOfIterations(5);
+
+  try
+  {
+    registration->Update();
+  }
+  catch (const itk::ExceptionObject & e)
+  {
+    std::cerr << "Unexpected exception caught: " << e << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Every iteration must have seen a sample set.
+  if (optimizer->GetCurrentIteration() == 0)
+  {
+    std::cerr << "Optimization did not iterate." << std::endl;
+    return EXIT_FAILURE;
+  }
+
   return EXIT_SUCCESS;
 }
@@ -133,7 +133,8 @@ ConnectedComponentImageFilter<TInputImage, TOutputImage, TMaskImage>::GenerateDa
     progress3.GetProcessObject());
 
   // AfterThreadedGenerateData
-  SizeValueType numberOfObjects = this->CreateConsecutive(m_BackgroundValue);
+  SizeValueType numberOfObjects = m_SortByObjectSize ? this->CreateConsecutiveSortedBySize(m_BackgroundValue)
+                                                     : this->CreateConsecutive(m_BackgroundValue);
   itkAssertOrThrowMacro(numberOfObjects <= this->m_NumberOfLabels,
                         "Number of consecutive labels cannot be greater than the initial number of labels!");
   // check for overflow exception here
@@ -268,6 +269,7 @@ ConnectedComponentImageFilter<TInputImage, TOutputImage, TMaskImage>::PrintSelf(
   Superclass::PrintSelf(os, indent);
 
   os << indent << "ObjectCount: " << m_ObjectCount << std::endl;
+  os << indent << "SortByObjectSize: " << m_SortByObjectSize << std::endl;
 }
 } // end namespace itk
 
@@ -0,0 +1,107 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkConnectedComponentImageFilter.h"
+#include "itkRelabelComponentImageFilter.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkTestingMacros.h"
+
+int
+itkConnectedComponentImageFilterSortBySizeTest(int, char *[])
+{
+  using ImageType = itk::Image<unsigned char, 2>;
+  using OutputImageType = itk::Image<unsigned short, 2>;
+  using FilterType = itk::ConnectedComponentImageFilter<ImageType, OutputImageType>;
+
+  // Many components of different sizes, scattered over the image so
+  // that they are split across work units.
+  auto                input = ImageType::New();
+  ImageType::SizeType size;
+  size.Fill(128);
+  input->SetRegions(size);
+  input->Allocate(true);
+
+  itk::ImageRegionIteratorWithIndex<ImageType> it(input, input->GetLargestPossibleRegion());
+  for (it.GoToBegin(); !it.IsAtEnd(); ++it)
+  {
+    const ImageType::IndexType index = it.GetIndex();
+    // A grid of 8x8 cells; each cell holds a square blob whose size
+    // depends on the cell position.
+    const itk::IndexValueType cellX = index[0] / 16;
+    const itk::IndexValueType cellY = index[1] / 16;
+    const itk::IndexValueType side = 2 + (cellX * 3 + cellY * 5) % 12;
+    if (index[0] % 16 < side && index[1] % 16 < side)
+    {
+      it.Set(255);
+    }
+  }
+
+  auto filter = FilterType::New();
+  filter->SetInput(input);
+  filter->SortByObjectSizeOn();
+  ITK_TEST_EXPECT_TRUE(filter->GetSortByObjectSize());
+  ITK_TRY_EXPECT_NO_EXCEPTION(filter->Update());
+
+  // The reference ordering is the one produced by the explicit
+  // relabeling pass.
+  auto referenceFilter = FilterType::New();
+  referenceFilter->SetInput(input);
+
+  auto relabel = itk::RelabelComponentImageFilter<OutputImageType, OutputImageType>::New();
+  relabel->SetInput(referenceFilter->GetOutput());
+  ITK_TRY_EXPECT_NO_EXCEPTION(relabel->Update());
+
+  ITK_TEST_EXPECT_EQUAL(static_cast<itk::SizeValueType>(relabel->GetNumberOfObjects()), filter->GetObjectCount());
+
+  itk::ImageRegionConstIterator<OutputImageType> sortedIt(filter->GetOutput(),
+                                                          filter->GetOutput()->GetLargestPossibleRegion());
+  itk::ImageRegionConstIterator<OutputImageType> referenceIt(relabel->GetOutput(),
+                                                             relabel->GetOutput()->GetLargestPossibleRegion());
+  for (; !sortedIt.IsAtEnd(); ++sortedIt, ++referenceIt)
+  {
+    if (sortedIt.Get() != referenceIt.Get())
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "Size-sorted label " << sortedIt.Get() << " differs from the RelabelComponentImageFilter label "
+                << referenceIt.Get() << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // The result must not depend on the work unit decomposition.
+  auto singleThreadedFilter = FilterType::New();
+  singleThreadedFilter->SetInput(input);
+  singleThreadedFilter->SortByObjectSizeOn();
+  singleThreadedFilter->SetNumberOfWorkUnits(1);
+  ITK_TRY_EXPECT_NO_EXCEPTION(singleThreadedFilter->Update());
+
+  itk::ImageRegionConstIterator<OutputImageType> singleIt(singleThreadedFilter->GetOutput(),
+                                                          singleThreadedFilter->GetOutput()->GetLargestPossibleRegion());
+  for (sortedIt.GoToBegin(); !sortedIt.IsAtEnd(); ++sortedIt, ++singleIt)
+  {
+    if (sortedIt.Get() != singleIt.Get())
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "Labels depend on the number of work units." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
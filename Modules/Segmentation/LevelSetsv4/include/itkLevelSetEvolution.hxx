@@ -21,6 +21,10 @@
 #define itkLevelSetEvolution_hxx
 
 #include "itkLevelSetEvolution.h"
+#include "itkMultiThreaderBase.h"
+
+#include <algorithm>
+#include <vector>
 
 namespace itk
 {
@@ -324,26 +328,55 @@ template <typename TEquationContainer, typename TOutput, unsigned int VDimension
 void
 LevelSetEvolution<TEquationContainer, WhitakerSparseLevelSetImage<TOutput, VDimension>>::UpdateLevelSets()
 {
+  // The sparse layer updates of the different level sets are independent
+  // of one another as long as they all read the same snapshot of the
+  // level set container. One update filter is therefore built per level
+  // set and they are run concurrently; the results are only grafted back
+  // once every filter has finished, so coupled terms reading neighbor
+  // level sets see a consistent state during the whole computation.
+  std::vector<typename LevelSetContainerType::Iterator> levelSetIterators;
+  std::vector<UpdateLevelSetFilterPointer>              updateLevelSets;
+
   typename LevelSetContainerType::Iterator it = this->m_LevelSetContainer->Begin();
   while (it != this->m_LevelSetContainer->End())
   {
-    typename LevelSetType::Pointer levelSet = it->GetLevelSet();
-
     UpdateLevelSetFilterPointer updateLevelSet = UpdateLevelSetFilterType::New();
-    updateLevelSet->SetInputLevelSet(levelSet);
+    updateLevelSet->SetInputLevelSet(it->GetLevelSet());
     updateLevelSet->SetUpdate(*this->m_UpdateBuffer[it->GetIdentifier()]);
     updateLevelSet->SetEquationContainer(this->m_EquationContainer);
     updateLevelSet->SetTimeStep(this->m_Dt);
     updateLevelSet->SetCurrentLevelSetId(it->GetIdentifier());
-    updateLevelSet->Update();
 
-    levelSet->Graft(updateLevelSet->GetOutputLevelSet());
+    levelSetIterators.push_back(it);
+    updateLevelSets.push_back(updateLevelSet);
+    ++it;
+  }
 
-    this->m_RMSChangeAccumulator = updateLevelSet->GetRMSChangeAccumulator();
+  MultiThreaderBase::Pointer multiThreader = MultiThreaderBase::New();
+  multiThreader->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+  multiThreader->ParallelizeArray(
+    0,
+    updateLevelSets.size(),
+    [&updateLevelSets](SizeValueType index) { updateLevelSets[index]->Update(); },
+    nullptr);
+
+  // Commit the updates and reduce the termination measure: the largest
+  // RMS change over the level sets drives the stopping criterion, which
+  // is the conservative choice when several fronts evolve at once.
+  LevelSetOutputRealType rmsChange = NumericTraits<LevelSetOutputRealType>::ZeroValue();
+  for (SizeValueType index = 0; index < updateLevelSets.size(); ++index)
+  {
+    typename LevelSetContainerType::Iterator levelSetIterator = levelSetIterators[index];
+    UpdateLevelSetFilterPointer              updateLevelSet = updateLevelSets[index];
 
-    this->m_UpdateBuffer[it->GetIdentifier()]->clear();
-    ++it;
+    levelSetIterator->GetLevelSet()->Graft(updateLevelSet->GetOutputLevelSet());
+
+    rmsChange =
+      std::max(rmsChange, static_cast<LevelSetOutputRealType>(updateLevelSet->GetRMSChangeAccumulator()));
+
+    this->m_UpdateBuffer[levelSetIterator->GetIdentifier()]->clear();
   }
+  this->m_RMSChangeAccumulator = rmsChange;
 }
 
 template <typename TEquationContainer, typename TOutput, unsigned int VDimension>
@@ -20,10 +20,8 @@
 
 #include "itkConnectedThresholdImageFilter.h"
 #include "itkBinaryThresholdImageFunction.h"
-#include "itkFloodFilledImageFunctionConditionalIterator.h"
-#include "itkProgressReporter.h"
+#include "itkRegionGrowingFloodFillEngine.h"
 
-#include "itkShapedFloodFilledImageFunctionConditionalIterator.h"
 #include "itkMath.h"
 
 namespace itk
@@ -241,40 +239,15 @@ ConnectedThresholdImageFilter<TInputImage, TOutputImage>::GenerateData()
   function->SetInputImage(inputImage);
   function->ThresholdBetween(lower, upper);
 
-  ProgressReporter progress(this, 0, region.GetNumberOfPixels());
+  // Grow the region with the shared parallel flood fill engine; the
+  // threshold function is stateless per evaluation, so the frontier waves
+  // can be expanded concurrently
+  using EngineType = RegionGrowingFloodFillEngine<OutputImageType, FunctionType>;
+  EngineType engine;
+  engine.SetFullyConnected(this->m_Connectivity == ConnectivityEnum::FullConnectivity);
+  engine.Fill(outputImage, function, m_Seeds, m_ReplaceValue, this->GetMultiThreader());
 
-  if (this->m_Connectivity == ConnectivityEnum::FaceConnectivity)
-  {
-    using IteratorType = FloodFilledImageFunctionConditionalIterator<OutputImageType, FunctionType>;
-    IteratorType it(outputImage, function, m_Seeds);
-    it.GoToBegin();
-
-    while (!it.IsAtEnd())
-    {
-      it.Set(m_ReplaceValue);
-      ++it;
-      progress.CompletedPixel(); // potential exception thrown here
-    }
-  }
-  else if (this->m_Connectivity == ConnectivityEnum::FullConnectivity)
-  {
-    // Use the fully connected iterator here. The fully connected iterator
-    // below is a superset of the above. However, it is reported to be 20%
-    // slower. Hence we use this "if" block to use the old iterator when
-    // we don't need full connectivity.
-
-    using IteratorType = ShapedFloodFilledImageFunctionConditionalIterator<OutputImageType, FunctionType>;
-    IteratorType it(outputImage, function, m_Seeds);
-    it.FullyConnectedOn();
-    it.GoToBegin();
-
-    while (!it.IsAtEnd())
-    {
-      it.Set(m_ReplaceValue);
-      ++it;
-      progress.CompletedPixel(); // potential exception thrown here
-    }
-  }
+  this->UpdateProgress(1.0f);
 }
 
 template <typename TInputImage, typename TOutputImage>
@@ -20,8 +20,7 @@
 
 #include "itkNeighborhoodConnectedImageFilter.h"
 #include "itkNeighborhoodBinaryThresholdImageFunction.h"
-#include "itkFloodFilledImageFunctionConditionalIterator.h"
-#include "itkProgressReporter.h"
+#include "itkRegionGrowingFloodFillEngine.h"
 
 namespace itk
 {
@@ -115,21 +114,20 @@ NeighborhoodConnectedImageFilter<TInputImage, TOutputImage>::GenerateData()
   outputImage->FillBuffer(NumericTraits<OutputImagePixelType>::ZeroValue());
 
   using FunctionType = NeighborhoodBinaryThresholdImageFunction<InputImageType>;
-  using IteratorType = FloodFilledImageFunctionConditionalIterator<OutputImageType, FunctionType>;
 
   auto function = FunctionType::New();
   function->SetInputImage(inputImage);
   function->ThresholdBetween(m_Lower, m_Upper);
   function->SetRadius(m_Radius);
-  IteratorType it = IteratorType(outputImage, function, m_Seeds);
 
-  ProgressReporter progress(this, 0, outputImage->GetRequestedRegion().GetNumberOfPixels());
-  while (!it.IsAtEnd())
-  {
-    it.Set(m_ReplaceValue);
-    ++it;
-    progress.CompletedPixel();
-  }
+  // Grow the region with the shared parallel flood fill engine; the
+  // neighborhood threshold function builds its neighborhood iterator per
+  // evaluation, so the frontier waves can be expanded concurrently
+  using EngineType = RegionGrowingFloodFillEngine<OutputImageType, FunctionType>;
+  EngineType engine;
+  engine.Fill(outputImage, function, m_Seeds, m_ReplaceValue, this->GetMultiThreader());
+
+  this->UpdateProgress(1.0f);
 }
 } // end namespace itk
 
@@ -0,0 +1,109 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkRegionGrowingFloodFillEngine_h
+#define itkRegionGrowingFloodFillEngine_h
+
+#include "itkMultiThreaderBase.h"
+
+#include <vector>
+
+namespace itk
+{
+/**
+ *\class RegionGrowingFloodFillEngine
+ * \brief Parallel flood fill used by the seeded region growing filters.
+ *
+ * Grows the connected component of the seed indices over all pixels for
+ * which the given image function evaluates to true, writing the replace
+ * value into the output image, with the same semantics as walking a
+ * FloodFilledImageFunctionConditionalIterator: the fill is bounded by the
+ * output buffered region, seeds are only accepted where the function holds,
+ * and the function is evaluated exactly once per visited pixel.
+ *
+ * The growth proceeds in breadth-first waves. Large waves are partitioned
+ * among the work units of the supplied MultiThreaderBase; a per-pixel
+ * atomic visited flag guarantees each candidate is claimed by exactly one
+ * work unit. The filled set is independent of the processing order, so the
+ * serial and parallel paths produce identical output. The function's
+ * EvaluateAtIndex() must be safe to call concurrently; pass a null
+ * threader to force serial growth otherwise.
+ *
+ * This is not an itk::Object: it is a lightweight helper intended to be
+ * used inside GenerateData() of the region growing filters.
+ *
+ * \ingroup RegionGrowingSegmentation
+ * \ingroup ITKRegionGrowing
+ *
+ * \sa ConnectedThresholdImageFilter
+ * \sa NeighborhoodConnectedImageFilter
+ * \sa VectorConfidenceConnectedImageFilter
+ */
+template <typename TOutputImage, typename TFunction>
+class ITK_TEMPLATE_EXPORT RegionGrowingFloodFillEngine
+{
+public:
+  using OutputImageType = TOutputImage;
+  using OutputPixelType = typename TOutputImage::PixelType;
+  using FunctionType = TFunction;
+  using RegionType = typename TOutputImage::RegionType;
+  using IndexType = typename TOutputImage::IndexType;
+  using OffsetType = typename TOutputImage::OffsetType;
+  using SeedContainerType = std::vector<IndexType>;
+
+  static constexpr unsigned int ImageDimension = TOutputImage::ImageDimension;
+
+  /** Waves smaller than this are grown serially; distributing a few
+   * candidates over the work units costs more than it saves. */
+  static constexpr SizeValueType ParallelFrontierThreshold = 4096;
+
+  RegionGrowingFloodFillEngine() = default;
+
+  /** Grow across all 3^N - 1 neighbors instead of the 2 * N face
+   * neighbors. Off by default. */
+  void
+  SetFullyConnected(bool fullyConnected)
+  {
+    m_FullyConnected = fullyConnected;
+  }
+
+  bool
+  GetFullyConnected() const
+  {
+    return m_FullyConnected;
+  }
+
+  /** Flood fill the output image from the seeds and return the number of
+   * pixels filled. When a threader is given, large frontier waves are
+   * expanded in parallel. */
+  SizeValueType
+  Fill(OutputImageType *         output,
+       FunctionType *            function,
+       const SeedContainerType & seeds,
+       OutputPixelType           replaceValue,
+       MultiThreaderBase *       threader = nullptr);
+
+private:
+  bool m_FullyConnected{ false };
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkRegionGrowingFloodFillEngine.hxx"
+#endif
+
+#endif
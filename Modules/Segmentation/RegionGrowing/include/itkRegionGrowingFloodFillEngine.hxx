@@ -0,0 +1,206 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkRegionGrowingFloodFillEngine_hxx
+#define itkRegionGrowingFloodFillEngine_hxx
+
+#include "itkRegionGrowingFloodFillEngine.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+namespace itk
+{
+
+template <typename TOutputImage, typename TFunction>
+SizeValueType
+RegionGrowingFloodFillEngine<TOutputImage, TFunction>::Fill(OutputImageType *         output,
+                                                            FunctionType *            function,
+                                                            const SeedContainerType & seeds,
+                                                            OutputPixelType           replaceValue,
+                                                            MultiThreaderBase *       threader)
+{
+  // Match the bounds of FloodFilledFunctionConditionalConstIterator
+  const RegionType region = output->GetBufferedRegion();
+  if (region.GetNumberOfPixels() == 0)
+  {
+    return 0;
+  }
+
+  OutputPixelType * outputBuffer = output->GetBufferPointer();
+
+  // Linear buffer offset of an index; the buffer is laid out with the
+  // fastest stride along dimension 0
+  SizeValueType strides[ImageDimension];
+  SizeValueType stride = 1;
+  for (unsigned int d = 0; d < ImageDimension; ++d)
+  {
+    strides[d] = stride;
+    stride *= region.GetSize(d);
+  }
+  auto computeOffset = [&region, &strides](const IndexType & index) {
+    SizeValueType offset = 0;
+    for (unsigned int d = 0; d < ImageDimension; ++d)
+    {
+      offset += static_cast<SizeValueType>(index[d] - region.GetIndex(d)) * strides[d];
+    }
+    return offset;
+  };
+
+  // One flag per pixel, set the first time the pixel is considered so the
+  // function is evaluated exactly once per visited pixel; exchange() lets
+  // concurrent work units claim candidates without locking
+  const SizeValueType                         numberOfPixels = region.GetNumberOfPixels();
+  std::unique_ptr<std::atomic<uint8_t>[]>     visited(new std::atomic<uint8_t>[numberOfPixels]);
+  for (SizeValueType i = 0; i < numberOfPixels; ++i)
+  {
+    visited[i].store(0, std::memory_order_relaxed);
+  }
+
+  // Connectivity offsets: the 2 * N faces, or all 3^N - 1 neighbors
+  std::vector<OffsetType> neighborOffsets;
+  if (m_FullyConnected)
+  {
+    OffsetType offset;
+    offset.Fill(-1);
+    while (true)
+    {
+      bool allZero = true;
+      for (unsigned int d = 0; d < ImageDimension; ++d)
+      {
+        allZero = allZero && (offset[d] == 0);
+      }
+      if (!allZero)
+      {
+        neighborOffsets.push_back(offset);
+      }
+      unsigned int d = 0;
+      for (; d < ImageDimension; ++d)
+      {
+        if (++offset[d] <= 1)
+        {
+          break;
+        }
+        offset[d] = -1;
+      }
+      if (d == ImageDimension)
+      {
+        break;
+      }
+    }
+  }
+  else
+  {
+    for (unsigned int d = 0; d < ImageDimension; ++d)
+    {
+      OffsetType offset;
+      offset.Fill(0);
+      offset[d] = -1;
+      neighborOffsets.push_back(offset);
+      offset[d] = 1;
+      neighborOffsets.push_back(offset);
+    }
+  }
+
+  // Expand one frontier pixel: claim the unvisited neighbors, test them
+  // against the function and fill the accepted ones
+  auto expand = [&](const IndexType & index, std::vector<IndexType> & nextWave) {
+    for (const OffsetType & neighborOffset : neighborOffsets)
+    {
+      const IndexType neighbor = index + neighborOffset;
+      if (region.IsInside(neighbor))
+      {
+        const SizeValueType offset = computeOffset(neighbor);
+        if (visited[offset].exchange(1) == 0)
+        {
+          if (function->EvaluateAtIndex(neighbor))
+          {
+            outputBuffer[offset] = replaceValue;
+            nextWave.push_back(neighbor);
+          }
+        }
+      }
+    }
+  };
+
+  // Accept the seeds that are inside the region and pass the function
+  SizeValueType          numberOfFilledPixels = 0;
+  std::vector<IndexType> currentWave;
+  for (const IndexType & seed : seeds)
+  {
+    if (region.IsInside(seed))
+    {
+      const SizeValueType offset = computeOffset(seed);
+      if (visited[offset].exchange(1) == 0 && function->EvaluateAtIndex(seed))
+      {
+        outputBuffer[offset] = replaceValue;
+        currentWave.push_back(seed);
+        ++numberOfFilledPixels;
+      }
+    }
+  }
+
+  // Breadth-first waves; the filled set does not depend on the order the
+  // frontier is expanded in, so the parallel path is equivalent to the
+  // serial one
+  std::vector<IndexType> nextWave;
+  while (!currentWave.empty())
+  {
+    nextWave.clear();
+    if (threader != nullptr && currentWave.size() >= ParallelFrontierThreshold)
+    {
+      std::mutex          nextWaveMutex;
+      const SizeValueType numberOfChunks = threader->GetNumberOfWorkUnits();
+      const SizeValueType pixelsPerChunk = (currentWave.size() + numberOfChunks - 1) / numberOfChunks;
+      threader->ParallelizeArray(
+        0,
+        numberOfChunks,
+        [&](SizeValueType chunk) {
+          std::vector<IndexType> localWave;
+          const SizeValueType    begin = chunk * pixelsPerChunk;
+          const SizeValueType    end = std::min<SizeValueType>(begin + pixelsPerChunk, currentWave.size());
+          for (SizeValueType i = begin; i < end; ++i)
+          {
+            expand(currentWave[i], localWave);
+          }
+          if (!localWave.empty())
+          {
+            const std::lock_guard<std::mutex> lockGuard(nextWaveMutex);
+            nextWave.insert(nextWave.end(), localWave.begin(), localWave.end());
+          }
+        },
+        nullptr);
+    }
+    else
+    {
+      for (const IndexType & index : currentWave)
+      {
+        expand(index, nextWave);
+      }
+    }
+    numberOfFilledPixels += nextWave.size();
+    std::swap(currentWave, nextWave);
+  }
+
+  return numberOfFilledPixels;
+}
+
+} // end namespace itk
+
+#endif
@@ -26,7 +26,7 @@
 #include "itkBinaryThresholdImageFunction.h"
 #include "itkFloodFilledImageFunctionConditionalIterator.h"
 #include "itkNumericTraitsRGBPixel.h"
-#include "itkProgressReporter.h"
+#include "itkRegionGrowingFloodFillEngine.h"
 
 namespace itk
 {
@@ -115,7 +115,6 @@ VectorConfidenceConnectedImageFilter<TInputImage, TOutputImage>::GenerateData()
   using InputPixelType = typename InputImageType::PixelType;
 
   using SecondFunctionType = BinaryThresholdImageFunction<OutputImageType>;
-  using IteratorType = FloodFilledImageFunctionConditionalIterator<OutputImageType, DistanceThresholdFunctionType>;
   using SecondIteratorType = FloodFilledImageFunctionConditionalConstIterator<InputImageType, SecondFunctionType>;
 
   unsigned int loop;
@@ -240,15 +239,11 @@ VectorConfidenceConnectedImageFilter<TInputImage, TOutputImage>::GenerateData()
   // the [lower, upper] bounds prescribed, the pixel is added to the
   // output segmentation and its neighbors become candidates for the
   // iterator to walk.
-  IteratorType it = IteratorType(outputImage, m_ThresholdFunction, m_Seeds);
-  it.GoToBegin();
-  while (!it.IsAtEnd())
-  {
-    it.Set(m_ReplaceValue);
-    ++it;
-  }
-
-  ProgressReporter progress(this, 0, region.GetNumberOfPixels() * m_NumberOfIterations);
+  // The Mahalanobis distance function is stateless per evaluation, so the
+  // shared flood fill engine can expand the frontier waves concurrently.
+  using EngineType = RegionGrowingFloodFillEngine<OutputImageType, DistanceThresholdFunctionType>;
+  EngineType engine;
+  engine.Fill(outputImage, m_ThresholdFunction, m_Seeds, m_ReplaceValue, this->GetMultiThreader());
 
   for (loop = 0; loop < m_NumberOfIterations; ++loop)
   {
@@ -319,18 +314,10 @@ VectorConfidenceConnectedImageFilter<TInputImage, TOutputImage>::GenerateData()
     // segmentation and its neighbors become candidates for the
     // iterator to walk.
     outputImage->FillBuffer(NumericTraits<OutputImagePixelType>::ZeroValue());
-    IteratorType thirdIt = IteratorType(outputImage, m_ThresholdFunction, m_Seeds);
-    thirdIt.GoToBegin();
-    try
-    {
-      while (!thirdIt.IsAtEnd())
-      {
-        thirdIt.Set(m_ReplaceValue);
-        ++thirdIt;
-        progress.CompletedPixel(); // potential exception thrown here
-      }
-    }
-    catch (ProcessAborted &)
+    engine.Fill(outputImage, m_ThresholdFunction, m_Seeds, m_ReplaceValue, this->GetMultiThreader());
+
+    this->UpdateProgress(static_cast<float>(loop + 1) / static_cast<float>(m_NumberOfIterations));
+    if (this->GetAbortGenerateData())
     {
       break; // interrupt the iterations loop
     }
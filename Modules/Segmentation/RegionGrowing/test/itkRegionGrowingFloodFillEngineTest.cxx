@@ -0,0 +1,216 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkRegionGrowingFloodFillEngine.h"
+#include "itkBinaryThresholdImageFunction.h"
+#include "itkFloodFilledImageFunctionConditionalIterator.h"
+#include "itkShapedFloodFilledImageFunctionConditionalIterator.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkTestingMacros.h"
+
+namespace
+{
+
+constexpr unsigned int Dimension = 2;
+using PixelType = unsigned char;
+using ImageType = itk::Image<PixelType, Dimension>;
+using FunctionType = itk::BinaryThresholdImageFunction<ImageType, double>;
+using EngineType = itk::RegionGrowingFloodFillEngine<ImageType, FunctionType>;
+using SeedContainerType = EngineType::SeedContainerType;
+
+// Build an input with two bright components that touch only diagonally, so
+// the face-connected and fully-connected fills differ
+ImageType::Pointer
+MakeInputImage()
+{
+  auto                  image = ImageType::New();
+  ImageType::RegionType region;
+  region.SetSize({ { 64, 64 } });
+  image->SetRegions(region);
+  image->Allocate(true);
+
+  for (itk::IndexValueType y = 5; y < 30; ++y)
+  {
+    for (itk::IndexValueType x = 5; x < 30; ++x)
+    {
+      image->SetPixel({ { x, y } }, 200);
+    }
+  }
+  for (itk::IndexValueType y = 30; y < 55; ++y)
+  {
+    for (itk::IndexValueType x = 30; x < 55; ++x)
+    {
+      image->SetPixel({ { x, y } }, 200);
+    }
+  }
+  // A hole inside the first component that the fill must flow around
+  for (itk::IndexValueType y = 12; y < 18; ++y)
+  {
+    for (itk::IndexValueType x = 12; x < 18; ++x)
+    {
+      image->SetPixel({ { x, y } }, 10);
+    }
+  }
+  return image;
+}
+
+ImageType::Pointer
+MakeZeroOutputImage()
+{
+  auto image = ImageType::New();
+  image->SetRegions(ImageType::SizeType{ { 64, 64 } });
+  image->Allocate(true);
+  return image;
+}
+
+bool
+ImagesMatch(const ImageType * image1, const ImageType * image2)
+{
+  itk::ImageRegionConstIterator<ImageType> it1(image1, image1->GetBufferedRegion());
+  itk::ImageRegionConstIterator<ImageType> it2(image2, image2->GetBufferedRegion());
+  while (!it1.IsAtEnd())
+  {
+    if (it1.Get() != it2.Get())
+    {
+      std::cerr << "Mismatch at " << it1.GetIndex() << ": " << static_cast<int>(it1.Get()) << " vs "
+                << static_cast<int>(it2.Get()) << std::endl;
+      return false;
+    }
+    ++it1;
+    ++it2;
+  }
+  return true;
+}
+
+itk::SizeValueType
+CountNonZeroPixels(const ImageType * image)
+{
+  itk::SizeValueType                       count = 0;
+  itk::ImageRegionConstIterator<ImageType> it(image, image->GetBufferedRegion());
+  while (!it.IsAtEnd())
+  {
+    if (it.Get() != 0)
+    {
+      ++count;
+    }
+    ++it;
+  }
+  return count;
+}
+
+} // namespace
+
+int
+itkRegionGrowingFloodFillEngineTest(int, char *[])
+{
+  const ImageType::Pointer input = MakeInputImage();
+
+  auto function = FunctionType::New();
+  function->SetInputImage(input);
+  function->ThresholdBetween(100, 255);
+
+  constexpr PixelType replaceValue = 255;
+
+  SeedContainerType seeds;
+  seeds.push_back({ { 10, 10 } });
+  // A second seed inside the already-filled component
+  seeds.push_back({ { 25, 25 } });
+  // A seed the function rejects: it must not be filled
+  seeds.push_back({ { 14, 14 } });
+  // A seed outside the buffered region: it must be ignored
+  seeds.push_back({ { 100, 100 } });
+
+  // Reference fill with the serial conditional iterators
+  const ImageType::Pointer faceReference = MakeZeroOutputImage();
+  {
+    using IteratorType = itk::FloodFilledImageFunctionConditionalIterator<ImageType, FunctionType>;
+    std::vector<ImageType::IndexType> seedList(seeds.begin(), seeds.end());
+    IteratorType                      it(faceReference, function, seedList);
+    while (!it.IsAtEnd())
+    {
+      it.Set(replaceValue);
+      ++it;
+    }
+  }
+  const ImageType::Pointer fullReference = MakeZeroOutputImage();
+  {
+    using IteratorType = itk::ShapedFloodFilledImageFunctionConditionalIterator<ImageType, FunctionType>;
+    std::vector<ImageType::IndexType> seedList(seeds.begin(), seeds.end());
+    IteratorType                      it(fullReference, function, seedList);
+    it.FullyConnectedOn();
+    while (!it.IsAtEnd())
+    {
+      it.Set(replaceValue);
+      ++it;
+    }
+  }
+
+  // The diagonal touch point must only be reached with full connectivity
+  ITK_TEST_EXPECT_TRUE(CountNonZeroPixels(fullReference) > CountNonZeroPixels(faceReference));
+
+  EngineType engine;
+  ITK_TEST_EXPECT_TRUE(!engine.GetFullyConnected());
+
+  // Serial face connectivity
+  {
+    const ImageType::Pointer output = MakeZeroOutputImage();
+    const itk::SizeValueType numberOfFilledPixels = engine.Fill(output, function, seeds, replaceValue);
+    ITK_TEST_EXPECT_TRUE(ImagesMatch(output, faceReference));
+    ITK_TEST_EXPECT_EQUAL(numberOfFilledPixels, CountNonZeroPixels(faceReference));
+  }
+
+  // Threaded face connectivity must produce the same filled set
+  {
+    const ImageType::Pointer output = MakeZeroOutputImage();
+    const itk::SizeValueType numberOfFilledPixels =
+      engine.Fill(output, function, seeds, replaceValue, itk::MultiThreaderBase::New());
+    ITK_TEST_EXPECT_TRUE(ImagesMatch(output, faceReference));
+    ITK_TEST_EXPECT_EQUAL(numberOfFilledPixels, CountNonZeroPixels(faceReference));
+  }
+
+  // Serial and threaded full connectivity
+  engine.SetFullyConnected(true);
+  ITK_TEST_EXPECT_TRUE(engine.GetFullyConnected());
+  {
+    const ImageType::Pointer output = MakeZeroOutputImage();
+    const itk::SizeValueType numberOfFilledPixels = engine.Fill(output, function, seeds, replaceValue);
+    ITK_TEST_EXPECT_TRUE(ImagesMatch(output, fullReference));
+    ITK_TEST_EXPECT_EQUAL(numberOfFilledPixels, CountNonZeroPixels(fullReference));
+  }
+  {
+    const ImageType::Pointer output = MakeZeroOutputImage();
+    const itk::SizeValueType numberOfFilledPixels =
+      engine.Fill(output, function, seeds, replaceValue, itk::MultiThreaderBase::New());
+    ITK_TEST_EXPECT_TRUE(ImagesMatch(output, fullReference));
+    ITK_TEST_EXPECT_EQUAL(numberOfFilledPixels, CountNonZeroPixels(fullReference));
+  }
+
+  // Rejected and out-of-region seeds alone fill nothing
+  {
+    SeedContainerType badSeeds;
+    badSeeds.push_back({ { 14, 14 } });
+    badSeeds.push_back({ { 100, 100 } });
+    const ImageType::Pointer output = MakeZeroOutputImage();
+    const itk::SizeValueType numberOfFilledPixels = engine.Fill(output, function, badSeeds, replaceValue);
+    ITK_TEST_EXPECT_EQUAL(numberOfFilledPixels, itk::SizeValueType{ 0 });
+    ITK_TEST_EXPECT_EQUAL(CountNonZeroPixels(output), itk::SizeValueType{ 0 });
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -114,6 +114,20 @@ public:
   itkSetMacro(MaximumNumberOfIterations, unsigned int);
   itkGetConstMacro(MaximumNumberOfIterations, unsigned int);
 
+  /** \brief Tolerance for skipping the windows of stationary clusters.
+   *
+   * After each iteration the squared joint distance each cluster moved
+   * is compared against this tolerance. The search window of a cluster
+   * is only rescanned in the next iteration if the cluster, or a
+   * cluster with an overlapping search window, moved by more than the
+   * tolerance. When no cluster moves the iteration loop terminates
+   * early. With the default value of 0 only bitwise stationary
+   * clusters are skipped and the result is unchanged; larger values
+   * trade accuracy near converged superpixel boundaries for speed.
+   */
+  itkSetMacro(ClusterResidualTolerance, double);
+  itkGetConstMacro(ClusterResidualTolerance, double);
+
   /** \brief The expected superpixel size and shape
    *
    * The requested size of a superpixel used to form a regular grid for
@@ -177,6 +191,9 @@ protected:
   void
   ThreadedUpdateDistanceAndLabel(const OutputImageRegionType & outputRegionForThread);
 
+  void
+  ThreadedRefreshDistances(const OutputImageRegionType & outputRegionForThread);
+
   void
   ThreadedUpdateClusters(const OutputImageRegionType & updateRegionForThread);
 
@@ -206,10 +223,13 @@ private:
   SuperGridSizeType m_SuperGridSize;
   unsigned int      m_MaximumNumberOfIterations;
   double            m_SpatialProximityWeight{ 10.0 };
+  double            m_ClusterResidualTolerance{ 0.0 };
 
   FixedArray<double, ImageDimension> m_DistanceScales;
   std::vector<ClusterComponentType>  m_Clusters;
   std::vector<ClusterComponentType>  m_OldClusters;
+  std::vector<unsigned char>         m_ActiveClusters;
+  std::vector<double>                m_ClusterResiduals;
 
 
   void
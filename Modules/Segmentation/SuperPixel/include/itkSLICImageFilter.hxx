@@ -37,6 +37,9 @@
 #include "itkMath.h"
 
 #include <numeric>
+#include <algorithm>
+#include <array>
+#include <set>
 
 
 namespace itk
@@ -93,6 +96,7 @@ SLICImageFilter<TInputImage, TOutputImage, TDistancePixel>::PrintSelf(std::ostre
   os << indent << "SuperGridSize: " << m_SuperGridSize << std::endl;
   os << indent << "MaximumNumberOfIterations: " << m_MaximumNumberOfIterations << std::endl;
   os << indent << "SpatialProximityWeight: " << m_SpatialProximityWeight << std::endl;
+  os << indent << "ClusterResidualTolerance: " << m_ClusterResidualTolerance << std::endl;
   os << indent << "EnforceConnectivity: " << m_EnforceConnectivity << std::endl;
   os << indent << "AverageResidual: " << m_AverageResidual << std::endl;
 }
@@ -180,6 +184,12 @@ SLICImageFilter<TInputImage, TOutputImage, TDistancePixel>::BeforeThreadedGenera
   m_DistanceImage->CopyInformation(inputImage);
   m_DistanceImage->SetBufferedRegion(region);
   m_DistanceImage->Allocate();
+  m_DistanceImage->FillBuffer(NumericTraits<typename DistanceImageType::PixelType>::max());
+
+  // All cluster windows are scanned in the first iteration; afterwards
+  // only the windows of clusters that moved need to be revisited.
+  m_ActiveClusters.assign(numberOfClusters, 1);
+  m_ClusterResiduals.assign(numberOfClusters, 0.0);
 
   for (unsigned int i = 0; i < ImageDimension; ++i)
   {
@@ -212,8 +222,17 @@ SLICImageFilter<TInputImage, TOutputImage, TDistancePixel>::ThreadedUpdateDistan
     searchRadius[i] = m_SuperGridSize[i];
   }
 
+  using OutputIteratorType = ImageScanlineIterator<OutputImageType>;
+
   for (size_t i = 0; i * numberOfClusterComponents < m_Clusters.size(); ++i)
   {
+    if (!m_ActiveClusters[i])
+    {
+      // neither this cluster nor any cluster with an overlapping search
+      // window moved, so the stored distances and labels are still valid
+      continue;
+    }
+
     ClusterType                         cluster(numberOfClusterComponents, &m_Clusters[i * numberOfClusterComponents]);
     typename InputImageType::RegionType localRegion;
     typename InputImageType::PointType  pt;
@@ -237,27 +256,32 @@ SLICImageFilter<TInputImage, TOutputImage, TDistancePixel>::ThreadedUpdateDistan
 
     InputConstIteratorType inputIter(inputImage, localRegion);
     DistanceIteratorType   distanceIter(m_DistanceImage, localRegion);
+    OutputIteratorType     outputIter(outputImage, localRegion);
 
+    const auto label = static_cast<typename OutputImageType::PixelType>(i);
 
     while (!inputIter.IsAtEnd())
     {
+      // only the fastest moving coordinate varies along a scanline
+      const IndexType lineIndex = inputIter.GetIndex();
+      pt = ContinuousIndexType(lineIndex);
       for (size_t x = 0; x < ln; ++x)
       {
-        const IndexType & currentIdx = inputIter.GetIndex();
-
-        pt = ContinuousIndexType(currentIdx);
+        pt[0] = static_cast<typename PointType::ValueType>(lineIndex[0] + static_cast<IndexValueType>(x));
         const double distance = this->Distance(cluster, inputIter.Get(), pt);
         if (distance < distanceIter.Get())
         {
           distanceIter.Set(distance);
-          outputImage->SetPixel(currentIdx, i);
+          outputIter.Set(label);
         }
 
         ++distanceIter;
         ++inputIter;
+        ++outputIter;
       }
       inputIter.NextLine();
       distanceIter.NextLine();
+      outputIter.NextLine();
     }
 
     // for neighborhood iterator size S
@@ -265,6 +289,56 @@ SLICImageFilter<TInputImage, TOutputImage, TDistancePixel>::ThreadedUpdateDistan
 }
 
 
+template <typename TInputImage, typename TOutputImage, typename TDistancePixel>
+void
+SLICImageFilter<TInputImage, TOutputImage, TDistancePixel>::ThreadedRefreshDistances(
+  const OutputImageRegionType & outputRegionForThread)
+{
+  // Re-bid the stored distance of every pixel whose current cluster
+  // moved in the last iteration. Pixels owned by stationary clusters
+  // keep their stored distance, which is still exact, so the window
+  // scan only needs to revisit the moving clusters.
+  using InputConstIteratorType = ImageScanlineConstIterator<InputImageType>;
+  using DistanceIteratorType = ImageScanlineIterator<DistanceImageType>;
+  using OutputConstIteratorType = ImageScanlineConstIterator<OutputImageType>;
+
+  const InputImageType * inputImage = this->GetInput();
+  const OutputImageType * outputImage = this->GetOutput();
+  const unsigned int     numberOfComponents = inputImage->GetNumberOfComponentsPerPixel();
+  const unsigned int     numberOfClusterComponents = numberOfComponents + ImageDimension;
+
+  InputConstIteratorType  inputIter(inputImage, outputRegionForThread);
+  DistanceIteratorType    distanceIter(m_DistanceImage, outputRegionForThread);
+  OutputConstIteratorType outputIter(outputImage, outputRegionForThread);
+
+  typename InputImageType::PointType pt;
+
+  const size_t ln = outputRegionForThread.GetSize(0);
+  while (!inputIter.IsAtEnd())
+  {
+    const IndexType lineIndex = inputIter.GetIndex();
+    pt = ContinuousIndexType(lineIndex);
+    for (size_t x = 0; x < ln; ++x)
+    {
+      const auto label = static_cast<size_t>(outputIter.Get());
+      if (m_ActiveClusters[label])
+      {
+        ClusterType cluster(numberOfClusterComponents, &m_Clusters[label * numberOfClusterComponents]);
+        pt[0] = static_cast<typename PointType::ValueType>(lineIndex[0] + static_cast<IndexValueType>(x));
+        distanceIter.Set(this->Distance(cluster, inputIter.Get(), pt));
+      }
+
+      ++distanceIter;
+      ++inputIter;
+      ++outputIter;
+    }
+    inputIter.NextLine();
+    distanceIter.NextLine();
+    outputIter.NextLine();
+  }
+}
+
+
 template <typename TInputImage, typename TOutputImage, typename TDistancePixel>
 void
 SLICImageFilter<TInputImage, TOutputImage, TDistancePixel>::ThreadedUpdateClusters(
@@ -623,9 +697,29 @@ SLICImageFilter<TInputImage, TOutputImage, TDistancePixel>::GenerateData()
   {
     itkDebugMacro("Iteration :" << loopCnt);
 
-    m_DistanceImage->FillBuffer(NumericTraits<typename DistanceImageType::PixelType>::max());
+    if (std::none_of(
+          m_ActiveClusters.begin(), m_ActiveClusters.end(), [](unsigned char active) { return active != 0; }))
+    {
+      // every cluster is stationary: further iterations cannot change
+      // the labeling
+      break;
+    }
+
     m_UpdateClusterPerThread.clear();
 
+    if (loopCnt > 0)
+    {
+      // The distance image persists between iterations; refresh the
+      // entries of pixels owned by clusters that moved before the
+      // clusters compete again.
+      this->GetMultiThreader()->template ParallelizeImageRegion<ImageDimension>(
+        outputImage->GetRequestedRegion(),
+        [this](const OutputImageRegionType & outputRegionForThread) {
+          this->ThreadedRefreshDistances(outputRegionForThread);
+        },
+        this);
+    }
+
     this->GetMultiThreader()->template ParallelizeImageRegion<ImageDimension>(
       outputImage->GetRequestedRegion(),
       [this](const OutputImageRegionType & outputRegionForThread) {
@@ -670,12 +764,68 @@ SLICImageFilter<TInputImage, TOutputImage, TDistancePixel>::GenerateData()
       cluster /= clusterCount[i];
 
       ClusterType oldCluster(numberOfClusterComponents, &m_OldClusters[i * numberOfClusterComponents]);
-      l1Residual += Distance(cluster, oldCluster);
+      m_ClusterResiduals[i] = Distance(cluster, oldCluster);
+      l1Residual += m_ClusterResiduals[i];
     }
 
     m_AverageResidual = std::sqrt(l1Residual) / m_Clusters.size();
     this->InvokeEvent(IterationEvent());
 
+    // A cluster's window must be rescanned in the next iteration if its
+    // center moved by more than the tolerance, or if the center of any
+    // cluster with an overlapping search window did. Moved centers are
+    // binned on a grid coarser than the window overlap radius, so the
+    // overlap test reduces to a constant-size cell neighborhood lookup.
+    using CellType = std::array<IndexValueType, ImageDimension>;
+    std::set<CellType> movedCells;
+    for (size_t i = 0; i < numberOfClusters; ++i)
+    {
+      if (m_ClusterResiduals[i] > m_ClusterResidualTolerance)
+      {
+        ClusterType cluster(numberOfClusterComponents, &m_Clusters[i * numberOfClusterComponents]);
+        CellType    cell;
+        for (unsigned int d = 0; d < ImageDimension; ++d)
+        {
+          cell[d] =
+            static_cast<IndexValueType>(std::floor(cluster[numberOfComponents + d] / (2.0 * (m_SuperGridSize[d] + 1))));
+        }
+        movedCells.insert(cell);
+      }
+    }
+
+    for (size_t i = 0; i < numberOfClusters; ++i)
+    {
+      // clusters that lost all their pixels have an indeterminate center
+      // and an indeterminate residual; their windows cannot be scanned
+      if (!(m_ClusterResiduals[i] >= 0.0))
+      {
+        m_ActiveClusters[i] = 0;
+        continue;
+      }
+
+      ClusterType cluster(numberOfClusterComponents, &m_Clusters[i * numberOfClusterComponents]);
+      CellType    cell;
+      for (unsigned int d = 0; d < ImageDimension; ++d)
+      {
+        cell[d] =
+          static_cast<IndexValueType>(std::floor(cluster[numberOfComponents + d] / (2.0 * (m_SuperGridSize[d] + 1))));
+      }
+
+      bool     active = false;
+      CellType probe;
+      for (SizeValueType n = 0; !active && n < Math::UnsignedPower(3, ImageDimension); ++n)
+      {
+        SizeValueType rem = n;
+        for (unsigned int d = 0; d < ImageDimension; ++d)
+        {
+          probe[d] = cell[d] + static_cast<IndexValueType>(rem % 3) - 1;
+          rem /= 3;
+        }
+        active = (movedCells.count(probe) != 0);
+      }
+      m_ActiveClusters[i] = active ? 1 : 0;
+    }
+
     // while error <= threshold
   }
 
@@ -714,6 +864,8 @@ SLICImageFilter<TInputImage, TOutputImage, TDistancePixel>::AfterThreadedGenerat
   // cleanup
   std::vector<ClusterComponentType>().swap(m_Clusters);
   std::vector<ClusterComponentType>().swap(m_OldClusters);
+  std::vector<unsigned char>().swap(m_ActiveClusters);
+  std::vector<double>().swap(m_ClusterResiduals);
   for (unsigned int i = 0; i < m_UpdateClusterPerThread.size(); ++i)
   {
     UpdateClusterMap().swap(m_UpdateClusterPerThread[i]);
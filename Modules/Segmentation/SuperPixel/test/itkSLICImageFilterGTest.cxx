@@ -20,6 +20,7 @@
 
 #include "itkSLICImageFilter.h"
 #include "itkVectorImage.h"
+#include "itkImageRegionConstIterator.h"
 
 #include "itkCommand.h"
 
@@ -112,6 +113,11 @@ TEST_F(SLICFixture, SetGetPrint)
   EXPECT_NO_THROW(filter->SetSpatialProximityWeight(9.1));
   EXPECT_EQ(9.1, filter->GetSpatialProximityWeight());
 
+  EXPECT_NO_THROW(filter->SetClusterResidualTolerance(0.5));
+  EXPECT_EQ(0.5, filter->GetClusterResidualTolerance());
+  EXPECT_NO_THROW(filter->SetClusterResidualTolerance(0.0));
+  EXPECT_EQ(0.0, filter->GetClusterResidualTolerance());
+
   EXPECT_NO_THROW(filter->EnforceConnectivityOn());
   EXPECT_TRUE(filter->GetEnforceConnectivity());
   EXPECT_NO_THROW(filter->EnforceConnectivityOff());
@@ -154,3 +160,42 @@ TEST_F(SLICFixture, Blank2DImage)
   filter->Update();
   EXPECT_EQ("4e0a293a5b638f0aba2c4fe2c3418d0e", MD5Hash(filter->GetOutput()));
 }
+
+TEST_F(SLICFixture, ClusterResidualTolerance)
+{
+
+  using namespace itk::GTest::TypedefsAndConstructors::Dimension2;
+  using Utils = FixtureUtilities<2>;
+
+  auto image = Utils::CreateImage(100);
+
+  // A tolerance large enough to stop after the first assignment must
+  // still produce a complete labeling with valid cluster ids.
+  auto prunedFilter = Utils::FilterType::New();
+  prunedFilter->SetInput(image);
+  prunedFilter->SetSuperGridSize(10);
+  prunedFilter->SetClusterResidualTolerance(1e20);
+  prunedFilter->EnforceConnectivityOff();
+  prunedFilter->Update();
+
+  itk::ImageRegionConstIterator<Utils::OutputImageType> it(prunedFilter->GetOutput(),
+                                                           prunedFilter->GetOutput()->GetBufferedRegion());
+  for (it.GoToBegin(); !it.IsAtEnd(); ++it)
+  {
+    EXPECT_LT(it.Get(), 100u);
+  }
+
+  // With a single cluster the labeling converges immediately, so the
+  // pruned and default paths must agree.
+  auto filter = Utils::FilterType::New();
+  filter->SetInput(image);
+  filter->SetSuperGridSize(200);
+  filter->Update();
+
+  auto prunedSingle = Utils::FilterType::New();
+  prunedSingle->SetInput(image);
+  prunedSingle->SetSuperGridSize(200);
+  prunedSingle->SetClusterResidualTolerance(1e20);
+  prunedSingle->Update();
+  EXPECT_EQ(MD5Hash(filter->GetOutput()), MD5Hash(prunedSingle->GetOutput()));
+}
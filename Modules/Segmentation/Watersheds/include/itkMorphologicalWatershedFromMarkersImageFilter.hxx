@@ -19,8 +19,11 @@
 #define itkMorphologicalWatershedFromMarkersImageFilter_hxx
 
 #include <algorithm>
-#include <queue>
-#include <list>
+#include <deque>
+#include <map>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include "itkMorphologicalWatershedFromMarkersImageFilter.h"
 #include "itkProgressReporter.h"
 #include "itkImageRegionIterator.h"
@@ -33,6 +36,127 @@
 namespace itk
 {
 
+/** \cond HIDE_HELPER_CLASSES */
+
+/** Hierarchical queue used by the flooding stage. Entries are pushed with
+ * their gray level and extracted one whole lowest-level queue at a time, in
+ * FIFO order within a level. The generic version keeps an ordered map of
+ * queues; the specialization below replaces it with flat bucket queues
+ * indexed by the gray level for the small integral pixel types, removing the
+ * per-push tree rebalancing. Both extract in exactly the same order. */
+template <typename TValue,
+          typename TIndex,
+          bool VUseBucketQueue =
+            std::is_integral<TValue>::value && !std::is_same<TValue, bool>::value && sizeof(TValue) <= 2>
+class MorphologicalWatershedHierarchicalQueue
+{
+public:
+  using QueueType = std::deque<TIndex>;
+
+  void
+  Push(TValue value, const TIndex & index)
+  {
+    m_Map[value].push_back(index);
+  }
+
+  bool
+  Empty() const
+  {
+    return m_Map.empty();
+  }
+
+  /** The gray level of the lowest non-empty queue. Only valid when the
+   * hierarchical queue is not empty. */
+  TValue
+  FrontValue()
+  {
+    return m_Map.begin()->first;
+  }
+
+  /** Remove and return the whole lowest-level queue. */
+  QueueType
+  PopFrontQueue()
+  {
+    QueueType queue = std::move(m_Map.begin()->second);
+    m_Map.erase(m_Map.begin());
+    return queue;
+  }
+
+private:
+  std::map<TValue, QueueType> m_Map;
+};
+
+/** Bucket queue specialization for integral pixel types of at most 16 bits:
+ * one queue per representable gray level, found in constant time. */
+template <typename TValue, typename TIndex>
+class MorphologicalWatershedHierarchicalQueue<TValue, TIndex, true>
+{
+public:
+  using QueueType = std::deque<TIndex>;
+
+  MorphologicalWatershedHierarchicalQueue()
+    : m_Buckets(SizeValueType{ 1 } << (8 * sizeof(TValue)))
+  {}
+
+  void
+  Push(TValue value, const TIndex & index)
+  {
+    const SizeValueType bucket = ComputeBucket(value);
+    m_Buckets[bucket].push_back(index);
+    m_FirstBucket = std::min(m_FirstBucket, bucket);
+    ++m_NumberOfEntries;
+  }
+
+  bool
+  Empty() const
+  {
+    return m_NumberOfEntries == 0;
+  }
+
+  TValue
+  FrontValue()
+  {
+    this->AdvanceToFirstNonEmptyBucket();
+    using UnsignedValueType = typename std::make_unsigned<TValue>::type;
+    return static_cast<TValue>(static_cast<UnsignedValueType>(m_FirstBucket) +
+                               static_cast<UnsignedValueType>(NumericTraits<TValue>::min()));
+  }
+
+  QueueType
+  PopFrontQueue()
+  {
+    this->AdvanceToFirstNonEmptyBucket();
+    QueueType queue = std::move(m_Buckets[m_FirstBucket]);
+    m_Buckets[m_FirstBucket].clear();
+    m_NumberOfEntries -= queue.size();
+    return queue;
+  }
+
+private:
+  static SizeValueType
+  ComputeBucket(TValue value)
+  {
+    using UnsignedValueType = typename std::make_unsigned<TValue>::type;
+    return static_cast<UnsignedValueType>(static_cast<UnsignedValueType>(value) -
+                                          static_cast<UnsignedValueType>(NumericTraits<TValue>::min()));
+  }
+
+  void
+  AdvanceToFirstNonEmptyBucket()
+  {
+    while (m_Buckets[m_FirstBucket].empty())
+    {
+      ++m_FirstBucket;
+    }
+  }
+
+  std::vector<QueueType> m_Buckets;
+  SizeValueType          m_FirstBucket{ 0 };
+  SizeValueType          m_NumberOfEntries{ 0 };
+};
+
+/** \endcond */
+
 template <typename TInputImage, typename TLabelImage>
 MorphologicalWatershedFromMarkersImageFilter<TInputImage, TLabelImage>::MorphologicalWatershedFromMarkersImageFilter()
 
@@ -114,9 +238,9 @@ MorphologicalWatershedFromMarkersImageFilter<TInputImage, TLabelImage>::Generate
   }
 
   // FAH (in french: File d'Attente Hierarchique)
-  using QueueType = std::queue<IndexType>;
-  using MapType = std::map<InputImagePixelType, QueueType>;
-  MapType fah;
+  using HierarchicalQueueType = MorphologicalWatershedHierarchicalQueue<InputImagePixelType, IndexType>;
+  using QueueType = typename HierarchicalQueueType::QueueType;
+  HierarchicalQueueType fah;
 
   // the radius which will be used for all the shaped iterators
   Size<ImageDimension> radius;
@@ -215,7 +339,7 @@ MorphologicalWatershedFromMarkersImageFilter<TInputImage, TLabelImage>::Generate
           {
             // this neighbor is a background pixel and is not already
             // processed; add its index to fah
-            fah[niIt.Get()].push(markerIt.GetIndex() + nmIt.GetNeighborhoodOffset());
+            fah.Push(niIt.Get(), markerIt.GetIndex() + nmIt.GetNeighborhoodOffset());
             // mark it as already in the fah to avoid adding it several times
             nsIt.Set(true);
           }
@@ -245,18 +369,17 @@ MorphologicalWatershedFromMarkersImageFilter<TInputImage, TLabelImage>::Generate
     inputIt.GoToBegin();
 
     // and start flooding
-    while (!fah.empty())
+    while (!fah.Empty())
     {
       // store the current vars
-      InputImagePixelType currentValue = fah.begin()->first;
-      QueueType           currentQueue = fah.begin()->second;
+      InputImagePixelType currentValue = fah.FrontValue();
       // and remove them from the fah
-      fah.erase(fah.begin());
+      QueueType currentQueue = fah.PopFrontQueue();
 
       while (!currentQueue.empty())
       {
         IndexType idx = currentQueue.front();
-        currentQueue.pop();
+        currentQueue.pop_front();
 
         // move the iterators to the right place
         OffsetType shift = idx - outputIt.GetIndex();
@@ -297,11 +420,11 @@ MorphologicalWatershedFromMarkersImageFilter<TInputImage, TLabelImage>::Generate
               InputImagePixelType GrayVal = niIt.Get();
               if (GrayVal <= currentValue)
               {
-                currentQueue.push(inputIt.GetIndex() + niIt.GetNeighborhoodOffset());
+                currentQueue.push_back(inputIt.GetIndex() + niIt.GetNeighborhoodOffset());
               }
               else
               {
-                fah[GrayVal].push(inputIt.GetIndex() + niIt.GetNeighborhoodOffset());
+                fah.Push(GrayVal, inputIt.GetIndex() + niIt.GetNeighborhoodOffset());
               }
               // mark it as already in the fah
               nsIt.Set(true);
@@ -355,7 +478,7 @@ MorphologicalWatershedFromMarkersImageFilter<TInputImage, TLabelImage>::Generate
         if (haveBgNeighbor)
         {
           // there is a background pixel in the neighborhood; add to fah
-          fah[inputIt.GetCenterPixel()].push(markerIt.GetIndex());
+          fah.Push(inputIt.GetCenterPixel(), markerIt.GetIndex());
         }
         else
         {
@@ -378,18 +501,17 @@ MorphologicalWatershedFromMarkersImageFilter<TInputImage, TLabelImage>::Generate
     inputIt.GoToBegin();
 
     // and start flooding
-    while (!fah.empty())
+    while (!fah.Empty())
     {
       // store the current vars
-      InputImagePixelType currentValue = fah.begin()->first;
-      QueueType           currentQueue = fah.begin()->second;
+      InputImagePixelType currentValue = fah.FrontValue();
       // and remove them from the fah
-      fah.erase(fah.begin());
+      QueueType currentQueue = fah.PopFrontQueue();
 
       while (!currentQueue.empty())
       {
         IndexType idx = currentQueue.front();
-        currentQueue.pop();
+        currentQueue.pop_front();
 
         // move the iterators to the right place
         OffsetType shift = idx - outputIt.GetIndex();
@@ -409,11 +531,11 @@ MorphologicalWatershedFromMarkersImageFilter<TInputImage, TLabelImage>::Generate
             InputImagePixelType GrayVal = niIt.Get();
             if (GrayVal <= currentValue)
             {
-              currentQueue.push(inputIt.GetIndex() + noIt.GetNeighborhoodOffset());
+              currentQueue.push_back(inputIt.GetIndex() + noIt.GetNeighborhoodOffset());
             }
             else
             {
-              fah[GrayVal].push(inputIt.GetIndex() + noIt.GetNeighborhoodOffset());
+              fah.Push(GrayVal, inputIt.GetIndex() + noIt.GetNeighborhoodOffset());
             }
             progress.CompletedPixel();
           }
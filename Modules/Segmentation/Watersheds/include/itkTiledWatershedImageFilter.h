@@ -0,0 +1,177 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkTiledWatershedImageFilter_h
+#define itkTiledWatershedImageFilter_h
+
+#include "itkImageToImageFilter.h"
+#include "itkWatershedSegmenter.h"
+#include "itkWatershedBoundaryResolver.h"
+#include "itkWatershedSegmentTreeGenerator.h"
+#include "itkWatershedRelabeler.h"
+
+namespace itk
+{
+/** \class TiledWatershedImageFilter
+ *  \brief Watershed segmentation that floods the image one tile at a time
+ *   and resolves the labeling across tile faces.
+ *
+ * \par Overview
+ * This filter produces the same kind of labeled output as
+ * itk::WatershedImageFilter, but it exercises the data-streaming mode for
+ * which the watershed components in the "watershed" namespace were
+ * originally designed.  The image is divided into a set of tiles stacked
+ * along the outermost image dimension.  Each tile is flooded independently
+ * by an itk::watershed::Segmenter with boundary analysis enabled, so the
+ * large temporary structures of the initial segmentation (the thresholded
+ * copy of the height function and the flooding tables) only ever cover one
+ * tile at a time.  The segment tables of the tiles are folded into a single
+ * table for the whole volume, and an itk::watershed::BoundaryResolver is
+ * run on each pair of adjacent tile faces to record which segments flow
+ * into one another across a face.  The resulting equivalencies are applied
+ * to the assembled labeled image, a merge tree is generated from the
+ * combined segment table, and the final labeling is produced by an
+ * itk::watershed::Relabeler, exactly as in the non-streaming filter.
+ *
+ * \par
+ * Consecutive tiles overlap by one slice so that every pixel adjacency in
+ * the volume, including those crossing a tile face, is seen by at least one
+ * tile's segment table.  Tiles are processed sequentially because each tile
+ * continues the label numbering of the previous one; the memory bound, not
+ * multithreading, is the point of the decomposition.
+ *
+ * \par Parameters
+ * Threshold and Level have the same meaning and the same [0, 1] range as in
+ * itk::WatershedImageFilter.  NumberOfTiles controls the decomposition; it
+ * is clamped so that every tile keeps at least three slices along the split
+ * dimension, and a value of 1 reproduces the monolithic behavior.
+ *
+ * \par Caveats
+ * The minimum-height threshold is applied per tile relative to the dynamic
+ * range of that tile, so for Threshold > 0 the initial segmentation can
+ * differ slightly from the non-streaming filter near tile faces.  With
+ * Threshold = 0 the decomposition is exact up to the renumbering of labels.
+ * The input and output images themselves are still held in memory in their
+ * entirety; processing images that do not fit in memory additionally
+ * requires a streaming-capable input pipeline.
+ *
+ * \sa WatershedImageFilter
+ * \sa watershed::Segmenter
+ * \sa watershed::BoundaryResolver
+ * \ingroup WatershedSegmentation
+ * \ingroup ITKWatersheds
+ */
+template <typename TInputImage>
+class ITK_TEMPLATE_EXPORT TiledWatershedImageFilter
+  : public ImageToImageFilter<TInputImage, Image<IdentifierType, TInputImage::ImageDimension>>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(TiledWatershedImageFilter);
+
+  /** Standard "Self" type alias.   */
+  using Self = TiledWatershedImageFilter;
+
+  /** The type of input image.   */
+  using InputImageType = TInputImage;
+
+  /** Dimension of the input and output images. */
+  static constexpr unsigned int ImageDimension = TInputImage::ImageDimension;
+
+  /** The type of output image.   */
+  using OutputImageType = Image<IdentifierType, Self::ImageDimension>;
+
+  /** Other convenient type alias   */
+  using RegionType = typename InputImageType::RegionType;
+  using SizeType = typename InputImageType::SizeType;
+  using IndexType = typename InputImageType::IndexType;
+
+  /** Standard super class type alias.   */
+  using Superclass = ImageToImageFilter<InputImageType, OutputImageType>;
+
+  /** Typedef support for the input image scalar value type. */
+  using ScalarType = typename InputImageType::PixelType;
+
+  /** Smart pointer type alias support   */
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Run-time type information (and related methods) */
+  itkTypeMacro(TiledWatershedImageFilter, ImageToImageFilter);
+
+  /** Standard process object method.  This filter is not multithreaded. */
+  void
+  GenerateData() override;
+
+  /** Standard New method. */
+  itkNewMacro(Self);
+
+  /** Set/Get the "flood level" for generating the merge tree from the
+   * initial segmentation.  See itk::WatershedImageFilter for details. */
+  itkSetClampMacro(Level, double, 0.0, 1.0);
+  itkGetConstMacro(Level, double);
+
+  /** Set/Get the minimum-height threshold, as a percentage of the dynamic
+   * range of a tile of the height function.  See the class documentation
+   * for the per-tile caveat. */
+  itkSetClampMacro(Threshold, double, 0.0, 1.0);
+  itkGetConstMacro(Threshold, double);
+
+  /** Set/Get the number of tiles the image is divided into along its
+   * outermost dimension.  The value is clamped at run time so that each
+   * tile keeps at least three slices along the split dimension. */
+  itkSetClampMacro(NumberOfTiles, unsigned int, 1, NumericTraits<unsigned int>::max());
+  itkGetConstMacro(NumberOfTiles, unsigned int);
+
+  /** The component types this filter assembles. */
+  using SegmenterType = watershed::Segmenter<InputImageType>;
+  using BoundaryType = typename SegmenterType::BoundaryType;
+  using SegmentTableType = typename SegmenterType::SegmentTableType;
+  using EquivalencyTableType = EquivalencyTable;
+  using BoundaryResolverType = watershed::BoundaryResolver<ScalarType, Self::ImageDimension>;
+  using TreeGeneratorType = watershed::SegmentTreeGenerator<ScalarType>;
+  using RelabelerType = watershed::Relabeler<ScalarType, Self::ImageDimension>;
+
+  void
+  EnlargeOutputRequestedRegion(DataObject * data) override;
+
+protected:
+  TiledWatershedImageFilter() = default;
+  ~TiledWatershedImageFilter() override = default;
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  /** A Percentage of the maximum depth (max - min pixel value) of the
+   *  input image.  This percentage is used to threshold the minimum values
+   *  in the image. */
+  double m_Threshold{ 0.0 };
+
+  /** The percentage of the maximum saliency value among adjacencies in the
+   *  segments of the initial segmentation for which all various merges are
+   *  precomputed. */
+  double m_Level{ 0.0 };
+
+  /** The number of tiles along the outermost dimension. */
+  unsigned int m_NumberOfTiles{ 4 };
+};
+} // namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkTiledWatershedImageFilter.hxx"
+#endif
+
+#endif
@@ -0,0 +1,216 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkTiledWatershedImageFilter_hxx
+#define itkTiledWatershedImageFilter_hxx
+
+#include "itkTiledWatershedImageFilter.h"
+#include "itkImageAlgorithm.h"
+
+#include <algorithm>
+
+namespace itk
+{
+template <typename TInputImage>
+void
+TiledWatershedImageFilter<TInputImage>::EnlargeOutputRequestedRegion(DataObject * data)
+{
+  // call the superclass' implementation of this method
+  Superclass::EnlargeOutputRequestedRegion(data);
+
+  // This filter requires all of the output image to be in the buffer.
+  auto * imgData = dynamic_cast<ImageBase<ImageDimension> *>(data);
+  if (imgData)
+  {
+    imgData->SetRequestedRegionToLargestPossibleRegion();
+  }
+}
+
+template <typename TInputImage>
+void
+TiledWatershedImageFilter<TInputImage>::GenerateData()
+{
+  auto *           input = const_cast<InputImageType *>(this->GetInput());
+  const RegionType fullRegion = input->GetLargestPossibleRegion();
+
+  // Tiles are stacked along the outermost image dimension, like the chunks
+  // of a streamed pipeline.
+  constexpr unsigned int splitAxis = ImageDimension - 1;
+  const auto             axisSize = static_cast<SizeValueType>(fullRegion.GetSize()[splitAxis]);
+  const IndexValueType   axisStart = fullRegion.GetIndex()[splitAxis];
+
+  // Each tile must keep at least three slices along the split dimension:
+  // one slice of overlap into the previous tile, and room for the segmenter
+  // to shrink the padded request back to the tile itself.
+  SizeValueType numberOfTiles = std::min(static_cast<SizeValueType>(m_NumberOfTiles), axisSize / 3);
+  numberOfTiles = std::max(numberOfTiles, static_cast<SizeValueType>(1));
+
+  // The labeled image assembled from the tiles.  This fills the role of the
+  // segmenter output of the non-streaming filter and is consumed by the
+  // relabeler below.
+  auto assembled = OutputImageType::New();
+  assembled->CopyInformation(input);
+  assembled->SetBufferedRegion(fullRegion);
+  assembled->Allocate();
+
+  // The segment table and the cross-tile equivalencies accumulated over
+  // the whole volume.
+  auto masterTable = SegmentTableType::New();
+  auto equivalencies = EquivalencyTableType::New();
+
+  typename BoundaryType::Pointer previousBoundary;
+  IdentifierType                 nextLabel = 1;
+
+  for (SizeValueType tile = 0; tile < numberOfTiles; ++tile)
+  {
+    // The disjoint span of slices owned by this tile, extended one slice
+    // down into the previous tile.  The one slice overlap guarantees that
+    // every pixel adjacency crossing a tile face is recorded in the
+    // segment table of the upper tile.
+    IndexValueType firstSlice = axisStart + static_cast<IndexValueType>(tile * axisSize / numberOfTiles);
+    const IndexValueType lastSlice = axisStart + static_cast<IndexValueType>((tile + 1) * axisSize / numberOfTiles) - 1;
+    if (tile > 0)
+    {
+      firstSlice -= 1;
+    }
+
+    RegionType tileRegion = fullRegion;
+    {
+      IndexType idx = tileRegion.GetIndex();
+      SizeType  sz = tileRegion.GetSize();
+      idx[splitAxis] = firstSlice;
+      sz[splitAxis] = static_cast<SizeValueType>(lastSlice - firstSlice + 1);
+      tileRegion.SetIndex(idx);
+      tileRegion.SetSize(sz);
+    }
+
+    // The region requested from the segmenter is the tile padded by one
+    // slice on each face shared with a neighboring tile.  The segmenter
+    // shrinks the request back to the tile and uses the padding to analyze
+    // the flow of segments across the faces.
+    RegionType paddedRegion = tileRegion;
+    {
+      IndexType idx = paddedRegion.GetIndex();
+      SizeType  sz = paddedRegion.GetSize();
+      if (tile > 0)
+      {
+        idx[splitAxis] -= 1;
+        sz[splitAxis] += 1;
+      }
+      if (tile < numberOfTiles - 1)
+      {
+        sz[splitAxis] += 1;
+      }
+      paddedRegion.SetIndex(idx);
+      paddedRegion.SetSize(sz);
+    }
+
+    // A fresh segmenter per tile.  Boundary analysis keeps the segment
+    // table and the label counter of the previous tiles intact, so the
+    // label ranges of the tiles are disjoint.
+    auto segmenter = SegmenterType::New();
+    segmenter->SetInputImage(input);
+    segmenter->SetLargestPossibleRegion(fullRegion);
+    segmenter->SetDoBoundaryAnalysis(true);
+    segmenter->SetSortEdgeLists(true);
+    segmenter->SetThreshold(m_Threshold);
+    segmenter->SetCurrentLabel(nextLabel);
+    segmenter->GetOutputImage()->UpdateOutputInformation();
+    segmenter->GetOutputImage()->SetRequestedRegion(paddedRegion);
+    segmenter->Update();
+    nextLabel = segmenter->GetCurrentLabel();
+
+    // Copy the tile labeling into the assembled image.  The slice shared
+    // with the previous tile is overwritten with this tile's labels; the
+    // boundary resolution below records the equivalence of the two.
+    ImageAlgorithm::Copy(segmenter->GetOutputImage(), assembled.GetPointer(), tileRegion, tileRegion);
+
+    // Fold the tile's segment table into the table for the whole volume.
+    SegmentTableType * tileTable = segmenter->GetSegmentTable();
+    for (auto segmentIt = tileTable->Begin(); segmentIt != tileTable->End(); ++segmentIt)
+    {
+      masterTable->Add(segmentIt->first, segmentIt->second);
+    }
+
+    // Detach the boundary from its segmenter so that updating the resolver
+    // cannot re-execute a previous tile.
+    typename BoundaryType::Pointer boundary = segmenter->GetBoundary();
+    boundary->DisconnectPipeline();
+
+    if (previousBoundary.IsNotNull())
+    {
+      auto resolver = BoundaryResolverType::New();
+      resolver->SetBoundaryA(previousBoundary);
+      resolver->SetBoundaryB(boundary);
+      resolver->SetFace(splitAxis);
+      resolver->SetEquivalencyTable(equivalencies);
+      resolver->Update();
+    }
+    previousBoundary = boundary;
+
+    this->UpdateProgress(0.7 * static_cast<float>(tile + 1) / static_cast<float>(numberOfTiles));
+  }
+
+  // The flood level is interpreted relative to the dynamic range of the
+  // whole volume, not of any single tile.
+  ScalarType minimum;
+  ScalarType maximum;
+  SegmenterType::MinMax(input, fullRegion, minimum, maximum);
+  masterTable->SetMaximumDepth(static_cast<ScalarType>(maximum - minimum));
+
+  // Apply the cross-tile equivalencies to the assembled labeling so that
+  // segments split by a tile face carry a single label.
+  equivalencies->Flatten();
+  SegmenterType::RelabelImage(assembled, fullRegion, equivalencies);
+
+  // From here on the pipeline is the same as in the non-streaming filter:
+  // generate the merge tree from the combined segment table and relabel up
+  // to the requested flood level.
+  auto treeGenerator = TreeGeneratorType::New();
+  treeGenerator->SetInputSegmentTable(masterTable);
+  treeGenerator->SetInputEquivalencyTable(equivalencies);
+  treeGenerator->SetMerge(true);
+  treeGenerator->SetFloodLevel(m_Level);
+  treeGenerator->Update();
+  this->UpdateProgress(0.85);
+
+  auto relabeler = RelabelerType::New();
+  relabeler->SetInputImage(assembled);
+  relabeler->SetInputSegmentTree(treeGenerator->GetOutputSegmentTree());
+  relabeler->SetFloodLevel(m_Level);
+
+  // Graft our output on the relabeler
+  relabeler->GraftOutput(this->GetOutput());
+  relabeler->Update();
+
+  // Graft the output of the relabeler back on this filter
+  this->GraftOutput(relabeler->GetOutputImage());
+  this->UpdateProgress(1.0);
+}
+
+template <typename TInputImage>
+void
+TiledWatershedImageFilter<TInputImage>::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+  os << indent << "Threshold: " << m_Threshold << std::endl;
+  os << indent << "Level: " << m_Level << std::endl;
+  os << indent << "NumberOfTiles: " << m_NumberOfTiles << std::endl;
+}
+} // namespace itk
+
+#endif
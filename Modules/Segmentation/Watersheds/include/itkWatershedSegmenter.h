@@ -211,6 +211,11 @@ public:
       an image according to a table of equivalencies. */
   static void RelabelImage(OutputImageTypePointer, ImageRegionType, EquivalencyTable::Pointer);
 
+  /** Helper function.  Other classes may have occasion to use this. Finds
+      the minimum and maximum values in an image. */
+  static void
+  MinMax(InputImageTypePointer img, ImageRegionType region, InputPixelType & min, InputPixelType & max);
+
   /** Standard itk::ProcessObject subclass method. */
   using DataObjectPointerArraySizeType = ProcessObject::DataObjectPointerArraySizeType;
   using Superclass::MakeOutput;
@@ -359,10 +364,6 @@ protected:
             const ImageRegionType destination_region,
             InputPixelType        threshold);
 
-  /** Helper function.  Finds the minimum and maximum values in an image. */
-  static void
-  MinMax(InputImageTypePointer img, ImageRegionType region, InputPixelType & min, InputPixelType & max);
-
   /** Helper function. Finds the minimum and maximum values in an image.   */
   static void
   MergeFlatRegions(flat_region_table_t &, EquivalencyTable::Pointer);
@@ -0,0 +1,134 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkTiledWatershedImageFilter.h"
+#include "itkWatershedImageFilter.h"
+#include "itkImageRegionConstIteratorWithIndex.h"
+#include "itkTestingMacros.h"
+
+#include <map>
+
+int
+itkTiledWatershedImageFilterTest(int, char *[])
+{
+  constexpr unsigned int Dimension = 2;
+
+  using PixelType = float;
+  using ImageType = itk::Image<PixelType, Dimension>;
+  using LabelImageType = itk::Image<itk::IdentifierType, Dimension>;
+
+  // A smooth height function with several basins in each tile and basins
+  // that straddle the tile faces.
+  ImageType::SizeType size;
+  size[0] = 64;
+  size[1] = 64;
+
+  auto image = ImageType::New();
+  image->SetRegions(size);
+  image->Allocate();
+
+  itk::ImageRegionConstIteratorWithIndex<ImageType> inputIt(image, image->GetRequestedRegion());
+  for (inputIt.GoToBegin(); !inputIt.IsAtEnd(); ++inputIt)
+  {
+    const ImageType::IndexType index = inputIt.GetIndex();
+    const auto                 x = static_cast<float>(index[0]);
+    const auto                 y = static_cast<float>(index[1]);
+    image->SetPixel(index, std::sin(x * 0.4f) * std::sin(y * 0.4f) + 0.02f * x + 0.01f * y);
+  }
+
+  constexpr double level = 0.2;
+
+  // Reference: the non-streaming watershed filter
+  itk::WatershedImageFilter<ImageType>::Pointer reference = itk::WatershedImageFilter<ImageType>::New();
+  reference->SetInput(image);
+  reference->SetThreshold(0.0);
+  reference->SetLevel(level);
+  ITK_TRY_EXPECT_NO_EXCEPTION(reference->Update());
+
+  using TiledFilterType = itk::TiledWatershedImageFilter<ImageType>;
+  auto tiled = TiledFilterType::New();
+
+  ITK_EXERCISE_BASIC_OBJECT_METHODS(tiled, TiledWatershedImageFilter, ImageToImageFilter);
+
+  tiled->SetThreshold(0.0);
+  ITK_TEST_SET_GET_VALUE(0.0, tiled->GetThreshold());
+
+  tiled->SetLevel(level);
+  ITK_TEST_SET_GET_VALUE(level, tiled->GetLevel());
+
+  constexpr unsigned int numberOfTiles = 3;
+  tiled->SetNumberOfTiles(numberOfTiles);
+  ITK_TEST_SET_GET_VALUE(numberOfTiles, tiled->GetNumberOfTiles());
+
+  tiled->SetInput(image);
+  ITK_TRY_EXPECT_NO_EXCEPTION(tiled->Update());
+
+  // With a zero threshold the tiled decomposition must reproduce the
+  // partition of the non-streaming filter.  The label values themselves
+  // are numbered differently, so check that the two labelings are related
+  // by a one-to-one relabeling.
+  std::map<itk::IdentifierType, itk::IdentifierType> forward;
+  std::map<itk::IdentifierType, itk::IdentifierType> backward;
+
+  itk::ImageRegionConstIteratorWithIndex<LabelImageType> labelIt(reference->GetOutput(),
+                                                                 reference->GetOutput()->GetBufferedRegion());
+  for (labelIt.GoToBegin(); !labelIt.IsAtEnd(); ++labelIt)
+  {
+    const itk::IdentifierType referenceLabel = labelIt.Get();
+    const itk::IdentifierType tiledLabel = tiled->GetOutput()->GetPixel(labelIt.GetIndex());
+
+    const auto forwardIt = forward.find(referenceLabel);
+    if (forwardIt == forward.end())
+    {
+      forward[referenceLabel] = tiledLabel;
+    }
+    else if (forwardIt->second != tiledLabel)
+    {
+      std::cout << "Error at index [" << labelIt.GetIndex() << "]" << std::endl;
+      std::cout << "Reference label " << referenceLabel << " maps to both " << forwardIt->second << " and "
+                << tiledLabel << std::endl;
+      std::cout << "Test failed" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    const auto backwardIt = backward.find(tiledLabel);
+    if (backwardIt == backward.end())
+    {
+      backward[tiledLabel] = referenceLabel;
+    }
+    else if (backwardIt->second != referenceLabel)
+    {
+      std::cout << "Error at index [" << labelIt.GetIndex() << "]" << std::endl;
+      std::cout << "Tiled label " << tiledLabel << " maps to both " << backwardIt->second << " and " << referenceLabel
+                << std::endl;
+      std::cout << "Test failed" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // A single tile must also work and take the same code path.
+  auto singleTile = TiledFilterType::New();
+  singleTile->SetInput(image);
+  singleTile->SetThreshold(0.0);
+  singleTile->SetLevel(level);
+  singleTile->SetNumberOfTiles(1);
+  ITK_TRY_EXPECT_NO_EXCEPTION(singleTile->Update());
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -53,6 +53,11 @@ namespace itk
  * Each method is templated over the type of itk::Image used.  The conversions
  * copy the data and convert between types if necessary.
  *
+ * The View variants wrap the existing pixel buffer instead of copying it.
+ * They require matching component types and a contiguous buffer, perform no
+ * channel reordering, and do not transfer ownership: the object providing
+ * the buffer must outlive every use of the wrapping one.
+ *
  * \ingroup ITKVideoBridgeOpenCV
  */
 class OpenCVImageBridge
@@ -73,6 +78,18 @@ public:
   static typename TOutputImageType::Pointer
   CVMatToITKImage(const cv::Mat & in);
 
+  /** cv::Mat -> itk::Image referencing the Mat's buffer (zero copy).
+   * The returned image imports the Mat's pixel buffer without taking
+   * ownership, so the Mat (or another holder of its data) must outlive the
+   * image. The Mat must be continuous and its depth and channel count must
+   * match the image pixel type exactly; no type or color conversion is
+   * performed, so 3-channel data keeps the Mat's BGR channel order.
+   * VectorImage outputs are not supported. Use CVMatToITKImage when a
+   * converting, owning copy is needed. */
+  template <typename TOutputImageType>
+  static typename TOutputImageType::Pointer
+  CVMatToITKImageView(const cv::Mat & in);
+
   /** itk::Image -> IplImage* */
   template <typename TInputImageType>
   static IplImage *
@@ -83,6 +100,17 @@ public:
   static cv::Mat
   ITKImageToCVMat(const TInputImageType * in, bool force3Channels = false);
 
+  /** itk::Image -> cv::Mat referencing the image's buffer (zero copy).
+   * The returned Mat is a header over the image's pixel container: no
+   * pixel is copied, no channel reordering is performed (3-channel data
+   * keeps the image's RGB channel order), and the Mat does not take
+   * ownership -- the itk image must outlive every use of the returned
+   * header. Use ITKImageToCVMat when an owning, BGR converted copy is
+   * needed. */
+  template <typename TInputImageType>
+  static cv::Mat
+  ITKImageToCVMatView(const TInputImageType * in);
+
 private:
   /** Steps involved in this method are:
     1) Handle converting between colorspaces
@@ -248,36 +276,50 @@ private:
     out->SetRegions(region);
     out->SetSpacing(spacing);
     out->Allocate();
-    size_t       lineLength = imgWidth * inChannels * sizeof(TPixel);
-    void *       unpaddedBuffer = reinterpret_cast<void *>(new TPixel[imgHeight * lineLength]);
-    unsigned int paddedBufPos = 0;
-    unsigned int unpaddedBufPos = 0;
 
-    for (int i = 0; i < imgHeight; ++i)
-    {
-      memcpy(&(reinterpret_cast<char *>(unpaddedBuffer)[unpaddedBufPos]), in + paddedBufPos, lineLength);
-      paddedBufPos += widthStep;
-      unpaddedBufPos += lineLength;
-    }
+    const size_t lineLength = imgWidth * inChannels * sizeof(TPixel);
+    const bool   contiguous = (static_cast<size_t>(widthStep) == lineLength);
 
-    if (isVectorImage)
+    if (!isVectorImage)
     {
-      ConvertPixelBuffer<TPixel, OutputPixelType, ConvertPixelTraits>::ConvertVectorImage(
-        static_cast<TPixel *>(unpaddedBuffer),
-        inChannels,
-        out->GetPixelContainer()->GetBufferPointer(),
-        out->GetPixelContainer()->Size());
+      // checkMatchingTypes has already guaranteed that the component type
+      // matches TPixel and, for 3 channels, that the pixel type is
+      // RGBPixel<TPixel>; both layouts are byte-compatible with the
+      // interleaved OpenCV rows, so the rows can be copied in bulk without
+      // an unpadded staging buffer or a per-element conversion.
+      auto * outBuffer = reinterpret_cast<char *>(out->GetPixelContainer()->GetBufferPointer());
+      if (contiguous)
+      {
+        memcpy(outBuffer, in, imgHeight * lineLength);
+      }
+      else
+      {
+        for (int i = 0; i < imgHeight; ++i)
+        {
+          memcpy(outBuffer + i * lineLength, in + i * static_cast<size_t>(widthStep), lineLength);
+        }
+      }
+      return;
     }
-    else
+
+    // Vector images convert through ConvertPixelBuffer; strip the row
+    // padding first unless the buffer is already contiguous.
+    TPixel * unpaddedBuffer = nullptr;
+    auto *   convertSource = reinterpret_cast<TPixel *>(const_cast<char *>(in));
+    if (!contiguous)
     {
-      ConvertPixelBuffer<TPixel, OutputPixelType, ConvertPixelTraits>::Convert(
-        static_cast<TPixel *>(unpaddedBuffer),
-        inChannels,
-        out->GetPixelContainer()->GetBufferPointer(),
-        out->GetPixelContainer()->Size());
+      unpaddedBuffer = new TPixel[static_cast<size_t>(imgHeight) * imgWidth * inChannels];
+      for (int i = 0; i < imgHeight; ++i)
+      {
+        memcpy(reinterpret_cast<char *>(unpaddedBuffer) + i * lineLength, in + i * static_cast<size_t>(widthStep), lineLength);
+      }
+      convertSource = unpaddedBuffer;
     }
 
-    delete[] reinterpret_cast<TPixel *>(unpaddedBuffer);
+    ConvertPixelBuffer<TPixel, OutputPixelType, ConvertPixelTraits>::ConvertVectorImage(
+      convertSource, inChannels, out->GetPixelContainer()->GetBufferPointer(), out->GetPixelContainer()->Size());
+
+    delete[] unpaddedBuffer;
   }
 
   template <typename TPixel, unsigned int VDimension>
@@ -236,9 +236,17 @@ OpenCVImageBridge::ITKImageToIplImage(const TInputImageType * in, bool force3Cha
   if (outChannels == 1)
   {
     size_t paddedRowBytes = typeSize * out->width;
-    for (int i = 0; i < out->height; ++i)
+    if (static_cast<size_t>(out->widthStep) == paddedRowBytes)
     {
-      memcpy(out->imageData + i * out->widthStep, in->GetBufferPointer() + i * out->width, paddedRowBytes);
+      // no row padding: copy the whole frame in one call
+      memcpy(out->imageData, in->GetBufferPointer(), paddedRowBytes * out->height);
+    }
+    else
+    {
+      for (int i = 0; i < out->height; ++i)
+      {
+        memcpy(out->imageData + i * out->widthStep, in->GetBufferPointer() + i * out->width, paddedRowBytes);
+      }
     }
   }
   // RGB output
@@ -266,7 +274,7 @@ OpenCVImageBridge::ITKImageToIplImage(const TInputImageType * in, bool force3Cha
   return out;
 }
 
-// ITKImageToIplImage
+// ITKImageToCVMat
 template <typename TInputImageType>
 cv::Mat
 OpenCVImageBridge::ITKImageToCVMat(const TInputImageType * in, bool force3Channels)
@@ -278,6 +286,70 @@ OpenCVImageBridge::ITKImageToCVMat(const TInputImageType * in, bool force3Channe
   using InputPixelType = typename ImageType::PixelType;
   using ValueType = typename itk::NumericTraits<InputPixelType>::ValueType;
 
+  if (!in)
+  {
+    itkGenericExceptionMacro("Input is nullptr");
+  }
+
+  unsigned int inChannels = itk::NumericTraits<InputPixelType>::MeasurementVectorType::Dimension;
+  if (inChannels != 1 && inChannels != 3)
+  {
+    itkGenericExceptionMacro("OpenCV only supports scalar and 3-channel data");
+  }
+
+  // cvtColor does not support multi-channel output for these depths
+  if (inChannels == 3 || force3Channels)
+  {
+    if (typeid(ValueType) == typeid(char))
+    {
+      itkGenericExceptionMacro("OpenCV does not support color images with pixels of type char");
+    }
+    if (typeid(ValueType) == typeid(short))
+    {
+      itkGenericExceptionMacro("OpenCV does not support color images with pixels of type short");
+    }
+    if (typeid(ValueType) == typeid(int))
+    {
+      itkGenericExceptionMacro("OpenCV does not support color images with pixels of type int");
+    }
+    if (typeid(ValueType) == typeid(double))
+    {
+      itkGenericExceptionMacro("OpenCV does not support color images with pixels of type double");
+    }
+  }
+
+  // Wrap the input buffer without copying, then convert into the output
+  Mat tmp = ITKImageToCVMatView(in);
+
+  Mat out;
+  if (inChannels == 3)
+  {
+    cvtColor(tmp, out, COLOR_RGB2BGR);
+  }
+  else if (inChannels == 1 && force3Channels)
+  {
+    cvtColor(tmp, out, COLOR_GRAY2BGR);
+  }
+  else
+  {
+    tmp.copyTo(out);
+  }
+
+  return out;
+}
+
+// ITKImageToCVMatView
+template <typename TInputImageType>
+cv::Mat
+OpenCVImageBridge::ITKImageToCVMatView(const TInputImageType * in)
+{
+  using namespace cv;
+
+  // Typedefs
+  using ImageType = TInputImageType;
+  using InputPixelType = typename ImageType::PixelType;
+  using ValueType = typename itk::NumericTraits<InputPixelType>::ValueType;
+
   // Make sure input isn't null, is 2D or 1D, and is scalar or RGB
   if (!in)
   {
@@ -309,85 +381,149 @@ OpenCVImageBridge::ITKImageToCVMat(const TInputImageType * in, bool force3Channe
     itkGenericExceptionMacro("OpenCV only supports scalar and 3-channel data");
   }
 
-  unsigned int outChannels = inChannels;
-
-  // Set up the output image
-  Mat          tmp;
   unsigned int w = static_cast<unsigned int>(size[0]);
   unsigned int h = static_cast<unsigned int>(size[1]);
 
   // set the depth correctly based on input pixel type
+  int depth;
   if (typeid(ValueType) == typeid(unsigned char))
   {
-    tmp = Mat(h,
-              w,
-              CV_8UC(outChannels),
-              reinterpret_cast<unsigned char *>(const_cast<InputPixelType *>(in->GetBufferPointer())));
+    depth = CV_8U;
   }
   else if (typeid(ValueType) == typeid(char))
   {
-    if (outChannels != 1 || force3Channels)
-    {
-      itkGenericExceptionMacro("OpenCV does not support color images with pixels of type char");
-    }
-    tmp = Mat(h, w, CV_8SC1, reinterpret_cast<unsigned char *>(const_cast<InputPixelType *>(in->GetBufferPointer())));
+    depth = CV_8S;
   }
   else if (typeid(ValueType) == typeid(unsigned short))
   {
-    tmp = Mat(h,
-              w,
-              CV_16UC(outChannels),
-              reinterpret_cast<unsigned char *>(const_cast<InputPixelType *>(in->GetBufferPointer())));
+    depth = CV_16U;
   }
   else if (typeid(ValueType) == typeid(short))
   {
-    if (outChannels != 1 || force3Channels)
-    {
-      itkGenericExceptionMacro("OpenCV does not support color images with pixels of type short");
-    }
-    tmp = Mat(h, w, CV_16SC1, reinterpret_cast<unsigned char *>(const_cast<InputPixelType *>(in->GetBufferPointer())));
+    depth = CV_16S;
   }
-  else if (typeid(ValueType) == typeid(float))
+  else if (typeid(ValueType) == typeid(int))
   {
-    tmp = Mat(h,
-              w,
-              CV_32FC(outChannels),
-              reinterpret_cast<unsigned char *>(const_cast<InputPixelType *>(in->GetBufferPointer())));
+    depth = CV_32S;
   }
-  else if (typeid(ValueType) == typeid(int))
+  else if (typeid(ValueType) == typeid(float))
   {
-    if (outChannels != 1 || force3Channels)
-    {
-      itkGenericExceptionMacro("OpenCV does not support color images with pixels of type int");
-    }
-    tmp = Mat(h, w, CV_32SC1, reinterpret_cast<unsigned char *>(const_cast<InputPixelType *>(in->GetBufferPointer())));
+    depth = CV_32F;
   }
   else if (typeid(ValueType) == typeid(double))
   {
-    if (outChannels != 1 || force3Channels)
-    {
-      itkGenericExceptionMacro("OpenCV does not support color images with pixels of type double");
-    }
-    tmp = Mat(h, w, CV_64FC1, reinterpret_cast<unsigned char *>(const_cast<InputPixelType *>(in->GetBufferPointer())));
+    depth = CV_64F;
   }
   else
   {
     itkGenericExceptionMacro("OpenCV does not support the input pixel type");
   }
 
-  Mat out;
-  if (inChannels == 3)
+  // A Mat header over the image's pixel container: no pixel is copied and
+  // no ownership is taken
+  return Mat(h,
+             w,
+             CV_MAKETYPE(depth, inChannels),
+             reinterpret_cast<unsigned char *>(const_cast<InputPixelType *>(in->GetBufferPointer())));
+}
+
+// CVMatToITKImageView
+template <typename TOutputImageType>
+typename TOutputImageType::Pointer
+OpenCVImageBridge::CVMatToITKImageView(const cv::Mat & in)
+{
+  // Typedefs
+  using ImageType = TOutputImageType;
+  using OutputPixelType = typename ImageType::PixelType;
+  using ValueType = typename itk::NumericTraits<OutputPixelType>::ValueType;
+
+  if (in.empty())
   {
-    cvtColor(tmp, out, COLOR_RGB2BGR);
+    itkGenericExceptionMacro("Input is empty");
   }
-  else if (inChannels == 1 && force3Channels)
+  if (in.dims > 2)
   {
-    cvtColor(tmp, out, COLOR_GRAY2BGR);
+    itkGenericExceptionMacro("OpenCV only supports 2D and 1D images");
+  }
+  if (!in.isContinuous())
+  {
+    itkGenericExceptionMacro("Zero-copy wrapping requires a continuous cv::Mat buffer;"
+                             " use CVMatToITKImage for padded data");
+  }
+
+  auto out = ImageType::New();
+
+  if (strcmp(out->GetNameOfClass(), "VectorImage") == 0)
+  {
+    itkGenericExceptionMacro("Zero-copy wrapping does not support VectorImage;"
+                             " use CVMatToITKImage instead");
+  }
+
+  const unsigned int outChannels = itk::NumericTraits<OutputPixelType>::MeasurementVectorType::Dimension;
+  if (static_cast<unsigned int>(in.channels()) != outChannels)
+  {
+    itkGenericExceptionMacro("Zero-copy wrapping requires a matching channel count: the input has "
+                             << in.channels() << " channels, the output pixel type has " << outChannels);
+  }
+
+  int depth;
+  if (typeid(ValueType) == typeid(unsigned char))
+  {
+    depth = CV_8U;
+  }
+  else if (typeid(ValueType) == typeid(char))
+  {
+    depth = CV_8S;
+  }
+  else if (typeid(ValueType) == typeid(unsigned short))
+  {
+    depth = CV_16U;
+  }
+  else if (typeid(ValueType) == typeid(short))
+  {
+    depth = CV_16S;
+  }
+  else if (typeid(ValueType) == typeid(int))
+  {
+    depth = CV_32S;
+  }
+  else if (typeid(ValueType) == typeid(float))
+  {
+    depth = CV_32F;
+  }
+  else if (typeid(ValueType) == typeid(double))
+  {
+    depth = CV_64F;
   }
   else
   {
-    tmp.copyTo(out);
+    itkGenericExceptionMacro("OpenCV does not support the output pixel type");
   }
+  if (in.depth() != depth)
+  {
+    itkGenericExceptionMacro("OpenCV to ITK conversion pixel type mismatch");
+  }
+
+  typename ImageType::RegionType            region;
+  typename ImageType::RegionType::SizeType  size;
+  typename ImageType::RegionType::IndexType start;
+  typename ImageType::SpacingType           spacing;
+  size.Fill(1);
+  size[0] = in.cols;
+  size[1] = in.rows;
+  start.Fill(0);
+  spacing.Fill(1);
+  region.SetSize(size);
+  region.SetIndex(start);
+  out->SetRegions(region);
+  out->SetSpacing(spacing);
+
+  // Import the Mat's buffer without taking ownership: the Mat (or another
+  // holder of its data) must outlive the image
+  out->GetPixelContainer()->SetImportPointer(
+    reinterpret_cast<OutputPixelType *>(const_cast<unsigned char *>(in.ptr())),
+    static_cast<SizeValueType>(in.rows) * static_cast<SizeValueType>(in.cols),
+    false);
 
   return out;
 }
@@ -0,0 +1,137 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkOpenCVImageBridge.h"
+#include "itkRGBPixel.h"
+#include "itkTestingMacros.h"
+
+// Exercises the zero-copy view conversions of OpenCVImageBridge: the
+// wrapping object must reference the exact pixel buffer of the wrapped
+// one, and incompatible layouts must be rejected.
+int
+itkOpenCVImageBridgeViewTest(int, char *[])
+{
+  using ScalarImageType = itk::Image<unsigned char, 2>;
+  using RGBImageType = itk::Image<itk::RGBPixel<unsigned char>, 2>;
+
+  constexpr unsigned int width = 16;
+  constexpr unsigned int height = 8;
+
+  //
+  // itk::Image -> cv::Mat view
+  //
+  auto scalarImage = ScalarImageType::New();
+  {
+    ScalarImageType::RegionType region;
+    region.SetSize(0, width);
+    region.SetSize(1, height);
+    scalarImage->SetRegions(region);
+    scalarImage->Allocate();
+    unsigned char * buffer = scalarImage->GetBufferPointer();
+    for (unsigned int i = 0; i < width * height; ++i)
+    {
+      buffer[i] = static_cast<unsigned char>(i % 251);
+    }
+  }
+
+  cv::Mat scalarView = itk::OpenCVImageBridge::ITKImageToCVMatView(scalarImage.GetPointer());
+  ITK_TEST_EXPECT_EQUAL(scalarView.rows, static_cast<int>(height));
+  ITK_TEST_EXPECT_EQUAL(scalarView.cols, static_cast<int>(width));
+  ITK_TEST_EXPECT_EQUAL(scalarView.type(), CV_8UC1);
+  ITK_TEST_EXPECT_TRUE(scalarView.ptr() == scalarImage->GetBufferPointer());
+
+  // a write through the view must land in the itk buffer
+  scalarView.at<unsigned char>(3, 5) = 213;
+  {
+    ScalarImageType::IndexType index;
+    index[0] = 5;
+    index[1] = 3;
+    ITK_TEST_EXPECT_EQUAL(static_cast<int>(scalarImage->GetPixel(index)), 213);
+  }
+
+  auto rgbImage = RGBImageType::New();
+  {
+    RGBImageType::RegionType region;
+    region.SetSize(0, width);
+    region.SetSize(1, height);
+    rgbImage->SetRegions(region);
+    rgbImage->Allocate();
+    itk::RGBPixel<unsigned char> pixel;
+    pixel.Set(10, 20, 30);
+    rgbImage->FillBuffer(pixel);
+  }
+
+  cv::Mat rgbView = itk::OpenCVImageBridge::ITKImageToCVMatView(rgbImage.GetPointer());
+  ITK_TEST_EXPECT_EQUAL(rgbView.type(), CV_8UC3);
+  ITK_TEST_EXPECT_TRUE(rgbView.ptr() == reinterpret_cast<unsigned char *>(rgbImage->GetBufferPointer()));
+  // no channel reordering: the view keeps the image's RGB order
+  ITK_TEST_EXPECT_EQUAL(static_cast<int>(rgbView.at<cv::Vec3b>(0, 0)[0]), 10);
+  ITK_TEST_EXPECT_EQUAL(static_cast<int>(rgbView.at<cv::Vec3b>(0, 0)[2]), 30);
+
+  //
+  // cv::Mat -> itk::Image view
+  //
+  cv::Mat mat(height, width, CV_8UC1);
+  for (unsigned int r = 0; r < height; ++r)
+  {
+    for (unsigned int c = 0; c < width; ++c)
+    {
+      mat.at<unsigned char>(r, c) = static_cast<unsigned char>(3 * r + c);
+    }
+  }
+
+  const ScalarImageType::Pointer wrapped = itk::OpenCVImageBridge::CVMatToITKImageView<ScalarImageType>(mat);
+  ITK_TEST_EXPECT_EQUAL(wrapped->GetLargestPossibleRegion().GetSize()[0], width);
+  ITK_TEST_EXPECT_EQUAL(wrapped->GetLargestPossibleRegion().GetSize()[1], height);
+  ITK_TEST_EXPECT_TRUE(wrapped->GetBufferPointer() == mat.ptr());
+
+  // a write through the Mat must be visible in the itk image
+  mat.at<unsigned char>(2, 7) = 99;
+  {
+    ScalarImageType::IndexType index;
+    index[0] = 7;
+    index[1] = 2;
+    ITK_TEST_EXPECT_EQUAL(static_cast<int>(wrapped->GetPixel(index)), 99);
+  }
+
+  //
+  // incompatible layouts must be rejected
+  //
+
+  // non-continuous buffer (a column ROI keeps the parent's stride)
+  cv::Mat roi = mat(cv::Rect(2, 0, 8, height));
+  ITK_TRY_EXPECT_EXCEPTION(itk::OpenCVImageBridge::CVMatToITKImageView<ScalarImageType>(roi));
+
+  // component type mismatch
+  cv::Mat floatMat(height, width, CV_32FC1, cv::Scalar(0));
+  ITK_TRY_EXPECT_EXCEPTION(itk::OpenCVImageBridge::CVMatToITKImageView<ScalarImageType>(floatMat));
+
+  // channel count mismatch
+  cv::Mat rgbMat(height, width, CV_8UC3, cv::Scalar(0, 0, 0));
+  ITK_TRY_EXPECT_EXCEPTION(itk::OpenCVImageBridge::CVMatToITKImageView<ScalarImageType>(rgbMat));
+
+  //
+  // the copying conversion must still agree with the view
+  //
+  cv::Mat copied = itk::OpenCVImageBridge::ITKImageToCVMat(scalarImage.GetPointer());
+  ITK_TEST_EXPECT_TRUE(copied.ptr() != scalarImage->GetBufferPointer());
+  ITK_TEST_EXPECT_TRUE(cv::countNonZero(copied != scalarView) == 0);
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
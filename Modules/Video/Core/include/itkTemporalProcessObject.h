@@ -18,6 +18,7 @@
 #ifndef itkTemporalProcessObject_h
 #define itkTemporalProcessObject_h
 
+#include "itkNumericTraits.h"
 #include "itkProcessObject.h"
 #include "itkTemporalRegion.h"
 #include "ITKVideoCoreExport.h"
@@ -102,6 +103,16 @@ public:
    * able to hold this as a constant. */
   itkGetMacro(UnitOutputNumberOfFrames, SizeValueType);
 
+  /** Set/Get the number of output units requested from the input pipeline in
+   * one batch during temporal streaming. With the default of 1, the input
+   * pipeline is re-negotiated and updated once per unit of output. Larger
+   * batches buffer the input frames for several units up front and amortize
+   * the per-unit pipeline overhead across them, at the cost of a latency of
+   * one batch of frames and an input buffer large enough to hold the span of
+   * the batch. The per-unit processing itself is unchanged. */
+  itkSetClampMacro(OutputBatchSize, SizeValueType, 1, NumericTraits<SizeValueType>::max());
+  itkGetMacro(OutputBatchSize, SizeValueType);
+
   /** The default implementation of UpdateOutputInformation to handle temporal
    * regions will compute the proper size of the output largest possible
    * temporal region based on the largest possible temporal region of the input,
@@ -241,6 +252,10 @@ protected:
    * internally (or provide access to it) if they wish. */
   OffsetValueType m_FrameSkipPerOutput{ 1 };
 
+  /** Number of output units to request from the input pipeline per batch
+   * during temporal streaming. */
+  SizeValueType m_OutputBatchSize{ 1 };
+
   /** Member to indicate the location of the "current frame" in the minimum set
    * of input frames. For example, if the unit number of input frames is 6 and
    * m_InputStencilCurrentFrameIndex = 4, this indicates that for output frame
@@ -19,6 +19,8 @@
 #include "itkTemporalProcessObject.h"
 #include "itkTemporalDataObject.h"
 
+#include <algorithm>
+
 
 namespace itk
 {
@@ -415,67 +417,98 @@ TemporalProcessObject::GenerateData()
   // Save the full requested and buffered output regions
   TemporalRegion fullOutputRequest = output->GetRequestedTemporalRegion();
 
-  // Process each of the temporal sub-regions in sequence
-  for (const auto & inputTemporalRegionRequest : this->SplitRequestedTemporalRegion())
+  // Process each of the temporal sub-regions in sequence. The sub-regions are
+  // grouped into batches of m_OutputBatchSize so that the input pipeline only
+  // has to be re-negotiated and updated once per batch; each sub-region is
+  // then processed against the already buffered input data exactly as it would
+  // be without batching.
+  const std::vector<TemporalRegion> inputTemporalRegionRequests = this->SplitRequestedTemporalRegion();
+  const SizeValueType               numRequests = inputTemporalRegionRequests.size();
+  for (SizeValueType batchStart = 0; batchStart < numRequests; batchStart += m_OutputBatchSize)
   {
-    // If we have an input, set the requested region and make sure its data is ready
+    const SizeValueType requestsInBatch = std::min(m_OutputBatchSize, numRequests - batchStart);
+
+    // If we have an input, request the union of this batch's input regions and
+    // make sure its data is ready
+    auto * input = dynamic_cast<TemporalDataObject *>(this->GetInput(0));
     if (this->GetNumberOfInputs())
     {
-      // Set Input's requested region to the new request at i
-      auto * input = dynamic_cast<TemporalDataObject *>(this->GetInput(0));
       if (input == nullptr)
       {
         itkExceptionMacro(<< "itk::TemporalProcessObject::GenerateData() "
                           << "cannot cast " << typeid(input).name() << " to " << typeid(TemporalDataObject *).name());
       }
-      input->SetRequestedTemporalRegion(inputTemporalRegionRequest);
+      TemporalRegion batchInputRequest = inputTemporalRegionRequests[batchStart];
+      for (SizeValueType i = 1; i < requestsInBatch; ++i)
+      {
+        const TemporalRegion & r = inputTemporalRegionRequests[batchStart + i];
+        const SizeValueType    unionStart = std::min(batchInputRequest.GetFrameStart(), r.GetFrameStart());
+        const SizeValueType    unionEnd =
+          std::max(batchInputRequest.GetFrameStart() + batchInputRequest.GetFrameDuration(),
+                   r.GetFrameStart() + r.GetFrameDuration());
+        batchInputRequest.SetFrameStart(unionStart);
+        batchInputRequest.SetFrameDuration(unionEnd - unionStart);
+      }
+      input->SetRequestedTemporalRegion(batchInputRequest);
 
       // Call Input's UpdateOutputData()
       input->UpdateOutputData();
     }
 
-    // Set the output's requested region to the region corresponding to this
-    // input request
-    TemporalRegion currentRequest;
-    currentRequest.SetFrameStart(outputStartFrame);
-    currentRequest.SetFrameDuration(m_UnitOutputNumberOfFrames);
-    output->SetRequestedTemporalRegion(currentRequest);
+    for (SizeValueType i = 0; i < requestsInBatch; ++i)
+    {
+      // Re-set the input's requested region to the single sub-region so that
+      // subclasses see the same unit-sized request as in the unbatched case.
+      // The corresponding data has already been buffered by the batch update
+      // above, so no new call to UpdateOutputData is needed.
+      if (input != nullptr && requestsInBatch > 1)
+      {
+        input->SetRequestedTemporalRegion(inputTemporalRegionRequests[batchStart + i]);
+      }
 
-    // Call TemporalStreamingGenerateData to process the chunk of data
-    this->TemporalStreamingGenerateData();
+      // Set the output's requested region to the region corresponding to this
+      // input request
+      TemporalRegion currentRequest;
+      currentRequest.SetFrameStart(outputStartFrame);
+      currentRequest.SetFrameDuration(m_UnitOutputNumberOfFrames);
+      output->SetRequestedTemporalRegion(currentRequest);
 
-    // Update the bufferd region information
-    TemporalRegion outputBufferedRegion = output->GetBufferedTemporalRegion();
-    SizeValueType  bufferedStart = outputBufferedRegion.GetFrameStart();
-    SizeValueType  bufferedDuration = outputBufferedRegion.GetFrameDuration();
+      // Call TemporalStreamingGenerateData to process the chunk of data
+      this->TemporalStreamingGenerateData();
 
-    // If there is nothing buffered, set the start as well as the duration
-    if (bufferedDuration == 0)
-    {
-      bufferedStart = outputStartFrame;
-    }
+      // Update the bufferd region information
+      TemporalRegion outputBufferedRegion = output->GetBufferedTemporalRegion();
+      SizeValueType  bufferedStart = outputBufferedRegion.GetFrameStart();
+      SizeValueType  bufferedDuration = outputBufferedRegion.GetFrameDuration();
 
-    OffsetValueType spareFrames = output->GetNumberOfBuffers() - (OffsetValueType)bufferedDuration;
-    if (spareFrames >= (OffsetValueType)m_UnitOutputNumberOfFrames)
-    {
-      bufferedDuration += m_UnitOutputNumberOfFrames;
-    }
-    else if (spareFrames > 0)
-    {
-      bufferedDuration += spareFrames;
-      bufferedStart += (m_UnitOutputNumberOfFrames - spareFrames);
-    }
-    else
-    {
-      bufferedStart += m_UnitOutputNumberOfFrames;
-    }
+      // If there is nothing buffered, set the start as well as the duration
+      if (bufferedDuration == 0)
+      {
+        bufferedStart = outputStartFrame;
+      }
+
+      OffsetValueType spareFrames = output->GetNumberOfBuffers() - (OffsetValueType)bufferedDuration;
+      if (spareFrames >= (OffsetValueType)m_UnitOutputNumberOfFrames)
+      {
+        bufferedDuration += m_UnitOutputNumberOfFrames;
+      }
+      else if (spareFrames > 0)
+      {
+        bufferedDuration += spareFrames;
+        bufferedStart += (m_UnitOutputNumberOfFrames - spareFrames);
+      }
+      else
+      {
+        bufferedStart += m_UnitOutputNumberOfFrames;
+      }
 
-    outputBufferedRegion.SetFrameStart(bufferedStart);
-    outputBufferedRegion.SetFrameDuration(bufferedDuration);
-    output->SetBufferedTemporalRegion(outputBufferedRegion);
+      outputBufferedRegion.SetFrameStart(bufferedStart);
+      outputBufferedRegion.SetFrameDuration(bufferedDuration);
+      output->SetBufferedTemporalRegion(outputBufferedRegion);
 
-    // Increment outputStartFrame
-    outputStartFrame += this->m_UnitOutputNumberOfFrames;
+      // Increment outputStartFrame
+      outputStartFrame += this->m_UnitOutputNumberOfFrames;
+    }
   }
 
   // Set the requested and buffered temporal regions to match the full request
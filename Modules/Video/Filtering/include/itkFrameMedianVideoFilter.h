@@ -0,0 +1,150 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkFrameMedianVideoFilter_h
+#define itkFrameMedianVideoFilter_h
+
+#include "itkVideoToVideoFilter.h"
+
+#include <deque>
+#include <vector>
+
+namespace itk
+{
+
+/**
+ *\class FrameMedianVideoFilter
+ * \brief Temporal median of a sliding frame window using per-pixel histograms
+ *
+ * This filter computes, for each pixel, the median over a window of frames.
+ * It processes one frame forward at a time and maintains a 256 bin histogram
+ * per pixel. When the output frames are requested in sequence each new frame
+ * only inserts the arriving value, removes the departing one and adjusts the
+ * median bin following the histogram, so the per-frame cost is O(pixels)
+ * instead of O(pixels x window). This makes the filter well suited for
+ * background estimation with long windows. The filter keeps its own copies
+ * of the frames currently in the window in order to remove the departing
+ * values from the histograms.
+ *
+ * The input pixel type must be an integer type with values in [0, 255];
+ * values outside that range are clamped into it. For windows of even length
+ * the upper median (the element at position window / 2 of the sorted window)
+ * is returned.
+ *
+ * \ingroup ITKVideoFiltering
+ */
+template <typename TInputVideoStream, typename TOutputVideoStream>
+class ITK_TEMPLATE_EXPORT FrameMedianVideoFilter : public VideoToVideoFilter<TInputVideoStream, TOutputVideoStream>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(FrameMedianVideoFilter);
+
+  /** Standard class type aliases */
+  using InputVideoStreamType = TInputVideoStream;
+  using OutputVideoStreamType = TOutputVideoStream;
+  using Self = FrameMedianVideoFilter<InputVideoStreamType, OutputVideoStreamType>;
+  using Superclass = VideoToVideoFilter<InputVideoStreamType, OutputVideoStreamType>;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+  using ConstWeakPointer = WeakPointer<const Self>;
+
+  using InputFrameType = typename TInputVideoStream::FrameType;
+  using InputPixelType = typename InputFrameType::PixelType;
+  using InputFrameSpatialRegionType = typename InputFrameType::RegionType;
+  using OutputFrameType = typename TOutputVideoStream::FrameType;
+  using OutputPixelType = typename OutputFrameType::PixelType;
+  using OutputFrameSpatialRegionType = typename OutputFrameType::RegionType;
+
+  itkNewMacro(Self);
+
+  itkTypeMacro(FrameMedianVideoFilter, VideoToVideoFilter);
+
+  /** Get/Set the number of frames to take the median over */
+  void
+  SetNumberOfFrames(SizeValueType numFrames);
+  SizeValueType
+  GetNumberOfFrames();
+
+#ifdef ITK_USE_CONCEPT_CHECKING
+  // Begin concept checking
+  itkConceptMacro(InputIsIntegerCheck, (Concept::IsInteger<InputPixelType>));
+  // End concept checking
+#endif
+
+protected:
+  /** Constructor and Destructor */
+  FrameMedianVideoFilter();
+  ~FrameMedianVideoFilter() override = default;
+
+  /** PrintSelf */
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+  /** Decide between the incremental update and a full rebuild of the
+   * histograms and prepare the window buffers accordingly. Runs single
+   * threaded before the spatial threads of each output frame. */
+  void
+  BeforeThreadedGenerateData() override;
+
+  /** FrameMedianVideoFilter is implemented as a temporal streaming and
+   * spatially multithreaded filter, so we override ThreadedGenerateData */
+  void
+  ThreadedGenerateData(const OutputFrameSpatialRegionType & outputRegionForThread, int threadId) override;
+
+private:
+  /** Number of histogram bins, one per possible 8 bit pixel value */
+  static constexpr unsigned int NumberOfBins = 256;
+
+  /** Map a pixel value to its histogram bin, clamping into [0, 255] */
+  static unsigned int
+  GetBin(InputPixelType value)
+  {
+    if (NumericTraits<InputPixelType>::IsNegative(value))
+    {
+      return 0;
+    }
+    const auto bin = static_cast<SizeValueType>(value);
+    return (bin < NumberOfBins) ? static_cast<unsigned int>(bin) : NumberOfBins - 1;
+  }
+
+  /** Per-pixel histograms of the values currently in the window, stored
+   * contiguously as NumberOfBins counters per pixel */
+  std::vector<unsigned short> m_Histograms;
+
+  /** Per-pixel current median bin and number of window values in the bins
+   * below it, used to adjust the median incrementally */
+  std::vector<unsigned short> m_MedianBins;
+  std::vector<unsigned short> m_CountsBelowMedian;
+
+  /** Copies of the binned frames currently in the window, oldest first, used
+   * to remove the departing frame from the histograms */
+  std::deque<std::vector<unsigned char>> m_WindowBuffers;
+
+  /** Bookkeeping used to detect whether the incremental update can be used */
+  SizeValueType                m_LastOutputFrameNumber;
+  bool                         m_StateValid;
+  bool                         m_UseIncrementalUpdate;
+  OutputFrameSpatialRegionType m_StateSpatialRegion;
+}; // end class FrameMedianVideoFilter
+
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkFrameMedianVideoFilter.hxx"
+#endif
+
+#endif
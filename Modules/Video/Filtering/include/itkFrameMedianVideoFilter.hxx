@@ -0,0 +1,290 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkFrameMedianVideoFilter_hxx
+#define itkFrameMedianVideoFilter_hxx
+
+#include "itkFrameMedianVideoFilter.h"
+
+#include "itkImageScanlineConstIterator.h"
+#include "itkImageScanlineIterator.h"
+#include "itkNumericTraits.h"
+
+namespace itk
+{
+
+//
+// Constructor
+//
+template <typename TInputVideoStream, typename TOutputVideoStream>
+FrameMedianVideoFilter<TInputVideoStream, TOutputVideoStream>::FrameMedianVideoFilter()
+{
+  // Default to the median over 3 frames
+  this->TemporalProcessObject::m_UnitInputNumberOfFrames = 3;
+
+  // Always output a single frame
+  this->TemporalProcessObject::m_UnitOutputNumberOfFrames = 1;
+
+  // The output frame gets the number of the first frame in the set
+  this->TemporalProcessObject::m_InputStencilCurrentFrameIndex = 0;
+
+  // Move forward one frame of input for every frame of output
+  this->TemporalProcessObject::m_FrameSkipPerOutput = 1;
+
+  m_LastOutputFrameNumber = 0;
+  m_StateValid = false;
+  m_UseIncrementalUpdate = false;
+}
+
+
+//
+// PrintSelf
+//
+template <typename TInputVideoStream, typename TOutputVideoStream>
+void
+FrameMedianVideoFilter<TInputVideoStream, TOutputVideoStream>::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfFrames: " << this->TemporalProcessObject::m_UnitInputNumberOfFrames << std::endl;
+}
+
+
+//
+// SetNumberOfFrames
+//
+template <typename TInputVideoStream, typename TOutputVideoStream>
+void
+FrameMedianVideoFilter<TInputVideoStream, TOutputVideoStream>::SetNumberOfFrames(SizeValueType numFrames)
+{
+  this->TemporalProcessObject::m_UnitInputNumberOfFrames = numFrames;
+  m_StateValid = false;
+  this->Modified();
+}
+
+
+//
+// GetNumberOfFrames
+//
+template <typename TInputVideoStream, typename TOutputVideoStream>
+SizeValueType
+FrameMedianVideoFilter<TInputVideoStream, TOutputVideoStream>::GetNumberOfFrames()
+{
+  return this->TemporalProcessObject::m_UnitInputNumberOfFrames;
+}
+
+
+//
+// BeforeThreadedGenerateData
+//
+template <typename TInputVideoStream, typename TOutputVideoStream>
+void
+FrameMedianVideoFilter<TInputVideoStream, TOutputVideoStream>::BeforeThreadedGenerateData()
+{
+  const InputVideoStreamType * input = this->GetInput();
+  OutputVideoStreamType *      output = this->GetOutput();
+  SizeValueType                numFrames = this->TemporalProcessObject::m_UnitInputNumberOfFrames;
+
+  SizeValueType outputFrameNumber = output->GetRequestedTemporalRegion().GetFrameStart();
+  SizeValueType inputStart = input->GetRequestedTemporalRegion().GetFrameStart();
+
+  const OutputFrameSpatialRegionType spatialRegion = output->GetFrame(outputFrameNumber)->GetRequestedRegion();
+  const SizeValueType numPixels = input->GetFrame(inputStart)->GetBufferedRegion().GetNumberOfPixels();
+
+  // The incremental update needs the state left by the previous frame: the
+  // same window length and spatial region, and an output frame number one
+  // past the last one processed
+  m_UseIncrementalUpdate = m_StateValid && outputFrameNumber == m_LastOutputFrameNumber + 1 &&
+                           spatialRegion == m_StateSpatialRegion && m_WindowBuffers.size() == numFrames &&
+                           m_MedianBins.size() == numPixels;
+
+  if (m_UseIncrementalUpdate)
+  {
+    // Rotate the oldest window buffer to the back. It still holds the values
+    // of the departing frame; the threads remove them from the histograms
+    // and overwrite them with the arriving frame
+    m_WindowBuffers.push_back(std::move(m_WindowBuffers.front()));
+    m_WindowBuffers.pop_front();
+  }
+  else
+  {
+    // Size the state for a full rebuild by the threads
+    m_Histograms.resize(numPixels * NumberOfBins);
+    m_MedianBins.resize(numPixels);
+    m_CountsBelowMedian.resize(numPixels);
+    m_WindowBuffers.resize(numFrames);
+    for (SizeValueType i = 0; i < numFrames; ++i)
+    {
+      m_WindowBuffers[i].resize(numPixels);
+    }
+  }
+
+  m_LastOutputFrameNumber = outputFrameNumber;
+  m_StateSpatialRegion = spatialRegion;
+  m_StateValid = true;
+}
+
+
+//
+// ThreadedGenerateData
+//
+template <typename TInputVideoStream, typename TOutputVideoStream>
+void
+FrameMedianVideoFilter<TInputVideoStream, TOutputVideoStream>::ThreadedGenerateData(
+  const OutputFrameSpatialRegionType & outputRegionForThread,
+  int                                  itkNotUsed(threadId))
+{
+  // Get the input and output video streams
+  const InputVideoStreamType * input = this->GetInput();
+  OutputVideoStreamType *      output = this->GetOutput();
+  SizeValueType                numFrames = this->TemporalProcessObject::m_UnitInputNumberOfFrames;
+
+  // Get output frame number
+  typename OutputVideoStreamType::TemporalRegionType outReqTempRegion = output->GetRequestedTemporalRegion();
+  SizeValueType                                      outputFrameNumber = outReqTempRegion.GetFrameStart();
+
+  typename InputVideoStreamType::TemporalRegionType inReqTempRegion = input->GetRequestedTemporalRegion();
+  SizeValueType                                     inputStart = inReqTempRegion.GetFrameStart();
+  SizeValueType                                     inputDuration = inReqTempRegion.GetFrameDuration();
+
+  // Make sure we've got the right duration
+  if (inputDuration != numFrames)
+  {
+    itkExceptionMacro("Incorrect number of input frames");
+  }
+
+  // Position of the median in the sorted window (upper median for windows of
+  // even length)
+  const unsigned int medianPosition = static_cast<unsigned int>(numFrames / 2);
+
+  // Get the output frame and its iterator
+  OutputFrameType *                      outFrame = output->GetFrame(outputFrameNumber);
+  ImageScanlineIterator<OutputFrameType> outIter(outFrame, outputRegionForThread);
+
+  if (!m_UseIncrementalUpdate)
+  {
+    // Rebuild the histograms and the window copies from all frames of the
+    // window
+    for (SizeValueType i = 0; i < numFrames; ++i)
+    {
+      const InputFrameType *                     frame = input->GetFrame(inputStart + i);
+      ImageScanlineConstIterator<InputFrameType> frameIter(frame, outputRegionForThread);
+      std::vector<unsigned char> &               windowBuffer = m_WindowBuffers[i];
+
+      while (!frameIter.IsAtEnd())
+      {
+        OffsetValueType offset = frame->ComputeOffset(frameIter.GetIndex());
+        while (!frameIter.IsAtEndOfLine())
+        {
+          const unsigned int bin = Self::GetBin(frameIter.Get());
+          unsigned short *   histogram = &m_Histograms[offset * NumberOfBins];
+          if (i == 0)
+          {
+            std::fill(histogram, histogram + NumberOfBins, static_cast<unsigned short>(0));
+          }
+          ++histogram[bin];
+          windowBuffer[offset] = static_cast<unsigned char>(bin);
+          ++offset;
+          ++frameIter;
+        }
+        frameIter.NextLine();
+      }
+    }
+
+    // Find the median bin of each histogram and record the number of values
+    // below it for the incremental updates
+    const InputFrameType * firstFrame = input->GetFrame(inputStart);
+    while (!outIter.IsAtEnd())
+    {
+      OffsetValueType offset = firstFrame->ComputeOffset(outIter.GetIndex());
+      while (!outIter.IsAtEndOfLine())
+      {
+        const unsigned short * histogram = &m_Histograms[offset * NumberOfBins];
+        unsigned int           medianBin = 0;
+        unsigned int           countBelow = 0;
+        while (countBelow + histogram[medianBin] <= medianPosition)
+        {
+          countBelow += histogram[medianBin];
+          ++medianBin;
+        }
+        m_MedianBins[offset] = static_cast<unsigned short>(medianBin);
+        m_CountsBelowMedian[offset] = static_cast<unsigned short>(countBelow);
+        outIter.Set((OutputPixelType)medianBin);
+        ++offset;
+        ++outIter;
+      }
+      outIter.NextLine();
+    }
+  }
+  else
+  {
+    // Remove the departing value, insert the arriving one and walk the
+    // median bin to its new position following the histogram
+    const InputFrameType * arrivingFrame = input->GetFrame(inputStart + numFrames - 1);
+
+    ImageScanlineConstIterator<InputFrameType> arrivingIter(arrivingFrame, outputRegionForThread);
+    std::vector<unsigned char> &               windowBuffer = m_WindowBuffers.back();
+
+    while (!outIter.IsAtEnd())
+    {
+      OffsetValueType offset = arrivingFrame->ComputeOffset(arrivingIter.GetIndex());
+      while (!outIter.IsAtEndOfLine())
+      {
+        unsigned short *   histogram = &m_Histograms[offset * NumberOfBins];
+        const unsigned int departingBin = windowBuffer[offset];
+        const unsigned int arrivingBin = Self::GetBin(arrivingIter.Get());
+        unsigned int       medianBin = m_MedianBins[offset];
+        unsigned int       countBelow = m_CountsBelowMedian[offset];
+
+        --histogram[departingBin];
+        if (departingBin < medianBin)
+        {
+          --countBelow;
+        }
+        ++histogram[arrivingBin];
+        if (arrivingBin < medianBin)
+        {
+          ++countBelow;
+        }
+
+        while (countBelow > medianPosition)
+        {
+          --medianBin;
+          countBelow -= histogram[medianBin];
+        }
+        while (countBelow + histogram[medianBin] <= medianPosition)
+        {
+          countBelow += histogram[medianBin];
+          ++medianBin;
+        }
+
+        m_MedianBins[offset] = static_cast<unsigned short>(medianBin);
+        m_CountsBelowMedian[offset] = static_cast<unsigned short>(countBelow);
+        windowBuffer[offset] = static_cast<unsigned char>(arrivingBin);
+        outIter.Set((OutputPixelType)medianBin);
+        ++offset;
+        ++arrivingIter;
+        ++outIter;
+      }
+      arrivingIter.NextLine();
+      outIter.NextLine();
+    }
+  }
+}
+
+} // end namespace itk
+
+#endif
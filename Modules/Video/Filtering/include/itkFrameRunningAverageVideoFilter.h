@@ -0,0 +1,123 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkFrameRunningAverageVideoFilter_h
+#define itkFrameRunningAverageVideoFilter_h
+
+#include "itkVideoToVideoFilter.h"
+
+#include <deque>
+#include <vector>
+
+namespace itk
+{
+
+/**
+ *\class FrameRunningAverageVideoFilter
+ * \brief Average frames over a sliding window using an incremental running sum
+ *
+ * This filter computes the same output as FrameAverageVideoFilter but keeps a
+ * per-pixel running sum over the frame window. When the output frames are
+ * requested in sequence, each new frame only adds the arriving frame to the
+ * sum and subtracts the departing one, so the per-frame cost is O(pixels)
+ * instead of O(pixels x window). The filter keeps its own copies of the
+ * frames currently in the window in order to subtract the departing values.
+ *
+ * When frames are requested out of sequence, or the requested spatial region
+ * or the window length changes, the running sum is rebuilt from all frames of
+ * the window. Because the sum is updated incrementally, floating point
+ * rounding can make the output differ from FrameAverageVideoFilter in the
+ * last bits for non-integer pixel data.
+ *
+ * \ingroup ITKVideoFiltering
+ */
+template <typename TInputVideoStream, typename TOutputVideoStream>
+class ITK_TEMPLATE_EXPORT FrameRunningAverageVideoFilter
+  : public VideoToVideoFilter<TInputVideoStream, TOutputVideoStream>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(FrameRunningAverageVideoFilter);
+
+  /** Standard class type aliases */
+  using InputVideoStreamType = TInputVideoStream;
+  using OutputVideoStreamType = TOutputVideoStream;
+  using Self = FrameRunningAverageVideoFilter<InputVideoStreamType, OutputVideoStreamType>;
+  using Superclass = VideoToVideoFilter<InputVideoStreamType, OutputVideoStreamType>;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+  using ConstWeakPointer = WeakPointer<const Self>;
+
+  using InputFrameType = typename TInputVideoStream::FrameType;
+  using InputPixelType = typename InputFrameType::PixelType;
+  using InputPixelRealType = typename NumericTraits<InputPixelType>::RealType;
+  using InputFrameSpatialRegionType = typename InputFrameType::RegionType;
+  using OutputFrameType = typename TOutputVideoStream::FrameType;
+  using OutputPixelType = typename OutputFrameType::PixelType;
+  using OutputFrameSpatialRegionType = typename OutputFrameType::RegionType;
+
+  itkNewMacro(Self);
+
+  itkTypeMacro(FrameRunningAverageVideoFilter, VideoToVideoFilter);
+
+  /** Get/Set the number of frames to average over */
+  void
+  SetNumberOfFrames(SizeValueType numFrames);
+  SizeValueType
+  GetNumberOfFrames();
+
+protected:
+  /** Constructor and Destructor */
+  FrameRunningAverageVideoFilter();
+  ~FrameRunningAverageVideoFilter() override = default;
+
+  /** PrintSelf */
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+  /** Decide between the incremental update and a full rebuild of the running
+   * sum and prepare the window buffers accordingly. Runs single threaded
+   * before the spatial threads of each output frame. */
+  void
+  BeforeThreadedGenerateData() override;
+
+  /** FrameRunningAverageVideoFilter is implemented as a temporal streaming and
+   * spatially multithreaded filter, so we override ThreadedGenerateData */
+  void
+  ThreadedGenerateData(const OutputFrameSpatialRegionType & outputRegionForThread, int threadId) override;
+
+private:
+  /** Per-pixel running sum over the frames currently in the window */
+  std::vector<InputPixelRealType> m_RunningSum;
+
+  /** Copies of the frames currently in the window, oldest first, used to
+   * subtract the departing frame from the running sum */
+  std::deque<std::vector<InputPixelType>> m_WindowBuffers;
+
+  /** Bookkeeping used to detect whether the incremental update can be used */
+  SizeValueType                m_LastOutputFrameNumber;
+  bool                         m_StateValid;
+  bool                         m_UseIncrementalUpdate;
+  OutputFrameSpatialRegionType m_StateSpatialRegion;
+}; // end class FrameRunningAverageVideoFilter
+
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkFrameRunningAverageVideoFilter.hxx"
+#endif
+
+#endif
@@ -0,0 +1,250 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkFrameRunningAverageVideoFilter_hxx
+#define itkFrameRunningAverageVideoFilter_hxx
+
+#include "itkFrameRunningAverageVideoFilter.h"
+
+#include "itkImageScanlineConstIterator.h"
+#include "itkImageScanlineIterator.h"
+#include "itkNumericTraits.h"
+
+namespace itk
+{
+
+//
+// Constructor
+//
+template <typename TInputVideoStream, typename TOutputVideoStream>
+FrameRunningAverageVideoFilter<TInputVideoStream, TOutputVideoStream>::FrameRunningAverageVideoFilter()
+{
+  // Default to average over 2 frames
+  this->TemporalProcessObject::m_UnitInputNumberOfFrames = 2;
+
+  // Always output a single frame
+  this->TemporalProcessObject::m_UnitOutputNumberOfFrames = 1;
+
+  // The output frame gets the number of the first frame in the set
+  this->TemporalProcessObject::m_InputStencilCurrentFrameIndex = 0;
+
+  // Move forward one frame of input for every frame of output
+  this->TemporalProcessObject::m_FrameSkipPerOutput = 1;
+
+  m_LastOutputFrameNumber = 0;
+  m_StateValid = false;
+  m_UseIncrementalUpdate = false;
+}
+
+
+//
+// PrintSelf
+//
+template <typename TInputVideoStream, typename TOutputVideoStream>
+void
+FrameRunningAverageVideoFilter<TInputVideoStream, TOutputVideoStream>::PrintSelf(std::ostream & os,
+                                                                                 Indent         indent) const
+{
+  Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfFrames: " << this->TemporalProcessObject::m_UnitInputNumberOfFrames << std::endl;
+}
+
+
+//
+// SetNumberOfFrames
+//
+template <typename TInputVideoStream, typename TOutputVideoStream>
+void
+FrameRunningAverageVideoFilter<TInputVideoStream, TOutputVideoStream>::SetNumberOfFrames(SizeValueType numFrames)
+{
+  this->TemporalProcessObject::m_UnitInputNumberOfFrames = numFrames;
+  m_StateValid = false;
+  this->Modified();
+}
+
+
+//
+// GetNumberOfFrames
+//
+template <typename TInputVideoStream, typename TOutputVideoStream>
+SizeValueType
+FrameRunningAverageVideoFilter<TInputVideoStream, TOutputVideoStream>::GetNumberOfFrames()
+{
+  return this->TemporalProcessObject::m_UnitInputNumberOfFrames;
+}
+
+
+//
+// BeforeThreadedGenerateData
+//
+template <typename TInputVideoStream, typename TOutputVideoStream>
+void
+FrameRunningAverageVideoFilter<TInputVideoStream, TOutputVideoStream>::BeforeThreadedGenerateData()
+{
+  const InputVideoStreamType * input = this->GetInput();
+  OutputVideoStreamType *      output = this->GetOutput();
+  SizeValueType                numFrames = this->TemporalProcessObject::m_UnitInputNumberOfFrames;
+
+  SizeValueType outputFrameNumber = output->GetRequestedTemporalRegion().GetFrameStart();
+  SizeValueType inputStart = input->GetRequestedTemporalRegion().GetFrameStart();
+
+  const OutputFrameSpatialRegionType spatialRegion = output->GetFrame(outputFrameNumber)->GetRequestedRegion();
+  const SizeValueType numPixels = input->GetFrame(inputStart)->GetBufferedRegion().GetNumberOfPixels();
+
+  // The incremental update needs the state left by the previous frame: the
+  // same window length and spatial region, and an output frame number one
+  // past the last one processed
+  m_UseIncrementalUpdate = m_StateValid && outputFrameNumber == m_LastOutputFrameNumber + 1 &&
+                           spatialRegion == m_StateSpatialRegion && m_WindowBuffers.size() == numFrames &&
+                           m_RunningSum.size() == numPixels;
+
+  if (m_UseIncrementalUpdate)
+  {
+    // Rotate the oldest window buffer to the back. It still holds the values
+    // of the departing frame; the threads subtract them from the running sum
+    // and overwrite them with the arriving frame
+    m_WindowBuffers.push_back(std::move(m_WindowBuffers.front()));
+    m_WindowBuffers.pop_front();
+  }
+  else
+  {
+    // Size the state for a full rebuild by the threads
+    m_RunningSum.resize(numPixels);
+    m_WindowBuffers.resize(numFrames);
+    for (SizeValueType i = 0; i < numFrames; ++i)
+    {
+      m_WindowBuffers[i].resize(numPixels);
+    }
+  }
+
+  m_LastOutputFrameNumber = outputFrameNumber;
+  m_StateSpatialRegion = spatialRegion;
+  m_StateValid = true;
+}
+
+
+//
+// ThreadedGenerateData
+//
+template <typename TInputVideoStream, typename TOutputVideoStream>
+void
+FrameRunningAverageVideoFilter<TInputVideoStream, TOutputVideoStream>::ThreadedGenerateData(
+  const OutputFrameSpatialRegionType & outputRegionForThread,
+  int                                  itkNotUsed(threadId))
+{
+  // Get the input and output video streams
+  const InputVideoStreamType * input = this->GetInput();
+  OutputVideoStreamType *      output = this->GetOutput();
+  SizeValueType                numFrames = this->TemporalProcessObject::m_UnitInputNumberOfFrames;
+
+  // Get output frame number
+  typename OutputVideoStreamType::TemporalRegionType outReqTempRegion = output->GetRequestedTemporalRegion();
+  SizeValueType                                      outputFrameNumber = outReqTempRegion.GetFrameStart();
+
+  typename InputVideoStreamType::TemporalRegionType inReqTempRegion = input->GetRequestedTemporalRegion();
+  SizeValueType                                     inputStart = inReqTempRegion.GetFrameStart();
+  SizeValueType                                     inputDuration = inReqTempRegion.GetFrameDuration();
+
+  // Make sure we've got the right duration
+  if (inputDuration != numFrames)
+  {
+    itkExceptionMacro("Incorrect number of input frames");
+  }
+
+  // Get the output frame and its iterator
+  OutputFrameType *                      outFrame = output->GetFrame(outputFrameNumber);
+  ImageScanlineIterator<OutputFrameType> outIter(outFrame, outputRegionForThread);
+
+  if (m_UseIncrementalUpdate)
+  {
+    // Subtract the departing frame from the running sum, add the arriving
+    // one and store its values for its own departure later
+    const InputFrameType * arrivingFrame = input->GetFrame(inputStart + numFrames - 1);
+
+    ImageScanlineConstIterator<InputFrameType> arrivingIter(arrivingFrame, outputRegionForThread);
+    std::vector<InputPixelType> &              windowBuffer = m_WindowBuffers.back();
+
+    while (!outIter.IsAtEnd())
+    {
+      OffsetValueType offset = arrivingFrame->ComputeOffset(arrivingIter.GetIndex());
+      while (!outIter.IsAtEndOfLine())
+      {
+        const InputPixelType arriving = arrivingIter.Get();
+        InputPixelRealType   sum = m_RunningSum[offset];
+        sum -= (InputPixelRealType)windowBuffer[offset];
+        sum += (InputPixelRealType)arriving;
+        m_RunningSum[offset] = sum;
+        windowBuffer[offset] = arriving;
+        outIter.Set((OutputPixelType)(sum / (InputPixelRealType)numFrames));
+        ++offset;
+        ++arrivingIter;
+        ++outIter;
+      }
+      arrivingIter.NextLine();
+      outIter.NextLine();
+    }
+  }
+  else
+  {
+    // Rebuild the running sum and the window copies from all frames of the
+    // window
+    for (SizeValueType i = 0; i < numFrames; ++i)
+    {
+      const InputFrameType *                     frame = input->GetFrame(inputStart + i);
+      ImageScanlineConstIterator<InputFrameType> frameIter(frame, outputRegionForThread);
+      std::vector<InputPixelType> &              windowBuffer = m_WindowBuffers[i];
+
+      while (!frameIter.IsAtEnd())
+      {
+        OffsetValueType offset = frame->ComputeOffset(frameIter.GetIndex());
+        while (!frameIter.IsAtEndOfLine())
+        {
+          const InputPixelType value = frameIter.Get();
+          windowBuffer[offset] = value;
+          if (i == 0)
+          {
+            m_RunningSum[offset] = (InputPixelRealType)value;
+          }
+          else
+          {
+            m_RunningSum[offset] += (InputPixelRealType)value;
+          }
+          ++offset;
+          ++frameIter;
+        }
+        frameIter.NextLine();
+      }
+    }
+
+    const InputFrameType * firstFrame = input->GetFrame(inputStart);
+    while (!outIter.IsAtEnd())
+    {
+      OffsetValueType offset = firstFrame->ComputeOffset(outIter.GetIndex());
+      while (!outIter.IsAtEndOfLine())
+      {
+        outIter.Set((OutputPixelType)(m_RunningSum[offset] / (InputPixelRealType)numFrames));
+        ++offset;
+        ++outIter;
+      }
+      outIter.NextLine();
+    }
+  }
+}
+
+} // end namespace itk
+
+#endif
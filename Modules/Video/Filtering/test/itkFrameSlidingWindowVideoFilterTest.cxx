@@ -0,0 +1,238 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+#include "itkFrameRunningAverageVideoFilter.h"
+#include "itkFrameMedianVideoFilter.h"
+#include "itkMath.h"
+#include "itkTestingMacros.h"
+
+
+// Set up type alias for test
+constexpr unsigned int Dimension = 2;
+using InputPixelType = unsigned char;
+using InputFrameType = itk::Image<InputPixelType, Dimension>;
+using InputVideoType = itk::VideoStream<InputFrameType>;
+using OutputPixelType = double;
+using OutputFrameType = itk::Image<OutputPixelType, Dimension>;
+using OutputVideoType = itk::VideoStream<OutputFrameType>;
+using SizeValueType = itk::SizeValueType;
+
+
+/**
+ * Helper functions
+ */
+namespace itk
+{
+namespace FrameSlidingWindowVideoFilterTest
+{
+
+/**
+ * The value of frame frameNumber at the given index. The values vary in both
+ * space and time so that the per-pixel state of the filters is exercised.
+ */
+InputPixelType
+FrameValue(SizeValueType frameNumber, const InputFrameType::IndexType & idx)
+{
+  return static_cast<InputPixelType>((7 * frameNumber + 3 * idx[0] + 5 * idx[1] + frameNumber * idx[0]) % 256);
+}
+
+/**
+ * Create a new frame filled with the test pattern
+ */
+InputFrameType::Pointer
+CreateInputFrame(SizeValueType frameNumber)
+{
+  auto out = InputFrameType::New();
+
+  InputFrameType::RegionType largestRegion;
+  InputFrameType::SizeType   sizeLR;
+  InputFrameType::IndexType  startLR;
+  startLR.Fill(0);
+  sizeLR[0] = 24;
+  sizeLR[1] = 16;
+  largestRegion.SetSize(sizeLR);
+  largestRegion.SetIndex(startLR);
+  out->SetRegions(largestRegion);
+
+  out->Allocate();
+
+  itk::ImageRegionIteratorWithIndex<InputFrameType> iter(out, largestRegion);
+  while (!iter.IsAtEnd())
+  {
+    iter.Set(FrameValue(frameNumber, iter.GetIndex()));
+    ++iter;
+  }
+
+  return out;
+}
+
+/**
+ * Set up an input VideoStream filled with the test pattern
+ */
+InputVideoType::Pointer
+CreateInputVideo(SizeValueType numFrames)
+{
+  auto inputVideo = InputVideoType::New();
+  inputVideo->SetNumberOfBuffers(numFrames);
+  itk::TemporalRegion inputTempRegion;
+  inputTempRegion.SetFrameStart(0);
+  inputTempRegion.SetFrameDuration(numFrames);
+  inputVideo->SetLargestPossibleTemporalRegion(inputTempRegion);
+  inputVideo->SetRequestedTemporalRegion(inputTempRegion);
+  inputVideo->SetBufferedTemporalRegion(inputTempRegion);
+  for (SizeValueType i = 0; i < numFrames; ++i)
+  {
+    inputVideo->SetFrame(i, CreateInputFrame(i));
+  }
+  return inputVideo;
+}
+
+} // end namespace FrameSlidingWindowVideoFilterTest
+} // end namespace itk
+
+
+/**
+ * Main test
+ */
+int
+itkFrameSlidingWindowVideoFilterTest(int, char *[])
+{
+  const SizeValueType numInputFrames = 20;
+  const SizeValueType windowSize = 5;
+
+  InputVideoType::Pointer inputVideo = itk::FrameSlidingWindowVideoFilterTest::CreateInputVideo(numInputFrames);
+
+  const InputFrameType::RegionType frameRegion = inputVideo->GetFrame(0)->GetLargestPossibleRegion();
+  const SizeValueType              numOutputFrames = numInputFrames - windowSize + 1;
+
+  //////
+  // Test FrameRunningAverageVideoFilter against the brute force average
+  //////
+  {
+    using FilterType = itk::FrameRunningAverageVideoFilter<InputVideoType, OutputVideoType>;
+    auto filter = FilterType::New();
+    filter->SetInput(inputVideo);
+    filter->SetNumberOfFrames(windowSize);
+    ITK_TEST_SET_GET_VALUE(windowSize, filter->GetNumberOfFrames());
+
+    ITK_TRY_EXPECT_NO_EXCEPTION(filter->Update());
+
+    for (SizeValueType i = 0; i < numOutputFrames; ++i)
+    {
+      itk::ImageRegionConstIteratorWithIndex<OutputFrameType> outIter(filter->GetOutput()->GetFrame(i), frameRegion);
+      while (!outIter.IsAtEnd())
+      {
+        double expectedVal = 0;
+        for (SizeValueType j = 0; j < windowSize; ++j)
+        {
+          expectedVal += itk::FrameSlidingWindowVideoFilterTest::FrameValue(i + j, outIter.GetIndex());
+        }
+        expectedVal /= static_cast<double>(windowSize);
+
+        constexpr double eps = 0.00001;
+        if (itk::Math::abs(outIter.Get() - expectedVal) > eps)
+        {
+          std::cerr << "FrameRunningAverageVideoFilter failed at frame " << i << " index " << outIter.GetIndex()
+                    << std::endl;
+          std::cerr << "Expected Pixel Val: " << expectedVal << std::endl;
+          std::cerr << "Actual Pixel Val: " << outIter.Get() << std::endl;
+          return EXIT_FAILURE;
+        }
+        ++outIter;
+      }
+    }
+  }
+
+  //////
+  // Test FrameMedianVideoFilter against the brute force median
+  //////
+  {
+    using FilterType = itk::FrameMedianVideoFilter<InputVideoType, OutputVideoType>;
+    auto filter = FilterType::New();
+    filter->SetInput(inputVideo);
+    filter->SetNumberOfFrames(windowSize);
+    ITK_TEST_SET_GET_VALUE(windowSize, filter->GetNumberOfFrames());
+
+    ITK_TRY_EXPECT_NO_EXCEPTION(filter->Update());
+
+    for (SizeValueType i = 0; i < numOutputFrames; ++i)
+    {
+      itk::ImageRegionConstIteratorWithIndex<OutputFrameType> outIter(filter->GetOutput()->GetFrame(i), frameRegion);
+      while (!outIter.IsAtEnd())
+      {
+        std::vector<InputPixelType> window;
+        for (SizeValueType j = 0; j < windowSize; ++j)
+        {
+          window.push_back(itk::FrameSlidingWindowVideoFilterTest::FrameValue(i + j, outIter.GetIndex()));
+        }
+        std::nth_element(window.begin(), window.begin() + windowSize / 2, window.end());
+        const auto expectedVal = static_cast<OutputPixelType>(window[windowSize / 2]);
+
+        if (itk::Math::NotExactlyEquals(outIter.Get(), expectedVal))
+        {
+          std::cerr << "FrameMedianVideoFilter failed at frame " << i << " index " << outIter.GetIndex() << std::endl;
+          std::cerr << "Expected Pixel Val: " << expectedVal << std::endl;
+          std::cerr << "Actual Pixel Val: " << outIter.Get() << std::endl;
+          return EXIT_FAILURE;
+        }
+        ++outIter;
+      }
+    }
+  }
+
+  //////
+  // Test that changing the window length invalidates the incremental state
+  //////
+  {
+    using FilterType = itk::FrameMedianVideoFilter<InputVideoType, OutputVideoType>;
+    auto filter = FilterType::New();
+    filter->SetInput(inputVideo);
+    filter->SetNumberOfFrames(windowSize);
+    ITK_TRY_EXPECT_NO_EXCEPTION(filter->Update());
+
+    filter->SetNumberOfFrames(3);
+    ITK_TRY_EXPECT_NO_EXCEPTION(filter->Update());
+
+    itk::ImageRegionConstIteratorWithIndex<OutputFrameType> outIter(filter->GetOutput()->GetFrame(0), frameRegion);
+    while (!outIter.IsAtEnd())
+    {
+      std::vector<InputPixelType> window;
+      for (SizeValueType j = 0; j < 3; ++j)
+      {
+        window.push_back(itk::FrameSlidingWindowVideoFilterTest::FrameValue(j, outIter.GetIndex()));
+      }
+      std::nth_element(window.begin(), window.begin() + 1, window.end());
+      const auto expectedVal = static_cast<OutputPixelType>(window[1]);
+
+      if (itk::Math::NotExactlyEquals(outIter.Get(), expectedVal))
+      {
+        std::cerr << "FrameMedianVideoFilter failed after window length change at index " << outIter.GetIndex()
+                  << std::endl;
+        std::cerr << "Expected Pixel Val: " << expectedVal << std::endl;
+        std::cerr << "Actual Pixel Val: " << outIter.Get() << std::endl;
+        return EXIT_FAILURE;
+      }
+      ++outIter;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,160 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include <iostream>
+#include "itkFrameAverageVideoFilter.h"
+#include "itkTestingMacros.h"
+
+
+// Set up type alias for test
+constexpr unsigned int Dimension = 2;
+using InputPixelType = unsigned char;
+using InputFrameType = itk::Image<InputPixelType, Dimension>;
+using InputVideoType = itk::VideoStream<InputFrameType>;
+using OutputPixelType = double;
+using OutputFrameType = itk::Image<OutputPixelType, Dimension>;
+using OutputVideoType = itk::VideoStream<OutputFrameType>;
+using SizeValueType = itk::SizeValueType;
+
+
+/**
+ * Helper function
+ */
+namespace itk
+{
+namespace VideoFilterOutputBatchSizeTest
+{
+
+/**
+ * Create a new frame and fill it with the indicated value
+ */
+InputFrameType::Pointer
+CreateInputFrame(InputPixelType val)
+{
+  auto out = InputFrameType::New();
+
+  InputFrameType::RegionType largestRegion;
+  InputFrameType::SizeType   sizeLR;
+  InputFrameType::IndexType  startLR;
+  startLR.Fill(0);
+  sizeLR[0] = 50;
+  sizeLR[1] = 40;
+  largestRegion.SetSize(sizeLR);
+  largestRegion.SetIndex(startLR);
+  out->SetRegions(largestRegion);
+
+  out->Allocate();
+
+  // Fill with the desired value
+  itk::ImageRegionIterator<InputFrameType> iter(out, largestRegion);
+  while (!iter.IsAtEnd())
+  {
+    iter.Set(val);
+    ++iter;
+  }
+
+  return out;
+}
+
+} // end namespace VideoFilterOutputBatchSizeTest
+} // end namespace itk
+
+
+/**
+ * Main test
+ */
+int
+itkVideoFilterOutputBatchSizeTest(int, char *[])
+{
+  // Set up an input VideoStream
+  auto          inputVideo = InputVideoType::New();
+  SizeValueType numInputFrames = 20;
+  inputVideo->SetNumberOfBuffers(numInputFrames);
+  itk::TemporalRegion inputTempRegion;
+  inputTempRegion.SetFrameStart(0);
+  inputTempRegion.SetFrameDuration(numInputFrames);
+  inputVideo->SetLargestPossibleTemporalRegion(inputTempRegion);
+  inputVideo->SetRequestedTemporalRegion(inputTempRegion);
+  inputVideo->SetBufferedTemporalRegion(inputTempRegion);
+  for (SizeValueType i = 0; i < numInputFrames; ++i)
+  {
+    inputVideo->SetFrame(i, itk::VideoFilterOutputBatchSizeTest::CreateInputFrame(i));
+  }
+
+  // The pixel checked in each output frame
+  OutputFrameType::IndexType checkPx;
+  checkPx[0] = inputVideo->GetFrame(0)->GetLargestPossibleRegion().GetSize()[0] - 1;
+  checkPx[1] = inputVideo->GetFrame(0)->GetLargestPossibleRegion().GetSize()[1] - 1;
+
+  // Process the video with a range of batch sizes, including the default of 1,
+  // a size that divides the number of output frames unevenly, and a size
+  // larger than the number of output frames
+  using FilterType = itk::FrameAverageVideoFilter<InputVideoType, OutputVideoType>;
+  const SizeValueType batchSizes[] = { 1, 3, 4, 19, 25 };
+  for (SizeValueType batchSize : batchSizes)
+  {
+    auto filter = FilterType::New();
+    filter->SetInput(inputVideo);
+    filter->SetNumberOfFrames(2);
+
+    if (filter->GetOutputBatchSize() != 1)
+    {
+      std::cerr << "OutputBatchSize does not default to 1" << std::endl;
+      return EXIT_FAILURE;
+    }
+    filter->SetOutputBatchSize(batchSize);
+    ITK_TEST_SET_GET_VALUE(batchSize, filter->GetOutputBatchSize());
+
+    filter->UpdateOutputInformation();
+    itk::TemporalRegion outputLargestTempRegion = filter->GetOutput()->GetLargestPossibleTemporalRegion();
+    SizeValueType       outputStart = outputLargestTempRegion.GetFrameStart();
+    SizeValueType       outputDuration = outputLargestTempRegion.GetFrameDuration();
+    if (outputStart != 0 || outputDuration != numInputFrames - 1)
+    {
+      std::cerr << "output's LargestPossibleTemporalRegion incorrect with batch size " << batchSize << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    // Process the entire video in one update and check the results
+    ITK_TRY_EXPECT_NO_EXCEPTION(filter->Update());
+    for (SizeValueType i = outputStart; i < outputStart + outputDuration; ++i)
+    {
+      OutputPixelType expectedVal = (OutputPixelType)(i + (i + 1)) / 2.0;
+      OutputPixelType actualVal = filter->GetOutput()->GetFrame(i)->GetPixel(checkPx);
+      double          eps = 0.00001;
+      if (expectedVal < actualVal - eps || expectedVal > actualVal + eps)
+      {
+        std::cerr << "Filter failed to compute frame " << i << " correctly with batch size " << batchSize << std::endl;
+        std::cerr << "Expected Pixel Val: " << expectedVal << std::endl;
+        std::cerr << "Actual Pixel Val: " << actualVal << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  // Test the clamping of the lower bound
+  auto filter = FilterType::New();
+  filter->SetOutputBatchSize(0);
+  if (filter->GetOutputBatchSize() != 1)
+  {
+    std::cerr << "OutputBatchSize not clamped to a minimum of 1" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
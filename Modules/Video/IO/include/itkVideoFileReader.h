@@ -22,6 +22,9 @@
 #include "itkVideoIOFactory.h"
 #include "itkDefaultConvertPixelTraits.h"
 
+#include <thread>
+#include <vector>
+
 namespace itk
 {
 
@@ -85,6 +88,13 @@ public:
   itkSetMacro(IFrameSafe, bool);
   itkGetMacro(IFrameSafe, bool);
 
+  /** Get/Set AsynchronousPrefetch. If true, the next frame is decoded on a
+   * background thread while downstream filters process the current one, so
+   * sequential pipelines no longer serialize decoding and processing. Off
+   * by default. */
+  itkSetMacro(AsynchronousPrefetch, bool);
+  itkGetMacro(AsynchronousPrefetch, bool);
+
   /** Set up the output information */
   void
   UpdateOutputInformation() override;
@@ -114,7 +124,7 @@ public:
 
 protected:
   VideoFileReader();
-  ~VideoFileReader() override = default;
+  ~VideoFileReader() override;
   void
   PrintSelf(std::ostream & os, Indent indent) const override;
 
@@ -133,6 +143,16 @@ protected:
   void
   InitializeVideoIO();
 
+  /** Wait for an in-flight prefetch. Must be called before any other use
+   * of the VideoIO, which is not thread safe. */
+  void
+  WaitForPrefetch();
+
+  /** Start decoding the indicated frame into the prefetch buffer on the
+   * background thread. Does nothing past the last frame. */
+  void
+  StartPrefetch(FrameOffsetType frameNumber);
+
 private:
   /** The file to read */
   std::string m_FileName;
@@ -147,6 +167,17 @@ private:
   /** Flag to indicate whether to report the last frame as the last IFrame. On
    * by default. */
   bool m_IFrameSafe;
+
+  /** Flag to decode the upcoming frame while the current one is processed
+   * downstream. Off by default. */
+  bool m_AsynchronousPrefetch;
+
+  /** Background decode of the upcoming frame. The raw frame is staged in
+   * m_PrefetchBuffer and converted or copied into the output on use. */
+  std::thread       m_PrefetchThread;
+  std::vector<char> m_PrefetchBuffer;
+  FrameOffsetType   m_PrefetchedFrame;
+  bool              m_PrefetchValid;
 };
 
 } // end namespace itk
@@ -23,6 +23,8 @@
 
 #include "itkVideoFileReader.h"
 
+#include <cstring>
+
 namespace itk
 {
 
@@ -34,6 +36,9 @@ VideoFileReader<TOutputVideoStream>::VideoFileReader()
   m_VideoIO = nullptr;
   m_PixelConversionNeeded = false;
   m_IFrameSafe = true;
+  m_AsynchronousPrefetch = false;
+  m_PrefetchedFrame = 0;
+  m_PrefetchValid = false;
 
   // TemporalProcessObject inherited members
   this->SetUnitOutputNumberOfFrames(1);
@@ -41,10 +46,59 @@ VideoFileReader<TOutputVideoStream>::VideoFileReader()
   this->SetInputStencilCurrentFrameIndex(0);
 }
 
+template <typename TOutputVideoStream>
+VideoFileReader<TOutputVideoStream>::~VideoFileReader()
+{
+  this->WaitForPrefetch();
+}
+
+template <typename TOutputVideoStream>
+void
+VideoFileReader<TOutputVideoStream>::WaitForPrefetch()
+{
+  if (m_PrefetchThread.joinable())
+  {
+    m_PrefetchThread.join();
+  }
+}
+
+template <typename TOutputVideoStream>
+void
+VideoFileReader<TOutputVideoStream>::StartPrefetch(FrameOffsetType frameNumber)
+{
+  const SizeValueType numberOfFrames = this->GetOutput()->GetLargestPossibleTemporalRegion().GetFrameDuration();
+  if (static_cast<SizeValueType>(frameNumber) >= numberOfFrames)
+  {
+    return;
+  }
+
+  m_PrefetchBuffer.resize(m_VideoIO->GetImageSizeInBytes());
+  m_PrefetchValid = false;
+  m_PrefetchedFrame = frameNumber;
+
+  m_PrefetchThread = std::thread([this, frameNumber] {
+    try
+    {
+      if (m_VideoIO->GetCurrentFrame() != frameNumber)
+      {
+        m_VideoIO->SetNextFrameToRead(frameNumber);
+      }
+      m_VideoIO->Read(static_cast<void *>(m_PrefetchBuffer.data()));
+      m_PrefetchValid = true;
+    }
+    catch (...)
+    {
+      // a failed prefetch is retried synchronously when the frame is used
+    }
+  });
+}
+
 template <typename TOutputVideoStream>
 void
 VideoFileReader<TOutputVideoStream>::UpdateOutputInformation()
 {
+  this->WaitForPrefetch();
+
   //
   // Use the VideoIOFactory to generate a VideoIOBase if needed
   //
@@ -119,6 +173,7 @@ template <typename TOutputVideoStream>
 auto
 VideoFileReader<TOutputVideoStream>::GetCurrentPositionFrame() -> FrameOffsetType
 {
+  this->WaitForPrefetch();
   if (m_VideoIO.IsNull())
   {
     this->InitializeVideoIO();
@@ -130,6 +185,7 @@ template <typename TOutputVideoStream>
 auto
 VideoFileReader<TOutputVideoStream>::GetCurrentPositionRatio() -> TemporalRatioType
 {
+  this->WaitForPrefetch();
   if (m_VideoIO.IsNull())
   {
     this->InitializeVideoIO();
@@ -141,6 +197,7 @@ template <typename TOutputVideoStream>
 auto
 VideoFileReader<TOutputVideoStream>::GetCurrentPositionMSec() -> TemporalRatioType
 {
+  this->WaitForPrefetch();
   if (m_VideoIO.IsNull())
   {
     this->InitializeVideoIO();
@@ -152,6 +209,7 @@ template <typename TOutputVideoStream>
 auto
 VideoFileReader<TOutputVideoStream>::GetNumberOfFrames() -> FrameOffsetType
 {
+  this->WaitForPrefetch();
   if (m_VideoIO.IsNull())
   {
     this->InitializeVideoIO();
@@ -163,6 +221,7 @@ template <typename TOutputVideoStream>
 auto
 VideoFileReader<TOutputVideoStream>::GetFramesPerSecond() -> TemporalRatioType
 {
+  this->WaitForPrefetch();
   if (m_VideoIO.IsNull())
   {
     this->InitializeVideoIO();
@@ -225,31 +284,57 @@ VideoFileReader<TOutputVideoStream>::TemporalStreamingGenerateData()
   requestedTemporalRegion = output->GetRequestedTemporalRegion();
   FrameOffsetType frameNum = requestedTemporalRegion.GetFrameStart();
 
-  // Figure out if we need to skip frames
-  FrameOffsetType currentIOFrame = m_VideoIO->GetCurrentFrame();
-  if (frameNum != currentIOFrame)
+  // Wait for a decode started while the previous frame was processed
+  this->WaitForPrefetch();
+
+  if (m_PrefetchValid && m_PrefetchedFrame == frameNum)
   {
-    m_VideoIO->SetNextFrameToRead(frameNum);
+    // Consume the prefetched frame
+    m_PrefetchValid = false;
+    if (this->m_PixelConversionNeeded)
+    {
+      this->DoConvertBuffer(static_cast<void *>(m_PrefetchBuffer.data()), frameNum);
+    }
+    else
+    {
+      FrameType * frame = this->GetOutput()->GetFrame(frameNum);
+      memcpy(reinterpret_cast<void *>(frame->GetBufferPointer()), m_PrefetchBuffer.data(), m_PrefetchBuffer.size());
+    }
   }
-
-  // Read a single frame
-  if (this->m_PixelConversionNeeded)
+  else
   {
-    // Set up temporary buffer for reading
-    size_t bufferSize = m_VideoIO->GetImageSizeInBytes();
-    auto * loadBuffer = new char[bufferSize];
+    // Figure out if we need to skip frames
+    FrameOffsetType currentIOFrame = m_VideoIO->GetCurrentFrame();
+    if (frameNum != currentIOFrame)
+    {
+      m_VideoIO->SetNextFrameToRead(frameNum);
+    }
+
+    // Read a single frame
+    if (this->m_PixelConversionNeeded)
+    {
+      // Set up temporary buffer for reading
+      size_t bufferSize = m_VideoIO->GetImageSizeInBytes();
+      auto * loadBuffer = new char[bufferSize];
 
-    // Read into a temporary buffer
-    this->m_VideoIO->Read(static_cast<void *>(loadBuffer));
+      // Read into a temporary buffer
+      this->m_VideoIO->Read(static_cast<void *>(loadBuffer));
 
-    // Convert the buffer into the output buffer location
-    this->DoConvertBuffer(static_cast<void *>(loadBuffer), frameNum);
-    delete[] loadBuffer;
+      // Convert the buffer into the output buffer location
+      this->DoConvertBuffer(static_cast<void *>(loadBuffer), frameNum);
+      delete[] loadBuffer;
+    }
+    else
+    {
+      FrameType * frame = this->GetOutput()->GetFrame(frameNum);
+      m_VideoIO->Read(reinterpret_cast<void *>(frame->GetBufferPointer()));
+    }
   }
-  else
+
+  // Start decoding the next frame while this one is processed downstream
+  if (m_AsynchronousPrefetch)
   {
-    FrameType * frame = this->GetOutput()->GetFrame(frameNum);
-    m_VideoIO->Read(reinterpret_cast<void *>(frame->GetBufferPointer()));
+    this->StartPrefetch(frameNum + 1);
   }
 
   // Mark ourselves modified
@@ -327,6 +412,7 @@ VideoFileReader<TOutputVideoStream>::PrintSelf(std::ostream & os, Indent indent)
   Superclass::PrintSelf(os, indent);
 
   os << indent << "FileName: " << this->m_FileName << std::endl;
+  os << indent << "AsynchronousPrefetch: " << this->m_AsynchronousPrefetch << std::endl;
   if (m_VideoIO)
   {
     os << indent << "VideoIO:" << std::endl;
@@ -0,0 +1,114 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include <iostream>
+
+#include "itkVideoFileReader.h"
+#include "itkFileListVideoIOFactory.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkTestingMacros.h"
+
+int
+itkVideoFileReaderPrefetchTest(int argc, char * argv[])
+{
+  // Check parameters
+  if (argc != 6)
+  {
+    std::cerr << "Missing parameters." << std::endl;
+    std::cerr << "Usage: " << std::endl;
+    std::cerr << itkNameOfTestExecutableMacro(argv) << " [Video Input]" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Instantiate a new reader
+  using PixelType = itk::RGBPixel<unsigned char>;
+  constexpr unsigned int NumberOfDimensions = 2;
+  using FrameType = itk::Image<PixelType, NumberOfDimensions>;
+  using VideoType = itk::VideoStream<FrameType>;
+  using VideoReaderType = itk::VideoFileReader<VideoType>;
+
+  std::string inFile = "";
+  for (int i = 1; i <= 5; ++i)
+  {
+    inFile = inFile + std::string(argv[i]);
+    if (i != 5)
+    {
+      inFile = inFile + std::string(",");
+    }
+  }
+
+  // I'm still not sure how to handle this right, but for now, just manually
+  // register an FileListVideoIO
+  itk::ObjectFactoryBase::RegisterFactory(itk::FileListVideoIOFactory::New());
+
+  // Read the frames one at a time, synchronously
+  auto synchronousReader = VideoReaderType::New();
+  synchronousReader->SetFileName(inFile.c_str());
+
+  // Read them again with the background decode of the upcoming frame
+  auto prefetchReader = VideoReaderType::New();
+  prefetchReader->SetFileName(inFile.c_str());
+  prefetchReader->SetAsynchronousPrefetch(true);
+  ITK_TEST_SET_GET_VALUE(true, prefetchReader->GetAsynchronousPrefetch());
+
+  synchronousReader->UpdateOutputInformation();
+  prefetchReader->UpdateOutputInformation();
+
+  const itk::SizeValueType numberOfFrames =
+    synchronousReader->GetOutput()->GetLargestPossibleTemporalRegion().GetFrameDuration();
+  if (numberOfFrames != prefetchReader->GetOutput()->GetLargestPossibleTemporalRegion().GetFrameDuration())
+  {
+    std::cerr << "Test failed!" << std::endl;
+    std::cerr << "Prefetching reader reports a different number of frames" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Both readers must produce identical frames
+  for (itk::SizeValueType frameNumber = 0; frameNumber < numberOfFrames; ++frameNumber)
+  {
+    itk::TemporalRegion frameRequest;
+    frameRequest.SetFrameStart(frameNumber);
+    frameRequest.SetFrameDuration(1);
+
+    synchronousReader->GetOutput()->SetRequestedTemporalRegion(frameRequest);
+    ITK_TRY_EXPECT_NO_EXCEPTION(synchronousReader->Update());
+
+    prefetchReader->GetOutput()->SetRequestedTemporalRegion(frameRequest);
+    ITK_TRY_EXPECT_NO_EXCEPTION(prefetchReader->Update());
+
+    const FrameType * expectedFrame = synchronousReader->GetOutput()->GetFrame(frameNumber);
+    const FrameType * prefetchedFrame = prefetchReader->GetOutput()->GetFrame(frameNumber);
+
+    itk::ImageRegionConstIterator<FrameType> expectedIt(expectedFrame, expectedFrame->GetBufferedRegion());
+    itk::ImageRegionConstIterator<FrameType> prefetchedIt(prefetchedFrame, prefetchedFrame->GetBufferedRegion());
+    while (!expectedIt.IsAtEnd())
+    {
+      if (expectedIt.Get() != prefetchedIt.Get())
+      {
+        std::cerr << "Test failed!" << std::endl;
+        std::cerr << "Frame " << frameNumber << " differs between the synchronous and prefetching reader"
+                  << std::endl;
+        return EXIT_FAILURE;
+      }
+      ++expectedIt;
+      ++prefetchedIt;
+    }
+  }
+
+  std::cout << "Test finished" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,100 @@
+#!/usr/bin/env python
+
+description = """
+Find threaded filter implementations that walk contiguous regions with
+per-pixel region iterators instead of ImageScanlineIterator.
+
+The script extracts the bodies of DynamicThreadedGenerateData and
+ThreadedGenerateData implementations from the .hxx files below the given
+directories and reports the ones constructing ImageRegionIterator or
+ImageRegionConstIterator, which iterate pixel by pixel and are measurably
+slower than the scanline iterators over the same regions.
+
+Uses of the WithIndex iterator variants are reported separately: they
+usually indicate an index-dependent pixel computation, where a scanline
+conversion needs the index to be tracked per line by hand and is not
+always worthwhile.
+
+The exit code is the number of files using plain region iterators inside
+a threaded body, so the script can guard against regressions.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+METHOD_RE = re.compile(r"\b(?:Dynamic)?ThreadedGenerateData\s*\(")
+PLAIN_ITERATOR_RE = re.compile(r"\bImageRegion(?:Const)?Iterator\s*<")
+WITH_INDEX_ITERATOR_RE = re.compile(r"\bImageRegion(?:Const)?IteratorWithIndex\s*<")
+
+
+def extract_threaded_bodies(source):
+    """Yield the brace-delimited bodies of the threaded methods in source."""
+    for match in METHOD_RE.finditer(source):
+        brace = source.find("{", match.end())
+        if brace < 0:
+            continue
+        depth = 0
+        for position in range(brace, len(source)):
+            if source[position] == "{":
+                depth += 1
+            elif source[position] == "}":
+                depth -= 1
+                if depth == 0:
+                    yield source[brace : position + 1]
+                    break
+
+
+def scan_file(path):
+    """Return (plain, with_index) iterator use counts in threaded bodies."""
+    with open(path, "r", errors="replace") as source_file:
+        source = source_file.read()
+    plain = 0
+    with_index = 0
+    for body in extract_threaded_bodies(source):
+        with_index += len(WITH_INDEX_ITERATOR_RE.findall(body))
+        plain += len(PLAIN_ITERATOR_RE.findall(body))
+    return plain, with_index
+
+
+def main():
+    parser = argparse.ArgumentParser(description=description)
+    parser.add_argument(
+        "directories",
+        nargs="*",
+        default=["Modules"],
+        help="directories to scan for .hxx files (default: Modules)",
+    )
+    args = parser.parse_args()
+
+    plain_files = []
+    with_index_files = []
+    for directory in args.directories:
+        for root, _, files in os.walk(directory):
+            for name in sorted(files):
+                if not name.endswith(".hxx"):
+                    continue
+                path = os.path.join(root, name)
+                plain, with_index = scan_file(path)
+                if plain:
+                    plain_files.append((path, plain))
+                if with_index:
+                    with_index_files.append((path, with_index))
+
+    if plain_files:
+        print("Threaded bodies using per-pixel region iterators (convert to scanline):")
+        for path, count in plain_files:
+            print("  {} ({} iterator{})".format(path, count, "s" if count > 1 else ""))
+    if with_index_files:
+        print("Threaded bodies using WithIndex iterators (index-dependent, review by hand):")
+        for path, count in with_index_files:
+            print("  {} ({} iterator{})".format(path, count, "s" if count > 1 else ""))
+    if not plain_files and not with_index_files:
+        print("No per-pixel region iterators found in threaded bodies.")
+
+    return len(plain_files)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,58 @@
+# ==========================================================================
+#
+#   Copyright NumFOCUS
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#          http://www.apache.org/licenses/LICENSE-2.0.txt
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+# ==========================================================================*/
+
+import numpy as np
+
+import itk
+
+
+def _median_of_array(arr):
+    # Runs in a worker: itk is already imported there
+    import itk
+
+    return itk.median_image_filter(arr, radius=1)
+
+
+def main():
+    arr = np.zeros((16, 16), dtype=np.uint8)
+    arr[:] = 10
+    arr[8, 8] = 200
+
+    with itk.WorkerPool(number_of_workers=2, preload=["MedianImageFilter"]) as pool:
+        # A plain callable
+        result = pool.submit(_median_of_array, arr).get()
+        assert result.shape == arr.shape
+        assert result[8, 8] == 10
+
+        # A declarative pipeline description
+        description = [
+            ("median_image_filter", {"radius": 1}),
+            ("shift_scale_image_filter", {"shift": 5.0}),
+        ]
+        result = pool.run_pipeline(description, arr).get()
+        assert result[8, 8] == 15
+
+        # The same description can be dispatched repeatedly; workers stay
+        # alive between tasks
+        results = [pool.run_pipeline(description, arr) for _ in range(4)]
+        for async_result in results:
+            assert async_result.get()[8, 8] == 15
+
+
+if __name__ == "__main__":
+    main()
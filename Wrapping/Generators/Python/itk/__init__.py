@@ -27,6 +27,7 @@ from itkConfig import ITK_GLOBAL_VERSION_STRING as __version__
 
 from itk.support.extras import *
 from itk.support.init_helpers import *
+from itk.support.worker_pool import *
 from itk.support.types import (
     itkCType,
     F,
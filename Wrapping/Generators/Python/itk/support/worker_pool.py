@@ -0,0 +1,146 @@
+# ==========================================================================
+#
+#   Copyright NumFOCUS
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#          http://www.apache.org/licenses/LICENSE-2.0.txt
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+# ==========================================================================*/
+
+"""Persistent worker processes that amortize the cost of importing itk.
+
+``import itk`` pays factory registration and (lazy) module import once per
+process. Workloads made of many small jobs — one image per cluster task, for
+example — pay that startup over and over, and it easily dominates the actual
+processing time. A :class:`WorkerPool` keeps interpreter processes alive
+between tasks: each worker imports itk and pre-loads a requested set of
+attributes exactly once, then executes submitted callables or declarative
+pipeline descriptions with millisecond dispatch overhead.
+
+Tasks and results travel through the standard :mod:`multiprocessing`
+machinery, so submitted callables must be picklable (defined at module
+level) and arguments are typically NumPy arrays rather than wrapped ITK
+objects.
+"""
+
+import multiprocessing
+
+__all__ = [
+    "WorkerPool",
+    "run_pipeline_description",
+]
+
+
+def _worker_initializer(preload) -> None:
+    """Import itk in the worker process and pre-load the requested attributes.
+
+    *preload* is either None (import itk, load modules lazily on first use),
+    the string "all" (force-load every submodule) or a sequence of itk
+    attribute names ("MedianImageFilter", "imread", ...) whose lazy
+    submodules are loaded up front.
+    """
+    import itk
+
+    if preload is None:
+        return
+    if preload == "all":
+        itk.force_load()
+        return
+    for attribute in preload:
+        getattr(itk, attribute)
+
+
+def run_pipeline_description(description, data):
+    """Execute a declarative pipeline description on *data*.
+
+    *description* is a sequence of (function_name, keyword_arguments) pairs.
+    Each function name is looked up on the itk package — typically the snake
+    case functional interface, e.g. ("median_image_filter", {"radius": 2}) —
+    and called with the result of the previous step as its first argument.
+    The result of the last step is returned.
+
+    The description only contains names, plain values and NumPy arrays, so it
+    pickles cheaply and the same description can be shipped to any worker.
+    """
+    import itk
+
+    for function_name, keyword_arguments in description:
+        step_function = getattr(itk, function_name)
+        data = step_function(data, **keyword_arguments)
+    return data
+
+
+class WorkerPool:
+    """A pool of persistent interpreter workers with itk pre-imported.
+
+    number_of_workers:
+        Number of worker processes; None uses the CPU count.
+    preload:
+        None to import itk without loading submodules, "all" to force-load
+        everything, or a sequence of itk attribute names to load up front so
+        the first task does not pay the import either.
+    context:
+        The multiprocessing start method; "spawn" (the default) gives every
+        worker a clean interpreter and also works when the parent process
+        already holds threads.
+
+    The pool can be used as a context manager; leaving the context shuts the
+    workers down.
+    """
+
+    def __init__(self, number_of_workers=None, preload=None, context="spawn"):
+        ctx = multiprocessing.get_context(context)
+        self._pool = ctx.Pool(
+            processes=number_of_workers,
+            initializer=_worker_initializer,
+            initargs=(preload,),
+        )
+
+    def submit(self, function, *args, **kwargs):
+        """Run function(*args, **kwargs) on a worker.
+
+        Returns a multiprocessing AsyncResult; call .get() for the value.
+        """
+        return self._pool.apply_async(function, args, kwargs)
+
+    def run_pipeline(self, description, data):
+        """Run a declarative pipeline description on a worker.
+
+        See run_pipeline_description() for the description format. Returns a
+        multiprocessing AsyncResult; call .get() for the result of the last
+        step.
+        """
+        return self._pool.apply_async(run_pipeline_description, (description, data))
+
+    def map(self, function, iterable):
+        """Run function on every item of iterable across the workers."""
+        return self._pool.map(function, iterable)
+
+    def close(self):
+        """Stop accepting tasks and let the workers finish."""
+        self._pool.close()
+
+    def join(self):
+        """Wait for the workers to exit; call close() first."""
+        self._pool.join()
+
+    def shutdown(self):
+        """Stop accepting tasks, wait for running tasks and exit the workers."""
+        self._pool.close()
+        self._pool.join()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        self.shutdown()
+        return False